@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       This example measures the submission latency of small buffer calls
+*       to oneapi::mkl::blas::axpy on a CPU device.
+*
+*       y = alpha * x + y
+*
+*       Each call is submitted on an out-of-order queue with buffers created
+*       with use_host_ptr and waited for before the next one. With the netlib
+*       backend, setting ONEMKL_NETLIB_DIRECT_HOST=1 runs such calls directly
+*       on the calling thread instead of through a host_task, so running the
+*       example with and without it compares the two paths.
+*
+*       The number of calls can be passed as the first argument.
+*
+*
+*******************************************************************************/
+
+// stl includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/mkl.hpp"
+
+#include "example_helper.hpp"
+
+//
+// Submits `calls` axpy calls of length n one after the other and returns the
+// average time per call, in microseconds, from submission to completion.
+//
+double time_axpy_calls(sycl::queue& queue, sycl::buffer<float, 1>& x_buffer,
+                       sycl::buffer<float, 1>& y_buffer, std::int64_t n, float alpha, int calls) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++) {
+        oneapi::mkl::blas::column_major::axpy(queue, n, alpha, x_buffer, 1, y_buffer, 1);
+        queue.wait_and_throw();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(stop - start).count() / calls;
+}
+
+//
+// Main example for the axpy submission latency, consisting of
+// initialization of the x and y vectors, a few warm-up calls, the timed
+// calls and a check of the result.
+//
+void run_axpy_latency_example(const sycl::device& dev, int calls) {
+    std::int64_t n = 16;
+    int warmup = 10;
+    float alpha = 0.5f;
+
+    // Catch asynchronous exceptions
+    auto exception_handler = [](sycl::exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (sycl::exception const& e) {
+                std::cerr << "Caught asynchronous SYCL exception during AXPY:" << std::endl;
+                std::cerr << "\t" << e.what() << std::endl;
+            }
+        }
+        std::exit(2);
+    };
+
+    // create an out-of-order execution queue
+    sycl::queue main_queue(dev, exception_handler);
+
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    std::fill(x.begin(), x.end(), 1.0f);
+    std::fill(y.begin(), y.end(), 0.0f);
+
+    double average_us;
+    {
+        sycl::buffer<float, 1> x_buffer(x.data(), sycl::range<1>(n),
+                                        { sycl::property::buffer::use_host_ptr() });
+        sycl::buffer<float, 1> y_buffer(y.data(), sycl::range<1>(n),
+                                        { sycl::property::buffer::use_host_ptr() });
+
+        time_axpy_calls(main_queue, x_buffer, y_buffer, n, alpha, warmup);
+        average_us = time_axpy_calls(main_queue, x_buffer, y_buffer, n, alpha, calls);
+    }
+
+    //
+    // Post Processing
+    //
+    float expected = alpha * float(warmup + calls);
+    for (std::int64_t i = 0; i < n; i++) {
+        if (std::abs(y[i] - expected) > 1e-3f * expected) {
+            throw std::runtime_error("AXPY result does not match the expected value.");
+        }
+    }
+
+    const char* direct_host = std::getenv("ONEMKL_NETLIB_DIRECT_HOST");
+    std::cout << "\n\t\tAXPY parameters:" << std::endl;
+    std::cout << "\t\t\tn = " << n << ", calls = " << calls << std::endl;
+    std::cout << "\t\t\tONEMKL_NETLIB_DIRECT_HOST = "
+              << (direct_host != nullptr ? direct_host : "(unset)") << std::endl;
+    std::cout << "\n\t\tAverage time per call: " << average_us << " us" << std::endl;
+}
+
+//
+// Description of example setup, apis used and supported floating point type precisions
+//
+void print_example_banner() {
+    std::cout << "" << std::endl;
+    std::cout << "########################################################################"
+              << std::endl;
+    std::cout << "# Submission Latency of Small Buffer Calls Example: " << std::endl;
+    std::cout << "# " << std::endl;
+    std::cout << "# y = alpha * x + y" << std::endl;
+    std::cout << "# " << std::endl;
+    std::cout << "# where x and y are short vectors held in buffers created with" << std::endl;
+    std::cout << "# use_host_ptr, and each call is waited for before the next." << std::endl;
+    std::cout << "# " << std::endl;
+    std::cout << "# Using apis:" << std::endl;
+    std::cout << "#   axpy" << std::endl;
+    std::cout << "# " << std::endl;
+    std::cout << "# Using single precision (float) data type" << std::endl;
+    std::cout << "# " << std::endl;
+    std::cout << "# Run with ONEMKL_NETLIB_DIRECT_HOST=1 and without it to compare the"
+              << std::endl;
+    std::cout << "# direct host path of the netlib backend with the host_task path." << std::endl;
+    std::cout << "# " << std::endl;
+    std::cout << "########################################################################"
+              << std::endl;
+    std::cout << std::endl;
+}
+
+//
+// Main entry point for example
+//
+int main(int argc, char** argv) {
+    print_example_banner();
+
+    int calls = 1000;
+    if (argc > 1) {
+        calls = std::max(1, std::atoi(argv[1]));
+    }
+
+    try {
+        sycl::device dev((sycl::cpu_selector()));
+
+        std::cout << "Running BLAS AXPY submission latency example on CPU device." << std::endl;
+        std::cout << "Device name is: " << dev.get_info<sycl::info::device::name>() << std::endl;
+        std::cout << "Running with single precision real data type:" << std::endl;
+
+        run_axpy_latency_example(dev, calls);
+        std::cout << "BLAS AXPY submission latency example ran OK." << std::endl;
+    }
+    catch (sycl::exception const& e) {
+        std::cerr << "Caught synchronous SYCL exception during AXPY:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        std::cerr << "\tSYCL error code: " << e.code().value() << std::endl;
+        return 1;
+    }
+    catch (std::exception const& e) {
+        std::cerr << "Caught std::exception during AXPY:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
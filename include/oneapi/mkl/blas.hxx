@@ -1708,6 +1708,300 @@ static inline void omatadd(sycl::queue &queue, transpose transa, transpose trans
                     c, ldc);
 }
 
+static inline void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb,
+                                 std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                 sycl::buffer<float, 1> &a, std::int64_t lda,
+                                 sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                 sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t levels) {
+    detail::gemm_strassen(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                          ldb, beta, c, ldc, levels);
+}
+
+static inline void gemm_strassen(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
+    sycl::buffer<double, 1> &b, std::int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+    std::int64_t ldc, std::int64_t levels) {
+    detail::gemm_strassen(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                          ldb, beta, c, ldc, levels);
+}
+
+static inline void gemm3m(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+    std::int64_t lda, sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+    std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                   beta, c, ldc);
+}
+
+static inline void gemm3m(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+    std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                   beta, c, ldc);
+}
+
+static inline void axpy_dot(sycl::queue &queue, std::int64_t n, float alpha,
+                            sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+                            std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+                            sycl::buffer<float, 1> &result) {
+    detail::axpy_dot(get_device_id(queue), queue, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+static inline void axpy_dot(
+    sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x, std::int64_t incx,
+    sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+    sycl::buffer<double, 1> &result) {
+    detail::axpy_dot(get_device_id(queue), queue, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+static inline void axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x, std::int64_t incx,
+    float beta, sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &result) {
+    detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy, result);
+}
+
+static inline void axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x, std::int64_t incx,
+    double beta, sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy, result);
+}
+
+static inline void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                        sycl::buffer<float, 1> &z, std::int64_t incz,
+                        sycl::buffer<float, 1> &result) {
+    detail::dot2(get_device_id(queue), queue, n, x, incx, y, incy, z, incz, result);
+}
+
+static inline void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                        sycl::buffer<double, 1> &z, std::int64_t incz,
+                        sycl::buffer<double, 1> &result) {
+    detail::dot2(get_device_id(queue), queue, n, x, incx, y, incy, z, incz, result);
+}
+
+static inline void dot_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                             std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1> &y,
+                             std::int64_t incy, std::int64_t stridey,
+                             sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    detail::dot_batch(get_device_id(queue), queue, n, x, incx, stridex, y, incy, stridey, result,
+                      batch_size);
+}
+
+static inline void dot_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                             std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1> &y,
+                             std::int64_t incy, std::int64_t stridey,
+                             sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    detail::dot_batch(get_device_id(queue), queue, n, x, incx, stridex, y, incy, stridey, result,
+                      batch_size);
+}
+
+static inline void nrm2_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                              std::int64_t incx, std::int64_t stridex,
+                              sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void nrm2_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                              std::int64_t incx, std::int64_t stridex,
+                              sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void nrm2_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void nrm2_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void asum_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                              std::int64_t incx, std::int64_t stridex,
+                              sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    detail::asum_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void asum_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                              std::int64_t incx, std::int64_t stridex,
+                              sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    detail::asum_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void asum_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    detail::asum_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void asum_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    detail::asum_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void iamax_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                               std::int64_t incx, std::int64_t stridex,
+                               sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    detail::iamax_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void iamax_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                               std::int64_t incx, std::int64_t stridex,
+                               sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    detail::iamax_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void iamax_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    detail::iamax_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void iamax_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    detail::iamax_batch(get_device_id(queue), queue, n, x, incx, stridex, result, batch_size);
+}
+
+static inline void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                        sycl::buffer<float, 1> &c, std::int64_t ldc, compute_mode mode) {
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                 c, ldc, mode);
+}
+
+static inline void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+                        std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                        sycl::buffer<double, 1> &c, std::int64_t ldc, compute_mode mode) {
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                 c, ldc, mode);
+}
+
+static inline void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                        sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                        std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c,
+                        std::int64_t ldc, compute_mode mode) {
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                 c, ldc, mode);
+}
+
+static inline void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                        sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                        std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c,
+                        std::int64_t ldc, compute_mode mode) {
+    detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                 c, ldc, mode);
+}
+
+template <typename fp_type>
+static inline std::int64_t gemm_pack_get_size(sycl::queue &queue, pack_matrix which, std::int64_t m,
+                                              std::int64_t n, std::int64_t k) {
+    return detail::gemm_pack_get_size<fp_type>(get_device_id(queue), queue, which, m, n, k);
+}
+
+static inline void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                             std::int64_t lda, sycl::buffer<float, 1> &packed) {
+    detail::gemm_pack(get_device_id(queue), queue, which, trans, m, n, k, alpha, a, lda, packed);
+}
+
+static inline void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t k, double alpha,
+                             sycl::buffer<double, 1> &a, std::int64_t lda,
+                             sycl::buffer<double, 1> &packed) {
+    detail::gemm_pack(get_device_id(queue), queue, which, trans, m, n, k, alpha, a, lda, packed);
+}
+
+static inline void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                             sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>, 1> &packed) {
+    detail::gemm_pack(get_device_id(queue), queue, which, trans, m, n, k, alpha, a, lda, packed);
+}
+
+static inline void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                             sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>, 1> &packed) {
+    detail::gemm_pack(get_device_id(queue), queue, which, trans, m, n, k, alpha, a, lda, packed);
+}
+
+static inline void gemm_compute(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, sycl::buffer<float, 1> &packed, sycl::buffer<float, 1> &b, std::int64_t ldb,
+    float beta, sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    detail::gemm_compute(get_device_id(queue), queue, which, trans, m, n, k, packed, b, ldb, beta,
+                         c, ldc);
+}
+
+static inline void gemm_compute(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, sycl::buffer<double, 1> &packed, sycl::buffer<double, 1> &b, std::int64_t ldb,
+    double beta, sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    detail::gemm_compute(get_device_id(queue), queue, which, trans, m, n, k, packed, b, ldb, beta,
+                         c, ldc);
+}
+
+static inline void gemm_compute(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, sycl::buffer<std::complex<float>, 1> &packed,
+    sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    detail::gemm_compute(get_device_id(queue), queue, which, trans, m, n, k, packed, b, ldb, beta,
+                         c, ldc);
+}
+
+static inline void gemm_compute(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, sycl::buffer<std::complex<double>, 1> &packed,
+    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    detail::gemm_compute(get_device_id(queue), queue, which, trans, m, n, k, packed, b, ldb, beta,
+                         c, ldc);
+}
+
+static inline void gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+    sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+    std::int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                          ldb, beta, c, ldc, bias, epilogue);
+}
+
+static inline void gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
+    sycl::buffer<double, 1> &b, std::int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+    std::int64_t ldc, sycl::buffer<double, 1> &bias, epilogue_desc epilogue) {
+    detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                          ldb, beta, c, ldc, bias, epilogue);
+}
+
+static inline void gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+    sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c,
+    std::int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                          ldb, beta, c, ldc, bias, epilogue);
+}
+
 // USM APIs
 
 static inline sycl::event asum(sycl::queue &queue, std::int64_t n,
@@ -4293,3 +4587,536 @@ static inline sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, s
                                        ldb, group_count, groupsize, dependencies);
     return done;
 }
+
+static inline sycl::event gemm_strassen(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc, std::int64_t levels,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_strassen(get_device_id(queue), queue, transa, transb, m, n, k, alpha,
+                                      a, lda, b, ldb, beta, c, ldc, levels, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_strassen(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *a, std::int64_t lda, const double *b,
+    std::int64_t ldb, double beta, double *c, std::int64_t ldc, std::int64_t levels,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_strassen(get_device_id(queue), queue, transa, transb, m, n, k, alpha,
+                                      a, lda, b, ldb, beta, c, ldc, levels, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm3m(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                               b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm3m(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm3m(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                               b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done =
+        detail::gemm_out_of_core(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                 lda, b, ldb, beta, c, ldc, max_memory, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *a, std::int64_t lda, const double *b,
+    std::int64_t ldb, double beta, double *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done =
+        detail::gemm_out_of_core(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                 lda, b, ldb, beta, c, ldc, max_memory, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done =
+        detail::gemm_out_of_core(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                 lda, b, ldb, beta, c, ldc, max_memory, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done =
+        detail::gemm_out_of_core(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a,
+                                 lda, b, ldb, beta, c, ldc, max_memory, dependencies);
+    return done;
+}
+
+static inline sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, float alpha, const float *x,
+                                   std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                                   std::int64_t incz, float *result,
+                                   const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpy_dot(get_device_id(queue), queue, n, alpha, x, incx, y, incy, z, incz,
+                                 result, dependencies);
+    return done;
+}
+
+static inline sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, double alpha,
+                                   const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                                   const double *z, std::int64_t incz, double *result,
+                                   const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpy_dot(get_device_id(queue), queue, n, alpha, x, incx, y, incy, z, incz,
+                                 result, dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx, float beta,
+    float *y, std::int64_t incy, float *result, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                                   result, dependencies);
+    return done;
+}
+
+static inline sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, double alpha,
+                                     const double *x, std::int64_t incx, double beta, double *y,
+                                     std::int64_t incy, double *result,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::axpby_nrm2(get_device_id(queue), queue, n, alpha, x, incx, beta, y, incy,
+                                   result, dependencies);
+    return done;
+}
+
+static inline sycl::event dot2(sycl::queue &queue, std::int64_t n, const float *x,
+                               std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                               std::int64_t incz, float *result,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::dot2(get_device_id(queue), queue, n, x, incx, y, incy, z, incz, result,
+                             dependencies);
+    return done;
+}
+
+static inline sycl::event dot2(sycl::queue &queue, std::int64_t n, const double *x,
+                               std::int64_t incx, const double *y, std::int64_t incy,
+                               const double *z, std::int64_t incz, double *result,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::dot2(get_device_id(queue), queue, n, x, incx, y, incy, z, incz, result,
+                             dependencies);
+    return done;
+}
+
+static inline sycl::event dot_batch(
+    sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+    const float *y, std::int64_t incy, std::int64_t stridey, float *result, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::dot_batch(get_device_id(queue), queue, n, x, incx, stridex, y, incy,
+                                  stridey, result, batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event dot_batch(
+    sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, std::int64_t stridex,
+    const double *y, std::int64_t incy, std::int64_t stridey, double *result,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::dot_batch(get_device_id(queue), queue, n, x, incx, stridex, y, incy,
+                                  stridey, result, batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event dot_batch(
+    sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx, const float **y,
+    std::int64_t *incy, float *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::dot_batch(get_device_id(queue), queue, n, x, incx, y, incy, result,
+                                  group_count, group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event dot_batch(
+    sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx, const double **y,
+    std::int64_t *incy, double *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::dot_batch(get_device_id(queue), queue, n, x, incx, y, incy, result,
+                                  group_count, group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event nrm2_batch(
+    sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+    float *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event nrm2_batch(
+    sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, std::int64_t stridex,
+    double *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event nrm2_batch(sycl::queue &queue, std::int64_t n,
+                                     const std::complex<float> *x, std::int64_t incx,
+                                     std::int64_t stridex, float *result, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event nrm2_batch(sycl::queue &queue, std::int64_t n,
+                                     const std::complex<double> *x, std::int64_t incx,
+                                     std::int64_t stridex, double *result, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event nrm2_batch(sycl::queue &queue, std::int64_t *n, const float **x,
+                                     std::int64_t *incx, float *result, std::int64_t group_count,
+                                     std::int64_t *group_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                   group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event nrm2_batch(sycl::queue &queue, std::int64_t *n, const double **x,
+                                     std::int64_t *incx, double *result, std::int64_t group_count,
+                                     std::int64_t *group_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                   group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event nrm2_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+    float *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                   group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event nrm2_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+    double *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::nrm2_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                   group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event asum_batch(
+    sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+    float *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::asum_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event asum_batch(
+    sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, std::int64_t stridex,
+    double *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::asum_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event asum_batch(sycl::queue &queue, std::int64_t n,
+                                     const std::complex<float> *x, std::int64_t incx,
+                                     std::int64_t stridex, float *result, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::asum_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event asum_batch(sycl::queue &queue, std::int64_t n,
+                                     const std::complex<double> *x, std::int64_t incx,
+                                     std::int64_t stridex, double *result, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::asum_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                   batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event asum_batch(sycl::queue &queue, std::int64_t *n, const float **x,
+                                     std::int64_t *incx, float *result, std::int64_t group_count,
+                                     std::int64_t *group_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::asum_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                   group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event asum_batch(sycl::queue &queue, std::int64_t *n, const double **x,
+                                     std::int64_t *incx, double *result, std::int64_t group_count,
+                                     std::int64_t *group_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::asum_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                   group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event asum_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+    float *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::asum_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                   group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event asum_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+    double *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::asum_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                   group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event iamax_batch(sycl::queue &queue, std::int64_t n, const float *x,
+                                      std::int64_t incx, std::int64_t stridex, std::int64_t *result,
+                                      std::int64_t batch_size,
+                                      const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::iamax_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                    batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event iamax_batch(sycl::queue &queue, std::int64_t n, const double *x,
+                                      std::int64_t incx, std::int64_t stridex, std::int64_t *result,
+                                      std::int64_t batch_size,
+                                      const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::iamax_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                    batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event iamax_batch(
+    sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+    std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::iamax_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                    batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event iamax_batch(
+    sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+    std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::iamax_batch(get_device_id(queue), queue, n, x, incx, stridex, result,
+                                    batch_size, dependencies);
+    return done;
+}
+
+static inline sycl::event iamax_batch(sycl::queue &queue, std::int64_t *n, const float **x,
+                                      std::int64_t *incx, std::int64_t *result,
+                                      std::int64_t group_count, std::int64_t *group_size,
+                                      const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::iamax_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                    group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event iamax_batch(sycl::queue &queue, std::int64_t *n, const double **x,
+                                      std::int64_t *incx, std::int64_t *result,
+                                      std::int64_t group_count, std::int64_t *group_size,
+                                      const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::iamax_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                    group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event iamax_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+    std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::iamax_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                    group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event iamax_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+    std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::iamax_batch(get_device_id(queue), queue, n, x, incx, result, group_count,
+                                    group_size, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb,
+                               std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                               const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
+                               float beta, float *c, std::int64_t ldc, compute_mode mode,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, mode, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb,
+                               std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                               const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
+                               double beta, double *c, std::int64_t ldc, compute_mode mode,
+                               const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, mode, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, compute_mode mode,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, mode, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, compute_mode mode,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                             ldb, beta, c, ldc, mode, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                    const float *a, std::int64_t lda, float *packed,
+                                    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_pack(get_device_id(queue), queue, which, trans, m, n, k, alpha, a, lda,
+                                  packed, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                    const double *a, std::int64_t lda, double *packed,
+                                    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_pack(get_device_id(queue), queue, which, trans, m, n, k, alpha, a, lda,
+                                  packed, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_pack(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    std::complex<float> *packed, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_pack(get_device_id(queue), queue, which, trans, m, n, k, alpha, a, lda,
+                                  packed, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_pack(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    std::complex<double> *packed, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_pack(get_device_id(queue), queue, which, trans, m, n, k, alpha, a, lda,
+                                  packed, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_compute(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *packed, const float *b, std::int64_t ldb, float beta, float *c,
+    std::int64_t ldc, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_compute(get_device_id(queue), queue, which, trans, m, n, k, packed, b,
+                                     ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_compute(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *packed, const double *b, std::int64_t ldb, double beta, double *c,
+    std::int64_t ldc, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_compute(get_device_id(queue), queue, which, trans, m, n, k, packed, b,
+                                     ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_compute(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const std::complex<float> *packed, const std::complex<float> *b,
+    std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_compute(get_device_id(queue), queue, which, trans, m, n, k, packed, b,
+                                     ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_compute(
+    sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const std::complex<double> *packed, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_compute(get_device_id(queue), queue, which, trans, m, n, k, packed, b,
+                                     ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
+    float beta, float *c, std::int64_t ldc, const float *bias, epilogue_desc epilogue,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, m, n, k, alpha,
+                                      a, lda, b, ldb, beta, c, ldc, bias, epilogue, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, double alpha, const double *a, std::int64_t lda, const double *b,
+    std::int64_t ldb, double beta, double *c, std::int64_t ldc, const double *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, m, n, k, alpha,
+                                      a, lda, b, ldb, beta, c, ldc, bias, epilogue, dependencies);
+    return done;
+}
+
+static inline sycl::event gemm_epilogue(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *b, std::int64_t ldb,
+    float beta, bfloat16 *c, std::int64_t ldc, const float *bias, epilogue_desc epilogue,
+    const std::vector<sycl::event> &dependencies = {}) {
+    auto done = detail::gemm_epilogue(get_device_id(queue), queue, transa, transb, m, n, k, alpha,
+                                      a, lda, b, ldb, beta, c, ldc, bias, epilogue, dependencies);
+    return done;
+}
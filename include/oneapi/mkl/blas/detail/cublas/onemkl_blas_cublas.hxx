@@ -994,6 +994,178 @@ void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
              std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
              sycl::buffer<std::complex<double>, 1> &c, int64_t ldc);
 
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, int64_t levels);
+
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, int64_t levels);
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc);
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc);
+
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result);
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result);
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result);
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result);
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result);
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result);
+
+void dot_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+               int64_t stridex, sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey,
+               sycl::buffer<float, 1> &result, int64_t batch_size);
+
+void dot_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+               int64_t stridex, sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+               sycl::buffer<double, 1> &result, int64_t batch_size);
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size);
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size);
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size);
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size);
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size);
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size);
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size);
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size);
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                 int64_t stridex, sycl::buffer<int64_t, 1> &result, int64_t batch_size);
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                 int64_t stridex, sycl::buffer<int64_t, 1> &result, int64_t batch_size);
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                 int64_t incx, int64_t stridex, sycl::buffer<int64_t, 1> &result,
+                 int64_t batch_size);
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                 int64_t incx, int64_t stridex, sycl::buffer<int64_t, 1> &result,
+                 int64_t batch_size);
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+          float alpha, sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &b,
+          int64_t ldb, float beta, sycl::buffer<float, 1> &c, int64_t ldc, compute_mode mode);
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+          double alpha, sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &b,
+          int64_t ldb, double beta, sycl::buffer<double, 1> &c, int64_t ldc, compute_mode mode);
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+          std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+          sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+          sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, compute_mode mode);
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+          std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+          sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+          sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, compute_mode mode);
+
+template <typename fp_type>
+int64_t gemm_pack_get_size(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n, int64_t k);
+template <>
+int64_t gemm_pack_get_size<float>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                  int64_t k);
+template <>
+int64_t gemm_pack_get_size<double>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                   int64_t k);
+template <>
+int64_t gemm_pack_get_size<std::complex<float>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                int64_t n, int64_t k);
+template <>
+int64_t gemm_pack_get_size<std::complex<double>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                 int64_t n, int64_t k);
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+               sycl::buffer<float, 1> &packed);
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+               sycl::buffer<double, 1> &packed);
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+               int64_t lda, sycl::buffer<std::complex<float>, 1> &packed);
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+               int64_t lda, sycl::buffer<std::complex<double>, 1> &packed);
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<float, 1> &packed, sycl::buffer<float, 1> &b, int64_t ldb,
+                  float beta, sycl::buffer<float, 1> &c, int64_t ldc);
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<double, 1> &packed, sycl::buffer<double, 1> &b,
+                  int64_t ldb, double beta, sycl::buffer<double, 1> &c, int64_t ldc);
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<std::complex<float>, 1> &packed,
+                  sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+                  sycl::buffer<std::complex<float>, 1> &c, int64_t ldc);
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<std::complex<double>, 1> &packed,
+                  sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+                  sycl::buffer<std::complex<double>, 1> &c, int64_t ldc);
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue);
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, sycl::buffer<double, 1> &bias, epilogue_desc epilogue);
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue);
+
 // USM APIs
 
 sycl::event asum(sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
@@ -2310,3 +2482,263 @@ sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, int64_t* m, int
                            std::complex<double>* alpha, std::complex<double>** ab, int64_t* lda,
                            int64_t* ldb, int64_t group_count, int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies = {});
+
+sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                          int64_t levels, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                          const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                          int64_t levels, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                   const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                   int64_t lda, const std::complex<double> *b, int64_t ldb,
+                   std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_out_of_core(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                             const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                             int64_t max_memory, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_out_of_core(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                             const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                             int64_t max_memory, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+    const std::complex<float> *b, int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+    int64_t ldc, int64_t max_memory, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+    const std::complex<double> *b, int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+    int64_t ldc, int64_t max_memory, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event dot_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                      const float *y, int64_t incy, int64_t stridey, float *result,
+                      int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event dot_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                      const double *y, int64_t incy, int64_t stridey, double *result,
+                      int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event dot_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                      const float **y, int64_t *incy, float *result, int64_t group_count,
+                      int64_t *group_size, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event dot_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                      const double **y, int64_t *incy, double *result, int64_t group_count,
+                      int64_t *group_size, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                       float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                       int64_t stridex, float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                       double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                       int64_t *incx, double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                       float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                       int64_t stridex, float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                       double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                       int64_t *incx, double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies = {});
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                        int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                        int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x,
+                        int64_t *incx, int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                        int64_t *incx, int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const float *a, int64_t lda, const float *b, int64_t ldb,
+                 float beta, float *c, int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, double alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, double beta, double *c, int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                 std::complex<float> *c, int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                 const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                 std::complex<double> *c, int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, float alpha, const float *a, int64_t lda, float *packed,
+                      const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, double alpha, const double *a, int64_t lda, double *packed,
+                      const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                      int64_t lda, std::complex<float> *packed,
+                      const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                      int64_t lda, std::complex<double> *packed,
+                      const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const float *packed, const float *b, int64_t ldb,
+                         float beta, float *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const double *packed, const double *b, int64_t ldb,
+                         double beta, double *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const std::complex<float> *packed,
+                         const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                         std::complex<float> *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const std::complex<double> *packed,
+                         const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                         std::complex<double> *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                          const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                          const double *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, bfloat16 *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies = {});
@@ -1224,6 +1224,231 @@ ONEMKL_EXPORT void omatadd(sycl::queue &queue, oneapi::mkl::transpose transa,
                            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
+ONEMKL_EXPORT void gemm_strassen(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+    std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+    sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t levels);
+
+ONEMKL_EXPORT void gemm_strassen(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+    std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+    sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t levels);
+
+ONEMKL_EXPORT void gemm3m(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm3m(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void axpy_dot(sycl::queue &queue, std::int64_t n, float alpha,
+                            sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+                            std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+                            sycl::buffer<float, 1> &result);
+
+ONEMKL_EXPORT void axpy_dot(
+    sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x, std::int64_t incx,
+    sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+    sycl::buffer<double, 1> &result);
+
+ONEMKL_EXPORT void axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x, std::int64_t incx,
+    float beta, sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &result);
+
+ONEMKL_EXPORT void axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x, std::int64_t incx,
+    double beta, sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result);
+
+ONEMKL_EXPORT void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                        sycl::buffer<float, 1> &z, std::int64_t incz,
+                        sycl::buffer<float, 1> &result);
+
+ONEMKL_EXPORT void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                        sycl::buffer<double, 1> &z, std::int64_t incz,
+                        sycl::buffer<double, 1> &result);
+
+ONEMKL_EXPORT void dot_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                             std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1> &y,
+                             std::int64_t incy, std::int64_t stridey,
+                             sycl::buffer<float, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void dot_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                             std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1> &y,
+                             std::int64_t incy, std::int64_t stridey,
+                             sycl::buffer<double, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void nrm2_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                              std::int64_t incx, std::int64_t stridex,
+                              sycl::buffer<float, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void nrm2_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                              std::int64_t incx, std::int64_t stridex,
+                              sycl::buffer<double, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void nrm2_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void nrm2_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void asum_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                              std::int64_t incx, std::int64_t stridex,
+                              sycl::buffer<float, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void asum_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                              std::int64_t incx, std::int64_t stridex,
+                              sycl::buffer<double, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void asum_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void asum_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void iamax_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                               std::int64_t incx, std::int64_t stridex,
+                               sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void iamax_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                               std::int64_t incx, std::int64_t stridex,
+                               sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void iamax_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void iamax_batch(
+    sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+    std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size);
+
+ONEMKL_EXPORT void gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+    std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+    sycl::buffer<float, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+
+ONEMKL_EXPORT void gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+    std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+    sycl::buffer<double, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+
+ONEMKL_EXPORT void gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+
+ONEMKL_EXPORT void gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+
+template <typename fp_type>
+std::int64_t gemm_pack_get_size(sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m,
+                                std::int64_t n, std::int64_t k);
+template <>
+ONEMKL_EXPORT std::int64_t gemm_pack_get_size<float>(sycl::queue &queue,
+                                                     oneapi::mkl::pack_matrix which, std::int64_t m,
+                                                     std::int64_t n, std::int64_t k);
+template <>
+ONEMKL_EXPORT std::int64_t gemm_pack_get_size<double>(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+    std::int64_t k);
+template <>
+ONEMKL_EXPORT std::int64_t gemm_pack_get_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+    std::int64_t k);
+template <>
+ONEMKL_EXPORT std::int64_t gemm_pack_get_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+    std::int64_t k);
+
+ONEMKL_EXPORT void gemm_pack(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                             std::int64_t lda, sycl::buffer<float, 1> &packed);
+
+ONEMKL_EXPORT void gemm_pack(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+                             std::int64_t lda, sycl::buffer<double, 1> &packed);
+
+ONEMKL_EXPORT void gemm_pack(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, std::complex<float> alpha,
+                             sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>, 1> &packed);
+
+ONEMKL_EXPORT void gemm_pack(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, std::complex<double> alpha,
+                             sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>, 1> &packed);
+
+ONEMKL_EXPORT void gemm_compute(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, sycl::buffer<float, 1> &packed,
+                                sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                                sycl::buffer<float, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm_compute(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, sycl::buffer<double, 1> &packed,
+                                sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                                sycl::buffer<double, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm_compute(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1> &packed,
+    sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm_compute(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1> &packed,
+    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa,
+                                 oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                                 std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                                 std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb,
+                                 float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+                                 sycl::buffer<float, 1> &bias, oneapi::mkl::epilogue_desc epilogue);
+
+ONEMKL_EXPORT void gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+    std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+    sycl::buffer<double, 1> &c, std::int64_t ldc, sycl::buffer<double, 1> &bias,
+    oneapi::mkl::epilogue_desc epilogue);
+
+ONEMKL_EXPORT void gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+    std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+    sycl::buffer<oneapi::mkl::bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+    oneapi::mkl::epilogue_desc epilogue);
+
 // USM APIs
 
 ONEMKL_EXPORT sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa,
@@ -2867,3 +3092,311 @@ ONEMKL_EXPORT sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, s
                                          std::int64_t* ldb, std::int64_t group_count,
                                          std::int64_t* groupsize,
                                          const std::vector<sycl::event>& dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_strassen(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, std::int64_t levels,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_strassen(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    std::int64_t levels, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm3m(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm3m(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_out_of_core(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_out_of_core(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_out_of_core(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_out_of_core(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, float alpha, const float *x,
+                                   std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                                   std::int64_t incz, float *result,
+                                   const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, double alpha,
+                                   const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                                   const double *z, std::int64_t incz, double *result,
+                                   const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby_nrm2(
+    sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx, float beta,
+    float *y, std::int64_t incy, float *result, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, double alpha,
+                                     const double *x, std::int64_t incx, double beta, double *y,
+                                     std::int64_t incy, double *result,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event dot2(sycl::queue &queue, std::int64_t n, const float *x,
+                               std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                               std::int64_t incz, float *result,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event dot2(sycl::queue &queue, std::int64_t n, const double *x,
+                               std::int64_t incx, const double *y, std::int64_t incy,
+                               const double *z, std::int64_t incz, double *result,
+                               const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event dot_batch(
+    sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+    const float *y, std::int64_t incy, std::int64_t stridey, float *result, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event dot_batch(
+    sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, std::int64_t stridex,
+    const double *y, std::int64_t incy, std::int64_t stridey, double *result,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event dot_batch(
+    sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx, const float **y,
+    std::int64_t *incy, float *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event dot_batch(
+    sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx, const double **y,
+    std::int64_t *incy, double *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event nrm2_batch(
+    sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+    float *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event nrm2_batch(
+    sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, std::int64_t stridex,
+    double *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event nrm2_batch(sycl::queue &queue, std::int64_t n,
+                                     const std::complex<float> *x, std::int64_t incx,
+                                     std::int64_t stridex, float *result, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event nrm2_batch(sycl::queue &queue, std::int64_t n,
+                                     const std::complex<double> *x, std::int64_t incx,
+                                     std::int64_t stridex, double *result, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event nrm2_batch(sycl::queue &queue, std::int64_t *n, const float **x,
+                                     std::int64_t *incx, float *result, std::int64_t group_count,
+                                     std::int64_t *group_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event nrm2_batch(sycl::queue &queue, std::int64_t *n, const double **x,
+                                     std::int64_t *incx, double *result, std::int64_t group_count,
+                                     std::int64_t *group_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event nrm2_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+    float *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event nrm2_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+    double *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event asum_batch(
+    sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+    float *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event asum_batch(
+    sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, std::int64_t stridex,
+    double *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event asum_batch(sycl::queue &queue, std::int64_t n,
+                                     const std::complex<float> *x, std::int64_t incx,
+                                     std::int64_t stridex, float *result, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event asum_batch(sycl::queue &queue, std::int64_t n,
+                                     const std::complex<double> *x, std::int64_t incx,
+                                     std::int64_t stridex, double *result, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event asum_batch(sycl::queue &queue, std::int64_t *n, const float **x,
+                                     std::int64_t *incx, float *result, std::int64_t group_count,
+                                     std::int64_t *group_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event asum_batch(sycl::queue &queue, std::int64_t *n, const double **x,
+                                     std::int64_t *incx, double *result, std::int64_t group_count,
+                                     std::int64_t *group_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event asum_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+    float *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event asum_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+    double *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event iamax_batch(sycl::queue &queue, std::int64_t n, const float *x,
+                                      std::int64_t incx, std::int64_t stridex, std::int64_t *result,
+                                      std::int64_t batch_size,
+                                      const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event iamax_batch(sycl::queue &queue, std::int64_t n, const double *x,
+                                      std::int64_t incx, std::int64_t stridex, std::int64_t *result,
+                                      std::int64_t batch_size,
+                                      const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event iamax_batch(
+    sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+    std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event iamax_batch(
+    sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+    std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event iamax_batch(sycl::queue &queue, std::int64_t *n, const float **x,
+                                      std::int64_t *incx, std::int64_t *result,
+                                      std::int64_t group_count, std::int64_t *group_size,
+                                      const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event iamax_batch(sycl::queue &queue, std::int64_t *n, const double **x,
+                                      std::int64_t *incx, std::int64_t *result,
+                                      std::int64_t group_count, std::int64_t *group_size,
+                                      const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event iamax_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+    std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event iamax_batch(
+    sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+    std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+    oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_pack(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    float *packed, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_pack(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    double *packed, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_pack(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, std::complex<float> *packed,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_pack(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, std::complex<double> *packed,
+    const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_compute(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                       oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                       std::int64_t k, const float *packed, const float *b,
+                                       std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                                       const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_compute(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                       oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                       std::int64_t k, const double *packed, const double *b,
+                                       std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                                       const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_compute(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *packed,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_compute(
+    sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *packed,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, const float *bias,
+    oneapi::mkl::epilogue_desc epilogue, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc, const double *bias,
+    oneapi::mkl::epilogue_desc epilogue, const std::vector<sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT sycl::event gemm_epilogue(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, oneapi::mkl::bfloat16 *c, std::int64_t ldc,
+    const float *bias, oneapi::mkl::epilogue_desc epilogue,
+    const std::vector<sycl::event> &dependencies = {});
@@ -1693,6 +1693,321 @@ void omatadd(backend_selector<backend::portblas> selector, transpose transa, tra
                                                 a, lda, beta, b, ldb, c, ldc);
 }
 
+void gemm_strassen(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   std::int64_t levels) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_strassen(selector.get_queue(), transa, transb, m, n, k,
+                                                      alpha, a, lda, b, ldb, beta, c, ldc, levels);
+}
+
+void gemm_strassen(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                   sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
+                   std::int64_t ldb, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   std::int64_t levels) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_strassen(selector.get_queue(), transa, transb, m, n, k,
+                                                      alpha, a, lda, b, ldb, beta, c, ldc, levels);
+}
+
+void gemm3m(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm3m(selector.get_queue(), transa, transb, m, n, k, alpha,
+                                               a, lda, b, ldb, beta, c, ldc);
+}
+
+void gemm3m(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm3m(selector.get_queue(), transa, transb, m, n, k, alpha,
+                                               a, lda, b, ldb, beta, c, ldc);
+}
+
+void axpy_dot(backend_selector<backend::portblas> selector, std::int64_t n, float alpha,
+              sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+              std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    oneapi::mkl::blas::portblas::MAJOR::axpy_dot(selector.get_queue(), n, alpha, x, incx, y, incy,
+                                                 z, incz, result);
+}
+
+void axpy_dot(backend_selector<backend::portblas> selector, std::int64_t n, double alpha,
+              sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+              std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    oneapi::mkl::blas::portblas::MAJOR::axpy_dot(selector.get_queue(), n, alpha, x, incx, y, incy,
+                                                 z, incz, result);
+}
+
+void axpby_nrm2(backend_selector<backend::portblas> selector, std::int64_t n, float alpha,
+                sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
+                std::int64_t incy, sycl::buffer<float, 1> &result) {
+    oneapi::mkl::blas::portblas::MAJOR::axpby_nrm2(selector.get_queue(), n, alpha, x, incx, beta, y,
+                                                   incy, result);
+}
+
+void axpby_nrm2(backend_selector<backend::portblas> selector, std::int64_t n, double alpha,
+                sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    oneapi::mkl::blas::portblas::MAJOR::axpby_nrm2(selector.get_queue(), n, alpha, x, incx, beta, y,
+                                                   incy, result);
+}
+
+void dot2(backend_selector<backend::portblas> selector, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+          sycl::buffer<float, 1> &z, std::int64_t incz, sycl::buffer<float, 1> &result) {
+    oneapi::mkl::blas::portblas::MAJOR::dot2(selector.get_queue(), n, x, incx, y, incy, z, incz,
+                                             result);
+}
+
+void dot2(backend_selector<backend::portblas> selector, std::int64_t n, sycl::buffer<double, 1> &x,
+          std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+          sycl::buffer<double, 1> &z, std::int64_t incz, sycl::buffer<double, 1> &result) {
+    oneapi::mkl::blas::portblas::MAJOR::dot2(selector.get_queue(), n, x, incx, y, incy, z, incz,
+                                             result);
+}
+
+void dot_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+               sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+               sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+               sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::dot_batch(selector.get_queue(), n, x, incx, stridex, y,
+                                                  incy, stridey, result, batch_size);
+}
+
+void dot_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+               sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+               sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
+               sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::dot_batch(selector.get_queue(), n, x, incx, stridex, y,
+                                                  incy, stridey, result, batch_size);
+}
+
+void nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(selector.get_queue(), n, x, incx, stridex,
+                                                   result, batch_size);
+}
+
+void nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(selector.get_queue(), n, x, incx, stridex,
+                                                   result, batch_size);
+}
+
+void nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(selector.get_queue(), n, x, incx, stridex,
+                                                   result, batch_size);
+}
+
+void nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(selector.get_queue(), n, x, incx, stridex,
+                                                   result, batch_size);
+}
+
+void asum_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::asum_batch(selector.get_queue(), n, x, incx, stridex,
+                                                   result, batch_size);
+}
+
+void asum_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::asum_batch(selector.get_queue(), n, x, incx, stridex,
+                                                   result, batch_size);
+}
+
+void asum_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::asum_batch(selector.get_queue(), n, x, incx, stridex,
+                                                   result, batch_size);
+}
+
+void asum_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::asum_batch(selector.get_queue(), n, x, incx, stridex,
+                                                   result, batch_size);
+}
+
+void iamax_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::iamax_batch(selector.get_queue(), n, x, incx, stridex,
+                                                    result, batch_size);
+}
+
+void iamax_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::iamax_batch(selector.get_queue(), n, x, incx, stridex,
+                                                    result, batch_size);
+}
+
+void iamax_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                 sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::iamax_batch(selector.get_queue(), n, x, incx, stridex,
+                                                    result, batch_size);
+}
+
+void iamax_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                 sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    oneapi::mkl::blas::portblas::MAJOR::iamax_batch(selector.get_queue(), n, x, incx, stridex,
+                                                    result, batch_size);
+}
+
+void gemm(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+          std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+          sycl::buffer<float, 1> &c, std::int64_t ldc, compute_mode mode) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm(selector.get_queue(), transa, transb, m, n, k, alpha,
+                                             a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+void gemm(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+          std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+          sycl::buffer<double, 1> &c, std::int64_t ldc, compute_mode mode) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm(selector.get_queue(), transa, transb, m, n, k, alpha,
+                                             a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+void gemm(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+          sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+          sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, compute_mode mode) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm(selector.get_queue(), transa, transb, m, n, k, alpha,
+                                             a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+void gemm(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+          sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+          sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, compute_mode mode) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm(selector.get_queue(), transa, transb, m, n, k, alpha,
+                                             a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+template <typename fp_type>
+std::int64_t gemm_pack_get_size(backend_selector<backend::portblas> selector, pack_matrix which,
+                                std::int64_t m, std::int64_t n, std::int64_t k) {
+    return oneapi::mkl::blas::portblas::MAJOR::gemm_pack_get_size<fp_type>(selector.get_queue(),
+                                                                           which, m, n, k);
+}
+
+void gemm_pack(backend_selector<backend::portblas> selector, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+               sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &packed) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_pack(selector.get_queue(), which, trans, m, n, k,
+                                                  alpha, a, lda, packed);
+}
+
+void gemm_pack(backend_selector<backend::portblas> selector, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+               sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &packed) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_pack(selector.get_queue(), which, trans, m, n, k,
+                                                  alpha, a, lda, packed);
+}
+
+void gemm_pack(backend_selector<backend::portblas> selector, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+               sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+               sycl::buffer<std::complex<float>, 1> &packed) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_pack(selector.get_queue(), which, trans, m, n, k,
+                                                  alpha, a, lda, packed);
+}
+
+void gemm_pack(backend_selector<backend::portblas> selector, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+               sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+               sycl::buffer<std::complex<double>, 1> &packed) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_pack(selector.get_queue(), which, trans, m, n, k,
+                                                  alpha, a, lda, packed);
+}
+
+void gemm_compute(backend_selector<backend::portblas> selector, pack_matrix which, transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<float, 1> &packed,
+                  sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                  sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_compute(selector.get_queue(), which, trans, m, n, k,
+                                                     packed, b, ldb, beta, c, ldc);
+}
+
+void gemm_compute(backend_selector<backend::portblas> selector, pack_matrix which, transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<double, 1> &packed,
+                  sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+                  sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_compute(selector.get_queue(), which, trans, m, n, k,
+                                                     packed, b, ldb, beta, c, ldc);
+}
+
+void gemm_compute(
+    backend_selector<backend::portblas> selector, pack_matrix which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1> &packed,
+    sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_compute(selector.get_queue(), which, trans, m, n, k,
+                                                     packed, b, ldb, beta, c, ldc);
+}
+
+void gemm_compute(
+    backend_selector<backend::portblas> selector, pack_matrix which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1> &packed,
+    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_compute(selector.get_queue(), which, trans, m, n, k,
+                                                     packed, b, ldb, beta, c, ldc);
+}
+
+void gemm_epilogue(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_epilogue(selector.get_queue(), transa, transb, m, n, k,
+                                                      alpha, a, lda, b, ldb, beta, c, ldc, bias,
+                                                      epilogue);
+}
+
+void gemm_epilogue(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                   sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
+                   std::int64_t ldb, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   sycl::buffer<double, 1> &bias, epilogue_desc epilogue) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_epilogue(selector.get_queue(), transa, transb, m, n, k,
+                                                      alpha, a, lda, b, ldb, beta, c, ldc, bias,
+                                                      epilogue);
+}
+
+void gemm_epilogue(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c, std::int64_t ldc,
+                   sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    oneapi::mkl::blas::portblas::MAJOR::gemm_epilogue(selector.get_queue(), transa, transb, m, n, k,
+                                                      alpha, a, lda, b, ldb, beta, c, ldc, bias,
+                                                      epilogue);
+}
+
 // USM APIs
 
 sycl::event syr2(backend_selector<backend::portblas> selector, uplo upper_lower, std::int64_t n,
@@ -4189,3 +4504,546 @@ sycl::event imatcopy_batch(backend_selector<backend::portblas> selector, transpo
         dependencies);
     return done;
 }
+
+sycl::event gemm_strassen(backend_selector<backend::portblas> selector, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          float alpha, const float *a, std::int64_t lda, const float *b,
+                          std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                          std::int64_t levels, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_strassen(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, levels,
+        dependencies);
+    return done;
+}
+
+sycl::event gemm_strassen(backend_selector<backend::portblas> selector, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          double alpha, const double *a, std::int64_t lda, const double *b,
+                          std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                          std::int64_t levels, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_strassen(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, levels,
+        dependencies);
+    return done;
+}
+
+sycl::event gemm3m(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                   const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                   std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                   std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm3m(selector.get_queue(), transa, transb, m,
+                                                           n, k, alpha, a, lda, b, ldb, beta, c,
+                                                           ldc, dependencies);
+    return done;
+}
+
+sycl::event gemm3m(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                   const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                   std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                   std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm3m(selector.get_queue(), transa, transb, m,
+                                                           n, k, alpha, a, lda, b, ldb, beta, c,
+                                                           ldc, dependencies);
+    return done;
+}
+
+sycl::event gemm_out_of_core(
+    backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_out_of_core(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+        max_memory, dependencies);
+    return done;
+}
+
+sycl::event gemm_out_of_core(
+    backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_out_of_core(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+        max_memory, dependencies);
+    return done;
+}
+
+sycl::event gemm_out_of_core(
+    backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_out_of_core(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+        max_memory, dependencies);
+    return done;
+}
+
+sycl::event gemm_out_of_core(
+    backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_out_of_core(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+        max_memory, dependencies);
+    return done;
+}
+
+sycl::event axpy_dot(backend_selector<backend::portblas> selector, std::int64_t n, float alpha,
+                     const float *x, std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                     std::int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::axpy_dot(
+        selector.get_queue(), n, alpha, x, incx, y, incy, z, incz, result, dependencies);
+    return done;
+}
+
+sycl::event axpy_dot(backend_selector<backend::portblas> selector, std::int64_t n, double alpha,
+                     const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                     const double *z, std::int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::axpy_dot(
+        selector.get_queue(), n, alpha, x, incx, y, incy, z, incz, result, dependencies);
+    return done;
+}
+
+sycl::event axpby_nrm2(backend_selector<backend::portblas> selector, std::int64_t n, float alpha,
+                       const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+                       float *result, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::axpby_nrm2(
+        selector.get_queue(), n, alpha, x, incx, beta, y, incy, result, dependencies);
+    return done;
+}
+
+sycl::event axpby_nrm2(backend_selector<backend::portblas> selector, std::int64_t n, double alpha,
+                       const double *x, std::int64_t incx, double beta, double *y,
+                       std::int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::axpby_nrm2(
+        selector.get_queue(), n, alpha, x, incx, beta, y, incy, result, dependencies);
+    return done;
+}
+
+sycl::event dot2(backend_selector<backend::portblas> selector, std::int64_t n, const float *x,
+                 std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                 std::int64_t incz, float *result, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::dot2(selector.get_queue(), n, x, incx, y, incy,
+                                                         z, incz, result, dependencies);
+    return done;
+}
+
+sycl::event dot2(backend_selector<backend::portblas> selector, std::int64_t n, const double *x,
+                 std::int64_t incx, const double *y, std::int64_t incy, const double *z,
+                 std::int64_t incz, double *result, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::dot2(selector.get_queue(), n, x, incx, y, incy,
+                                                         z, incz, result, dependencies);
+    return done;
+}
+
+sycl::event dot_batch(backend_selector<backend::portblas> selector, std::int64_t n, const float *x,
+                      std::int64_t incx, std::int64_t stridex, const float *y, std::int64_t incy,
+                      std::int64_t stridey, float *result, std::int64_t batch_size,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::dot_batch(selector.get_queue(), n, x, incx,
+                                                              stridex, y, incy, stridey, result,
+                                                              batch_size, dependencies);
+    return done;
+}
+
+sycl::event dot_batch(backend_selector<backend::portblas> selector, std::int64_t n, const double *x,
+                      std::int64_t incx, std::int64_t stridex, const double *y, std::int64_t incy,
+                      std::int64_t stridey, double *result, std::int64_t batch_size,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::dot_batch(selector.get_queue(), n, x, incx,
+                                                              stridex, y, incy, stridey, result,
+                                                              batch_size, dependencies);
+    return done;
+}
+
+sycl::event dot_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                      const float **x, std::int64_t *incx, const float **y, std::int64_t *incy,
+                      float *result, std::int64_t group_count, std::int64_t *group_size,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::dot_batch(
+        selector.get_queue(), n, x, incx, y, incy, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event dot_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                      const double **x, std::int64_t *incx, const double **y, std::int64_t *incy,
+                      double *result, std::int64_t group_count, std::int64_t *group_size,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::dot_batch(
+        selector.get_queue(), n, x, incx, y, incy, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t n, const float *x,
+                       std::int64_t incx, std::int64_t stridex, float *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                       const double *x, std::int64_t incx, std::int64_t stridex, double *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                       const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                       float *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                       const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                       double *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                       const float **x, std::int64_t *incx, float *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                       const double **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                       const std::complex<float> **x, std::int64_t *incx, float *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event nrm2_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                       const std::complex<double> **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::nrm2_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event asum_batch(backend_selector<backend::portblas> selector, std::int64_t n, const float *x,
+                       std::int64_t incx, std::int64_t stridex, float *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::asum_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event asum_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                       const double *x, std::int64_t incx, std::int64_t stridex, double *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::asum_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event asum_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                       const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                       float *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::asum_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event asum_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                       const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                       double *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::asum_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event asum_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                       const float **x, std::int64_t *incx, float *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::asum_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event asum_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                       const double **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::asum_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event asum_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                       const std::complex<float> **x, std::int64_t *incx, float *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::asum_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event asum_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                       const std::complex<double> **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::asum_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event iamax_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                        const float *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::iamax_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event iamax_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                        const double *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::iamax_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event iamax_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                        const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::iamax_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event iamax_batch(backend_selector<backend::portblas> selector, std::int64_t n,
+                        const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::iamax_batch(
+        selector.get_queue(), n, x, incx, stridex, result, batch_size, dependencies);
+    return done;
+}
+
+sycl::event iamax_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                        const float **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::iamax_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event iamax_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                        const double **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::iamax_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event iamax_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                        const std::complex<float> **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::iamax_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event iamax_batch(backend_selector<backend::portblas> selector, std::int64_t *n,
+                        const std::complex<double> **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::iamax_batch(
+        selector.get_queue(), n, x, incx, result, group_count, group_size, dependencies);
+    return done;
+}
+
+sycl::event gemm(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+                 std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm(selector.get_queue(), transa, transb, m, n,
+                                                         k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                         mode, dependencies);
+    return done;
+}
+
+sycl::event gemm(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+                 std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm(selector.get_queue(), transa, transb, m, n,
+                                                         k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                         mode, dependencies);
+    return done;
+}
+
+sycl::event gemm(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                 const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                 std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm(selector.get_queue(), transa, transb, m, n,
+                                                         k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                         mode, dependencies);
+    return done;
+}
+
+sycl::event gemm(backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                 const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                 std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm(selector.get_queue(), transa, transb, m, n,
+                                                         k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                         mode, dependencies);
+    return done;
+}
+
+sycl::event gemm_pack(backend_selector<backend::portblas> selector, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                      const float *a, std::int64_t lda, float *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_pack(
+        selector.get_queue(), which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+    return done;
+}
+
+sycl::event gemm_pack(backend_selector<backend::portblas> selector, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                      const double *a, std::int64_t lda, double *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_pack(
+        selector.get_queue(), which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+    return done;
+}
+
+sycl::event gemm_pack(backend_selector<backend::portblas> selector, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                      std::complex<float> *packed, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_pack(
+        selector.get_queue(), which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+    return done;
+}
+
+sycl::event gemm_pack(backend_selector<backend::portblas> selector, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                      std::complex<double> *packed, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_pack(
+        selector.get_queue(), which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+    return done;
+}
+
+sycl::event gemm_compute(backend_selector<backend::portblas> selector, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const float *packed, const float *b, std::int64_t ldb, float beta,
+                         float *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_compute(
+        selector.get_queue(), which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+sycl::event gemm_compute(backend_selector<backend::portblas> selector, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const double *packed, const double *b, std::int64_t ldb, double beta,
+                         double *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_compute(
+        selector.get_queue(), which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+sycl::event gemm_compute(backend_selector<backend::portblas> selector, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const std::complex<float> *packed, const std::complex<float> *b,
+                         std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                         std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_compute(
+        selector.get_queue(), which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+sycl::event gemm_compute(backend_selector<backend::portblas> selector, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const std::complex<double> *packed, const std::complex<double> *b,
+                         std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                         std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_compute(
+        selector.get_queue(), which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+    return done;
+}
+
+sycl::event gemm_epilogue(
+    backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, const float *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_epilogue(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias,
+        epilogue, dependencies);
+    return done;
+}
+
+sycl::event gemm_epilogue(
+    backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc, const double *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_epilogue(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias,
+        epilogue, dependencies);
+    return done;
+}
+
+sycl::event gemm_epilogue(
+    backend_selector<backend::portblas> selector, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, bfloat16 *c, std::int64_t ldc, const float *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    auto done = oneapi::mkl::blas::portblas::MAJOR::gemm_epilogue(
+        selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias,
+        epilogue, dependencies);
+    return done;
+}
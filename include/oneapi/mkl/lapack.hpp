@@ -33,5 +33,8 @@
 #ifdef ENABLE_ROCSOLVER_BACKEND
 #include "oneapi/mkl/lapack/detail/rocsolver/lapack_ct.hpp"
 #endif
+#ifdef ENABLE_NETLIB_LAPACK_BACKEND
+#include "oneapi/mkl/lapack/detail/netlib/lapack_ct.hpp"
+#endif
 
 #include "oneapi/mkl/lapack/detail/lapack_rt.hpp"
@@ -2376,6 +2376,1203 @@ template <>
 ONEMKL_EXPORT std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *k, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+ONEMKL_EXPORT void pack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                                std::int64_t stride_a, sycl::buffer<float> &ap, std::int64_t ldap,
+                                std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT void pack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                                std::int64_t stride_a, sycl::buffer<double> &ap, std::int64_t ldap,
+                                std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT sycl::event pack_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+    std::int64_t lda, std::int64_t stride_a, float *ap, std::int64_t ldap, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event pack_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+    std::int64_t lda, std::int64_t stride_a, double *ap, std::int64_t ldap, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT void unpack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                  std::int64_t n, sycl::buffer<float> &ap, std::int64_t ldap,
+                                  sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                                  std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT void unpack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                  std::int64_t n, sycl::buffer<double> &ap, std::int64_t ldap,
+                                  sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                                  std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT sycl::event unpack_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, float *ap,
+    std::int64_t ldap, float *a, std::int64_t lda, std::int64_t stride_a, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event unpack_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, double *ap,
+    std::int64_t ldap, double *a, std::int64_t lda, std::int64_t stride_a, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT void getrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                 std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                 std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT void getrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                 std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                 std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT sycl::event getrf_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+    std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event getrf_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+    std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT void getrs_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+    std::int64_t stride_ipiv, sycl::buffer<float> &b, std::int64_t ldb, std::int64_t interleave,
+    std::int64_t batch_size);
+ONEMKL_EXPORT void getrs_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+    std::int64_t stride_ipiv, sycl::buffer<double> &b, std::int64_t ldb, std::int64_t interleave,
+    std::int64_t batch_size);
+ONEMKL_EXPORT sycl::event getrs_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+    std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    float *b, std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event getrs_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    double *b, std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT void potrf_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<float> &a, std::int64_t lda, std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT void potrf_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<double> &a, std::int64_t lda, std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT sycl::event potrf_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    float *a, std::int64_t lda, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event potrf_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    double *a, std::int64_t lda, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT void trsm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    float alpha, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+    std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT void trsm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    double alpha, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+    std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT sycl::event trsm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    float alpha, float *a, std::int64_t lda, float *b, std::int64_t ldb, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event trsm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    double alpha, double *a, std::int64_t lda, double *b, std::int64_t ldb, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT void gemm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose transa,
+    oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb, float beta,
+    sycl::buffer<float> &c, std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT void gemm_compact(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                                std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                                std::int64_t ldb, double beta, sycl::buffer<double> &c,
+                                std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size);
+ONEMKL_EXPORT sycl::event gemm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose transa,
+    oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+    float *a, std::int64_t lda, float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gemm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose transa,
+    oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+    double *a, std::int64_t lda, double *b, std::int64_t ldb, double beta, double *c,
+    std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT void gesv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                              std::int64_t ldb, sycl::buffer<double> &x, std::int64_t ldx,
+                              sycl::buffer<std::int64_t> &iter, sycl::buffer<double> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_mixed(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+    sycl::buffer<std::complex<double>> &b, std::int64_t ldb, sycl::buffer<std::complex<double>> &x,
+    std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event gesv_mixed(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb, double *x, std::int64_t ldx,
+    std::int64_t *iter, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                                     std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                     std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                                     std::complex<double> *x, std::int64_t ldx, std::int64_t *iter,
+                                     std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t gesv_mixed_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                        std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                        std::int64_t ldb, std::int64_t ldx);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_mixed_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t ldb, std::int64_t ldx);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_mixed_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t ldb, std::int64_t ldx);
+ONEMKL_EXPORT void posv_mixed(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+    std::int64_t ldb, sycl::buffer<double> &x, std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_mixed(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    sycl::buffer<std::complex<double>> &b, std::int64_t ldb, sycl::buffer<std::complex<double>> &x,
+    std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event posv_mixed(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, double *b, std::int64_t ldb, double *x,
+    std::int64_t ldx, std::int64_t *iter, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_mixed(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> *x, std::int64_t ldx, std::int64_t *iter,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t posv_mixed_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t ldb, std::int64_t ldx);
+template <>
+ONEMKL_EXPORT std::int64_t posv_mixed_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb, std::int64_t ldx);
+template <>
+ONEMKL_EXPORT std::int64_t posv_mixed_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb, std::int64_t ldx);
+ONEMKL_EXPORT void gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv, sycl::buffer<double> &b,
+    std::int64_t ldb, std::int64_t stride_b, sycl::buffer<double> &x, std::int64_t ldx,
+    std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+    sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+    sycl::buffer<std::complex<double>> &x, std::int64_t ldx, std::int64_t stride_x,
+    sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    double *b, std::int64_t ldb, std::int64_t stride_b, double *x, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+    std::int64_t stride_ipiv, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> *x, std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t gesv_mixed_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_mixed_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_mixed_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+ONEMKL_EXPORT void posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b, sycl::buffer<double> &x,
+    std::int64_t ldx, std::int64_t stride_x, sycl::buffer<std::int64_t> &iter,
+    std::int64_t batch_size, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+    std::int64_t stride_b, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+    std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+    std::int64_t ldb, std::int64_t stride_b, double *x, std::int64_t ldx, std::int64_t stride_x,
+    std::int64_t *iter, std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<double> *x,
+    std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t posv_mixed_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t posv_mixed_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t posv_mixed_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+ONEMKL_EXPORT sycl::event gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, double **a,
+    std::int64_t *lda, std::int64_t **ipiv, double **b, std::int64_t *ldb, double **x,
+    std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs,
+    std::complex<double> **a, std::int64_t *lda, std::int64_t **ipiv, std::complex<double> **b,
+    std::int64_t *ldb, std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, double **a, std::int64_t *lda, double **b, std::int64_t *ldb, double **x,
+    std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, std::complex<double> **a, std::int64_t *lda, std::complex<double> **b,
+    std::int64_t *ldb, std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t gesv_mixed_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_mixed_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_mixed_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t posv_mixed_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx,
+    std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t posv_mixed_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx,
+    std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t posv_mixed_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx,
+    std::int64_t group_count, std::int64_t *group_sizes);
+ONEMKL_EXPORT void geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                              std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                              sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                              std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                              sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void geqrf_tsqr(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+    sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::complex<float>> &tau,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                              std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                              std::int64_t lda, sycl::buffer<std::complex<double>> &tau,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                     std::int64_t n, float *a, std::int64_t lda, float *tau,
+                                     float *scratchpad, std::int64_t scratchpad_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                     std::int64_t n, double *a, std::int64_t lda, double *tau,
+                                     double *scratchpad, std::int64_t scratchpad_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                     std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                                     std::complex<float> *tau, std::complex<float> *scratchpad,
+                                     std::int64_t scratchpad_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                     std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                                     std::complex<double> *tau, std::complex<double> *scratchpad,
+                                     std::int64_t scratchpad_size,
+                                     const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t geqrf_tsqr_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                        std::int64_t m, std::int64_t n, std::int64_t lda);
+template <>
+ONEMKL_EXPORT std::int64_t geqrf_tsqr_scratchpad_size<float>(oneapi::mkl::device libkey,
+                                                             sycl::queue &queue, std::int64_t m,
+                                                             std::int64_t n, std::int64_t lda);
+template <>
+ONEMKL_EXPORT std::int64_t geqrf_tsqr_scratchpad_size<double>(oneapi::mkl::device libkey,
+                                                              sycl::queue &queue, std::int64_t m,
+                                                              std::int64_t n, std::int64_t lda);
+template <>
+ONEMKL_EXPORT std::int64_t geqrf_tsqr_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+    std::int64_t lda);
+template <>
+ONEMKL_EXPORT std::int64_t geqrf_tsqr_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+    std::int64_t lda);
+ONEMKL_EXPORT void gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed, sycl::buffer<float> &a,
+    std::int64_t lda, sycl::buffer<float> &s, sycl::buffer<float> &u, std::int64_t ldu,
+    sycl::buffer<float> &vt, std::int64_t ldvt, sycl::buffer<float> &scratchpad,
+    std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed, sycl::buffer<double> &a,
+    std::int64_t lda, sycl::buffer<double> &s, sycl::buffer<double> &u, std::int64_t ldu,
+    sycl::buffer<double> &vt, std::int64_t ldvt, sycl::buffer<double> &scratchpad,
+    std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+    sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<float> &s,
+    sycl::buffer<std::complex<float>> &u, std::int64_t ldu, sycl::buffer<std::complex<float>> &vt,
+    std::int64_t ldvt, sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<double> &s,
+    sycl::buffer<std::complex<double>> &u, std::int64_t ldu, sycl::buffer<std::complex<double>> &vt,
+    std::int64_t ldvt, sycl::buffer<std::complex<double>> &scratchpad,
+    std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed, const float *a,
+    std::int64_t lda, float *s, float *u, std::int64_t ldu, float *vt, std::int64_t ldvt,
+    float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed, const double *a,
+    std::int64_t lda, double *s, double *u, std::int64_t ldu, double *vt, std::int64_t ldvt,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+    const std::complex<float> *a, std::int64_t lda, float *s, std::complex<float> *u,
+    std::int64_t ldu, std::complex<float> *vt, std::int64_t ldvt, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+    const std::complex<double> *a, std::int64_t lda, double *s, std::complex<double> *u,
+    std::int64_t ldu, std::complex<double> *vt, std::int64_t ldvt, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesvd_randomized_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt);
+template <>
+ONEMKL_EXPORT std::int64_t gesvd_randomized_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt);
+template <>
+ONEMKL_EXPORT std::int64_t gesvd_randomized_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt);
+template <>
+ONEMKL_EXPORT std::int64_t gesvd_randomized_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt);
+template <>
+ONEMKL_EXPORT std::int64_t gesvd_randomized_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt);
+ONEMKL_EXPORT void heevr(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu, std::int64_t il,
+    std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+    sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevr(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu, std::int64_t il,
+    std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+    sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event heevr(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+    std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+    std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevr(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+    std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+    std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevr_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevr_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+ONEMKL_EXPORT void heevx(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu, std::int64_t il,
+    std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+    sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu, std::int64_t il,
+    std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+    sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event heevx(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+    std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+    std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+    std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+    std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+ONEMKL_EXPORT void syevr(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+    std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+    sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z, std::int64_t ldz,
+    sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevr(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+    std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+    sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+    std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event syevr(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+    float vl, float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    float *z, std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevr(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+    double vl, double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+    double *w, double *z, std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevr_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevr_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+ONEMKL_EXPORT void syevx(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+    std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+    sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z, std::int64_t ldz,
+    sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+    std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+    sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+    std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event syevx(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+    float vl, float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    float *z, std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+    double vl, double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+    double *w, double *z, std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+ONEMKL_EXPORT void heevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, std::int64_t stride_w, sycl::buffer<std::complex<float>> &z,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, std::int64_t stride_w, sycl::buffer<std::complex<double>> &z,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event heevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+    std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+    float abstol, std::int64_t *m, float *w, std::int64_t stride_w, std::complex<float> *z,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+    double abstol, std::int64_t *m, double *w, std::int64_t stride_w, std::complex<double> *z,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a,
+    std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu, float *abstol,
+    std::int64_t *m, float **w, std::complex<float> **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<double> **a,
+    std::int64_t *lda, double *vl, double *vu, std::int64_t *il, std::int64_t *iu, double *abstol,
+    std::int64_t *m, double **w, std::complex<double> **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevr_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevr_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t heevr_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t heevr_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+ONEMKL_EXPORT void heevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, std::int64_t stride_w, sycl::buffer<std::complex<float>> &z,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, std::int64_t stride_w, sycl::buffer<std::complex<double>> &z,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event heevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+    std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+    float abstol, std::int64_t *m, float *w, std::int64_t stride_w, std::complex<float> *z,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+    double abstol, std::int64_t *m, double *w, std::int64_t stride_w, std::complex<double> *z,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a,
+    std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu, float *abstol,
+    std::int64_t *m, float **w, std::complex<float> **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<double> **a,
+    std::int64_t *lda, double *vl, double *vu, std::int64_t *il, std::int64_t *iu, double *abstol,
+    std::int64_t *m, double **w, std::complex<double> **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+ONEMKL_EXPORT void syevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+    std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+    float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+    sycl::buffer<float> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+    std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+    double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, std::int64_t stride_w,
+    sycl::buffer<double> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event syevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+    std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+    std::int64_t *m, float *w, std::int64_t stride_w, float *z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+    std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+    std::int64_t *m, double *w, std::int64_t stride_w, double *z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, float **a,
+    std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu, float *abstol,
+    std::int64_t *m, float **w, float **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, double **a,
+    std::int64_t *lda, double *vl, double *vu, std::int64_t *il, std::int64_t *iu, double *abstol,
+    std::int64_t *m, double **w, double **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevr_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevr_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t syevr_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t syevr_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+ONEMKL_EXPORT void syevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+    std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+    float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+    sycl::buffer<float> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+    std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+    double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, std::int64_t stride_w,
+    sycl::buffer<double> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event syevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+    std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+    std::int64_t *m, float *w, std::int64_t stride_w, float *z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+    std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+    std::int64_t *m, double *w, std::int64_t stride_w, double *z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, float **a,
+    std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu, float *abstol,
+    std::int64_t *m, float **w, float **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, double **a,
+    std::int64_t *lda, double *vl, double *vu, std::int64_t *il, std::int64_t *iu, double *abstol,
+    std::int64_t *m, double **w, double **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes);
+ONEMKL_EXPORT void heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<float> **a, std::int64_t *lda, float **w,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double **w,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                         oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                         std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_w, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+ONEMKL_EXPORT void syevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event syevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, float **a, std::int64_t *lda, float **w, std::int64_t group_count,
+    std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, double **a, std::int64_t *lda, double **w, std::int64_t group_count,
+    std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                         oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                         std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_w, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevd_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevd_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t syevd_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t syevd_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+ONEMKL_EXPORT void gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+    std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+    std::int64_t scratchpad_size);
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a,
+    double *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda, double **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::complex<float> **a, std::int64_t *lda,
+    std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a, std::int64_t *lda,
+    std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {});
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_batch_scratchpad_size(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes);
 } //namespace detail
 } //namespace lapack
 } //namespace mkl
@@ -2386,6 +2386,1360 @@ std::int64_t ungqr_batch_scratchpad_size(sycl::queue &queue, std::int64_t *m, st
     return detail::ungqr_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, m, n, k, lda,
                                                         group_count, group_sizes);
 }
+static inline void pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                                sycl::buffer<float> &ap, std::int64_t ldap, std::int64_t interleave,
+                                std::int64_t batch_size) {
+    detail::pack_compact(get_device_id(queue), queue, m, n, a, lda, stride_a, ap, ldap, interleave,
+                         batch_size);
+}
+static inline void pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                                sycl::buffer<double> &ap, std::int64_t ldap,
+                                std::int64_t interleave, std::int64_t batch_size) {
+    detail::pack_compact(get_device_id(queue), queue, m, n, a, lda, stride_a, ap, ldap, interleave,
+                         batch_size);
+}
+static inline sycl::event pack_compact(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
+    std::int64_t stride_a, float *ap, std::int64_t ldap, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::pack_compact(get_device_id(queue), queue, m, n, a, lda, stride_a, ap, ldap,
+                                interleave, batch_size, dependencies);
+}
+static inline sycl::event pack_compact(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
+    std::int64_t stride_a, double *ap, std::int64_t ldap, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::pack_compact(get_device_id(queue), queue, m, n, a, lda, stride_a, ap, ldap,
+                                interleave, batch_size, dependencies);
+}
+static inline void unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  sycl::buffer<float> &ap, std::int64_t ldap,
+                                  sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                                  std::int64_t interleave, std::int64_t batch_size) {
+    detail::unpack_compact(get_device_id(queue), queue, m, n, ap, ldap, a, lda, stride_a,
+                           interleave, batch_size);
+}
+static inline void unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                  sycl::buffer<double> &ap, std::int64_t ldap,
+                                  sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                                  std::int64_t interleave, std::int64_t batch_size) {
+    detail::unpack_compact(get_device_id(queue), queue, m, n, ap, ldap, a, lda, stride_a,
+                           interleave, batch_size);
+}
+static inline sycl::event unpack_compact(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, float *ap, std::int64_t ldap, float *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::unpack_compact(get_device_id(queue), queue, m, n, ap, ldap, a, lda, stride_a,
+                                  interleave, batch_size, dependencies);
+}
+static inline sycl::event unpack_compact(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, double *ap, std::int64_t ldap, double *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::unpack_compact(get_device_id(queue), queue, m, n, ap, ldap, a, lda, stride_a,
+                                  interleave, batch_size, dependencies);
+}
+static inline void getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 sycl::buffer<float> &a, std::int64_t lda,
+                                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                 std::int64_t interleave, std::int64_t batch_size) {
+    detail::getrf_compact(get_device_id(queue), queue, m, n, a, lda, ipiv, stride_ipiv, interleave,
+                          batch_size);
+}
+static inline void getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 sycl::buffer<double> &a, std::int64_t lda,
+                                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                 std::int64_t interleave, std::int64_t batch_size) {
+    detail::getrf_compact(get_device_id(queue), queue, m, n, a, lda, ipiv, stride_ipiv, interleave,
+                          batch_size);
+}
+static inline sycl::event getrf_compact(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
+    std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::getrf_compact(get_device_id(queue), queue, m, n, a, lda, ipiv, stride_ipiv,
+                                 interleave, batch_size, dependencies);
+}
+static inline sycl::event getrf_compact(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
+    std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::getrf_compact(get_device_id(queue), queue, m, n, a, lda, ipiv, stride_ipiv,
+                                 interleave, batch_size, dependencies);
+}
+static inline void getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                                 std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                 sycl::buffer<float> &b, std::int64_t ldb, std::int64_t interleave,
+                                 std::int64_t batch_size) {
+    detail::getrs_compact(get_device_id(queue), queue, trans, n, nrhs, a, lda, ipiv, stride_ipiv, b,
+                          ldb, interleave, batch_size);
+}
+static inline void getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                                 std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                 sycl::buffer<double> &b, std::int64_t ldb, std::int64_t interleave,
+                                 std::int64_t batch_size) {
+    detail::getrs_compact(get_device_id(queue), queue, trans, n, nrhs, a, lda, ipiv, stride_ipiv, b,
+                          ldb, interleave, batch_size);
+}
+static inline sycl::event getrs_compact(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs, float *a,
+    std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv, float *b, std::int64_t ldb,
+    std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::getrs_compact(get_device_id(queue), queue, trans, n, nrhs, a, lda, ipiv,
+                                 stride_ipiv, b, ldb, interleave, batch_size, dependencies);
+}
+static inline sycl::event getrs_compact(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b, std::int64_t ldb,
+    std::int64_t interleave, std::int64_t batch_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::getrs_compact(get_device_id(queue), queue, trans, n, nrhs, a, lda, ipiv,
+                                 stride_ipiv, b, ldb, interleave, batch_size, dependencies);
+}
+static inline void potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                 sycl::buffer<float> &a, std::int64_t lda, std::int64_t interleave,
+                                 std::int64_t batch_size) {
+    detail::potrf_compact(get_device_id(queue), queue, uplo, n, a, lda, interleave, batch_size);
+}
+static inline void potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t interleave,
+                                 std::int64_t batch_size) {
+    detail::potrf_compact(get_device_id(queue), queue, uplo, n, a, lda, interleave, batch_size);
+}
+static inline sycl::event potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                        float *a, std::int64_t lda, std::int64_t interleave,
+                                        std::int64_t batch_size,
+                                        const std::vector<sycl::event> &dependencies = {}) {
+    return detail::potrf_compact(get_device_id(queue), queue, uplo, n, a, lda, interleave,
+                                 batch_size, dependencies);
+}
+static inline sycl::event potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                        double *a, std::int64_t lda, std::int64_t interleave,
+                                        std::int64_t batch_size,
+                                        const std::vector<sycl::event> &dependencies = {}) {
+    return detail::potrf_compact(get_device_id(queue), queue, uplo, n, a, lda, interleave,
+                                 batch_size, dependencies);
+}
+static inline void trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                                std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float> &a,
+                                std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+                                std::int64_t interleave, std::int64_t batch_size) {
+    detail::trsm_compact(get_device_id(queue), queue, side, uplo, trans, diag, m, n, alpha, a, lda,
+                         b, ldb, interleave, batch_size);
+}
+static inline void trsm_compact(
+    sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    double alpha, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+    std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size) {
+    detail::trsm_compact(get_device_id(queue), queue, side, uplo, trans, diag, m, n, alpha, a, lda,
+                         b, ldb, interleave, batch_size);
+}
+static inline sycl::event trsm_compact(
+    sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    float alpha, float *a, std::int64_t lda, float *b, std::int64_t ldb, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::trsm_compact(get_device_id(queue), queue, side, uplo, trans, diag, m, n, alpha,
+                                a, lda, b, ldb, interleave, batch_size, dependencies);
+}
+static inline sycl::event trsm_compact(
+    sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    double alpha, double *a, std::int64_t lda, double *b, std::int64_t ldb, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::trsm_compact(get_device_id(queue), queue, side, uplo, trans, diag, m, n, alpha,
+                                a, lda, b, ldb, interleave, batch_size, dependencies);
+}
+static inline void gemm_compact(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float> &a,
+    std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb, float beta, sycl::buffer<float> &c,
+    std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size) {
+    detail::gemm_compact(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                         ldb, beta, c, ldc, interleave, batch_size);
+}
+static inline void gemm_compact(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double> &a,
+    std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb, double beta,
+    sycl::buffer<double> &c, std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size) {
+    detail::gemm_compact(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda, b,
+                         ldb, beta, c, ldc, interleave, batch_size);
+}
+static inline sycl::event gemm_compact(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, float *a, std::int64_t lda,
+    float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gemm_compact(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                                b, ldb, beta, c, ldc, interleave, batch_size, dependencies);
+}
+static inline sycl::event gemm_compact(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, double *a, std::int64_t lda,
+    double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gemm_compact(get_device_id(queue), queue, transa, transb, m, n, k, alpha, a, lda,
+                                b, ldb, beta, c, ldc, interleave, batch_size, dependencies);
+}
+static inline void gesv_mixed(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+    std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+    sycl::buffer<double> &x, std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gesv_mixed(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter,
+                       scratchpad, scratchpad_size);
+}
+static inline void gesv_mixed(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+    std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+    std::int64_t ldb, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+    sycl::buffer<std::int64_t> &iter, sycl::buffer<std::complex<double>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::gesv_mixed(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter,
+                       scratchpad, scratchpad_size);
+}
+static inline sycl::event gesv_mixed(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+    std::int64_t *ipiv, double *b, std::int64_t ldb, double *x, std::int64_t ldx,
+    std::int64_t *iter, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesv_mixed(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx,
+                              iter, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_mixed(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+    std::int64_t lda, std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+    std::complex<double> *x, std::int64_t ldx, std::int64_t *iter, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesv_mixed(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx,
+                              iter, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t gesv_mixed_scratchpad_size(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t ldb, std::int64_t ldx) {
+    return detail::gesv_mixed_scratchpad_size<fp_type>(get_device_id(queue), queue, n, nrhs, lda,
+                                                       ldb, ldx);
+}
+static inline void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &x,
+                              std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::posv_mixed(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter,
+                       scratchpad, scratchpad_size);
+}
+static inline void posv_mixed(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<std::complex<double>> &b,
+    std::int64_t ldb, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+    sycl::buffer<std::int64_t> &iter, sycl::buffer<std::complex<double>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::posv_mixed(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter,
+                       scratchpad, scratchpad_size);
+}
+static inline sycl::event posv_mixed(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, double *b, std::int64_t ldb, double *x, std::int64_t ldx, std::int64_t *iter,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::posv_mixed(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx,
+                              iter, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event posv_mixed(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+    std::complex<double> *a, std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+    std::complex<double> *x, std::int64_t ldx, std::int64_t *iter, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::posv_mixed(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx,
+                              iter, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t posv_mixed_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                        std::int64_t nrhs, std::int64_t lda, std::int64_t ldb,
+                                        std::int64_t ldx) {
+    return detail::posv_mixed_scratchpad_size<fp_type>(get_device_id(queue), queue, uplo, n, nrhs,
+                                                       lda, ldb, ldx);
+}
+static inline void gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+    std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+    std::int64_t stride_ipiv, sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+    sycl::buffer<double> &x, std::int64_t ldx, std::int64_t stride_x,
+    sycl::buffer<std::int64_t> &iter, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::gesv_mixed_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv,
+                             stride_ipiv, b, ldb, stride_b, x, ldx, stride_x, iter, batch_size,
+                             scratchpad, scratchpad_size);
+}
+static inline void gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+    std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+    std::int64_t stride_ipiv, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+    std::int64_t stride_b, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+    std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gesv_mixed_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv,
+                             stride_ipiv, b, ldb, stride_b, x, ldx, stride_x, iter, batch_size,
+                             scratchpad, scratchpad_size);
+}
+static inline sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+    std::int64_t ldb, std::int64_t stride_b, double *x, std::int64_t ldx, std::int64_t stride_x,
+    std::int64_t *iter, std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesv_mixed_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv,
+                                    stride_ipiv, b, ldb, stride_b, x, ldx, stride_x, iter,
+                                    batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<double> *x,
+    std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesv_mixed_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv,
+                                    stride_ipiv, b, ldb, stride_b, x, ldx, stride_x, iter,
+                                    batch_size, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t gesv_mixed_batch_scratchpad_size(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    return detail::gesv_mixed_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, n, nrhs,
+                                                             lda, stride_a, stride_ipiv, ldb,
+                                                             stride_b, ldx, stride_x, batch_size);
+}
+static inline void posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b,
+    std::int64_t ldb, std::int64_t stride_b, sycl::buffer<double> &x, std::int64_t ldx,
+    std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::posv_mixed_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                             stride_b, x, ldx, stride_x, iter, batch_size, scratchpad,
+                             scratchpad_size);
+}
+static inline void posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+    sycl::buffer<std::complex<double>> &x, std::int64_t ldx, std::int64_t stride_x,
+    sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::posv_mixed_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                             stride_b, x, ldx, stride_x, iter, batch_size, scratchpad,
+                             scratchpad_size);
+}
+static inline sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+    double *x, std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::posv_mixed_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b,
+                                    ldb, stride_b, x, ldx, stride_x, iter, batch_size, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+static inline sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, std::complex<double> *b,
+    std::int64_t ldb, std::int64_t stride_b, std::complex<double> *x, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::posv_mixed_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b,
+                                    ldb, stride_b, x, ldx, stride_x, iter, batch_size, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t posv_mixed_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    return detail::posv_mixed_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, uplo, n,
+                                                             nrhs, lda, stride_a, ldb, stride_b,
+                                                             ldx, stride_x, batch_size);
+}
+static inline sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda,
+    std::int64_t **ipiv, double **b, std::int64_t *ldb, double **x, std::int64_t *ldx,
+    std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesv_mixed_batch(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, x,
+                                    ldx, iter, group_count, group_sizes, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a,
+    std::int64_t *lda, std::int64_t **ipiv, std::complex<double> **b, std::int64_t *ldb,
+    std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesv_mixed_batch(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, x,
+                                    ldx, iter, group_count, group_sizes, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+static inline sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs, double **a,
+    std::int64_t *lda, double **b, std::int64_t *ldb, double **x, std::int64_t *ldx,
+    std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::posv_mixed_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, x,
+                                    ldx, iter, group_count, group_sizes, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+static inline sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+    std::complex<double> **a, std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
+    std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::posv_mixed_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, x,
+                                    ldx, iter, group_count, group_sizes, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t gesv_mixed_batch_scratchpad_size(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t *ldx, std::int64_t group_count, std::int64_t *group_sizes) {
+    return detail::gesv_mixed_batch_scratchpad_size<fp_type>(
+        get_device_id(queue), queue, n, nrhs, lda, ldb, ldx, group_count, group_sizes);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_mixed_precision_floating_point<fp_type> = nullptr>
+std::int64_t posv_mixed_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    return detail::posv_mixed_batch_scratchpad_size<fp_type>(
+        get_device_id(queue), queue, uplo, n, nrhs, lda, ldb, ldx, group_count, group_sizes);
+}
+static inline void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                              sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    detail::geqrf_tsqr(get_device_id(queue), queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+static inline void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                              sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::geqrf_tsqr(get_device_id(queue), queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+static inline void geqrf_tsqr(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+    std::int64_t lda, sycl::buffer<std::complex<float>> &tau,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::geqrf_tsqr(get_device_id(queue), queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+static inline void geqrf_tsqr(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+    std::int64_t lda, sycl::buffer<std::complex<double>> &tau,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::geqrf_tsqr(get_device_id(queue), queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+static inline sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                                     std::int64_t lda, float *tau, float *scratchpad,
+                                     std::int64_t scratchpad_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    return detail::geqrf_tsqr(get_device_id(queue), queue, m, n, a, lda, tau, scratchpad,
+                              scratchpad_size, dependencies);
+}
+static inline sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                                     std::int64_t lda, double *tau, double *scratchpad,
+                                     std::int64_t scratchpad_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    return detail::geqrf_tsqr(get_device_id(queue), queue, m, n, a, lda, tau, scratchpad,
+                              scratchpad_size, dependencies);
+}
+static inline sycl::event geqrf_tsqr(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+    std::complex<float> *tau, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::geqrf_tsqr(get_device_id(queue), queue, m, n, a, lda, tau, scratchpad,
+                              scratchpad_size, dependencies);
+}
+static inline sycl::event geqrf_tsqr(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+    std::complex<double> *tau, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::geqrf_tsqr(get_device_id(queue), queue, m, n, a, lda, tau, scratchpad,
+                              scratchpad_size, dependencies);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t geqrf_tsqr_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        std::int64_t lda) {
+    return detail::geqrf_tsqr_scratchpad_size<fp_type>(get_device_id(queue), queue, m, n, lda);
+}
+static inline void gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &s,
+    sycl::buffer<float> &u, std::int64_t ldu, sycl::buffer<float> &vt, std::int64_t ldvt,
+    sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gesvd_randomized(get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample,
+                             power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                             scratchpad_size);
+}
+static inline void gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &s,
+    sycl::buffer<double> &u, std::int64_t ldu, sycl::buffer<double> &vt, std::int64_t ldvt,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gesvd_randomized(get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample,
+                             power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                             scratchpad_size);
+}
+static inline void gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+    sycl::buffer<float> &s, sycl::buffer<std::complex<float>> &u, std::int64_t ldu,
+    sycl::buffer<std::complex<float>> &vt, std::int64_t ldvt,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gesvd_randomized(get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample,
+                             power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                             scratchpad_size);
+}
+static inline void gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    sycl::buffer<double> &s, sycl::buffer<std::complex<double>> &u, std::int64_t ldu,
+    sycl::buffer<std::complex<double>> &vt, std::int64_t ldvt,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gesvd_randomized(get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample,
+                             power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                             scratchpad_size);
+}
+static inline sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const float *a, std::int64_t lda, float *s, float *u, std::int64_t ldu,
+    float *vt, std::int64_t ldvt, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesvd_randomized(get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample,
+                                    power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+static inline sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const double *a, std::int64_t lda, double *s, double *u, std::int64_t ldu,
+    double *vt, std::int64_t ldvt, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesvd_randomized(get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample,
+                                    power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+static inline sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const std::complex<float> *a, std::int64_t lda, float *s,
+    std::complex<float> *u, std::int64_t ldu, std::complex<float> *vt, std::int64_t ldvt,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesvd_randomized(get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample,
+                                    power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+static inline sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const std::complex<double> *a, std::int64_t lda, double *s,
+    std::complex<double> *u, std::int64_t ldu, std::complex<double> *vt, std::int64_t ldvt,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gesvd_randomized(get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample,
+                                    power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                                    scratchpad_size, dependencies);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesvd_randomized_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    return detail::gesvd_randomized_scratchpad_size<fp_type>(
+        get_device_id(queue), queue, jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+}
+static inline void heevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+    std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void heevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline sycl::event heevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+    std::int64_t iu, float abstol, std::int64_t *m, float *w, std::complex<float> *z,
+    std::int64_t ldz, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return detail::heevr_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, ldz);
+}
+static inline void heevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+    std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void heevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline sycl::event heevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+    std::int64_t iu, float abstol, std::int64_t *m, float *w, std::complex<float> *z,
+    std::int64_t ldz, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return detail::heevx_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, ldz);
+}
+static inline void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::syevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::syevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+    std::int64_t iu, double abstol, std::int64_t *m, double *w, double *z, std::int64_t ldz,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return detail::syevr_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, ldz);
+}
+static inline void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+                                const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+    std::int64_t iu, double abstol, std::int64_t *m, double *w, double *z, std::int64_t ldz,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return detail::syevx_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, ldz);
+}
+static inline void heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+    float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+    sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+    sycl::buffer<std::complex<float>> &z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::heevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                        il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size, scratchpad,
+                        scratchpad_size);
+}
+static inline void heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+    sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, std::int64_t stride_w,
+    sycl::buffer<std::complex<double>> &z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::heevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                        il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size, scratchpad,
+                        scratchpad_size);
+}
+static inline sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a,
+                               vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::int64_t stride_w, std::complex<double> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a,
+                               vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<float> **a, std::int64_t *lda, float *vl, float *vu,
+    std::int64_t *il, std::int64_t *iu, float *abstol, std::int64_t *m, float **w,
+    std::complex<float> **z, std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu,
+                               il, iu, abstol, m, w, z, ldz, group_count, group_sizes, scratchpad,
+                               scratchpad_size, dependencies);
+}
+static inline sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double *vl, double *vu,
+    std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m, double **w,
+    std::complex<double> **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu,
+                               il, iu, abstol, m, w, z, ldz, group_count, group_sizes, scratchpad,
+                               scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    return detail::heevr_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range,
+                                                        uplo, n, lda, stride_a, stride_w, ldz,
+                                                        stride_z, batch_size);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::job *jobz,
+                                         oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+                                         std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+                                         std::int64_t group_count, std::int64_t *group_sizes) {
+    return detail::heevr_batch_scratchpad_size<fp_type>(
+        get_device_id(queue), queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+static inline void heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+    float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+    sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+    sycl::buffer<std::complex<float>> &z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::heevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                        il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size, scratchpad,
+                        scratchpad_size);
+}
+static inline void heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+    sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, std::int64_t stride_w,
+    sycl::buffer<std::complex<double>> &z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::heevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                        il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size, scratchpad,
+                        scratchpad_size);
+}
+static inline sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a,
+                               vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::int64_t stride_w, std::complex<double> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a,
+                               vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<float> **a, std::int64_t *lda, float *vl, float *vu,
+    std::int64_t *il, std::int64_t *iu, float *abstol, std::int64_t *m, float **w,
+    std::complex<float> **z, std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu,
+                               il, iu, abstol, m, w, z, ldz, group_count, group_sizes, scratchpad,
+                               scratchpad_size, dependencies);
+}
+static inline sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double *vl, double *vu,
+    std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m, double **w,
+    std::complex<double> **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu,
+                               il, iu, abstol, m, w, z, ldz, group_count, group_sizes, scratchpad,
+                               scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    return detail::heevx_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range,
+                                                        uplo, n, lda, stride_a, stride_w, ldz,
+                                                        stride_z, batch_size);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::job *jobz,
+                                         oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+                                         std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+                                         std::int64_t group_count, std::int64_t *group_sizes) {
+    return detail::heevx_batch_scratchpad_size<fp_type>(
+        get_device_id(queue), queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+static inline void syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, std::int64_t stride_w, sycl::buffer<float> &z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::syevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                        il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size, scratchpad,
+                        scratchpad_size);
+}
+static inline void syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, std::int64_t stride_w, sycl::buffer<double> &z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::syevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                        il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size, scratchpad,
+                        scratchpad_size);
+}
+static inline sycl::event syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a, float vl, float vu,
+    std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    std::int64_t stride_w, float *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a,
+                               vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a,
+                               vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, float **a, std::int64_t *lda, float *vl, float *vu, std::int64_t *il,
+    std::int64_t *iu, float *abstol, std::int64_t *m, float **w, float **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu,
+                               il, iu, abstol, m, w, z, ldz, group_count, group_sizes, scratchpad,
+                               scratchpad_size, dependencies);
+}
+static inline sycl::event syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, double **a, std::int64_t *lda, double *vl, double *vu, std::int64_t *il,
+    std::int64_t *iu, double *abstol, std::int64_t *m, double **w, double **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevr_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu,
+                               il, iu, abstol, m, w, z, ldz, group_count, group_sizes, scratchpad,
+                               scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    return detail::syevr_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range,
+                                                        uplo, n, lda, stride_a, stride_w, ldz,
+                                                        stride_z, batch_size);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::job *jobz,
+                                         oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+                                         std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+                                         std::int64_t group_count, std::int64_t *group_sizes) {
+    return detail::syevr_batch_scratchpad_size<fp_type>(
+        get_device_id(queue), queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+static inline void syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, std::int64_t stride_w, sycl::buffer<float> &z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::syevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                        il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size, scratchpad,
+                        scratchpad_size);
+}
+static inline void syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, std::int64_t stride_w, sycl::buffer<double> &z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::syevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                        il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size, scratchpad,
+                        scratchpad_size);
+}
+static inline sycl::event syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a, float vl, float vu,
+    std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    std::int64_t stride_w, float *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a,
+                               vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, stride_a,
+                               vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, float **a, std::int64_t *lda, float *vl, float *vu, std::int64_t *il,
+    std::int64_t *iu, float *abstol, std::int64_t *m, float **w, float **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu,
+                               il, iu, abstol, m, w, z, ldz, group_count, group_sizes, scratchpad,
+                               scratchpad_size, dependencies);
+}
+static inline sycl::event syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, double **a, std::int64_t *lda, double *vl, double *vu, std::int64_t *il,
+    std::int64_t *iu, double *abstol, std::int64_t *m, double **w, double **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevx_batch(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu,
+                               il, iu, abstol, m, w, z, ldz, group_count, group_sizes, scratchpad,
+                               scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    return detail::syevx_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range,
+                                                        uplo, n, lda, stride_a, stride_w, ldz,
+                                                        stride_z, batch_size);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::job *jobz,
+                                         oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+                                         std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+                                         std::int64_t group_count, std::int64_t *group_sizes) {
+    return detail::syevx_batch_scratchpad_size<fp_type>(
+        get_device_id(queue), queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+static inline void heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                        batch_size, scratchpad, scratchpad_size);
+}
+static inline void heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                        batch_size, scratchpad, scratchpad_size);
+}
+static inline sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w,
+                               stride_w, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w,
+                               stride_w, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::complex<float> **a, std::int64_t *lda, float **w, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, group_count,
+                               group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::complex<double> **a, std::int64_t *lda, double **w, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, group_count,
+                               group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    return detail::heevd_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n,
+                                                        lda, stride_a, stride_w, batch_size);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    return detail::heevd_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n,
+                                                        lda, group_count, group_sizes);
+}
+static inline void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w,
+                               std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                               std::int64_t scratchpad_size) {
+    detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                        batch_size, scratchpad, scratchpad_size);
+}
+static inline void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<double> &w,
+                               std::int64_t stride_w, std::int64_t batch_size,
+                               sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                        batch_size, scratchpad, scratchpad_size);
+}
+static inline sycl::event syevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+    std::int64_t lda, std::int64_t stride_a, float *w, std::int64_t stride_w,
+    std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w,
+                               stride_w, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+    std::int64_t lda, std::int64_t stride_a, double *w, std::int64_t stride_w,
+    std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w,
+                               stride_w, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevd_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n, float **a,
+    std::int64_t *lda, float **w, std::int64_t group_count, std::int64_t *group_sizes,
+    float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, group_count,
+                               group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevd_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    double **a, std::int64_t *lda, double **w, std::int64_t group_count, std::int64_t *group_sizes,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, group_count,
+                               group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    return detail::syevd_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n,
+                                                        lda, stride_a, stride_w, batch_size);
+}
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_batch_scratchpad_size(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    return detail::syevd_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n,
+                                                        lda, group_count, group_sizes);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b,
+                              ldb, stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b,
+                              ldb, stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b,
+                              ldb, stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b,
+                              ldb, stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb,
+                              group_count, group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, double **a, std::int64_t *lda, double **b, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb,
+                              group_count, group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::complex<float> **a, std::int64_t *lda, std::complex<float> **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb,
+                              group_count, group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::complex<double> **a, std::int64_t *lda, std::complex<double> **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb,
+                              group_count, group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                        std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size) {
+    return detail::gels_batch_scratchpad_size<fp_type>(
+        get_device_id(queue), queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::transpose *trans,
+                                        std::int64_t *m, std::int64_t *n, std::int64_t *nrhs,
+                                        std::int64_t *lda, std::int64_t *ldb,
+                                        std::int64_t group_count, std::int64_t *group_sizes) {
+    return detail::gels_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, trans, m, n,
+                                                       nrhs, lda, ldb, group_count, group_sizes);
+}
 
 } // namespace lapack
 } // namespace mkl
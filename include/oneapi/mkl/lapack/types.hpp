@@ -42,6 +42,8 @@ template <typename T>
 struct is_rfp;
 template <typename T>
 struct is_cfp;
+template <typename T>
+struct is_mpfp;
 
 // auxilary typechecking templates
 template <typename T>
@@ -84,12 +86,23 @@ struct is_cfp<std::complex<double>> {
     static constexpr bool value{ true };
 };
 
+template <>
+struct is_mpfp<double> {
+    static constexpr bool value{ true };
+};
+template <>
+struct is_mpfp<std::complex<double>> {
+    static constexpr bool value{ true };
+};
+
 template <typename fp>
 using is_floating_point = typename enable_if<is_fp<fp>::value>::type*;
 template <typename fp>
 using is_real_floating_point = typename enable_if<is_rfp<fp>::value>::type*;
 template <typename fp>
 using is_complex_floating_point = typename enable_if<is_cfp<fp>::value>::type*;
+template <typename fp>
+using is_mixed_precision_floating_point = typename enable_if<is_mpfp<fp>::value>::type*;
 
 } // namespace internal
 } // namespace lapack
@@ -55,6 +55,35 @@ enum class index_base : char {
     one = 1,
 };
 
+// Accuracy hints for gemm. Backends may use a faster, less accurate
+// algorithm for the requested mode and ignore modes they do not support.
+enum class compute_mode : char {
+    unset = 0,
+    float_to_bf16 = 1,
+    float_to_bf16x2 = 2,
+    float_to_bf16x3 = 3,
+    float_to_tf32 = 4,
+    complex_3m = 5,
+    any = 6,
+};
+
+// Operand of gemm_pack and gemm_compute.
+enum class pack_matrix : char { a = 0, b = 1, A = 0, B = 1 };
+
+// Elementwise epilogue of gemm_epilogue. Each element x of
+// alpha * op(A) * op(B) + beta * C is stored as scale * activation(x + bias),
+// converted to the type of C. A row bias has one value per column of C and is
+// added to every row, a column bias one value per row of C.
+enum class epilogue_bias : char { none = 0, row = 1, column = 2, N = 0, R = 1, C = 2 };
+
+enum class activation : char { none = 0, relu = 1, gelu_tanh = 2, gelu_erf = 3 };
+
+struct epilogue_desc {
+    epilogue_bias bias = epilogue_bias::none;
+    activation act = activation::none;
+    double scale = 1.0;
+};
+
 // LAPACK flag types.
 enum class job : char {
     novec = 0,
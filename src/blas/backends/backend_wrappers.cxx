@@ -240,6 +240,49 @@ oneapi::mkl::blas::BACKEND::MAJOR::omatadd,
 oneapi::mkl::blas::BACKEND::MAJOR::omatadd,
 oneapi::mkl::blas::BACKEND::MAJOR::omatadd,
 oneapi::mkl::blas::BACKEND::MAJOR::omatadd,    
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_strassen,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_strassen,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy_dot,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy_dot,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::dot2,
+oneapi::mkl::blas::BACKEND::MAJOR::dot2,
+oneapi::mkl::blas::BACKEND::MAJOR::dot_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::dot_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack_get_size<float>,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack_get_size<double>,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack_get_size<std::complex<float>>,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack_get_size<std::complex<double>>,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
@@ -499,4 +542,61 @@ oneapi::mkl::blas::BACKEND::MAJOR::imatcopy_batch,
 oneapi::mkl::blas::BACKEND::MAJOR::imatcopy_batch,
 oneapi::mkl::blas::BACKEND::MAJOR::imatcopy_batch,
 oneapi::mkl::blas::BACKEND::MAJOR::imatcopy_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_strassen,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_strassen,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_out_of_core,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_out_of_core,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_out_of_core,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_out_of_core,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy_dot,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy_dot,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::axpby_nrm2,
+oneapi::mkl::blas::BACKEND::MAJOR::dot2,
+oneapi::mkl::blas::BACKEND::MAJOR::dot2,
+oneapi::mkl::blas::BACKEND::MAJOR::dot_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::dot_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::dot_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::dot_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::nrm2_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::asum_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::iamax_batch,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_epilogue,
     // clang-format on
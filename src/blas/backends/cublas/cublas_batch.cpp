@@ -328,6 +328,82 @@ void omatadd_batch(sycl::queue &queue, transpose transa, transpose transb, int64
     throw unimplemented("blas", "omatadd_batch", "for column_major layout");
 }
 
+void dot_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+               int64_t stridex, sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey,
+               sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "dot_batch", "for column_major layout");
+}
+
+void dot_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+               int64_t stridex, sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+               sycl::buffer<double, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "dot_batch", "for column_major layout");
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<double, 1> &result,
+                int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<double, 1> &result,
+                int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                 int64_t stridex, sycl::buffer<int64_t, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                 int64_t stridex, sycl::buffer<int64_t, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                 int64_t incx, int64_t stridex, sycl::buffer<int64_t, 1> &result,
+                 int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                 int64_t incx, int64_t stridex, sycl::buffer<int64_t, 1> &result,
+                 int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
 // USM APIs
 
 sycl::event copy_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx, float **y,
@@ -950,6 +1026,174 @@ sycl::event imatcopy_batch(sycl::queue &queue, transpose *trans, int64_t *m, int
     throw unimplemented("blas", "imatcopy_batch", "for column_major layout");
 }
 
+sycl::event dot_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                      const float *y, int64_t incy, int64_t stridey, float *result,
+                      int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot_batch", "for column_major layout");
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                      const double *y, int64_t incy, int64_t stridey, double *result,
+                      int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot_batch", "for column_major layout");
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                      const float **y, int64_t *incy, float *result, int64_t group_count,
+                      int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot_batch", "for column_major layout");
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                      const double **y, int64_t *incy, double *result, int64_t group_count,
+                      int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot_batch", "for column_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                       float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                       int64_t stridex, float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                       double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                       int64_t *incx, double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for column_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                       float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                       int64_t stridex, float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                       double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                       int64_t *incx, double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for column_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                        int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                        int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x,
+                        int64_t *incx, int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                        int64_t *incx, int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for column_major layout");
+}
+
 } // namespace column_major
 namespace row_major {
 
@@ -1233,6 +1477,82 @@ void omatadd_batch(sycl::queue &queue, transpose transa, transpose transb, int64
     throw unimplemented("blas", "omatadd_batch", "for row_major layout");
 }
 
+void dot_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+               int64_t stridex, sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey,
+               sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "dot_batch", "for row_major layout");
+}
+
+void dot_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+               int64_t stridex, sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+               sycl::buffer<double, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "dot_batch", "for row_major layout");
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<double, 1> &result,
+                int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<double, 1> &result,
+                int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                 int64_t stridex, sycl::buffer<int64_t, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                 int64_t stridex, sycl::buffer<int64_t, 1> &result, int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                 int64_t incx, int64_t stridex, sycl::buffer<int64_t, 1> &result,
+                 int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                 int64_t incx, int64_t stridex, sycl::buffer<int64_t, 1> &result,
+                 int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
 // USM APIs
 
 sycl::event copy_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx, float **y,
@@ -1776,6 +2096,174 @@ sycl::event imatcopy_batch(sycl::queue &queue, transpose *trans, int64_t *m, int
     throw unimplemented("blas", "imatcopy_batch", "for row_major layout");
 }
 
+sycl::event dot_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                      const float *y, int64_t incy, int64_t stridey, float *result,
+                      int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot_batch", "for row_major layout");
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                      const double *y, int64_t incy, int64_t stridey, double *result,
+                      int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot_batch", "for row_major layout");
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                      const float **y, int64_t *incy, float *result, int64_t group_count,
+                      int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot_batch", "for row_major layout");
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                      const double **y, int64_t *incy, double *result, int64_t group_count,
+                      int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot_batch", "for row_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                       float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                       int64_t stridex, float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                       double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                       int64_t *incx, double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "for row_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                       float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                       int64_t stridex, float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                       double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                       int64_t *incx, double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "for row_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                        int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                        int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x,
+                        int64_t *incx, int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                        int64_t *incx, int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "for row_major layout");
+}
+
 } // namespace row_major
 } // namespace cublas
 } // namespace blas
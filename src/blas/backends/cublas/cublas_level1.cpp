@@ -621,6 +621,42 @@ NRM2_LAUNCHER(std::complex<float>, float, cublasScnrm2)
 NRM2_LAUNCHER(std::complex<double>, double, cublasDznrm2)
 #undef NRM2_LAUNCHER
 
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpy_dot", "for column_major layout");
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpy_dot", "for column_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "dot2", "for column_major layout");
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "dot2", "for column_major layout");
+}
+
 // USM APIs
 
 // Level 1
@@ -1297,6 +1333,42 @@ NRM2_LAUNCHER_USM(std::complex<float>, float, cublasScnrm2)
 NRM2_LAUNCHER_USM(std::complex<double>, double, cublasDznrm2)
 #undef NRM2_LAUNCHER_USM
 
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy_dot", "for column_major layout");
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy_dot", "for column_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for column_major layout");
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot2", "for column_major layout");
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot2", "for column_major layout");
+}
+
 } // namespace column_major
 namespace row_major {
 
@@ -1565,6 +1637,42 @@ NRM2_LAUNCHER(std::complex<float>, float, cublasScnrm2)
 NRM2_LAUNCHER(std::complex<double>, double, cublasDznrm2)
 #undef NRM2_LAUNCHER
 
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpy_dot", "for row_major layout");
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpy_dot", "for row_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result) {
+    throw unimplemented("blas", "dot2", "for row_major layout");
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    throw unimplemented("blas", "dot2", "for row_major layout");
+}
+
 // USM APIs
 
 // Level 1
@@ -1846,6 +1954,42 @@ NRM2_LAUNCHER_USM(std::complex<float>, float, cublasScnrm2)
 NRM2_LAUNCHER_USM(std::complex<double>, double, cublasDznrm2)
 #undef NRM2_LAUNCHER_USM
 
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy_dot", "for row_major layout");
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy_dot", "for row_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpby_nrm2", "for row_major layout");
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot2", "for row_major layout");
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "dot2", "for row_major layout");
+}
+
 } // namespace row_major
 } // namespace cublas
 } // namespace blas
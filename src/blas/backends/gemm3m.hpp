@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_GEMM3M_HPP_
+#define _ONEMKL_BLAS_GEMM3M_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace gemm3m {
+
+/**
+ * Complex gemm with three real matrix products, shared by the backends
+ * implementing gemm3m.
+ *
+ * With op(A) = Ar + i Ai and op(B) = Br + i Bi, the product is formed from
+ *
+ *   T1 = Ar * Br,  T2 = Ai * Bi,  T3 = (Ar + Ai) * (Br + Bi)
+ *
+ * as op(A) * op(B) = (T1 - T2) + i (T3 - T1 - T2), which replaces the four
+ * real products of a complex gemm by three. k is processed in panels of
+ * panel_size: every panel of op(A) and op(B) is split into dense column major
+ * real, imaginary and summed parts, and the three real products of the panels
+ * are accumulated into T1, T2 and T3 with the backend real gemm. C is updated
+ * once all panels are done.
+ */
+constexpr std::int64_t panel_size = 512;
+
+// Number of real elements of workspace needed for an m x n x k product.
+inline std::int64_t workspace_size(std::int64_t m, std::int64_t n, std::int64_t k) {
+    const std::int64_t kb = std::min(k, panel_size);
+    return 3 * (m * kb + kb * n + m * n);
+}
+
+// Distances between consecutive rows (rs) and columns (cs) of op(X).
+inline void op_strides(bool col_major, transpose trans, std::int64_t ld, std::int64_t &rs,
+                       std::int64_t &cs) {
+    const bool no_trans = (trans == transpose::nontrans);
+    rs = (col_major == no_trans) ? 1 : ld;
+    cs = (col_major == no_trans) ? ld : 1;
+}
+
+// Splits a rows x cols block of op(X), starting at x, into its real part, its
+// imaginary part and their sum, stored column major with leading dimension
+// rows. Src is a pointer or an accessor to std::complex<T>.
+template <typename T, typename Src>
+struct split_kernel {
+    Src x;
+    std::int64_t offset, rs, cs;
+    bool conj;
+    std::int64_t rows;
+    T *re, *im, *sum;
+
+    void operator()(std::int64_t i, std::int64_t j) const {
+        const std::complex<T> v = x[offset + i * rs + j * cs];
+        const T v_re = v.real();
+        const T v_im = conj ? -v.imag() : v.imag();
+        const std::int64_t idx = i + j * rows;
+        re[idx] = v_re;
+        im[idx] = v_im;
+        sum[idx] = v_re + v_im;
+    }
+
+    void operator()(sycl::id<2> id) const {
+        (*this)(id[0], id[1]);
+    }
+};
+
+// Sets C = alpha * ((T1 - T2) + i (T3 - T1 - T2)) + beta * C, with T1, T2, T3
+// stored column major with leading dimension m. When has_product is false
+// (k = 0) the product is taken as zero. Dst is a pointer or an accessor to
+// std::complex<T>.
+template <typename T, typename Dst>
+struct combine_kernel {
+    const T *t1, *t2, *t3;
+    std::int64_t m;
+    bool has_product;
+    std::complex<T> alpha, beta;
+    bool beta_zero;
+    Dst c;
+    std::int64_t rs, cs;
+
+    void operator()(std::int64_t i, std::int64_t j) const {
+        const std::int64_t idx = i + j * m;
+        const T p_re = has_product ? t1[idx] - t2[idx] : T(0);
+        const T p_im = has_product ? t3[idx] - t1[idx] - t2[idx] : T(0);
+        T c_re = alpha.real() * p_re - alpha.imag() * p_im;
+        T c_im = alpha.real() * p_im + alpha.imag() * p_re;
+        const std::int64_t c_idx = i * rs + j * cs;
+        if (!beta_zero) {
+            const std::complex<T> old = c[c_idx];
+            c_re += beta.real() * old.real() - beta.imag() * old.imag();
+            c_im += beta.real() * old.imag() + beta.imag() * old.real();
+        }
+        c[c_idx] = std::complex<T>(c_re, c_im);
+    }
+
+    void operator()(sycl::id<2> id) const {
+        (*this)(id[0], id[1]);
+    }
+};
+
+namespace detail {
+
+template <typename T>
+inline const T *get_input(sycl::handler &, const T *x) {
+    return x;
+}
+
+template <typename T>
+inline auto get_input(sycl::handler &cgh, sycl::buffer<T, 1> &x) {
+    return x.template get_access<sycl::access::mode::read>(cgh);
+}
+
+template <typename T>
+inline T *get_output(sycl::handler &, T *x) {
+    return x;
+}
+
+template <typename T>
+inline auto get_output(sycl::handler &cgh, sycl::buffer<T, 1> &x) {
+    return x.template get_access<sycl::access::mode::read_write>(cgh);
+}
+
+} // namespace detail
+
+/**
+ * gemm3m driver for device backends. A, B and C are either USM pointers or
+ * buffers. gemm is a callable with the signature of the backend column major
+ * USM gemm for T, used for the real products. The workspace is allocated on
+ * the device of queue and freed once C has been updated.
+ */
+template <typename T, typename AType, typename BType, typename CType, typename Gemm>
+sycl::event gemm3m(sycl::queue &queue, bool col_major, transpose transa, transpose transb,
+                   std::int64_t m, std::int64_t n, std::int64_t k, std::complex<T> alpha, AType &a,
+                   std::int64_t lda, BType &b, std::int64_t ldb, std::complex<T> beta, CType &c,
+                   std::int64_t ldc, const std::vector<sycl::event> &dependencies, Gemm gemm) {
+    const std::int64_t kb = std::min(k, panel_size);
+    T *workspace = nullptr;
+    if (m > 0 && n > 0) {
+        workspace = sycl::malloc_device<T>(workspace_size(m, n, k), queue);
+        if (!workspace)
+            throw device_bad_alloc("blas", "gemm3m", queue.get_device());
+    }
+    T *a_re = workspace, *a_im = a_re + m * kb, *a_sum = a_im + m * kb;
+    T *b_re = a_sum + m * kb, *b_im = b_re + kb * n, *b_sum = b_im + kb * n;
+    T *t1 = b_sum + kb * n, *t2 = t1 + m * n, *t3 = t2 + m * n;
+
+    std::int64_t a_rs, a_cs, b_rs, b_cs, c_rs, c_cs;
+    op_strides(col_major, transa, lda, a_rs, a_cs);
+    op_strides(col_major, transb, ldb, b_rs, b_cs);
+    op_strides(col_major, transpose::nontrans, ldc, c_rs, c_cs);
+    const bool conj_a = (transa == transpose::conjtrans);
+    const bool conj_b = (transb == transpose::conjtrans);
+
+    // last holds the events the next step depends on, pending every event
+    // that may still use the workspace.
+    std::vector<sycl::event> last = dependencies, pending;
+    try {
+        for (std::int64_t p = 0; m > 0 && n > 0 && p < k; p += kb) {
+            const std::int64_t kp = std::min(kb, k - p);
+            auto split_a_done = queue.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(last);
+                auto a_src = detail::get_input(cgh, a);
+                using kernel_t = split_kernel<T, decltype(a_src)>;
+                cgh.parallel_for(sycl::range<2>(m, kp),
+                                 kernel_t{ a_src, p * a_cs, a_rs, a_cs, conj_a, m, a_re, a_im,
+                                           a_sum });
+            });
+            auto split_b_done = queue.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(last);
+                auto b_src = detail::get_input(cgh, b);
+                using kernel_t = split_kernel<T, decltype(b_src)>;
+                cgh.parallel_for(sycl::range<2>(kp, n),
+                                 kernel_t{ b_src, p * b_rs, b_rs, b_cs, conj_b, kp, b_re, b_im,
+                                           b_sum });
+            });
+            const std::vector<sycl::event> splits{ split_a_done, split_b_done };
+            pending.insert(pending.end(), splits.begin(), splits.end());
+            const T beta_p = (p == 0) ? T(0) : T(1);
+            last.clear();
+            auto real_gemm = [&](const T *x, const T *y, T *t) {
+                last.push_back(gemm(queue, transpose::nontrans, transpose::nontrans, m, n, kp,
+                                    T(1), x, m, y, kp, beta_p, t, m, splits));
+                pending.push_back(last.back());
+            };
+            real_gemm(a_re, b_re, t1);
+            real_gemm(a_im, b_im, t2);
+            real_gemm(a_sum, b_sum, t3);
+        }
+        last = { queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(last);
+            auto c_dst = detail::get_output(cgh, c);
+            using kernel_t = combine_kernel<T, decltype(c_dst)>;
+            cgh.parallel_for(sycl::range<2>(m, n),
+                             kernel_t{ t1, t2, t3, m, k > 0, alpha, beta,
+                                       beta == std::complex<T>(0), c_dst, c_rs, c_cs });
+        }) };
+    }
+    catch (...) {
+        if (workspace) {
+            sycl::event::wait(pending);
+            sycl::free(workspace, queue);
+        }
+        throw;
+    }
+    if (!workspace)
+        return last.front();
+
+    auto context = queue.get_context();
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(last);
+        cgh.host_task([=]() { sycl::free(workspace, context); });
+    });
+}
+
+} // namespace gemm3m
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_GEMM3M_HPP_
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_GEMM_EPILOGUE_HPP_
+#define _ONEMKL_BLAS_GEMM_EPILOGUE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cstdint>
+
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace epilogue {
+
+/**
+ * Elementwise epilogue of gemm_epilogue, applied by the backends to every
+ * element of C as it is written back. It is used on the host and in kernels,
+ * so it only holds scalars.
+ *
+ * The backends compute a row major C as the column major C^T, so the bias is
+ * described by the strides of a column major C: element (i, j) adds
+ * bias[i * bias_rs + j * bias_cs].
+ */
+template <typename T>
+struct op {
+    bool has_bias;
+    std::int64_t bias_rs, bias_cs;
+    activation act;
+    T scale;
+
+    op(const epilogue_desc &desc, bool col_major)
+            : has_bias(desc.bias != epilogue_bias::none),
+              bias_rs((desc.bias == epilogue_bias::column) == col_major ? 1 : 0),
+              bias_cs(1 - bias_rs),
+              act(desc.act),
+              scale(static_cast<T>(desc.scale)) {}
+
+    // x is alpha * op(A) * op(B) + beta * C at (i, j); bias is a pointer or an
+    // accessor, not read without a bias.
+    template <typename Bias>
+    T operator()(T x, const Bias &bias, std::int64_t i, std::int64_t j) const {
+        if (has_bias)
+            x += bias[i * bias_rs + j * bias_cs];
+        switch (act) {
+            case activation::relu: x = (x > T(0)) ? x : T(0); break;
+            case activation::gelu_tanh: {
+                const T u = T(0.7978845608028654) * (x + T(0.044715) * x * x * x);
+                x = T(0.5) * x * (T(1) + sycl::tanh(u));
+                break;
+            }
+            case activation::gelu_erf:
+                x = T(0.5) * x * (T(1) + sycl::erf(x * T(0.7071067811865476)));
+                break;
+            default: break;
+        }
+        return scale * x;
+    }
+};
+
+} // namespace epilogue
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_GEMM_EPILOGUE_HPP_
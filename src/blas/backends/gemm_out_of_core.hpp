@@ -0,0 +1,267 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_GEMM_OUT_OF_CORE_HPP_
+#define _ONEMKL_BLAS_GEMM_OUT_OF_CORE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace out_of_core {
+
+/**
+ * Out-of-core gemm shared by the backends implementing gemm_out_of_core.
+ *
+ * A, B and C stay in host memory. C is processed tile by tile: for every
+ * mb x nb tile of C, the matching mb x kb tiles of op(A) and kb x nb tiles of
+ * op(B) are packed on the host into pinned staging memory, copied to the
+ * device and multiplied into the device copy of the C tile with the backend
+ * column major gemm. Two slots are kept for every tile kind, so packing and
+ * copying the next A and B tiles and writing back the previous C tile run on
+ * a separate copy queue while the current gemm runs on the user's queue.
+ */
+
+// Tile sizes for one problem. 2 * (mb * kb + kb * nb + mb * nb) elements of
+// device memory and as many of pinned host memory are used.
+struct tiling {
+    std::int64_t mb, nb, kb;
+};
+
+inline tiling choose_tiling(std::int64_t m, std::int64_t n, std::int64_t k,
+                            std::int64_t max_elements) {
+    const std::int64_t budget = max_elements / 2;
+    const auto t = static_cast<std::int64_t>(std::sqrt(budget / 3.0));
+    if (t < 1)
+        throw invalid_argument("blas", "gemm_out_of_core", "max_memory is too small");
+    tiling tl{ std::min(m, t), std::min(n, t), 0 };
+    // Spend the memory left by small m or n on longer k panels.
+    tl.kb = std::min(k, (budget - tl.mb * tl.nb) / (tl.mb + tl.nb));
+    return tl;
+}
+
+// Bytes of device memory the tiles may use: max_memory if positive, otherwise
+// half of the global memory of the device, within the maximum allocation size.
+inline std::int64_t memory_budget(const sycl::queue &queue, std::int64_t max_memory) {
+    if (max_memory > 0)
+        return max_memory;
+    const auto device = queue.get_device();
+    const auto global_mem = device.get_info<sycl::info::device::global_mem_size>();
+    const auto max_alloc = device.get_info<sycl::info::device::max_mem_alloc_size>();
+    return static_cast<std::int64_t>(std::min<std::uint64_t>(global_mem / 2, max_alloc));
+}
+
+template <typename T>
+inline T conj_if(bool conj, T x) {
+    return x;
+}
+
+template <typename T>
+inline std::complex<T> conj_if(bool conj, std::complex<T> x) {
+    return conj ? std::conj(x) : x;
+}
+
+// Copies the rows x cols block of op(X) at (i0, j0) into dst, column major with
+// leading dimension rows.
+template <typename T>
+void pack(bool col_major, transpose trans, const T *x, std::int64_t ldx, std::int64_t i0,
+          std::int64_t j0, std::int64_t rows, std::int64_t cols, T *dst) {
+    const bool no_trans = (trans == transpose::nontrans);
+    const bool conj = (trans == transpose::conjtrans);
+    const std::int64_t rs = (col_major == no_trans) ? 1 : ldx;
+    const std::int64_t cs = (col_major == no_trans) ? ldx : 1;
+    for (std::int64_t j = 0; j < cols; ++j) {
+        const T *src = x + i0 * rs + (j0 + j) * cs;
+        for (std::int64_t i = 0; i < rows; ++i)
+            dst[i + j * rows] = conj_if(conj, src[i * rs]);
+    }
+}
+
+// Inverse of pack for the nontransposed C.
+template <typename T>
+void unpack(bool col_major, const T *src, std::int64_t i0, std::int64_t j0, std::int64_t rows,
+            std::int64_t cols, T *c, std::int64_t ldc) {
+    const std::int64_t rs = col_major ? 1 : ldc;
+    const std::int64_t cs = col_major ? ldc : 1;
+    for (std::int64_t j = 0; j < cols; ++j) {
+        T *dst = c + i0 * rs + (j0 + j) * cs;
+        for (std::int64_t i = 0; i < rows; ++i)
+            dst[i * rs] = src[i + j * rows];
+    }
+}
+
+// C = beta * C for the nontransposed C, as gemm computes it when k = 0.
+template <typename T>
+void scale(bool col_major, std::int64_t m, std::int64_t n, T beta, T *c, std::int64_t ldc) {
+    const std::int64_t rs = col_major ? 1 : ldc;
+    const std::int64_t cs = col_major ? ldc : 1;
+    for (std::int64_t j = 0; j < n; ++j) {
+        T *dst = c + j * cs;
+        for (std::int64_t i = 0; i < m; ++i)
+            dst[i * rs] = (beta == T(0)) ? T(0) : beta * dst[i * rs];
+    }
+}
+
+/**
+ * USM driver. a, b and c are host pointers. gemm is a callable with the
+ * signature of the backend column major USM gemm for T. The returned event
+ * completes once C has been written back and the temporary memory released.
+ */
+template <typename T, typename Gemm>
+sycl::event gemm_out_of_core(sycl::queue &queue, bool col_major, transpose transa,
+                             transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                             T alpha, const T *a, std::int64_t lda, const T *b, std::int64_t ldb,
+                             T beta, T *c, std::int64_t ldc, std::int64_t max_memory,
+                             const std::vector<sycl::event> &dependencies, Gemm gemm) {
+    if (max_memory < 0)
+        throw invalid_argument("blas", "gemm_out_of_core", "max_memory must be non-negative");
+    if (m <= 0 || n <= 0) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            cgh.host_task([]() {});
+        });
+    }
+    // An empty product only scales C, which is done in place on the host
+    // without packing anything or touching the device.
+    if (k <= 0) {
+        return queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
+            cgh.host_task([=]() { scale(col_major, m, n, beta, c, ldc); });
+        });
+    }
+
+    const tiling tl =
+        choose_tiling(m, n, k, memory_budget(queue, max_memory) / std::int64_t(sizeof(T)));
+    const std::int64_t a_size = tl.mb * tl.kb, b_size = tl.kb * tl.nb, c_size = tl.mb * tl.nb;
+    const std::int64_t slot_size = a_size + b_size + c_size;
+    T *device_mem = sycl::malloc_device<T>(2 * slot_size, queue);
+    if (!device_mem)
+        throw device_bad_alloc("blas", "gemm_out_of_core", queue.get_device());
+    T *host_mem = sycl::malloc_host<T>(2 * slot_size, queue);
+    if (!host_mem) {
+        sycl::free(device_mem, queue);
+        throw host_bad_alloc("blas", "gemm_out_of_core");
+    }
+
+    sycl::queue copy_queue(queue.get_context(), queue.get_device());
+    const bool load_c = (beta != T(0));
+
+    // Last users of each slot: staging_free for the host side of the A and B
+    // tiles, ab_free for their device side and c_free for both sides of C.
+    std::array<sycl::event, 2> staging_free, ab_free, c_free;
+    std::vector<sycl::event> stores;
+    try {
+        std::int64_t step = 0, tile = 0;
+        for (std::int64_t i0 = 0; i0 < m; i0 += tl.mb) {
+            for (std::int64_t j0 = 0; j0 < n; j0 += tl.nb, ++tile) {
+                const std::int64_t mt = std::min(tl.mb, m - i0);
+                const std::int64_t nt = std::min(tl.nb, n - j0);
+                const std::int64_t cs = tile % 2;
+                T *c_dev = device_mem + cs * slot_size + a_size + b_size;
+                T *c_host = host_mem + cs * slot_size + a_size + b_size;
+
+                sycl::event c_ready = c_free[cs];
+                if (load_c) {
+                    auto packed = copy_queue.submit([&](sycl::handler &cgh) {
+                        cgh.depends_on(dependencies);
+                        cgh.depends_on(c_free[cs]);
+                        cgh.host_task([=]() {
+                            pack<T>(col_major, transpose::nontrans, c, ldc, i0, j0, mt, nt,
+                                    c_host);
+                        });
+                    });
+                    c_ready = copy_queue.memcpy(c_dev, c_host, sizeof(T) * mt * nt, packed);
+                }
+
+                sycl::event last = c_ready;
+                for (std::int64_t p = 0; p < k; p += tl.kb, ++step) {
+                    const std::int64_t kt = std::min(tl.kb, k - p);
+                    const std::int64_t s = step % 2;
+                    T *a_dev = device_mem + s * slot_size, *b_dev = a_dev + a_size;
+                    T *a_host = host_mem + s * slot_size, *b_host = a_host + a_size;
+
+                    auto packed = copy_queue.submit([&](sycl::handler &cgh) {
+                        cgh.depends_on(dependencies);
+                        cgh.depends_on(staging_free[s]);
+                        cgh.host_task([=]() {
+                            pack(col_major, transa, a, lda, i0, p, mt, kt, a_host);
+                            pack(col_major, transb, b, ldb, p, j0, kt, nt, b_host);
+                        });
+                    });
+                    const std::vector<sycl::event> ready{ packed, ab_free[s] };
+                    auto a_loaded = copy_queue.memcpy(a_dev, a_host, sizeof(T) * mt * kt, ready);
+                    auto b_loaded = copy_queue.memcpy(b_dev, b_host, sizeof(T) * kt * nt, ready);
+                    staging_free[s] = copy_queue.submit([&](sycl::handler &cgh) {
+                        cgh.depends_on({ a_loaded, b_loaded });
+                        cgh.host_task([]() {});
+                    });
+                    const std::vector<sycl::event> loaded{ a_loaded, b_loaded, last };
+                    last = gemm(queue, transpose::nontrans, transpose::nontrans, mt, nt, kt, alpha,
+                                a_dev, mt, b_dev, kt, (p == 0) ? beta : T(1), c_dev, mt, loaded);
+                    ab_free[s] = last;
+                }
+
+                auto stored = copy_queue.memcpy(c_host, c_dev, sizeof(T) * mt * nt, last);
+                c_free[cs] = copy_queue.submit([&](sycl::handler &cgh) {
+                    cgh.depends_on(stored);
+                    cgh.host_task([=]() { unpack(col_major, c_host, i0, j0, mt, nt, c, ldc); });
+                });
+                stores.push_back(c_free[cs]);
+            }
+        }
+    }
+    catch (...) {
+        copy_queue.wait();
+        queue.wait();
+        sycl::free(device_mem, queue);
+        sycl::free(host_mem, queue);
+        throw;
+    }
+
+    auto context = queue.get_context();
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(stores);
+        cgh.host_task([=]() {
+            sycl::free(device_mem, context);
+            sycl::free(host_mem, context);
+        });
+    });
+}
+
+} // namespace out_of_core
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_GEMM_OUT_OF_CORE_HPP_
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_GEMM_PACK_HPP_
+#define _ONEMKL_BLAS_GEMM_PACK_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace packed_gemm {
+
+/**
+ * gemm_pack and gemm_compute for the device backends.
+ *
+ * The packed operand is alpha * op(X) stored as a dense column major matrix,
+ * so that gemm_compute is one backend gemm that neither transposes,
+ * conjugates nor scales it. A row major C^T = op(B)^T * op(A)^T is computed
+ * as a column major product with m and n and the roles of A and B swapped;
+ * op(X)^T of a row major X is the same transpose operation applied to X read
+ * as a column major matrix.
+ */
+inline void to_column_major(bool col_major, pack_matrix &which, std::int64_t &m,
+                            std::int64_t &n) {
+    if (!col_major) {
+        std::swap(m, n);
+        which = (which == pack_matrix::a) ? pack_matrix::b : pack_matrix::a;
+    }
+}
+
+// Number of elements of the packed operand, the same for both layouts.
+inline std::int64_t packed_size(pack_matrix which, std::int64_t m, std::int64_t n,
+                                std::int64_t k) {
+    const std::int64_t rows = (which == pack_matrix::a) ? m : k;
+    const std::int64_t cols = (which == pack_matrix::a) ? k : n;
+    return std::max<std::int64_t>(rows, 0) * std::max<std::int64_t>(cols, 0);
+}
+
+template <typename T>
+inline T conj_if(bool conj, T x) {
+    return x;
+}
+
+template <typename T>
+inline std::complex<T> conj_if(bool conj, std::complex<T> x) {
+    return conj ? std::complex<T>(x.real(), -x.imag()) : x;
+}
+
+// Stores alpha * op(X) column major with leading dimension rows. Src and Dst
+// are pointers or accessors to T.
+template <typename T, typename Src, typename Dst>
+struct pack_kernel {
+    Src x;
+    std::int64_t rs, cs;
+    bool conj;
+    T alpha;
+    std::int64_t rows;
+    Dst dst;
+
+    void operator()(sycl::id<2> id) const {
+        const std::int64_t i = id[0], j = id[1];
+        dst[i + j * rows] = alpha * conj_if(conj, T(x[i * rs + j * cs]));
+    }
+};
+
+namespace detail {
+
+template <typename T>
+inline const T *get_input(sycl::handler &, const T *x) {
+    return x;
+}
+
+template <typename T>
+inline auto get_input(sycl::handler &cgh, sycl::buffer<T, 1> &x) {
+    return x.template get_access<sycl::access::mode::read>(cgh);
+}
+
+template <typename T>
+inline T *get_output(sycl::handler &, T *x) {
+    return x;
+}
+
+template <typename T>
+inline auto get_output(sycl::handler &cgh, sycl::buffer<T, 1> &x) {
+    return x.template get_access<sycl::access::mode::write>(cgh);
+}
+
+} // namespace detail
+
+// Packs alpha * op(X). x and packed are both USM pointers or both buffers.
+template <typename T, typename XType, typename PackedType>
+sycl::event pack(sycl::queue &queue, bool col_major, pack_matrix which, transpose trans,
+                 std::int64_t m, std::int64_t n, std::int64_t k, T alpha, XType &x,
+                 std::int64_t ld, PackedType &packed,
+                 const std::vector<sycl::event> &dependencies) {
+    to_column_major(col_major, which, m, n);
+    const std::int64_t rows = std::max<std::int64_t>((which == pack_matrix::a) ? m : k, 0);
+    const std::int64_t cols = std::max<std::int64_t>((which == pack_matrix::a) ? k : n, 0);
+    const bool no_trans = (trans == transpose::nontrans);
+    const std::int64_t rs = no_trans ? 1 : ld;
+    const std::int64_t cs = no_trans ? ld : 1;
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto src = detail::get_input(cgh, x);
+        auto dst = detail::get_output(cgh, packed);
+        using kernel_t = pack_kernel<T, decltype(src), decltype(dst)>;
+        cgh.parallel_for(sycl::range<2>(rows, cols),
+                         kernel_t{ src, rs, cs, trans == transpose::conjtrans, alpha, rows, dst });
+    });
+}
+
+/**
+ * C = packed * op(B) + beta * C or C = op(A) * packed + beta * C. gemm is a
+ * callable with the signature of the backend column major gemm for the types
+ * of packed, x and C, buffers or USM pointers; dependencies are passed on to
+ * it and its result is returned.
+ */
+template <typename T, typename PackedType, typename XType, typename CType, typename Gemm,
+          typename... Deps>
+auto compute(sycl::queue &queue, bool col_major, pack_matrix which, transpose trans,
+             std::int64_t m, std::int64_t n, std::int64_t k, PackedType &packed, XType &x,
+             std::int64_t ldx, T beta, CType &c, std::int64_t ldc, Gemm gemm,
+             const Deps &...dependencies) {
+    to_column_major(col_major, which, m, n);
+    if (which == pack_matrix::a)
+        return gemm(queue, transpose::nontrans, trans, m, n, k, T(1), packed,
+                    std::max<std::int64_t>(1, m), x, ldx, beta, c, ldc, dependencies...);
+    return gemm(queue, trans, transpose::nontrans, m, n, k, T(1), x, ldx, packed,
+                std::max<std::int64_t>(1, k), beta, c, ldc, dependencies...);
+}
+
+} // namespace packed_gemm
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_GEMM_PACK_HPP_
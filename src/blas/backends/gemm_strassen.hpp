@@ -0,0 +1,379 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_GEMM_STRASSEN_HPP_
+#define _ONEMKL_BLAS_GEMM_STRASSEN_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace strassen {
+
+// Larger levels arguments are clamped to max_levels. Each level adds up to
+// about four bits of error, and on the netlib backend already two levels were
+// slower than gemm at n = 4096.
+constexpr std::int64_t max_levels = 4;
+
+/**
+ * Strassen-Winograd gemm shared by the backends implementing gemm_strassen.
+ *
+ * Each recursion level splits op(A), op(B) and C into 2 x 2 blocks and forms
+ * the product with the 7 block multiplications and 15 block additions of
+ * Winograd's variant of Strassen's algorithm, using four temporaries: S and T
+ * for operand sums and P1, P2 for partial products. Odd trailing rows and
+ * columns are peeled off and handled with the backend gemm. The recursion only
+ * relies on an Ops policy providing
+ *
+ *   void gemm(m, n, k, alpha, const_view a, const_view b, beta, view c);
+ *   void combine(m, n, view dst, const std::array<term<T>, 3> &terms);
+ *
+ * where combine sets dst to the sum of coef * x over the terms with a non-null
+ * x, so the same schedule drives host and device implementations.
+ */
+
+// An m x n block of op(X), where X is stored with leading dimension ld in the
+// layout the view was created for. rs and cs are the distances between
+// consecutive rows and columns of op(X).
+template <typename T>
+struct matrix_view {
+    T *ptr;
+    std::int64_t ld;
+    transpose trans;
+    std::int64_t rs, cs;
+
+    matrix_view block(std::int64_t i, std::int64_t j) const {
+        return { ptr + i * rs + j * cs, ld, trans, rs, cs };
+    }
+
+    template <typename U = T, typename = std::enable_if_t<!std::is_const_v<U>>>
+    operator matrix_view<const U>() const {
+        return { ptr, ld, trans, rs, cs };
+    }
+};
+
+template <typename T>
+inline matrix_view<T> make_view(T *ptr, bool col_major, transpose trans, std::int64_t ld) {
+    const bool no_trans = (trans == transpose::nontrans);
+    const std::int64_t rs = (col_major == no_trans) ? 1 : ld;
+    const std::int64_t cs = (col_major == no_trans) ? ld : 1;
+    return { ptr, ld, trans, rs, cs };
+}
+
+template <typename T>
+struct term {
+    T coef;
+    matrix_view<const T> x;
+};
+
+template <typename T, typename Ops>
+class strassen_gemm {
+public:
+    using view = matrix_view<T>;
+    using const_view = matrix_view<const T>;
+    using terms = std::array<term<T>, 3>;
+
+    // Number of elements of workspace needed by run() for the given problem.
+    static std::int64_t workspace_size(std::int64_t levels, std::int64_t m, std::int64_t n,
+                                       std::int64_t k) {
+        std::int64_t size = 0;
+        for (; levels > 0 && m >= 2 && n >= 2 && k >= 2; --levels) {
+            m /= 2;
+            n /= 2;
+            k /= 2;
+            size += m * k + k * n + 2 * m * n;
+        }
+        return size;
+    }
+
+    strassen_gemm(Ops &ops, bool col_major) : ops_(ops), col_major_(col_major) {}
+
+    // Computes C = alpha * op(A) * op(B) + beta * C with up to levels levels of
+    // recursion. workspace must hold workspace_size(levels, m, n, k) elements.
+    void run(std::int64_t levels, std::int64_t m, std::int64_t n, std::int64_t k, T alpha,
+             const_view a, const_view b, T beta, view c, T *workspace) {
+        if (levels <= 0 || m < 2 || n < 2 || k < 2) {
+            ops_.gemm(m, n, k, alpha, a, b, beta, c);
+            return;
+        }
+        const std::int64_t mh = m / 2, nh = n / 2, kh = k / 2;
+
+        view s = temporary(workspace, mh, kh);
+        view t = temporary(s.ptr + mh * kh, kh, nh);
+        view p1 = temporary(t.ptr + kh * nh, mh, nh);
+        view p2 = temporary(p1.ptr + mh * nh, mh, nh);
+        T *next = p2.ptr + mh * nh;
+
+        const_view a11 = a, a12 = a.block(0, kh), a21 = a.block(mh, 0), a22 = a.block(mh, kh);
+        const_view b11 = b, b12 = b.block(0, nh), b21 = b.block(kh, 0), b22 = b.block(kh, nh);
+        view c11 = c, c12 = c.block(0, nh), c21 = c.block(mh, 0), c22 = c.block(mh, nh);
+        auto multiply = [&](T scale, const_view x, const_view y, T c_scale, view z) {
+            run(levels - 1, mh, nh, kh, scale, x, y, c_scale, z, next);
+        };
+
+        // P1 = A11 * B11
+        multiply(T(1), a11, b11, T(0), p1);
+        // C11 = alpha * (A12 * B21 + P1) + beta * C11
+        multiply(alpha, a12, b21, beta, c11);
+        ops_.combine(mh, nh, c11, terms{ { { T(1), c11 }, { alpha, p1 } } });
+        // P1 += (A21 + A22 - A11) * (B22 - B12 + B11)
+        ops_.combine(mh, kh, s, terms{ { { T(1), a21 }, { T(1), a22 }, { T(-1), a11 } } });
+        ops_.combine(kh, nh, t, terms{ { { T(1), b22 }, { T(-1), b12 }, { T(1), b11 } } });
+        multiply(T(1), s, t, T(1), p1);
+        // P2 = (A21 + A22) * (B12 - B11)
+        ops_.combine(mh, kh, s, terms{ { { T(1), a21 }, { T(1), a22 } } });
+        ops_.combine(kh, nh, t, terms{ { { T(1), b12 }, { T(-1), b11 } } });
+        multiply(T(1), s, t, T(0), p2);
+        // P1 += P2, C12 = alpha * ((A12 - A21 - A22 + A11) * B22 + P1) + beta * C12
+        ops_.combine(mh, nh, p1, terms{ { { T(1), p1 }, { T(1), p2 } } });
+        ops_.combine(mh, kh, s, terms{ { { T(1), a12 }, { T(-1), s }, { T(1), a11 } } });
+        multiply(alpha, s, b22, beta, c12);
+        ops_.combine(mh, nh, c12, terms{ { { T(1), c12 }, { alpha, p1 } } });
+        // P1 += (A11 - A21) * (B22 - B12), C22 = alpha * P1 + beta * C22
+        ops_.combine(mh, kh, s, terms{ { { T(1), a11 }, { T(-1), a21 } } });
+        ops_.combine(kh, nh, t, terms{ { { T(1), b22 }, { T(-1), b12 } } });
+        multiply(T(1), s, t, T(1), p1);
+        if (beta == T(0))
+            ops_.combine(mh, nh, c22, terms{ { { alpha, p1 } } });
+        else
+            ops_.combine(mh, nh, c22, terms{ { { alpha, p1 }, { beta, c22 } } });
+        // P1 -= P2, C21 = alpha * (P1 - A22 * (B22 - B12 + B11 - B21)) + beta * C21
+        ops_.combine(mh, nh, p1, terms{ { { T(1), p1 }, { T(-1), p2 } } });
+        ops_.combine(kh, nh, t, terms{ { { T(1), t }, { T(1), b11 }, { T(-1), b21 } } });
+        multiply(-alpha, a22, t, beta, c21);
+        ops_.combine(mh, nh, c21, terms{ { { T(1), c21 }, { alpha, p1 } } });
+
+        // Peel the odd trailing row, column and rank-1 update.
+        if (k > 2 * kh)
+            ops_.gemm(2 * mh, 2 * nh, k - 2 * kh, alpha, a.block(0, 2 * kh), b.block(2 * kh, 0),
+                      T(1), c);
+        if (m > 2 * mh)
+            ops_.gemm(m - 2 * mh, n, k, alpha, a.block(2 * mh, 0), b, beta, c.block(2 * mh, 0));
+        if (n > 2 * nh)
+            ops_.gemm(2 * mh, n - 2 * nh, k, alpha, a, b.block(0, 2 * nh), beta,
+                      c.block(0, 2 * nh));
+    }
+
+private:
+    // Dense rows x cols temporary stored in the layout of C.
+    view temporary(T *ptr, std::int64_t rows, std::int64_t cols) const {
+        return make_view(ptr, col_major_, transpose::nontrans, col_major_ ? rows : cols);
+    }
+
+    Ops &ops_;
+    bool col_major_;
+};
+
+// dst = sum of coef * x over the terms with a non-null x, one work-item per element.
+template <typename T>
+struct combine_kernel {
+    matrix_view<T> dst;
+    std::array<term<T>, 3> terms;
+
+    void operator()(sycl::id<2> id) const {
+        const std::int64_t i = id[0], j = id[1];
+        T sum = T(0);
+        for (const auto &t : terms) {
+            if (t.x.ptr)
+                sum += t.coef * t.x.ptr[i * t.x.rs + j * t.x.cs];
+        }
+        dst.ptr[i * dst.rs + j * dst.cs] = sum;
+    }
+};
+
+// Ops policy for USM memory. Block products are computed by the backend USM gemm
+// and every operation depends on the previous one.
+template <typename T, typename Gemm>
+class usm_ops {
+public:
+    usm_ops(sycl::queue &queue, Gemm gemm, const std::vector<sycl::event> &dependencies)
+            : queue_(queue),
+              gemm_(gemm),
+              dependencies_(dependencies) {}
+
+    void gemm(std::int64_t m, std::int64_t n, std::int64_t k, T alpha, matrix_view<const T> a,
+              matrix_view<const T> b, T beta, matrix_view<T> c) {
+        set_last(gemm_(queue_, a.trans, b.trans, m, n, k, alpha, a.ptr, a.ld, b.ptr, b.ld, beta,
+                       c.ptr, c.ld, dependencies_));
+    }
+
+    void combine(std::int64_t m, std::int64_t n, matrix_view<T> dst,
+                 const std::array<term<T>, 3> &terms) {
+        set_last(queue_.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies_);
+            cgh.parallel_for(sycl::range<2>(m, n), combine_kernel<T>{ dst, terms });
+        }));
+    }
+
+    // Events the next operation would depend on.
+    const std::vector<sycl::event> &dependencies() const {
+        return dependencies_;
+    }
+
+private:
+    void set_last(sycl::event e) {
+        dependencies_.assign(1, e);
+    }
+
+    sycl::queue &queue_;
+    Gemm gemm_;
+    std::vector<sycl::event> dependencies_;
+};
+
+/**
+ * Device workspaces kept between gemm_strassen calls, at most one per context
+ * and device. A call takes the cached block when it is large enough and
+ * allocates a new one otherwise. The block is handed back by the host task
+ * that runs after the last operation of the call, and the larger of the
+ * returned and the cached block is kept, so repeated calls of the same size
+ * allocate once. Concurrent calls on the same device each get their own
+ * block. Cached blocks are only freed when a larger one replaces them; the
+ * cache is never destroyed, so nothing is freed during static destruction.
+ */
+class workspace_cache {
+public:
+    static workspace_cache &instance() {
+        static workspace_cache *cache = new workspace_cache();
+        return *cache;
+    }
+
+    void *acquire(sycl::queue &queue, std::size_t bytes) {
+        const auto context = queue.get_context();
+        const auto device = queue.get_device();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto &entry : entries_) {
+                if (entry.ptr && entry.bytes >= bytes && entry.context == context &&
+                    entry.device == device) {
+                    void *ptr = entry.ptr;
+                    entry.ptr = nullptr;
+                    return ptr;
+                }
+            }
+        }
+        void *ptr = sycl::malloc_device(bytes, queue);
+        if (!ptr)
+            throw device_bad_alloc("blas", "gemm_strassen", device);
+        return ptr;
+    }
+
+    void release(const sycl::context &context, const sycl::device &device, void *ptr,
+                 std::size_t bytes) {
+        void *unused = ptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto entry = std::find_if(entries_.begin(), entries_.end(), [&](const auto &e) {
+                return e.context == context && e.device == device;
+            });
+            if (entry == entries_.end()) {
+                entries_.push_back({ context, device, ptr, bytes });
+                unused = nullptr;
+            }
+            else if (!entry->ptr || entry->bytes < bytes) {
+                unused = entry->ptr;
+                entry->ptr = ptr;
+                entry->bytes = bytes;
+            }
+        }
+        if (unused)
+            sycl::free(unused, context);
+    }
+
+private:
+    struct entry_t {
+        sycl::context context;
+        sycl::device device;
+        void *ptr;
+        std::size_t bytes;
+    };
+
+    workspace_cache() = default;
+
+    std::mutex mutex_;
+    std::vector<entry_t> entries_;
+};
+
+/**
+ * USM gemm_strassen driver for device backends. gemm is a callable with the
+ * signature of the backend USM gemm (without the namespace), used for the
+ * block products. The workspace comes from workspace_cache and is returned to
+ * it once the last operation completes.
+ */
+template <typename T, typename Gemm>
+sycl::event gemm_strassen(sycl::queue &queue, bool col_major, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          T alpha, const T *a, std::int64_t lda, const T *b, std::int64_t ldb,
+                          T beta, T *c, std::int64_t ldc, std::int64_t levels,
+                          const std::vector<sycl::event> &dependencies, Gemm gemm) {
+    if (levels < 0)
+        throw invalid_argument("blas", "gemm_strassen", "levels must be non-negative");
+    levels = std::min(levels, max_levels);
+
+    using ops_t = usm_ops<T, Gemm>;
+    const std::size_t bytes =
+        sizeof(T) * strassen_gemm<T, ops_t>::workspace_size(levels, m, n, k);
+    auto &cache = workspace_cache::instance();
+    T *workspace = bytes > 0 ? static_cast<T *>(cache.acquire(queue, bytes)) : nullptr;
+
+    auto context = queue.get_context();
+    auto device = queue.get_device();
+    ops_t ops(queue, gemm, dependencies);
+    try {
+        strassen_gemm<T, ops_t>(ops, col_major)
+            .run(levels, m, n, k, alpha, make_view(a, col_major, transa, lda),
+                 make_view(b, col_major, transb, ldb), beta,
+                 make_view(c, col_major, transpose::nontrans, ldc), workspace);
+    }
+    catch (...) {
+        if (workspace) {
+            sycl::event::wait(ops.dependencies());
+            cache.release(context, device, workspace, bytes);
+        }
+        throw;
+    }
+    if (!workspace)
+        return ops.dependencies().front();
+
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(ops.dependencies());
+        cgh.host_task([=, &cache]() { cache.release(context, device, workspace, bytes); });
+    });
+}
+
+} // namespace strassen
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_GEMM_STRASSEN_HPP_
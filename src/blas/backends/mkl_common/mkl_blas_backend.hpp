@@ -67,6 +67,34 @@ public:
 
 namespace blas {
 
+#if INTEL_MKL_VERSION >= 20230100
+#define ONEMKL_MKL_HAS_COMPUTE_MODE
+
+// Declaration of the compute mode taken by the gemm overloads of Intel oneMKL.
+// Modes are bit flags and may be combined.
+enum class compute_mode : std::uint64_t {
+    unset = 0x0,
+    float_to_bf16 = 0x1,
+    float_to_bf16x2 = 0x2,
+    float_to_bf16x3 = 0x4,
+    float_to_tf32 = 0x8,
+    complex_3m = 0x10,
+    any = 0x1f,
+};
+
+inline compute_mode get_mkl_compute_mode(oneapi::mkl::compute_mode mode) {
+    switch (mode) {
+        case oneapi::mkl::compute_mode::float_to_bf16: return compute_mode::float_to_bf16;
+        case oneapi::mkl::compute_mode::float_to_bf16x2: return compute_mode::float_to_bf16x2;
+        case oneapi::mkl::compute_mode::float_to_bf16x3: return compute_mode::float_to_bf16x3;
+        case oneapi::mkl::compute_mode::float_to_tf32: return compute_mode::float_to_tf32;
+        case oneapi::mkl::compute_mode::complex_3m: return compute_mode::complex_3m;
+        case oneapi::mkl::compute_mode::any: return compute_mode::any;
+        default: return compute_mode::unset;
+    }
+}
+#endif
+
 namespace column_major {
 
 #include "mkl_blas_backend.hxx"
@@ -69,6 +69,30 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m
           sycl::buffer<std::int8_t, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
           std::int64_t ldc);
 
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+          sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+          std::int64_t ldc, blas::compute_mode mode);
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
+          sycl::buffer<double, 1> &b, std::int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+          std::int64_t ldc, blas::compute_mode mode);
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+          std::int64_t lda, sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+          std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+          blas::compute_mode mode);
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+          std::int64_t lda, sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+          std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+          blas::compute_mode mode);
+#endif
+
 void symm(sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
           std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc);
@@ -245,6 +269,34 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::in
                  value_or_pointer<float> beta, float *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies = {});
 
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, value_or_pointer<float> alpha, const float *a,
+                 std::int64_t lda, const float *b, std::int64_t ldb, value_or_pointer<float> beta,
+                 float *c, std::int64_t ldc, blas::compute_mode mode,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, value_or_pointer<double> alpha, const double *a,
+                 std::int64_t lda, const double *b, std::int64_t ldb,
+                 value_or_pointer<double> beta, double *c, std::int64_t ldc,
+                 blas::compute_mode mode, const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, value_or_pointer<std::complex<float>> alpha,
+                 const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                 std::int64_t ldb, value_or_pointer<std::complex<float>> beta,
+                 std::complex<float> *c, std::int64_t ldc, blas::compute_mode mode,
+                 const std::vector<sycl::event> &dependencies = {});
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, value_or_pointer<std::complex<double>> alpha,
+                 const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                 std::int64_t ldb, value_or_pointer<std::complex<double>> beta,
+                 std::complex<double> *c, std::int64_t ldc, blas::compute_mode mode,
+                 const std::vector<sycl::event> &dependencies = {});
+#endif
+
 sycl::event symm(sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
                  std::int64_t n, value_or_pointer<float> alpha, const float *a, std::int64_t lda,
                  const float *b, std::int64_t ldb, value_or_pointer<float> beta, float *c,
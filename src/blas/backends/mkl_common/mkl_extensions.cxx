@@ -176,6 +176,137 @@ void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
     blas_major::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, int64_t levels) {
+    throw unimplemented("blas", "gemm_strassen", "for buffer API");
+}
+
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, int64_t levels) {
+    throw unimplemented("blas", "gemm_strassen", "for buffer API");
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm3m", "");
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm3m", "");
+}
+
+template <>
+int64_t gemm_pack_get_size<float>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                  int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<double>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                   int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<std::complex<float>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                int64_t n, int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<std::complex<double>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                 int64_t n, int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+               sycl::buffer<float, 1> &packed) {
+    packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed, {});
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+               sycl::buffer<double, 1> &packed) {
+    packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed, {});
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+               int64_t lda, sycl::buffer<std::complex<float>, 1> &packed) {
+    packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed, {});
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+               int64_t lda, sycl::buffer<std::complex<double>, 1> &packed) {
+    packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed, {});
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<float, 1> &packed, sycl::buffer<float, 1> &b, int64_t ldb,
+                  float beta, sycl::buffer<float, 1> &c, int64_t ldc) {
+    auto gemm_fn = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb, beta, c,
+                         ldc, gemm_fn);
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<double, 1> &packed, sycl::buffer<double, 1> &b,
+                  int64_t ldb, double beta, sycl::buffer<double, 1> &c, int64_t ldc) {
+    auto gemm_fn = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb, beta, c,
+                         ldc, gemm_fn);
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<std::complex<float>, 1> &packed,
+                  sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+                  sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    auto gemm_fn = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb, beta, c,
+                         ldc, gemm_fn);
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<std::complex<double>, 1> &packed,
+                  sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+                  sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    auto gemm_fn = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb, beta, c,
+                         ldc, gemm_fn);
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, sycl::buffer<double, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
 // USM APIs
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -357,3 +488,171 @@ sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int6
     return blas_major::omatadd(queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
                                dependencies);
 }
+
+sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                          int64_t levels, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return blas_major::gemm(args...); };
+    return strassen::gemm_strassen(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda,
+                                   b, ldb, beta, c, ldc, levels, dependencies, gemm_usm);
+}
+
+sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                          const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                          int64_t levels, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return blas_major::gemm(args...); };
+    return strassen::gemm_strassen(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda,
+                                   b, ldb, beta, c, ldc, levels, dependencies, gemm_usm);
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                   const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm3m", "");
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                   int64_t lda, const std::complex<double> *b, int64_t ldb,
+                   std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm3m", "");
+}
+
+sycl::event gemm_out_of_core(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                             const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                             int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, is_column_major(), transa, transb, m, n, k, alpha,
+                                         a, lda, b, ldb, beta, c, ldc, max_memory, dependencies,
+                                         gemm_usm);
+}
+
+sycl::event gemm_out_of_core(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                             const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                             int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, is_column_major(), transa, transb, m, n, k, alpha,
+                                         a, lda, b, ldb, beta, c, ldc, max_memory, dependencies,
+                                         gemm_usm);
+}
+
+sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+    const std::complex<float> *b, int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+    int64_t ldc, int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, is_column_major(), transa, transb, m, n, k, alpha,
+                                         a, lda, b, ldb, beta, c, ldc, max_memory, dependencies,
+                                         gemm_usm);
+}
+
+sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+    const std::complex<double> *b, int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+    int64_t ldc, int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, is_column_major(), transa, transb, m, n, k, alpha,
+                                         a, lda, b, ldb, beta, c, ldc, max_memory, dependencies,
+                                         gemm_usm);
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, float alpha, const float *a, int64_t lda, float *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed,
+                             dependencies);
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, double alpha, const double *a, int64_t lda, double *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed,
+                             dependencies);
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                      int64_t lda, std::complex<float> *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed,
+                             dependencies);
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                      int64_t lda, std::complex<double> *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed,
+                             dependencies);
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const float *packed, const float *b, int64_t ldb,
+                         float beta, float *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto gemm_fn = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    return packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb,
+                                beta, c, ldc, gemm_fn, dependencies);
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const double *packed, const double *b, int64_t ldb,
+                         double beta, double *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto gemm_fn = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    return packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb,
+                                beta, c, ldc, gemm_fn, dependencies);
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const std::complex<float> *packed,
+                         const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                         std::complex<float> *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto gemm_fn = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    return packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb,
+                                beta, c, ldc, gemm_fn, dependencies);
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const std::complex<double> *packed,
+                         const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                         std::complex<double> *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto gemm_fn = [](auto &&...args) { return ::oneapi::mkl::blas::column_major::gemm(args...); };
+    return packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb,
+                                beta, c, ldc, gemm_fn, dependencies);
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                          const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                          const double *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, bfloat16 *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "");
+}
@@ -322,6 +322,52 @@ void iamin(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>
     blas_major::iamin(queue, n, x, incx, result);
 }
 
+void axpy_dot(sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x,
+              std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+              sycl::buffer<float, 1> &z, std::int64_t incz, sycl::buffer<float, 1> &result) {
+    blas_major::axpy(queue, n, alpha, x, incx, y, incy);
+    blas_major::dot(queue, n, y, incy, z, incz, result);
+}
+
+void axpy_dot(sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x,
+              std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+              sycl::buffer<double, 1> &z, std::int64_t incz, sycl::buffer<double, 1> &result) {
+    blas_major::axpy(queue, n, alpha, x, incx, y, incy);
+    blas_major::dot(queue, n, y, incy, z, incz, result);
+}
+
+void axpby_nrm2(sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x,
+                std::int64_t incx, float beta, sycl::buffer<float, 1> &y, std::int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    blas_major::nrm2(queue, n, y, incy, result);
+}
+
+void axpby_nrm2(sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                std::int64_t incx, double beta, sycl::buffer<double, 1> &y, std::int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy);
+    blas_major::nrm2(queue, n, y, incy, result);
+}
+
+void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+          sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &z,
+          std::int64_t incz, sycl::buffer<float, 1> &result) {
+    sycl::buffer<float, 1> result_y(result, sycl::id<1>(0), sycl::range<1>(1));
+    sycl::buffer<float, 1> result_z(result, sycl::id<1>(1), sycl::range<1>(1));
+    blas_major::dot(queue, n, x, incx, y, incy, result_y);
+    blas_major::dot(queue, n, x, incx, z, incz, result_z);
+}
+
+void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+          sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &z,
+          std::int64_t incz, sycl::buffer<double, 1> &result) {
+    sycl::buffer<double, 1> result_y(result, sycl::id<1>(0), sycl::range<1>(1));
+    sycl::buffer<double, 1> result_z(result, sycl::id<1>(1), sycl::range<1>(1));
+    blas_major::dot(queue, n, x, incx, y, incy, result_y);
+    blas_major::dot(queue, n, x, incx, z, incz, result_z);
+}
+
 // USM APIs
 
 sycl::event asum(sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
@@ -643,3 +689,49 @@ sycl::event iamin(sycl::queue &queue, std::int64_t n, const std::complex<double>
                   const std::vector<sycl::event> &dependencies) {
     return blas_major::iamin(queue, n, x, incx, result, dependencies);
 }
+
+sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, float alpha, const float *x,
+                     std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                     std::int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto axpy_done = blas_major::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
+    return blas_major::dot(queue, n, y, incy, z, incz, result, { axpy_done });
+}
+
+sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, double alpha, const double *x,
+                     std::int64_t incx, double *y, std::int64_t incy, const double *z,
+                     std::int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto axpy_done = blas_major::axpy(queue, n, alpha, x, incx, y, incy, dependencies);
+    return blas_major::dot(queue, n, y, incy, z, incz, result, { axpy_done });
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, float alpha, const float *x,
+                       std::int64_t incx, float beta, float *y, std::int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto axpby_done =
+        blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return blas_major::nrm2(queue, n, y, incy, result, { axpby_done });
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, double alpha, const double *x,
+                       std::int64_t incx, double beta, double *y, std::int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto axpby_done =
+        blas_major::axpby(queue, n, alpha, x, incx, beta, y, incy, dependencies);
+    return blas_major::nrm2(queue, n, y, incy, result, { axpby_done });
+}
+
+sycl::event dot2(sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
+                 const float *y, std::int64_t incy, const float *z, std::int64_t incz,
+                 float *result, const std::vector<sycl::event> &dependencies) {
+    auto dot_y_done = blas_major::dot(queue, n, x, incx, y, incy, result, dependencies);
+    return blas_major::dot(queue, n, x, incx, z, incz, result + 1, { dot_y_done });
+}
+
+sycl::event dot2(sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+                 const double *y, std::int64_t incy, const double *z, std::int64_t incz,
+                 double *result, const std::vector<sycl::event> &dependencies) {
+    auto dot_y_done = blas_major::dot(queue, n, x, incx, y, incy, result, dependencies);
+    return blas_major::dot(queue, n, x, incx, z, incz, result + 1, { dot_y_done });
+}
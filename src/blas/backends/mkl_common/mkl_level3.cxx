@@ -68,6 +68,56 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m
     blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+          sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+          std::int64_t ldc, ::oneapi::mkl::compute_mode mode) {
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                     get_mkl_compute_mode(mode));
+#else
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+#endif
+}
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
+          sycl::buffer<double, 1> &b, std::int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+          std::int64_t ldc, ::oneapi::mkl::compute_mode mode) {
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                     get_mkl_compute_mode(mode));
+#else
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+#endif
+}
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+          std::int64_t lda, sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+          std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+          ::oneapi::mkl::compute_mode mode) {
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                     get_mkl_compute_mode(mode));
+#else
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+#endif
+}
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+          std::int64_t lda, sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+          std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+          ::oneapi::mkl::compute_mode mode) {
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                     get_mkl_compute_mode(mode));
+#else
+    blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+#endif
+}
+
 void symm(sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
           std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc) {
@@ -304,6 +354,62 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::in
                             dependencies);
 }
 
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+                 const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                 ::oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies) {
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            get_mkl_compute_mode(mode), dependencies);
+#else
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+#endif
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+                 const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                 ::oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies) {
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            get_mkl_compute_mode(mode), dependencies);
+#else
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+#endif
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                 const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                 std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                 std::int64_t ldc, ::oneapi::mkl::compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            get_mkl_compute_mode(mode), dependencies);
+#else
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+#endif
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                 const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                 std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                 std::int64_t ldc, ::oneapi::mkl::compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+#ifdef ONEMKL_MKL_HAS_COMPUTE_MODE
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            get_mkl_compute_mode(mode), dependencies);
+#else
+    return blas_major::gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+#endif
+}
+
 sycl::event symm(sycl::queue &queue, side left_right, uplo upper_lower, std::int64_t m,
                  std::int64_t n, float alpha, const float *a, std::int64_t lda, const float *b,
                  std::int64_t ldb, float beta, float *c, std::int64_t ldc,
@@ -27,6 +27,9 @@
 
 #include "oneapi/mkl/exceptions.hpp"
 #include "../mkl_common/mkl_blas_backend.hpp"
+#include "../gemm_out_of_core.hpp"
+#include "../gemm_pack.hpp"
+#include "../gemm_strassen.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -35,12 +38,18 @@ namespace mklgpu {
 namespace column_major {
 
 namespace blas_major = ::oneapi::mkl::blas::column_major;
+constexpr bool is_column_major() {
+    return true;
+}
 #include "../mkl_common/mkl_extensions.cxx"
 
 } // namespace column_major
 namespace row_major {
 
 namespace blas_major = ::oneapi::mkl::blas::row_major;
+constexpr bool is_column_major() {
+    return false;
+}
 #include "../mkl_common/mkl_extensions.cxx"
 
 } // namespace row_major
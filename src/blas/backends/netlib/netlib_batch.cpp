@@ -24,6 +24,8 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_gemm.hpp"
+#include "netlib_reduction_batch.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 
@@ -33,15 +35,19 @@ namespace blas {
 namespace netlib {
 namespace column_major {
 
+#define MAJOR CblasColMajor
 #define COLUMN_MAJOR
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
+#define MAJOR CblasRowMajor
 #define ROW_MAJOR
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
@@ -217,12 +217,16 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t stride_a, sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
                 float beta, sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_sgemm_batch>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                            stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                            accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -230,12 +234,16 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t stride_a, sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
                 double beta, sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_dgemm_batch>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                            stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                            accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -244,12 +252,16 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t ldb, int64_t stride_b, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_cgemm_batch>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                            stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                            accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -258,12 +270,16 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t ldb, int64_t stride_b, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_zgemm_batch>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                            stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                            accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -521,6 +537,182 @@ void omatadd_batch(sycl::queue &queue, transpose transa, transpose transb, int64
 #endif
 }
 
+void dot_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+               int64_t stridex, sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey,
+               sycl::buffer<float, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_sdot_batch>(cgh, [=]() {
+            host_dot_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex, accessor_y.GET_MULTI_PTR,
+                           incy, stridey, accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void dot_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+               int64_t stridex, sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
+               sycl::buffer<double, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_ddot_batch>(cgh, [=]() {
+            host_dot_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex, accessor_y.GET_MULTI_PTR,
+                           incy, stridey, accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_snrm2_batch>(cgh, [=]() {
+            host_nrm2_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                            accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_dnrm2_batch>(cgh, [=]() {
+            host_nrm2_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                            accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_scnrm2_batch>(cgh, [=]() {
+            host_nrm2_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                            accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void nrm2_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<double, 1> &result,
+                int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_dznrm2_batch>(cgh, [=]() {
+            host_nrm2_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                            accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_sasum_batch>(cgh, [=]() {
+            host_asum_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                            accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                int64_t stridex, sycl::buffer<double, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_dasum_batch>(cgh, [=]() {
+            host_asum_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                            accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<float, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_scasum_batch>(cgh, [=]() {
+            host_asum_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                            accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void asum_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                int64_t incx, int64_t stridex, sycl::buffer<double, 1> &result,
+                int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_dzasum_batch>(cgh, [=]() {
+            host_asum_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                            accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+                 int64_t stridex, sycl::buffer<int64_t, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_isamax_batch>(cgh, [=]() {
+            host_iamax_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                             accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+                 int64_t stridex, sycl::buffer<int64_t, 1> &result, int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_idamax_batch>(cgh, [=]() {
+            host_iamax_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                             accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                 int64_t incx, int64_t stridex, sycl::buffer<int64_t, 1> &result,
+                 int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_icamax_batch>(cgh, [=]() {
+            host_iamax_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                             accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
+void iamax_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                 int64_t incx, int64_t stridex, sycl::buffer<int64_t, 1> &result,
+                 int64_t batch_size) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_izamax_batch>(cgh, [=]() {
+            host_iamax_batch(n, accessor_x.GET_MULTI_PTR, incx, stridex,
+                             accessor_result.GET_MULTI_PTR, batch_size);
+        });
+    });
+}
+
 // USM APIs
 
 sycl::event copy_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
@@ -921,12 +1113,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const float **b, int64_t *ldb, float *beta, float **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_group_usm>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -934,12 +1131,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const double **b, int64_t *ldb, double *beta, double **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_group_usm>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -948,12 +1150,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const std::complex<float> **b, int64_t *ldb, std::complex<float> *beta,
                            std::complex<float> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_group_usm>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -962,12 +1169,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const std::complex<double> **b, int64_t *ldb, std::complex<double> *beta,
                            std::complex<double> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_group_usm>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -988,12 +1200,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            int64_t stride_a, const float *b, int64_t ldb, int64_t stride_b,
                            float beta, float *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_strided_usm>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1001,12 +1218,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
                            double beta, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_strided_usm>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1016,12 +1238,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_strided_usm>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1031,12 +1258,17 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_strided_usm>(cgh, [=]() {
+            host_gemm_batch(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                            stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1501,3 +1733,423 @@ sycl::event imatcopy_batch(sycl::queue& queue, transpose* trans, int64_t* m, int
     throw unimplemented("blas", "imatcopy_batch", "for row_major layout");
 #endif
 }
+
+sycl::event dot_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                      const float *y, int64_t incy, int64_t stridey, float *result,
+                      int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdot_batch_strided_usm>(cgh, [=]() {
+            host_dot_batch(n, x, incx, stridex, y, incy, stridey, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                      const double *y, int64_t incy, int64_t stridey, double *result,
+                      int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddot_batch_strided_usm>(cgh, [=]() {
+            host_dot_batch(n, x, incx, stridex, y, incy, stridey, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                      const float **y, int64_t *incy, float *result, int64_t group_count,
+                      int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdot_batch_group_usm>(cgh, [=]() {
+            host_dot_batch(n, x, incx, y, incy, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event dot_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                      const double **y, int64_t *incy, double *result, int64_t group_count,
+                      int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddot_batch_group_usm>(cgh, [=]() {
+            host_dot_batch(n, x, incx, y, incy, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                       float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_snrm2_batch_strided_usm>(cgh, [=]() {
+            host_nrm2_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dnrm2_batch_strided_usm>(cgh, [=]() {
+            host_nrm2_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                       int64_t stridex, float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scnrm2_batch_strided_usm>(cgh, [=]() {
+            host_nrm2_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dznrm2_batch_strided_usm>(cgh, [=]() {
+            host_nrm2_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_snrm2_batch_group_usm>(cgh, [=]() {
+            host_nrm2_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                       double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dnrm2_batch_group_usm>(cgh, [=]() {
+            host_nrm2_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scnrm2_batch_group_usm>(cgh, [=]() {
+            host_nrm2_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                       int64_t *incx, double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dznrm2_batch_group_usm>(cgh, [=]() {
+            host_nrm2_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                       float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sasum_batch_strided_usm>(cgh, [=]() {
+            host_asum_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dasum_batch_strided_usm>(cgh, [=]() {
+            host_asum_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                       int64_t stridex, float *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scasum_batch_strided_usm>(cgh, [=]() {
+            host_asum_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                       int64_t stridex, double *result, int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dzasum_batch_strided_usm>(cgh, [=]() {
+            host_asum_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sasum_batch_group_usm>(cgh, [=]() {
+            host_asum_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                       double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dasum_batch_group_usm>(cgh, [=]() {
+            host_asum_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x, int64_t *incx,
+                       float *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scasum_batch_group_usm>(cgh, [=]() {
+            host_asum_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event asum_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                       int64_t *incx, double *result, int64_t group_count, int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dzasum_batch_group_usm>(cgh, [=]() {
+            host_asum_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_isamax_batch_strided_usm>(cgh, [=]() {
+            host_iamax_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_idamax_batch_strided_usm>(cgh, [=]() {
+            host_iamax_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_icamax_batch_strided_usm>(cgh, [=]() {
+            host_iamax_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
+                        int64_t stridex, int64_t *result, int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_izamax_batch_strided_usm>(cgh, [=]() {
+            host_iamax_batch(n, x, incx, stridex, result, batch_size);
+        });
+    });
+    return done;
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
+                        int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_isamax_batch_group_usm>(cgh, [=]() {
+            host_iamax_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
+                        int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_idamax_batch_group_usm>(cgh, [=]() {
+            host_iamax_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x,
+                        int64_t *incx, int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_icamax_batch_group_usm>(cgh, [=]() {
+            host_iamax_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
+
+sycl::event iamax_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
+                        int64_t *incx, int64_t *result, int64_t group_count, int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_izamax_batch_group_usm>(cgh, [=]() {
+            host_iamax_batch(n, x, incx, result, group_count, group_size);
+        });
+    });
+    return done;
+}
@@ -0,0 +1,412 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_BF16_GEMM_HPP_
+#define _NETLIB_BF16_GEMM_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "oneapi/mkl/types.hpp"
+
+#include "netlib_common.hpp"
+#include "netlib_gemm_engine.hpp"
+
+#if defined(NETLIB_GEMM_ENGINE_X86) && \
+    ((defined(__clang__) && __clang_major__ >= 12) || (!defined(__clang__) && __GNUC__ >= 11))
+#define NETLIB_BF16_GEMM_X86
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * sgemm on bfloat16 operands for compute_mode::float_to_bf16: every element of
+ * op(A) and op(B) is rounded to bfloat16, the products are exact and
+ * accumulated in single precision by the blocked loops of the gemm engine with
+ * an AMX (tdpbf16ps) or AVX512-BF16 (vdpbf16ps) micro-kernel.
+ *
+ * The modes that split the elements into two or three bfloat16 pieces
+ * (float_to_bf16x2, float_to_bf16x3, float_to_tf32) take three or six such
+ * products per multiply-add, which is slower than the fp32 kernels of the
+ * engine, and are computed as ordinary sgemm, as accurate as they promise.
+ * So are products of less than gemm_engine_min_work multiply-adds and
+ * processors without AMX or AVX512-BF16.
+ */
+namespace bf16_gemm {
+
+// Round to nearest even; NaNs stay NaNs. Finite values that would round to
+// infinity are truncated instead.
+inline uint16_t to_bf16(float x) {
+    uint32_t u;
+    std::memcpy(&u, &x, sizeof(u));
+    if ((u & 0x7f800000u) == 0x7f800000u)
+        return uint16_t((u >> 16) | ((u & 0x7fffffu) ? 0x40 : 0));
+    const uint32_t r = u + 0x7fffu + ((u >> 16) & 1u);
+    return uint16_t((((r & 0x7f800000u) == 0x7f800000u) ? u : r) >> 16);
+}
+
+#ifdef NETLIB_BF16_GEMM_X86
+
+#define NETLIB_TARGET_AVX512_BF16 __attribute__((target("avx512bf16,avx512f,avx2,fma")))
+#define NETLIB_TARGET_AMX_BF16    __attribute__((target("amx-tile,amx-bf16,avx512f,avx2,fma")))
+#define NETLIB_TARGET_AVX512BW    __attribute__((target("avx512bw,avx512f,avx2,fma")))
+
+/**
+ * AVX512-BF16 kernel. The packed panels hold pairs of consecutive steps of
+ * the expanded depth: A is stored 32 pairs per step, so that a vector holds
+ * 16 rows, and B NR pairs per step, each broadcast as one 32-bit word.
+ */
+struct avx512_layout {
+    static constexpr int64_t mr = 32, nr = 12, kr = 2;
+    static int64_t a_index(int64_t q, int64_t i) {
+        return (q / 2) * 2 * mr + 2 * i + q % 2;
+    }
+    static int64_t b_index(int64_t q, int64_t j) {
+        return (q / 2) * 2 * nr + 2 * j + q % 2;
+    }
+};
+
+template <int NR>
+NETLIB_TARGET_AVX512_BF16 void avx512_bf16_kernel(int64_t kc, const uint16_t *a,
+                                                  const uint16_t *b, float alpha, float beta,
+                                                  float *c, int64_t ldc) {
+    __m512 acc0[NR], acc1[NR];
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; ++j)
+        acc0[j] = acc1[j] = _mm512_setzero_ps();
+    for (int64_t p = 0; p < kc; p += 2, a += 64, b += 2 * NR) {
+        const __m512bh a0 = (__m512bh)_mm512_loadu_si512(a);
+        const __m512bh a1 = (__m512bh)_mm512_loadu_si512(a + 32);
+#pragma GCC unroll 16
+        for (int j = 0; j < NR; ++j) {
+            int32_t pair;
+            std::memcpy(&pair, b + 2 * j, sizeof(pair));
+            const __m512bh bj = (__m512bh)_mm512_set1_epi32(pair);
+            acc0[j] = _mm512_dpbf16_ps(acc0[j], a0, bj);
+            acc1[j] = _mm512_dpbf16_ps(acc1[j], a1, bj);
+        }
+    }
+    const __m512 va = _mm512_set1_ps(alpha), vb = _mm512_set1_ps(beta);
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; ++j) {
+        float *cj = c + j * ldc;
+        if (beta == 0.0f) {
+            _mm512_storeu_ps(cj, _mm512_mul_ps(va, acc0[j]));
+            _mm512_storeu_ps(cj + 16, _mm512_mul_ps(va, acc1[j]));
+        }
+        else {
+            const __m512 c0 = _mm512_mul_ps(vb, _mm512_loadu_ps(cj));
+            const __m512 c1 = _mm512_mul_ps(vb, _mm512_loadu_ps(cj + 16));
+            _mm512_storeu_ps(cj, _mm512_fmadd_ps(va, acc0[j], c0));
+            _mm512_storeu_ps(cj + 16, _mm512_fmadd_ps(va, acc1[j], c1));
+        }
+    }
+}
+
+/**
+ * AMX kernel for a 32 x 32 tile of C, computed as C^T = B^T * A^T in four
+ * 16 x 16 tiles so that the rows of the tiles are columns of C. Every step of
+ * 32 along the expanded depth holds two 16 x 32 tiles of B^T, one row per
+ * column of C, and two tiles of A^T in the pair-interleaved layout of the
+ * second tdpbf16ps operand, one row per pair of steps.
+ */
+struct amx_layout {
+    static constexpr int64_t mr = 32, nr = 32, kr = 32;
+    static int64_t a_index(int64_t q, int64_t i) {
+        return (q / 32) * 1024 + (i / 16) * 512 + (q % 32 / 2) * 32 + (i % 16) * 2 + q % 2;
+    }
+    static int64_t b_index(int64_t q, int64_t j) {
+        return (q / 32) * 1024 + (j / 16) * 512 + (j % 16) * 32 + q % 32;
+    }
+};
+
+struct tile_config {
+    uint8_t palette;
+    uint8_t start_row;
+    uint8_t reserved[14];
+    uint16_t colsb[16];
+    uint8_t rows[16];
+};
+
+NETLIB_TARGET_AMX_BF16 inline void amx_bf16_kernel(int64_t kc, const uint16_t *a, const uint16_t *b,
+                                                   float alpha, float beta, float *c, int64_t ldc) {
+    tile_config config{};
+    config.palette = 1;
+    for (int t = 0; t < 8; ++t) {
+        config.rows[t] = 16;
+        config.colsb[t] = 64;
+    }
+    _tile_loadconfig(&config);
+    _tile_zero(0);
+    _tile_zero(1);
+    _tile_zero(2);
+    _tile_zero(3);
+    for (int64_t p = 0; p < kc; p += 32, a += 1024, b += 1024) {
+        _tile_loadd(4, b, 64);
+        _tile_loadd(5, b + 512, 64);
+        _tile_loadd(6, a, 64);
+        _tile_loadd(7, a + 512, 64);
+        _tile_dpbf16ps(0, 4, 6);
+        _tile_dpbf16ps(1, 4, 7);
+        _tile_dpbf16ps(2, 5, 6);
+        _tile_dpbf16ps(3, 5, 7);
+    }
+    alignas(64) float acc[32][32];
+    _tile_stored(0, &acc[0][0], 128);
+    _tile_stored(1, &acc[0][16], 128);
+    _tile_stored(2, &acc[16][0], 128);
+    _tile_stored(3, &acc[16][16], 128);
+    _tile_release();
+    const __m512 va = _mm512_set1_ps(alpha), vb = _mm512_set1_ps(beta);
+    for (int j = 0; j < 32; ++j) {
+        float *cj = c + j * ldc;
+        const __m512 c0 = _mm512_mul_ps(va, _mm512_load_ps(acc[j]));
+        const __m512 c1 = _mm512_mul_ps(va, _mm512_load_ps(acc[j] + 16));
+        if (beta == 0.0f) {
+            _mm512_storeu_ps(cj, c0);
+            _mm512_storeu_ps(cj + 16, c1);
+        }
+        else {
+            _mm512_storeu_ps(cj, _mm512_fmadd_ps(vb, _mm512_loadu_ps(cj), c0));
+            _mm512_storeu_ps(cj + 16, _mm512_fmadd_ps(vb, _mm512_loadu_ps(cj + 16), c1));
+        }
+    }
+}
+
+// to_bf16 of 16 floats.
+NETLIB_TARGET_AVX512BW inline __m256i to_bf16(const float *x) {
+    const __m512i u = _mm512_loadu_si512(x), exponent = _mm512_set1_epi32(0x7f800000);
+    const __mmask16 special =
+        _mm512_cmpeq_epi32_mask(_mm512_and_si512(u, exponent), exponent);
+    const __m512i odd = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(1));
+    __m512i r = _mm512_add_epi32(u, _mm512_add_epi32(odd, _mm512_set1_epi32(0x7fff)));
+    const __mmask16 overflow = _mm512_cmpeq_epi32_mask(_mm512_and_si512(r, exponent), exponent);
+    r = _mm512_mask_mov_epi32(r, special | overflow, u);
+    const __mmask16 nan = _mm512_mask_test_epi32_mask(special, u, _mm512_set1_epi32(0x7fffff));
+    r = _mm512_mask_or_epi32(r, nan, r, _mm512_set1_epi32(0x400000));
+    return _mm512_cvtepi32_epi16(_mm512_srli_epi32(r, 16));
+}
+
+// pack_a for amx_layout, 16 rows of a column at a time.
+NETLIB_TARGET_AVX512BW inline void amx_pack_a(const gemm_engine::operand<float> &a, int64_t k,
+                                              int64_t i0, int64_t mb, int64_t p0, int64_t kb,
+                                              uint16_t *dst) {
+    // Columns of 16 rows, then every pair of columns interleaved row by row.
+    std::vector<uint16_t> columns(kb * 16);
+    alignas(64) uint16_t interleave[32];
+    for (int i = 0; i < 16; ++i) {
+        interleave[2 * i] = uint16_t(i);
+        interleave[2 * i + 1] = uint16_t(16 + i);
+    }
+    const __m512i pairs = _mm512_load_si512(interleave);
+    for (int64_t ir = 0; ir < mb; ir += amx_layout::mr, dst += amx_layout::mr * kb) {
+        for (int64_t h = 0; h < 2; ++h) {
+            const int64_t first = ir + 16 * h, rows = std::clamp<int64_t>(mb - first, 0, 16);
+            for (int64_t p = 0; p < kb; ++p) {
+                alignas(64) float x[16] = {};
+                for (int64_t i = 0; i < (p0 + p < k ? rows : 0); ++i)
+                    x[i] = a(i0 + first + i, p0 + p);
+                _mm256_storeu_si256((__m256i *)&columns[p * 16], to_bf16(x));
+            }
+            for (int64_t r = 0; r < kb / 2; ++r) {
+                const __m512i x = _mm512_loadu_si512(&columns[r * 32]);
+                _mm512_storeu_si512(dst + (r / 16) * 1024 + h * 512 + (r % 16) * 32,
+                                    _mm512_permutexvar_epi16(pairs, x));
+            }
+        }
+    }
+}
+
+// pack_b for amx_layout, 16 rows of a column at a time.
+NETLIB_TARGET_AVX512BW inline void amx_pack_b(const gemm_engine::operand<float> &b, int64_t k,
+                                              int64_t p0, int64_t kb, int64_t j0, int64_t nb,
+                                              uint16_t *dst) {
+    for (int64_t j = 0; j < amx_layout::nr; ++j) {
+        uint16_t *row = dst + (j / 16) * 512 + (j % 16) * 32;
+        for (int64_t q = 0; q < kb; q += 16) {
+            alignas(64) float x[16] = {};
+            if (j < nb) {
+                for (int64_t l = 0; l < std::min<int64_t>(16, k - p0 - q); ++l)
+                    x[l] = b(p0 + q + l, j0 + j);
+            }
+            _mm256_storeu_si256((__m256i *)(row + (q / 32) * 1024 + q % 32), to_bf16(x));
+        }
+    }
+}
+
+#undef NETLIB_TARGET_AVX512_BF16
+#undef NETLIB_TARGET_AMX_BF16
+#undef NETLIB_TARGET_AVX512BW
+
+// Linux only grants the AMX tile state to processes that request it.
+inline bool amx_enabled() {
+#ifdef __linux__
+    static const bool enabled = []() {
+        unsigned eax, ebx, ecx, edx;
+        if (__get_cpuid_max(0, nullptr) < 7)
+            return false;
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        const bool amx_bf16 = (edx >> 22) & 1, amx_tile = (edx >> 24) & 1;
+        constexpr long arch_req_xcomp_perm = 0x1023, xfeature_xtiledata = 18;
+        return amx_bf16 && amx_tile &&
+               syscall(SYS_arch_prctl, arch_req_xcomp_perm, xfeature_xtiledata) == 0;
+    }();
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+inline bool avx512_bf16_enabled() {
+    static const bool enabled = []() {
+        __builtin_cpu_init();
+        return bool(__builtin_cpu_supports("avx512bf16"));
+    }();
+    return enabled;
+}
+
+/**
+ * Packs the rows [i0, i0 + mb) of a for the columns [p0, p0 + kb) into panels
+ * of Layout::mr rows, rounded to bfloat16. Rows past mb and columns past k are
+ * zero; kb may run past k by less than Layout::kr.
+ */
+template <typename Layout>
+void pack_a(const gemm_engine::operand<float> &a, int64_t k, int64_t i0, int64_t mb, int64_t p0,
+            int64_t kb, uint16_t *dst) {
+    constexpr int64_t mr = Layout::mr;
+    const int64_t cols = std::min(kb, k - p0);
+    for (int64_t ir = 0; ir < mb; ir += mr, dst += mr * kb) {
+        const int64_t rows = std::min(mr, mb - ir);
+        std::fill(dst, dst + mr * kb, uint16_t(0));
+        for (int64_t p = 0; p < cols; ++p) {
+            for (int64_t i = 0; i < rows; ++i)
+                dst[Layout::a_index(p, i)] = to_bf16(a(i0 + ir + i, p0 + p));
+        }
+    }
+}
+
+// Packs the columns [j0, j0 + nb) of b into one panel of Layout::nr columns,
+// see pack_a.
+template <typename Layout>
+void pack_b(const gemm_engine::operand<float> &b, int64_t k, int64_t p0, int64_t kb, int64_t j0,
+            int64_t nb, uint16_t *dst) {
+    const int64_t rows = std::min(kb, k - p0);
+    std::fill(dst, dst + Layout::nr * kb, uint16_t(0));
+    for (int64_t j = 0; j < nb; ++j) {
+        for (int64_t p = 0; p < rows; ++p)
+            dst[Layout::b_index(p, j)] = to_bf16(b(p0 + p, j0 + j));
+    }
+}
+
+template <typename Layout>
+void blocked_gemm(const gemm_engine::kernel_info<float, uint16_t> &kernel, int64_t m, int64_t n,
+                  int64_t k, float alpha, const gemm_engine::operand<float> &a,
+                  const gemm_engine::operand<float> &b, float beta,
+                  const gemm_engine::output<float> &c) {
+    gemm_engine::blocked_gemm(
+        kernel, m, n, detail::round_up(k, Layout::kr), alpha, beta, c.ptr, c.cs,
+        [&](int64_t i0, int64_t mb, int64_t p0, int64_t kb, uint16_t *dst) {
+            if constexpr (std::is_same_v<Layout, amx_layout>)
+                amx_pack_a(a, k, i0, mb, p0, kb, dst);
+            else
+                pack_a<Layout>(a, k, i0, mb, p0, kb, dst);
+            return dst;
+        },
+        [&](int64_t p0, int64_t kb, int64_t j0, int64_t nb, uint16_t *dst) {
+            if constexpr (std::is_same_v<Layout, amx_layout>)
+                amx_pack_b(b, k, p0, kb, j0, nb, dst);
+            else
+                pack_b<Layout>(b, k, p0, kb, j0, nb, dst);
+            return dst;
+        },
+        true);
+}
+
+// C = alpha * a * b + beta * C on bfloat16 operands, see gemm_engine::gemm
+// for the operands.
+inline void gemm(int64_t m, int64_t n, int64_t k, float alpha, gemm_engine::operand<float> a,
+                 gemm_engine::operand<float> b, float beta, gemm_engine::output<float> c) {
+    if (alpha == 0.0f) {
+        gemm_engine::gemm(m, n, k, alpha, a, b, beta, c);
+        return;
+    }
+    if (c.rs != 1) {
+        std::swap(m, n);
+        std::swap(a, b);
+        a = a.transposed();
+        b = b.transposed();
+        std::swap(c.rs, c.cs);
+    }
+    if (amx_enabled()) {
+        blocked_gemm<amx_layout>({ amx_layout::mr, amx_layout::nr, amx_bf16_kernel,
+                                   amx_layout::kr },
+                                 m, n, k, alpha, a, b, beta, c);
+    }
+    else {
+        blocked_gemm<avx512_layout>({ avx512_layout::mr, avx512_layout::nr,
+                                      avx512_bf16_kernel<avx512_layout::nr>, avx512_layout::kr },
+                                    m, n, k, alpha, a, b, beta, c);
+    }
+}
+
+#endif // NETLIB_BF16_GEMM_X86
+
+inline bool host_supported() {
+#ifdef NETLIB_BF16_GEMM_X86
+    return amx_enabled() || avx512_bf16_enabled();
+#else
+    return false;
+#endif
+}
+
+} // namespace bf16_gemm
+
+inline bool use_bf16_gemm(compute_mode mode, int64_t m, int64_t n, int64_t k) {
+    return mode == compute_mode::float_to_bf16 && bf16_gemm::host_supported() && m > 0 &&
+           n > 0 && k > 0 && m * n * k >= gemm_engine_min_work;
+}
+
+// Requires use_bf16_gemm(compute_mode::float_to_bf16, m, n, k).
+inline void host_bf16_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                           int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                           const float *b, int64_t ldb, float beta, float *c, int64_t ldc) {
+#ifdef NETLIB_BF16_GEMM_X86
+    bf16_gemm::gemm(m, n, k, alpha, gemm_engine::general_operand(layout, transa, a, lda),
+                    gemm_engine::general_operand(layout, transb, b, ldb), beta,
+                    gemm_engine::output<float>(layout, c, ldc));
+#endif
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_BF16_GEMM_HPP_
@@ -26,6 +26,12 @@
 #include <CL/sycl.hpp>
 #endif
 #include <complex>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
 
 #include "cblas.h"
 
@@ -76,6 +82,178 @@ inline CBLAS_OFFSET convert_to_cblas_offset(offset offsetc) {
         return CBLAS_OFFSET::CblasRowOffset;
 }
 
+/**
+ * Overloaded CBLAS wrappers for use in templated host code.
+ */
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                       const float *b, int64_t ldb, float beta, float *c, int64_t ldc) {
+    ::cblas_sgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, alpha, a, (const int)lda, b,
+                  (const int)ldb, beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                       const double *b, int64_t ldb, double beta, double *c, int64_t ldc) {
+    ::cblas_dgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, alpha, a, (const int)lda, b,
+                  (const int)ldb, beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, const std::complex<float> *b,
+                       int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                       int64_t ldc) {
+    ::cblas_cgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
+                  (const int)lda, b, (const int)ldb, (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
+                       int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                       int64_t ldc) {
+    ::cblas_zgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
+                  (const int)lda, b, (const int)ldb, (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_symm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, int64_t m, int64_t n,
+                       float alpha, const float *a, int64_t lda, const float *b, int64_t ldb,
+                       float beta, float *c, int64_t ldc) {
+    ::cblas_ssymm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  (const int)m, (const int)n, alpha, a, (const int)lda, b, (const int)ldb, beta, c,
+                  (const int)ldc);
+}
+
+inline void cblas_symm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, int64_t m, int64_t n,
+                       double alpha, const double *a, int64_t lda, const double *b, int64_t ldb,
+                       double beta, double *c, int64_t ldc) {
+    ::cblas_dsymm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  (const int)m, (const int)n, alpha, a, (const int)lda, b, (const int)ldb, beta, c,
+                  (const int)ldc);
+}
+
+inline void cblas_symm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, int64_t m, int64_t n,
+                       std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                       const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                       std::complex<float> *c, int64_t ldc) {
+    ::cblas_csymm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  (const int)m, (const int)n, (const void *)&alpha, a, (const int)lda, b,
+                  (const int)ldb, (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_symm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, int64_t m, int64_t n,
+                       std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                       const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                       std::complex<double> *c, int64_t ldc) {
+    ::cblas_zsymm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  (const int)m, (const int)n, (const void *)&alpha, a, (const int)lda, b,
+                  (const int)ldb, (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                       float alpha, const float *a, int64_t lda, float beta, float *c,
+                       int64_t ldc) {
+    ::cblas_ssyrk(layout, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                  (const int)n, (const int)k, alpha, a, (const int)lda, beta, c, (const int)ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                       double alpha, const double *a, int64_t lda, double beta, double *c,
+                       int64_t ldc) {
+    ::cblas_dsyrk(layout, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                  (const int)n, (const int)k, alpha, a, (const int)lda, beta, c, (const int)ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                       std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                       std::complex<float> beta, std::complex<float> *c, int64_t ldc) {
+    ::cblas_csyrk(layout, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                  (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
+                  (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                       std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                       std::complex<double> beta, std::complex<double> *c, int64_t ldc) {
+    ::cblas_zsyrk(layout, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                  (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
+                  (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_trmm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, float alpha, const float *a,
+                       int64_t lda, float *b, int64_t ldb) {
+    ::cblas_strmm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trmm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
+                       int64_t lda, double *b, int64_t ldb) {
+    ::cblas_dtrmm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trmm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, std::complex<float> *b,
+                       int64_t ldb) {
+    ::cblas_ctrmm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trmm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, std::complex<double> *b,
+                       int64_t ldb) {
+    ::cblas_ztrmm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, float alpha, const float *a,
+                       int64_t lda, float *b, int64_t ldb) {
+    ::cblas_strsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
+                       int64_t lda, double *b, int64_t ldb) {
+    ::cblas_dtrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, std::complex<float> *b,
+                       int64_t ldb) {
+    ::cblas_ctrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, std::complex<double> *b,
+                       int64_t ldb) {
+    ::cblas_ztrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(trans), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+}
+
 // host_task automatically uses run_on_host_intel if it is supported by the
 //  compiler. Otherwise, it falls back to single_task.
 template <typename K, typename H, typename F>
@@ -95,6 +273,158 @@ static inline void host_task(H &cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// Buffer entry points are written as command-group functions over a generic
+//  handler and dispatched through host_submit. When ONEMKL_NETLIB_DIRECT_HOST
+//  is set to a non-zero value, a call on an out-of-order CPU queue where every
+//  buffer was created with use_host_ptr runs directly on the calling thread
+//  through host accessors instead of going through the SYCL scheduler.
+//  Constructing the host accessors waits for pending commands on those buffers
+//  and blocks later ones until the call returns, so buffer dependencies are
+//  still honoured. The path is off by default.
+inline bool direct_host_enabled() {
+    static const bool enabled = []() {
+        const char *env = std::getenv("ONEMKL_NETLIB_DIRECT_HOST");
+        return env != nullptr && *env != '\0' && std::strcmp(env, "0") != 0;
+    }();
+    return enabled;
+}
+
+// One distinct buffer used by a call on the direct path. A buffer passed for
+//  several arguments gets a single entry, opened for writing if any argument
+//  writes to it, so only one host accessor is ever taken per buffer.
+struct host_buffer_entry {
+    std::type_index type;
+    std::shared_ptr<void> buffer;
+    bool write;
+    void (*acquire)(host_buffer_entry &);
+    std::shared_ptr<void> accessor;
+    void *ptr;
+};
+
+template <typename T>
+inline void acquire_host_buffer(host_buffer_entry &entry) {
+    auto &buf = *static_cast<sycl::buffer<T, 1> *>(entry.buffer.get());
+    if (entry.write) {
+        auto acc = std::make_shared<sycl::host_accessor<T, 1, sycl::access::mode::read_write>>(buf);
+        entry.ptr = acc->get_pointer();
+        entry.accessor = acc;
+    }
+    else {
+        auto acc = std::make_shared<sycl::host_accessor<T, 1, sycl::access::mode::read>>(buf);
+        entry.ptr = const_cast<T *>(acc->get_pointer());
+        entry.accessor = acc;
+    }
+}
+
+template <typename T>
+inline host_buffer_entry *find_host_buffer(std::vector<host_buffer_entry> &entries,
+                                           sycl::buffer<T, 1> &buf) {
+    for (auto &entry : entries) {
+        if (entry.type == std::type_index(typeid(T)) &&
+            *static_cast<sycl::buffer<T, 1> *>(entry.buffer.get()) == buf)
+            return &entry;
+    }
+    return nullptr;
+}
+
+// First pass of host_submit: records whether all buffers are host-backed and
+//  collects the distinct buffers with their strongest access mode.
+struct host_buffer_probe {
+    bool host_backed = true;
+    std::vector<host_buffer_entry> buffers;
+
+    template <typename F>
+    void host_task(F) {}
+};
+
+// Second pass of host_submit: hands out pointers into the accessors acquired
+//  for the probed buffers and runs the host task immediately.
+struct host_direct_handler {
+    std::vector<host_buffer_entry> &buffers;
+
+    template <typename F>
+    void host_task(F f) {
+        f();
+    }
+};
+
+// Accessor handed to the command-group function on the direct path. It keeps
+//  the underlying host accessor alive for as long as any copy of it exists and
+//  exposes the same operator[] and get_multi_ptr interface as sycl::accessor.
+template <typename T, sycl::access::mode Mode>
+class host_ptr_accessor {
+public:
+    using value_type = std::conditional_t<Mode == sycl::access::mode::read, const T, T>;
+
+    struct raw_ptr {
+        value_type *ptr;
+        value_type *get_raw() const {
+            return ptr;
+        }
+    };
+
+    host_ptr_accessor() = default;
+    host_ptr_accessor(std::shared_ptr<void> acc, T *ptr) : acc_(std::move(acc)), ptr_(ptr) {}
+
+    template <sycl::access::decorated D>
+    raw_ptr get_multi_ptr() const {
+        return { ptr_ };
+    }
+
+    value_type &operator[](size_t i) const {
+        return ptr_[i];
+    }
+
+private:
+    std::shared_ptr<void> acc_;
+    value_type *ptr_ = nullptr;
+};
+
+template <sycl::access::mode Mode, typename T>
+static inline auto get_access(sycl::handler &cgh, sycl::buffer<T, 1> &buf) {
+    return buf.template get_access<Mode>(cgh);
+}
+
+template <sycl::access::mode Mode, typename T>
+static inline host_ptr_accessor<T, Mode> get_access(host_buffer_probe &probe,
+                                                    sycl::buffer<T, 1> &buf) {
+    probe.host_backed =
+        probe.host_backed && buf.template has_property<sycl::property::buffer::use_host_ptr>();
+    constexpr bool write = Mode != sycl::access::mode::read;
+    if (auto *entry = find_host_buffer(probe.buffers, buf))
+        entry->write = entry->write || write;
+    else
+        probe.buffers.push_back({ std::type_index(typeid(T)),
+                                  std::make_shared<sycl::buffer<T, 1>>(buf), write,
+                                  &acquire_host_buffer<T>, nullptr, nullptr });
+    return host_ptr_accessor<T, Mode>();
+}
+
+template <sycl::access::mode Mode, typename T>
+static inline host_ptr_accessor<T, Mode> get_access(host_direct_handler &direct,
+                                                    sycl::buffer<T, 1> &buf) {
+    auto *entry = find_host_buffer(direct.buffers, buf);
+    return host_ptr_accessor<T, Mode>(entry->accessor, static_cast<T *>(entry->ptr));
+}
+
+// In-order queues keep the host_task path so the call stays ordered with any
+//  earlier commands that do not touch its buffers.
+template <typename CGF>
+static inline void host_submit(sycl::queue &queue, CGF cgf) {
+    if (direct_host_enabled() && !queue.is_in_order() && queue.get_device().is_cpu()) {
+        host_buffer_probe probe;
+        cgf(probe);
+        if (probe.host_backed) {
+            for (auto &entry : probe.buffers)
+                entry.acquire(entry);
+            host_direct_handler direct{ probe.buffers };
+            cgf(direct);
+            return;
+        }
+    }
+    queue.submit([&](sycl::handler &cgh) { cgf(cgh); });
+}
+
 } // namespace netlib
 } // namespace blas
 } // namespace mkl
@@ -292,6 +292,257 @@ void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
 #endif
 }
 
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, int64_t levels) {
+    if (levels < 0)
+        throw invalid_argument("blas", "gemm_strassen", "levels must be non-negative");
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_sgemm_strassen>(cgh, [=]() {
+            host_gemm_strassen(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                               accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                               levels);
+        });
+    });
+}
+
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, int64_t levels) {
+    if (levels < 0)
+        throw invalid_argument("blas", "gemm_strassen", "levels must be non-negative");
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_dgemm_strassen>(cgh, [=]() {
+            host_gemm_strassen(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                               accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                               levels);
+        });
+    });
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_cgemm3m>(cgh, [=]() {
+            host_gemm3m(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                        accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_zgemm3m>(cgh, [=]() {
+            host_gemm3m(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                        accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+template <>
+int64_t gemm_pack_get_size<float>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                  int64_t k) {
+    return host_gemm_pack_size<float>(MAJOR, which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<double>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                   int64_t k) {
+    return host_gemm_pack_size<double>(MAJOR, which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<std::complex<float>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                int64_t n, int64_t k) {
+    return host_gemm_pack_size<std::complex<float>>(MAJOR, which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<std::complex<double>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                 int64_t n, int64_t k) {
+    return host_gemm_pack_size<std::complex<double>>(MAJOR, which, m, n, k);
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+               sycl::buffer<float, 1> &packed) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_packed = get_access<sycl::access::mode::write>(cgh, packed);
+        host_task<class netlib_sgemm_pack>(cgh, [=]() {
+            host_gemm_pack(MAJOR, which, trans, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                           accessor_packed.GET_MULTI_PTR);
+        });
+    });
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+               sycl::buffer<double, 1> &packed) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_packed = get_access<sycl::access::mode::write>(cgh, packed);
+        host_task<class netlib_dgemm_pack>(cgh, [=]() {
+            host_gemm_pack(MAJOR, which, trans, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                           accessor_packed.GET_MULTI_PTR);
+        });
+    });
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+               int64_t lda, sycl::buffer<std::complex<float>, 1> &packed) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_packed = get_access<sycl::access::mode::write>(cgh, packed);
+        host_task<class netlib_cgemm_pack>(cgh, [=]() {
+            host_gemm_pack(MAJOR, which, trans, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                           accessor_packed.GET_MULTI_PTR);
+        });
+    });
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+               int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+               int64_t lda, sycl::buffer<std::complex<double>, 1> &packed) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_packed = get_access<sycl::access::mode::write>(cgh, packed);
+        host_task<class netlib_zgemm_pack>(cgh, [=]() {
+            host_gemm_pack(MAJOR, which, trans, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                           accessor_packed.GET_MULTI_PTR);
+        });
+    });
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<float, 1> &packed, sycl::buffer<float, 1> &b, int64_t ldb,
+                  float beta, sycl::buffer<float, 1> &c, int64_t ldc) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_packed = get_access<sycl::access::mode::read>(cgh, packed);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_sgemm_compute>(cgh, [=]() {
+            host_gemm_compute(MAJOR, which, trans, m, n, k, accessor_packed.GET_MULTI_PTR,
+                              accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<double, 1> &packed, sycl::buffer<double, 1> &b,
+                  int64_t ldb, double beta, sycl::buffer<double, 1> &c, int64_t ldc) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_packed = get_access<sycl::access::mode::read>(cgh, packed);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_dgemm_compute>(cgh, [=]() {
+            host_gemm_compute(MAJOR, which, trans, m, n, k, accessor_packed.GET_MULTI_PTR,
+                              accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<std::complex<float>, 1> &packed,
+                  sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+                  sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_packed = get_access<sycl::access::mode::read>(cgh, packed);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_cgemm_compute>(cgh, [=]() {
+            host_gemm_compute(MAJOR, which, trans, m, n, k, accessor_packed.GET_MULTI_PTR,
+                              accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, sycl::buffer<std::complex<double>, 1> &packed,
+                  sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+                  sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_packed = get_access<sycl::access::mode::read>(cgh, packed);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_zgemm_compute>(cgh, [=]() {
+            host_gemm_compute(MAJOR, which, trans, m, n, k, accessor_packed.GET_MULTI_PTR,
+                              accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        auto accessor_bias = get_access<sycl::access::mode::read>(cgh, bias);
+        host_task<class netlib_sgemm_epilogue>(cgh, [=]() {
+            host_gemm_epilogue(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                               accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                               accessor_bias.GET_MULTI_PTR, epilogue);
+        });
+    });
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, sycl::buffer<double, 1> &bias, epilogue_desc epilogue) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        auto accessor_bias = get_access<sycl::access::mode::read>(cgh, bias);
+        host_task<class netlib_dgemm_epilogue>(cgh, [=]() {
+            host_gemm_epilogue(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                               accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                               accessor_bias.GET_MULTI_PTR, epilogue);
+        });
+    });
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        auto accessor_bias = get_access<sycl::access::mode::read>(cgh, bias);
+        host_task<class netlib_bf16gemm_epilogue>(cgh, [=]() {
+            host_gemm_epilogue(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                               accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                               accessor_bias.GET_MULTI_PTR, epilogue);
+        });
+    });
+}
+
 // USM APIs
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
@@ -582,4 +833,298 @@ sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int6
 #endif
 }
 
+sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                          int64_t levels, const std::vector<sycl::event> &dependencies) {
+    if (levels < 0)
+        throw invalid_argument("blas", "gemm_strassen", "levels must be non-negative");
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_strassen_usm>(cgh, [=]() {
+            host_gemm_strassen(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               levels);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                          const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                          int64_t levels, const std::vector<sycl::event> &dependencies) {
+    if (levels < 0)
+        throw invalid_argument("blas", "gemm_strassen", "levels must be non-negative");
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_strassen_usm>(cgh, [=]() {
+            host_gemm_strassen(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               levels);
+        });
+    });
+    return done;
+}
 
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                   const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm3m_usm>(cgh, [=]() {
+            host_gemm3m(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                   int64_t lda, const std::complex<double> *b, int64_t ldb,
+                   std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm3m_usm>(cgh, [=]() {
+            host_gemm3m(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_out_of_core(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                             const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                             int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, MAJOR == CblasColMajor, transa, transb, m, n, k,
+                                         alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+                                         dependencies, gemm_usm);
+}
+
+sycl::event gemm_out_of_core(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                             int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                             const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                             int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, MAJOR == CblasColMajor, transa, transb, m, n, k,
+                                         alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+                                         dependencies, gemm_usm);
+}
+
+sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+    const std::complex<float> *b, int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+    int64_t ldc, int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, MAJOR == CblasColMajor, transa, transb, m, n, k,
+                                         alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+                                         dependencies, gemm_usm);
+}
+
+sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+    const std::complex<double> *b, int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+    int64_t ldc, int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, MAJOR == CblasColMajor, transa, transb, m, n, k,
+                                         alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+                                         dependencies, gemm_usm);
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, float alpha, const float *a, int64_t lda, float *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_pack_usm>(cgh, [=]() {
+            host_gemm_pack(MAJOR, which, trans, m, n, k, alpha, a, lda, packed);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, double alpha, const double *a, int64_t lda, double *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_pack_usm>(cgh, [=]() {
+            host_gemm_pack(MAJOR, which, trans, m, n, k, alpha, a, lda, packed);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                      int64_t lda, std::complex<float> *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_pack_usm>(cgh, [=]() {
+            host_gemm_pack(MAJOR, which, trans, m, n, k, alpha, a, lda, packed);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n,
+                      int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                      int64_t lda, std::complex<double> *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_pack_usm>(cgh, [=]() {
+            host_gemm_pack(MAJOR, which, trans, m, n, k, alpha, a, lda, packed);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const float *packed, const float *b, int64_t ldb,
+                         float beta, float *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_compute_usm>(cgh, [=]() {
+            host_gemm_compute(MAJOR, which, trans, m, n, k, packed, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const double *packed, const double *b, int64_t ldb,
+                         double beta, double *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_compute_usm>(cgh, [=]() {
+            host_gemm_compute(MAJOR, which, trans, m, n, k, packed, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const std::complex<float> *packed,
+                         const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                         std::complex<float> *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_compute_usm>(cgh, [=]() {
+            host_gemm_compute(MAJOR, which, trans, m, n, k, packed, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,
+                         int64_t n, int64_t k, const std::complex<double> *packed,
+                         const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                         std::complex<double> *c, int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_compute_usm>(cgh, [=]() {
+            host_gemm_compute(MAJOR, which, trans, m, n, k, packed, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_epilogue_usm>(cgh, [=]() {
+            host_gemm_epilogue(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               bias, epilogue);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                          const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                          const double *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_epilogue_usm>(cgh, [=]() {
+            host_gemm_epilogue(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               bias, epilogue);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, bfloat16 *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_bf16gemm_epilogue_usm>(cgh, [=]() {
+            host_gemm_epilogue(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                               bias, epilogue);
+        });
+    });
+    return done;
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_FUSED_HPP_
+#define _NETLIB_FUSED_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "netlib_common.hpp"
+#include "netlib_threaded.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Fused level-1 kernels.
+ *
+ * Krylov solvers chain axpy, dot and nrm2 on the same vectors. These kernels
+ * compute such a chain in a single sweep over memory. The vectors are cut
+ * into the chunks of the threaded level-1 kernels: each chunk updates its part
+ * of y and reduces it while it is still in cache, and the per-chunk results
+ * are added in chunk order, as in host_dot and host_nrm2. Chunks run on the
+ * host threads from threaded_level1_min_n elements on, and the result does not
+ * depend on the number of threads.
+ */
+
+namespace detail {
+
+// Partial sums of dot2 for one chunk.
+template <typename T>
+struct dot2_sums {
+    T y, z;
+
+    dot2_sums &operator+=(const dot2_sums &other) {
+        y += other.y;
+        z += other.z;
+        return *this;
+    }
+};
+
+} // namespace detail
+
+// y = alpha * x + y, returns y^T * z computed with the updated y.
+template <typename T>
+T host_axpy_dot(int64_t n, T alpha, const T *x, int64_t incx, T *y, int64_t incy, const T *z,
+                int64_t incz) {
+    if (n <= 0)
+        return T(0);
+    x = detail::vector_start(x, n, incx);
+    y = detail::vector_start(y, n, incy);
+    z = detail::vector_start(z, n, incz);
+    const bool unit = (incx == 1 && incy == 1 && incz == 1);
+    return detail::chunked_sum<T>(
+        n,
+        [=](int64_t begin, int64_t end) {
+            T acc[fused_lanes] = {};
+            int64_t i = begin;
+            if (unit) {
+                for (; i + fused_lanes <= end; i += fused_lanes) {
+                    for (int64_t l = 0; l < fused_lanes; ++l) {
+                        const T v = alpha * x[i + l] + y[i + l];
+                        y[i + l] = v;
+                        acc[l] += v * z[i + l];
+                    }
+                }
+            }
+            for (; i < end; ++i) {
+                const T v = alpha * x[i * incx] + y[i * incy];
+                y[i * incy] = v;
+                acc[i % fused_lanes] += v * z[i * incz];
+            }
+            return detail::sum_lanes(acc);
+        },
+        n >= threaded_level1_min_n);
+}
+
+// y = alpha * x + beta * y, returns the Euclidean norm of the updated y.
+template <typename T>
+T host_axpby_nrm2(int64_t n, T alpha, const T *x, int64_t incx, T beta, T *y, int64_t incy) {
+    if (n <= 0)
+        return T(0);
+    const T *x_start = detail::vector_start(x, n, incx);
+    T *y_start = detail::vector_start(y, n, incy);
+    const bool unit = (incx == 1 && incy == 1);
+    const bool parallel = n >= threaded_level1_min_n;
+    const T ssq = detail::chunked_sum<T>(
+        n,
+        [=](int64_t begin, int64_t end) {
+            T acc[fused_lanes] = {};
+            int64_t i = begin;
+            if (unit) {
+                for (; i + fused_lanes <= end; i += fused_lanes) {
+                    for (int64_t l = 0; l < fused_lanes; ++l) {
+                        const T v = alpha * x_start[i + l] + beta * y_start[i + l];
+                        y_start[i + l] = v;
+                        acc[l] += v * v;
+                    }
+                }
+            }
+            for (; i < end; ++i) {
+                const T v = alpha * x_start[i * incx] + beta * y_start[i * incy];
+                y_start[i * incy] = v;
+                acc[i % fused_lanes] += v * v;
+            }
+            return detail::sum_lanes(acc);
+        },
+        parallel);
+    // The unscaled sum of squares may have overflowed or lost precision to
+    // underflow. The updated y is then reduced again with scaling, by CBLAS or,
+    // in reproducible mode, by the fixed-order nrm2.
+    if (!(ssq < std::numeric_limits<T>::max()) ||
+        ssq < std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon()) {
+        if (host_reproducible())
+            return detail::reproducible_nrm2(n, y, incy, parallel);
+        return detail::cblas_nrm2(n, y, incy);
+    }
+    return std::sqrt(ssq);
+}
+
+// Returns x^T * y and x^T * z in result[0] and result[1].
+template <typename T>
+void host_dot2(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy, const T *z,
+               int64_t incz, T *result) {
+    if (n <= 0) {
+        result[0] = result[1] = T(0);
+        return;
+    }
+    x = detail::vector_start(x, n, incx);
+    y = detail::vector_start(y, n, incy);
+    z = detail::vector_start(z, n, incz);
+    const bool unit = (incx == 1 && incy == 1 && incz == 1);
+    const auto sums = detail::chunked_sum<detail::dot2_sums<T>>(
+        n,
+        [=](int64_t begin, int64_t end) {
+            T acc_y[fused_lanes] = {}, acc_z[fused_lanes] = {};
+            int64_t i = begin;
+            if (unit) {
+                for (; i + fused_lanes <= end; i += fused_lanes) {
+                    for (int64_t l = 0; l < fused_lanes; ++l) {
+                        acc_y[l] += x[i + l] * y[i + l];
+                        acc_z[l] += x[i + l] * z[i + l];
+                    }
+                }
+            }
+            for (; i < end; ++i) {
+                acc_y[i % fused_lanes] += x[i * incx] * y[i * incy];
+                acc_z[i % fused_lanes] += x[i * incx] * z[i * incz];
+            }
+            return detail::dot2_sums<T>{ detail::sum_lanes(acc_y), detail::sum_lanes(acc_z) };
+        },
+        n >= threaded_level1_min_n);
+    result[0] = sums.y;
+    result[1] = sums.z;
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_FUSED_HPP_
@@ -0,0 +1,542 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_GEMM_HPP_
+#define _NETLIB_GEMM_HPP_
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../gemm3m.hpp"
+#include "../gemm_epilogue.hpp"
+#include "../gemm_strassen.hpp"
+#include "netlib_bf16_gemm.hpp"
+#include "netlib_common.hpp"
+#include "netlib_gemm_engine.hpp"
+#include "netlib_parallel.hpp"
+#include "netlib_small_gemm.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Split-K gemm.
+ *
+ * Reference CBLAS runs a single gemm on one thread, which leaves most of the
+ * machine idle for shapes such as m = n = 64, k = 1e6. Split-K partitions k
+ * into chunks, computes alpha * op(A)(:, chunk) * op(B)(chunk, :) for every
+ * chunk into a private buffer in parallel, then sums the partial products in
+ * chunk order.
+ *
+ * The partial products take num_chunks * m * n elements, so the chunk count is
+ * limited to what fits in split_k_max_workspace bytes and, outside
+ * reproducible mode, to the number of threads, since more chunks than threads
+ * only add workspace and summation. In reproducible mode the chunk count
+ * depends only on the sizes, so the result does not depend on the number of
+ * threads.
+ *
+ * Split-K is used automatically when k is much larger than m and n. The
+ * ONEMKL_NETLIB_GEMM_SPLIT_K environment variable overrides the heuristic:
+ * 0 disables split-K and 1 uses it whenever there are at least two chunks. In
+ * reproducible mode the heuristic ignores the number of threads.
+ */
+constexpr int64_t split_k_min_chunk = 256;
+constexpr int64_t split_k_max_chunks = 64;
+constexpr int64_t split_k_min_ratio = 16;
+constexpr int64_t split_k_max_mn = 512 * 512;
+constexpr int64_t split_k_max_workspace = int64_t(64) << 20;
+
+enum class split_k_mode { automatic, disabled, forced };
+
+inline split_k_mode get_split_k_mode() {
+    static const split_k_mode mode = []() {
+        const char *env = std::getenv("ONEMKL_NETLIB_GEMM_SPLIT_K");
+        if (env == nullptr || *env == '\0')
+            return split_k_mode::automatic;
+        return std::strcmp(env, "0") == 0 ? split_k_mode::disabled : split_k_mode::forced;
+    }();
+    return mode;
+}
+
+template <typename T>
+inline int64_t split_k_num_chunks(int64_t m, int64_t n, int64_t k) {
+    const int64_t workspace_chunks = split_k_max_workspace / int64_t(sizeof(T)) / (m * n);
+    int64_t num_chunks = std::min({ k / split_k_min_chunk, split_k_max_chunks, workspace_chunks });
+    if (!host_reproducible())
+        num_chunks = std::min(num_chunks, host_num_threads());
+    return num_chunks;
+}
+
+template <typename T>
+inline bool use_split_k_gemm(int64_t m, int64_t n, int64_t k) {
+    if (m <= 0 || n <= 0 || split_k_num_chunks<T>(m, n, k) < 2)
+        return false;
+    switch (get_split_k_mode()) {
+        case split_k_mode::disabled: return false;
+        case split_k_mode::forced: return true;
+        default:
+            return (host_num_threads() > 1 || host_reproducible()) &&
+                   k >= split_k_min_ratio * std::max(m, n) && m * n <= split_k_max_mn;
+    }
+}
+
+template <typename T>
+void split_k_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                  int64_t k, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb, T beta,
+                  T *c, int64_t ldc) {
+    const int64_t num_chunks = split_k_num_chunks<T>(m, n, k);
+    int64_t a_rs, a_cs, b_rs, b_cs;
+    detail::op_strides(layout, transa, lda, a_rs, a_cs);
+    detail::op_strides(layout, transb, ldb, b_rs, b_cs);
+
+    // Partial products are stored densely in the layout of C.
+    const bool col_major = (layout == CblasColMajor);
+    const int64_t inner = col_major ? m : n;
+    const int64_t outer = col_major ? n : m;
+    std::vector<T> partial(num_chunks * m * n);
+
+    host_parallel_for(num_chunks, [&](int64_t chunk) {
+        const int64_t k_begin = chunk * k / num_chunks;
+        const int64_t k_size = (chunk + 1) * k / num_chunks - k_begin;
+        if (use_gemm_engine(m, n, k_size)) {
+            engine_gemm(layout, transa, transb, m, n, k_size, alpha, a + k_begin * a_cs, lda,
+                        b + k_begin * b_rs, ldb, T(0), partial.data() + chunk * m * n, inner,
+                        false);
+        }
+        else {
+            cblas_gemm(layout, transa, transb, m, n, k_size, alpha, a + k_begin * a_cs, lda,
+                       b + k_begin * b_rs, ldb, T(0), partial.data() + chunk * m * n, inner);
+        }
+    });
+
+    host_parallel_for(outer, [&](int64_t o) {
+        T *c_vec = c + o * ldc;
+        for (int64_t i = 0; i < inner; ++i) {
+            T sum = partial[o * inner + i];
+            for (int64_t chunk = 1; chunk < num_chunks; ++chunk)
+                sum += partial[(chunk * outer + o) * inner + i];
+            c_vec[i] = (beta == T(0)) ? sum : sum + beta * c_vec[i];
+        }
+    });
+}
+
+/**
+ * Host gemm driver. Runs inside the host_task of the gemm and gemm_batch
+ * entry points and selects the execution strategy for one matrix product.
+ */
+template <typename T>
+void host_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+               int64_t k, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb, T beta, T *c,
+               int64_t ldc) {
+    if (use_small_gemm(m, n, k)) {
+        small_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+    else if (use_split_k_gemm<T>(m, n, k)) {
+        split_k_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+    else if (use_gemm_engine(m, n, k)) {
+        engine_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+    else {
+        cblas_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+}
+
+template <typename T>
+void host_gemm_batch(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                     int64_t n, int64_t k, T alpha, const T *a, int64_t lda, int64_t stride_a,
+                     const T *b, int64_t ldb, int64_t stride_b, T beta, T *c, int64_t ldc,
+                     int64_t stride_c, int64_t batch_size) {
+    for (int64_t i = 0; i < batch_size; ++i) {
+        host_gemm(layout, transa, transb, m, n, k, alpha, a + i * stride_a, lda, b + i * stride_b,
+                  ldb, beta, c + i * stride_c, ldc);
+    }
+}
+
+/**
+ * One product of a grouped gemm_batch on the calling thread, for callers that
+ * are already parallel. Takes the path of host_gemm except for split-K.
+ */
+template <typename T>
+void host_gemm_serial(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                      int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b,
+                      int64_t ldb, T beta, T *c, int64_t ldc) {
+    if (use_small_gemm(m, n, k)) {
+        small_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+    else if (use_gemm_engine(m, n, k)) {
+        engine_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, false);
+    }
+    else {
+        cblas_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+}
+
+/**
+ * Grouped gemm_batch.
+ *
+ * Servicing the groups one after another leaves threads idle when sizes
+ * differ widely, since a small product does not keep more than one thread
+ * busy. The products of all groups are instead flattened and sorted by
+ * decreasing work m * n * k. Products of at least gemm_batch_parallel_work run
+ * first, one at a time, on all threads through host_gemm. The others are
+ * handed out dynamically to the threads, largest first, and each runs on one
+ * thread, so that the longest products do not end up last on a single thread.
+ * The path of a product depends only on its sizes, so results do not depend
+ * on the number of threads.
+ */
+constexpr int64_t gemm_batch_parallel_work = int64_t(256) * 256 * 256;
+
+template <typename T>
+void host_gemm_batch(CBLAS_LAYOUT layout, const transpose *transa, const transpose *transb,
+                     const int64_t *m, const int64_t *n, const int64_t *k, const T *alpha,
+                     const T **a, const int64_t *lda, const T **b, const int64_t *ldb,
+                     const T *beta, T **c, const int64_t *ldc, int64_t group_count,
+                     const int64_t *group_size) {
+    struct problem {
+        int64_t group, offset, work;
+    };
+    std::vector<problem> problems;
+    int64_t offset = 0;
+    for (int64_t group = 0; group < group_count; ++group) {
+        const int64_t work = std::max<int64_t>(m[group], 0) * std::max<int64_t>(n[group], 0) *
+                             std::max<int64_t>(k[group], 1);
+        for (int64_t i = 0; i < group_size[group]; ++i, ++offset)
+            problems.push_back({ group, offset, work });
+    }
+    std::stable_sort(problems.begin(), problems.end(),
+                     [](const problem &x, const problem &y) { return x.work > y.work; });
+
+    const auto small = std::find_if(problems.begin(), problems.end(), [](const problem &p) {
+        return p.work < gemm_batch_parallel_work;
+    });
+    for (auto p = problems.begin(); p != small; ++p) {
+        const int64_t g = p->group, i = p->offset;
+        host_gemm(layout, transa[g], transb[g], m[g], n[g], k[g], alpha[g], a[i], lda[g], b[i],
+                  ldb[g], beta[g], c[i], ldc[g]);
+    }
+    const problem *rest = problems.data() + (small - problems.begin());
+    host_parallel_for(problems.end() - small, [&](int64_t task) {
+        const int64_t g = rest[task].group, i = rest[task].offset;
+        host_gemm_serial(layout, transa[g], transb[g], m[g], n[g], k[g], alpha[g], a[i], lda[g],
+                         b[i], ldb[g], beta[g], c[i], ldc[g]);
+    });
+}
+
+/**
+ * Host policy for the Strassen-Winograd recursion of gemm_strassen: block
+ * products go through host_gemm and block sums are computed in parallel over
+ * the columns (column major) or rows (row major) of the destination.
+ */
+template <typename T>
+class host_strassen_ops {
+public:
+    explicit host_strassen_ops(CBLAS_LAYOUT layout) : layout_(layout) {}
+
+    void gemm(int64_t m, int64_t n, int64_t k, T alpha, strassen::matrix_view<const T> a,
+              strassen::matrix_view<const T> b, T beta, strassen::matrix_view<T> c) {
+        host_gemm(layout_, a.trans, b.trans, m, n, k, alpha, a.ptr, a.ld, b.ptr, b.ld, beta, c.ptr,
+                  c.ld);
+    }
+
+    void combine(int64_t m, int64_t n, strassen::matrix_view<T> dst,
+                 const std::array<strassen::term<T>, 3> &terms) {
+        const bool col_major = (layout_ == CblasColMajor);
+        const int64_t outer = col_major ? n : m;
+        const int64_t inner = col_major ? m : n;
+        host_parallel_for(outer, [&](int64_t o) {
+            for (int64_t idx = 0; idx < inner; ++idx) {
+                const int64_t i = col_major ? idx : o;
+                const int64_t j = col_major ? o : idx;
+                T sum = T(0);
+                for (const auto &t : terms) {
+                    if (t.x.ptr)
+                        sum += t.coef * t.x.ptr[i * t.x.rs + j * t.x.cs];
+                }
+                dst.ptr[i * dst.rs + j * dst.cs] = sum;
+            }
+        });
+    }
+
+private:
+    CBLAS_LAYOUT layout_;
+};
+
+template <typename T>
+void host_gemm_strassen(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                        int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b,
+                        int64_t ldb, T beta, T *c, int64_t ldc, int64_t levels) {
+    using recursion_t = strassen::strassen_gemm<T, host_strassen_ops<T>>;
+    const bool col_major = (layout == CblasColMajor);
+    levels = std::min(levels, strassen::max_levels);
+    host_strassen_ops<T> ops(layout);
+    std::vector<T> workspace(recursion_t::workspace_size(levels, m, n, k));
+    recursion_t(ops, col_major)
+        .run(levels, m, n, k, alpha, strassen::make_view(a, col_major, transa, lda),
+             strassen::make_view(b, col_major, transb, ldb), beta,
+             strassen::make_view(c, col_major, transpose::nontrans, ldc), workspace.data());
+}
+
+/**
+ * Host gemm3m: the panels of op(A) and op(B) are split in parallel over their
+ * columns, the three real products go through host_gemm and C is updated in
+ * parallel over its columns (column major) or rows (row major).
+ */
+template <typename T>
+void host_gemm3m(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<T> alpha, const std::complex<T> *a, int64_t lda,
+                 const std::complex<T> *b, int64_t ldb, std::complex<T> beta, std::complex<T> *c,
+                 int64_t ldc) {
+    if (m <= 0 || n <= 0)
+        return;
+    const bool col_major = (layout == CblasColMajor);
+    const int64_t kb = std::min(k, gemm3m::panel_size);
+    std::vector<T> workspace(gemm3m::workspace_size(m, n, k));
+    T *a_re = workspace.data(), *a_im = a_re + m * kb, *a_sum = a_im + m * kb;
+    T *b_re = a_sum + m * kb, *b_im = b_re + kb * n, *b_sum = b_im + kb * n;
+    T *t1 = b_sum + kb * n, *t2 = t1 + m * n, *t3 = t2 + m * n;
+
+    int64_t a_rs, a_cs, b_rs, b_cs, c_rs, c_cs;
+    gemm3m::op_strides(col_major, transa, lda, a_rs, a_cs);
+    gemm3m::op_strides(col_major, transb, ldb, b_rs, b_cs);
+    gemm3m::op_strides(col_major, transpose::nontrans, ldc, c_rs, c_cs);
+    const bool conj_a = (transa == transpose::conjtrans);
+    const bool conj_b = (transb == transpose::conjtrans);
+
+    for (int64_t p = 0; p < k; p += kb) {
+        const int64_t kp = std::min(kb, k - p);
+        const gemm3m::split_kernel<T, const std::complex<T> *> split_a{
+            a, p * a_cs, a_rs, a_cs, conj_a, m, a_re, a_im, a_sum
+        };
+        const gemm3m::split_kernel<T, const std::complex<T> *> split_b{
+            b, p * b_rs, b_rs, b_cs, conj_b, kp, b_re, b_im, b_sum
+        };
+        host_parallel_for(kp, [&](int64_t j) {
+            for (int64_t i = 0; i < m; ++i)
+                split_a(i, j);
+        });
+        host_parallel_for(n, [&](int64_t j) {
+            for (int64_t i = 0; i < kp; ++i)
+                split_b(i, j);
+        });
+        const T beta_p = (p == 0) ? T(0) : T(1);
+        host_gemm(CblasColMajor, transpose::nontrans, transpose::nontrans, m, n, kp, T(1), a_re, m,
+                  b_re, kp, beta_p, t1, m);
+        host_gemm(CblasColMajor, transpose::nontrans, transpose::nontrans, m, n, kp, T(1), a_im, m,
+                  b_im, kp, beta_p, t2, m);
+        host_gemm(CblasColMajor, transpose::nontrans, transpose::nontrans, m, n, kp, T(1), a_sum,
+                  m, b_sum, kp, beta_p, t3, m);
+    }
+
+    const gemm3m::combine_kernel<T, std::complex<T> *> update_c{
+        t1, t2, t3, m, k > 0, alpha, beta, beta == std::complex<T>(0), c, c_rs, c_cs
+    };
+    const int64_t outer = col_major ? n : m;
+    const int64_t inner = col_major ? m : n;
+    host_parallel_for(outer, [&](int64_t o) {
+        for (int64_t idx = 0; idx < inner; ++idx) {
+            if (col_major)
+                update_c(idx, o);
+            else
+                update_c(o, idx);
+        }
+    });
+}
+
+/**
+ * Host gemm with a compute mode. float products use bfloat16 operands for
+ * float_to_bf16, see netlib_bf16_gemm.hpp, and complex products use gemm3m for
+ * complex_3m and any. Other modes, and modes without an implementation for the
+ * processor, fall back to host_gemm.
+ */
+template <typename T>
+void host_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+               int64_t k, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb, T beta, T *c,
+               int64_t ldc, compute_mode mode) {
+    if constexpr (std::is_same_v<T, float>) {
+        if (use_bf16_gemm(mode, m, n, k)) {
+            host_bf16_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+            return;
+        }
+    }
+    if constexpr (detail::is_complex<T>::value) {
+        if (mode == compute_mode::complex_3m || mode == compute_mode::any) {
+            host_gemm3m(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+            return;
+        }
+    }
+    host_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+/**
+ * gemm_pack and gemm_compute. Products large enough for the gemm engine keep
+ * the packed operand in the engine's own panel layout, see
+ * gemm_engine::pack, so that gemm_compute skips packing it. Other products
+ * store alpha * op(X) as a dense column-major matrix and go through
+ * host_gemm. Both sides choose the format from m, n and k only.
+ *
+ * A row-major C^T = op(B)^T * op(A)^T is handled as a column-major product
+ * with m and n and the roles of A and B swapped; op(X)^T of a row-major X is
+ * the same transpose operation applied to X read as a column-major matrix.
+ */
+inline void gemm_pack_to_column_major(CBLAS_LAYOUT layout, pack_matrix &which, int64_t &m,
+                                      int64_t &n) {
+    if (layout == CblasRowMajor) {
+        std::swap(m, n);
+        which = (which == pack_matrix::a) ? pack_matrix::b : pack_matrix::a;
+    }
+}
+
+template <typename T>
+int64_t host_gemm_pack_size(CBLAS_LAYOUT layout, pack_matrix which, int64_t m, int64_t n,
+                            int64_t k) {
+    gemm_pack_to_column_major(layout, which, m, n);
+    if (m <= 0 || n <= 0 || k <= 0)
+        return 0;
+    if (use_gemm_engine(m, n, k))
+        return gemm_engine::packed_size<T>(which, m, n, k);
+    return ((which == pack_matrix::a) ? m : n) * k;
+}
+
+template <typename T>
+void host_gemm_pack(CBLAS_LAYOUT layout, pack_matrix which, transpose trans, int64_t m,
+                    int64_t n, int64_t k, T alpha, const T *x, int64_t ld, T *dst) {
+    gemm_pack_to_column_major(layout, which, m, n);
+    if (m <= 0 || n <= 0 || k <= 0)
+        return;
+    const auto op = gemm_engine::general_operand(CblasColMajor, trans, x, ld);
+    if (use_gemm_engine(m, n, k)) {
+        gemm_engine::pack(which, m, n, k, alpha, op, dst);
+        return;
+    }
+    const int64_t rows = (which == pack_matrix::a) ? m : k;
+    const int64_t cols = (which == pack_matrix::a) ? k : n;
+    host_parallel_for(cols, [&](int64_t j) {
+        for (int64_t i = 0; i < rows; ++i)
+            dst[i + j * rows] = alpha * op(i, j);
+    });
+}
+
+template <typename T>
+void host_gemm_compute(CBLAS_LAYOUT layout, pack_matrix which, transpose trans, int64_t m,
+                       int64_t n, int64_t k, const T *packed, const T *x, int64_t ldx, T beta,
+                       T *c, int64_t ldc) {
+    gemm_pack_to_column_major(layout, which, m, n);
+    if (m > 0 && n > 0 && k > 0 && use_gemm_engine(m, n, k)) {
+        gemm_engine::gemm_packed(which, m, n, k, packed,
+                                 gemm_engine::general_operand(CblasColMajor, trans, x, ldx), beta,
+                                 c, ldc);
+    }
+    else if (which == pack_matrix::a) {
+        host_gemm(CblasColMajor, transpose::nontrans, trans, m, n, k, T(1), packed,
+                  std::max<int64_t>(1, m), x, ldx, beta, c, ldc);
+    }
+    else {
+        host_gemm(CblasColMajor, trans, transpose::nontrans, m, n, k, T(1), x, ldx, packed,
+                  std::max<int64_t>(1, k), beta, c, ldc);
+    }
+}
+
+/**
+ * gemm_epilogue. Products large enough for the gemm engine apply the epilogue
+ * to each block of C as the engine completes it, see gemm_engine::blocked_gemm.
+ * A C of another type than the product, such as the bfloat16 C of a float
+ * product, is computed by blocks of columns in a workspace of the product
+ * type, and beta * C is added as each block is converted. Other products apply
+ * the epilogue after host_gemm. Row-major products are computed as C^T.
+ */
+template <typename T, typename Tc>
+void host_gemm_epilogue(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                        int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b,
+                        int64_t ldb, T beta, Tc *c, int64_t ldc, const T *bias,
+                        const epilogue_desc &desc) {
+    const epilogue::op<T> ep(desc, layout == CblasColMajor);
+    if (layout == CblasRowMajor) {
+        std::swap(m, n);
+        std::swap(transa, transb);
+        std::swap(a, b);
+        std::swap(lda, ldb);
+    }
+    if (m <= 0 || n <= 0)
+        return;
+    constexpr bool in_place = std::is_same_v<T, Tc>;
+    // Stores the mb x nb block x of the product at (i0, j0) of C. x already
+    // includes beta * C when C has the type of the product.
+    auto finish = [&](int64_t i0, int64_t j0, int64_t mb, int64_t nb, const T *x, int64_t ldx) {
+        // Local copies, which the stores to C cannot alias.
+        const epilogue::op<T> e = ep;
+        const T *const bias_ptr = bias;
+        for (int64_t j = 0; j < nb; ++j) {
+            for (int64_t i = 0; i < mb; ++i) {
+                Tc &cij = c[(i0 + i) + (j0 + j) * ldc];
+                T v = x[i + j * ldx];
+                if (!in_place && beta != T(0))
+                    v += beta * static_cast<T>(cij);
+                cij = static_cast<Tc>(e(v, bias_ptr, i0 + i, j0 + j));
+            }
+        }
+    };
+    if (alpha != T(0) && use_gemm_engine(m, n, k)) {
+        const auto op_a = gemm_engine::general_operand(CblasColMajor, transa, a, lda);
+        const auto op_b = gemm_engine::general_operand(CblasColMajor, transb, b, ldb);
+        if constexpr (in_place) {
+            gemm_engine::gemm_finish(m, n, k, alpha, op_a, op_b, beta, c, ldc, finish);
+        }
+        else {
+            const int64_t nc = std::min(
+                n, gemm_engine::get_block_sizes(gemm_engine::select_kernel<T>()).nc);
+            std::vector<T> work(m * nc);
+            for (int64_t j0 = 0; j0 < n; j0 += nc) {
+                gemm_engine::gemm_finish(
+                    m, std::min(nc, n - j0), k, alpha, op_a, op_b.block(0, j0), T(0),
+                    work.data(), m,
+                    [&](int64_t i0, int64_t j, int64_t mb, int64_t nb, const T *x, int64_t ldx) {
+                        finish(i0, j0 + j, mb, nb, x, ldx);
+                    });
+            }
+        }
+        return;
+    }
+    if constexpr (in_place) {
+        host_gemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        host_parallel_for(n, [&](int64_t j) { finish(0, j, m, 1, c + j * ldc, ldc); });
+    }
+    else {
+        std::vector<T> work(m * n);
+        host_gemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, T(0),
+                  work.data(), m);
+        host_parallel_for(n, [&](int64_t j) { finish(0, j, m, 1, work.data() + j * m, m); });
+    }
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_GEMM_HPP_
@@ -0,0 +1,1119 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_GEMM_ENGINE_HPP_
+#define _NETLIB_GEMM_ENGINE_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(__SYCL_DEVICE_ONLY__)
+#define NETLIB_GEMM_ENGINE_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+#include "netlib_common.hpp"
+#include "netlib_parallel.hpp"
+#include "netlib_small_gemm.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Built-in gemm engine.
+ *
+ * Reference CBLAS computes level-3 routines with unblocked loops. When the
+ * backend is built with ENABLE_NETLIB_GEMM_ENGINE, large gemm, symm, syrk,
+ * trmm and trsm calls are instead computed by a BLIS-style engine:
+ *
+ * - op(A) and op(B) are packed into panels of MR rows and NR columns, and an
+ *   MR x NR tile of C is accumulated in registers by a micro-kernel. AVX-512
+ *   and AVX2 micro-kernels are selected at run time, other targets use a
+ *   portable kernel. Complex products are mapped to the real kernels.
+ * - The loops are blocked so that a KC x NR panel of B stays in L1, an
+ *   MC x KC block of A in L2 and a KC x NC block of B in L3. The cache sizes
+ *   are read with cpuid.
+ * - The blocks of C are computed in parallel over m and n. The order of the
+ *   additions into an element of C only depends on k and the block sizes, so
+ *   the result does not depend on the number of threads.
+ *
+ * symm and trmm pack the symmetric or triangular operand directly, syrk and
+ * trmm are split into block rows or columns so that only the referenced
+ * triangle is computed, and trsm solves diagonal blocks by substitution and
+ * updates the remaining rows with the engine.
+ *
+ * Setting the ONEMKL_NETLIB_GEMM_ENGINE environment variable to 0 disables the
+ * engine at run time.
+ */
+#ifdef ONEMKL_NETLIB_GEMM_ENGINE
+constexpr bool gemm_engine_built = true;
+#else
+constexpr bool gemm_engine_built = false;
+#endif
+constexpr int64_t gemm_engine_min_work = 1 << 15;
+
+inline bool gemm_engine_enabled() {
+    static const bool enabled = []() {
+        const char *env = std::getenv("ONEMKL_NETLIB_GEMM_ENGINE");
+        return gemm_engine_built && (env == nullptr || std::strcmp(env, "0") != 0);
+    }();
+    return enabled;
+}
+
+inline bool use_gemm_engine(int64_t m, int64_t n, int64_t k) {
+    return gemm_engine_enabled() && m > 0 && n > 0 && k > 0 && m * n * k >= gemm_engine_min_work;
+}
+
+namespace gemm_engine {
+
+constexpr int64_t level3_block = 256;
+constexpr int64_t trsm_block = 128;
+
+enum class structure { general, symmetric, triangular };
+
+/**
+ * Matrix operand of the engine. Element (i, j) is read at
+ * ptr[(row0 + i) * rs + (col0 + j) * cs], conjugated if conj is set. A
+ * symmetric operand only reads its lower or upper triangle, and a triangular
+ * operand is zero outside of it and may have an implicit unit diagonal. The
+ * triangles refer to the full matrix, so that blocks keep their structure.
+ */
+template <typename T>
+struct operand {
+    const T *ptr;
+    int64_t rs, cs;
+    bool conj = false;
+    structure kind = structure::general;
+    bool lower = false;
+    bool unit = false;
+    int64_t row0 = 0, col0 = 0;
+
+    T operator()(int64_t i, int64_t j) const {
+        i += row0;
+        j += col0;
+        if (kind != structure::general && (lower ? i < j : i > j)) {
+            if (kind == structure::triangular)
+                return T(0);
+            std::swap(i, j);
+        }
+        if (kind == structure::triangular && unit && i == j)
+            return T(1);
+        return detail::conj_if(ptr[i * rs + j * cs], conj);
+    }
+
+    operand block(int64_t i, int64_t j) const {
+        operand sub = *this;
+        sub.row0 += i;
+        sub.col0 += j;
+        return sub;
+    }
+
+    operand transposed() const {
+        operand t = *this;
+        std::swap(t.rs, t.cs);
+        std::swap(t.row0, t.col0);
+        t.lower = !lower;
+        return t;
+    }
+};
+
+// op(X) for a general matrix stored with leading dimension ld.
+template <typename T>
+operand<T> general_operand(CBLAS_LAYOUT layout, transpose trans, const T *x, int64_t ld) {
+    operand<T> op{ x, 0, 0 };
+    detail::op_strides(layout, trans, ld, op.rs, op.cs);
+    op.conj = (trans == transpose::conjtrans);
+    return op;
+}
+
+template <typename T>
+operand<T> symmetric_operand(CBLAS_LAYOUT layout, uplo upper_lower, const T *x, int64_t ld) {
+    operand<T> op = general_operand(layout, transpose::nontrans, x, ld);
+    op.kind = structure::symmetric;
+    op.lower = (upper_lower == uplo::lower);
+    return op;
+}
+
+// op(X) for a triangular matrix; op(X) is lower triangular if X is lower
+// triangular and not transposed, or upper triangular and transposed.
+template <typename T>
+operand<T> triangular_operand(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans,
+                              diag unit_diag, const T *x, int64_t ld) {
+    operand<T> op = general_operand(layout, trans, x, ld);
+    op.kind = structure::triangular;
+    op.lower = (upper_lower == uplo::lower) == (trans == transpose::nontrans);
+    op.unit = (unit_diag == diag::unit);
+    return op;
+}
+
+// A dense m x n matrix in the given layout, written by the engine.
+template <typename T>
+struct output {
+    T *ptr;
+    int64_t rs, cs;
+
+    output(CBLAS_LAYOUT layout, T *x, int64_t ld)
+            : ptr(x),
+              rs(layout == CblasColMajor ? 1 : ld),
+              cs(layout == CblasColMajor ? ld : 1) {}
+    output(T *x, int64_t x_rs, int64_t x_cs) : ptr(x), rs(x_rs), cs(x_cs) {}
+
+    T &operator()(int64_t i, int64_t j) const {
+        return ptr[i * rs + j * cs];
+    }
+    output block(int64_t i, int64_t j) const {
+        return output(ptr + i * rs + j * cs, rs, cs);
+    }
+    operand<T> as_operand() const {
+        return operand<T>{ ptr, rs, cs };
+    }
+};
+
+struct cache_sizes {
+    int64_t l1, l2, l3;
+};
+
+// Data cache sizes from the deterministic cache parameters of cpuid, leaf 4 on
+// Intel and leaf 0x8000001D on AMD processors. Levels that cannot be read keep
+// a default size.
+inline cache_sizes host_cache_sizes() {
+    static const cache_sizes sizes = []() {
+        cache_sizes s{ 32 * 1024, 1024 * 1024, 8 * 1024 * 1024 };
+#ifdef NETLIB_GEMM_ENGINE_X86
+        unsigned eax, ebx, ecx, edx, leaf;
+        if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx))
+            return s;
+        if (ebx == 0x756e6547 && eax >= 4) // "Genu"
+            leaf = 4;
+        else if (ebx == 0x68747541 && __get_cpuid_max(0x80000000, nullptr) >= 0x8000001d) // "Auth"
+            leaf = 0x8000001d;
+        else
+            return s;
+        for (unsigned sub = 0; sub < 16; ++sub) {
+            __cpuid_count(leaf, sub, eax, ebx, ecx, edx);
+            const unsigned type = eax & 0x1f;
+            if (type == 0)
+                break;
+            if (type == 2) // instruction cache
+                continue;
+            const int64_t size = int64_t((ebx >> 22) + 1) * (((ebx >> 12) & 0x3ff) + 1) *
+                                 ((ebx & 0xfff) + 1) * (int64_t(ecx) + 1);
+            switch ((eax >> 5) & 0x7) {
+                case 1: s.l1 = size; break;
+                case 2: s.l2 = size; break;
+                case 3: s.l3 = size; break;
+                default: break;
+            }
+        }
+#endif
+        return s;
+    }();
+    return sizes;
+}
+
+enum class isa { generic, avx2, avx512 };
+
+inline isa host_isa() {
+    static const isa value = []() {
+#ifdef NETLIB_GEMM_ENGINE_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return isa::avx512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return isa::avx2;
+#endif
+        return isa::generic;
+    }();
+    return value;
+}
+
+/**
+ * Micro-kernels compute C = alpha * A * B + beta * C for an MR x NR tile of a
+ * real column-major C, where A is a packed KC x MR panel stored MR elements
+ * per step of k and B a packed KC x NR panel stored NR elements per step. C is
+ * not read if beta is zero. Complex products are mapped to the real kernels,
+ * see gemm below. The packed panels hold elements of type P, which differs
+ * from T for kernels working on a lower precision copy of A and B.
+ */
+template <typename T, typename P = T>
+using micro_kernel = void (*)(int64_t kc, const P *a, const P *b, T alpha, T beta, T *c,
+                              int64_t ldc);
+
+// kr is the step of the kernel along k; the kc passed to it is a multiple of
+// kr.
+template <typename T, typename P = T>
+struct kernel_info {
+    int64_t mr, nr;
+    micro_kernel<T, P> run;
+    int64_t kr = 1;
+};
+
+// acc + a * b, without the special cases of the complex product.
+template <typename T>
+inline T mul_add(T acc, T a, T b) {
+    if constexpr (detail::is_complex<T>::value) {
+        return T(acc.real() + a.real() * b.real() - a.imag() * b.imag(),
+                 acc.imag() + a.real() * b.imag() + a.imag() * b.real());
+    }
+    else {
+        return acc + a * b;
+    }
+}
+
+template <typename T, int MR, int NR>
+void generic_kernel(int64_t kc, const T *a, const T *b, T alpha, T beta, T *c, int64_t ldc) {
+    T acc[NR][MR] = {};
+    for (int64_t p = 0; p < kc; ++p, a += MR, b += NR) {
+        for (int j = 0; j < NR; ++j) {
+            for (int i = 0; i < MR; ++i)
+                acc[j][i] += a[i] * b[j];
+        }
+    }
+    for (int j = 0; j < NR; ++j) {
+        for (int i = 0; i < MR; ++i) {
+            T &cij = c[i + j * ldc];
+            cij = (beta == T(0)) ? alpha * acc[j][i] : alpha * acc[j][i] + beta * cij;
+        }
+    }
+}
+
+#ifdef NETLIB_GEMM_ENGINE_X86
+
+#define NETLIB_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#define NETLIB_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+
+template <typename T>
+struct avx2_ops;
+
+template <>
+struct avx2_ops<float> {
+    using vec = __m256;
+    static constexpr int width = 8;
+    NETLIB_TARGET_AVX2 static vec zero() {
+        return _mm256_setzero_ps();
+    }
+    NETLIB_TARGET_AVX2 static vec set1(float x) {
+        return _mm256_set1_ps(x);
+    }
+    NETLIB_TARGET_AVX2 static vec load(const float *p) {
+        return _mm256_loadu_ps(p);
+    }
+    NETLIB_TARGET_AVX2 static void store(float *p, vec x) {
+        _mm256_storeu_ps(p, x);
+    }
+    NETLIB_TARGET_AVX2 static vec mul(vec x, vec y) {
+        return _mm256_mul_ps(x, y);
+    }
+    NETLIB_TARGET_AVX2 static vec fmadd(vec x, vec y, vec z) {
+        return _mm256_fmadd_ps(x, y, z);
+    }
+};
+
+template <>
+struct avx2_ops<double> {
+    using vec = __m256d;
+    static constexpr int width = 4;
+    NETLIB_TARGET_AVX2 static vec zero() {
+        return _mm256_setzero_pd();
+    }
+    NETLIB_TARGET_AVX2 static vec set1(double x) {
+        return _mm256_set1_pd(x);
+    }
+    NETLIB_TARGET_AVX2 static vec load(const double *p) {
+        return _mm256_loadu_pd(p);
+    }
+    NETLIB_TARGET_AVX2 static void store(double *p, vec x) {
+        _mm256_storeu_pd(p, x);
+    }
+    NETLIB_TARGET_AVX2 static vec mul(vec x, vec y) {
+        return _mm256_mul_pd(x, y);
+    }
+    NETLIB_TARGET_AVX2 static vec fmadd(vec x, vec y, vec z) {
+        return _mm256_fmadd_pd(x, y, z);
+    }
+};
+
+template <typename T>
+struct avx512_ops;
+
+template <>
+struct avx512_ops<float> {
+    using vec = __m512;
+    static constexpr int width = 16;
+    NETLIB_TARGET_AVX512 static vec zero() {
+        return _mm512_setzero_ps();
+    }
+    NETLIB_TARGET_AVX512 static vec set1(float x) {
+        return _mm512_set1_ps(x);
+    }
+    NETLIB_TARGET_AVX512 static vec load(const float *p) {
+        return _mm512_loadu_ps(p);
+    }
+    NETLIB_TARGET_AVX512 static void store(float *p, vec x) {
+        _mm512_storeu_ps(p, x);
+    }
+    NETLIB_TARGET_AVX512 static vec mul(vec x, vec y) {
+        return _mm512_mul_ps(x, y);
+    }
+    NETLIB_TARGET_AVX512 static vec fmadd(vec x, vec y, vec z) {
+        return _mm512_fmadd_ps(x, y, z);
+    }
+};
+
+template <>
+struct avx512_ops<double> {
+    using vec = __m512d;
+    static constexpr int width = 8;
+    NETLIB_TARGET_AVX512 static vec zero() {
+        return _mm512_setzero_pd();
+    }
+    NETLIB_TARGET_AVX512 static vec set1(double x) {
+        return _mm512_set1_pd(x);
+    }
+    NETLIB_TARGET_AVX512 static vec load(const double *p) {
+        return _mm512_loadu_pd(p);
+    }
+    NETLIB_TARGET_AVX512 static void store(double *p, vec x) {
+        _mm512_storeu_pd(p, x);
+    }
+    NETLIB_TARGET_AVX512 static vec mul(vec x, vec y) {
+        return _mm512_mul_pd(x, y);
+    }
+    NETLIB_TARGET_AVX512 static vec fmadd(vec x, vec y, vec z) {
+        return _mm512_fmadd_pd(x, y, z);
+    }
+};
+
+// The AVX2 and AVX-512 kernels are identical up to the vector operations, but
+// each needs its own target attribute for the operations to be inlined.
+// MR is two vectors and the NR x 2 accumulators stay in registers.
+template <typename T, int NR>
+NETLIB_TARGET_AVX2 void avx2_kernel(int64_t kc, const T *a, const T *b, T alpha, T beta, T *c,
+                                    int64_t ldc) {
+    using ops = avx2_ops<T>;
+    using vec = typename ops::vec;
+    constexpr int w = ops::width;
+    vec acc0[NR], acc1[NR];
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; ++j)
+        acc0[j] = acc1[j] = ops::zero();
+    for (int64_t p = 0; p < kc; ++p, a += 2 * w, b += NR) {
+        const vec a0 = ops::load(a), a1 = ops::load(a + w);
+#pragma GCC unroll 16
+        for (int j = 0; j < NR; ++j) {
+            const vec bj = ops::set1(b[j]);
+            acc0[j] = ops::fmadd(a0, bj, acc0[j]);
+            acc1[j] = ops::fmadd(a1, bj, acc1[j]);
+        }
+    }
+    const vec va = ops::set1(alpha), vb = ops::set1(beta);
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; ++j) {
+        T *cj = c + j * ldc;
+        if (beta == T(0)) {
+            ops::store(cj, ops::mul(va, acc0[j]));
+            ops::store(cj + w, ops::mul(va, acc1[j]));
+        }
+        else {
+            ops::store(cj, ops::fmadd(va, acc0[j], ops::mul(vb, ops::load(cj))));
+            ops::store(cj + w, ops::fmadd(va, acc1[j], ops::mul(vb, ops::load(cj + w))));
+        }
+    }
+}
+
+template <typename T, int NR>
+NETLIB_TARGET_AVX512 void avx512_kernel(int64_t kc, const T *a, const T *b, T alpha, T beta, T *c,
+                                        int64_t ldc) {
+    using ops = avx512_ops<T>;
+    using vec = typename ops::vec;
+    constexpr int w = ops::width;
+    vec acc0[NR], acc1[NR];
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; ++j)
+        acc0[j] = acc1[j] = ops::zero();
+    for (int64_t p = 0; p < kc; ++p, a += 2 * w, b += NR) {
+        const vec a0 = ops::load(a), a1 = ops::load(a + w);
+#pragma GCC unroll 16
+        for (int j = 0; j < NR; ++j) {
+            const vec bj = ops::set1(b[j]);
+            acc0[j] = ops::fmadd(a0, bj, acc0[j]);
+            acc1[j] = ops::fmadd(a1, bj, acc1[j]);
+        }
+    }
+    const vec va = ops::set1(alpha), vb = ops::set1(beta);
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; ++j) {
+        T *cj = c + j * ldc;
+        if (beta == T(0)) {
+            ops::store(cj, ops::mul(va, acc0[j]));
+            ops::store(cj + w, ops::mul(va, acc1[j]));
+        }
+        else {
+            ops::store(cj, ops::fmadd(va, acc0[j], ops::mul(vb, ops::load(cj))));
+            ops::store(cj + w, ops::fmadd(va, acc1[j], ops::mul(vb, ops::load(cj + w))));
+        }
+    }
+}
+
+#undef NETLIB_TARGET_AVX2
+#undef NETLIB_TARGET_AVX512
+
+#endif // NETLIB_GEMM_ENGINE_X86
+
+template <typename T>
+kernel_info<T> select_kernel() {
+#ifdef NETLIB_GEMM_ENGINE_X86
+    switch (host_isa()) {
+        case isa::avx512: return { 2 * avx512_ops<T>::width, 12, avx512_kernel<T, 12> };
+        case isa::avx2: return { 2 * avx2_ops<T>::width, 6, avx2_kernel<T, 6> };
+        default: break;
+    }
+#endif
+    constexpr int mr = 32 / sizeof(T);
+    return { mr, 4, generic_kernel<T, mr, 4> };
+}
+
+struct block_sizes {
+    int64_t mc, kc, nc;
+};
+
+// Block sizes keeping a KC x NR panel of B in half of L1, an MC x KC block of
+// A in half of L2 and a KC x NC block of B in half of L3.
+template <typename T, typename P>
+block_sizes get_block_sizes(const kernel_info<T, P> &kernel) {
+    const cache_sizes cache = host_cache_sizes();
+    const int64_t size = sizeof(P);
+    const int64_t step = std::max<int64_t>(8, kernel.kr);
+    const int64_t kc = std::max(
+        step, std::clamp<int64_t>(cache.l1 / (2 * kernel.nr * size), 64, 1024) / step * step);
+    const int64_t mc = std::clamp<int64_t>(cache.l2 / (2 * kc * size) / kernel.mr * kernel.mr,
+                                           kernel.mr, 64 * kernel.mr);
+    const int64_t nc = std::clamp<int64_t>(cache.l3 / (2 * kc * size) / kernel.nr * kernel.nr,
+                                           kernel.nr, 512 * kernel.nr);
+    return { mc, kc, nc };
+}
+
+template <typename F>
+void run_tasks(bool parallel, int64_t num_tasks, F &&f) {
+    if (parallel) {
+        host_parallel_for(num_tasks, f);
+    }
+    else {
+        for (int64_t i = 0; i < num_tasks; ++i)
+            f(i);
+    }
+}
+
+// Packs rows [i0, i0 + mb) and columns [p0, p0 + kb) of a into panels of mr
+// rows, zero-padded to a multiple of mr rows.
+template <typename T>
+void pack_a(const operand<T> &a, int64_t i0, int64_t mb, int64_t p0, int64_t kb, int64_t mr,
+            T *dst) {
+    for (int64_t ir = 0; ir < mb; ir += mr, dst += mr * kb) {
+        const int64_t rows = std::min(mr, mb - ir);
+        for (int64_t p = 0; p < kb; ++p) {
+            for (int64_t i = 0; i < rows; ++i)
+                dst[p * mr + i] = a(i0 + ir + i, p0 + p);
+            for (int64_t i = rows; i < mr; ++i)
+                dst[p * mr + i] = T(0);
+        }
+    }
+}
+
+// Packs columns [j0, j0 + nb) and rows [p0, p0 + kb) of b into one panel of
+// nb <= nr columns, zero-padded to nr columns.
+template <typename T>
+void pack_b(const operand<T> &b, int64_t p0, int64_t kb, int64_t j0, int64_t nb, int64_t nr,
+            T *dst) {
+    for (int64_t p = 0; p < kb; ++p) {
+        for (int64_t j = 0; j < nb; ++j)
+            dst[p * nr + j] = b(p0 + p, j0 + j);
+        for (int64_t j = nb; j < nr; ++j)
+            dst[p * nr + j] = T(0);
+    }
+}
+
+// Complex counterparts of pack_a and pack_b for the real kernels. Row 2i and
+// 2i + 1 of the real matrix hold the real and imaginary parts of row i of
+// alpha * a, and every complex element becomes the 2 x 2 block
+// [re -im; im re]. Row 2p and 2p + 1 of b hold the real and imaginary parts of
+// row p. Real blocks start and end on even rows and columns of k.
+template <typename R>
+void pack_a_complex(const operand<std::complex<R>> &a, std::complex<R> alpha, int64_t i0,
+                    int64_t mb, int64_t p0, int64_t kb, int64_t mr, R *dst) {
+    for (int64_t ir = 0; ir < mb; ir += mr, dst += mr * kb) {
+        const int64_t rows = std::min(mr, mb - ir);
+        for (int64_t p = 0; p < kb; p += 2) {
+            for (int64_t i = 0; i < rows; ++i) {
+                const int64_t row = i0 + ir + i;
+                const std::complex<R> v = mul_add({}, alpha, a(row / 2, (p0 + p) / 2));
+                dst[p * mr + i] = (row % 2 == 0) ? v.real() : v.imag();
+                dst[(p + 1) * mr + i] = (row % 2 == 0) ? -v.imag() : v.real();
+            }
+            for (int64_t i = rows; i < mr; ++i)
+                dst[p * mr + i] = dst[(p + 1) * mr + i] = R(0);
+        }
+    }
+}
+
+template <typename R>
+void pack_b_complex(const operand<std::complex<R>> &b, int64_t p0, int64_t kb, int64_t j0,
+                    int64_t nb, int64_t nr, R *dst) {
+    for (int64_t p = 0; p < kb; p += 2) {
+        for (int64_t j = 0; j < nb; ++j) {
+            const std::complex<R> v = b((p0 + p) / 2, j0 + j);
+            dst[p * nr + j] = v.real();
+            dst[(p + 1) * nr + j] = v.imag();
+        }
+        for (int64_t j = nb; j < nr; ++j)
+            dst[p * nr + j] = dst[(p + 1) * nr + j] = R(0);
+    }
+}
+
+/**
+ * Blocked loops around the micro-kernel for a real column-major m x n matrix
+ * C. pack_a(i0, mb, p0, kb, dst) packs an mb x kb block of A into panels of MR
+ * rows and pack_b(p0, kb, j0, nb, dst) a kb x nb block of B into one panel of
+ * NR columns. Both return the packed data, which is dst unless the operand
+ * was packed in advance, see packed_operand.
+ *
+ * finish(i0, j0, mb, nb, c_block, ldc) is called on every mc x nr block of C
+ * once its last block of k has been added, while the block is still in cache;
+ * see gemm_epilogue.
+ */
+struct no_finish {
+    template <typename R>
+    void operator()(int64_t, int64_t, int64_t, int64_t, R *, int64_t) const {}
+};
+
+template <typename R, typename P, typename PackA, typename PackB, typename Finish = no_finish>
+void blocked_gemm(const kernel_info<R, P> &kernel, int64_t m, int64_t n, int64_t k, R alpha,
+                  R beta, R *c, int64_t ldc, PackA &&pack_a, PackB &&pack_b, bool parallel,
+                  Finish &&finish = Finish{}) {
+    const block_sizes blocks = get_block_sizes(kernel);
+    const int64_t mr = kernel.mr, nr = kernel.nr;
+    const int64_t mc = blocks.mc;
+    const int64_t kc = std::min(blocks.kc, k);
+    const int64_t nc = std::min(blocks.nc, detail::round_up(n, nr));
+    const int64_t m_blocks = (m + mc - 1) / mc;
+    std::unique_ptr<P[]> b_pack(new P[kc * nc]);
+    std::vector<const P *> b_panels(nc / nr);
+
+    for (int64_t jc = 0; jc < n; jc += nc) {
+        const int64_t nb = std::min(nc, n - jc);
+        const int64_t n_panels = (nb + nr - 1) / nr;
+        // Blocks of C are split over n as well when m alone does not keep all
+        // threads busy.
+        const int64_t n_parts =
+            parallel ? std::clamp<int64_t>((host_num_threads() + m_blocks - 1) / m_blocks, 1,
+                                           n_panels)
+                     : 1;
+        for (int64_t pc = 0; pc < k; pc += kc) {
+            const int64_t kb = std::min(kc, k - pc);
+            const R beta_p = (pc == 0) ? beta : R(1);
+            const bool last = (pc + kb == k);
+            run_tasks(parallel, n_panels, [&](int64_t jp) {
+                b_panels[jp] = pack_b(pc, kb, jc + jp * nr, std::min(nr, nb - jp * nr),
+                                      b_pack.get() + jp * nr * kb);
+            });
+            run_tasks(parallel, m_blocks * n_parts, [&](int64_t task) {
+                const int64_t ic = (task / n_parts) * mc;
+                const int64_t part = task % n_parts;
+                const int64_t mb = std::min(mc, m - ic);
+                std::unique_ptr<P[]> a_pack(new P[detail::round_up(mb, mr) * kb]);
+                std::vector<R> tile(mr * nr);
+                const P *a_block = pack_a(ic, mb, pc, kb, a_pack.get());
+                for (int64_t jp = part * n_panels / n_parts; jp < (part + 1) * n_panels / n_parts;
+                     ++jp) {
+                    const int64_t j = jc + jp * nr;
+                    const int64_t nj = std::min(nr, n - j);
+                    const P *b_panel = b_panels[jp];
+                    for (int64_t ir = 0; ir < mb; ir += mr) {
+                        const int64_t ni = std::min(mr, mb - ir);
+                        const P *a_panel = a_block + ir * kb;
+                        R *c_tile = c + (ic + ir) + j * ldc;
+                        if (ni == mr && nj == nr) {
+                            kernel.run(kb, a_panel, b_panel, alpha, beta_p, c_tile, ldc);
+                        }
+                        else {
+                            kernel.run(kb, a_panel, b_panel, alpha, R(0), tile.data(), mr);
+                            for (int64_t jj = 0; jj < nj; ++jj) {
+                                for (int64_t ii = 0; ii < ni; ++ii) {
+                                    R &cij = c_tile[ii + jj * ldc];
+                                    cij = (beta_p == R(0)) ? tile[ii + jj * mr]
+                                                           : tile[ii + jj * mr] + beta_p * cij;
+                                }
+                            }
+                        }
+                    }
+                    if (last)
+                        finish(ic, j, mb, nj, c + ic + j * ldc, ldc);
+                }
+            });
+        }
+    }
+}
+
+/**
+ * C = alpha * a * b + beta * C for a real column-major C, calling finish on
+ * every block of C once it is complete, see blocked_gemm. Requires m, n and k
+ * to be positive.
+ */
+template <typename T, typename Finish>
+void gemm_finish(int64_t m, int64_t n, int64_t k, T alpha, const operand<T> &a,
+                 const operand<T> &b, T beta, T *c, int64_t ldc, Finish &&finish,
+                 bool parallel = true) {
+    const kernel_info<T> kernel = select_kernel<T>();
+    blocked_gemm(
+        kernel, m, n, k, alpha, beta, c, ldc,
+        [&](int64_t i0, int64_t mb, int64_t p0, int64_t kb, T *dst) {
+            pack_a(a, i0, mb, p0, kb, kernel.mr, dst);
+            return dst;
+        },
+        [&](int64_t p0, int64_t kb, int64_t j0, int64_t nb, T *dst) {
+            pack_b(b, p0, kb, j0, nb, kernel.nr, dst);
+            return dst;
+        },
+        parallel, finish);
+}
+
+/**
+ * C = alpha * a * b + beta * C, where a is m x k, b is k x n and C is stored by
+ * columns (c.rs == 1) or by rows (c.cs == 1). With parallel set to false the
+ * calling thread does all the work, for callers that are already parallel.
+ *
+ * A complex C is computed as the real 2m x n matrix holding its real and
+ * imaginary parts, which is the product of a 2m x 2k expansion of alpha * a and
+ * a 2k x n expansion of b, so that complex types use the same kernels and the
+ * same number of flops as the complex product.
+ */
+template <typename T>
+void gemm(int64_t m, int64_t n, int64_t k, T alpha, operand<T> a, operand<T> b, T beta,
+          output<T> c, bool parallel = true) {
+    if (m <= 0 || n <= 0)
+        return;
+    if (k <= 0 || alpha == T(0)) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i)
+                c(i, j) = (beta == T(0)) ? T(0) : beta * c(i, j);
+        }
+        return;
+    }
+    if (c.rs != 1) {
+        // C^T = b^T * a^T, with C^T stored by columns.
+        std::swap(m, n);
+        std::swap(a, b);
+        a = a.transposed();
+        b = b.transposed();
+        std::swap(c.rs, c.cs);
+    }
+    if constexpr (detail::is_complex<T>::value) {
+        using R = typename T::value_type;
+        const kernel_info<R> kernel = select_kernel<R>();
+        if (beta != T(0) && beta != T(1)) {
+            run_tasks(parallel, n, [&](int64_t j) {
+                for (int64_t i = 0; i < m; ++i)
+                    c(i, j) *= beta;
+            });
+        }
+        blocked_gemm(
+            kernel, 2 * m, n, 2 * k, R(1), (beta == T(0)) ? R(0) : R(1),
+            reinterpret_cast<R *>(c.ptr), 2 * c.cs,
+            [&](int64_t i0, int64_t mb, int64_t p0, int64_t kb, R *dst) {
+                pack_a_complex(a, alpha, i0, mb, p0, kb, kernel.mr, dst);
+                return dst;
+            },
+            [&](int64_t p0, int64_t kb, int64_t j0, int64_t nb, R *dst) {
+                pack_b_complex(b, p0, kb, j0, nb, kernel.nr, dst);
+                return dst;
+            },
+            parallel);
+    }
+    else {
+        gemm_finish(m, n, k, alpha, a, b, beta, c.ptr, c.cs, no_finish{}, parallel);
+    }
+}
+
+/**
+ * Prepacked operands. pack() stores alpha * a (which == pack_matrix::a) or
+ * alpha * b (pack_matrix::b) of an m x n x k product in the order in which
+ * blocked_gemm reads it: one block per KC columns of a or rows of b, each
+ * holding the whole operand in panels of MR rows of a or NR columns of b.
+ * gemm_packed() then reads the panels in place. The layout depends on the
+ * kernel and the block sizes chosen for the host, so it is only valid in the
+ * process that packed it. Complex operands are stored expanded to real ones as
+ * in gemm().
+ */
+template <typename R, typename P>
+int64_t packed_extent(const kernel_info<R, P> &kernel, pack_matrix which, int64_t m, int64_t n) {
+    return (which == pack_matrix::a) ? detail::round_up(m, kernel.mr)
+                                     : detail::round_up(n, kernel.nr);
+}
+
+template <typename T>
+int64_t packed_size(pack_matrix which, int64_t m, int64_t n, int64_t k) {
+    if (m <= 0 || n <= 0 || k <= 0)
+        return 0;
+    if constexpr (detail::is_complex<T>::value) {
+        const kernel_info<typename T::value_type> kernel = select_kernel<typename T::value_type>();
+        return packed_extent(kernel, which, 2 * m, n) * k;
+    }
+    else {
+        return packed_extent(select_kernel<T>(), which, m, n) * k;
+    }
+}
+
+// Calls pack_panel(i0, rows, p0, kb, dst) for every panel of the packed
+// operand, with i0 and rows counting rows of a or columns of b.
+template <typename R, typename P, typename PackPanel>
+void pack_blocks(const kernel_info<R, P> &kernel, pack_matrix which, int64_t m, int64_t n,
+                 int64_t k, P *dst, PackPanel &&pack_panel, bool parallel) {
+    const int64_t kc = std::min(get_block_sizes(kernel).kc, k);
+    const int64_t panel = (which == pack_matrix::a) ? kernel.mr : kernel.nr;
+    const int64_t extent = (which == pack_matrix::a) ? m : n;
+    const int64_t padded = packed_extent(kernel, which, m, n);
+    for (int64_t pc = 0; pc < k; pc += kc) {
+        const int64_t kb = std::min(kc, k - pc);
+        run_tasks(parallel, padded / panel, [&](int64_t ip) {
+            const int64_t i0 = ip * panel;
+            pack_panel(i0, std::min(panel, extent - i0), pc, kb, dst + pc * padded + i0 * kb);
+        });
+    }
+}
+
+// Packs alpha * x, where x is the m x k matrix a or the k x n matrix b.
+template <typename T>
+void pack(pack_matrix which, int64_t m, int64_t n, int64_t k, T alpha, const operand<T> &x,
+          T *dst, bool parallel = true) {
+    if (m <= 0 || n <= 0 || k <= 0)
+        return;
+    if constexpr (detail::is_complex<T>::value) {
+        using R = typename T::value_type;
+        const kernel_info<R> kernel = select_kernel<R>();
+        pack_blocks(
+            kernel, which, 2 * m, n, 2 * k, reinterpret_cast<R *>(dst),
+            [&](int64_t i0, int64_t rows, int64_t p0, int64_t kb, R *d) {
+                if (which == pack_matrix::a) {
+                    pack_a_complex(x, alpha, i0, rows, p0, kb, kernel.mr, d);
+                    return;
+                }
+                pack_b_complex(x, p0, kb, i0, rows, kernel.nr, d);
+                for (int64_t p = 0; p < kb; p += 2) {
+                    for (int64_t j = 0; j < rows; ++j) {
+                        const T v = alpha * T(d[p * kernel.nr + j], d[(p + 1) * kernel.nr + j]);
+                        d[p * kernel.nr + j] = v.real();
+                        d[(p + 1) * kernel.nr + j] = v.imag();
+                    }
+                }
+            },
+            parallel);
+    }
+    else {
+        const kernel_info<T> kernel = select_kernel<T>();
+        pack_blocks(
+            kernel, which, m, n, k, dst,
+            [&](int64_t i0, int64_t rows, int64_t p0, int64_t kb, T *d) {
+                const int64_t size = ((which == pack_matrix::a) ? kernel.mr : kernel.nr) * kb;
+                if (which == pack_matrix::a)
+                    pack_a(x, i0, rows, p0, kb, kernel.mr, d);
+                else
+                    pack_b(x, p0, kb, i0, rows, kernel.nr, d);
+                if (alpha != T(1)) {
+                    for (int64_t i = 0; i < size; ++i)
+                        d[i] *= alpha;
+                }
+            },
+            parallel);
+    }
+}
+
+/**
+ * C = packed * b + beta * C (which == pack_matrix::a) or
+ * C = a * packed + beta * C (pack_matrix::b) for a column-major m x n C, where
+ * packed was returned by pack() for the same m, n and k and x is the operand
+ * that was not packed.
+ */
+template <typename T>
+void gemm_packed(pack_matrix which, int64_t m, int64_t n, int64_t k, const T *packed,
+                 const operand<T> &x, T beta, T *c, int64_t ldc, bool parallel = true) {
+    if (m <= 0 || n <= 0)
+        return;
+    if (k <= 0 || (beta != T(0) && beta != T(1) && detail::is_complex<T>::value)) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i)
+                c[i + j * ldc] = (beta == T(0)) ? T(0) : beta * c[i + j * ldc];
+        }
+        if (k <= 0)
+            return;
+    }
+    if constexpr (detail::is_complex<T>::value) {
+        using R = typename T::value_type;
+        const kernel_info<R> kernel = select_kernel<R>();
+        const R *packed_r = reinterpret_cast<const R *>(packed);
+        const int64_t padded = packed_extent(kernel, which, 2 * m, n);
+        blocked_gemm(
+            kernel, 2 * m, n, 2 * k, R(1), (beta == T(0)) ? R(0) : R(1),
+            reinterpret_cast<R *>(c), 2 * ldc,
+            [&](int64_t i0, int64_t mb, int64_t p0, int64_t kb, R *dst) {
+                if (which == pack_matrix::a)
+                    return packed_r + p0 * padded + i0 * kb;
+                pack_a_complex(x, T(1), i0, mb, p0, kb, kernel.mr, dst);
+                return static_cast<const R *>(dst);
+            },
+            [&](int64_t p0, int64_t kb, int64_t j0, int64_t nb, R *dst) {
+                if (which == pack_matrix::b)
+                    return packed_r + p0 * padded + j0 * kb;
+                pack_b_complex(x, p0, kb, j0, nb, kernel.nr, dst);
+                return static_cast<const R *>(dst);
+            },
+            parallel);
+    }
+    else {
+        const kernel_info<T> kernel = select_kernel<T>();
+        const int64_t padded = packed_extent(kernel, which, m, n);
+        blocked_gemm(
+            kernel, m, n, k, T(1), beta, c, ldc,
+            [&](int64_t i0, int64_t mb, int64_t p0, int64_t kb, T *dst) {
+                if (which == pack_matrix::a)
+                    return packed + p0 * padded + i0 * kb;
+                pack_a(x, i0, mb, p0, kb, kernel.mr, dst);
+                return static_cast<const T *>(dst);
+            },
+            [&](int64_t p0, int64_t kb, int64_t j0, int64_t nb, T *dst) {
+                if (which == pack_matrix::b)
+                    return packed + p0 * padded + j0 * kb;
+                pack_b(x, p0, kb, j0, nb, kernel.nr, dst);
+                return static_cast<const T *>(dst);
+            },
+            parallel);
+    }
+}
+
+// C = alpha * A * B + beta * C (left) or alpha * B * A + beta * C (right) with
+// A symmetric.
+template <typename T>
+void symm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, int64_t m, int64_t n, T alpha,
+          const T *a, int64_t lda, const T *b, int64_t ldb, T beta, T *c, int64_t ldc) {
+    const operand<T> sym = symmetric_operand(layout, upper_lower, a, lda);
+    const operand<T> gen = general_operand(layout, transpose::nontrans, b, ldb);
+    if (left_right == side::left)
+        gemm(m, n, m, alpha, sym, gen, beta, output<T>(layout, c, ldc));
+    else
+        gemm(m, n, n, alpha, gen, sym, beta, output<T>(layout, c, ldc));
+}
+
+// Triangle of C = alpha * op(A) * op(A)^T + beta * C. C is split into block
+// columns; the part of a block column outside of the diagonal block goes
+// directly to the engine and the diagonal block is computed in full into a
+// temporary.
+template <typename T>
+void syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n, int64_t k, T alpha,
+          const T *a, int64_t lda, T beta, T *c, int64_t ldc) {
+    const operand<T> op_a = general_operand(layout, trans, a, lda);
+    const operand<T> op_at = op_a.transposed();
+    const output<T> c_out(layout, c, ldc);
+    const bool lower = (upper_lower == uplo::lower);
+    std::vector<T> diag_block(level3_block * level3_block);
+    for (int64_t j0 = 0; j0 < n; j0 += level3_block) {
+        const int64_t jb = std::min(level3_block, n - j0);
+        const output<T> tmp(diag_block.data(), 1, jb);
+        gemm(jb, jb, k, alpha, op_a.block(j0, 0), op_at.block(0, j0), T(0), tmp);
+        for (int64_t j = 0; j < jb; ++j) {
+            for (int64_t i = lower ? j : 0; i < (lower ? jb : j + 1); ++i) {
+                T &cij = c_out(j0 + i, j0 + j);
+                cij = (beta == T(0)) ? tmp(i, j) : tmp(i, j) + beta * cij;
+            }
+        }
+        if (lower) {
+            gemm(n - j0 - jb, jb, k, alpha, op_a.block(j0 + jb, 0), op_at.block(0, j0), beta,
+                 c_out.block(j0 + jb, j0));
+        }
+        else {
+            gemm(j0, jb, k, alpha, op_a, op_at.block(0, j0), beta, c_out.block(0, j0));
+        }
+    }
+}
+
+// B = alpha * op(A) * B (left) or alpha * B * op(A) (right) with A
+// triangular. B is copied, then every block row (left) or block column (right)
+// of the result is computed from the nonzero part of op(A) only.
+template <typename T>
+void trmm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+          int64_t m, int64_t n, T alpha, const T *a, int64_t lda, T *b, int64_t ldb) {
+    const operand<T> tri = triangular_operand(layout, upper_lower, trans, unit_diag, a, lda);
+    const output<T> b_out(layout, b, ldb);
+    std::vector<T> b_copy(m * n);
+    const output<T> copy(b_copy.data(), 1, m);
+    host_parallel_for(n, [&](int64_t j) {
+        for (int64_t i = 0; i < m; ++i)
+            copy(i, j) = b_out(i, j);
+    });
+    const operand<T> x = copy.as_operand();
+    if (left_right == side::left) {
+        for (int64_t i0 = 0; i0 < m; i0 += level3_block) {
+            const int64_t ib = std::min(level3_block, m - i0);
+            const int64_t p0 = tri.lower ? 0 : i0;
+            const int64_t p1 = tri.lower ? i0 + ib : m;
+            gemm(ib, n, p1 - p0, alpha, tri.block(i0, p0), x.block(p0, 0), T(0),
+                 b_out.block(i0, 0));
+        }
+    }
+    else {
+        for (int64_t j0 = 0; j0 < n; j0 += level3_block) {
+            const int64_t jb = std::min(level3_block, n - j0);
+            const int64_t p0 = tri.lower ? j0 : 0;
+            const int64_t p1 = tri.lower ? n : j0 + jb;
+            gemm(m, jb, p1 - p0, alpha, x.block(0, p0), tri.block(p0, j0), T(0),
+                 b_out.block(0, j0));
+        }
+    }
+}
+
+/**
+ * Solves op(A) * X = alpha * B (left) or X * op(A) = alpha * B (right) with A
+ * triangular, overwriting B with X. The right-hand side case is solved as
+ * op(A)^T * X^T = alpha * B^T. Diagonal blocks are copied to a dense buffer
+ * and solved by column-oriented substitution in parallel over the columns of
+ * B, and the rows of B that remain to be solved are updated with the engine.
+ */
+template <typename T>
+void trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+          int64_t m, int64_t n, T alpha, const T *a, int64_t lda, T *b, int64_t ldb) {
+    operand<T> tri = triangular_operand(layout, upper_lower, trans, unit_diag, a, lda);
+    output<T> x(layout, b, ldb);
+    if (left_right == side::right) {
+        tri = tri.transposed();
+        std::swap(x.rs, x.cs);
+        std::swap(m, n);
+    }
+    if (alpha != T(1)) {
+        host_parallel_for(n, [&](int64_t j) {
+            for (int64_t i = 0; i < m; ++i)
+                x(i, j) = (alpha == T(0)) ? T(0) : alpha * x(i, j);
+        });
+        if (alpha == T(0))
+            return;
+    }
+    const int64_t num_blocks = (m + trsm_block - 1) / trsm_block;
+    std::vector<T> diag_block(trsm_block * trsm_block);
+    for (int64_t blk = 0; blk < num_blocks; ++blk) {
+        const int64_t i0 = (tri.lower ? blk : num_blocks - 1 - blk) * trsm_block;
+        const int64_t ib = std::min(trsm_block, m - i0);
+        for (int64_t p = 0; p < ib; ++p) {
+            for (int64_t i = 0; i < ib; ++i)
+                diag_block[i + p * ib] = tri(i0 + i, i0 + p);
+        }
+        host_parallel_for(n, [&](int64_t j) {
+            std::vector<T> xj(ib);
+            for (int64_t i = 0; i < ib; ++i)
+                xj[i] = x(i0 + i, j);
+            for (int64_t idx = 0; idx < ib; ++idx) {
+                const int64_t p = tri.lower ? idx : ib - 1 - idx;
+                const T *d = diag_block.data() + p * ib;
+                if (!tri.unit)
+                    xj[p] /= d[p];
+                const T xp = -xj[p];
+                for (int64_t i = tri.lower ? p + 1 : 0; i < (tri.lower ? ib : p); ++i)
+                    xj[i] = mul_add(xj[i], d[i], xp);
+            }
+            for (int64_t i = 0; i < ib; ++i)
+                x(i0 + i, j) = xj[i];
+        });
+        if (tri.lower) {
+            gemm(m - i0 - ib, n, ib, T(-1), tri.block(i0 + ib, i0), x.as_operand().block(i0, 0),
+                 T(1), x.block(i0 + ib, 0));
+        }
+        else {
+            gemm(i0, n, ib, T(-1), tri.block(0, i0), x.as_operand().block(i0, 0), T(1), x);
+        }
+    }
+}
+
+} // namespace gemm_engine
+
+template <typename T>
+void engine_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb, T beta,
+                 T *c, int64_t ldc, bool parallel = true) {
+    gemm_engine::gemm(m, n, k, alpha, gemm_engine::general_operand(layout, transa, a, lda),
+                      gemm_engine::general_operand(layout, transb, b, ldb), beta,
+                      gemm_engine::output<T>(layout, c, ldc), parallel);
+}
+
+template <typename T>
+void host_symm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, int64_t m, int64_t n,
+               T alpha, const T *a, int64_t lda, const T *b, int64_t ldb, T beta, T *c,
+               int64_t ldc) {
+    if (use_gemm_engine(m, n, left_right == side::left ? m : n))
+        gemm_engine::symm(layout, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc);
+    else
+        cblas_symm(layout, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <typename T>
+void host_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+               T alpha, const T *a, int64_t lda, T beta, T *c, int64_t ldc) {
+    if (use_gemm_engine(n, n, k))
+        gemm_engine::syrk(layout, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+    else
+        cblas_syrk(layout, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+}
+
+template <typename T>
+void host_trmm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+               diag unit_diag, int64_t m, int64_t n, T alpha, const T *a, int64_t lda, T *b,
+               int64_t ldb) {
+    if (use_gemm_engine(m, n, left_right == side::left ? m : n))
+        gemm_engine::trmm(layout, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                          b, ldb);
+    else
+        cblas_trmm(layout, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                   ldb);
+}
+
+template <typename T>
+void host_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+               diag unit_diag, int64_t m, int64_t n, T alpha, const T *a, int64_t lda, T *b,
+               int64_t ldb) {
+    if (use_gemm_engine(m, n, left_right == side::left ? m : n))
+        gemm_engine::trsm(layout, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                          b, ldb);
+    else
+        cblas_trsm(layout, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                   ldb);
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_GEMM_ENGINE_HPP_
@@ -24,6 +24,8 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_fused.hpp"
+#include "netlib_threaded.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 
@@ -21,72 +21,62 @@
 
 void asum(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
           sycl::buffer<float, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
-        host_task<class netlib_sasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_sasum((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
-        });
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_sasum>(
+            cgh, [=]() { accessor_result[0] = host_asum(n, accessor_x.GET_MULTI_PTR, incx); });
     });
 }
 
 void asum(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
           sycl::buffer<double, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
-        host_task<class netlib_dasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dasum((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
-        });
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_dasum>(
+            cgh, [=]() { accessor_result[0] = host_asum(n, accessor_x.GET_MULTI_PTR, incx); });
     });
 }
 
 void asum(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<float, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
-        host_task<class netlib_scasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_scasum((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
-        });
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_scasum>(
+            cgh, [=]() { accessor_result[0] = host_asum(n, accessor_x.GET_MULTI_PTR, incx); });
     });
 }
 
 void asum(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<double, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
-        host_task<class netlib_dzasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dzasum((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
-        });
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_dzasum>(
+            cgh, [=]() { accessor_result[0] = host_asum(n, accessor_x.GET_MULTI_PTR, incx); });
     });
 }
 
 void axpy(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
           sycl::buffer<float, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_saxpy>(cgh, [=]() {
-            ::cblas_saxpy((const int)n, (const float)alpha, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, accessor_y.GET_MULTI_PTR, (const int)incy);
+            host_axpy(n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
 
 void axpy(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
           sycl::buffer<double, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_daxpy>(cgh, [=]() {
-            ::cblas_daxpy((const int)n, (const double)alpha, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, accessor_y.GET_MULTI_PTR, (const int)incy);
+            host_axpy(n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -94,12 +84,11 @@ void axpy(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &
 void axpy(sycl::queue &queue, int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_caxpy>(cgh, [=]() {
-            ::cblas_caxpy((const int)n, (const void *)&alpha, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, accessor_y.GET_MULTI_PTR, (const int)incy);
+            host_axpy(n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -107,12 +96,11 @@ void axpy(sycl::queue &queue, int64_t n, std::complex<float> alpha,
 void axpy(sycl::queue &queue, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zaxpy>(cgh, [=]() {
-            ::cblas_zaxpy((const int)n, (const void *)&alpha, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, accessor_y.GET_MULTI_PTR, (const int)incy);
+            host_axpy(n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -161,9 +149,9 @@ void axpby(sycl::queue &queue, int64_t n, std::complex<double> alpha,
 
 void copy(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
           sycl::buffer<float, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_scopy>(cgh, [=]() {
             ::cblas_scopy((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy);
@@ -173,9 +161,9 @@ void copy(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx
 
 void copy(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
           sycl::buffer<double, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_dcopy>(cgh, [=]() {
             ::cblas_dcopy((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy);
@@ -185,9 +173,9 @@ void copy(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t inc
 
 void copy(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_ccopy>(cgh, [=]() {
             ::cblas_ccopy((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy);
@@ -197,9 +185,9 @@ void copy(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x
 
 void copy(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zcopy>(cgh, [=]() {
             ::cblas_zcopy((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy);
@@ -209,38 +197,36 @@ void copy(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &
 
 void dot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_sdot>(cgh, [=]() {
             accessor_result[0] =
-                ::cblas_sdot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                             accessor_y.GET_MULTI_PTR, (const int)incy);
+                host_dot(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
 
 void dot(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_ddot>(cgh, [=]() {
             accessor_result[0] =
-                ::cblas_ddot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                             accessor_y.GET_MULTI_PTR, (const int)incy);
+                host_dot(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
 
 void dot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<double, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_dsdot>(cgh, [=]() {
             accessor_result[0] =
                 ::cblas_dsdot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -252,14 +238,13 @@ void dot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
 void dotc(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<float>, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::read_write>(cgh, result);
         host_task<class netlib_cdotc>(cgh, [=]() {
-            ::cblas_cdotc_sub((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                              accessor_y.GET_MULTI_PTR, (const int)incy,
-                              accessor_result.GET_MULTI_PTR);
+            accessor_result[0] =
+                host_dotc(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -267,14 +252,13 @@ void dotc(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x
 void dotc(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<double>, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::read_write>(cgh, result);
         host_task<class netlib_zdotc>(cgh, [=]() {
-            ::cblas_zdotc_sub((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                              accessor_y.GET_MULTI_PTR, (const int)incy,
-                              accessor_result.GET_MULTI_PTR);
+            accessor_result[0] =
+                host_dotc(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -282,14 +266,13 @@ void dotc(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &
 void dotu(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<float>, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::read_write>(cgh, result);
         host_task<class netlib_cdotu>(cgh, [=]() {
-            ::cblas_cdotu_sub((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                              accessor_y.GET_MULTI_PTR, (const int)incy,
-                              accessor_result.GET_MULTI_PTR);
+            accessor_result[0] =
+                host_dotu(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -297,23 +280,22 @@ void dotu(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x
 void dotu(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<double>, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::read_write>(cgh, result);
         host_task<class netlib_zdotu>(cgh, [=]() {
-            ::cblas_zdotu_sub((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
-                              accessor_y.GET_MULTI_PTR, (const int)incy,
-                              accessor_result.GET_MULTI_PTR);
+            accessor_result[0] =
+                host_dotu(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
 
 void iamin(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
            sycl::buffer<int64_t, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_isamin>(cgh, [=]() {
             accessor_result[0] = ::cblas_isamin((int)n, accessor_x.GET_MULTI_PTR, (int)incx);
         });
@@ -322,9 +304,9 @@ void iamin(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t inc
 
 void iamin(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
            sycl::buffer<int64_t, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.template get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.template get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_idamin>(cgh, [=]() {
             accessor_result[0] = ::cblas_idamin((int)n, accessor_x.GET_MULTI_PTR, (int)incx);
         });
@@ -333,9 +315,9 @@ void iamin(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t in
 
 void iamin(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
            sycl::buffer<int64_t, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_icamin>(cgh, [=]() {
             accessor_result[0] = ::cblas_icamin((int)n, accessor_x.GET_MULTI_PTR, (int)incx);
         });
@@ -344,9 +326,9 @@ void iamin(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &
 
 void iamin(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
            sycl::buffer<int64_t, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_izamin>(cgh, [=]() {
             accessor_result[0] = ::cblas_izamin((int)n, accessor_x.GET_MULTI_PTR, (int)incx);
         });
@@ -355,9 +337,9 @@ void iamin(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1>
 
 void iamax(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
            sycl::buffer<int64_t, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_isamax>(cgh, [=]() {
             accessor_result[0] = ::cblas_isamax((int)n, accessor_x.GET_MULTI_PTR, (int)incx);
         });
@@ -366,9 +348,9 @@ void iamax(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t inc
 
 void iamax(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
            sycl::buffer<int64_t, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_idamax>(cgh, [=]() {
             accessor_result[0] = ::cblas_idamax((int)n, accessor_x.GET_MULTI_PTR, (int)incx);
         });
@@ -377,9 +359,9 @@ void iamax(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t in
 
 void iamax(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
            sycl::buffer<int64_t, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_icamax>(cgh, [=]() {
             accessor_result[0] = ::cblas_icamax((int)n, accessor_x.GET_MULTI_PTR, (int)incx);
         });
@@ -388,9 +370,9 @@ void iamax(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &
 
 void iamax(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
            sycl::buffer<int64_t, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_izamax>(cgh, [=]() {
             accessor_result[0] = ::cblas_izamax((int)n, accessor_x.GET_MULTI_PTR, (int)incx);
         });
@@ -399,57 +381,49 @@ void iamax(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1>
 
 void nrm2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
           sycl::buffer<float, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.template get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.template get_access<sycl::access::mode::write>(cgh);
-        host_task<class netlib_snrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_snrm2((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
-        });
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_snrm2>(
+            cgh, [=]() { accessor_result[0] = host_nrm2(n, accessor_x.GET_MULTI_PTR, incx); });
     });
 }
 
 void nrm2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
           sycl::buffer<double, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
-        host_task<class netlib_dnrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dnrm2((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
-        });
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_dnrm2>(
+            cgh, [=]() { accessor_result[0] = host_nrm2(n, accessor_x.GET_MULTI_PTR, incx); });
     });
 }
 
 void nrm2(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<float, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
-        host_task<class netlib_scnrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_scnrm2((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
-        });
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_scnrm2>(
+            cgh, [=]() { accessor_result[0] = host_nrm2(n, accessor_x.GET_MULTI_PTR, incx); });
     });
 }
 
 void nrm2(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<double, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
-        host_task<class netlib_dznrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dznrm2((const int)n, accessor_x.GET_MULTI_PTR, (const int)std::abs(incx));
-        });
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_dznrm2>(
+            cgh, [=]() { accessor_result[0] = host_nrm2(n, accessor_x.GET_MULTI_PTR, incx); });
     });
 }
 
 void rot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
          sycl::buffer<float, 1> &y, int64_t incy, float c, float s) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_srot>(cgh, [=]() {
             ::cblas_srot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                          accessor_y.GET_MULTI_PTR, (const int)incy, (const float)c, (const float)s);
@@ -459,9 +433,9 @@ void rot(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
 
 void rot(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
          sycl::buffer<double, 1> &y, int64_t incy, double c, double s) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_drot>(cgh, [=]() {
             ::cblas_drot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                          accessor_y.GET_MULTI_PTR, (const int)incy, (const float)c, (const float)s);
@@ -471,9 +445,9 @@ void rot(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx
 
 void rot(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
          sycl::buffer<std::complex<float>, 1> &y, int64_t incy, float c, float s) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_csrot>(cgh, [=]() {
             ::cblas_csrot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy, (const float)c,
@@ -484,9 +458,9 @@ void rot(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
 
 void rot(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
          sycl::buffer<std::complex<double>, 1> &y, int64_t incy, double c, double s) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zdrot>(cgh, [=]() {
             ::cblas_zdrot((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy, (const double)c,
@@ -497,11 +471,11 @@ void rot(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x
 
 void rotg(sycl::queue &queue, sycl::buffer<float, 1> &a, sycl::buffer<float, 1> &b,
           sycl::buffer<float, 1> &c, sycl::buffer<float, 1> &s) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_s = s.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        auto accessor_s = get_access<sycl::access::mode::read_write>(cgh, s);
         host_task<class netlib_srotg>(cgh, [=]() {
             ::cblas_srotg(accessor_a.GET_MULTI_PTR, accessor_b.GET_MULTI_PTR,
                           accessor_c.GET_MULTI_PTR, accessor_s.GET_MULTI_PTR);
@@ -511,11 +485,11 @@ void rotg(sycl::queue &queue, sycl::buffer<float, 1> &a, sycl::buffer<float, 1>
 
 void rotg(sycl::queue &queue, sycl::buffer<double, 1> &a, sycl::buffer<double, 1> &b,
           sycl::buffer<double, 1> &c, sycl::buffer<double, 1> &s) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_s = s.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        auto accessor_s = get_access<sycl::access::mode::read_write>(cgh, s);
         host_task<class netlib_drotg>(cgh, [=]() {
             ::cblas_drotg(accessor_a.GET_MULTI_PTR, accessor_b.GET_MULTI_PTR,
                           accessor_c.GET_MULTI_PTR, accessor_s.GET_MULTI_PTR);
@@ -526,11 +500,11 @@ void rotg(sycl::queue &queue, sycl::buffer<double, 1> &a, sycl::buffer<double, 1
 void rotg(sycl::queue &queue, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &b, sycl::buffer<float, 1> &c,
           sycl::buffer<std::complex<float>, 1> &s) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_s = s.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        auto accessor_s = get_access<sycl::access::mode::read_write>(cgh, s);
         host_task<class netlib_crotg>(cgh, [=]() {
             ::cblas_crotg(accessor_a.GET_MULTI_PTR, accessor_b.GET_MULTI_PTR,
                           accessor_c.GET_MULTI_PTR, accessor_s.GET_MULTI_PTR);
@@ -541,11 +515,11 @@ void rotg(sycl::queue &queue, sycl::buffer<std::complex<float>, 1> &a,
 void rotg(sycl::queue &queue, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &b, sycl::buffer<double, 1> &c,
           sycl::buffer<std::complex<double>, 1> &s) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_s = s.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        auto accessor_s = get_access<sycl::access::mode::read_write>(cgh, s);
         host_task<class netlib_zrotg>(cgh, [=]() {
             ::cblas_zrotg(accessor_a.GET_MULTI_PTR, accessor_b.GET_MULTI_PTR,
                           accessor_c.GET_MULTI_PTR, accessor_s.GET_MULTI_PTR);
@@ -555,10 +529,10 @@ void rotg(sycl::queue &queue, sycl::buffer<std::complex<double>, 1> &a,
 
 void rotm(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
           sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &param) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_param = param.get_access<sycl::access::mode::read>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
+        auto accessor_param = get_access<sycl::access::mode::read>(cgh, param);
         host_task<class netlib_srotm>(cgh, [=]() {
             ::cblas_srotm((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy, accessor_param.GET_MULTI_PTR);
@@ -568,10 +542,10 @@ void rotm(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx
 
 void rotm(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
           sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &param) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_param = param.get_access<sycl::access::mode::read>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
+        auto accessor_param = get_access<sycl::access::mode::read>(cgh, param);
         host_task<class netlib_drotm>(cgh, [=]() {
             ::cblas_drotm((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy, accessor_param.GET_MULTI_PTR);
@@ -581,11 +555,11 @@ void rotm(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t inc
 
 void rotmg(sycl::queue &queue, sycl::buffer<float, 1> &d1, sycl::buffer<float, 1> &d2,
            sycl::buffer<float, 1> &x1, float y1, sycl::buffer<float, 1> &param) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_d1 = d1.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_d2 = d2.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_x1 = x1.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_param = param.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_d1 = get_access<sycl::access::mode::read_write>(cgh, d1);
+        auto accessor_d2 = get_access<sycl::access::mode::read_write>(cgh, d2);
+        auto accessor_x1 = get_access<sycl::access::mode::read_write>(cgh, x1);
+        auto accessor_param = get_access<sycl::access::mode::read_write>(cgh, param);
         host_task<class netlib_srotmg>(cgh, [=]() {
             ::cblas_srotmg(accessor_d1.GET_MULTI_PTR, accessor_d2.GET_MULTI_PTR,
                            accessor_x1.GET_MULTI_PTR, (float)y1, accessor_param.GET_MULTI_PTR);
@@ -595,11 +569,11 @@ void rotmg(sycl::queue &queue, sycl::buffer<float, 1> &d1, sycl::buffer<float, 1
 
 void rotmg(sycl::queue &queue, sycl::buffer<double, 1> &d1, sycl::buffer<double, 1> &d2,
            sycl::buffer<double, 1> &x1, double y1, sycl::buffer<double, 1> &param) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_d1 = d1.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_d2 = d2.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_x1 = x1.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_param = param.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_d1 = get_access<sycl::access::mode::read_write>(cgh, d1);
+        auto accessor_d2 = get_access<sycl::access::mode::read_write>(cgh, d2);
+        auto accessor_x1 = get_access<sycl::access::mode::read_write>(cgh, x1);
+        auto accessor_param = get_access<sycl::access::mode::read_write>(cgh, param);
         host_task<class netlib_drotmg>(cgh, [=]() {
             ::cblas_drotmg(accessor_d1.GET_MULTI_PTR, accessor_d2.GET_MULTI_PTR,
                            accessor_x1.GET_MULTI_PTR, (double)y1, accessor_param.GET_MULTI_PTR);
@@ -608,8 +582,8 @@ void rotmg(sycl::queue &queue, sycl::buffer<double, 1> &d1, sycl::buffer<double,
 }
 
 void scal(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_sscal>(cgh, [=]() {
             ::cblas_sscal((const int)n, (const float)alpha, accessor_x.GET_MULTI_PTR,
                           (const int)std::abs(incx));
@@ -618,8 +592,8 @@ void scal(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x,
 }
 
 void scal(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_dscal>(cgh, [=]() {
             ::cblas_dscal((const int)n, (const double)alpha, accessor_x.GET_MULTI_PTR,
                           (const int)std::abs(incx));
@@ -629,8 +603,8 @@ void scal(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &
 
 void scal(sycl::queue &queue, int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_cscal>(cgh, [=]() {
             ::cblas_cscal((const int)n, (const void *)&alpha, accessor_x.GET_MULTI_PTR,
                           (const int)std::abs(incx));
@@ -640,8 +614,8 @@ void scal(sycl::queue &queue, int64_t n, std::complex<float> alpha,
 
 void scal(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_csscal>(cgh, [=]() {
             ::cblas_csscal((const int)n, (const float)alpha, accessor_x.GET_MULTI_PTR,
                            (const int)std::abs(incx));
@@ -651,8 +625,8 @@ void scal(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<std::complex<
 
 void scal(sycl::queue &queue, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_zscal>(cgh, [=]() {
             ::cblas_zscal((const int)n, (const void *)&alpha, accessor_x.GET_MULTI_PTR,
                           (const int)std::abs(incx));
@@ -662,8 +636,8 @@ void scal(sycl::queue &queue, int64_t n, std::complex<double> alpha,
 
 void scal(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_zdscal>(cgh, [=]() {
             ::cblas_zdscal((const int)n, (const double)alpha, accessor_x.GET_MULTI_PTR,
                            (const int)std::abs(incx));
@@ -673,10 +647,10 @@ void scal(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<std::complex
 
 void sdsdot(sycl::queue &queue, int64_t n, float sb, sycl::buffer<float, 1> &x, int64_t incx,
             sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &result) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_result = result.get_access<sycl::access::mode::write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
         host_task<class netlib_sdsdot>(cgh, [=]() {
             accessor_result[0] =
                 ::cblas_sdsdot((const int)n, (const float)sb, accessor_x.GET_MULTI_PTR,
@@ -687,9 +661,9 @@ void sdsdot(sycl::queue &queue, int64_t n, float sb, sycl::buffer<float, 1> &x,
 
 void swap(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
           sycl::buffer<float, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_sswap>(cgh, [=]() {
             ::cblas_sswap((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy);
@@ -699,9 +673,9 @@ void swap(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx
 
 void swap(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
           sycl::buffer<double, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_dswap>(cgh, [=]() {
             ::cblas_dswap((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy);
@@ -711,9 +685,9 @@ void swap(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t inc
 
 void swap(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_cswap>(cgh, [=]() {
             ::cblas_cswap((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy);
@@ -723,9 +697,9 @@ void swap(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x
 
 void swap(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zswap>(cgh, [=]() {
             ::cblas_zswap((const int)n, accessor_x.GET_MULTI_PTR, (const int)incx,
                           accessor_y.GET_MULTI_PTR, (const int)incy);
@@ -733,6 +707,96 @@ void swap(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &
     });
 }
 
+void axpy_dot(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+              sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
+        auto accessor_z = get_access<sycl::access::mode::read>(cgh, z);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_saxpy_dot>(cgh, [=]() {
+            accessor_result[0] =
+                host_axpy_dot(n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR,
+                              incy, accessor_z.GET_MULTI_PTR, incz);
+        });
+    });
+}
+
+void axpy_dot(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x, int64_t incx,
+              sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
+        auto accessor_z = get_access<sycl::access::mode::read>(cgh, z);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_daxpy_dot>(cgh, [=]() {
+            accessor_result[0] =
+                host_axpy_dot(n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR,
+                              incy, accessor_z.GET_MULTI_PTR, incz);
+        });
+    });
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x, int64_t incx,
+                float beta, sycl::buffer<float, 1> &y, int64_t incy,
+                sycl::buffer<float, 1> &result) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_saxpby_nrm2>(cgh, [=]() {
+            accessor_result[0] = host_axpby_nrm2(n, alpha, accessor_x.GET_MULTI_PTR, incx, beta,
+                                                 accessor_y.GET_MULTI_PTR, incy);
+        });
+    });
+}
+
+void axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
+                int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy,
+                sycl::buffer<double, 1> &result) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_daxpby_nrm2>(cgh, [=]() {
+            accessor_result[0] = host_axpby_nrm2(n, alpha, accessor_x.GET_MULTI_PTR, incx, beta,
+                                                 accessor_y.GET_MULTI_PTR, incy);
+        });
+    });
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
+          sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &z, int64_t incz,
+          sycl::buffer<float, 1> &result) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_z = get_access<sycl::access::mode::read>(cgh, z);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_sdot2>(cgh, [=]() {
+            host_dot2(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy,
+                      accessor_z.GET_MULTI_PTR, incz, accessor_result.GET_MULTI_PTR);
+        });
+    });
+}
+
+void dot2(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
+          sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &z, int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_z = get_access<sycl::access::mode::read>(cgh, z);
+        auto accessor_result = get_access<sycl::access::mode::write>(cgh, result);
+        host_task<class netlib_ddot2>(cgh, [=]() {
+            host_dot2(n, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR, incy,
+                      accessor_z.GET_MULTI_PTR, incz, accessor_result.GET_MULTI_PTR);
+        });
+    });
+}
+
 // USM APIs
 
 sycl::event asum(sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
@@ -742,8 +806,7 @@ sycl::event asum(sycl::queue &queue, int64_t n, const float *x, int64_t incx, fl
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_sasum((const int)n, x, (const int)std::abs(incx)); });
+        host_task<class netlib_sasum_usm>(cgh, [=]() { result[0] = host_asum(n, x, incx); });
     });
     return done;
 }
@@ -755,8 +818,7 @@ sycl::event asum(sycl::queue &queue, int64_t n, const double *x, int64_t incx, d
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_dasum((const int)n, x, (const int)std::abs(incx)); });
+        host_task<class netlib_dasum_usm>(cgh, [=]() { result[0] = host_asum(n, x, incx); });
     });
     return done;
 }
@@ -768,8 +830,7 @@ sycl::event asum(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_scasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_scasum((const int)n, x, (const int)std::abs(incx)); });
+        host_task<class netlib_scasum_usm>(cgh, [=]() { result[0] = host_asum(n, x, incx); });
     });
     return done;
 }
@@ -781,8 +842,7 @@ sycl::event asum(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dzasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_dzasum((const int)n, x, (const int)std::abs(incx)); });
+        host_task<class netlib_dzasum_usm>(cgh, [=]() { result[0] = host_asum(n, x, incx); });
     });
     return done;
 }
@@ -794,9 +854,7 @@ sycl::event axpy(sycl::queue &queue, int64_t n, float alpha, const float *x, int
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_saxpy_usm>(cgh, [=]() {
-            ::cblas_saxpy((const int)n, (const float)alpha, x, (const int)incx, y, (const int)incy);
-        });
+        host_task<class netlib_saxpy_usm>(cgh, [=]() { host_axpy(n, alpha, x, incx, y, incy); });
     });
     return done;
 }
@@ -808,10 +866,7 @@ sycl::event axpy(sycl::queue &queue, int64_t n, double alpha, const double *x, i
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_daxpy_usm>(cgh, [=]() {
-            ::cblas_daxpy((const int)n, (const double)alpha, x, (const int)incx, y,
-                          (const int)incy);
-        });
+        host_task<class netlib_daxpy_usm>(cgh, [=]() { host_axpy(n, alpha, x, incx, y, incy); });
     });
     return done;
 }
@@ -824,10 +879,7 @@ sycl::event axpy(sycl::queue &queue, int64_t n, std::complex<float> alpha,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_caxpy_usm>(cgh, [=]() {
-            ::cblas_caxpy((const int)n, (const void *)&alpha, x, (const int)incx, y,
-                          (const int)incy);
-        });
+        host_task<class netlib_caxpy_usm>(cgh, [=]() { host_axpy(n, alpha, x, incx, y, incy); });
     });
     return done;
 }
@@ -840,10 +892,7 @@ sycl::event axpy(sycl::queue &queue, int64_t n, std::complex<double> alpha,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zaxpy_usm>(cgh, [=]() {
-            ::cblas_zaxpy((const int)n, (const void *)&alpha, x, (const int)incx, y,
-                          (const int)incy);
-        });
+        host_task<class netlib_zaxpy_usm>(cgh, [=]() { host_axpy(n, alpha, x, incx, y, incy); });
     });
     return done;
 }
@@ -955,9 +1004,7 @@ sycl::event dot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, con
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sdot_usm>(cgh, [=]() {
-            result[0] = ::cblas_sdot((const int)n, x, (const int)incx, y, (const int)incy);
-        });
+        host_task<class netlib_sdot_usm>(cgh, [=]() { result[0] = host_dot(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -969,9 +1016,7 @@ sycl::event dot(sycl::queue &queue, int64_t n, const double *x, int64_t incx, co
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ddot_usm>(cgh, [=]() {
-            result[0] = ::cblas_ddot((const int)n, x, (const int)incx, y, (const int)incy);
-        });
+        host_task<class netlib_ddot_usm>(cgh, [=]() { result[0] = host_dot(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -998,9 +1043,8 @@ sycl::event dotc(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cdotc_usm>(cgh, [=]() {
-            ::cblas_cdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
-        });
+        host_task<class netlib_cdotc_usm>(
+            cgh, [=]() { result[0] = host_dotc(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -1013,9 +1057,8 @@ sycl::event dotc(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zdotc_usm>(cgh, [=]() {
-            ::cblas_zdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
-        });
+        host_task<class netlib_zdotc_usm>(
+            cgh, [=]() { result[0] = host_dotc(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -1028,9 +1071,8 @@ sycl::event dotu(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cdotu_usm>(cgh, [=]() {
-            ::cblas_cdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
-        });
+        host_task<class netlib_cdotu_usm>(
+            cgh, [=]() { result[0] = host_dotu(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -1043,9 +1085,8 @@ sycl::event dotu(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zdotu_usm>(cgh, [=]() {
-            ::cblas_zdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
-        });
+        host_task<class netlib_zdotu_usm>(
+            cgh, [=]() { result[0] = host_dotu(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -1161,8 +1202,7 @@ sycl::event nrm2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, fl
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_snrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_snrm2((const int)n, x, (const int)std::abs(incx)); });
+        host_task<class netlib_snrm2_usm>(cgh, [=]() { result[0] = host_nrm2(n, x, incx); });
     });
     return done;
 }
@@ -1174,8 +1214,7 @@ sycl::event nrm2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, d
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dnrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_dnrm2((const int)n, x, (const int)std::abs(incx)); });
+        host_task<class netlib_dnrm2_usm>(cgh, [=]() { result[0] = host_nrm2(n, x, incx); });
     });
     return done;
 }
@@ -1187,8 +1226,7 @@ sycl::event nrm2(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_scnrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_scnrm2((const int)n, x, (const int)std::abs(incx)); });
+        host_task<class netlib_scnrm2_usm>(cgh, [=]() { result[0] = host_nrm2(n, x, incx); });
     });
     return done;
 }
@@ -1200,8 +1238,7 @@ sycl::event nrm2(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dznrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_dznrm2((const int)n, x, (const int)std::abs(incx)); });
+        host_task<class netlib_dznrm2_usm>(cgh, [=]() { result[0] = host_nrm2(n, x, incx); });
     });
     return done;
 }
@@ -1523,3 +1560,93 @@ sycl::event swap(sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t
     });
     return done;
 }
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                     float *y, int64_t incy, const float *z, int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_dot_usm>(cgh, [=]() {
+            result[0] = host_axpy_dot(n, alpha, x, incx, y, incy, z, incz);
+        });
+    });
+    return done;
+}
+
+sycl::event axpy_dot(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                     double *y, int64_t incy, const double *z, int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_dot_usm>(cgh, [=]() {
+            result[0] = host_axpy_dot(n, alpha, x, incx, y, incy, z, incz);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
+                       float beta, float *y, int64_t incy, float *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpby_nrm2_usm>(cgh, [=]() {
+            result[0] = host_axpby_nrm2(n, alpha, x, incx, beta, y, incy);
+        });
+    });
+    return done;
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
+                       double beta, double *y, int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpby_nrm2_usm>(cgh, [=]() {
+            result[0] = host_axpby_nrm2(n, alpha, x, incx, beta, y, incy);
+        });
+    });
+    return done;
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
+                 int64_t incy, const float *z, int64_t incz, float *result,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdot2_usm>(cgh, [=]() {
+            host_dot2(n, x, incx, y, incy, z, incz, result);
+        });
+    });
+    return done;
+}
+
+sycl::event dot2(sycl::queue &queue, int64_t n, const double *x, int64_t incx, const double *y,
+                 int64_t incy, const double *z, int64_t incz, double *result,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddot2_usm>(cgh, [=]() {
+            host_dot2(n, x, incx, y, incy, z, incz, result);
+        });
+    });
+    return done;
+}
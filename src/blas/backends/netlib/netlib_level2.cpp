@@ -24,6 +24,7 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_threaded.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 
 namespace oneapi {
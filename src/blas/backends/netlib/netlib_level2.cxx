@@ -22,10 +22,10 @@
 void gbmv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl, int64_t ku,
           float alpha, sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &x,
           int64_t incx, float beta, sycl::buffer<float, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_sgbmv>(cgh, [=]() {
             ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
                           (const int)kl, (const int)ku, (const float)alpha,
@@ -39,10 +39,10 @@ void gbmv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl,
 void gbmv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl, int64_t ku,
           double alpha, sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &x,
           int64_t incx, double beta, sycl::buffer<double, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_dgbmv>(cgh, [=]() {
             ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
                           (const int)kl, (const int)ku, (const double)alpha,
@@ -57,10 +57,10 @@ void gbmv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_cgbmv>(cgh, [=]() {
             ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
                           (const int)kl, (const int)ku, (const void *)&alpha,
@@ -75,10 +75,10 @@ void gbmv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zgbmv>(cgh, [=]() {
             ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
                           (const int)kl, (const int)ku, (const void *)&alpha,
@@ -92,15 +92,13 @@ void gbmv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t kl,
 void gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
           sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &x, int64_t incx,
           float beta, sycl::buffer<float, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_sgemv>(cgh, [=]() {
-            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const float)beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+            host_gemv(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_x.GET_MULTI_PTR, incx, beta, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -108,15 +106,13 @@ void gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha
 void gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
           sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &x, int64_t incx,
           double beta, sycl::buffer<double, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_dgemv>(cgh, [=]() {
-            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const double)beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+            host_gemv(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_x.GET_MULTI_PTR, incx, beta, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -125,15 +121,13 @@ void gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::comple
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_cgemv>(cgh, [=]() {
-            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const void *)&beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+            host_gemv(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_x.GET_MULTI_PTR, incx, beta, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -142,15 +136,13 @@ void gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::comple
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zgemv>(cgh, [=]() {
-            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const void *)&beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+            host_gemv(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_x.GET_MULTI_PTR, incx, beta, accessor_y.GET_MULTI_PTR, incy);
         });
     });
 }
@@ -158,14 +150,13 @@ void gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::comple
 void ger(sycl::queue &queue, int64_t m, int64_t n, float alpha, sycl::buffer<float, 1> &x,
          int64_t incx, sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &a,
          int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_sger>(cgh, [=]() {
-            ::cblas_sger(MAJOR, (const int)m, (const int)n, (const float)alpha,
-                         accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
-                         (const int)incy, accessor_a.GET_MULTI_PTR, (const int)lda);
+            host_ger(MAJOR, m, n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR,
+                     incy, accessor_a.GET_MULTI_PTR, lda);
         });
     });
 }
@@ -173,14 +164,13 @@ void ger(sycl::queue &queue, int64_t m, int64_t n, float alpha, sycl::buffer<flo
 void ger(sycl::queue &queue, int64_t m, int64_t n, double alpha, sycl::buffer<double, 1> &x,
          int64_t incx, sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &a,
          int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_dger>(cgh, [=]() {
-            ::cblas_dger(MAJOR, (const int)m, (const int)n, (const double)alpha,
-                         accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
-                         (const int)incy, accessor_a.GET_MULTI_PTR, (const int)lda);
+            host_ger(MAJOR, m, n, alpha, accessor_x.GET_MULTI_PTR, incx, accessor_y.GET_MULTI_PTR,
+                     incy, accessor_a.GET_MULTI_PTR, lda);
         });
     });
 }
@@ -189,10 +179,10 @@ void gerc(sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_cgerc>(cgh, [=]() {
             ::cblas_cgerc(MAJOR, (const int)m, (const int)n, (const void *)&alpha,
                           accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
@@ -205,10 +195,10 @@ void gerc(sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_zgerc>(cgh, [=]() {
             ::cblas_zgerc(MAJOR, (const int)m, (const int)n, (const void *)&alpha,
                           accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
@@ -221,10 +211,10 @@ void geru(sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_cgeru>(cgh, [=]() {
             ::cblas_cgeru(MAJOR, (const int)m, (const int)n, (const void *)&alpha,
                           accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
@@ -237,10 +227,10 @@ void geru(sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_zgeru>(cgh, [=]() {
             ::cblas_zgeru(MAJOR, (const int)m, (const int)n, (const void *)&alpha,
                           accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
@@ -253,10 +243,10 @@ void hbmv(sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, std::compl
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_chbmv>(cgh, [=]() {
             ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
                           (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
@@ -270,10 +260,10 @@ void hbmv(sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, std::compl
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zhbmv>(cgh, [=]() {
             ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
                           (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
@@ -287,10 +277,10 @@ void hemv(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<float> a
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_chemv>(cgh, [=]() {
             ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
@@ -304,10 +294,10 @@ void hemv(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<double>
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zhemv>(cgh, [=]() {
             ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
@@ -320,9 +310,9 @@ void hemv(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<double>
 void her(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
          sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
          sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_cher>(cgh, [=]() {
             ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                          (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -334,9 +324,9 @@ void her(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void her(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
          sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
          sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_zher>(cgh, [=]() {
             ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                          (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -349,10 +339,10 @@ void her2(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<float> a
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_cher2>(cgh, [=]() {
             ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const void *)&alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -366,10 +356,10 @@ void her2(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<double>
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_zher2>(cgh, [=]() {
             ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const void *)&alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -383,10 +373,10 @@ void hpmv(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<float> a
           sycl::buffer<std::complex<float>, 1> &ap, sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx, std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y,
           int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_chpmv>(cgh, [=]() {
             ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const void *)&alpha, accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR,
@@ -400,10 +390,10 @@ void hpmv(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<double>
           sycl::buffer<std::complex<double>, 1> &ap, sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx, std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y,
           int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_zhpmv>(cgh, [=]() {
             ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const void *)&alpha, accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR,
@@ -416,9 +406,9 @@ void hpmv(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<double>
 void hpr(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
          sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
          sycl::buffer<std::complex<float>, 1> &ap) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_ap = get_access<sycl::access::mode::read_write>(cgh, ap);
         host_task<class netlib_chpr>(cgh, [=]() {
             ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                          (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -430,9 +420,9 @@ void hpr(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
 void hpr(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
          sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
          sycl::buffer<std::complex<double>, 1> &ap) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_ap = get_access<sycl::access::mode::read_write>(cgh, ap);
         host_task<class netlib_zhpr>(cgh, [=]() {
             ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                          (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -445,10 +435,10 @@ void hpr2(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<float> a
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<float>, 1> &ap) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_ap = get_access<sycl::access::mode::read_write>(cgh, ap);
         host_task<class netlib_chpr2>(cgh, [=]() {
             ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const void *)&alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -461,10 +451,10 @@ void hpr2(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<double>
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, int64_t incy,
           sycl::buffer<std::complex<double>, 1> &ap) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_ap = get_access<sycl::access::mode::read_write>(cgh, ap);
         host_task<class netlib_zhpr2>(cgh, [=]() {
             ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const void *)&alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -476,10 +466,10 @@ void hpr2(sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<double>
 void sbmv(sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, float alpha,
           sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &x, int64_t incx,
           float beta, sycl::buffer<float, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_ssbmv>(cgh, [=]() {
             ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
                           (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
@@ -492,10 +482,10 @@ void sbmv(sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, float alph
 void sbmv(sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, double alpha,
           sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &x, int64_t incx,
           double beta, sycl::buffer<double, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_dsbmv>(cgh, [=]() {
             ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
                           (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
@@ -508,10 +498,10 @@ void sbmv(sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, double alp
 void spmv(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1> &ap,
           sycl::buffer<float, 1> &x, int64_t incx, float beta, sycl::buffer<float, 1> &y,
           int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_sspmv>(cgh, [=]() {
             ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const float)alpha, accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR,
@@ -524,10 +514,10 @@ void spmv(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::bu
 void spmv(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
           sycl::buffer<double, 1> &ap, sycl::buffer<double, 1> &x, int64_t incx, double beta,
           sycl::buffer<double, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_dspmv>(cgh, [=]() {
             ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const double)alpha, accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR,
@@ -539,9 +529,9 @@ void spmv(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
 
 void spr(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1> &x,
          int64_t incx, sycl::buffer<float, 1> &ap) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_ap = get_access<sycl::access::mode::read_write>(cgh, ap);
         host_task<class netlib_sspr>(cgh, [=]() {
             ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                          (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -552,9 +542,9 @@ void spr(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::buf
 
 void spr(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1> &x,
          int64_t incx, sycl::buffer<double, 1> &ap) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_ap = get_access<sycl::access::mode::read_write>(cgh, ap);
         host_task<class netlib_dspr>(cgh, [=]() {
             ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                          (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -565,10 +555,10 @@ void spr(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::bu
 
 void spr2(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1> &x,
           int64_t incx, sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &ap) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_ap = get_access<sycl::access::mode::read_write>(cgh, ap);
         host_task<class netlib_sspr2>(cgh, [=]() {
             ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -579,10 +569,10 @@ void spr2(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::bu
 
 void spr2(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1> &x,
           int64_t incx, sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &ap) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_ap = get_access<sycl::access::mode::read_write>(cgh, ap);
         host_task<class netlib_dspr2>(cgh, [=]() {
             ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -594,10 +584,10 @@ void spr2(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::b
 void symv(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1> &a,
           int64_t lda, sycl::buffer<float, 1> &x, int64_t incx, float beta,
           sycl::buffer<float, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_ssymv>(cgh, [=]() {
             ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
@@ -610,10 +600,10 @@ void symv(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::bu
 void symv(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1> &a,
           int64_t lda, sycl::buffer<double, 1> &x, int64_t incx, double beta,
           sycl::buffer<double, 1> &y, int64_t incy) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read_write>(cgh, y);
         host_task<class netlib_dsymv>(cgh, [=]() {
             ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
@@ -625,9 +615,9 @@ void symv(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::b
 
 void syr(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1> &x,
          int64_t incx, sycl::buffer<float, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_ssyr>(cgh, [=]() {
             ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                          (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -638,9 +628,9 @@ void syr(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::buf
 
 void syr(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1> &x,
          int64_t incx, sycl::buffer<double, 1> &a, int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_dsyr>(cgh, [=]() {
             ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                          (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -652,10 +642,10 @@ void syr(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::bu
 void syr2(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1> &x,
           int64_t incx, sycl::buffer<float, 1> &y, int64_t incy, sycl::buffer<float, 1> &a,
           int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_ssyr2>(cgh, [=]() {
             ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -668,10 +658,10 @@ void syr2(sycl::queue &queue, uplo upper_lower, int64_t n, float alpha, sycl::bu
 void syr2(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1> &x,
           int64_t incx, sycl::buffer<double, 1> &y, int64_t incy, sycl::buffer<double, 1> &a,
           int64_t lda) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_x = get_access<sycl::access::mode::read>(cgh, x);
+        auto accessor_y = get_access<sycl::access::mode::read>(cgh, y);
+        auto accessor_a = get_access<sycl::access::mode::read_write>(cgh, a);
         host_task<class netlib_dsyr2>(cgh, [=]() {
             ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
                           (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
@@ -684,9 +674,9 @@ void syr2(sycl::queue &queue, uplo upper_lower, int64_t n, double alpha, sycl::b
 void tbmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_stbmv>(cgh, [=]() {
             ::cblas_stbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
@@ -699,9 +689,9 @@ void tbmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_dtbmv>(cgh, [=]() {
             ::cblas_dtbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
@@ -714,9 +704,9 @@ void tbmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ctbmv>(cgh, [=]() {
             ::cblas_ctbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
@@ -729,9 +719,9 @@ void tbmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ztbmv>(cgh, [=]() {
             ::cblas_ztbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
@@ -744,9 +734,9 @@ void tbmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_stbsv>(cgh, [=]() {
             ::cblas_stbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
@@ -759,9 +749,9 @@ void tbsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_dtbsv>(cgh, [=]() {
             ::cblas_dtbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
@@ -774,9 +764,9 @@ void tbsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ctbsv>(cgh, [=]() {
             ::cblas_ctbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
@@ -789,9 +779,9 @@ void tbsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ztbsv>(cgh, [=]() {
             ::cblas_ztbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
@@ -803,9 +793,9 @@ void tbsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 
 void tpmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<float, 1> &ap, sycl::buffer<float, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_stpmv>(cgh, [=]() {
             ::cblas_stpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
@@ -816,9 +806,9 @@ void tpmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 
 void tpmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<double, 1> &ap, sycl::buffer<double, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_dtpmv>(cgh, [=]() {
             ::cblas_dtpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
@@ -830,9 +820,9 @@ void tpmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tpmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<float>, 1> &ap, sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ctpmv>(cgh, [=]() {
             ::cblas_ctpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
@@ -844,9 +834,9 @@ void tpmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tpmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<double>, 1> &ap, sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ztpmv>(cgh, [=]() {
             ::cblas_ztpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
@@ -857,9 +847,9 @@ void tpmv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 
 void tpsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<float, 1> &ap, sycl::buffer<float, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_stpsv>(cgh, [=]() {
             ::cblas_stpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
@@ -870,9 +860,9 @@ void tpsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 
 void tpsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<double, 1> &ap, sycl::buffer<double, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_dtpsv>(cgh, [=]() {
             ::cblas_dtpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
@@ -884,9 +874,9 @@ void tpsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tpsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<float>, 1> &ap, sycl::buffer<std::complex<float>, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ctpsv>(cgh, [=]() {
             ::cblas_ctpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
@@ -898,9 +888,9 @@ void tpsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tpsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<double>, 1> &ap, sycl::buffer<std::complex<double>, 1> &x,
           int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_ap = get_access<sycl::access::mode::read>(cgh, ap);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ztpsv>(cgh, [=]() {
             ::cblas_ztpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
@@ -911,9 +901,9 @@ void tpsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 
 void trmv(sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &b, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_strmv>(cgh, [=]() {
             ::cblas_strmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
@@ -924,9 +914,9 @@ void trmv(sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag
 
 void trmv(sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &b, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_dtrmv>(cgh, [=]() {
             ::cblas_dtrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
@@ -938,9 +928,9 @@ void trmv(sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag
 void trmv(sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_ctrmv>(cgh, [=]() {
             ::cblas_ctrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
@@ -952,9 +942,9 @@ void trmv(sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag
 void trmv(sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_ztrmv>(cgh, [=]() {
             ::cblas_ztrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
@@ -965,9 +955,9 @@ void trmv(sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag
 
 void trsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_strsv>(cgh, [=]() {
             ::cblas_strsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
@@ -978,9 +968,9 @@ void trsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 
 void trsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_dtrsv>(cgh, [=]() {
             ::cblas_dtrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
@@ -992,9 +982,9 @@ void trsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void trsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ctrsv>(cgh, [=]() {
             ::cblas_ctrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
@@ -1006,9 +996,9 @@ void trsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
 void trsv(sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_x = get_access<sycl::access::mode::read_write>(cgh, x);
         host_task<class netlib_ztrsv>(cgh, [=]() {
             ::cblas_ztrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
@@ -1100,11 +1090,8 @@ sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, floa
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sgemv_usm>(cgh, [=]() {
-            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, x, (const int)incx,
-                          (const float)beta, y, (const int)incy);
-        });
+        host_task<class netlib_sgemv_usm>(
+            cgh, [=]() { host_gemv(MAJOR, trans, m, n, alpha, a, lda, x, incx, beta, y, incy); });
     });
     return done;
 }
@@ -1117,11 +1104,8 @@ sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n, doub
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dgemv_usm>(cgh, [=]() {
-            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, x, (const int)incx,
-                          (const double)beta, y, (const int)incy);
-        });
+        host_task<class netlib_dgemv_usm>(
+            cgh, [=]() { host_gemv(MAJOR, trans, m, n, alpha, a, lda, x, incx, beta, y, incy); });
     });
     return done;
 }
@@ -1136,11 +1120,8 @@ sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cgemv_usm>(cgh, [=]() {
-            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void *)&beta, y, (const int)incy);
-        });
+        host_task<class netlib_cgemv_usm>(
+            cgh, [=]() { host_gemv(MAJOR, trans, m, n, alpha, a, lda, x, incx, beta, y, incy); });
     });
     return done;
 }
@@ -1155,11 +1136,8 @@ sycl::event gemv(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zgemv_usm>(cgh, [=]() {
-            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void *)&beta, y, (const int)incy);
-        });
+        host_task<class netlib_zgemv_usm>(
+            cgh, [=]() { host_gemv(MAJOR, trans, m, n, alpha, a, lda, x, incx, beta, y, incy); });
     });
     return done;
 }
@@ -1172,10 +1150,8 @@ sycl::event ger(sycl::queue &queue, int64_t m, int64_t n, float alpha, const flo
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sger_usm>(cgh, [=]() {
-            ::cblas_sger(MAJOR, (const int)m, (const int)n, (const float)alpha, x, (const int)incx,
-                         y, (const int)incy, a, (const int)lda);
-        });
+        host_task<class netlib_sger_usm>(
+            cgh, [=]() { host_ger(MAJOR, m, n, alpha, x, incx, y, incy, a, lda); });
     });
     return done;
 }
@@ -1188,10 +1164,8 @@ sycl::event ger(sycl::queue &queue, int64_t m, int64_t n, double alpha, const do
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dger_usm>(cgh, [=]() {
-            ::cblas_dger(MAJOR, (const int)m, (const int)n, (const double)alpha, x, (const int)incx,
-                         y, (const int)incy, a, (const int)lda);
-        });
+        host_task<class netlib_dger_usm>(
+            cgh, [=]() { host_ger(MAJOR, m, n, alpha, x, incx, y, incy, a, lda); });
     });
     return done;
 }
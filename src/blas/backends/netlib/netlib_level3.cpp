@@ -24,6 +24,8 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_gemm.hpp"
+#include "netlib_gemm_engine.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 
@@ -22,16 +22,13 @@
 void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           float alpha, sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &b,
           int64_t ldb, float beta, sycl::buffer<float, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_sgemm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const float)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -39,16 +36,13 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
 void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           double alpha, sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &b,
           int64_t ldb, double beta, sycl::buffer<double, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_dgemm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const double)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -57,16 +51,13 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_cgemm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const void *)&beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -75,16 +66,13 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_zgemm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const void *)&beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -123,14 +111,72 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
 #endif
 }
 
+void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+          float alpha, sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &b,
+          int64_t ldb, float beta, sycl::buffer<float, 1> &c, int64_t ldc, compute_mode mode) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_sgemm_compute_mode>(cgh, [=]() {
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc, mode);
+        });
+    });
+}
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+          double alpha, sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &b,
+          int64_t ldb, double beta, sycl::buffer<double, 1> &c, int64_t ldc, compute_mode mode) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_dgemm_compute_mode>(cgh, [=]() {
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc, mode);
+        });
+    });
+}
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+          std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+          sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+          sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, compute_mode mode) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_cgemm_compute_mode>(cgh, [=]() {
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc, mode);
+        });
+    });
+}
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+          std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+          sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+          sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, compute_mode mode) {
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
+        host_task<class netlib_zgemm_compute_mode>(cgh, [=]() {
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc, mode);
+        });
+    });
+}
+
 void hemm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_chemm>(cgh, [=]() {
             ::cblas_chemm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
@@ -145,10 +191,10 @@ void hemm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int6
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_zhemm>(cgh, [=]() {
             ::cblas_zhemm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
@@ -162,9 +208,9 @@ void hemm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int6
 void herk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, float alpha,
           sycl::buffer<std::complex<float>, 1> &a, int64_t lda, float beta,
           sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_cherk>(cgh, [=]() {
             ::cblas_cherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           (const int)n, (const int)k, (const float)alpha, accessor_a.GET_MULTI_PTR,
@@ -177,9 +223,9 @@ void herk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
 void herk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, double alpha,
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda, double beta,
           sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_zherk>(cgh, [=]() {
             ::cblas_zherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                           (const int)n, (const int)k, (const double)alpha, accessor_a.GET_MULTI_PTR,
@@ -193,10 +239,10 @@ void her2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int
            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, float beta,
            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_cher2k>(cgh, [=]() {
             ::cblas_cher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                            (const int)n, (const int)k, (const void *)&alpha,
@@ -211,10 +257,10 @@ void her2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int
            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, double beta,
            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_zher2k>(cgh, [=]() {
             ::cblas_zher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                            (const int)n, (const int)k, (const void *)&alpha,
@@ -228,16 +274,13 @@ void her2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int
 void symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n, float alpha,
           sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &b, int64_t ldb,
           float beta, sycl::buffer<float, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_ssymm>(cgh, [=]() {
-            ::cblas_ssymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const float)beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+            host_symm(MAJOR, left_right, upper_lower, m, n, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -245,16 +288,13 @@ void symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int6
 void symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n, double alpha,
           sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &b, int64_t ldb,
           double beta, sycl::buffer<double, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_dsymm>(cgh, [=]() {
-            ::cblas_dsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const double)beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+            host_symm(MAJOR, left_right, upper_lower, m, n, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -263,16 +303,13 @@ void symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int6
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_csymm>(cgh, [=]() {
-            ::cblas_csymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const void *)&beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+            host_symm(MAJOR, left_right, upper_lower, m, n, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -281,16 +318,13 @@ void symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int6
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_zsymm>(cgh, [=]() {
-            ::cblas_zsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const void *)&beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+            host_symm(MAJOR, left_right, upper_lower, m, n, alpha, accessor_a.GET_MULTI_PTR, lda,
+                      accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -298,14 +332,12 @@ void symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int6
 void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, float alpha,
           sycl::buffer<float, 1> &a, int64_t lda, float beta, sycl::buffer<float, 1> &c,
           int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_ssyrk>(cgh, [=]() {
-            ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, (const float)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            host_syrk(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.GET_MULTI_PTR, lda, beta,
+                      accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -313,14 +345,12 @@ void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
 void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, double alpha,
           sycl::buffer<double, 1> &a, int64_t lda, double beta, sycl::buffer<double, 1> &c,
           int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_dsyrk>(cgh, [=]() {
-            ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, (const double)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+            host_syrk(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.GET_MULTI_PTR, lda, beta,
+                      accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -328,14 +358,12 @@ void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
 void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_csyrk>(cgh, [=]() {
-            ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, (const void *)&beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+            host_syrk(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.GET_MULTI_PTR, lda, beta,
+                      accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -343,14 +371,12 @@ void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
 void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_zsyrk>(cgh, [=]() {
-            ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, (const void *)&beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+            host_syrk(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.GET_MULTI_PTR, lda, beta,
+                      accessor_c.GET_MULTI_PTR, ldc);
         });
     });
 }
@@ -358,10 +384,10 @@ void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
 void syr2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, float alpha,
            sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &b, int64_t ldb,
            float beta, sycl::buffer<float, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_ssyr2k>(cgh, [=]() {
             ::cblas_ssyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                            (const int)n, (const int)k, (const float)alpha, accessor_a.GET_MULTI_PTR,
@@ -374,10 +400,10 @@ void syr2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int
 void syr2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
            double alpha, sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &b,
            int64_t ldb, double beta, sycl::buffer<double, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_dsyr2k>(cgh, [=]() {
             ::cblas_dsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                            (const int)n, (const int)k, (const double)alpha,
@@ -392,10 +418,10 @@ void syr2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int
            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_csyr2k>(cgh, [=]() {
             ::cblas_csyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                            (const int)n, (const int)k, (const void *)&alpha,
@@ -410,10 +436,10 @@ void syr2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int
            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read>(cgh, b);
+        auto accessor_c = get_access<sycl::access::mode::read_write>(cgh, c);
         host_task<class netlib_zsyr2k>(cgh, [=]() {
             ::cblas_zsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
                            (const int)n, (const int)k, (const void *)&alpha,
@@ -427,15 +453,12 @@ void syr2k(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int
 void trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
           sycl::buffer<float, 1> &b, int64_t ldb) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_strmm>(cgh, [=]() {
-            ::cblas_strmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+            host_trmm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                      accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb);
         });
     });
 }
@@ -443,15 +466,12 @@ void trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
 void trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
           sycl::buffer<double, 1> &b, int64_t ldb) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_dtrmm>(cgh, [=]() {
-            ::cblas_dtrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+            host_trmm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                      accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb);
         });
     });
 }
@@ -459,15 +479,12 @@ void trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
 void trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
           int64_t lda, sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_ctrmm>(cgh, [=]() {
-            ::cblas_ctrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+            host_trmm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                      accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb);
         });
     });
 }
@@ -476,15 +493,12 @@ void trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
           int64_t m, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_ztrmm>(cgh, [=]() {
-            ::cblas_ztrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+            host_trmm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                      accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb);
         });
     });
 }
@@ -492,15 +506,12 @@ void trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
 void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
           sycl::buffer<float, 1> &b, int64_t ldb) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_strsm>(cgh, [=]() {
-            ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+            host_trsm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                      accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb);
         });
     });
 }
@@ -508,15 +519,12 @@ void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
 void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
           sycl::buffer<double, 1> &b, int64_t ldb) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_dtrsm>(cgh, [=]() {
-            ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+            host_trsm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                      accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb);
         });
     });
 }
@@ -524,15 +532,12 @@ void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
 void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
           int64_t lda, sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_ctrsm>(cgh, [=]() {
-            ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+            host_trsm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                      accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb);
         });
     });
 }
@@ -541,15 +546,12 @@ void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
           int64_t m, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
-    queue.submit([&](sycl::handler &cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+    host_submit(queue, [&](auto &cgh) {
+        auto accessor_a = get_access<sycl::access::mode::read>(cgh, a);
+        auto accessor_b = get_access<sycl::access::mode::read_write>(cgh, b);
         host_task<class netlib_ztrsm>(cgh, [=]() {
-            ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+            host_trsm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                      accessor_a.GET_MULTI_PTR, lda, accessor_b.GET_MULTI_PTR, ldb);
         });
     });
 }
@@ -565,9 +567,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sgemm_usm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const float)beta, c, (const int)ldc);
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -583,9 +583,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dgemm_usm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const double)beta, c, (const int)ldc);
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -602,10 +600,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cgemm_usm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void *)&beta, c,
-                          (const int)ldc);
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -622,10 +617,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zgemm_usm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void *)&beta, c,
-                          (const int)ldc);
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -667,6 +659,72 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
 #endif
 }
 
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const float *a, int64_t lda, const float *b, int64_t ldb,
+                 float beta, float *c, int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_compute_mode_usm>(cgh, [=]() {
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, double alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, double beta, double *c, int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_compute_mode_usm>(cgh, [=]() {
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                 std::complex<float> *c, int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_compute_mode_usm>(cgh, [=]() {
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode);
+        });
+    });
+    return done;
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                 const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                 std::complex<double> *c, int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_compute_mode_usm>(cgh, [=]() {
+            host_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode);
+        });
+    });
+    return done;
+}
+
 sycl::event hemm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
                  std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
                  const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
@@ -788,10 +846,7 @@ sycl::event symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssymm_usm>(cgh, [=]() {
-            ::cblas_ssymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb,
-                          (const float)beta, c, (const int)ldc);
+            host_symm(MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -807,10 +862,7 @@ sycl::event symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsymm_usm>(cgh, [=]() {
-            ::cblas_dsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb,
-                          (const double)beta, c, (const int)ldc);
+            host_symm(MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -827,10 +879,7 @@ sycl::event symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_csymm_usm>(cgh, [=]() {
-            ::cblas_csymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void *)&beta, c, (const int)ldc);
+            host_symm(MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -847,10 +896,7 @@ sycl::event symm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zsymm_usm>(cgh, [=]() {
-            ::cblas_zsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void *)&beta, c, (const int)ldc);
+            host_symm(MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -865,9 +911,7 @@ sycl::event syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssyrk_usm>(cgh, [=]() {
-            ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
-                          (const float)beta, c, (const int)ldc);
+            host_syrk(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -882,9 +926,7 @@ sycl::event syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsyrk_usm>(cgh, [=]() {
-            ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
-                          (const double)beta, c, (const int)ldc);
+            host_syrk(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -900,9 +942,7 @@ sycl::event syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_csyrk_usm>(cgh, [=]() {
-            ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
-                          (const void *)&beta, c, (const int)ldc);
+            host_syrk(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -918,9 +958,7 @@ sycl::event syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zsyrk_usm>(cgh, [=]() {
-            ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
-                          (const void *)&beta, c, (const int)ldc);
+            host_syrk(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -1008,10 +1046,8 @@ sycl::event trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_strmm_usm>(cgh, [=]() {
-            ::cblas_strmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
+            host_trmm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                      ldb);
         });
     });
     return done;
@@ -1026,10 +1062,8 @@ sycl::event trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dtrmm_usm>(cgh, [=]() {
-            ::cblas_dtrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
+            host_trmm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                      ldb);
         });
     });
     return done;
@@ -1045,10 +1079,8 @@ sycl::event trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ctrmm_usm>(cgh, [=]() {
-            ::cblas_ctrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            host_trmm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                      ldb);
         });
     });
     return done;
@@ -1064,10 +1096,8 @@ sycl::event trmm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ztrmm_usm>(cgh, [=]() {
-            ::cblas_ztrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            host_trmm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                      ldb);
         });
     });
     return done;
@@ -1082,10 +1112,8 @@ sycl::event trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_strsm_usm>(cgh, [=]() {
-            ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
+            host_trsm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                      ldb);
         });
     });
     return done;
@@ -1100,10 +1128,8 @@ sycl::event trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dtrsm_usm>(cgh, [=]() {
-            ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
+            host_trsm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                      ldb);
         });
     });
     return done;
@@ -1119,10 +1145,8 @@ sycl::event trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ctrsm_usm>(cgh, [=]() {
-            ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            host_trsm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                      ldb);
         });
     });
     return done;
@@ -1138,10 +1162,8 @@ sycl::event trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ztrsm_usm>(cgh, [=]() {
-            ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            host_trsm(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                      ldb);
         });
     });
     return done;
@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_PARALLEL_HPP_
+#define _NETLIB_PARALLEL_HPP_
+
+#include <cstdlib>
+#include <cstring>
+
+#include "host_parallel_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+using ::oneapi::mkl::host::host_num_threads;
+using ::oneapi::mkl::host::host_parallel_for;
+
+/**
+ * Reproducible mode, enabled by setting the ONEMKL_BLAS_REPRODUCIBLE
+ * environment variable to a value other than 0. Reductions then never go
+ * through CBLAS, whose summation order may depend on its own threading, and
+ * no code path is chosen from the number of threads, so results are bitwise
+ * identical for any ONEMKL_NETLIB_NUM_THREADS.
+ */
+inline bool host_reproducible() {
+    static const bool reproducible = []() {
+        const char *env = std::getenv("ONEMKL_BLAS_REPRODUCIBLE");
+        return env != nullptr && *env != '\0' && std::strcmp(env, "0") != 0;
+    }();
+    return reproducible;
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_PARALLEL_HPP_
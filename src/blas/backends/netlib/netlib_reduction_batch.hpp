@@ -0,0 +1,241 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_REDUCTION_BATCH_HPP_
+#define _NETLIB_REDUCTION_BATCH_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include "netlib_common.hpp"
+#include "netlib_parallel.hpp"
+#include "netlib_threaded.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Batched level-1 reductions.
+ *
+ * Every vector of the batch is reduced with one CBLAS call. The batch is cut
+ * into chunks of consecutive vectors holding about reduction_batch_chunk
+ * elements, and the chunks are spread over the host threads, so that a batch
+ * of many short vectors is not processed one task per vector. Each result
+ * only depends on its own vector. In reproducible mode dot, nrm2 and asum use
+ * the fixed-order kernels of the non-batched routines instead of CBLAS, so
+ * every result matches the non-batched call on the same vector.
+ */
+constexpr int64_t reduction_batch_chunk = 1 << 14;
+
+namespace detail {
+
+inline float reduce_dot(int64_t n, const float *x, int64_t incx, const float *y, int64_t incy) {
+    return ::cblas_sdot((const int)n, x, (const int)incx, y, (const int)incy);
+}
+
+inline double reduce_dot(int64_t n, const double *x, int64_t incx, const double *y,
+                         int64_t incy) {
+    return ::cblas_ddot((const int)n, x, (const int)incx, y, (const int)incy);
+}
+
+inline float reduce_nrm2(int64_t n, const float *x, int64_t incx) {
+    return ::cblas_snrm2((const int)n, x, (const int)std::abs(incx));
+}
+
+inline double reduce_nrm2(int64_t n, const double *x, int64_t incx) {
+    return ::cblas_dnrm2((const int)n, x, (const int)std::abs(incx));
+}
+
+inline float reduce_nrm2(int64_t n, const std::complex<float> *x, int64_t incx) {
+    return ::cblas_scnrm2((const int)n, x, (const int)std::abs(incx));
+}
+
+inline double reduce_nrm2(int64_t n, const std::complex<double> *x, int64_t incx) {
+    return ::cblas_dznrm2((const int)n, x, (const int)std::abs(incx));
+}
+
+inline float reduce_asum(int64_t n, const float *x, int64_t incx) {
+    return ::cblas_sasum((const int)n, x, (const int)std::abs(incx));
+}
+
+inline double reduce_asum(int64_t n, const double *x, int64_t incx) {
+    return ::cblas_dasum((const int)n, x, (const int)std::abs(incx));
+}
+
+inline float reduce_asum(int64_t n, const std::complex<float> *x, int64_t incx) {
+    return ::cblas_scasum((const int)n, x, (const int)std::abs(incx));
+}
+
+inline double reduce_asum(int64_t n, const std::complex<double> *x, int64_t incx) {
+    return ::cblas_dzasum((const int)n, x, (const int)std::abs(incx));
+}
+
+inline int64_t reduce_iamax(int64_t n, const float *x, int64_t incx) {
+    return ::cblas_isamax((const int)n, x, (const int)incx);
+}
+
+inline int64_t reduce_iamax(int64_t n, const double *x, int64_t incx) {
+    return ::cblas_idamax((const int)n, x, (const int)incx);
+}
+
+inline int64_t reduce_iamax(int64_t n, const std::complex<float> *x, int64_t incx) {
+    return ::cblas_icamax((const int)n, x, (const int)incx);
+}
+
+inline int64_t reduce_iamax(int64_t n, const std::complex<double> *x, int64_t incx) {
+    return ::cblas_izamax((const int)n, x, (const int)incx);
+}
+
+template <typename T>
+T batch_dot(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy) {
+    if (host_reproducible())
+        return reproducible_dot(n, x, incx, y, incy, false);
+    return reduce_dot(n, x, incx, y, incy);
+}
+
+template <typename T, typename R = decltype(std::abs(T()))>
+R batch_nrm2(int64_t n, const T *x, int64_t incx) {
+    if (host_reproducible())
+        return reproducible_nrm2(n, x, incx, false);
+    return reduce_nrm2(n, x, incx);
+}
+
+template <typename T, typename R = decltype(std::abs(T()))>
+R batch_asum(int64_t n, const T *x, int64_t incx) {
+    if (host_reproducible())
+        return reproducible_asum(n, x, incx, false);
+    return reduce_asum(n, x, incx);
+}
+
+// Calls f(b) for every vector b of a strided batch of vectors of n elements.
+template <typename F>
+void strided_batch_for(int64_t n, int64_t batch_size, F f) {
+    const int64_t per_chunk = std::max<int64_t>(1, reduction_batch_chunk / std::max<int64_t>(n, 1));
+    const int64_t num_chunks = (batch_size + per_chunk - 1) / per_chunk;
+    host_parallel_for(num_chunks, [&](int64_t chunk) {
+        const int64_t end = std::min(batch_size, (chunk + 1) * per_chunk);
+        for (int64_t b = chunk * per_chunk; b < end; ++b)
+            f(b);
+    });
+}
+
+// Calls f(g, b) for every vector b of a group batch, g being the group of b.
+template <typename F>
+void group_batch_for(const int64_t *n, int64_t group_count, const int64_t *group_size, F f) {
+    std::vector<int64_t> first(group_count + 1, 0);
+    int64_t elements = 0;
+    for (int64_t g = 0; g < group_count; ++g) {
+        first[g + 1] = first[g] + group_size[g];
+        elements += group_size[g] * std::max<int64_t>(n[g], 0);
+    }
+    const int64_t batch_size = first[group_count];
+    if (batch_size == 0)
+        return;
+    const int64_t per_chunk =
+        std::max<int64_t>(1, reduction_batch_chunk * batch_size / std::max<int64_t>(elements, 1));
+    const int64_t num_chunks = (batch_size + per_chunk - 1) / per_chunk;
+    host_parallel_for(num_chunks, [&](int64_t chunk) {
+        const int64_t begin = chunk * per_chunk;
+        const int64_t end = std::min(batch_size, begin + per_chunk);
+        int64_t g = std::upper_bound(first.begin(), first.end(), begin) - first.begin() - 1;
+        for (int64_t b = begin; b < end; ++b) {
+            while (b >= first[g + 1])
+                ++g;
+            f(g, b);
+        }
+    });
+}
+
+} // namespace detail
+
+template <typename T>
+void host_dot_batch(int64_t n, const T *x, int64_t incx, int64_t stridex, const T *y,
+                    int64_t incy, int64_t stridey, T *result, int64_t batch_size) {
+    detail::strided_batch_for(n, batch_size, [=](int64_t b) {
+        result[b] = detail::batch_dot(n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+
+template <typename T>
+void host_dot_batch(const int64_t *n, const T **x, const int64_t *incx, const T **y,
+                    const int64_t *incy, T *result, int64_t group_count,
+                    const int64_t *group_size) {
+    detail::group_batch_for(n, group_count, group_size, [=](int64_t g, int64_t b) {
+        result[b] = detail::batch_dot(n[g], x[b], incx[g], y[b], incy[g]);
+    });
+}
+
+template <typename T, typename R>
+void host_nrm2_batch(int64_t n, const T *x, int64_t incx, int64_t stridex, R *result,
+                     int64_t batch_size) {
+    detail::strided_batch_for(n, batch_size, [=](int64_t b) {
+        result[b] = detail::batch_nrm2(n, x + b * stridex, incx);
+    });
+}
+
+template <typename T, typename R>
+void host_nrm2_batch(const int64_t *n, const T **x, const int64_t *incx, R *result,
+                     int64_t group_count, const int64_t *group_size) {
+    detail::group_batch_for(n, group_count, group_size, [=](int64_t g, int64_t b) {
+        result[b] = detail::batch_nrm2(n[g], x[b], incx[g]);
+    });
+}
+
+template <typename T, typename R>
+void host_asum_batch(int64_t n, const T *x, int64_t incx, int64_t stridex, R *result,
+                     int64_t batch_size) {
+    detail::strided_batch_for(n, batch_size, [=](int64_t b) {
+        result[b] = detail::batch_asum(n, x + b * stridex, incx);
+    });
+}
+
+template <typename T, typename R>
+void host_asum_batch(const int64_t *n, const T **x, const int64_t *incx, R *result,
+                     int64_t group_count, const int64_t *group_size) {
+    detail::group_batch_for(n, group_count, group_size, [=](int64_t g, int64_t b) {
+        result[b] = detail::batch_asum(n[g], x[b], incx[g]);
+    });
+}
+
+template <typename T>
+void host_iamax_batch(int64_t n, const T *x, int64_t incx, int64_t stridex, int64_t *result,
+                      int64_t batch_size) {
+    detail::strided_batch_for(n, batch_size, [=](int64_t b) {
+        result[b] = detail::reduce_iamax(n, x + b * stridex, incx);
+    });
+}
+
+template <typename T>
+void host_iamax_batch(const int64_t *n, const T **x, const int64_t *incx, int64_t *result,
+                      int64_t group_count, const int64_t *group_size) {
+    detail::group_batch_for(n, group_count, group_size, [=](int64_t g, int64_t b) {
+        result[b] = detail::reduce_iamax(n[g], x[b], incx[g]);
+    });
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_REDUCTION_BATCH_HPP_
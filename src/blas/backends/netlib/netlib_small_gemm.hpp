@@ -0,0 +1,215 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_SMALL_GEMM_HPP_
+#define _NETLIB_SMALL_GEMM_HPP_
+
+#include <complex>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "cblas.h"
+
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Small-matrix gemm kernels.
+ *
+ * Reference CBLAS spends most of its time in argument checking and loop
+ * overhead when m, n and k are tiny. Problems where every dimension is at most
+ * small_gemm_max_size are instead dispatched to a kernel instantiated for the
+ * smallest (M, N, K) size bucket that holds them. The operands are packed into
+ * fixed-size panels so that the kernel only has compile-time strides and
+ * register tile sizes, and C is accumulated in a fully unrolled register tile.
+ */
+constexpr int64_t small_gemm_min_bucket = 4;
+constexpr int64_t small_gemm_max_size = 32;
+
+inline bool use_small_gemm(int64_t m, int64_t n, int64_t k) {
+    return m > 0 && n > 0 && k >= 0 && m <= small_gemm_max_size && n <= small_gemm_max_size &&
+           k <= small_gemm_max_size;
+}
+
+namespace detail {
+
+template <typename T>
+struct is_complex : std::false_type {};
+template <typename T>
+struct is_complex<std::complex<T>> : std::true_type {};
+
+template <typename T>
+inline T conj_if(T val, bool conj) {
+    if constexpr (is_complex<T>::value) {
+        return conj ? std::conj(val) : val;
+    }
+    else {
+        return val;
+    }
+}
+
+// Invokes f with the smallest power-of-two bucket in [small_gemm_min_bucket,
+// small_gemm_max_size] that is not smaller than size.
+template <int Bucket = small_gemm_min_bucket, typename F>
+inline void dispatch_small_bucket(int64_t size, F &&f) {
+    if constexpr (Bucket >= small_gemm_max_size) {
+        f(std::integral_constant<int, Bucket>{});
+    }
+    else {
+        if (size <= Bucket)
+            f(std::integral_constant<int, Bucket>{});
+        else
+            dispatch_small_bucket<2 * Bucket>(size, std::forward<F>(f));
+    }
+}
+
+// Strides of element (i, j) of op(X) for a matrix stored with leading
+// dimension ld in the given layout.
+inline void op_strides(CBLAS_LAYOUT layout, transpose trans, int64_t ld, int64_t &row_stride,
+                       int64_t &col_stride) {
+    bool col_major = (layout == CblasColMajor);
+    bool no_trans = (trans == transpose::nontrans);
+    row_stride = (col_major == no_trans) ? 1 : ld;
+    col_stride = (col_major == no_trans) ? ld : 1;
+}
+
+// Register tile size of the kernel along one dimension of C.
+template <typename T, int Bucket>
+constexpr int small_gemm_tile() {
+    constexpr int max_tile = is_complex<T>::value ? 2 : 4;
+    return Bucket < max_tile ? Bucket : max_tile;
+}
+
+inline int64_t round_up(int64_t x, int64_t multiple) {
+    return ((x + multiple - 1) / multiple) * multiple;
+}
+
+template <typename T, int MB, int NB, int KB>
+void small_gemm_kernel(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b,
+                       int64_t ldb, T beta, T *c, int64_t ldc) {
+    constexpr int RM = small_gemm_tile<T, MB>();
+    constexpr int RN = small_gemm_tile<T, NB>();
+    constexpr int KU = 4;
+    static_assert(MB % RM == 0 && NB % RN == 0 && KB % KU == 0, "invalid small gemm bucket");
+
+    // Pack op(A) as an MB x KB column-major panel and op(B) as a KB x NB
+    // row-major panel. Both are zero-padded up to the register tile and k
+    // unroll factor so that the inner loops have no remainder handling.
+    const int64_t mp = round_up(m, RM);
+    const int64_t np = round_up(n, RN);
+    const int64_t kp = round_up(k, KU);
+    T a_pack[MB * KB];
+    T b_pack[KB * NB];
+    int64_t a_rs, a_cs, b_rs, b_cs;
+    op_strides(layout, transa, lda, a_rs, a_cs);
+    op_strides(layout, transb, ldb, b_rs, b_cs);
+    const bool conj_a = (transa == transpose::conjtrans);
+    const bool conj_b = (transb == transpose::conjtrans);
+
+    for (int64_t p = 0; p < kp; ++p) {
+        for (int64_t i = 0; i < mp; ++i) {
+            a_pack[p * MB + i] = (i < m && p < k) ? conj_if(a[i * a_rs + p * a_cs], conj_a) : T(0);
+        }
+        for (int64_t j = 0; j < np; ++j) {
+            b_pack[p * NB + j] = (j < n && p < k) ? conj_if(b[p * b_rs + j * b_cs], conj_b) : T(0);
+        }
+    }
+
+    const int64_t c_rs = (layout == CblasColMajor) ? 1 : ldc;
+    const int64_t c_cs = (layout == CblasColMajor) ? ldc : 1;
+
+    for (int64_t i0 = 0; i0 < mp; i0 += RM) {
+        for (int64_t j0 = 0; j0 < np; j0 += RN) {
+            T acc[RN][RM] = {};
+            for (int64_t p0 = 0; p0 < kp; p0 += KU) {
+                for (int pu = 0; pu < KU; ++pu) {
+                    const T *a_col = a_pack + (p0 + pu) * MB + i0;
+                    const T *b_row = b_pack + (p0 + pu) * NB + j0;
+                    for (int j = 0; j < RN; ++j) {
+                        for (int i = 0; i < RM; ++i) {
+                            acc[j][i] += a_col[i] * b_row[j];
+                        }
+                    }
+                }
+            }
+            for (int j = 0; j < RN; ++j) {
+                for (int i = 0; i < RM; ++i) {
+                    if (i0 + i < m && j0 + j < n) {
+                        T &c_ij = c[(i0 + i) * c_rs + (j0 + j) * c_cs];
+                        c_ij = (beta == T(0)) ? alpha * acc[j][i] : alpha * acc[j][i] + beta * c_ij;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// C = beta * C without reading A or B, so that NaN or Inf in the operands
+// does not propagate into C when alpha is zero, as in reference BLAS.
+template <typename T>
+void small_gemm_scale_c(CBLAS_LAYOUT layout, int64_t m, int64_t n, T beta, T *c, int64_t ldc) {
+    const int64_t c_rs = (layout == CblasColMajor) ? 1 : ldc;
+    const int64_t c_cs = (layout == CblasColMajor) ? ldc : 1;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            T &c_ij = c[i * c_rs + j * c_cs];
+            c_ij = (beta == T(0)) ? T(0) : beta * c_ij;
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * Computes C = alpha * op(A) * op(B) + beta * C with a kernel specialized for
+ * the size bucket of (m, n, k). The caller must check use_small_gemm first.
+ * When alpha is zero or k is zero, A and B are not referenced.
+ */
+template <typename T>
+void small_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                int64_t k, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb, T beta, T *c,
+                int64_t ldc) {
+    if (alpha == T(0) || k == 0) {
+        detail::small_gemm_scale_c(layout, m, n, beta, c, ldc);
+        return;
+    }
+    detail::dispatch_small_bucket(m, [&](auto mb) {
+        detail::dispatch_small_bucket(n, [&](auto nb) {
+            detail::dispatch_small_bucket(k, [&](auto kb) {
+                detail::small_gemm_kernel<T, decltype(mb)::value, decltype(nb)::value,
+                                          decltype(kb)::value>(layout, transa, transb, m, n, k,
+                                                               alpha, a, lda, b, ldb, beta, c,
+                                                               ldc);
+            });
+        });
+    });
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_SMALL_GEMM_HPP_
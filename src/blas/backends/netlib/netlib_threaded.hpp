@@ -0,0 +1,573 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_THREADED_HPP_
+#define _NETLIB_THREADED_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "netlib_common.hpp"
+#include "netlib_parallel.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Multithreaded level-1 and level-2 kernels.
+ *
+ * Reference CBLAS is single-threaded, so large axpy, dot, nrm2, gemv and ger
+ * calls use one core. Above a size threshold these kernels split the work
+ * over the host threads; below it they call CBLAS directly.
+ *
+ * Level-1 vectors are cut into chunks of threaded_level1_chunk elements. The
+ * inner loops keep fused_lanes partial sums, and dot and nrm2 add the
+ * per-chunk results in chunk order, so the result only depends on n and not
+ * on the number of threads.
+ *
+ * gemv and ger are split into blocks of the output, and every block is
+ * computed with one CBLAS call. With reference CBLAS every output element is
+ * then computed by the same operations as in a single call.
+ *
+ * In reproducible mode (see host_reproducible) dot, dotc, dotu, asum, nrm2 and
+ * gemv never call CBLAS. The level-1 reductions use the chunked kernels for
+ * every n, nrm2 rescales by a power of two instead of falling back to CBLAS,
+ * and gemv accumulates every element of y over the columns of op(A) in a
+ * fixed order, whatever the split of y over the threads.
+ *
+ * The thresholds keep the serial work of a call at several times the cost of
+ * waking the thread pool, which is a few microseconds per call.
+ */
+constexpr int64_t threaded_level1_min_n = 1 << 16;
+constexpr int64_t threaded_level1_chunk = 1 << 13;
+constexpr int64_t threaded_level2_min_size = 1 << 16;
+constexpr int64_t threaded_level2_min_block = 32;
+
+// Number of independent partial sums kept by the level-1 reduction loops,
+// which lets the compiler vectorize the unit-stride loops. The partial sums
+// are added up in a fixed order, so the result does not depend on the input
+// alignment.
+constexpr int64_t fused_lanes = 8;
+
+namespace detail {
+
+// Start of a vector of n elements with increment inc, as in BLAS.
+template <typename T>
+inline T *vector_start(T *x, int64_t n, int64_t inc) {
+    return inc < 0 ? x + (1 - n) * inc : x;
+}
+
+template <typename T>
+inline T sum_lanes(T (&acc)[fused_lanes]) {
+    for (int64_t width = fused_lanes / 2; width > 0; width /= 2) {
+        for (int64_t l = 0; l < width; ++l)
+            acc[l] += acc[l + width];
+    }
+    return acc[0];
+}
+
+inline void cblas_axpy(int64_t n, float alpha, const float *x, int64_t incx, float *y,
+                       int64_t incy) {
+    ::cblas_saxpy((const int)n, alpha, x, (const int)incx, y, (const int)incy);
+}
+
+inline void cblas_axpy(int64_t n, double alpha, const double *x, int64_t incx, double *y,
+                       int64_t incy) {
+    ::cblas_daxpy((const int)n, alpha, x, (const int)incx, y, (const int)incy);
+}
+
+inline void cblas_axpy(int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+                       int64_t incx, std::complex<float> *y, int64_t incy) {
+    ::cblas_caxpy((const int)n, (const void *)&alpha, x, (const int)incx, y, (const int)incy);
+}
+
+inline void cblas_axpy(int64_t n, std::complex<double> alpha, const std::complex<double> *x,
+                       int64_t incx, std::complex<double> *y, int64_t incy) {
+    ::cblas_zaxpy((const int)n, (const void *)&alpha, x, (const int)incx, y, (const int)incy);
+}
+
+inline float cblas_dot(int64_t n, const float *x, int64_t incx, const float *y, int64_t incy) {
+    return ::cblas_sdot((const int)n, x, (const int)incx, y, (const int)incy);
+}
+
+inline double cblas_dot(int64_t n, const double *x, int64_t incx, const double *y,
+                        int64_t incy) {
+    return ::cblas_ddot((const int)n, x, (const int)incx, y, (const int)incy);
+}
+
+inline std::complex<float> cblas_dotc(int64_t n, const std::complex<float> *x, int64_t incx,
+                                      const std::complex<float> *y, int64_t incy) {
+    std::complex<float> result;
+    ::cblas_cdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, &result);
+    return result;
+}
+
+inline std::complex<double> cblas_dotc(int64_t n, const std::complex<double> *x, int64_t incx,
+                                       const std::complex<double> *y, int64_t incy) {
+    std::complex<double> result;
+    ::cblas_zdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, &result);
+    return result;
+}
+
+inline std::complex<float> cblas_dotu(int64_t n, const std::complex<float> *x, int64_t incx,
+                                      const std::complex<float> *y, int64_t incy) {
+    std::complex<float> result;
+    ::cblas_cdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, &result);
+    return result;
+}
+
+inline std::complex<double> cblas_dotu(int64_t n, const std::complex<double> *x, int64_t incx,
+                                       const std::complex<double> *y, int64_t incy) {
+    std::complex<double> result;
+    ::cblas_zdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, &result);
+    return result;
+}
+
+inline float cblas_asum(int64_t n, const float *x, int64_t incx) {
+    return ::cblas_sasum((const int)n, x, (const int)std::abs(incx));
+}
+
+inline double cblas_asum(int64_t n, const double *x, int64_t incx) {
+    return ::cblas_dasum((const int)n, x, (const int)std::abs(incx));
+}
+
+inline float cblas_asum(int64_t n, const std::complex<float> *x, int64_t incx) {
+    return ::cblas_scasum((const int)n, x, (const int)std::abs(incx));
+}
+
+inline double cblas_asum(int64_t n, const std::complex<double> *x, int64_t incx) {
+    return ::cblas_dzasum((const int)n, x, (const int)std::abs(incx));
+}
+
+inline float cblas_nrm2(int64_t n, const float *x, int64_t incx) {
+    return ::cblas_snrm2((const int)n, x, (const int)std::abs(incx));
+}
+
+inline double cblas_nrm2(int64_t n, const double *x, int64_t incx) {
+    return ::cblas_dnrm2((const int)n, x, (const int)std::abs(incx));
+}
+
+inline float cblas_nrm2(int64_t n, const std::complex<float> *x, int64_t incx) {
+    return ::cblas_scnrm2((const int)n, x, (const int)std::abs(incx));
+}
+
+inline double cblas_nrm2(int64_t n, const std::complex<double> *x, int64_t incx) {
+    return ::cblas_dznrm2((const int)n, x, (const int)std::abs(incx));
+}
+
+inline void cblas_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, float alpha,
+                       const float *a, int64_t lda, const float *x, int64_t incx, float beta,
+                       float *y, int64_t incy) {
+    ::cblas_sgemv(layout, convert_to_cblas_trans(trans), (const int)m, (const int)n, alpha, a,
+                  (const int)lda, x, (const int)incx, beta, y, (const int)incy);
+}
+
+inline void cblas_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, double alpha,
+                       const double *a, int64_t lda, const double *x, int64_t incx, double beta,
+                       double *y, int64_t incy) {
+    ::cblas_dgemv(layout, convert_to_cblas_trans(trans), (const int)m, (const int)n, alpha, a,
+                  (const int)lda, x, (const int)incx, beta, y, (const int)incy);
+}
+
+inline void cblas_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n,
+                       std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                       const std::complex<float> *x, int64_t incx, std::complex<float> beta,
+                       std::complex<float> *y, int64_t incy) {
+    ::cblas_cgemv(layout, convert_to_cblas_trans(trans), (const int)m, (const int)n,
+                  (const void *)&alpha, a, (const int)lda, x, (const int)incx,
+                  (const void *)&beta, y, (const int)incy);
+}
+
+inline void cblas_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n,
+                       std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                       const std::complex<double> *x, int64_t incx, std::complex<double> beta,
+                       std::complex<double> *y, int64_t incy) {
+    ::cblas_zgemv(layout, convert_to_cblas_trans(trans), (const int)m, (const int)n,
+                  (const void *)&alpha, a, (const int)lda, x, (const int)incx,
+                  (const void *)&beta, y, (const int)incy);
+}
+
+inline void cblas_ger(CBLAS_LAYOUT layout, int64_t m, int64_t n, float alpha, const float *x,
+                      int64_t incx, const float *y, int64_t incy, float *a, int64_t lda) {
+    ::cblas_sger(layout, (const int)m, (const int)n, alpha, x, (const int)incx, y,
+                 (const int)incy, a, (const int)lda);
+}
+
+inline void cblas_ger(CBLAS_LAYOUT layout, int64_t m, int64_t n, double alpha, const double *x,
+                      int64_t incx, const double *y, int64_t incy, double *a, int64_t lda) {
+    ::cblas_dger(layout, (const int)m, (const int)n, alpha, x, (const int)incx, y,
+                 (const int)incy, a, (const int)lda);
+}
+
+inline int64_t level1_num_chunks(int64_t n) {
+    return (n + threaded_level1_chunk - 1) / threaded_level1_chunk;
+}
+
+// Number of blocks an output dimension of size outer is split into for
+// inner * outer work.
+inline int64_t level2_num_blocks(int64_t outer, int64_t inner) {
+    if (outer * inner < threaded_level2_min_size)
+        return 1;
+    return std::max<int64_t>(1, std::min(4 * host_num_threads(),
+                                         outer / threaded_level2_min_block));
+}
+
+// Pointer to element begin of a vector of n elements with increment inc, such
+// that the elements [begin, end) form a vector with the same increment.
+template <typename T>
+inline T *sub_vector(T *x, int64_t n, int64_t inc, int64_t begin, int64_t end) {
+    return inc < 0 ? x + (n - end) * -inc : x + begin * inc;
+}
+
+template <typename T>
+inline T conj_if(bool conj, T val) {
+    if constexpr (std::is_arithmetic_v<T>)
+        return val;
+    else
+        return conj ? std::conj(val) : val;
+}
+
+// Sum of op(x_i) * y_i for i in [begin, end), x and y pointing to element 0,
+// op conjugating when ConjX is set.
+template <bool ConjX = false, typename T>
+T dot_chunk(const T *x, int64_t incx, const T *y, int64_t incy, int64_t begin, int64_t end) {
+    T acc[fused_lanes] = {};
+    int64_t i = begin;
+    if (incx == 1 && incy == 1) {
+        for (; i + fused_lanes <= end; i += fused_lanes) {
+            for (int64_t l = 0; l < fused_lanes; ++l)
+                acc[l] += conj_if(ConjX, x[i + l]) * y[i + l];
+        }
+    }
+    for (; i < end; ++i)
+        acc[i % fused_lanes] += conj_if(ConjX, x[i * incx]) * y[i * incy];
+    return sum_lanes(acc);
+}
+
+// Sum of |scale * x_i|^2 for i in [begin, end), x pointing to element 0.
+template <typename T, typename R>
+R ssq_chunk(const T *x, int64_t incx, int64_t begin, int64_t end, R scale = R(1)) {
+    R acc[fused_lanes] = {};
+    int64_t i = begin;
+    if (incx == 1) {
+        for (; i + fused_lanes <= end; i += fused_lanes) {
+            for (int64_t l = 0; l < fused_lanes; ++l)
+                acc[l] += std::norm(scale * x[i + l]);
+        }
+    }
+    for (; i < end; ++i)
+        acc[i % fused_lanes] += std::norm(scale * x[i * incx]);
+    return sum_lanes(acc);
+}
+
+// Sum of |Re(x_i)| + |Im(x_i)| for i in [begin, end), x pointing to element 0.
+template <typename T, typename R>
+R asum_chunk(const T *x, int64_t incx, int64_t begin, int64_t end) {
+    R acc[fused_lanes] = {};
+    int64_t i = begin;
+    if (incx == 1) {
+        for (; i + fused_lanes <= end; i += fused_lanes) {
+            for (int64_t l = 0; l < fused_lanes; ++l)
+                acc[l] += std::abs(std::real(x[i + l])) + std::abs(std::imag(x[i + l]));
+        }
+    }
+    for (; i < end; ++i)
+        acc[i % fused_lanes] += std::abs(std::real(x[i * incx])) + std::abs(std::imag(x[i * incx]));
+    return sum_lanes(acc);
+}
+
+// Adds up the results of f(begin, end) over the chunks of [0, n), in order.
+// The chunks run on the host threads when parallel is set and on the calling
+// thread otherwise, with the same result.
+template <typename T, typename F>
+T chunked_sum(int64_t n, F f, bool parallel = true) {
+    const int64_t num_chunks = n > 0 ? level1_num_chunks(n) : 0;
+    if (num_chunks <= 1)
+        return num_chunks == 0 ? T{} : f(0, n);
+    std::vector<T> partial(num_chunks);
+    auto run_chunk = [&](int64_t chunk) {
+        const int64_t begin = chunk * threaded_level1_chunk;
+        partial[chunk] = f(begin, std::min(n, begin + threaded_level1_chunk));
+    };
+    if (parallel) {
+        host_parallel_for(num_chunks, run_chunk);
+    }
+    else {
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk)
+            run_chunk(chunk);
+    }
+    T sum = partial[0];
+    for (int64_t chunk = 1; chunk < num_chunks; ++chunk)
+        sum += partial[chunk];
+    return sum;
+}
+
+// Fixed-order reductions used in reproducible mode, for vectors given as in
+// CBLAS. The batched reductions call them with parallel set to false.
+template <bool ConjX = false, typename T>
+T reproducible_dot(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy,
+                   bool parallel = true) {
+    x = vector_start(x, n, incx);
+    y = vector_start(y, n, incy);
+    return chunked_sum<T>(
+        n,
+        [=](int64_t begin, int64_t end) {
+            return dot_chunk<ConjX>(x, incx, y, incy, begin, end);
+        },
+        parallel);
+}
+
+template <typename T, typename R = decltype(std::abs(T()))>
+R reproducible_asum(int64_t n, const T *x, int64_t incx, bool parallel = true) {
+    const int64_t inc = std::abs(incx);
+    return chunked_sum<R>(
+        n, [=](int64_t begin, int64_t end) { return asum_chunk<T, R>(x, inc, begin, end); },
+        parallel);
+}
+
+// The sum of squares is rescaled by a power of two, which is exact, when it
+// overflows or underflows.
+template <typename T, typename R = decltype(std::abs(T()))>
+R reproducible_nrm2(int64_t n, const T *x, int64_t incx, bool parallel = true) {
+    const int64_t inc = std::abs(incx);
+    const R ssq = chunked_sum<R>(
+        n, [=](int64_t begin, int64_t end) { return ssq_chunk<T, R>(x, inc, begin, end); },
+        parallel);
+    const R tiny = std::numeric_limits<R>::min() / std::numeric_limits<R>::epsilon();
+    if (std::isnan(ssq) || (ssq < std::numeric_limits<R>::max() && ssq >= tiny))
+        return std::sqrt(ssq);
+    R amax = R(0);
+    for (int64_t i = 0; i < n; ++i) {
+        amax = std::max(amax, std::max(std::abs(std::real(x[i * inc])),
+                                       std::abs(std::imag(x[i * inc]))));
+    }
+    if (amax == R(0) || std::isinf(amax))
+        return amax;
+    int exp;
+    std::frexp(amax, &exp);
+    const R scale = std::ldexp(R(1), -exp);
+    const R scaled_ssq = chunked_sum<R>(
+        n,
+        [=](int64_t begin, int64_t end) { return ssq_chunk<T, R>(x, inc, begin, end, scale); },
+        parallel);
+    return std::ldexp(std::sqrt(scaled_ssq), exp);
+}
+
+// Rows [begin, end) of y = alpha * op(A) * x + beta * y, where element (r, c)
+// of op(A) is a[r * row_stride + c * col_stride], conjugated if conj is set,
+// and x and y point to element 0. Every element of y is accumulated over c in
+// the same order whatever begin and end are.
+template <typename T>
+void gemv_rows(bool conj, int64_t cols, T alpha, const T *a, int64_t row_stride,
+               int64_t col_stride, const T *x, int64_t incx, T beta, T *y, int64_t incy,
+               int64_t begin, int64_t end) {
+    auto update = [=](int64_t r, T sum) {
+        T &yr = y[r * incy];
+        yr = (beta == T(0)) ? alpha * sum : alpha * sum + beta * yr;
+    };
+    if (alpha == T(0)) {
+        for (int64_t r = begin; r < end; ++r) {
+            T &yr = y[r * incy];
+            yr = (beta == T(0)) ? T(0) : beta * yr;
+        }
+    }
+    else if (row_stride == 1) {
+        std::vector<T> sum(end - begin, T(0));
+        for (int64_t c = 0; c < cols; ++c) {
+            const T xc = x[c * incx];
+            const T *a_col = a + c * col_stride;
+            for (int64_t r = begin; r < end; ++r)
+                sum[r - begin] += conj_if(conj, a_col[r]) * xc;
+        }
+        for (int64_t r = begin; r < end; ++r)
+            update(r, sum[r - begin]);
+    }
+    else if (conj) {
+        for (int64_t r = begin; r < end; ++r)
+            update(r, dot_chunk<true>(a + r * row_stride, 1, x, incx, 0, cols));
+    }
+    else {
+        for (int64_t r = begin; r < end; ++r)
+            update(r, dot_chunk<false>(a + r * row_stride, 1, x, incx, 0, cols));
+    }
+}
+
+} // namespace detail
+
+// y = alpha * x + y
+template <typename T>
+void host_axpy(int64_t n, T alpha, const T *x, int64_t incx, T *y, int64_t incy) {
+    if (n < threaded_level1_min_n) {
+        detail::cblas_axpy(n, alpha, x, incx, y, incy);
+        return;
+    }
+    x = detail::vector_start(x, n, incx);
+    y = detail::vector_start(y, n, incy);
+    host_parallel_for(detail::level1_num_chunks(n), [=](int64_t chunk) {
+        const int64_t begin = chunk * threaded_level1_chunk;
+        const int64_t end = std::min(n, begin + threaded_level1_chunk);
+        if (incx == 1 && incy == 1) {
+            for (int64_t i = begin; i < end; ++i)
+                y[i] += alpha * x[i];
+        }
+        else {
+            for (int64_t i = begin; i < end; ++i)
+                y[i * incy] += alpha * x[i * incx];
+        }
+    });
+}
+
+// Returns x^T * y.
+template <typename T>
+T host_dot(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy) {
+    if (n < threaded_level1_min_n && !host_reproducible())
+        return detail::cblas_dot(n, x, incx, y, incy);
+    return detail::reproducible_dot(n, x, incx, y, incy);
+}
+
+// Returns x^H * y.
+template <typename T>
+T host_dotc(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy) {
+    if (n < threaded_level1_min_n && !host_reproducible())
+        return detail::cblas_dotc(n, x, incx, y, incy);
+    return detail::reproducible_dot<true>(n, x, incx, y, incy);
+}
+
+// Returns x^T * y for complex x and y.
+template <typename T>
+T host_dotu(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy) {
+    if (n < threaded_level1_min_n && !host_reproducible())
+        return detail::cblas_dotu(n, x, incx, y, incy);
+    return detail::reproducible_dot(n, x, incx, y, incy);
+}
+
+// Returns the sum of |Re(x_i)| + |Im(x_i)|. As in the single-threaded path, the
+// sign of incx is ignored.
+template <typename T, typename R = decltype(std::abs(T()))>
+R host_asum(int64_t n, const T *x, int64_t incx) {
+    if (n < threaded_level1_min_n && !host_reproducible())
+        return detail::cblas_asum(n, x, incx);
+    return detail::reproducible_asum(n, x, incx);
+}
+
+// Returns the Euclidean norm of x. As in the single-threaded path, the sign of
+// incx is ignored.
+template <typename T, typename R = decltype(std::abs(T()))>
+R host_nrm2(int64_t n, const T *x, int64_t incx) {
+    if (host_reproducible())
+        return detail::reproducible_nrm2(n, x, incx);
+    if (n < threaded_level1_min_n)
+        return detail::cblas_nrm2(n, x, incx);
+    const int64_t inc = std::abs(incx);
+    const R ssq = detail::chunked_sum<R>(n, [=](int64_t begin, int64_t end) {
+        return detail::ssq_chunk<T, R>(x, inc, begin, end);
+    });
+    // The unscaled sum of squares may have overflowed or lost precision to
+    // underflow; fall back to the scaled CBLAS nrm2 in both cases.
+    if (!(ssq < std::numeric_limits<R>::max()) ||
+        ssq < std::numeric_limits<R>::min() / std::numeric_limits<R>::epsilon()) {
+        return detail::cblas_nrm2(n, x, incx);
+    }
+    return std::sqrt(ssq);
+}
+
+// y = alpha * op(A) * x + beta * y, split into blocks of rows of op(A).
+template <typename T>
+void host_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, T alpha, const T *a,
+               int64_t lda, const T *x, int64_t incx, T beta, T *y, int64_t incy) {
+    const bool nontrans = (trans == transpose::nontrans);
+    const int64_t rows = nontrans ? m : n;
+    const int64_t cols = nontrans ? n : m;
+    const int64_t num_blocks = detail::level2_num_blocks(rows, cols);
+    // Distance in A between consecutive rows of op(A).
+    const int64_t row_stride = ((layout == CblasColMajor) == nontrans) ? 1 : lda;
+    if (host_reproducible()) {
+        if (rows <= 0 || cols <= 0)
+            return;
+        const int64_t col_stride = (row_stride == 1) ? lda : 1;
+        const T *x0 = detail::vector_start(x, cols, incx);
+        T *y0 = detail::vector_start(y, rows, incy);
+        host_parallel_for(num_blocks, [&](int64_t block) {
+            detail::gemv_rows(trans == transpose::conjtrans, cols, alpha, a, row_stride,
+                              col_stride, x0, incx, beta, y0, incy, block * rows / num_blocks,
+                              (block + 1) * rows / num_blocks);
+        });
+        return;
+    }
+    if (num_blocks <= 1) {
+        detail::cblas_gemv(layout, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        return;
+    }
+    host_parallel_for(num_blocks, [&](int64_t block) {
+        const int64_t begin = block * rows / num_blocks;
+        const int64_t end = (block + 1) * rows / num_blocks;
+        T *y_block = detail::sub_vector(y, rows, incy, begin, end);
+        if (nontrans) {
+            detail::cblas_gemv(layout, trans, end - begin, n, alpha, a + begin * row_stride, lda,
+                               x, incx, beta, y_block, incy);
+        }
+        else {
+            detail::cblas_gemv(layout, trans, m, end - begin, alpha, a + begin * row_stride, lda,
+                               x, incx, beta, y_block, incy);
+        }
+    });
+}
+
+// A = alpha * x * y^T + A, split into blocks of columns of A in memory order,
+// that is columns for column major and rows for row major.
+template <typename T>
+void host_ger(CBLAS_LAYOUT layout, int64_t m, int64_t n, T alpha, const T *x, int64_t incx,
+              const T *y, int64_t incy, T *a, int64_t lda) {
+    const bool col_major = (layout == CblasColMajor);
+    const int64_t outer = col_major ? n : m;
+    const int64_t num_blocks = detail::level2_num_blocks(outer, col_major ? m : n);
+    if (num_blocks <= 1) {
+        detail::cblas_ger(layout, m, n, alpha, x, incx, y, incy, a, lda);
+        return;
+    }
+    host_parallel_for(num_blocks, [&](int64_t block) {
+        const int64_t begin = block * outer / num_blocks;
+        const int64_t end = (block + 1) * outer / num_blocks;
+        if (col_major) {
+            detail::cblas_ger(layout, m, end - begin, alpha, x, incx,
+                              detail::sub_vector(y, n, incy, begin, end), incy, a + begin * lda,
+                              lda);
+        }
+        else {
+            detail::cblas_ger(layout, end - begin, n, alpha,
+                              detail::sub_vector(x, m, incx, begin, end), incx, y, incy,
+                              a + begin * lda, lda);
+        }
+    });
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_THREADED_HPP_
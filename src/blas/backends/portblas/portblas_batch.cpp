@@ -24,6 +24,8 @@
 #endif
 
 #include "portblas_common.hpp"
+#include "portblas_reduction_batch.hpp"
+#include "portblas_small_gemm.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
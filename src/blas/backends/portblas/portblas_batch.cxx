@@ -172,6 +172,13 @@ void gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::
                 sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
+    if constexpr (is_column_major()) {
+        if (batch_size > 0 && detail::use_small_gemm(m, n, k)) {
+            detail::small_gemm(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+            return;
+        }
+    }
     CALL_PORTBLAS_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a, lda,
                      stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -182,6 +189,13 @@ void gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::
                 sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b, double beta,
                 sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
+    if constexpr (is_column_major()) {
+        if (batch_size > 0 && detail::use_small_gemm(m, n, k)) {
+            detail::small_gemm(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+            return;
+        }
+    }
     CALL_PORTBLAS_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a, lda,
                      stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
@@ -341,6 +355,94 @@ void omatadd_batch(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mk
     throw unimplemented("blas", "omatadd_batch", "");
 }
 
+void dot_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+               std::int64_t stridex, sycl::buffer<float, 1> &y, std::int64_t incy,
+               std::int64_t stridey, sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    detail::reduction_batch<detail::reduction_op::dot, float>(queue, n, x, incx, stridex, y, incy,
+                                                              stridey, result, batch_size, {});
+}
+
+void dot_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+               std::int64_t stridex, sycl::buffer<double, 1> &y, std::int64_t incy,
+               std::int64_t stridey, sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    detail::reduction_batch<detail::reduction_op::dot, double>(queue, n, x, incx, stridex, y, incy,
+                                                               stridey, result, batch_size, {});
+}
+
+void nrm2_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    detail::reduction_batch<detail::reduction_op::nrm2, float>(queue, n, x, incx, stridex, x, incx,
+                                                               stridex, result, batch_size, {});
+}
+
+void nrm2_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+                std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    detail::reduction_batch<detail::reduction_op::nrm2, double>(queue, n, x, incx, stridex, x, incx,
+                                                                stridex, result, batch_size, {});
+}
+
+void nrm2_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1> &result,
+                std::int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "");
+}
+
+void nrm2_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1> &result,
+                std::int64_t batch_size) {
+    throw unimplemented("blas", "nrm2_batch", "");
+}
+
+void asum_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+                std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    detail::reduction_batch<detail::reduction_op::asum, float>(queue, n, x, incx, stridex, x, incx,
+                                                               stridex, result, batch_size, {});
+}
+
+void asum_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+                std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    detail::reduction_batch<detail::reduction_op::asum, double>(queue, n, x, incx, stridex, x, incx,
+                                                                stridex, result, batch_size, {});
+}
+
+void asum_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1> &result,
+                std::int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "");
+}
+
+void asum_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1> &result,
+                std::int64_t batch_size) {
+    throw unimplemented("blas", "asum_batch", "");
+}
+
+void iamax_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+                 std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result,
+                 std::int64_t batch_size) {
+    detail::reduction_batch<detail::reduction_op::iamax, float>(queue, n, x, incx, stridex, x, incx,
+                                                                stridex, result, batch_size, {});
+}
+
+void iamax_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+                 std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result,
+                 std::int64_t batch_size) {
+    detail::reduction_batch<detail::reduction_op::iamax, double>(
+        queue, n, x, incx, stridex, x, incx, stridex, result, batch_size, {});
+}
+
+void iamax_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result,
+                 std::int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "");
+}
+
+void iamax_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result,
+                 std::int64_t batch_size) {
+    throw unimplemented("blas", "iamax_batch", "");
+}
+
 // USM APIs
 
 sycl::event syrk_batch(sycl::queue &queue, oneapi::mkl::uplo *upper_lower,
@@ -707,6 +809,13 @@ sycl::event gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa,
                        std::int64_t stride_b, float beta, float *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        if (batch_size > 0 && detail::use_small_gemm(m, n, k)) {
+            return detail::small_gemm(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                                      ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                                      dependencies);
+        }
+    }
     CALL_PORTBLAS_USM_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a,
                          lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
                          dependencies);
@@ -719,6 +828,13 @@ sycl::event gemm_batch(sycl::queue &queue, oneapi::mkl::transpose transa,
                        std::int64_t stride_b, double beta, double *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        if (batch_size > 0 && detail::use_small_gemm(m, n, k)) {
+            return detail::small_gemm(queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                                      ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                                      dependencies);
+        }
+    }
     CALL_PORTBLAS_USM_FN(::blas::_gemm_strided_batched, queue, transa, transb, m, n, k, alpha, a,
                          lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
                          dependencies);
@@ -931,3 +1047,190 @@ sycl::event omatadd_batch(sycl::queue &queue, oneapi::mkl::transpose transa,
                           std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
     throw unimplemented("blas", "omatadd_batch", " for USM");
 }
+
+sycl::event dot_batch(sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
+                      std::int64_t stridex, const float *y, std::int64_t incy, std::int64_t stridey,
+                      float *result, std::int64_t batch_size,
+                      const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::dot, float>(
+        queue, n, x, incx, stridex, y, incy, stridey, result, batch_size, dependencies);
+}
+
+sycl::event dot_batch(sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+                      std::int64_t stridex, const double *y, std::int64_t incy,
+                      std::int64_t stridey, double *result, std::int64_t batch_size,
+                      const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::dot, double>(
+        queue, n, x, incx, stridex, y, incy, stridey, result, batch_size, dependencies);
+}
+
+sycl::event dot_batch(sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx,
+                      const float **y, std::int64_t *incy, float *result, std::int64_t group_count,
+                      std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::dot, float>(
+        queue, n, x, incx, y, incy, result, group_count, group_size, dependencies);
+}
+
+sycl::event dot_batch(sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx,
+                      const double **y, std::int64_t *incy, double *result,
+                      std::int64_t group_count, std::int64_t *group_size,
+                      const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::dot, double>(
+        queue, n, x, incx, y, incy, result, group_count, group_size, dependencies);
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
+                       std::int64_t stridex, float *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::nrm2, float>(
+        queue, n, x, incx, stridex, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+                       std::int64_t stridex, double *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::nrm2, double>(
+        queue, n, x, incx, stridex, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
+                       std::int64_t incx, std::int64_t stridex, float *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
+                       std::int64_t incx, std::int64_t stridex, double *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx,
+                       float *result, std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::nrm2, float>(
+        queue, n, x, incx, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx,
+                       double *result, std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::nrm2, double>(
+        queue, n, x, incx, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, std::int64_t *n, const std::complex<float> **x,
+                       std::int64_t *incx, float *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "");
+}
+
+sycl::event nrm2_batch(sycl::queue &queue, std::int64_t *n, const std::complex<double> **x,
+                       std::int64_t *incx, double *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "nrm2_batch", "");
+}
+
+sycl::event asum_batch(sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
+                       std::int64_t stridex, float *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::asum, float>(
+        queue, n, x, incx, stridex, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+                       std::int64_t stridex, double *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::asum, double>(
+        queue, n, x, incx, stridex, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
+                       std::int64_t incx, std::int64_t stridex, float *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "");
+}
+
+sycl::event asum_batch(sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
+                       std::int64_t incx, std::int64_t stridex, double *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "");
+}
+
+sycl::event asum_batch(sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx,
+                       float *result, std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::asum, float>(
+        queue, n, x, incx, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx,
+                       double *result, std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::asum, double>(
+        queue, n, x, incx, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(sycl::queue &queue, std::int64_t *n, const std::complex<float> **x,
+                       std::int64_t *incx, float *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "");
+}
+
+sycl::event asum_batch(sycl::queue &queue, std::int64_t *n, const std::complex<double> **x,
+                       std::int64_t *incx, double *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "asum_batch", "");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx,
+                        std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::iamax, float>(
+        queue, n, x, incx, stridex, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+                        std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::iamax, double>(
+        queue, n, x, incx, stridex, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
+                        std::int64_t incx, std::int64_t stridex, std::int64_t *result,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, std::int64_t n, const std::complex<double> *x,
+                        std::int64_t incx, std::int64_t stridex, std::int64_t *result,
+                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx,
+                        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::iamax, float>(
+        queue, n, x, incx, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx,
+                        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return detail::reduction_batch<detail::reduction_op::iamax, double>(
+        queue, n, x, incx, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(sycl::queue &queue, std::int64_t *n, const std::complex<float> **x,
+                        std::int64_t *incx, std::int64_t *result, std::int64_t group_count,
+                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "");
+}
+
+sycl::event iamax_batch(sycl::queue &queue, std::int64_t *n, const std::complex<double> **x,
+                        std::int64_t *incx, std::int64_t *result, std::int64_t group_count,
+                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "iamax_batch", "");
+}
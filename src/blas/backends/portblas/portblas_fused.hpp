@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_FUSED_HPP_
+#define _PORTBLAS_FUSED_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "portblas_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+/** Fused level-1 kernels.
+ *
+ *  axpy_dot, axpby_nrm2 and dot2 read their vectors once: the first kernel
+ *  updates y where needed and reduces each work-group's share of the vectors
+ *  to one partial result (two for dot2), and a single work-item then adds the
+ *  partial results in group order. The number of groups depends only on n,
+ *  so the result does not depend on scheduling.
+**/
+constexpr std::int64_t fused_wg_size = 256;
+constexpr std::int64_t fused_max_groups = 256;
+
+enum class fused_op { axpy_dot, axpby_nrm2, dot2 };
+
+inline std::int64_t fused_num_groups(std::int64_t n) {
+    return std::clamp<std::int64_t>((n + fused_wg_size - 1) / fused_wg_size, 1, fused_max_groups);
+}
+
+// Offset of the first element of a vector of n elements with increment inc.
+inline std::int64_t fused_offset(std::int64_t n, std::int64_t inc) {
+    return (inc < 0 && n > 0) ? (1 - n) * inc : 0;
+}
+
+template <sycl::access::mode Mode, typename T>
+inline T* fused_access(sycl::handler&, T* x) {
+    return x;
+}
+
+template <sycl::access::mode Mode, typename T>
+inline auto fused_access(sycl::handler& cgh, sycl::buffer<T, 1>& x) {
+    return x.template get_access<Mode>(cgh);
+}
+
+/** Reduces the share of work-group g to partials[2 * g] (and partials[2 * g + 1]
+ *  for dot2). For axpy_dot and axpby_nrm2, y is updated first.
+ *
+ *  @tparam AccX, AccY, AccZ are USM pointers or SYCL accessors.
+**/
+template <fused_op Op, typename T, typename AccX, typename AccY, typename AccZ>
+struct fused_partial_kernel {
+    AccX x;
+    AccY y;
+    AccZ z;
+    std::int64_t n;
+    std::int64_t off_x, inc_x, off_y, inc_y, off_z, inc_z;
+    T alpha, beta;
+    T* partials;
+
+    void operator()(sycl::nd_item<1> item) const {
+        T acc0 = T(0), acc1 = T(0);
+        const std::int64_t stride = item.get_global_range(0);
+        for (std::int64_t i = item.get_global_id(0); i < n; i += stride) {
+            const T x_i = x[off_x + i * inc_x];
+            if constexpr (Op == fused_op::dot2) {
+                acc0 += x_i * y[off_y + i * inc_y];
+                acc1 += x_i * z[off_z + i * inc_z];
+            }
+            else {
+                const std::int64_t y_idx = off_y + i * inc_y;
+                const T v = (Op == fused_op::axpy_dot) ? alpha * x_i + y[y_idx]
+                                                       : alpha * x_i + beta * y[y_idx];
+                y[y_idx] = v;
+                acc0 += (Op == fused_op::axpy_dot) ? v * z[off_z + i * inc_z] : v * v;
+            }
+        }
+        const auto group = item.get_group();
+        acc0 = sycl::reduce_over_group(group, acc0, sycl::plus<T>());
+        if constexpr (Op == fused_op::dot2) {
+            acc1 = sycl::reduce_over_group(group, acc1, sycl::plus<T>());
+        }
+        if (item.get_local_id(0) == 0) {
+            partials[2 * item.get_group(0)] = acc0;
+            partials[2 * item.get_group(0) + 1] = acc1;
+        }
+    }
+};
+
+/** Adds the partial results in group order and writes the final result.
+ *
+ *  @tparam AccR is a USM pointer or a SYCL accessor.
+**/
+template <fused_op Op, typename T, typename AccR>
+struct fused_final_kernel {
+    const T* partials;
+    std::int64_t num_groups;
+    AccR result;
+
+    void operator()() const {
+        T sum0 = T(0), sum1 = T(0);
+        for (std::int64_t g = 0; g < num_groups; ++g) {
+            sum0 += partials[2 * g];
+            sum1 += partials[2 * g + 1];
+        }
+        if constexpr (Op == fused_op::axpby_nrm2) {
+            result[0] = sycl::sqrt(sum0);
+        }
+        else {
+            result[0] = sum0;
+        }
+        if constexpr (Op == fused_op::dot2) {
+            result[1] = sum1;
+        }
+    }
+};
+
+/** Fused level-1 driver. x, y, z and result are either USM pointers or
+ *  buffers; y is only read for dot2 and z is not used by axpby_nrm2. The
+ *  partial results are kept in device memory freed once result is written.
+**/
+template <fused_op Op, typename T, typename XType, typename YType, typename ZType,
+          typename RType>
+sycl::event fused_level1(sycl::queue& queue, std::int64_t n, T alpha, XType& x,
+                         std::int64_t incx, T beta, YType& y, std::int64_t incy, ZType& z,
+                         std::int64_t incz, RType& result,
+                         const std::vector<sycl::event>& dependencies) {
+    throw_if_unsupported_by_device<double, sycl::aspect::fp64>{}(
+        " portBLAS function requiring fp64 support", queue, T{});
+    constexpr auto y_mode = (Op == fused_op::dot2) ? sycl::access::mode::read
+                                                   : sycl::access::mode::read_write;
+    const std::int64_t num_groups = fused_num_groups(n);
+    T* partials = sycl::malloc_device<T>(2 * num_groups, queue);
+    if (!partials) {
+        throw device_bad_alloc("blas", "fused level-1", queue.get_device());
+    }
+
+    sycl::event done;
+    try {
+        auto reduced = queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            auto x_acc = fused_access<sycl::access::mode::read>(cgh, x);
+            auto y_acc = fused_access<y_mode>(cgh, y);
+            auto z_acc = fused_access<sycl::access::mode::read>(cgh, z);
+            using kernel_t =
+                fused_partial_kernel<Op, T, decltype(x_acc), decltype(y_acc), decltype(z_acc)>;
+            cgh.parallel_for(
+                sycl::nd_range<1>(num_groups * fused_wg_size, fused_wg_size),
+                kernel_t{ x_acc, y_acc, z_acc, n, fused_offset(n, incx), incx,
+                          fused_offset(n, incy), incy, fused_offset(n, incz), incz, alpha, beta,
+                          partials });
+        });
+        done = queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(reduced);
+            auto result_acc = fused_access<sycl::access::mode::write>(cgh, result);
+            using kernel_t = fused_final_kernel<Op, T, decltype(result_acc)>;
+            cgh.single_task(kernel_t{ partials, num_groups, result_acc });
+        });
+    }
+    catch (...) {
+        queue.wait();
+        sycl::free(partials, queue);
+        throw;
+    }
+
+    auto context = queue.get_context();
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(done);
+        cgh.host_task([=]() { sycl::free(partials, context); });
+    });
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_PORTBLAS_FUSED_HPP_
@@ -0,0 +1,354 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_GEMM_EPILOGUE_HPP_
+#define _PORTBLAS_GEMM_EPILOGUE_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "portblas_common.hpp"
+#include "../gemm_epilogue.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+/** gemm with a fused epilogue.
+ *
+ *  portBLAS does not expose the write-back of its gemm kernels. Large products
+ *  are computed by the portBLAS gemm, into C or, when C has another type than
+ *  the product, into a temporary matrix, and a single elementwise pass then
+ *  applies the epilogue and the conversion to the type of C. Below
+ *  epilogue_portblas_min_flops multiply-adds the second launch, and the
+ *  temporary matrix, are expected to cost more than the portBLAS gemm saves,
+ *  so gemm_epilogue runs its own tiled kernel: a work-group of epilogue_wg x
+ *  epilogue_wg work-items computes an epilogue_tile x epilogue_tile block of a
+ *  column-major C, staging epilogue_tile_k columns of A and rows of B at a time
+ *  in local memory, and each work-item accumulates a strided register tile.
+ *  The epilogue and the conversion to the type of C are applied to the
+ *  registers before the only store to C. A row-major product is computed as
+ *  C^T = op(B)^T * op(A)^T.
+**/
+constexpr std::int64_t epilogue_portblas_min_flops = std::int64_t(1) << 24;
+constexpr int epilogue_tile = 32;
+constexpr int epilogue_tile_k = 16;
+constexpr int epilogue_wg = 8;
+
+template <sycl::access::mode Mode, typename T>
+inline T* epilogue_access(sycl::handler&, T* x) {
+    return x;
+}
+
+template <sycl::access::mode Mode, typename T>
+inline auto epilogue_access(sycl::handler& cgh, sycl::buffer<T, 1>& x) {
+    return x.template get_access<Mode>(cgh);
+}
+
+inline bool use_portblas_gemm_epilogue(std::int64_t m, std::int64_t n, std::int64_t k) {
+    return m > 0 && n > 0 && k > 0 &&
+           static_cast<double>(m) * n * k >= static_cast<double>(epilogue_portblas_min_flops);
+}
+
+// Column-major portBLAS gemm on buffers or USM pointers.
+template <typename T>
+inline sycl::event epilogue_gemm(sycl::queue& queue, oneapi::mkl::transpose transa,
+                                 oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                                 std::int64_t k, T alpha, sycl::buffer<T, 1>& a, std::int64_t lda,
+                                 sycl::buffer<T, 1>& b, std::int64_t ldb, T beta,
+                                 sycl::buffer<T, 1>& c, std::int64_t ldc,
+                                 const std::vector<sycl::event>&) {
+    handle_t sb_handle(queue);
+    return ::blas::_gemm(sb_handle, convert_to_portblas_type(transa),
+                         convert_to_portblas_type(transb), m, n, k, alpha,
+                         buffer_iterator_t<T>(a), lda, buffer_iterator_t<T>(b), ldb, beta,
+                         buffer_iterator_t<T>(c), ldc)
+        .back();
+}
+
+template <typename T>
+inline sycl::event epilogue_gemm(sycl::queue& queue, oneapi::mkl::transpose transa,
+                                 oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                                 std::int64_t k, T alpha, const T* a, std::int64_t lda,
+                                 const T* b, std::int64_t ldb, T beta, T* c, std::int64_t ldc,
+                                 const std::vector<sycl::event>& dependencies) {
+    handle_t sb_handle(queue);
+    return ::blas::_gemm(sb_handle, convert_to_portblas_type(transa),
+                         convert_to_portblas_type(transb), m, n, k, alpha, a, lda, b, ldb, beta, c,
+                         ldc, dependencies)
+        .back();
+}
+
+/** @tparam AccA, AccB, AccC, AccBias are USM pointers or SYCL accessors.
+ *  T is the type of the product and of the bias, Tc the type of C.
+**/
+template <typename T, typename Tc, typename AccA, typename AccB, typename AccC, typename AccBias>
+struct gemm_epilogue_kernel {
+    static constexpr int reg = epilogue_tile / epilogue_wg;
+    static constexpr int loads = epilogue_tile * epilogue_tile_k / (epilogue_wg * epilogue_wg);
+
+    AccA a;
+    AccB b;
+    AccC c;
+    AccBias bias;
+    sycl::local_accessor<T, 1> a_tile, b_tile;
+    bool trans_a, trans_b;
+    std::int64_t m, n, k;
+    std::int64_t lda, ldb, ldc;
+    T alpha, beta;
+    epilogue::op<T> ep;
+
+    void operator()(sycl::nd_item<2> item) const {
+        const int li = item.get_local_id(0);
+        const int lj = item.get_local_id(1);
+        const int lid = lj * epilogue_wg + li;
+        const std::int64_t i0 = item.get_group(0) * epilogue_tile;
+        const std::int64_t j0 = item.get_group(1) * epilogue_tile;
+        const std::int64_t a_rs = trans_a ? lda : 1;
+        const std::int64_t a_cs = trans_a ? 1 : lda;
+        const std::int64_t b_rs = trans_b ? ldb : 1;
+        const std::int64_t b_cs = trans_b ? 1 : ldb;
+
+        T acc[reg][reg] = {};
+        for (std::int64_t p0 = 0; p0 < k; p0 += epilogue_tile_k) {
+            for (int t = 0; t < loads; ++t) {
+                const int e = lid + t * epilogue_wg * epilogue_wg;
+                const std::int64_t i = i0 + e % epilogue_tile;
+                const std::int64_t pa = p0 + e / epilogue_tile;
+                a_tile[e] = (i < m && pa < k) ? T(a[i * a_rs + pa * a_cs]) : T(0);
+                const std::int64_t pb = p0 + e % epilogue_tile_k;
+                const std::int64_t j = j0 + e / epilogue_tile_k;
+                b_tile[e] = (pb < k && j < n) ? T(b[pb * b_rs + j * b_cs]) : T(0);
+            }
+            sycl::group_barrier(item.get_group());
+#pragma unroll
+            for (int p = 0; p < epilogue_tile_k; ++p) {
+                T a_reg[reg], b_reg[reg];
+#pragma unroll
+                for (int r = 0; r < reg; ++r) {
+                    a_reg[r] = a_tile[p * epilogue_tile + li + r * epilogue_wg];
+                    b_reg[r] = b_tile[(lj + r * epilogue_wg) * epilogue_tile_k + p];
+                }
+#pragma unroll
+                for (int s = 0; s < reg; ++s) {
+#pragma unroll
+                    for (int r = 0; r < reg; ++r)
+                        acc[s][r] += a_reg[r] * b_reg[s];
+                }
+            }
+            sycl::group_barrier(item.get_group());
+        }
+#pragma unroll
+        for (int s = 0; s < reg; ++s) {
+#pragma unroll
+            for (int r = 0; r < reg; ++r) {
+                const std::int64_t i = i0 + li + r * epilogue_wg;
+                const std::int64_t j = j0 + lj + s * epilogue_wg;
+                if (i < m && j < n) {
+                    const std::int64_t idx = i + j * ldc;
+                    T x = alpha * acc[s][r];
+                    if (beta != T(0))
+                        x += beta * T(c[idx]);
+                    c[idx] = Tc(ep(x, bias, i, j));
+                }
+            }
+        }
+    }
+};
+
+/** Applies the epilogue to the m x n product computed by the portBLAS gemm.
+ *  When C has the type of the product, the product is in C and already holds
+ *  beta * C; otherwise p holds alpha * op(A) * op(B) and beta * C is added here.
+ *
+ *  @tparam AccP, AccC, AccBias are USM pointers or SYCL accessors.
+**/
+template <typename T, typename Tc, typename AccP, typename AccC, typename AccBias>
+struct epilogue_pass_kernel {
+    AccP p;
+    AccC c;
+    AccBias bias;
+    std::int64_t ldp, ldc;
+    T beta;
+    epilogue::op<T> ep;
+
+    void operator()(sycl::id<2> id) const {
+        const std::int64_t i = id[0];
+        const std::int64_t j = id[1];
+        const std::int64_t idx = i + j * ldc;
+        T x;
+        if constexpr (std::is_same_v<T, Tc>) {
+            x = c[idx];
+        }
+        else {
+            x = p[i + j * ldp];
+            if (beta != T(0))
+                x += beta * T(c[idx]);
+        }
+        c[idx] = Tc(ep(x, bias, i, j));
+    }
+};
+
+template <typename T, typename Tc, typename PType, typename CType, typename BiasType>
+inline sycl::event epilogue_pass(sycl::queue& queue, std::int64_t m, std::int64_t n, PType& p,
+                                 std::int64_t ldp, T beta, CType& c, std::int64_t ldc,
+                                 BiasType& bias, const epilogue::op<T>& ep,
+                                 const std::vector<sycl::event>& dependencies) {
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto c_acc = epilogue_access<sycl::access::mode::read_write>(cgh, c);
+        auto p_acc = [&]() {
+            if constexpr (std::is_same_v<T, Tc>)
+                return c_acc;
+            else
+                return epilogue_access<sycl::access::mode::read>(cgh, p);
+        }();
+        auto bias_acc = epilogue_access<sycl::access::mode::read>(cgh, bias);
+        using kernel_t = epilogue_pass_kernel<T, Tc, decltype(p_acc), decltype(c_acc),
+                                              decltype(bias_acc)>;
+        cgh.parallel_for(sycl::range<2>(m, n),
+                         kernel_t{ p_acc, c_acc, bias_acc, ldp, ldc, beta, ep });
+    });
+}
+
+/** gemm_epilogue on the portBLAS gemm, for a column-major product. A C of
+ *  another type than the product is computed through a temporary matrix,
+ *  freed, or released, once the epilogue has been applied.
+**/
+template <typename T, typename Tc, typename AType, typename BType, typename CType,
+          typename BiasType>
+inline sycl::event gemm_epilogue_portblas(sycl::queue& queue, oneapi::mkl::transpose transa,
+                                          oneapi::mkl::transpose transb, std::int64_t m,
+                                          std::int64_t n, std::int64_t k, T alpha, AType& a,
+                                          std::int64_t lda, BType& b, std::int64_t ldb, T beta,
+                                          CType& c, std::int64_t ldc, BiasType& bias,
+                                          const epilogue::op<T>& ep,
+                                          const std::vector<sycl::event>& dependencies) {
+    if constexpr (std::is_same_v<T, Tc>) {
+        auto done = epilogue_gemm<T>(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                                     c, ldc, dependencies);
+        return epilogue_pass<T, Tc>(queue, m, n, c, ldc, beta, c, ldc, bias, ep, { done });
+    }
+    else if constexpr (std::is_pointer_v<CType>) {
+        T* product = sycl::malloc_device<T>(m * n, queue);
+        if (!product) {
+            throw device_bad_alloc("blas", "gemm_epilogue", queue.get_device());
+        }
+        sycl::event done;
+        try {
+            auto product_done = epilogue_gemm<T>(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                 ldb, T(0), product, m, dependencies);
+            done = epilogue_pass<T, Tc>(queue, m, n, product, m, beta, c, ldc, bias, ep,
+                                        { product_done });
+        }
+        catch (...) {
+            queue.wait();
+            sycl::free(product, queue);
+            throw;
+        }
+        auto context = queue.get_context();
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(done);
+            cgh.host_task([=]() { sycl::free(product, context); });
+        });
+    }
+    else {
+        sycl::buffer<T, 1> product{ sycl::range<1>(m * n) };
+        epilogue_gemm<T>(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, T(0), product, m,
+                         dependencies);
+        auto done = epilogue_pass<T, Tc>(queue, m, n, product, m, beta, c, ldc, bias, ep, {});
+        // The host task holds the last reference to the product, so that its
+        // destructor does not wait here for the epilogue to finish.
+        return queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(done);
+            cgh.host_task([product]() {});
+        });
+    }
+}
+
+template <typename T, typename Tc, typename AType, typename BType, typename CType,
+          typename BiasType>
+inline sycl::event gemm_epilogue(sycl::queue& queue, bool col_major,
+                                 oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                                 std::int64_t m, std::int64_t n, std::int64_t k, T alpha,
+                                 AType& a, std::int64_t lda, BType& b, std::int64_t ldb, T beta,
+                                 CType& c, std::int64_t ldc, BiasType& bias,
+                                 const oneapi::mkl::epilogue_desc& desc,
+                                 const std::vector<sycl::event>& dependencies) {
+    throw_if_unsupported_by_device<double, sycl::aspect::fp64>{}(
+        " portBLAS function requiring fp64 support", queue, alpha);
+    const epilogue::op<T> ep(desc, col_major);
+    if (!col_major) {
+        std::swap(m, n);
+        std::swap(transa, transb);
+    }
+    if (use_portblas_gemm_epilogue(m, n, k)) {
+        return gemm_epilogue_portblas<T, Tc>(queue, transa, transb, m, n, k, alpha,
+                                             col_major ? a : b, col_major ? lda : ldb,
+                                             col_major ? b : a, col_major ? ldb : lda, beta, c,
+                                             ldc, bias, ep, dependencies);
+    }
+    const std::int64_t groups_m = (std::max<std::int64_t>(m, 0) + epilogue_tile - 1) /
+                                  epilogue_tile;
+    const std::int64_t groups_n = (std::max<std::int64_t>(n, 0) + epilogue_tile - 1) /
+                                  epilogue_tile;
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = epilogue_access<sycl::access::mode::read>(cgh, col_major ? a : b);
+        auto b_acc = epilogue_access<sycl::access::mode::read>(cgh, col_major ? b : a);
+        auto c_acc = epilogue_access<sycl::access::mode::read_write>(cgh, c);
+        auto bias_acc = epilogue_access<sycl::access::mode::read>(cgh, bias);
+        using kernel_t = gemm_epilogue_kernel<T, Tc, decltype(a_acc), decltype(b_acc),
+                                              decltype(c_acc), decltype(bias_acc)>;
+        sycl::local_accessor<T, 1> a_tile(sycl::range<1>(epilogue_tile * epilogue_tile_k), cgh);
+        sycl::local_accessor<T, 1> b_tile(sycl::range<1>(epilogue_tile * epilogue_tile_k), cgh);
+        cgh.parallel_for(
+            sycl::nd_range<2>(sycl::range<2>(groups_m * epilogue_wg, groups_n * epilogue_wg),
+                              sycl::range<2>(epilogue_wg, epilogue_wg)),
+            kernel_t{ a_acc,
+                      b_acc,
+                      c_acc,
+                      bias_acc,
+                      a_tile,
+                      b_tile,
+                      transa != oneapi::mkl::transpose::nontrans,
+                      transb != oneapi::mkl::transpose::nontrans,
+                      m,
+                      n,
+                      k,
+                      col_major ? lda : ldb,
+                      col_major ? ldb : lda,
+                      ldc,
+                      alpha,
+                      beta,
+                      ep });
+    });
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_GEMM_EPILOGUE_HPP_
@@ -203,6 +203,27 @@ void swap(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<real_t>,
     throw unimplemented("blas", "swap", " for complex");
 }
 
+void axpy_dot(sycl::queue &queue, std::int64_t n, real_t alpha, sycl::buffer<real_t, 1> &x,
+              std::int64_t incx, sycl::buffer<real_t, 1> &y, std::int64_t incy,
+              sycl::buffer<real_t, 1> &z, std::int64_t incz, sycl::buffer<real_t, 1> &result) {
+    detail::fused_level1<detail::fused_op::axpy_dot>(queue, n, alpha, x, incx, real_t(1), y, incy,
+                                                     z, incz, result, {});
+}
+
+void axpby_nrm2(sycl::queue &queue, std::int64_t n, real_t alpha, sycl::buffer<real_t, 1> &x,
+                std::int64_t incx, real_t beta, sycl::buffer<real_t, 1> &y, std::int64_t incy,
+                sycl::buffer<real_t, 1> &result) {
+    detail::fused_level1<detail::fused_op::axpby_nrm2>(queue, n, alpha, x, incx, beta, y, incy, x,
+                                                       incx, result, {});
+}
+
+void dot2(sycl::queue &queue, std::int64_t n, sycl::buffer<real_t, 1> &x, std::int64_t incx,
+          sycl::buffer<real_t, 1> &y, std::int64_t incy, sycl::buffer<real_t, 1> &z,
+          std::int64_t incz, sycl::buffer<real_t, 1> &result) {
+    detail::fused_level1<detail::fused_op::dot2>(queue, n, real_t(0), x, incx, real_t(0), y, incy,
+                                                 z, incz, result, {});
+}
+
 // USM APIs
 
 sycl::event dotc(sycl::queue &queue, std::int64_t n, const std::complex<real_t> *x,
@@ -408,3 +429,25 @@ sycl::event swap(sycl::queue &queue, std::int64_t n, std::complex<real_t> *x, st
                  const std::vector<sycl::event> &dependencies) {
     throw unimplemented("blas", "swap", " for USM");
 }
+
+sycl::event axpy_dot(sycl::queue &queue, std::int64_t n, real_t alpha, const real_t *x,
+                     std::int64_t incx, real_t *y, std::int64_t incy, const real_t *z,
+                     std::int64_t incz, real_t *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return detail::fused_level1<detail::fused_op::axpy_dot>(queue, n, alpha, x, incx, real_t(1), y,
+                                                            incy, z, incz, result, dependencies);
+}
+
+sycl::event axpby_nrm2(sycl::queue &queue, std::int64_t n, real_t alpha, const real_t *x,
+                       std::int64_t incx, real_t beta, real_t *y, std::int64_t incy, real_t *result,
+                       const std::vector<sycl::event> &dependencies) {
+    return detail::fused_level1<detail::fused_op::axpby_nrm2>(queue, n, alpha, x, incx, beta, y,
+                                                              incy, x, incx, result, dependencies);
+}
+
+sycl::event dot2(sycl::queue &queue, std::int64_t n, const real_t *x, std::int64_t incx,
+                 const real_t *y, std::int64_t incy, const real_t *z, std::int64_t incz,
+                 real_t *result, const std::vector<sycl::event> &dependencies) {
+    return detail::fused_level1<detail::fused_op::dot2>(queue, n, real_t(0), x, incx, real_t(0), y,
+                                                        incy, z, incz, result, dependencies);
+}
@@ -24,6 +24,7 @@
 #endif
 
 #include "portblas_common.hpp"
+#include "portblas_fused.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
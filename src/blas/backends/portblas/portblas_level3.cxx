@@ -23,6 +23,13 @@ void gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transp
           std::int64_t m, std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<real_t, 1> &a,
           std::int64_t lda, sycl::buffer<real_t, 1> &b, std::int64_t ldb, real_t beta,
           sycl::buffer<real_t, 1> &c, std::int64_t ldc) {
+    if constexpr (is_column_major()) {
+        if (detail::use_small_gemm(m, n, k)) {
+            detail::small_gemm(queue, transa, transb, m, n, k, alpha, a, lda, 0, b, ldb, 0, beta, c,
+                               ldc, 0, 1);
+            return;
+        }
+    }
     CALL_PORTBLAS_FN(::blas::_gemm, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
                      ldc);
 }
@@ -226,12 +233,107 @@ void omatadd(sycl::queue &queue, transpose transa, transpose transb, std::int64_
     throw unimplemented("blas", "omatadd", "");
 }
 
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<real_t, 1> &a,
+                   std::int64_t lda, sycl::buffer<real_t, 1> &b, std::int64_t ldb, real_t beta,
+                   sycl::buffer<real_t, 1> &c, std::int64_t ldc, std::int64_t levels) {
+    throw unimplemented("blas", "gemm_strassen", "for buffer API");
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+            std::int64_t k, std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1> &a,
+            std::int64_t lda, sycl::buffer<std::complex<real_t>, 1> &b, std::int64_t ldb,
+            std::complex<real_t> beta, sycl::buffer<std::complex<real_t>, 1> &c, std::int64_t ldc) {
+    auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };
+    gemm3m::gemm3m(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                   c, ldc, {}, gemm_usm);
+}
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, real_t alpha, sycl::buffer<real_t, 1> &a, std::int64_t lda,
+          sycl::buffer<real_t, 1> &b, std::int64_t ldb, real_t beta, sycl::buffer<real_t, 1> &c,
+          std::int64_t ldc, compute_mode mode) {
+    // portBLAS has no bfloat16 kernels, the compute mode falls back to the default.
+    gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+          std::int64_t k, std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1> &a,
+          std::int64_t lda, sycl::buffer<std::complex<real_t>, 1> &b, std::int64_t ldb,
+          std::complex<real_t> beta, sycl::buffer<std::complex<real_t>, 1> &c, std::int64_t ldc,
+          compute_mode mode) {
+    if (mode == compute_mode::complex_3m || mode == compute_mode::any) {
+        gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        return;
+    }
+    gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <>
+std::int64_t gemm_pack_get_size<real_t>(sycl::queue &queue, pack_matrix which, std::int64_t m,
+                                        std::int64_t n, std::int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+std::int64_t gemm_pack_get_size<std::complex<real_t>>(
+    sycl::queue &queue, pack_matrix which, std::int64_t m, std::int64_t n, std::int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+               std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<real_t, 1> &a,
+               std::int64_t lda, sycl::buffer<real_t, 1> &packed) {
+    packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed, {});
+}
+
+void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+               std::int64_t n, std::int64_t k, std::complex<real_t> alpha,
+               sycl::buffer<std::complex<real_t>, 1> &a, std::int64_t lda,
+               sycl::buffer<std::complex<real_t>, 1> &packed) {
+    packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed, {});
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                  std::int64_t n, std::int64_t k, sycl::buffer<real_t, 1> &packed,
+                  sycl::buffer<real_t, 1> &b, std::int64_t ldb, real_t beta,
+                  sycl::buffer<real_t, 1> &c, std::int64_t ldc) {
+    auto gemm_fn = [](auto &&...args) { return column_major::gemm(args...); };
+    packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb, beta, c,
+                         ldc, gemm_fn);
+}
+
+void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                  std::int64_t n, std::int64_t k, sycl::buffer<std::complex<real_t>, 1> &packed,
+                  sycl::buffer<std::complex<real_t>, 1> &b, std::int64_t ldb,
+                  std::complex<real_t> beta, sycl::buffer<std::complex<real_t>, 1> &c,
+                  std::int64_t ldc) {
+    auto gemm_fn = [](auto &&...args) { return column_major::gemm(args...); };
+    packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb, beta, c,
+                         ldc, gemm_fn);
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<real_t, 1> &a,
+                   std::int64_t lda, sycl::buffer<real_t, 1> &b, std::int64_t ldb, real_t beta,
+                   sycl::buffer<real_t, 1> &c, std::int64_t ldc, sycl::buffer<real_t, 1> &bias,
+                   epilogue_desc epilogue) {
+    detail::gemm_epilogue<real_t, real_t>(queue, is_column_major(), transa, transb, m, n, k, alpha,
+                                          a, lda, b, ldb, beta, c, ldc, bias, epilogue, {});
+}
+
 // USM APIs
 
 sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, real_t alpha, const real_t *a,
                  std::int64_t lda, const real_t *b, std::int64_t ldb, real_t beta, real_t *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        if (detail::use_small_gemm(m, n, k)) {
+            return detail::small_gemm(queue, transa, transb, m, n, k, alpha, a, lda, 0, b, ldb, 0,
+                                      beta, c, ldc, 0, 1, dependencies);
+        }
+    }
     CALL_PORTBLAS_USM_FN(::blas::_gemm, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
                          c, ldc, dependencies);
 }
@@ -421,6 +523,121 @@ sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, std:
                     const std::vector<sycl::event> &dependencies) {
     throw unimplemented("blas", "omatadd", "");
 }
+
+sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                          std::int64_t n, std::int64_t k, real_t alpha, const real_t *a,
+                          std::int64_t lda, const real_t *b, std::int64_t ldb, real_t beta,
+                          real_t *c, std::int64_t ldc, std::int64_t levels,
+                          const std::vector<sycl::event> &dependencies) {
+    if constexpr (is_column_major()) {
+        auto gemm_usm = [](auto &&...args) { return gemm(args...); };
+        return strassen::gemm_strassen(queue, true, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                       beta, c, ldc, levels, dependencies, gemm_usm);
+    }
+    else {
+        throw unimplemented("blas", "gemm_strassen", "for row_major layout");
+    }
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                   std::int64_t n, std::int64_t k, std::complex<real_t> alpha,
+                   const std::complex<real_t> *a, std::int64_t lda, const std::complex<real_t> *b,
+                   std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t> *c,
+                   std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };
+    return gemm3m::gemm3m(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                          beta, c, ldc, dependencies, gemm_usm);
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, real_t alpha, const real_t *a, std::int64_t lda,
+                 const real_t *b, std::int64_t ldb, real_t beta, real_t *c, std::int64_t ldc,
+                 compute_mode mode, const std::vector<sycl::event> &dependencies) {
+    // portBLAS has no bfloat16 kernels, the compute mode falls back to the default.
+    return gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                 std::int64_t n, std::int64_t k, std::complex<real_t> alpha,
+                 const std::complex<real_t> *a, std::int64_t lda, const std::complex<real_t> *b,
+                 std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t> *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    if (mode == compute_mode::complex_3m || mode == compute_mode::any) {
+        return gemm3m(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                      dependencies);
+    }
+    return gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_out_of_core(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                             std::int64_t n, std::int64_t k, real_t alpha, const real_t *a,
+                             std::int64_t lda, const real_t *b, std::int64_t ldb, real_t beta,
+                             real_t *c, std::int64_t ldc, std::int64_t max_memory,
+                             const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, is_column_major(), transa, transb, m, n, k, alpha,
+                                         a, lda, b, ldb, beta, c, ldc, max_memory, dependencies,
+                                         gemm_usm);
+}
+
+sycl::event gemm_out_of_core(
+    sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<real_t> alpha, const std::complex<real_t> *a, std::int64_t lda,
+    const std::complex<real_t> *b, std::int64_t ldb, std::complex<real_t> beta,
+    std::complex<real_t> *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies) {
+    auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };
+    return out_of_core::gemm_out_of_core(queue, is_column_major(), transa, transb, m, n, k, alpha,
+                                         a, lda, b, ldb, beta, c, ldc, max_memory, dependencies,
+                                         gemm_usm);
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                      std::int64_t n, std::int64_t k, real_t alpha, const real_t *a,
+                      std::int64_t lda, real_t *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed,
+                             dependencies);
+}
+
+sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                      std::int64_t n, std::int64_t k, std::complex<real_t> alpha,
+                      const std::complex<real_t> *a, std::int64_t lda, std::complex<real_t> *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return packed_gemm::pack(queue, is_column_major(), which, trans, m, n, k, alpha, a, lda, packed,
+                             dependencies);
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                         std::int64_t n, std::int64_t k, const real_t *packed, const real_t *b,
+                         std::int64_t ldb, real_t beta, real_t *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto gemm_fn = [](auto &&...args) { return column_major::gemm(args...); };
+    return packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb,
+                                beta, c, ldc, gemm_fn, dependencies);
+}
+
+sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, std::int64_t m,
+                         std::int64_t n, std::int64_t k, const std::complex<real_t> *packed,
+                         const std::complex<real_t> *b, std::int64_t ldb, std::complex<real_t> beta,
+                         std::complex<real_t> *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    auto gemm_fn = [](auto &&...args) { return column_major::gemm(args...); };
+    return packed_gemm::compute(queue, is_column_major(), which, trans, m, n, k, packed, b, ldb,
+                                beta, c, ldc, gemm_fn, dependencies);
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                          std::int64_t n, std::int64_t k, real_t alpha, const real_t *a,
+                          std::int64_t lda, const real_t *b, std::int64_t ldb, real_t beta,
+                          real_t *c, std::int64_t ldc, const real_t *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_epilogue<real_t, real_t>(queue, is_column_major(), transa, transb, m, n, k,
+                                                 alpha, a, lda, b, ldb, beta, c, ldc, bias,
+                                                 epilogue, dependencies);
+}
+
 sycl::event omatcopy_batch(sycl::queue &queue, transpose *trans, int64_t *m, int64_t *n,
                            real_t *alpha, const real_t **a, int64_t *lda, real_t **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
@@ -23,6 +23,7 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "portblas_gemm_epilogue.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
@@ -41,6 +42,17 @@ void gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transp
     throw unimplemented("blas", "gemm", " for bfloat16");
 }
 
+void gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa,
+                   oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+                   sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<oneapi::mkl::bfloat16, 1> &c, std::int64_t ldc,
+                   sycl::buffer<float, 1> &bias, oneapi::mkl::epilogue_desc epilogue) {
+    detail::gemm_epilogue<float, oneapi::mkl::bfloat16>(queue, true, transa, transb, m, n, k, alpha,
+                                                        a, lda, b, ldb, beta, c, ldc, bias,
+                                                        epilogue, {});
+}
+
 // USM
 sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
@@ -50,6 +62,17 @@ sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl:
     throw unimplemented("blas", "gemm", " for USM");
 }
 
+sycl::event gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa,
+                          oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const float *a, std::int64_t lda,
+                          const float *b, std::int64_t ldb, float beta, oneapi::mkl::bfloat16 *c,
+                          std::int64_t ldc, const float *bias, oneapi::mkl::epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_epilogue<float, oneapi::mkl::bfloat16>(queue, true, transa, transb, m, n, k,
+                                                               alpha, a, lda, b, ldb, beta, c, ldc,
+                                                               bias, epilogue, dependencies);
+}
+
 } // namespace column_major
 namespace row_major {
 
@@ -62,6 +85,17 @@ void gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transp
     throw unimplemented("blas", "gemm", " for bfloat16");
 }
 
+void gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa,
+                   oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+                   sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+                   sycl::buffer<oneapi::mkl::bfloat16, 1> &c, std::int64_t ldc,
+                   sycl::buffer<float, 1> &bias, oneapi::mkl::epilogue_desc epilogue) {
+    detail::gemm_epilogue<float, oneapi::mkl::bfloat16>(queue, false, transa, transb, m, n, k, alpha,
+                                                        a, lda, b, ldb, beta, c, ldc, bias,
+                                                        epilogue, {});
+}
+
 // USM
 sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
@@ -71,6 +105,17 @@ sycl::event gemm(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl:
     throw unimplemented("blas", "gemm", " for USM");
 }
 
+sycl::event gemm_epilogue(sycl::queue &queue, oneapi::mkl::transpose transa,
+                          oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                          std::int64_t k, float alpha, const float *a, std::int64_t lda,
+                          const float *b, std::int64_t ldb, float beta, oneapi::mkl::bfloat16 *c,
+                          std::int64_t ldc, const float *bias, oneapi::mkl::epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    return detail::gemm_epilogue<float, oneapi::mkl::bfloat16>(queue, false, transa, transb, m, n, k,
+                                                               alpha, a, lda, b, ldb, beta, c, ldc,
+                                                               bias, epilogue, dependencies);
+}
+
 } // namespace row_major
 } // namespace portblas
 } // namespace blas
@@ -24,6 +24,12 @@
 #endif
 
 #include "portblas_common.hpp"
+#include "portblas_gemm_epilogue.hpp"
+#include "portblas_small_gemm.hpp"
+#include "../gemm3m.hpp"
+#include "../gemm_out_of_core.hpp"
+#include "../gemm_pack.hpp"
+#include "../gemm_strassen.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/portblas/onemkl_blas_portblas.hpp"
 
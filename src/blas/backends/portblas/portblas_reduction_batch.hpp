@@ -0,0 +1,310 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_REDUCTION_BATCH_HPP_
+#define _PORTBLAS_REDUCTION_BATCH_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "portblas_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+/** Batched level-1 reductions.
+ *
+ *  Vectors of at most reduction_batch_serial_max elements are reduced by a
+ *  single work-item each, so that a work-group handles as many vectors as it
+ *  has work-items. Longer vectors get one work-group each, sized from n, and
+ *  are reduced with reduce_over_group. In both cases the order of the
+ *  additions only depends on n, so the results are reproducible.
+**/
+constexpr std::int64_t reduction_batch_serial_max = 64;
+constexpr std::int64_t reduction_batch_min_wg_size = 32;
+constexpr std::int64_t reduction_batch_max_wg_size = 256;
+
+enum class reduction_op { dot, nrm2, asum, iamax };
+
+// Work-group size for vectors of n elements, about 8 elements per work-item.
+inline std::int64_t reduction_batch_wg_size(std::int64_t n) {
+    std::int64_t wg_size = reduction_batch_min_wg_size;
+    while (wg_size < reduction_batch_max_wg_size && 8 * wg_size < n) {
+        wg_size *= 2;
+    }
+    return wg_size;
+}
+
+// Element i of vector b of a strided batch. Acc is a USM pointer or an accessor.
+template <typename Acc>
+struct strided_vectors {
+    Acc data;
+    std::int64_t stride, offset, inc;
+
+    auto operator()(std::int64_t b, std::int64_t i) const {
+        return data[b * stride + offset + i * inc];
+    }
+};
+
+// Element i of vector b of a group of a group batch.
+template <typename T>
+struct pointer_vectors {
+    const T* const* data;
+    std::int64_t offset, inc;
+
+    T operator()(std::int64_t b, std::int64_t i) const {
+        return data[b][offset + i * inc];
+    }
+};
+
+/** Reduction of one vector of the batch, shared by the kernels below.
+ *
+ *  @tparam XVec, YVec are strided_vectors or pointer_vectors. YVec is only
+ *  read by dot.
+ *  @tparam Res is a USM pointer or a SYCL accessor.
+**/
+template <reduction_op Op, typename T, typename XVec, typename YVec, typename Res>
+struct vector_reduction {
+    XVec x;
+    YVec y;
+    Res result;
+    std::int64_t n;
+
+    // Reduces elements start, start + step, ... of vector b, then combines the
+    // partial results of the work-items sharing the vector with group_reduce.
+    template <typename GroupReduce>
+    auto reduce(std::int64_t b, std::int64_t start, std::int64_t step,
+                GroupReduce group_reduce) const {
+        if constexpr (Op == reduction_op::iamax) {
+            // First index of the largest magnitude.
+            T max = T(-1);
+            std::int64_t idx = n;
+            for (std::int64_t i = start; i < n; i += step) {
+                const T v = sycl::fabs(x(b, i));
+                if (v > max) {
+                    max = v;
+                    idx = i;
+                }
+            }
+            const T group_max = group_reduce(max, sycl::maximum<T>());
+            const std::int64_t first =
+                group_reduce(max == group_max ? idx : n, sycl::minimum<std::int64_t>());
+            return first < n ? first : std::int64_t(0);
+        }
+        else {
+            T sum = T(0);
+            for (std::int64_t i = start; i < n; i += step) {
+                const T v = x(b, i);
+                if constexpr (Op == reduction_op::dot) {
+                    sum += v * y(b, i);
+                }
+                else if constexpr (Op == reduction_op::nrm2) {
+                    sum += v * v;
+                }
+                else {
+                    sum += sycl::fabs(v);
+                }
+            }
+            sum = group_reduce(sum, sycl::plus<T>());
+            if constexpr (Op == reduction_op::nrm2) {
+                // The unscaled sum of squares may have overflowed or lost
+                // precision to underflow; sum is the same for the whole group.
+                if (!sycl::isnan(sum) && (!(sum < std::numeric_limits<T>::max()) ||
+                                          sum < std::numeric_limits<T>::min() /
+                                                    std::numeric_limits<T>::epsilon())) {
+                    return scaled_nrm2(b, start, step, group_reduce);
+                }
+                return sycl::sqrt(sum);
+            }
+            else {
+                return sum;
+            }
+        }
+    }
+
+    template <typename GroupReduce>
+    T scaled_nrm2(std::int64_t b, std::int64_t start, std::int64_t step,
+                  GroupReduce group_reduce) const {
+        T scale = T(0);
+        for (std::int64_t i = start; i < n; i += step) {
+            scale = sycl::fmax(scale, sycl::fabs(x(b, i)));
+        }
+        scale = group_reduce(scale, sycl::maximum<T>());
+        if (!(scale > T(0) && scale <= std::numeric_limits<T>::max())) {
+            return scale;
+        }
+        T ssq = T(0);
+        for (std::int64_t i = start; i < n; i += step) {
+            const T v = x(b, i) / scale;
+            ssq += v * v;
+        }
+        return scale * sycl::sqrt(group_reduce(ssq, sycl::plus<T>()));
+    }
+};
+
+// Reduces vector b into result[b] with work-item b.
+template <typename Reduction>
+struct serial_reduction_batch_kernel {
+    Reduction r;
+
+    void operator()(sycl::id<1> id) const {
+        r.result[id[0]] = r.reduce(id[0], 0, 1, [](auto value, auto) { return value; });
+    }
+};
+
+// Reduces vector b into result[b] with work-group b.
+template <typename Reduction>
+struct group_reduction_batch_kernel {
+    Reduction r;
+
+    void operator()(sycl::nd_item<1> item) const {
+        const auto group = item.get_group();
+        const auto value = r.reduce(item.get_group(0), item.get_local_id(0),
+                                    item.get_local_range(0), [=](auto value, auto op) {
+                                        return sycl::reduce_over_group(group, value, op);
+                                    });
+        if (item.get_local_id(0) == 0) {
+            r.result[item.get_group(0)] = value;
+        }
+    }
+};
+
+template <reduction_op Op, typename T, typename XVec, typename YVec, typename Res>
+inline void submit_reduction_batch(sycl::handler& cgh, std::int64_t n, XVec x, YVec y,
+                                   Res result, std::int64_t batch_size) {
+    using reduction_t = vector_reduction<Op, T, XVec, YVec, Res>;
+    const reduction_t reduction{ x, y, result, n };
+    if (n <= reduction_batch_serial_max) {
+        cgh.parallel_for(sycl::range<1>(batch_size),
+                         serial_reduction_batch_kernel<reduction_t>{ reduction });
+    }
+    else {
+        const std::int64_t wg_size = reduction_batch_wg_size(n);
+        cgh.parallel_for(sycl::nd_range<1>(batch_size * wg_size, wg_size),
+                         group_reduction_batch_kernel<reduction_t>{ reduction });
+    }
+}
+
+// Number of elements to reduce and offset of the first element of a vector
+// of n elements with increment inc. nrm2 and asum ignore the sign of inc, as
+// the single-vector routines of this backend do, and iamax returns 0 for a
+// non-positive inc, as in BLAS.
+template <reduction_op Op>
+inline void reduction_batch_vector(std::int64_t& n, std::int64_t& inc, std::int64_t& offset) {
+    offset = 0;
+    if constexpr (Op == reduction_op::dot) {
+        if (inc < 0 && n > 0) {
+            offset = (1 - n) * inc;
+        }
+    }
+    else if constexpr (Op == reduction_op::iamax) {
+        if (inc <= 0) {
+            n = 0;
+        }
+    }
+    else {
+        inc = std::abs(inc);
+    }
+}
+
+template <sycl::access::mode Mode, typename T>
+inline T* reduction_batch_access(sycl::handler&, T* x) {
+    return x;
+}
+
+template <sycl::access::mode Mode, typename T>
+inline auto reduction_batch_access(sycl::handler& cgh, sycl::buffer<T, 1>& x) {
+    return x.template get_access<Mode>(cgh);
+}
+
+/** Strided batch driver. x, y and result are either USM pointers or buffers;
+ *  y is only read by dot, other operations may pass x again.
+**/
+template <reduction_op Op, typename T, typename XType, typename YType, typename RType>
+sycl::event reduction_batch(sycl::queue& queue, std::int64_t n, XType& x, std::int64_t incx,
+                            std::int64_t stridex, YType& y, std::int64_t incy,
+                            std::int64_t stridey, RType& result, std::int64_t batch_size,
+                            const std::vector<sycl::event>& dependencies) {
+    throw_if_unsupported_by_device<double, sycl::aspect::fp64>{}(
+        " portBLAS function requiring fp64 support", queue, T{});
+    std::int64_t n_x = n, n_y = n, offset_x, offset_y;
+    reduction_batch_vector<Op>(n_x, incx, offset_x);
+    reduction_batch_vector<Op>(n_y, incy, offset_y);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        auto x_acc = reduction_batch_access<sycl::access::mode::read>(cgh, x);
+        auto y_acc = reduction_batch_access<sycl::access::mode::read>(cgh, y);
+        auto result_acc = reduction_batch_access<sycl::access::mode::write>(cgh, result);
+        submit_reduction_batch<Op, T>(
+            cgh, n_x, strided_vectors<decltype(x_acc)>{ x_acc, stridex, offset_x, incx },
+            strided_vectors<decltype(y_acc)>{ y_acc, stridey, offset_y, incy }, result_acc,
+            batch_size);
+    });
+}
+
+/** Group batch driver. One kernel is submitted per group. The x and y pointer
+ *  arrays must be accessible on the device; the group parameters are read on
+ *  the host.
+**/
+template <reduction_op Op, typename T, typename R>
+sycl::event reduction_batch(sycl::queue& queue, const std::int64_t* n, const T** x,
+                            const std::int64_t* incx, const T** y, const std::int64_t* incy,
+                            R* result, std::int64_t group_count, const std::int64_t* group_size,
+                            const std::vector<sycl::event>& dependencies) {
+    throw_if_unsupported_by_device<double, sycl::aspect::fp64>{}(
+        " portBLAS function requiring fp64 support", queue, T{});
+    std::vector<sycl::event> groups_done;
+    std::int64_t first = 0;
+    for (std::int64_t g = 0; g < group_count; ++g) {
+        std::int64_t n_x = n[g], n_y = n[g], inc_x = incx[g], inc_y = incy[g], offset_x,
+                     offset_y;
+        reduction_batch_vector<Op>(n_x, inc_x, offset_x);
+        reduction_batch_vector<Op>(n_y, inc_y, offset_y);
+        groups_done.push_back(queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            submit_reduction_batch<Op, T>(
+                cgh, n_x, pointer_vectors<T>{ x + first, offset_x, inc_x },
+                pointer_vectors<T>{ y + first, offset_y, inc_y }, result + first, group_size[g]);
+        }));
+        first += group_size[g];
+    }
+    // A single group needs no join. Otherwise the group events are joined by an
+    // empty kernel, which unlike a host task does not wait for a host thread.
+    if (groups_done.size() == 1)
+        return groups_done.front();
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.depends_on(groups_done);
+        cgh.single_task([]() {});
+    });
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_REDUCTION_BATCH_HPP_
@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _PORTBLAS_SMALL_GEMM_HPP_
+#define _PORTBLAS_SMALL_GEMM_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "portblas_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace portblas {
+namespace detail {
+
+/** Small-matrix gemm kernels.
+ *
+ *  portBLAS tiles gemm for large problems, so a product where m, n and k are
+ *  all at most small_gemm_max_size spends most of its time in launch and tile
+ *  bookkeeping. Those problems are instead computed by a kernel instantiated
+ *  for the smallest (M, N, K) size bucket that holds them: each work-item owns
+ *  a register tile of C and the k loop has a compile-time trip count so it can
+ *  be fully unrolled. Only column-major real gemm is handled here.
+**/
+constexpr std::int64_t small_gemm_min_bucket = 4;
+constexpr std::int64_t small_gemm_max_size = 32;
+
+inline bool use_small_gemm(std::int64_t m, std::int64_t n, std::int64_t k) {
+    return m > 0 && n > 0 && k >= 0 && m <= small_gemm_max_size && n <= small_gemm_max_size &&
+           k <= small_gemm_max_size;
+}
+
+// Invokes f with the smallest power-of-two bucket in [small_gemm_min_bucket,
+// small_gemm_max_size] that is not smaller than size.
+template <int Bucket = small_gemm_min_bucket, typename F>
+inline void dispatch_small_bucket(std::int64_t size, F&& f) {
+    if constexpr (Bucket >= small_gemm_max_size) {
+        f(std::integral_constant<int, Bucket>{});
+    }
+    else {
+        if (size <= Bucket)
+            f(std::integral_constant<int, Bucket>{});
+        else
+            dispatch_small_bucket<2 * Bucket>(size, std::forward<F>(f));
+    }
+}
+
+/** Computes one RM x RN register tile of C = alpha * op(A) * op(B) + beta * C
+ *  for one matrix of a strided batch.
+ *
+ *  @tparam AccA, AccB, AccC are USM pointers or SYCL accessors.
+ *  The work-item index is (batch entry, tile index within the MB x NB bucket).
+**/
+template <typename T, int MB, int NB, int KB, typename AccA, typename AccB, typename AccC>
+struct small_gemm_kernel {
+    static constexpr int RM = MB < 4 ? MB : 4;
+    static constexpr int RN = NB < 4 ? NB : 4;
+    static constexpr int tiles_m = MB / RM;
+    static constexpr int tiles = tiles_m * (NB / RN);
+
+    AccA a;
+    AccB b;
+    AccC c;
+    bool trans_a, trans_b;
+    std::int64_t m, n, k;
+    std::int64_t lda, ldb, ldc;
+    std::int64_t stride_a, stride_b, stride_c;
+    T alpha, beta;
+
+    void operator()(sycl::id<2> id) const {
+        const std::int64_t batch = id[0];
+        const std::int64_t i0 = (id[1] % tiles_m) * RM;
+        const std::int64_t j0 = (id[1] / tiles_m) * RN;
+        if (i0 >= m || j0 >= n) {
+            return;
+        }
+        const std::int64_t a_off = batch * stride_a;
+        const std::int64_t b_off = batch * stride_b;
+        const std::int64_t c_off = batch * stride_c;
+        const std::int64_t a_rs = trans_a ? lda : 1;
+        const std::int64_t a_cs = trans_a ? 1 : lda;
+        const std::int64_t b_rs = trans_b ? ldb : 1;
+        const std::int64_t b_cs = trans_b ? 1 : ldb;
+
+        // As in reference BLAS, A and B are not read when alpha or k is zero,
+        // so NaN or Inf in them does not reach C.
+        const bool product = alpha != T(0) && k > 0;
+        T acc[RN][RM] = {};
+#pragma unroll
+        for (int p = 0; p < KB; ++p) {
+            if (product && p < k) {
+                T a_reg[RM];
+                T b_reg[RN];
+#pragma unroll
+                for (int i = 0; i < RM; ++i) {
+                    a_reg[i] = (i0 + i < m) ? a[a_off + (i0 + i) * a_rs + p * a_cs] : T(0);
+                }
+#pragma unroll
+                for (int j = 0; j < RN; ++j) {
+                    b_reg[j] = (j0 + j < n) ? b[b_off + p * b_rs + (j0 + j) * b_cs] : T(0);
+                }
+#pragma unroll
+                for (int j = 0; j < RN; ++j) {
+#pragma unroll
+                    for (int i = 0; i < RM; ++i) {
+                        acc[j][i] += a_reg[i] * b_reg[j];
+                    }
+                }
+            }
+        }
+#pragma unroll
+        for (int j = 0; j < RN; ++j) {
+#pragma unroll
+            for (int i = 0; i < RM; ++i) {
+                if (i0 + i < m && j0 + j < n) {
+                    const std::int64_t idx = c_off + (i0 + i) + (j0 + j) * ldc;
+                    const T ab = product ? alpha * acc[j][i] : T(0);
+                    c[idx] = (beta == T(0)) ? ab : ab + beta * c[idx];
+                }
+            }
+        }
+    }
+};
+
+template <typename T, typename AccA, typename AccB, typename AccC>
+inline void submit_small_gemm(sycl::handler& cgh, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              std::int64_t k, T alpha, AccA a, std::int64_t lda,
+                              std::int64_t stride_a, AccB b, std::int64_t ldb,
+                              std::int64_t stride_b, T beta, AccC c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size) {
+    const bool trans_a = (transa != oneapi::mkl::transpose::nontrans);
+    const bool trans_b = (transb != oneapi::mkl::transpose::nontrans);
+    dispatch_small_bucket(m, [&](auto mb) {
+        dispatch_small_bucket(n, [&](auto nb) {
+            dispatch_small_bucket(k, [&](auto kb) {
+                using kernel_t = small_gemm_kernel<T, decltype(mb)::value, decltype(nb)::value,
+                                                   decltype(kb)::value, AccA, AccB, AccC>;
+                cgh.parallel_for(
+                    sycl::range<2>(batch_size, kernel_t::tiles),
+                    kernel_t{ a, b, c, trans_a, trans_b, m, n, k, lda, ldb, ldc, stride_a,
+                              stride_b, stride_c, alpha, beta });
+            });
+        });
+    });
+}
+
+template <typename T>
+inline void small_gemm(sycl::queue& queue, oneapi::mkl::transpose transa,
+                       oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                       std::int64_t k, T alpha, sycl::buffer<T, 1>& a, std::int64_t lda,
+                       std::int64_t stride_a, sycl::buffer<T, 1>& b, std::int64_t ldb,
+                       std::int64_t stride_b, T beta, sycl::buffer<T, 1>& c, std::int64_t ldc,
+                       std::int64_t stride_c, std::int64_t batch_size) {
+    throw_if_unsupported_by_device<double, sycl::aspect::fp64>{}(
+        " portBLAS function requiring fp64 support", queue, alpha);
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        submit_small_gemm(cgh, transa, transb, m, n, k, alpha, a_acc, lda, stride_a, b_acc, ldb,
+                          stride_b, beta, c_acc, ldc, stride_c, batch_size);
+    });
+}
+
+template <typename T>
+inline sycl::event small_gemm(sycl::queue& queue, oneapi::mkl::transpose transa,
+                              oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                              std::int64_t k, T alpha, const T* a, std::int64_t lda,
+                              std::int64_t stride_a, const T* b, std::int64_t ldb,
+                              std::int64_t stride_b, T beta, T* c, std::int64_t ldc,
+                              std::int64_t stride_c, std::int64_t batch_size,
+                              const std::vector<sycl::event>& dependencies) {
+    throw_if_unsupported_by_device<double, sycl::aspect::fp64>{}(
+        " portBLAS function requiring fp64 support", queue, alpha);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        submit_small_gemm(cgh, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                          beta, c, ldc, stride_c, batch_size);
+    });
+}
+
+} // namespace detail
+} // namespace portblas
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif // _PORTBLAS_SMALL_GEMM_HPP_
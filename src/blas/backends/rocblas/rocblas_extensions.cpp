@@ -21,6 +21,9 @@
 
 #include "rocblas_helper.hpp"
 #include "rocblas_task.hpp"
+#include "../gemm_out_of_core.hpp"
+#include "../gemm_pack.hpp"
+#include "../gemm_strassen.hpp"
 
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/rocblas/onemkl_blas_rocblas.hpp"
@@ -212,6 +215,110 @@ OMATADD_LAUNCHER(std::complex<double>, rocblas_zgeam)
 
 #undef OMATADD_LAUNCHER
 
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, int64_t levels) {
+    throw unimplemented("blas", "gemm_strassen", "for buffer API");
+}
+
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, int64_t levels) {
+    throw unimplemented("blas", "gemm_strassen", "for buffer API");
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm3m", "for column_major layout");
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm3m", "for column_major layout");
+}
+
+template <>
+int64_t gemm_pack_get_size<float>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                  int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<double>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                   int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<std::complex<float>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                int64_t n, int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<std::complex<double>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                 int64_t n, int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+#define GEMM_PACK_LAUNCHER(TYPE)                                                                 \
+    void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n, \
+                   int64_t k, TYPE alpha, sycl::buffer<TYPE, 1> &a, int64_t lda,                 \
+                   sycl::buffer<TYPE, 1> &packed) {                                              \
+        packed_gemm::pack(queue, true, which, trans, m, n, k, alpha, a, lda, packed, {});        \
+    }
+
+GEMM_PACK_LAUNCHER(float)
+GEMM_PACK_LAUNCHER(double)
+GEMM_PACK_LAUNCHER(std::complex<float>)
+GEMM_PACK_LAUNCHER(std::complex<double>)
+
+#undef GEMM_PACK_LAUNCHER
+
+#define GEMM_COMPUTE_LAUNCHER(TYPE)                                                               \
+    void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,          \
+                      int64_t n, int64_t k, sycl::buffer<TYPE, 1> &packed,                        \
+                      sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta, sycl::buffer<TYPE, 1> &c, \
+                      int64_t ldc) {                                                              \
+        auto gemm_fn = [](auto &&...args) { return column_major::gemm(args...); };                \
+        packed_gemm::compute(queue, true, which, trans, m, n, k, packed, b, ldb, beta, c, ldc,    \
+                             gemm_fn);                                                            \
+    }
+
+GEMM_COMPUTE_LAUNCHER(float)
+GEMM_COMPUTE_LAUNCHER(double)
+GEMM_COMPUTE_LAUNCHER(std::complex<float>)
+GEMM_COMPUTE_LAUNCHER(std::complex<double>)
+
+#undef GEMM_COMPUTE_LAUNCHER
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, sycl::buffer<double, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
 // USM APIs
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -407,6 +514,111 @@ OMATADD_LAUNCHER_USM(std::complex<double>, rocblas_zgeam)
 
 #undef OMATADD_LAUNCHER_USM
 
+#define GEMM_STRASSEN_LAUNCHER_USM(TYPE)                                                         \
+    sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, \
+                              int64_t n, int64_t k, TYPE alpha, const TYPE *a, int64_t lda,      \
+                              const TYPE *b, int64_t ldb, TYPE beta, TYPE *c, int64_t ldc,       \
+                              int64_t levels, const std::vector<sycl::event> &dependencies) {    \
+        auto gemm_usm = [](auto &&...args) { return gemm(args...); };                            \
+        return strassen::gemm_strassen(queue, true, transa, transb, m, n, k, alpha, a, lda, b,   \
+                                       ldb, beta, c, ldc, levels, dependencies, gemm_usm);       \
+    }
+
+GEMM_STRASSEN_LAUNCHER_USM(float)
+GEMM_STRASSEN_LAUNCHER_USM(double)
+
+#undef GEMM_STRASSEN_LAUNCHER_USM
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                   const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm3m", "for column_major layout");
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                   int64_t lda, const std::complex<double> *b, int64_t ldb,
+                   std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm3m", "for column_major layout");
+}
+
+#define GEMM_OUT_OF_CORE_LAUNCHER_USM(TYPE)                                                       \
+    sycl::event gemm_out_of_core(                                                                 \
+        sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,  \
+        TYPE alpha, const TYPE *a, int64_t lda, const TYPE *b, int64_t ldb, TYPE beta, TYPE *c,   \
+        int64_t ldc, int64_t max_memory, const std::vector<sycl::event> &dependencies) {          \
+        auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };               \
+        return out_of_core::gemm_out_of_core(queue, true, transa, transb, m, n, k, alpha, a, lda, \
+                                             b, ldb, beta, c, ldc, max_memory, dependencies,      \
+                                             gemm_usm);                                           \
+    }
+
+GEMM_OUT_OF_CORE_LAUNCHER_USM(float)
+GEMM_OUT_OF_CORE_LAUNCHER_USM(double)
+GEMM_OUT_OF_CORE_LAUNCHER_USM(std::complex<float>)
+GEMM_OUT_OF_CORE_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM_OUT_OF_CORE_LAUNCHER_USM
+
+#define GEMM_PACK_LAUNCHER_USM(TYPE)                                                         \
+    sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, \
+                          int64_t n, int64_t k, TYPE alpha, const TYPE *a, int64_t lda,      \
+                          TYPE *packed, const std::vector<sycl::event> &dependencies) {      \
+        return packed_gemm::pack(queue, true, which, trans, m, n, k, alpha, a, lda, packed,  \
+                                 dependencies);                                              \
+    }
+
+GEMM_PACK_LAUNCHER_USM(float)
+GEMM_PACK_LAUNCHER_USM(double)
+GEMM_PACK_LAUNCHER_USM(std::complex<float>)
+GEMM_PACK_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM_PACK_LAUNCHER_USM
+
+#define GEMM_COMPUTE_LAUNCHER_USM(TYPE)                                                            \
+    sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,    \
+                             int64_t n, int64_t k, const TYPE *packed, const TYPE *b, int64_t ldb, \
+                             TYPE beta, TYPE *c, int64_t ldc,                                      \
+                             const std::vector<sycl::event> &dependencies) {                       \
+        auto gemm_fn = [](auto &&...args) { return column_major::gemm(args...); };                 \
+        return packed_gemm::compute(queue, true, which, trans, m, n, k, packed, b, ldb, beta, c,   \
+                                    ldc, gemm_fn, dependencies);                                   \
+    }
+
+GEMM_COMPUTE_LAUNCHER_USM(float)
+GEMM_COMPUTE_LAUNCHER_USM(double)
+GEMM_COMPUTE_LAUNCHER_USM(std::complex<float>)
+GEMM_COMPUTE_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM_COMPUTE_LAUNCHER_USM
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                          const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                          const double *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, bfloat16 *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for column_major layout");
+}
+
 } // namespace column_major
 
 namespace row_major {
@@ -553,6 +765,110 @@ OMATADD_LAUNCHER(std::complex<double>, rocblas_zgeam)
 
 #undef OMATADD_LAUNCHER
 
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, int64_t levels) {
+    throw unimplemented("blas", "gemm_strassen", "for buffer API");
+}
+
+void gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, int64_t levels) {
+    throw unimplemented("blas", "gemm_strassen", "for buffer API");
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm3m", "for row_major layout");
+}
+
+void gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm3m", "for row_major layout");
+}
+
+template <>
+int64_t gemm_pack_get_size<float>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                  int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<double>(sycl::queue &queue, pack_matrix which, int64_t m, int64_t n,
+                                   int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<std::complex<float>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                int64_t n, int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+template <>
+int64_t gemm_pack_get_size<std::complex<double>>(sycl::queue &queue, pack_matrix which, int64_t m,
+                                                 int64_t n, int64_t k) {
+    return packed_gemm::packed_size(which, m, n, k);
+}
+
+#define GEMM_PACK_LAUNCHER(TYPE)                                                                 \
+    void gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, int64_t n, \
+                   int64_t k, TYPE alpha, sycl::buffer<TYPE, 1> &a, int64_t lda,                 \
+                   sycl::buffer<TYPE, 1> &packed) {                                              \
+        packed_gemm::pack(queue, false, which, trans, m, n, k, alpha, a, lda, packed, {});       \
+    }
+
+GEMM_PACK_LAUNCHER(float)
+GEMM_PACK_LAUNCHER(double)
+GEMM_PACK_LAUNCHER(std::complex<float>)
+GEMM_PACK_LAUNCHER(std::complex<double>)
+
+#undef GEMM_PACK_LAUNCHER
+
+#define GEMM_COMPUTE_LAUNCHER(TYPE)                                                               \
+    void gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,          \
+                      int64_t n, int64_t k, sycl::buffer<TYPE, 1> &packed,                        \
+                      sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta, sycl::buffer<TYPE, 1> &c, \
+                      int64_t ldc) {                                                              \
+        auto gemm_fn = [](auto &&...args) { return column_major::gemm(args...); };                \
+        packed_gemm::compute(queue, false, which, trans, m, n, k, packed, b, ldb, beta, c, ldc,   \
+                             gemm_fn);                                                            \
+    }
+
+GEMM_COMPUTE_LAUNCHER(float)
+GEMM_COMPUTE_LAUNCHER(double)
+GEMM_COMPUTE_LAUNCHER(std::complex<float>)
+GEMM_COMPUTE_LAUNCHER(std::complex<double>)
+
+#undef GEMM_COMPUTE_LAUNCHER
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
+                   sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+                   int64_t ldc, sycl::buffer<double, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+void gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
+                   sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c,
+                   int64_t ldc, sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
 // USM APIs
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -709,6 +1025,111 @@ OMATADD_LAUNCHER_USM(std::complex<double>, rocblas_zgeam)
 
 #undef OMATADD_LAUNCHER_USM
 
+#define GEMM_STRASSEN_LAUNCHER_USM(TYPE)                                                         \
+    sycl::event gemm_strassen(sycl::queue &queue, transpose transa, transpose transb, int64_t m, \
+                              int64_t n, int64_t k, TYPE alpha, const TYPE *a, int64_t lda,      \
+                              const TYPE *b, int64_t ldb, TYPE beta, TYPE *c, int64_t ldc,       \
+                              int64_t levels, const std::vector<sycl::event> &dependencies) {    \
+        auto gemm_usm = [](auto &&...args) { return gemm(args...); };                            \
+        return strassen::gemm_strassen(queue, false, transa, transb, m, n, k, alpha, a, lda, b,  \
+                                       ldb, beta, c, ldc, levels, dependencies, gemm_usm);       \
+    }
+
+GEMM_STRASSEN_LAUNCHER_USM(float)
+GEMM_STRASSEN_LAUNCHER_USM(double)
+
+#undef GEMM_STRASSEN_LAUNCHER_USM
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                   const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm3m", "for row_major layout");
+}
+
+sycl::event gemm3m(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                   int64_t lda, const std::complex<double> *b, int64_t ldb,
+                   std::complex<double> beta, std::complex<double> *c, int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm3m", "for row_major layout");
+}
+
+#define GEMM_OUT_OF_CORE_LAUNCHER_USM(TYPE)                                                        \
+    sycl::event gemm_out_of_core(                                                                  \
+        sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,   \
+        TYPE alpha, const TYPE *a, int64_t lda, const TYPE *b, int64_t ldb, TYPE beta, TYPE *c,    \
+        int64_t ldc, int64_t max_memory, const std::vector<sycl::event> &dependencies) {           \
+        auto gemm_usm = [](auto &&...args) { return column_major::gemm(args...); };                \
+        return out_of_core::gemm_out_of_core(queue, false, transa, transb, m, n, k, alpha, a, lda, \
+                                             b, ldb, beta, c, ldc, max_memory, dependencies,       \
+                                             gemm_usm);                                            \
+    }
+
+GEMM_OUT_OF_CORE_LAUNCHER_USM(float)
+GEMM_OUT_OF_CORE_LAUNCHER_USM(double)
+GEMM_OUT_OF_CORE_LAUNCHER_USM(std::complex<float>)
+GEMM_OUT_OF_CORE_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM_OUT_OF_CORE_LAUNCHER_USM
+
+#define GEMM_PACK_LAUNCHER_USM(TYPE)                                                         \
+    sycl::event gemm_pack(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m, \
+                          int64_t n, int64_t k, TYPE alpha, const TYPE *a, int64_t lda,      \
+                          TYPE *packed, const std::vector<sycl::event> &dependencies) {      \
+        return packed_gemm::pack(queue, false, which, trans, m, n, k, alpha, a, lda, packed, \
+                                 dependencies);                                              \
+    }
+
+GEMM_PACK_LAUNCHER_USM(float)
+GEMM_PACK_LAUNCHER_USM(double)
+GEMM_PACK_LAUNCHER_USM(std::complex<float>)
+GEMM_PACK_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM_PACK_LAUNCHER_USM
+
+#define GEMM_COMPUTE_LAUNCHER_USM(TYPE)                                                            \
+    sycl::event gemm_compute(sycl::queue &queue, pack_matrix which, transpose trans, int64_t m,    \
+                             int64_t n, int64_t k, const TYPE *packed, const TYPE *b, int64_t ldb, \
+                             TYPE beta, TYPE *c, int64_t ldc,                                      \
+                             const std::vector<sycl::event> &dependencies) {                       \
+        auto gemm_fn = [](auto &&...args) { return column_major::gemm(args...); };                 \
+        return packed_gemm::compute(queue, false, which, trans, m, n, k, packed, b, ldb, beta, c,  \
+                                    ldc, gemm_fn, dependencies);                                   \
+    }
+
+GEMM_COMPUTE_LAUNCHER_USM(float)
+GEMM_COMPUTE_LAUNCHER_USM(double)
+GEMM_COMPUTE_LAUNCHER_USM(std::complex<float>)
+GEMM_COMPUTE_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM_COMPUTE_LAUNCHER_USM
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                          const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
+                          const double *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
+sycl::event gemm_epilogue(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                          const float *b, int64_t ldb, float beta, bfloat16 *c, int64_t ldc,
+                          const float *bias, epilogue_desc epilogue,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_epilogue", "for row_major layout");
+}
+
 } // namespace row_major
 } // namespace rocblas
 } // namespace blas
@@ -74,6 +74,22 @@ GEMM_LAUNCHER(std::complex<double>, rocblas_zgemm)
 
 #undef GEMM_LAUNCHER
 
+// The compute mode is a hint; the default algorithm is always used.
+#define GEMM_COMPUTE_MODE_LAUNCHER(TYPE)                                                        \
+    void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,     \
+              int64_t k, TYPE alpha, sycl::buffer<TYPE, 1> &a, int64_t lda,                     \
+              sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta, sycl::buffer<TYPE, 1> &c,       \
+              int64_t ldc, compute_mode mode) {                                                 \
+        gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);              \
+    }
+
+GEMM_COMPUTE_MODE_LAUNCHER(float)
+GEMM_COMPUTE_MODE_LAUNCHER(double)
+GEMM_COMPUTE_MODE_LAUNCHER(std::complex<float>)
+GEMM_COMPUTE_MODE_LAUNCHER(std::complex<double>)
+
+#undef GEMM_COMPUTE_MODE_LAUNCHER
+
 template <typename Func, typename T_A, typename T_B, typename T_C, typename T_S,
           typename DATATYPE_A, typename DATATYPE_B, typename DATATYPE_C, typename COMPUTETYPE>
 inline void gemm_ex(Func func, DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_C, COMPUTETYPE CT,
@@ -487,6 +503,23 @@ GEMM_LAUNCHER_USM(std::complex<double>, rocblas_zgemm)
 
 #undef GEMM_LAUNCHER_USM
 
+// The compute mode is a hint; the default algorithm is always used.
+#define GEMM_COMPUTE_MODE_LAUNCHER_USM(TYPE)                                                       \
+    sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, \
+                     int64_t k, TYPE alpha, const TYPE *a, int64_t lda, const TYPE *b,             \
+                     int64_t ldb, TYPE beta, TYPE *c, int64_t ldc, compute_mode mode,              \
+                     const std::vector<sycl::event> &dependencies) {                               \
+        return gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,           \
+                    dependencies);                                                                 \
+    }
+
+GEMM_COMPUTE_MODE_LAUNCHER_USM(float)
+GEMM_COMPUTE_MODE_LAUNCHER_USM(double)
+GEMM_COMPUTE_MODE_LAUNCHER_USM(std::complex<float>)
+GEMM_COMPUTE_MODE_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM_COMPUTE_MODE_LAUNCHER_USM
+
 template <typename Func, typename T_A, typename T_B, typename T_C, typename T_S,
           typename DATATYPE_A, typename DATATYPE_B, typename DATATYPE_C, typename COMPUTETYPE>
 inline sycl::event gemm_ex(Func func, DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_C,
@@ -904,6 +937,22 @@ GEMM_LAUNCHER(std::complex<double>, rocblas_zgemm)
 
 #undef GEMM_LAUNCHER
 
+// The compute mode is a hint; the default algorithm is always used.
+#define GEMM_COMPUTE_MODE_LAUNCHER(TYPE)                                                        \
+    void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,     \
+              int64_t k, TYPE alpha, sycl::buffer<TYPE, 1> &a, int64_t lda,                     \
+              sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta, sycl::buffer<TYPE, 1> &c,       \
+              int64_t ldc, compute_mode mode) {                                                 \
+        gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);              \
+    }
+
+GEMM_COMPUTE_MODE_LAUNCHER(float)
+GEMM_COMPUTE_MODE_LAUNCHER(double)
+GEMM_COMPUTE_MODE_LAUNCHER(std::complex<float>)
+GEMM_COMPUTE_MODE_LAUNCHER(std::complex<double>)
+
+#undef GEMM_COMPUTE_MODE_LAUNCHER
+
 template <typename Func, typename T_A, typename T_B, typename T_C, typename T_S,
           typename DATATYPE_A, typename DATATYPE_B, typename DATATYPE_C, typename COMPUTETYPE>
 inline void gemm_ex(Func func, DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_C, COMPUTETYPE CT,
@@ -1190,6 +1239,23 @@ GEMM_LAUNCHER_USM(std::complex<double>, rocblas_zgemm)
 
 #undef GEMM_LAUNCHER_USM
 
+// The compute mode is a hint; the default algorithm is always used.
+#define GEMM_COMPUTE_MODE_LAUNCHER_USM(TYPE)                                                       \
+    sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, \
+                     int64_t k, TYPE alpha, const TYPE *a, int64_t lda, const TYPE *b,             \
+                     int64_t ldb, TYPE beta, TYPE *c, int64_t ldc, compute_mode mode,              \
+                     const std::vector<sycl::event> &dependencies) {                               \
+        return gemm(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,           \
+                    dependencies);                                                                 \
+    }
+
+GEMM_COMPUTE_MODE_LAUNCHER_USM(float)
+GEMM_COMPUTE_MODE_LAUNCHER_USM(double)
+GEMM_COMPUTE_MODE_LAUNCHER_USM(std::complex<float>)
+GEMM_COMPUTE_MODE_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM_COMPUTE_MODE_LAUNCHER_USM
+
 template <typename Func, typename T_A, typename T_B, typename T_C, typename T_S,
           typename DATATYPE_A, typename DATATYPE_B, typename DATATYPE_C, typename COMPUTETYPE>
 inline sycl::event gemm_ex(Func func, DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_C,
@@ -1675,6 +1675,338 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
                                                        beta, b, ldb, c, ldc);
 }
 
+void gemm_strassen(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   std::int64_t levels) {
+    function_tables[libkey].column_major_sgemm_strassen_sycl(queue, transa, transb, m, n, k, alpha,
+                                                             a, lda, b, ldb, beta, c, ldc, levels);
+}
+
+void gemm_strassen(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                   sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
+                   std::int64_t ldb, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   std::int64_t levels) {
+    function_tables[libkey].column_major_dgemm_strassen_sycl(queue, transa, transb, m, n, k, alpha,
+                                                             a, lda, b, ldb, beta, c, ldc, levels);
+}
+
+void gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_cgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                      b, ldb, beta, c, ldc);
+}
+
+void gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_zgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                      b, ldb, beta, c, ldc);
+}
+
+void axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+              sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+              std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    function_tables[libkey].column_major_saxpy_dot_sycl(queue, n, alpha, x, incx, y, incy, z, incz,
+                                                        result);
+}
+
+void axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+              sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+              std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    function_tables[libkey].column_major_daxpy_dot_sycl(queue, n, alpha, x, incx, y, incy, z, incz,
+                                                        result);
+}
+
+void axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
+                std::int64_t incy, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].column_major_saxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                          result);
+}
+
+void axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    function_tables[libkey].column_major_daxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                          result);
+}
+
+void dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+          sycl::buffer<float, 1> &z, std::int64_t incz, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].column_major_sdot2_sycl(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+          std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    function_tables[libkey].column_major_ddot2_sycl(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+               sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+               sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+               sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_sdot_batch_strided_sycl(queue, n, x, incx, stridex, y,
+                                                                 incy, stridey, result, batch_size);
+}
+
+void dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+               sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+               sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
+               sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_ddot_batch_strided_sycl(queue, n, x, incx, stridex, y,
+                                                                 incy, stridey, result, batch_size);
+}
+
+void nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_snrm2_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                  result, batch_size);
+}
+
+void nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_dnrm2_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                  result, batch_size);
+}
+
+void nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_scnrm2_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                   result, batch_size);
+}
+
+void nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_dznrm2_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                   result, batch_size);
+}
+
+void asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_sasum_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                  result, batch_size);
+}
+
+void asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_dasum_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                  result, batch_size);
+}
+
+void asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_scasum_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                   result, batch_size);
+}
+
+void asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_dzasum_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                   result, batch_size);
+}
+
+void iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_isamax_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                   result, batch_size);
+}
+
+void iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_idamax_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                   result, batch_size);
+}
+
+void iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_icamax_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                   result, batch_size);
+}
+
+void iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].column_major_izamax_batch_strided_sycl(queue, n, x, incx, stridex,
+                                                                   result, batch_size);
+}
+
+void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+          std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+          sycl::buffer<float, 1> &c, std::int64_t ldc, compute_mode mode) {
+    function_tables[libkey].column_major_sgemm_compute_mode_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+          std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+          sycl::buffer<double, 1> &c, std::int64_t ldc, compute_mode mode) {
+    function_tables[libkey].column_major_dgemm_compute_mode_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+          sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+          sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, compute_mode mode) {
+    function_tables[libkey].column_major_cgemm_compute_mode_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+          sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+          sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, compute_mode mode) {
+    function_tables[libkey].column_major_zgemm_compute_mode_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+template <>
+std::int64_t gemm_pack_get_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                       pack_matrix which, std::int64_t m, std::int64_t n,
+                                       std::int64_t k) {
+    return function_tables[libkey].column_major_sgemm_pack_get_size_sycl(queue, which, m, n, k);
+}
+
+template <>
+std::int64_t gemm_pack_get_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                        pack_matrix which, std::int64_t m, std::int64_t n,
+                                        std::int64_t k) {
+    return function_tables[libkey].column_major_dgemm_pack_get_size_sycl(queue, which, m, n, k);
+}
+
+template <>
+std::int64_t gemm_pack_get_size<std::complex<float>>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                     pack_matrix which, std::int64_t m,
+                                                     std::int64_t n, std::int64_t k) {
+    return function_tables[libkey].column_major_cgemm_pack_get_size_sycl(queue, which, m, n, k);
+}
+
+template <>
+std::int64_t gemm_pack_get_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, std::int64_t m,
+    std::int64_t n, std::int64_t k) {
+    return function_tables[libkey].column_major_zgemm_pack_get_size_sycl(queue, which, m, n, k);
+}
+
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+               sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &packed) {
+    function_tables[libkey].column_major_sgemm_pack_sycl(queue, which, trans, m, n, k, alpha, a,
+                                                         lda, packed);
+}
+
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+               sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &packed) {
+    function_tables[libkey].column_major_dgemm_pack_sycl(queue, which, trans, m, n, k, alpha, a,
+                                                         lda, packed);
+}
+
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+               sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+               sycl::buffer<std::complex<float>, 1> &packed) {
+    function_tables[libkey].column_major_cgemm_pack_sycl(queue, which, trans, m, n, k, alpha, a,
+                                                         lda, packed);
+}
+
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+               sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+               sycl::buffer<std::complex<double>, 1> &packed) {
+    function_tables[libkey].column_major_zgemm_pack_sycl(queue, which, trans, m, n, k, alpha, a,
+                                                         lda, packed);
+}
+
+void gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                  transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                  sycl::buffer<float, 1> &packed, sycl::buffer<float, 1> &b, std::int64_t ldb,
+                  float beta, sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_sgemm_compute_sycl(queue, which, trans, m, n, k, packed, b,
+                                                            ldb, beta, c, ldc);
+}
+
+void gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                  transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                  sycl::buffer<double, 1> &packed, sycl::buffer<double, 1> &b, std::int64_t ldb,
+                  double beta, sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_dgemm_compute_sycl(queue, which, trans, m, n, k, packed, b,
+                                                            ldb, beta, c, ldc);
+}
+
+void gemm_compute(
+    oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1> &packed,
+    sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_cgemm_compute_sycl(queue, which, trans, m, n, k, packed, b,
+                                                            ldb, beta, c, ldc);
+}
+
+void gemm_compute(
+    oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1> &packed,
+    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].column_major_zgemm_compute_sycl(queue, which, trans, m, n, k, packed, b,
+                                                            ldb, beta, c, ldc);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    function_tables[libkey].column_major_sgemm_epilogue_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                   sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
+                   std::int64_t ldb, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   sycl::buffer<double, 1> &bias, epilogue_desc epilogue) {
+    function_tables[libkey].column_major_dgemm_epilogue_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c, std::int64_t ldc,
+                   sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    function_tables[libkey].column_major_gemm_epilogue_f32f32bf16_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue);
+}
+
 // USM APIs
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
@@ -3862,174 +4194,652 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
         queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
 }
 
-} //namespace detail
-} //namespace column_major
-namespace row_major {
-namespace detail {
+sycl::event gemm_strassen(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          float alpha, const float *a, std::int64_t lda, const float *b,
+                          std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                          std::int64_t levels, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_strassen_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, levels, dependencies);
+}
 
-static oneapi::mkl::detail::table_initializer<domain::blas, blas_function_table_t> function_tables;
+sycl::event gemm_strassen(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          double alpha, const double *a, std::int64_t lda, const double *b,
+                          std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                          std::int64_t levels, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_strassen_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, levels, dependencies);
+}
 
-// Buffer APIs
+sycl::event gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                   const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm3m_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
 
-void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-          sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
-          sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_scasum_sycl(queue, n, x, incx, result);
+sycl::event gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                   const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+                   std::complex<double> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm3m_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
 }
 
-void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-          sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
-          sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dzasum_sycl(queue, n, x, incx, result);
+sycl::event gemm_out_of_core(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_out_of_core_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+        dependencies);
 }
 
-void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
-          std::int64_t incx, sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_sasum_sycl(queue, n, x, incx, result);
+sycl::event gemm_out_of_core(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_out_of_core_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+        dependencies);
 }
 
-void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dasum_sycl(queue, n, x, incx, result);
+sycl::event gemm_out_of_core(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm_out_of_core_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+        dependencies);
 }
 
-void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
-          sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
-          std::int64_t incy) {
-    function_tables[libkey].row_major_saxpy_sycl(queue, n, alpha, x, incx, y, incy);
+sycl::event gemm_out_of_core(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm_out_of_core_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+        dependencies);
 }
 
-void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
-          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
-          std::int64_t incy) {
-    function_tables[libkey].row_major_daxpy_sycl(queue, n, alpha, x, incx, y, incy);
+sycl::event axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                     const float *x, std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                     std::int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_saxpy_dot_usm_sycl(
+        queue, n, alpha, x, incx, y, incy, z, incz, result, dependencies);
 }
 
-void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
-          sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
-          sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_caxpy_sycl(queue, n, alpha, x, incx, y, incy);
+sycl::event axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                     const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                     const double *z, std::int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_daxpy_dot_usm_sycl(
+        queue, n, alpha, x, incx, y, incy, z, incz, result, dependencies);
 }
 
-void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-          std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
-          sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                       const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+                       float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_saxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                     y, incy, result, dependencies);
 }
 
-void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
-                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
-                sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
-                std::int64_t batch_size) {
-    function_tables[libkey].row_major_saxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
-                                                               incy, stridey, batch_size);
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                       const double *x, std::int64_t incx, double beta, double *y,
+                       std::int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_daxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta,
+                                                                     y, incy, result, dependencies);
 }
 
-void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
-                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
-                sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
-                std::int64_t batch_size) {
-    function_tables[libkey].row_major_daxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
-                                                               incy, stridey, batch_size);
+sycl::event dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
+                 std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                 std::int64_t incz, float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sdot2_usm_sycl(queue, n, x, incx, y, incy, z, incz,
+                                                               result, dependencies);
 }
 
-void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-                std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x,
-                std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<float>, 1> &y,
-                std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].row_major_caxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
-                                                               incy, stridey, batch_size);
+sycl::event dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
+                 std::int64_t incx, const double *y, std::int64_t incy, const double *z,
+                 std::int64_t incz, double *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_ddot2_usm_sycl(queue, n, x, incx, y, incy, z, incz,
+                                                               result, dependencies);
 }
 
-void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-                std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x,
-                std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<double>, 1> &y,
-                std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zaxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
-                                                               incy, stridey, batch_size);
+sycl::event dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                      const float *x, std::int64_t incx, std::int64_t stridex, const float *y,
+                      std::int64_t incy, std::int64_t stridey, float *result,
+                      std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sdot_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, y, incy, stridey, result, batch_size, dependencies);
 }
 
-void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
-           sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
-           std::int64_t incy) {
-    function_tables[libkey].row_major_saxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+sycl::event dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                      const double *x, std::int64_t incx, std::int64_t stridex, const double *y,
+                      std::int64_t incy, std::int64_t stridey, double *result,
+                      std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_ddot_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, y, incy, stridey, result, batch_size, dependencies);
 }
 
-void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
-           sycl::buffer<double, 1> &x, std::int64_t incx, double beta, sycl::buffer<double, 1> &y,
-           std::int64_t incy) {
-    function_tables[libkey].row_major_daxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+sycl::event dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                      const float **x, std::int64_t *incx, const float **y, std::int64_t *incy,
+                      float *result, std::int64_t group_count, std::int64_t *group_size,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sdot_batch_group_usm_sycl(
+        queue, n, x, incx, y, incy, result, group_count, group_size, dependencies);
 }
 
-void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
-           std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_caxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+sycl::event dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                      const double **x, std::int64_t *incx, const double **y, std::int64_t *incy,
+                      double *result, std::int64_t group_count, std::int64_t *group_size,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_ddot_batch_group_usm_sycl(
+        queue, n, x, incx, y, incy, result, group_count, group_size, dependencies);
 }
 
-void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
-           std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zaxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const float *x, std::int64_t incx, std::int64_t stridex, float *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_snrm2_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
 }
 
-void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
-          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_scopy_sycl(queue, n, x, incx, y, incy);
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const double *x, std::int64_t incx, std::int64_t stridex, double *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dnrm2_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
 }
 
-void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
-          std::int64_t incy) {
-    function_tables[libkey].row_major_dcopy_sycl(queue, n, x, incx, y, incy);
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                       float *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_scnrm2_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
 }
 
-void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-          sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
-          sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_ccopy_sycl(queue, n, x, incx, y, incy);
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                       double *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dznrm2_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
 }
 
-void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-          sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
-          sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zcopy_sycl(queue, n, x, incx, y, incy);
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const float **x, std::int64_t *incx, float *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_snrm2_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
 }
 
-void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
-                sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
-                std::int64_t batch_size) {
-    function_tables[libkey].row_major_scopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
-                                                               stridey, batch_size);
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const double **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dnrm2_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
 }
 
-void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
-                sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
-                std::int64_t batch_size) {
-    function_tables[libkey].row_major_dcopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
-                                                               stridey, batch_size);
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const std::complex<float> **x, std::int64_t *incx, float *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_scnrm2_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
 }
 
-void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-                sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
-                sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::int64_t stridey,
-                std::int64_t batch_size) {
-    function_tables[libkey].row_major_ccopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
-                                                               stridey, batch_size);
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const std::complex<double> **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dznrm2_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
 }
 
-void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
-                sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
-                sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, std::int64_t stridey,
-                std::int64_t batch_size) {
-    function_tables[libkey].row_major_zcopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
-                                                               stridey, batch_size);
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const float *x, std::int64_t incx, std::int64_t stridex, float *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sasum_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
 }
 
-void dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
-         std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const double *x, std::int64_t incx, std::int64_t stridex, double *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dasum_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                       float *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_scasum_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                       double *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dzasum_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const float **x, std::int64_t *incx, float *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sasum_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const double **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dasum_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const std::complex<float> **x, std::int64_t *incx, float *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_scasum_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const std::complex<double> **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dzasum_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        const float *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_isamax_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        const double *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_idamax_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_icamax_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_izamax_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                        const float **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_isamax_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                        const double **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_idamax_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                        const std::complex<float> **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_icamax_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                        const std::complex<double> **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_izamax_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+                 std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_compute_mode_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+                 std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_compute_mode_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                 const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                 std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm_compute_mode_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                 const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                 std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm_compute_mode_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                      const float *a, std::int64_t lda, float *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_pack_usm_sycl(
+        queue, which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                      const double *a, std::int64_t lda, double *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_pack_usm_sycl(
+        queue, which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                      std::complex<float> *packed, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm_pack_usm_sycl(
+        queue, which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                      std::complex<double> *packed, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm_pack_usm_sycl(
+        queue, which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const float *packed, const float *b, std::int64_t ldb, float beta,
+                         float *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_compute_usm_sycl(
+        queue, which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const double *packed, const double *b, std::int64_t ldb, double beta,
+                         double *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_compute_usm_sycl(
+        queue, which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const std::complex<float> *packed, const std::complex<float> *b,
+                         std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                         std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_cgemm_compute_usm_sycl(
+        queue, which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const std::complex<double> *packed, const std::complex<double> *b,
+                         std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                         std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_zgemm_compute_usm_sycl(
+        queue, which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_epilogue(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, const float *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_sgemm_epilogue_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue,
+        dependencies);
+}
+
+sycl::event gemm_epilogue(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc, const double *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_dgemm_epilogue_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue,
+        dependencies);
+}
+
+sycl::event gemm_epilogue(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, bfloat16 *c, std::int64_t ldc, const float *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].column_major_gemm_epilogue_f32f32bf16_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue,
+        dependencies);
+}
+
+} //namespace detail
+} //namespace column_major
+namespace row_major {
+namespace detail {
+
+static oneapi::mkl::detail::table_initializer<domain::blas, blas_function_table_t> function_tables;
+
+// Buffer APIs
+
+void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_scasum_sycl(queue, n, x, incx, result);
+}
+
+void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_dzasum_sycl(queue, n, x, incx, result);
+}
+
+void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_sasum_sycl(queue, n, x, incx, result);
+}
+
+void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_dasum_sycl(queue, n, x, incx, result);
+}
+
+void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+          sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+          std::int64_t incy) {
+    function_tables[libkey].row_major_saxpy_sycl(queue, n, alpha, x, incx, y, incy);
+}
+
+void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+          std::int64_t incy) {
+    function_tables[libkey].row_major_daxpy_sycl(queue, n, alpha, x, incx, y, incy);
+}
+
+void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
+          sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    function_tables[libkey].row_major_caxpy_sycl(queue, n, alpha, x, incx, y, incy);
+}
+
+void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    function_tables[libkey].row_major_zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
+}
+
+void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+                std::int64_t batch_size) {
+    function_tables[libkey].row_major_saxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
+                                                               incy, stridey, batch_size);
+}
+
+void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
+                std::int64_t batch_size) {
+    function_tables[libkey].row_major_daxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
+                                                               incy, stridey, batch_size);
+}
+
+void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x,
+                std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<float>, 1> &y,
+                std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    function_tables[libkey].row_major_caxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
+                                                               incy, stridey, batch_size);
+}
+
+void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x,
+                std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<double>, 1> &y,
+                std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+    function_tables[libkey].row_major_zaxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
+                                                               incy, stridey, batch_size);
+}
+
+void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+           sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
+           std::int64_t incy) {
+    function_tables[libkey].row_major_saxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+           sycl::buffer<double, 1> &x, std::int64_t incx, double beta, sycl::buffer<double, 1> &y,
+           std::int64_t incy) {
+    function_tables[libkey].row_major_daxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+           std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    function_tables[libkey].row_major_caxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+           std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    function_tables[libkey].row_major_zaxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+}
+
+void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy) {
+    function_tables[libkey].row_major_scopy_sycl(queue, n, x, incx, y, incy);
+}
+
+void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+          std::int64_t incy) {
+    function_tables[libkey].row_major_dcopy_sycl(queue, n, x, incx, y, incy);
+}
+
+void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+          sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+    function_tables[libkey].row_major_ccopy_sycl(queue, n, x, incx, y, incy);
+}
+
+void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+          sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+    function_tables[libkey].row_major_zcopy_sycl(queue, n, x, incx, y, incy);
+}
+
+void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+                std::int64_t batch_size) {
+    function_tables[libkey].row_major_scopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
+                                                               stridey, batch_size);
+}
+
+void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
+                std::int64_t batch_size) {
+    function_tables[libkey].row_major_dcopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
+                                                               stridey, batch_size);
+}
+
+void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::int64_t stridey,
+                std::int64_t batch_size) {
+    function_tables[libkey].row_major_ccopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
+                                                               stridey, batch_size);
+}
+
+void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, std::int64_t stridey,
+                std::int64_t batch_size) {
+    function_tables[libkey].row_major_zcopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
+                                                               stridey, batch_size);
+}
+
+void dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+         std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
          sycl::buffer<float, 1> &result) {
     function_tables[libkey].row_major_sdot_sycl(queue, n, x, incx, y, incy, result);
 }
@@ -5396,118 +6206,450 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
         stride_c, batch_size);
 }
 
-void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-              std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
-              sycl::buffer<float, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_somatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+              sycl::buffer<float, 1> &b, std::int64_t ldb) {
+    function_tables[libkey].row_major_somatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
+              sycl::buffer<double, 1> &b, std::int64_t ldb) {
+    function_tables[libkey].row_major_domatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+    function_tables[libkey].row_major_comatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+    function_tables[libkey].row_major_zomatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+}
+
+void omatcopy2(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+               std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
+               std::int64_t stridea, sycl::buffer<float, 1> &b, std::int64_t ldb,
+               std::int64_t strideb) {
+    function_tables[libkey].row_major_somatcopy2_sycl(queue, trans, m, n, alpha, a, lda, stridea, b,
+                                                      ldb, strideb);
+}
+
+void omatcopy2(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+               std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
+               std::int64_t stridea, sycl::buffer<double, 1> &b, std::int64_t ldb,
+               std::int64_t strideb) {
+    function_tables[libkey].row_major_domatcopy2_sycl(queue, trans, m, n, alpha, a, lda, stridea, b,
+                                                      ldb, strideb);
+}
+
+void omatcopy2(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
+               std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<float>, 1> &b,
+               std::int64_t ldb, std::int64_t strideb) {
+    function_tables[libkey].row_major_comatcopy2_sycl(queue, trans, m, n, alpha, a, lda, stridea, b,
+                                                      ldb, strideb);
+}
+
+void omatcopy2(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
+               std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<double>, 1> &b,
+               std::int64_t ldb, std::int64_t strideb) {
+    function_tables[libkey].row_major_zomatcopy2_sycl(queue, trans, m, n, alpha, a, lda, stridea, b,
+                                                      ldb, strideb);
+}
+
+void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, float alpha, sycl::buffer<float, 1> &ab, std::int64_t lda,
+              std::int64_t ldb) {
+    function_tables[libkey].row_major_simatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, double alpha, sycl::buffer<double, 1> &ab, std::int64_t lda,
+              std::int64_t ldb) {
+    function_tables[libkey].row_major_dimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    function_tables[libkey].row_major_cimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &ab,
+              std::int64_t lda, std::int64_t ldb) {
+    function_tables[libkey].row_major_zimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+}
+
+void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1> &a,
+             std::int64_t lda, float beta, sycl::buffer<float, 1> &b, std::int64_t ldb,
+             sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_somatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                    beta, b, ldb, c, ldc);
+}
+
+void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1> &a,
+             std::int64_t lda, double beta, sycl::buffer<double, 1> &b, std::int64_t ldb,
+             sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_domatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                    beta, b, ldb, c, ldc);
+}
+
+void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<float> alpha,
+             sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
+             sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+             sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_comatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                    beta, b, ldb, c, ldc);
+}
+
+void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+             std::int64_t m, std::int64_t n, std::complex<double> alpha,
+             sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
+             sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+             sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_zomatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
+                                                    beta, b, ldb, c, ldc);
+}
+
+void gemm_strassen(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   std::int64_t levels) {
+    function_tables[libkey].row_major_sgemm_strassen_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                          lda, b, ldb, beta, c, ldc, levels);
+}
+
+void gemm_strassen(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                   sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
+                   std::int64_t ldb, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   std::int64_t levels) {
+    function_tables[libkey].row_major_dgemm_strassen_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                          lda, b, ldb, beta, c, ldc, levels);
+}
+
+void gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_cgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                   ldb, beta, c, ldc);
+}
+
+void gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_zgemm3m_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                                   ldb, beta, c, ldc);
+}
+
+void axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+              sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
+              std::int64_t incy, sycl::buffer<float, 1> &z, std::int64_t incz,
+              sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_saxpy_dot_sycl(queue, n, alpha, x, incx, y, incy, z, incz,
+                                                     result);
+}
+
+void axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+              sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+              std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+              sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_daxpy_dot_sycl(queue, n, alpha, x, incx, y, incy, z, incz,
+                                                     result);
+}
+
+void axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
+                std::int64_t incy, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_saxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                       result);
+}
+
+void axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                sycl::buffer<double, 1> &y, std::int64_t incy, sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_daxpby_nrm2_sycl(queue, n, alpha, x, incx, beta, y, incy,
+                                                       result);
+}
+
+void dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+          sycl::buffer<float, 1> &z, std::int64_t incz, sycl::buffer<float, 1> &result) {
+    function_tables[libkey].row_major_sdot2_sycl(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+          sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
+          std::int64_t incy, sycl::buffer<double, 1> &z, std::int64_t incz,
+          sycl::buffer<double, 1> &result) {
+    function_tables[libkey].row_major_ddot2_sycl(queue, n, x, incx, y, incy, z, incz, result);
+}
+
+void dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+               sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+               sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+               sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_sdot_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
+                                                              stridey, result, batch_size);
+}
+
+void dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+               sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+               sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
+               sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_ddot_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
+                                                              stridey, result, batch_size);
+}
+
+void nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_snrm2_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                               batch_size);
+}
+
+void nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_dnrm2_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                               batch_size);
+}
+
+void nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_scnrm2_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                                batch_size);
+}
+
+void nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_dznrm2_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                                batch_size);
+}
+
+void asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_sasum_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                               batch_size);
+}
+
+void asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_dasum_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                               batch_size);
+}
+
+void asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<float, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_scasum_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                                batch_size);
+}
+
+void asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                sycl::buffer<double, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_dzasum_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                                batch_size);
+}
+
+void iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_isamax_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                                batch_size);
+}
+
+void iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_idamax_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                                batch_size);
+}
+
+void iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_icamax_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                                batch_size);
+}
+
+void iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                 sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
+                 sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size) {
+    function_tables[libkey].row_major_izamax_batch_strided_sycl(queue, n, x, incx, stridex, result,
+                                                                batch_size);
+}
+
+void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+          std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+          sycl::buffer<float, 1> &c, std::int64_t ldc, compute_mode mode) {
+    function_tables[libkey].row_major_sgemm_compute_mode_sycl(queue, transa, transb, m, n, k, alpha,
+                                                              a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+          std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+          sycl::buffer<double, 1> &c, std::int64_t ldc, compute_mode mode) {
+    function_tables[libkey].row_major_dgemm_compute_mode_sycl(queue, transa, transb, m, n, k, alpha,
+                                                              a, lda, b, ldb, beta, c, ldc, mode);
+}
+
+void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+          sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+          sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+          sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, compute_mode mode) {
+    function_tables[libkey].row_major_cgemm_compute_mode_sycl(queue, transa, transb, m, n, k, alpha,
+                                                              a, lda, b, ldb, beta, c, ldc, mode);
 }
 
-void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-              std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
-              sycl::buffer<double, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_domatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+          sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+          sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+          sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, compute_mode mode) {
+    function_tables[libkey].row_major_zgemm_compute_mode_sycl(queue, transa, transb, m, n, k, alpha,
+                                                              a, lda, b, ldb, beta, c, ldc, mode);
 }
 
-void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-              std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
-              std::int64_t lda, sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_comatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+template <>
+std::int64_t gemm_pack_get_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                       pack_matrix which, std::int64_t m, std::int64_t n,
+                                       std::int64_t k) {
+    return function_tables[libkey].row_major_sgemm_pack_get_size_sycl(queue, which, m, n, k);
 }
 
-void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-              std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
-              std::int64_t lda, sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_zomatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+template <>
+std::int64_t gemm_pack_get_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                        pack_matrix which, std::int64_t m, std::int64_t n,
+                                        std::int64_t k) {
+    return function_tables[libkey].row_major_dgemm_pack_get_size_sycl(queue, which, m, n, k);
 }
 
-void omatcopy2(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-               std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
-               std::int64_t stridea, sycl::buffer<float, 1> &b, std::int64_t ldb,
-               std::int64_t strideb) {
-    function_tables[libkey].row_major_somatcopy2_sycl(queue, trans, m, n, alpha, a, lda, stridea, b,
-                                                      ldb, strideb);
+template <>
+std::int64_t gemm_pack_get_size<std::complex<float>>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                     pack_matrix which, std::int64_t m,
+                                                     std::int64_t n, std::int64_t k) {
+    return function_tables[libkey].row_major_cgemm_pack_get_size_sycl(queue, which, m, n, k);
 }
 
-void omatcopy2(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-               std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
-               std::int64_t stridea, sycl::buffer<double, 1> &b, std::int64_t ldb,
-               std::int64_t strideb) {
-    function_tables[libkey].row_major_domatcopy2_sycl(queue, trans, m, n, alpha, a, lda, stridea, b,
-                                                      ldb, strideb);
+template <>
+std::int64_t gemm_pack_get_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, std::int64_t m,
+    std::int64_t n, std::int64_t k) {
+    return function_tables[libkey].row_major_zgemm_pack_get_size_sycl(queue, which, m, n, k);
 }
 
-void omatcopy2(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
-               std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<float>, 1> &b,
-               std::int64_t ldb, std::int64_t strideb) {
-    function_tables[libkey].row_major_comatcopy2_sycl(queue, trans, m, n, alpha, a, lda, stridea, b,
-                                                      ldb, strideb);
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+               sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &packed) {
+    function_tables[libkey].row_major_sgemm_pack_sycl(queue, which, trans, m, n, k, alpha, a, lda,
+                                                      packed);
 }
 
-void omatcopy2(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
-               std::int64_t lda, std::int64_t stridea, sycl::buffer<std::complex<double>, 1> &b,
-               std::int64_t ldb, std::int64_t strideb) {
-    function_tables[libkey].row_major_zomatcopy2_sycl(queue, trans, m, n, alpha, a, lda, stridea, b,
-                                                      ldb, strideb);
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+               sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &packed) {
+    function_tables[libkey].row_major_dgemm_pack_sycl(queue, which, trans, m, n, k, alpha, a, lda,
+                                                      packed);
 }
 
-void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-              std::int64_t n, float alpha, sycl::buffer<float, 1> &ab, std::int64_t lda,
-              std::int64_t ldb) {
-    function_tables[libkey].row_major_simatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+               sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+               sycl::buffer<std::complex<float>, 1> &packed) {
+    function_tables[libkey].row_major_cgemm_pack_sycl(queue, which, trans, m, n, k, alpha, a, lda,
+                                                      packed);
 }
 
-void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-              std::int64_t n, double alpha, sycl::buffer<double, 1> &ab, std::int64_t lda,
-              std::int64_t ldb) {
-    function_tables[libkey].row_major_dimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+void gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+               sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+               sycl::buffer<std::complex<double>, 1> &packed) {
+    function_tables[libkey].row_major_zgemm_pack_sycl(queue, which, trans, m, n, k, alpha, a, lda,
+                                                      packed);
 }
 
-void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-              std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &ab,
-              std::int64_t lda, std::int64_t ldb) {
-    function_tables[libkey].row_major_cimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+void gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                  transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                  sycl::buffer<float, 1> &packed, sycl::buffer<float, 1> &b, std::int64_t ldb,
+                  float beta, sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_sgemm_compute_sycl(queue, which, trans, m, n, k, packed, b,
+                                                         ldb, beta, c, ldc);
 }
 
-void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
-              std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &ab,
-              std::int64_t lda, std::int64_t ldb) {
-    function_tables[libkey].row_major_zimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+void gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                  transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                  sycl::buffer<double, 1> &packed, sycl::buffer<double, 1> &b, std::int64_t ldb,
+                  double beta, sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_dgemm_compute_sycl(queue, which, trans, m, n, k, packed, b,
+                                                         ldb, beta, c, ldc);
 }
 
-void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
-             std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1> &a,
-             std::int64_t lda, float beta, sycl::buffer<float, 1> &b, std::int64_t ldb,
-             sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_somatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                    beta, b, ldb, c, ldc);
+void gemm_compute(
+    oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1> &packed,
+    sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_cgemm_compute_sycl(queue, which, trans, m, n, k, packed, b,
+                                                         ldb, beta, c, ldc);
 }
 
-void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
-             std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1> &a,
-             std::int64_t lda, double beta, sycl::buffer<double, 1> &b, std::int64_t ldb,
-             sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_domatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                    beta, b, ldb, c, ldc);
+void gemm_compute(
+    oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1> &packed,
+    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+    function_tables[libkey].row_major_zgemm_compute_sycl(queue, which, trans, m, n, k, packed, b,
+                                                         ldb, beta, c, ldc);
 }
 
-void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
-             std::int64_t m, std::int64_t n, std::complex<float> alpha,
-             sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
-             sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
-             sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_comatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                    beta, b, ldb, c, ldc);
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc,
+                   sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    function_tables[libkey].row_major_sgemm_epilogue_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue);
 }
 
-void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
-             std::int64_t m, std::int64_t n, std::complex<double> alpha,
-             sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
-             sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
-             sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zomatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                    beta, b, ldb, c, ldc);
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                   sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
+                   std::int64_t ldb, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc,
+                   sycl::buffer<double, 1> &bias, epilogue_desc epilogue) {
+    function_tables[libkey].row_major_dgemm_epilogue_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue);
+}
+
+void gemm_epilogue(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                   sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
+                   std::int64_t ldb, float beta, sycl::buffer<bfloat16, 1> &c, std::int64_t ldc,
+                   sycl::buffer<float, 1> &bias, epilogue_desc epilogue) {
+    function_tables[libkey].row_major_gemm_epilogue_f32f32bf16_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue);
 }
 
 // USM APIs
@@ -7693,6 +8835,484 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
         queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
 }
 
+sycl::event gemm_strassen(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          float alpha, const float *a, std::int64_t lda, const float *b,
+                          std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                          std::int64_t levels, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_strassen_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, levels, dependencies);
+}
+
+sycl::event gemm_strassen(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          double alpha, const double *a, std::int64_t lda, const double *b,
+                          std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                          std::int64_t levels, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_strassen_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, levels, dependencies);
+}
+
+sycl::event gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                   const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+                   std::complex<float> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm3m_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm3m(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
+                   transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                   std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                   const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+                   std::complex<double> *c, std::int64_t ldc,
+                   const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm3m_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_out_of_core(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_out_of_core_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+        dependencies);
+}
+
+sycl::event gemm_out_of_core(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_out_of_core_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+        dependencies);
+}
+
+sycl::event gemm_out_of_core(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc, std::int64_t max_memory,
+    const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm_out_of_core_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+        dependencies);
+}
+
+sycl::event gemm_out_of_core(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    std::int64_t max_memory, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm_out_of_core_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, max_memory,
+        dependencies);
+}
+
+sycl::event axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                     const float *x, std::int64_t incx, float *y, std::int64_t incy, const float *z,
+                     std::int64_t incz, float *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_saxpy_dot_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                z, incz, result, dependencies);
+}
+
+sycl::event axpy_dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                     const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                     const double *z, std::int64_t incz, double *result,
+                     const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_daxpy_dot_usm_sycl(queue, n, alpha, x, incx, y, incy,
+                                                                z, incz, result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
+                       const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+                       float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_saxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                  incy, result, dependencies);
+}
+
+sycl::event axpby_nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
+                       const double *x, std::int64_t incx, double beta, double *y,
+                       std::int64_t incy, double *result,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_daxpby_nrm2_usm_sycl(queue, n, alpha, x, incx, beta, y,
+                                                                  incy, result, dependencies);
+}
+
+sycl::event dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
+                 std::int64_t incx, const float *y, std::int64_t incy, const float *z,
+                 std::int64_t incz, float *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sdot2_usm_sycl(queue, n, x, incx, y, incy, z, incz,
+                                                            result, dependencies);
+}
+
+sycl::event dot2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
+                 std::int64_t incx, const double *y, std::int64_t incy, const double *z,
+                 std::int64_t incz, double *result, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_ddot2_usm_sycl(queue, n, x, incx, y, incy, z, incz,
+                                                            result, dependencies);
+}
+
+sycl::event dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                      const float *x, std::int64_t incx, std::int64_t stridex, const float *y,
+                      std::int64_t incy, std::int64_t stridey, float *result,
+                      std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sdot_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, y, incy, stridey, result, batch_size, dependencies);
+}
+
+sycl::event dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                      const double *x, std::int64_t incx, std::int64_t stridex, const double *y,
+                      std::int64_t incy, std::int64_t stridey, double *result,
+                      std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_ddot_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, y, incy, stridey, result, batch_size, dependencies);
+}
+
+sycl::event dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                      const float **x, std::int64_t *incx, const float **y, std::int64_t *incy,
+                      float *result, std::int64_t group_count, std::int64_t *group_size,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sdot_batch_group_usm_sycl(
+        queue, n, x, incx, y, incy, result, group_count, group_size, dependencies);
+}
+
+sycl::event dot_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                      const double **x, std::int64_t *incx, const double **y, std::int64_t *incy,
+                      double *result, std::int64_t group_count, std::int64_t *group_size,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_ddot_batch_group_usm_sycl(
+        queue, n, x, incx, y, incy, result, group_count, group_size, dependencies);
+}
+
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const float *x, std::int64_t incx, std::int64_t stridex, float *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_snrm2_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const double *x, std::int64_t incx, std::int64_t stridex, double *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dnrm2_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                       float *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_scnrm2_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                       double *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dznrm2_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const float **x, std::int64_t *incx, float *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_snrm2_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const double **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dnrm2_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const std::complex<float> **x, std::int64_t *incx, float *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_scnrm2_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event nrm2_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const std::complex<double> **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dznrm2_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const float *x, std::int64_t incx, std::int64_t stridex, float *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sasum_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const double *x, std::int64_t incx, std::int64_t stridex, double *result,
+                       std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dasum_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                       float *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_scasum_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                       double *result, std::int64_t batch_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dzasum_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const float **x, std::int64_t *incx, float *result, std::int64_t group_count,
+                       std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sasum_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const double **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dasum_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const std::complex<float> **x, std::int64_t *incx, float *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_scasum_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event asum_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                       const std::complex<double> **x, std::int64_t *incx, double *result,
+                       std::int64_t group_count, std::int64_t *group_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dzasum_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        const float *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_isamax_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        const double *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_idamax_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_icamax_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+                        std::int64_t *result, std::int64_t batch_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_izamax_batch_strided_usm_sycl(
+        queue, n, x, incx, stridex, result, batch_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                        const float **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_isamax_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                        const double **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_idamax_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                        const std::complex<float> **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_icamax_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event iamax_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
+                        const std::complex<double> **x, std::int64_t *incx, std::int64_t *result,
+                        std::int64_t group_count, std::int64_t *group_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_izamax_batch_group_usm_sycl(
+        queue, n, x, incx, result, group_count, group_size, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+                 std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_compute_mode_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+                 std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_compute_mode_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                 const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                 std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm_compute_mode_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode, dependencies);
+}
+
+sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+                 std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                 const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+                 std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                 std::int64_t ldc, compute_mode mode,
+                 const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm_compute_mode_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, mode, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                      const float *a, std::int64_t lda, float *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_pack_usm_sycl(
+        queue, which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                      const double *a, std::int64_t lda, double *packed,
+                      const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_pack_usm_sycl(
+        queue, which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                      std::complex<float> *packed, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm_pack_usm_sycl(
+        queue, which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+}
+
+sycl::event gemm_pack(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                      transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+                      std::complex<double> *packed, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm_pack_usm_sycl(
+        queue, which, trans, m, n, k, alpha, a, lda, packed, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const float *packed, const float *b, std::int64_t ldb, float beta,
+                         float *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_compute_usm_sycl(
+        queue, which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const double *packed, const double *b, std::int64_t ldb, double beta,
+                         double *c, std::int64_t ldc,
+                         const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_compute_usm_sycl(
+        queue, which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const std::complex<float> *packed, const std::complex<float> *b,
+                         std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                         std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_cgemm_compute_usm_sycl(
+        queue, which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_compute(oneapi::mkl::device libkey, sycl::queue &queue, pack_matrix which,
+                         transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                         const std::complex<double> *packed, const std::complex<double> *b,
+                         std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                         std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_zgemm_compute_usm_sycl(
+        queue, which, trans, m, n, k, packed, b, ldb, beta, c, ldc, dependencies);
+}
+
+sycl::event gemm_epilogue(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, const float *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_sgemm_epilogue_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue,
+        dependencies);
+}
+
+sycl::event gemm_epilogue(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
+    const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc, const double *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_dgemm_epilogue_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue,
+        dependencies);
+}
+
+sycl::event gemm_epilogue(
+    oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
+    const float *b, std::int64_t ldb, float beta, bfloat16 *c, std::int64_t ldc, const float *bias,
+    epilogue_desc epilogue, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].row_major_gemm_epilogue_f32f32bf16_usm_sycl(
+        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, bias, epilogue,
+        dependencies);
+}
+
 } //namespace detail
 } //namespace row_major
 } //namespace blas
@@ -1094,6 +1094,194 @@ typedef struct {
                                        std::complex<double> beta,
                                        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                                        sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*column_major_sgemm_strassen_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t levels);
+    void (*column_major_dgemm_strassen_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+        std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+        sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t levels);
+    void (*column_major_cgemm3m_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+        sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*column_major_zgemm3m_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+        sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*column_major_saxpy_dot_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x,
+        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &z,
+        std::int64_t incz, sycl::buffer<float, 1> &result);
+    void (*column_major_daxpy_dot_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x,
+        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+        sycl::buffer<double, 1> &z, std::int64_t incz, sycl::buffer<double, 1> &result);
+    void (*column_major_saxpby_nrm2_sycl)(sycl::queue &queue, std::int64_t n, float alpha,
+                                          sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                          sycl::buffer<float, 1> &y, std::int64_t incy,
+                                          sycl::buffer<float, 1> &result);
+    void (*column_major_daxpby_nrm2_sycl)(sycl::queue &queue, std::int64_t n, double alpha,
+                                          sycl::buffer<double, 1> &x, std::int64_t incx,
+                                          double beta, sycl::buffer<double, 1> &y,
+                                          std::int64_t incy, sycl::buffer<double, 1> &result);
+    void (*column_major_sdot2_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                                    std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                                    sycl::buffer<float, 1> &z, std::int64_t incz,
+                                    sycl::buffer<float, 1> &result);
+    void (*column_major_ddot2_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                                    std::int64_t incx, sycl::buffer<double, 1> &y,
+                                    std::int64_t incy, sycl::buffer<double, 1> &z,
+                                    std::int64_t incz, sycl::buffer<double, 1> &result);
+    void (*column_major_sdot_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+        sycl::buffer<float, 1> &result, std::int64_t batch_size);
+    void (*column_major_ddot_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
+        sycl::buffer<double, 1> &result, std::int64_t batch_size);
+    void (*column_major_snrm2_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size);
+    void (*column_major_dnrm2_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size);
+    void (*column_major_scnrm2_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1> &result,
+        std::int64_t batch_size);
+    void (*column_major_dznrm2_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1> &result,
+        std::int64_t batch_size);
+    void (*column_major_sasum_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size);
+    void (*column_major_dasum_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size);
+    void (*column_major_scasum_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1> &result,
+        std::int64_t batch_size);
+    void (*column_major_dzasum_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1> &result,
+        std::int64_t batch_size);
+    void (*column_major_isamax_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size);
+    void (*column_major_idamax_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size);
+    void (*column_major_icamax_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result,
+        std::int64_t batch_size);
+    void (*column_major_izamax_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result,
+        std::int64_t batch_size);
+    void (*column_major_sgemm_compute_mode_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+    void (*column_major_dgemm_compute_mode_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+        std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+        sycl::buffer<double, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+    void (*column_major_cgemm_compute_mode_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+        sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+    void (*column_major_zgemm_compute_mode_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+        sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+    std::int64_t (*column_major_sgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    std::int64_t (*column_major_dgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    std::int64_t (*column_major_cgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    std::int64_t (*column_major_zgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    void (*column_major_sgemm_pack_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &packed);
+    void (*column_major_dgemm_pack_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+        std::int64_t lda, sycl::buffer<double, 1> &packed);
+    void (*column_major_cgemm_pack_sycl)(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                         oneapi::mkl::transpose trans, std::int64_t m,
+                                         std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                                         sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                         sycl::buffer<std::complex<float>, 1> &packed);
+    void (*column_major_zgemm_pack_sycl)(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                         oneapi::mkl::transpose trans, std::int64_t m,
+                                         std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                                         sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                         sycl::buffer<std::complex<double>, 1> &packed);
+    void (*column_major_sgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<float, 1> &packed,
+        sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+        std::int64_t ldc);
+    void (*column_major_dgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<double, 1> &packed,
+        sycl::buffer<double, 1> &b, std::int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+        std::int64_t ldc);
+    void (*column_major_cgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k,
+        sycl::buffer<std::complex<float>, 1> &packed, sycl::buffer<std::complex<float>, 1> &b,
+        std::int64_t ldb, std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c,
+        std::int64_t ldc);
+    void (*column_major_zgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k,
+        sycl::buffer<std::complex<double>, 1> &packed, sycl::buffer<std::complex<double>, 1> &b,
+        std::int64_t ldb, std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c,
+        std::int64_t ldc);
+    void (*column_major_sgemm_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::epilogue_desc epilogue);
+    void (*column_major_dgemm_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+        std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+        sycl::buffer<double, 1> &c, std::int64_t ldc, sycl::buffer<double, 1> &bias,
+        oneapi::mkl::epilogue_desc epilogue);
+    void (*column_major_gemm_epilogue_f32f32bf16_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<oneapi::mkl::bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::epilogue_desc epilogue);
 
     // USM APIs
 
@@ -2453,6 +2641,263 @@ typedef struct {
         std::complex<double> *alpha, std::complex<double> **ab, std::int64_t *lda,
         std::int64_t *ldb, std::int64_t group_count, std::int64_t *groupsize,
         const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_strassen_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        std::int64_t levels, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_strassen_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+        std::int64_t ldc, std::int64_t levels, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm3m_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm3m_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_out_of_core_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        std::int64_t max_memory, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_out_of_core_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+        std::int64_t ldc, std::int64_t max_memory, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm_out_of_core_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        std::int64_t max_memory, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm_out_of_core_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        std::int64_t max_memory, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_saxpy_dot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+        float *y, std::int64_t incy, const float *z, std::int64_t incz, float *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_daxpy_dot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+        double *y, std::int64_t incy, const double *z, std::int64_t incz, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_saxpby_nrm2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+        float beta, float *y, std::int64_t incy, float *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_daxpby_nrm2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+        double beta, double *y, std::int64_t incy, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sdot2_usm_sycl)(sycl::queue &queue, std::int64_t n, const float *x,
+                                               std::int64_t incx, const float *y, std::int64_t incy,
+                                               const float *z, std::int64_t incz, float *result,
+                                               const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_ddot2_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx, const double *y,
+        std::int64_t incy, const double *z, std::int64_t incz, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sdot_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+        const float *y, std::int64_t incy, std::int64_t stridey, float *result,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_ddot_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+        std::int64_t stridex, const double *y, std::int64_t incy, std::int64_t stridey,
+        double *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sdot_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx, const float **y,
+        std::int64_t *incy, float *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_ddot_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx, const double **y,
+        std::int64_t *incy, double *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_snrm2_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+        float *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dnrm2_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+        std::int64_t stridex, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_scnrm2_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+        std::int64_t stridex, float *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dznrm2_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+        std::int64_t stridex, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_snrm2_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx, float *result,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dnrm2_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx, double *result,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_scnrm2_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+        float *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dznrm2_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+        double *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sasum_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+        float *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dasum_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+        std::int64_t stridex, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_scasum_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+        std::int64_t stridex, float *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dzasum_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+        std::int64_t stridex, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sasum_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx, float *result,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dasum_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx, double *result,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_scasum_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+        float *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dzasum_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+        double *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_isamax_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+        std::int64_t *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_idamax_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+        std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_icamax_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+        std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_izamax_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+        std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_isamax_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx,
+        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_idamax_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx,
+        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_icamax_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_izamax_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_compute_mode_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_compute_mode_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+        std::int64_t ldc, oneapi::mkl::compute_mode mode,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm_compute_mode_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm_compute_mode_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, float *packed, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, double *packed, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, std::complex<float> *packed,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, std::complex<double> *packed,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *packed, const float *b,
+        std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *packed, const double *b,
+        std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_cgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *packed,
+        const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+        std::complex<float> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_zgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *packed,
+        const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+        std::complex<double> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_sgemm_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        const float *bias, oneapi::mkl::epilogue_desc epilogue,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_dgemm_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+        std::int64_t ldc, const double *bias, oneapi::mkl::epilogue_desc epilogue,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*column_major_gemm_epilogue_f32f32bf16_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, oneapi::mkl::bfloat16 *c,
+        std::int64_t ldc, const float *bias, oneapi::mkl::epilogue_desc epilogue,
+        const std::vector<sycl::event> &dependencies);
 
     // Buffer APIs
 
@@ -3491,6 +3936,194 @@ typedef struct {
                                     std::complex<double> beta,
                                     sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                                     sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*row_major_sgemm_strassen_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t levels);
+    void (*row_major_dgemm_strassen_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+        std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+        sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t levels);
+    void (*row_major_cgemm3m_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+        sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*row_major_zgemm3m_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+        sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+    void (*row_major_saxpy_dot_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, sycl::buffer<float, 1> &x,
+        std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy, sycl::buffer<float, 1> &z,
+        std::int64_t incz, sycl::buffer<float, 1> &result);
+    void (*row_major_daxpy_dot_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, sycl::buffer<double, 1> &x,
+        std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+        sycl::buffer<double, 1> &z, std::int64_t incz, sycl::buffer<double, 1> &result);
+    void (*row_major_saxpby_nrm2_sycl)(sycl::queue &queue, std::int64_t n, float alpha,
+                                       sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+                                       sycl::buffer<float, 1> &y, std::int64_t incy,
+                                       sycl::buffer<float, 1> &result);
+    void (*row_major_daxpby_nrm2_sycl)(sycl::queue &queue, std::int64_t n, double alpha,
+                                       sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+                                       sycl::buffer<double, 1> &y, std::int64_t incy,
+                                       sycl::buffer<double, 1> &result);
+    void (*row_major_sdot2_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
+                                 std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
+                                 sycl::buffer<float, 1> &z, std::int64_t incz,
+                                 sycl::buffer<float, 1> &result);
+    void (*row_major_ddot2_sycl)(sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
+                                 std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
+                                 sycl::buffer<double, 1> &z, std::int64_t incz,
+                                 sycl::buffer<double, 1> &result);
+    void (*row_major_sdot_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
+        sycl::buffer<float, 1> &result, std::int64_t batch_size);
+    void (*row_major_ddot_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
+        sycl::buffer<double, 1> &result, std::int64_t batch_size);
+    void (*row_major_snrm2_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size);
+    void (*row_major_dnrm2_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size);
+    void (*row_major_scnrm2_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1> &result,
+        std::int64_t batch_size);
+    void (*row_major_dznrm2_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1> &result,
+        std::int64_t batch_size);
+    void (*row_major_sasum_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<float, 1> &result, std::int64_t batch_size);
+    void (*row_major_dasum_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<double, 1> &result, std::int64_t batch_size);
+    void (*row_major_scasum_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<float, 1> &result,
+        std::int64_t batch_size);
+    void (*row_major_dzasum_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<double, 1> &result,
+        std::int64_t batch_size);
+    void (*row_major_isamax_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size);
+    void (*row_major_idamax_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x, std::int64_t incx,
+        std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result, std::int64_t batch_size);
+    void (*row_major_icamax_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result,
+        std::int64_t batch_size);
+    void (*row_major_izamax_batch_strided_sycl)(
+        sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>, 1> &x,
+        std::int64_t incx, std::int64_t stridex, sycl::buffer<std::int64_t, 1> &result,
+        std::int64_t batch_size);
+    void (*row_major_sgemm_compute_mode_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+    void (*row_major_dgemm_compute_mode_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+        std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+        sycl::buffer<double, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+    void (*row_major_cgemm_compute_mode_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+        sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+    void (*row_major_zgemm_compute_mode_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+        sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+        sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc, oneapi::mkl::compute_mode mode);
+    std::int64_t (*row_major_sgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    std::int64_t (*row_major_dgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    std::int64_t (*row_major_cgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    std::int64_t (*row_major_zgemm_pack_get_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    void (*row_major_sgemm_pack_sycl)(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+                                      std::int64_t lda, sycl::buffer<float, 1> &packed);
+    void (*row_major_dgemm_pack_sycl)(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+                                      std::int64_t lda, sycl::buffer<double, 1> &packed);
+    void (*row_major_cgemm_pack_sycl)(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, std::complex<float> alpha,
+                                      sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                                      sycl::buffer<std::complex<float>, 1> &packed);
+    void (*row_major_zgemm_pack_sycl)(sycl::queue &queue, oneapi::mkl::pack_matrix which,
+                                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, std::complex<double> alpha,
+                                      sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                                      sycl::buffer<std::complex<double>, 1> &packed);
+    void (*row_major_sgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<float, 1> &packed,
+        sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
+        std::int64_t ldc);
+    void (*row_major_dgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<double, 1> &packed,
+        sycl::buffer<double, 1> &b, std::int64_t ldb, double beta, sycl::buffer<double, 1> &c,
+        std::int64_t ldc);
+    void (*row_major_cgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k,
+        sycl::buffer<std::complex<float>, 1> &packed, sycl::buffer<std::complex<float>, 1> &b,
+        std::int64_t ldb, std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c,
+        std::int64_t ldc);
+    void (*row_major_zgemm_compute_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k,
+        sycl::buffer<std::complex<double>, 1> &packed, sycl::buffer<std::complex<double>, 1> &b,
+        std::int64_t ldb, std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c,
+        std::int64_t ldc);
+    void (*row_major_sgemm_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::epilogue_desc epilogue);
+    void (*row_major_dgemm_epilogue_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
+        std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+        sycl::buffer<double, 1> &c, std::int64_t ldc, sycl::buffer<double, 1> &bias,
+        oneapi::mkl::epilogue_desc epilogue);
+    void (*row_major_gemm_epilogue_f32f32bf16_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
+        std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+        sycl::buffer<oneapi::mkl::bfloat16, 1> &c, std::int64_t ldc, sycl::buffer<float, 1> &bias,
+        oneapi::mkl::epilogue_desc epilogue);
 
     // USM APIs
 
@@ -4856,6 +5489,263 @@ typedef struct {
         std::complex<double> *alpha, std::complex<double> **ab, std::int64_t *lda,
         std::int64_t *ldb, std::int64_t group_count, std::int64_t *groupsize,
         const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_strassen_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        std::int64_t levels, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_strassen_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+        std::int64_t ldc, std::int64_t levels, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm3m_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm3m_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_out_of_core_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        std::int64_t max_memory, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_out_of_core_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+        std::int64_t ldc, std::int64_t max_memory, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm_out_of_core_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        std::int64_t max_memory, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm_out_of_core_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        std::int64_t max_memory, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_saxpy_dot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, float alpha, const float *x, std::int64_t incx,
+        float *y, std::int64_t incy, const float *z, std::int64_t incz, float *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_daxpy_dot_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, double alpha, const double *x, std::int64_t incx,
+        double *y, std::int64_t incy, const double *z, std::int64_t incz, double *result,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_saxpby_nrm2_usm_sycl)(sycl::queue &queue, std::int64_t n, float alpha,
+                                                  const float *x, std::int64_t incx, float beta,
+                                                  float *y, std::int64_t incy, float *result,
+                                                  const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_daxpby_nrm2_usm_sycl)(sycl::queue &queue, std::int64_t n, double alpha,
+                                                  const double *x, std::int64_t incx, double beta,
+                                                  double *y, std::int64_t incy, double *result,
+                                                  const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sdot2_usm_sycl)(sycl::queue &queue, std::int64_t n, const float *x,
+                                            std::int64_t incx, const float *y, std::int64_t incy,
+                                            const float *z, std::int64_t incz, float *result,
+                                            const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_ddot2_usm_sycl)(sycl::queue &queue, std::int64_t n, const double *x,
+                                            std::int64_t incx, const double *y, std::int64_t incy,
+                                            const double *z, std::int64_t incz, double *result,
+                                            const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sdot_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+        const float *y, std::int64_t incy, std::int64_t stridey, float *result,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_ddot_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+        std::int64_t stridex, const double *y, std::int64_t incy, std::int64_t stridey,
+        double *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sdot_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx, const float **y,
+        std::int64_t *incy, float *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_ddot_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx, const double **y,
+        std::int64_t *incy, double *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_snrm2_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+        float *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dnrm2_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+        std::int64_t stridex, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_scnrm2_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+        std::int64_t stridex, float *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dznrm2_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+        std::int64_t stridex, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_snrm2_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx, float *result,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dnrm2_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx, double *result,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_scnrm2_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+        float *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dznrm2_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+        double *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sasum_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+        float *result, std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dasum_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+        std::int64_t stridex, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_scasum_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+        std::int64_t stridex, float *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dzasum_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+        std::int64_t stridex, double *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sasum_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx, float *result,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dasum_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx, double *result,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_scasum_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+        float *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dzasum_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+        double *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_isamax_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const float *x, std::int64_t incx, std::int64_t stridex,
+        std::int64_t *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_idamax_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const double *x, std::int64_t incx,
+        std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_icamax_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+        std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_izamax_batch_strided_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+        std::int64_t stridex, std::int64_t *result, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_isamax_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const float **x, std::int64_t *incx,
+        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_idamax_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const double **x, std::int64_t *incx,
+        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_icamax_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_izamax_batch_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+        std::int64_t *result, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_compute_mode_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_compute_mode_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+        std::int64_t ldc, oneapi::mkl::compute_mode mode,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm_compute_mode_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm_compute_mode_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        oneapi::mkl::compute_mode mode, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, float *packed, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, double *packed, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, std::complex<float> *packed,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm_pack_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, std::complex<double> *packed,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *packed, const float *b,
+        std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *packed, const double *b,
+        std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_cgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<float> *packed,
+        const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+        std::complex<float> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_zgemm_compute_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::pack_matrix which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const std::complex<double> *packed,
+        const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+        std::complex<double> *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_sgemm_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+        const float *bias, oneapi::mkl::epilogue_desc epilogue,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_dgemm_epilogue_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
+        std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
+        std::int64_t ldc, const double *bias, oneapi::mkl::epilogue_desc epilogue,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*row_major_gemm_epilogue_f32f32bf16_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
+        std::int64_t lda, const float *b, std::int64_t ldb, float beta, oneapi::mkl::bfloat16 *c,
+        std::int64_t ldc, const float *bias, oneapi::mkl::epilogue_desc epilogue,
+        const std::vector<sycl::event> &dependencies);
 
 } blas_function_table_t;
 
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef __HOST_PARALLEL_HELPER_HPP
+#define __HOST_PARALLEL_HELPER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oneapi {
+namespace mkl {
+namespace host {
+
+/**
+ * Number of threads used by the multithreaded host kernels of the netlib BLAS
+ * and LAPACK backends. Defaults to the hardware concurrency and can be
+ * overridden with the ONEMKL_NETLIB_NUM_THREADS environment variable.
+ */
+inline int64_t host_num_threads() {
+    static const int64_t num_threads = []() -> int64_t {
+        if (const char *env = std::getenv("ONEMKL_NETLIB_NUM_THREADS")) {
+            long val = std::strtol(env, nullptr, 10);
+            if (val > 0)
+                return val;
+        }
+        unsigned hw = std::thread::hardware_concurrency();
+        return hw > 0 ? hw : 1;
+    }();
+    return num_threads;
+}
+
+namespace detail {
+
+// Set on a thread while it runs tasks of host_parallel_for.
+inline bool &in_host_parallel_for() {
+    static thread_local bool active = false;
+    return active;
+}
+
+/**
+ * Worker threads of host_parallel_for. The pool runs one loop at a time: the
+ * caller and the workers take task indices from a shared counter until none
+ * are left, and the caller then waits for every worker to finish its current
+ * task. The first exception thrown by a task stops the handout of further
+ * tasks and is rethrown on the caller.
+ */
+class host_thread_pool {
+public:
+    explicit host_thread_pool(int64_t num_workers) {
+        workers_.reserve(num_workers);
+        for (int64_t t = 0; t < num_workers; ++t)
+            workers_.emplace_back([this]() { worker_loop(); });
+    }
+
+    host_thread_pool(const host_thread_pool &) = delete;
+    host_thread_pool &operator=(const host_thread_pool &) = delete;
+
+    // Runs task(ctx, i) for every i in [0, num_tasks). Returns false without
+    // running anything if another thread is using the pool.
+    bool try_run(int64_t num_tasks, void *ctx, void (*task)(void *, int64_t)) {
+        std::unique_lock<std::mutex> owner(run_mutex_, std::try_to_lock);
+        if (!owner.owns_lock())
+            return false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ctx_ = ctx;
+            task_ = task;
+            num_tasks_ = num_tasks;
+            next_ = 0;
+            error_ = nullptr;
+            busy_workers_ = static_cast<int64_t>(workers_.size());
+            ++generation_;
+        }
+        wake_.notify_all();
+        run_tasks();
+
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [this]() { return busy_workers_ == 0; });
+            std::swap(error, error_);
+        }
+        if (error)
+            std::rethrow_exception(error);
+        return true;
+    }
+
+private:
+    void run_tasks() {
+        in_host_parallel_for() = true;
+        for (int64_t i = next_++; i < num_tasks_; i = next_++) {
+            try {
+                task_(ctx_, i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_)
+                    error_ = std::current_exception();
+                next_ = num_tasks_;
+            }
+        }
+        in_host_parallel_for() = false;
+    }
+
+    void worker_loop() {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_.wait(lock, [&]() { return generation_ != seen; });
+            seen = generation_;
+            lock.unlock();
+            run_tasks();
+            lock.lock();
+            if (--busy_workers_ == 0)
+                done_.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t generation_ = 0;
+    int64_t busy_workers_ = 0;
+    void *ctx_ = nullptr;
+    void (*task_)(void *, int64_t) = nullptr;
+    int64_t num_tasks_ = 0;
+    std::atomic<int64_t> next_{ 0 };
+    std::exception_ptr error_;
+};
+
+// The pool is started on first use with host_num_threads() - 1 workers. It is
+// never destroyed: joining its threads during static destruction can deadlock
+// when the library is unloaded, and the blocked workers hold no resources.
+inline host_thread_pool &host_pool() {
+    static host_thread_pool *pool = new host_thread_pool(host_num_threads() - 1);
+    return *pool;
+}
+
+} // namespace detail
+
+/**
+ * Calls f(i) for every i in [0, num_tasks) on the calling thread and the
+ * workers of a persistent pool of host_num_threads() - 1 threads. Tasks are
+ * handed out dynamically, so f must write disjoint outputs and must not depend
+ * on which thread runs it. An exception thrown by f is rethrown on the caller
+ * once all running tasks have finished; tasks not yet started are skipped.
+ * Calls made from inside a task, or while another thread is using the pool,
+ * run serially on the calling thread.
+ */
+template <typename F>
+void host_parallel_for(int64_t num_tasks, F &&f) {
+    const int64_t num_threads = std::min(host_num_threads(), num_tasks);
+    if (num_threads > 1 && !detail::in_host_parallel_for()) {
+        auto task = [&f](int64_t i) { f(i); };
+        using task_t = decltype(task);
+        auto invoke = [](void *ctx, int64_t i) { (*static_cast<task_t *>(ctx))(i); };
+        if (detail::host_pool().try_run(num_tasks, &task, invoke))
+            return;
+    }
+    for (int64_t i = 0; i < num_tasks; ++i)
+        f(i);
+}
+
+} // namespace host
+} // namespace mkl
+} // namespace oneapi
+
+#endif //__HOST_PARALLEL_HELPER_HPP
@@ -3315,6 +3315,417 @@ UNMTR_LAUNCHER_SCRATCH(std::complex<double>, cusolverDnZunmtr_bufferSize)
 
 #undef UNMTR_LAUNCHER_SCRATCH
 
+void gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                std::int64_t ldb, sycl::buffer<double> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesv_mixed");
+}
+void gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                std::int64_t ldb, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesv_mixed");
+}
+sycl::event gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+                       std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb, double *x,
+                       std::int64_t ldx, std::int64_t *iter, double *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed");
+}
+sycl::event gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                       std::complex<double> *b, std::int64_t ldb, std::complex<double> *x,
+                       std::int64_t ldx, std::int64_t *iter, std::complex<double> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed");
+}
+template <>
+std::int64_t gesv_mixed_scratchpad_size<double>(sycl::queue &queue, std::int64_t n,
+                                                std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb, std::int64_t ldx) {
+    throw unimplemented("lapack", "gesv_mixed_scratchpad_size");
+}
+template <>
+std::int64_t gesv_mixed_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t n,
+                                                              std::int64_t nrhs, std::int64_t lda,
+                                                              std::int64_t ldb, std::int64_t ldx) {
+    throw unimplemented("lapack", "gesv_mixed_scratchpad_size");
+}
+void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                std::int64_t ldb, sycl::buffer<double> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "posv_mixed");
+}
+void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "posv_mixed");
+}
+sycl::event posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, double *a, std::int64_t lda, double *b, std::int64_t ldb,
+                       double *x, std::int64_t ldx, std::int64_t *iter, double *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed");
+}
+sycl::event posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::complex<double> *b, std::int64_t ldb, std::complex<double> *x,
+                       std::int64_t ldx, std::int64_t *iter, std::complex<double> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed");
+}
+template <>
+std::int64_t posv_mixed_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb, std::int64_t ldx) {
+    throw unimplemented("lapack", "posv_mixed_scratchpad_size");
+}
+template <>
+std::int64_t posv_mixed_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t ldb, std::int64_t ldx) {
+    throw unimplemented("lapack", "posv_mixed_scratchpad_size");
+}
+
+void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+                std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                sycl::buffer<std::complex<float>> &tau,
+                sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                sycl::buffer<std::complex<double>> &tau,
+                sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                       std::int64_t lda, float *tau, float *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                       std::int64_t lda, double *tau, double *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+                       std::int64_t lda, std::complex<float> *tau, std::complex<float> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+                       std::int64_t lda, std::complex<double> *tau,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size, dependencies);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                               std::int64_t lda) {
+    return geqrf_scratchpad_size<float>(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t lda) {
+    return geqrf_scratchpad_size<double>(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                             std::int64_t n, std::int64_t lda) {
+    return geqrf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                              std::int64_t n, std::int64_t lda) {
+    return geqrf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+}
+
+void gesvd_randomized(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                      std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversample,
+                      std::int64_t power_iters, std::uint64_t seed, sycl::buffer<float> &a,
+                      std::int64_t lda, sycl::buffer<float> &s, sycl::buffer<float> &u,
+                      std::int64_t ldu, sycl::buffer<float> &vt, std::int64_t ldvt,
+                      sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+void gesvd_randomized(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                      std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversample,
+                      std::int64_t power_iters, std::uint64_t seed, sycl::buffer<double> &a,
+                      std::int64_t lda, sycl::buffer<double> &s, sycl::buffer<double> &u,
+                      std::int64_t ldu, sycl::buffer<double> &vt, std::int64_t ldvt,
+                      sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+void gesvd_randomized(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                      std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversample,
+                      std::int64_t power_iters, std::uint64_t seed,
+                      sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                      sycl::buffer<float> &s, sycl::buffer<std::complex<float>> &u,
+                      std::int64_t ldu, sycl::buffer<std::complex<float>> &vt, std::int64_t ldvt,
+                      sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+void gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    sycl::buffer<double> &s, sycl::buffer<std::complex<double>> &u, std::int64_t ldu,
+    sycl::buffer<std::complex<double>> &vt, std::int64_t ldvt,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const float *a, std::int64_t lda, float *s, float *u, std::int64_t ldu,
+    float *vt, std::int64_t ldvt, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const double *a, std::int64_t lda, double *s, double *u, std::int64_t ldu,
+    double *vt, std::int64_t ldvt, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const std::complex<float> *a, std::int64_t lda, float *s,
+    std::complex<float> *u, std::int64_t ldu, std::complex<float> *vt, std::int64_t ldvt,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const std::complex<double> *a, std::int64_t lda, double *s,
+    std::complex<double> *u, std::int64_t ldu, std::complex<double> *vt, std::int64_t ldvt,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    throw unimplemented("lapack", "gesvd_randomized_scratchpad_size");
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    throw unimplemented("lapack", "gesvd_randomized_scratchpad_size");
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    throw unimplemented("lapack", "gesvd_randomized_scratchpad_size");
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    throw unimplemented("lapack", "gesvd_randomized_scratchpad_size");
+}
+
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr");
+}
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr");
+}
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr");
+}
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr");
+}
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevr_scratchpad_size");
+}
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevr_scratchpad_size");
+}
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx");
+}
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx");
+}
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx");
+}
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx");
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevx_scratchpad_size");
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevx_scratchpad_size");
+}
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr");
+}
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr");
+}
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr");
+}
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr");
+}
+template <>
+std::int64_t syevr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevr_scratchpad_size");
+}
+template <>
+std::int64_t syevr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevr_scratchpad_size");
+}
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx");
+}
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx");
+}
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx");
+}
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx");
+}
+template <>
+std::int64_t syevx_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevx_scratchpad_size");
+}
+template <>
+std::int64_t syevx_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevx_scratchpad_size");
+}
+
 } // namespace cusolver
 } // namespace lapack
 } // namespace mkl
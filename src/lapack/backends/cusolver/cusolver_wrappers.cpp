@@ -421,6 +421,194 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::cusolver::potrs_batch_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::cusolver::potrs_batch_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::cusolver::ungqr_batch_scratchpad_size<std::complex<float>>,
-    oneapi::mkl::lapack::cusolver::ungqr_batch_scratchpad_size<std::complex<double>>
+    oneapi::mkl::lapack::cusolver::ungqr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::pack_compact,
+    oneapi::mkl::lapack::cusolver::pack_compact,
+    oneapi::mkl::lapack::cusolver::pack_compact,
+    oneapi::mkl::lapack::cusolver::pack_compact,
+    oneapi::mkl::lapack::cusolver::unpack_compact,
+    oneapi::mkl::lapack::cusolver::unpack_compact,
+    oneapi::mkl::lapack::cusolver::unpack_compact,
+    oneapi::mkl::lapack::cusolver::unpack_compact,
+    oneapi::mkl::lapack::cusolver::getrf_compact,
+    oneapi::mkl::lapack::cusolver::getrf_compact,
+    oneapi::mkl::lapack::cusolver::getrf_compact,
+    oneapi::mkl::lapack::cusolver::getrf_compact,
+    oneapi::mkl::lapack::cusolver::getrs_compact,
+    oneapi::mkl::lapack::cusolver::getrs_compact,
+    oneapi::mkl::lapack::cusolver::getrs_compact,
+    oneapi::mkl::lapack::cusolver::getrs_compact,
+    oneapi::mkl::lapack::cusolver::potrf_compact,
+    oneapi::mkl::lapack::cusolver::potrf_compact,
+    oneapi::mkl::lapack::cusolver::potrf_compact,
+    oneapi::mkl::lapack::cusolver::potrf_compact,
+    oneapi::mkl::lapack::cusolver::trsm_compact,
+    oneapi::mkl::lapack::cusolver::trsm_compact,
+    oneapi::mkl::lapack::cusolver::trsm_compact,
+    oneapi::mkl::lapack::cusolver::trsm_compact,
+    oneapi::mkl::lapack::cusolver::gemm_compact,
+    oneapi::mkl::lapack::cusolver::gemm_compact,
+    oneapi::mkl::lapack::cusolver::gemm_compact,
+    oneapi::mkl::lapack::cusolver::gemm_compact,
+    oneapi::mkl::lapack::cusolver::gesv_mixed,
+    oneapi::mkl::lapack::cusolver::gesv_mixed,
+    oneapi::mkl::lapack::cusolver::gesv_mixed,
+    oneapi::mkl::lapack::cusolver::gesv_mixed,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::posv_mixed,
+    oneapi::mkl::lapack::cusolver::posv_mixed,
+    oneapi::mkl::lapack::cusolver::posv_mixed,
+    oneapi::mkl::lapack::cusolver::posv_mixed,
+    oneapi::mkl::lapack::cusolver::posv_mixed_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::posv_mixed_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::gesv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::posv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::geqrf_tsqr_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::gesvd_randomized_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::heevr,
+    oneapi::mkl::lapack::cusolver::heevr,
+    oneapi::mkl::lapack::cusolver::heevr,
+    oneapi::mkl::lapack::cusolver::heevr,
+    oneapi::mkl::lapack::cusolver::heevr_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevr_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::heevx,
+    oneapi::mkl::lapack::cusolver::heevx,
+    oneapi::mkl::lapack::cusolver::heevx,
+    oneapi::mkl::lapack::cusolver::heevx,
+    oneapi::mkl::lapack::cusolver::heevx_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevx_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::syevr,
+    oneapi::mkl::lapack::cusolver::syevr,
+    oneapi::mkl::lapack::cusolver::syevr,
+    oneapi::mkl::lapack::cusolver::syevr,
+    oneapi::mkl::lapack::cusolver::syevr_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevr_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::syevx,
+    oneapi::mkl::lapack::cusolver::syevx,
+    oneapi::mkl::lapack::cusolver::syevx,
+    oneapi::mkl::lapack::cusolver::syevx,
+    oneapi::mkl::lapack::cusolver::syevx_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevx_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::heevr_batch,
+    oneapi::mkl::lapack::cusolver::heevr_batch,
+    oneapi::mkl::lapack::cusolver::heevr_batch,
+    oneapi::mkl::lapack::cusolver::heevr_batch,
+    oneapi::mkl::lapack::cusolver::heevr_batch,
+    oneapi::mkl::lapack::cusolver::heevr_batch,
+    oneapi::mkl::lapack::cusolver::heevr_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::heevr_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::heevx_batch,
+    oneapi::mkl::lapack::cusolver::heevx_batch,
+    oneapi::mkl::lapack::cusolver::heevx_batch,
+    oneapi::mkl::lapack::cusolver::heevx_batch,
+    oneapi::mkl::lapack::cusolver::heevx_batch,
+    oneapi::mkl::lapack::cusolver::heevx_batch,
+    oneapi::mkl::lapack::cusolver::heevx_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevx_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::heevx_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevx_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::syevr_batch,
+    oneapi::mkl::lapack::cusolver::syevr_batch,
+    oneapi::mkl::lapack::cusolver::syevr_batch,
+    oneapi::mkl::lapack::cusolver::syevr_batch,
+    oneapi::mkl::lapack::cusolver::syevr_batch,
+    oneapi::mkl::lapack::cusolver::syevr_batch,
+    oneapi::mkl::lapack::cusolver::syevr_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevr_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::syevr_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevr_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::syevx_batch,
+    oneapi::mkl::lapack::cusolver::syevx_batch,
+    oneapi::mkl::lapack::cusolver::syevx_batch,
+    oneapi::mkl::lapack::cusolver::syevx_batch,
+    oneapi::mkl::lapack::cusolver::syevx_batch,
+    oneapi::mkl::lapack::cusolver::syevx_batch,
+    oneapi::mkl::lapack::cusolver::syevx_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevx_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::syevx_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevx_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::heevd_batch,
+    oneapi::mkl::lapack::cusolver::heevd_batch,
+    oneapi::mkl::lapack::cusolver::heevd_batch,
+    oneapi::mkl::lapack::cusolver::heevd_batch,
+    oneapi::mkl::lapack::cusolver::heevd_batch,
+    oneapi::mkl::lapack::cusolver::heevd_batch,
+    oneapi::mkl::lapack::cusolver::heevd_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevd_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::heevd_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::heevd_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::syevd_batch,
+    oneapi::mkl::lapack::cusolver::syevd_batch,
+    oneapi::mkl::lapack::cusolver::syevd_batch,
+    oneapi::mkl::lapack::cusolver::syevd_batch,
+    oneapi::mkl::lapack::cusolver::syevd_batch,
+    oneapi::mkl::lapack::cusolver::syevd_batch,
+    oneapi::mkl::lapack::cusolver::syevd_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevd_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::syevd_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::syevd_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch,
+    oneapi::mkl::lapack::cusolver::gels_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::gels_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::gels_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::gels_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::cusolver::gels_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::cusolver::gels_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::cusolver::gels_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::cusolver::gels_batch_scratchpad_size<std::complex<double>>
 #undef LAPACK_BACKEND
 };
@@ -328,4 +328,192 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs_batch_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs_batch_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<float>>,
-    oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<double>>
+    oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::pack_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::pack_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::pack_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::pack_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::unpack_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::unpack_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::unpack_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::unpack_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::getrf_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::getrf_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::getrf_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::getrf_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::getrs_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::getrs_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::getrs_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::getrs_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::potrf_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::potrf_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::potrf_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::potrf_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::trsm_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::trsm_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::trsm_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::trsm_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gemm_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gemm_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gemm_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gemm_compact,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::geqrf_tsqr_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesvd_randomized_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<std::complex<double>>
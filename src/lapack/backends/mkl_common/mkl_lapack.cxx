@@ -2791,3 +2791,1336 @@ std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(sycl::queue &queu
     return ::oneapi::mkl::lapack::ungqr_batch_scratchpad_size<std::complex<double>>(
         queue, m, n, k, lda, group_count, group_sizes);
 }
+void pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                  std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &ap,
+                  std::int64_t ldap, std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "pack_compact");
+}
+void pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+                  std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &ap,
+                  std::int64_t ldap, std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "pack_compact");
+}
+sycl::event pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                         std::int64_t lda, std::int64_t stride_a, float *ap, std::int64_t ldap,
+                         std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "pack_compact");
+}
+sycl::event pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                         std::int64_t lda, std::int64_t stride_a, double *ap, std::int64_t ldap,
+                         std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "pack_compact");
+}
+void unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &ap,
+                    std::int64_t ldap, sycl::buffer<float> &a, std::int64_t lda,
+                    std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "unpack_compact");
+}
+void unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &ap,
+                    std::int64_t ldap, sycl::buffer<double> &a, std::int64_t lda,
+                    std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "unpack_compact");
+}
+sycl::event unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, float *ap,
+                           std::int64_t ldap, float *a, std::int64_t lda, std::int64_t stride_a,
+                           std::int64_t interleave, std::int64_t batch_size,
+                           const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "unpack_compact");
+}
+sycl::event unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, double *ap,
+                           std::int64_t ldap, double *a, std::int64_t lda, std::int64_t stride_a,
+                           std::int64_t interleave, std::int64_t batch_size,
+                           const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "unpack_compact");
+}
+void getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                   std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "getrf_compact");
+}
+void getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+                   std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "getrf_compact");
+}
+sycl::event getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                          std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                          std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "getrf_compact");
+}
+sycl::event getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                          std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                          std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "getrf_compact");
+}
+void getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                   std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                   sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   sycl::buffer<float> &b, std::int64_t ldb, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    throw unimplemented("lapack", "getrs_compact");
+}
+void getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                   std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                   sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   sycl::buffer<double> &b, std::int64_t ldb, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    throw unimplemented("lapack", "getrs_compact");
+}
+sycl::event getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                          std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                          std::int64_t stride_ipiv, float *b, std::int64_t ldb,
+                          std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "getrs_compact");
+}
+sycl::event getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                          std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                          std::int64_t stride_ipiv, double *b, std::int64_t ldb,
+                          std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "getrs_compact");
+}
+void potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                   sycl::buffer<float> &a, std::int64_t lda, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    throw unimplemented("lapack", "potrf_compact");
+}
+void potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                   sycl::buffer<double> &a, std::int64_t lda, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    throw unimplemented("lapack", "potrf_compact");
+}
+sycl::event potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                          std::int64_t lda, std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "potrf_compact");
+}
+sycl::event potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                          std::int64_t lda, std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "potrf_compact");
+}
+void trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                  std::int64_t n, float alpha, sycl::buffer<float> &a, std::int64_t lda,
+                  sycl::buffer<float> &b, std::int64_t ldb, std::int64_t interleave,
+                  std::int64_t batch_size) {
+    throw unimplemented("lapack", "trsm_compact");
+}
+void trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                  std::int64_t n, double alpha, sycl::buffer<double> &a, std::int64_t lda,
+                  sycl::buffer<double> &b, std::int64_t ldb, std::int64_t interleave,
+                  std::int64_t batch_size) {
+    throw unimplemented("lapack", "trsm_compact");
+}
+sycl::event trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                         oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                         std::int64_t n, float alpha, float *a, std::int64_t lda, float *b,
+                         std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "trsm_compact");
+}
+sycl::event trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                         oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                         std::int64_t n, double alpha, double *a, std::int64_t lda, double *b,
+                         std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "trsm_compact");
+}
+void gemm_compact(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                  sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+                  std::int64_t ldb, float beta, sycl::buffer<float> &c, std::int64_t ldc,
+                  std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gemm_compact");
+}
+void gemm_compact(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                  sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                  std::int64_t ldb, double beta, sycl::buffer<double> &c, std::int64_t ldc,
+                  std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gemm_compact");
+}
+sycl::event gemm_compact(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, float *a, std::int64_t lda,
+    float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gemm_compact");
+}
+sycl::event gemm_compact(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, double *a, std::int64_t lda,
+    double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gemm_compact");
+}
+void gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                std::int64_t ldb, sycl::buffer<double> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesv_mixed");
+}
+void gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                std::int64_t ldb, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesv_mixed");
+}
+sycl::event gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+                       std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb, double *x,
+                       std::int64_t ldx, std::int64_t *iter, double *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed");
+}
+sycl::event gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                       std::complex<double> *b, std::int64_t ldb, std::complex<double> *x,
+                       std::int64_t ldx, std::int64_t *iter, std::complex<double> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed");
+}
+template <>
+std::int64_t gesv_mixed_scratchpad_size<double>(sycl::queue &queue, std::int64_t n,
+                                                std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb, std::int64_t ldx) {
+    throw unimplemented("lapack", "gesv_mixed_scratchpad_size");
+}
+template <>
+std::int64_t gesv_mixed_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t n,
+                                                              std::int64_t nrhs, std::int64_t lda,
+                                                              std::int64_t ldb, std::int64_t ldx) {
+    throw unimplemented("lapack", "gesv_mixed_scratchpad_size");
+}
+void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                std::int64_t ldb, sycl::buffer<double> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "posv_mixed");
+}
+void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "posv_mixed");
+}
+sycl::event posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, double *a, std::int64_t lda, double *b, std::int64_t ldb,
+                       double *x, std::int64_t ldx, std::int64_t *iter, double *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed");
+}
+sycl::event posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::complex<double> *b, std::int64_t ldb, std::complex<double> *x,
+                       std::int64_t ldx, std::int64_t *iter, std::complex<double> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed");
+}
+template <>
+std::int64_t posv_mixed_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb, std::int64_t ldx) {
+    throw unimplemented("lapack", "posv_mixed_scratchpad_size");
+}
+template <>
+std::int64_t posv_mixed_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t ldb, std::int64_t ldx) {
+    throw unimplemented("lapack", "posv_mixed_scratchpad_size");
+}
+void gesv_mixed_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                      sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                      sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                      sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                      sycl::buffer<double> &x, std::int64_t ldx, std::int64_t stride_x,
+                      sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+                      sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+void gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+    std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+    std::int64_t stride_ipiv, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+    std::int64_t stride_b, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+    std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+    std::int64_t ldb, std::int64_t stride_b, double *x, std::int64_t ldx, std::int64_t stride_x,
+    std::int64_t *iter, std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<double> *x,
+    std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<double>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gesv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gesv_mixed_batch_scratchpad_size");
+}
+void posv_mixed_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                      sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                      sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                      sycl::buffer<double> &x, std::int64_t ldx, std::int64_t stride_x,
+                      sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+                      sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+void posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+    sycl::buffer<std::complex<double>> &x, std::int64_t ldx, std::int64_t stride_x,
+    sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+    double *x, std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+sycl::event posv_mixed_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                             std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                             std::int64_t stride_b, std::complex<double> *x, std::int64_t ldx,
+                             std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+                             std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                             const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    throw unimplemented("lapack", "posv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    throw unimplemented("lapack", "posv_mixed_batch_scratchpad_size");
+}
+sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda,
+    std::int64_t **ipiv, double **b, std::int64_t *ldb, double **x, std::int64_t *ldx,
+    std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a,
+    std::int64_t *lda, std::int64_t **ipiv, std::complex<double> **b, std::int64_t *ldb,
+    std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs, double **a,
+    std::int64_t *lda, double **b, std::int64_t *ldb, double **x, std::int64_t *ldx,
+    std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+    std::complex<double> **a, std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
+    std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<double>(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t *ldx, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gesv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t *ldx, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gesv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "posv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "posv_mixed_batch_scratchpad_size");
+}
+void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+                std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                sycl::buffer<std::complex<float>> &tau,
+                sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                sycl::buffer<std::complex<double>> &tau,
+                sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                       std::int64_t lda, float *tau, float *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                                        dependencies);
+}
+sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                       std::int64_t lda, double *tau, double *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                                        dependencies);
+}
+sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+                       std::int64_t lda, std::complex<float> *tau, std::complex<float> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                                        dependencies);
+}
+sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+                       std::int64_t lda, std::complex<double> *tau,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                                        dependencies);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                               std::int64_t lda) {
+    return ::oneapi::mkl::lapack::geqrf_scratchpad_size<float>(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t lda) {
+    return ::oneapi::mkl::lapack::geqrf_scratchpad_size<double>(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                             std::int64_t n, std::int64_t lda) {
+    return ::oneapi::mkl::lapack::geqrf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                              std::int64_t n, std::int64_t lda) {
+    return ::oneapi::mkl::lapack::geqrf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+}
+void gesvd_randomized(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                      std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversample,
+                      std::int64_t power_iters, std::uint64_t seed, sycl::buffer<float> &a,
+                      std::int64_t lda, sycl::buffer<float> &s, sycl::buffer<float> &u,
+                      std::int64_t ldu, sycl::buffer<float> &vt, std::int64_t ldvt,
+                      sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+void gesvd_randomized(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                      std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversample,
+                      std::int64_t power_iters, std::uint64_t seed, sycl::buffer<double> &a,
+                      std::int64_t lda, sycl::buffer<double> &s, sycl::buffer<double> &u,
+                      std::int64_t ldu, sycl::buffer<double> &vt, std::int64_t ldvt,
+                      sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+void gesvd_randomized(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                      std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversample,
+                      std::int64_t power_iters, std::uint64_t seed,
+                      sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                      sycl::buffer<float> &s, sycl::buffer<std::complex<float>> &u,
+                      std::int64_t ldu, sycl::buffer<std::complex<float>> &vt, std::int64_t ldvt,
+                      sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+void gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    sycl::buffer<double> &s, sycl::buffer<std::complex<double>> &u, std::int64_t ldu,
+    sycl::buffer<std::complex<double>> &vt, std::int64_t ldvt,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const float *a, std::int64_t lda, float *s, float *u, std::int64_t ldu,
+    float *vt, std::int64_t ldvt, float *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const double *a, std::int64_t lda, double *s, double *u, std::int64_t ldu,
+    double *vt, std::int64_t ldvt, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const std::complex<float> *a, std::int64_t lda, float *s,
+    std::complex<float> *u, std::int64_t ldu, std::complex<float> *vt, std::int64_t ldvt,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+sycl::event gesvd_randomized(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::uint64_t seed, const std::complex<double> *a, std::int64_t lda, double *s,
+    std::complex<double> *u, std::int64_t ldu, std::complex<double> *vt, std::int64_t ldvt,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesvd_randomized");
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    throw unimplemented("lapack", "gesvd_randomized_scratchpad_size");
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    throw unimplemented("lapack", "gesvd_randomized_scratchpad_size");
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    throw unimplemented("lapack", "gesvd_randomized_scratchpad_size");
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+    std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    throw unimplemented("lapack", "gesvd_randomized_scratchpad_size");
+}
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr");
+}
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr");
+}
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr");
+}
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr");
+}
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevr_scratchpad_size");
+}
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevr_scratchpad_size");
+}
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx");
+}
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx");
+}
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx");
+}
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx");
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevx_scratchpad_size");
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevx_scratchpad_size");
+}
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr");
+}
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr");
+}
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr");
+}
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr");
+}
+template <>
+std::int64_t syevr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevr_scratchpad_size");
+}
+template <>
+std::int64_t syevr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevr_scratchpad_size");
+}
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx");
+}
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx");
+}
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx");
+}
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx");
+}
+template <>
+std::int64_t syevx_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevx_scratchpad_size");
+}
+template <>
+std::int64_t syevx_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevx_scratchpad_size");
+}
+void heevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                 std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il,
+                 std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+                 sycl::buffer<float> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<float>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+void heevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                 std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il,
+                 std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+                 sycl::buffer<double> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<double>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::int64_t stride_w, std::complex<double> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+sycl::event heevr_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+                        oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a,
+                        std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu,
+                        float *abstol, std::int64_t *m, float **w, std::complex<float> **z,
+                        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double *vl, double *vu,
+    std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m, double **w,
+    std::complex<double> **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevr_batch_scratchpad_size");
+}
+void heevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                 std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il,
+                 std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+                 sycl::buffer<float> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<float>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+void heevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                 std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il,
+                 std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+                 sycl::buffer<double> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<double>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::int64_t stride_w, std::complex<double> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+sycl::event heevx_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+                        oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a,
+                        std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu,
+                        float *abstol, std::int64_t *m, float **w, std::complex<float> **z,
+                        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double *vl, double *vu,
+    std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m, double **w,
+    std::complex<double> **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevx_batch_scratchpad_size");
+}
+void syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                 std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+                 float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                 std::int64_t stride_w, sycl::buffer<float> &z, std::int64_t ldz,
+                 std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+void syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                 std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+                 double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                 std::int64_t stride_w, sycl::buffer<double> &z, std::int64_t ldz,
+                 std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+sycl::event syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                        std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, std::int64_t *m, float *w, std::int64_t stride_w, float *z,
+                        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+sycl::event syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                        std::int64_t stride_a, double vl, double vu, std::int64_t il,
+                        std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                        std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+sycl::event syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, float **a, std::int64_t *lda, float *vl, float *vu, std::int64_t *il,
+    std::int64_t *iu, float *abstol, std::int64_t *m, float **w, float **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+sycl::event syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, double **a, std::int64_t *lda, double *vl, double *vu, std::int64_t *il,
+    std::int64_t *iu, double *abstol, std::int64_t *m, double **w, double **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevr_batch_scratchpad_size");
+}
+void syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                 std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+                 float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                 std::int64_t stride_w, sycl::buffer<float> &z, std::int64_t ldz,
+                 std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+void syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                 std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+                 double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                 std::int64_t stride_w, sycl::buffer<double> &z, std::int64_t ldz,
+                 std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+sycl::event syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                        std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, std::int64_t *m, float *w, std::int64_t stride_w, float *z,
+                        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+sycl::event syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                        std::int64_t stride_a, double vl, double vu, std::int64_t il,
+                        std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                        std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+sycl::event syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, float **a, std::int64_t *lda, float *vl, float *vu, std::int64_t *il,
+    std::int64_t *iu, float *abstol, std::int64_t *m, float **w, float **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+sycl::event syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, double **a, std::int64_t *lda, double *vl, double *vu, std::int64_t *il,
+    std::int64_t *iu, double *abstol, std::int64_t *m, double **w, double **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevx_batch_scratchpad_size");
+}
+void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+                        std::int64_t *n, std::complex<float> **a, std::int64_t *lda, float **w,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+                        std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double **w,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevd_batch_scratchpad_size");
+}
+void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a, float *w,
+                        std::int64_t stride_w, std::int64_t batch_size, float *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
+                        double *w, std::int64_t stride_w, std::int64_t batch_size,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+sycl::event syevd_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n, float **a,
+    std::int64_t *lda, float **w, std::int64_t group_count, std::int64_t *group_sizes,
+    float *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+                        std::int64_t *n, double **a, std::int64_t *lda, double **w,
+                        std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevd_batch_scratchpad_size");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                       std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                       std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+                       std::int64_t *n, std::int64_t *nrhs, float **a, std::int64_t *lda, float **b,
+                       std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+                       float *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+                       std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda,
+                       double **b, std::int64_t *ldb, std::int64_t group_count,
+                       std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+                       std::int64_t *n, std::int64_t *nrhs, std::complex<float> **a,
+                       std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb,
+                       std::int64_t group_count, std::int64_t *group_sizes,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+                       std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a,
+                       std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
+                       std::int64_t group_count, std::int64_t *group_sizes,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
@@ -23,6 +23,7 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/types.hpp"
 #include "oneapi/mkl/lapack/types.hpp"
 #include "oneapi/mkl/lapack/detail/mklcpu/onemkl_lapack_mklcpu.hpp"
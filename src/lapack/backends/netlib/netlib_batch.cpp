@@ -0,0 +1,3146 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "netlib_helper.hpp"
+#include "netlib_host.hpp"
+#include "netlib_jacobi.hpp"
+#include "host_parallel_helper.hpp"
+#include "netlib_small_batch.hpp"
+#include "oneapi/mkl/lapack/detail/netlib/onemkl_lapack_netlib.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+// BATCH EXECUTION
+
+inline std::int64_t group_batch_size(std::int64_t group_count, const std::int64_t *group_sizes) {
+    return std::accumulate(group_sizes, group_sizes + group_count, std::int64_t(0));
+}
+
+// Host copy of a parameter array of a group batch call, so the host task does
+// not read user memory that may have been released by the time it runs.
+template <typename P>
+inline std::vector<P> host_copy(const P *param, std::int64_t count) {
+    return std::vector<P>(param, param + count);
+}
+
+// Scratchpad of a group batch: every problem of group g gets lwork_of(g)
+// elements, laid out group after group.
+template <typename Lwork>
+inline std::int64_t group_scratchpad_size(std::int64_t group_count,
+                                          const std::int64_t *group_sizes, Lwork lwork_of) {
+    std::int64_t size = 0;
+    for (std::int64_t g = 0; g < group_count; ++g)
+        size += group_sizes[g] * lwork_of(g);
+    return size;
+}
+
+// Runs problem(i, work, lwork) for every problem of a strided batch, spread
+// over the host threads. The scratchpad is split evenly between the problems.
+template <typename T, typename Problem>
+inline void host_batch(const char *func_name, const char *lapacke_name, std::int64_t batch_size,
+                       T *scratchpad, std::int64_t scratchpad_size, Problem problem) {
+    batch_info info(func_name, lapacke_name, batch_size);
+    const std::int64_t lwork = batch_size > 0 ? scratchpad_size / batch_size : 0;
+    host::host_parallel_for(batch_size, [&](std::int64_t i) {
+        info.set(i, problem(i, scratchpad + i * lwork, lwork));
+    });
+    info.check();
+}
+
+// Estimated work x * y * z of one problem of a group batch, e.g. m * n * k.
+// Only the relative order of the problems of one call matters.
+inline std::int64_t batch_cost(std::int64_t x, std::int64_t y, std::int64_t z) {
+    return std::max<std::int64_t>(x, 0) * std::max<std::int64_t>(y, 0) *
+           std::max<std::int64_t>(z, 1);
+}
+
+// Runs problem(g, id, work, lwork) for every problem id of a group batch,
+// where g is the group of the problem, spread over the host threads.
+//
+// Each problem runs on a single thread, so handing out the problems group by
+// group can leave a few large matrices of the last group running alone while
+// the other threads idle. The problems of all groups are instead flattened and
+// handed out by decreasing cost_of(g), largest first. Problem ids, workspace
+// slices and reported errors keep the order of the groups.
+template <typename T, typename Lwork, typename Cost, typename Problem>
+inline void host_group_batch(const char *func_name, const char *lapacke_name,
+                             std::int64_t group_count, const std::int64_t *group_sizes,
+                             T *scratchpad, std::int64_t scratchpad_size, Lwork lwork_of,
+                             Cost cost_of, Problem problem) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    std::vector<std::int64_t> group(batch_size), lwork(group_count), cost(group_count),
+        work_offset(batch_size), order(batch_size);
+    for (std::int64_t g = 0, id = 0, offset = 0; g < group_count; ++g) {
+        lwork[g] = lwork_of(g);
+        cost[g] = cost_of(g);
+        for (std::int64_t j = 0; j < group_sizes[g]; ++j, ++id, offset += lwork[g]) {
+            group[id] = g;
+            work_offset[id] = offset;
+        }
+    }
+    if (batch_size > 0 && work_offset.back() + lwork[group.back()] > scratchpad_size)
+        throw oneapi::mkl::lapack::invalid_argument(func_name, "scratchpad_size is too small");
+
+    std::iota(order.begin(), order.end(), std::int64_t(0));
+    std::stable_sort(order.begin(), order.end(), [&](std::int64_t x, std::int64_t y) {
+        return cost[group[x]] > cost[group[y]];
+    });
+
+    batch_info info(func_name, lapacke_name, batch_size);
+    host::host_parallel_for(batch_size, [&](std::int64_t task) {
+        const std::int64_t id = order[task], g = group[id];
+        info.set(id, problem(g, id, scratchpad + work_offset[id], lwork[g]));
+    });
+    info.check();
+}
+
+inline std::int64_t no_workspace(std::int64_t) {
+    return 0;
+}
+
+// Workspace of a single problem of the batch, as reported by LAPACKE.
+
+template <typename T, typename Func>
+inline std::int64_t gels_lwork(const char *func_name, Func func, oneapi::mkl::transpose trans,
+                               std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                               std::int64_t lda, std::int64_t ldb) {
+    return lapacke_query<T>("gels_batch", func_name, [&](T *work) {
+        return host_gels<T>(func, trans, m, n, nrhs, nullptr, lda, nullptr, ldb, work, -1);
+    });
+}
+
+template <typename T, typename Func>
+inline std::int64_t geqrf_lwork(const char *func_name, Func func, std::int64_t m, std::int64_t n,
+                                std::int64_t lda) {
+    return lapacke_query<T>("geqrf_batch", func_name, [&](T *work) {
+        return host_geqrf<T>(func, m, n, nullptr, lda, nullptr, work, -1);
+    });
+}
+
+template <typename T, typename Func>
+inline std::int64_t getri_lwork(const char *func_name, Func func, std::int64_t n,
+                                std::int64_t lda) {
+    return lapacke_query<T>("getri_batch", func_name, [&](T *work) {
+        return host_getri<T>(func, n, nullptr, lda, nullptr, work, -1);
+    });
+}
+
+template <typename T, typename Func>
+inline std::int64_t heevr_lwork(const char *func_name, Func func, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::int64_t lda, std::int64_t ldz) {
+    return lapacke_query<T>("heevr_batch", func_name, [&](T *work) {
+        return host_heevr<T>(func, jobz, range, uplo, n, nullptr, lda, 0, 0, 0, 0, 0, nullptr,
+                             nullptr, nullptr, ldz, work, -1);
+    });
+}
+
+template <typename T, typename Func>
+inline std::int64_t heevx_lwork(const char *func_name, Func func, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::int64_t lda, std::int64_t ldz) {
+    return lapacke_query<T>("heevx_batch", func_name, [&](T *work) {
+        return host_heevx<T>(func, jobz, range, uplo, n, nullptr, lda, 0, 0, 0, 0, 0, nullptr,
+                             nullptr, nullptr, ldz, work, -1);
+    });
+}
+
+template <typename T, typename Func>
+inline std::int64_t orgqr_lwork(const char *func_name, Func func, std::int64_t m, std::int64_t n,
+                                std::int64_t k, std::int64_t lda) {
+    return lapacke_query<T>("orgqr_batch", func_name, [&](T *work) {
+        return host_orgqr<T>(func, m, n, k, nullptr, lda, nullptr, work, -1);
+    });
+}
+
+template <typename T, typename Func>
+inline std::int64_t syevr_lwork(const char *func_name, Func func, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::int64_t lda, std::int64_t ldz) {
+    return lapacke_query<T>("syevr_batch", func_name, [&](T *work) {
+        return host_syevr<T>(func, jobz, range, uplo, n, nullptr, lda, 0, 0, 0, 0, 0, nullptr,
+                             nullptr, nullptr, ldz, work, -1);
+    });
+}
+
+template <typename T, typename Func>
+inline std::int64_t syevx_lwork(const char *func_name, Func func, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::int64_t lda, std::int64_t ldz) {
+    return lapacke_query<T>("syevx_batch", func_name, [&](T *work) {
+        return host_syevx<T>(func, jobz, range, uplo, n, nullptr, lda, 0, 0, 0, 0, 0, nullptr,
+                             nullptr, nullptr, ldz, work, -1);
+    });
+}
+
+// HOST BATCH DRIVERS
+
+template <typename T, typename Func>
+inline void host_gels_batch(const char *func_name, Func func, oneapi::mkl::transpose trans,
+                            std::int64_t m, std::int64_t n, std::int64_t nrhs, T *a,
+                            std::int64_t lda, std::int64_t stride_a, T *b, std::int64_t ldb,
+                            std::int64_t stride_b, std::int64_t batch_size, T *scratchpad,
+                            std::int64_t scratchpad_size) {
+    host_batch("gels_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t lwork) {
+                   return host_gels<T>(func, trans, m, n, nrhs, a + i * stride_a, lda,
+                                       b + i * stride_b, ldb, work, lwork);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_gels_batch(const char *func_name, Func func,
+                            const oneapi::mkl::transpose *trans, const std::int64_t *m,
+                            const std::int64_t *n, const std::int64_t *nrhs, T *const *a,
+                            const std::int64_t *lda, T *const *b, const std::int64_t *ldb,
+                            std::int64_t group_count, const std::int64_t *group_sizes,
+                            T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        "gels_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) {
+            return gels_lwork<T>(func_name, func, trans[g], m[g], n[g], nrhs[g], lda[g], ldb[g]);
+        },
+        [&](std::int64_t g) {
+            return batch_cost(m[g], n[g], std::min(m[g], n[g]) + nrhs[g]);
+        },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t lwork) {
+            return host_gels<T>(func, trans[g], m[g], n[g], nrhs[g], a[id], lda[g], b[id],
+                                ldb[g], work, lwork);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_geqrf_batch(const char *func_name, Func func, std::int64_t m, std::int64_t n,
+                             T *a, std::int64_t lda, std::int64_t stride_a, T *tau,
+                             std::int64_t stride_tau, std::int64_t batch_size, T *scratchpad,
+                             std::int64_t scratchpad_size) {
+    host_batch("geqrf_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t lwork) {
+                   return host_geqrf<T>(func, m, n, a + i * stride_a, lda, tau + i * stride_tau,
+                                        work, lwork);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_geqrf_batch(const char *func_name, Func func, const std::int64_t *m,
+                             const std::int64_t *n, T *const *a, const std::int64_t *lda,
+                             T *const *tau, std::int64_t group_count,
+                             const std::int64_t *group_sizes, T *scratchpad,
+                             std::int64_t scratchpad_size) {
+    host_group_batch(
+        "geqrf_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) { return geqrf_lwork<T>(func_name, func, m[g], n[g], lda[g]); },
+        [&](std::int64_t g) { return batch_cost(m[g], n[g], std::min(m[g], n[g])); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t lwork) {
+            return host_geqrf<T>(func, m[g], n[g], a[id], lda[g], tau[id], work, lwork);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_getri_batch(const char *func_name, Func func, std::int64_t n, T *a,
+                             std::int64_t lda, std::int64_t stride_a, const std::int64_t *ipiv,
+                             std::int64_t stride_ipiv, std::int64_t batch_size, T *scratchpad,
+                             std::int64_t scratchpad_size) {
+    host_batch("getri_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t lwork) {
+                   return host_getri<T>(func, n, a + i * stride_a, lda, ipiv + i * stride_ipiv,
+                                        work, lwork);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_getri_batch(const char *func_name, Func func, const std::int64_t *n, T *const *a,
+                             const std::int64_t *lda, std::int64_t *const *ipiv,
+                             std::int64_t group_count, const std::int64_t *group_sizes,
+                             T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        "getri_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) { return getri_lwork<T>(func_name, func, n[g], lda[g]); },
+        [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t lwork) {
+            return host_getri<T>(func, n[g], a[id], lda[g], ipiv[id], work, lwork);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_getrs_batch(const char *func_name, Func func, oneapi::mkl::transpose trans,
+                             std::int64_t n, std::int64_t nrhs, const T *a, std::int64_t lda,
+                             std::int64_t stride_a, const std::int64_t *ipiv,
+                             std::int64_t stride_ipiv, T *b, std::int64_t ldb,
+                             std::int64_t stride_b, std::int64_t batch_size) {
+    host_batch("getrs_batch", func_name, batch_size, static_cast<T *>(nullptr), 0,
+               [&](std::int64_t i, T *, std::int64_t) {
+                   return host_getrs<T>(func, trans, n, nrhs, a + i * stride_a, lda,
+                                        ipiv + i * stride_ipiv, b + i * stride_b, ldb);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_getrs_batch(const char *func_name, Func func,
+                             const oneapi::mkl::transpose *trans, const std::int64_t *n,
+                             const std::int64_t *nrhs, T *const *a, const std::int64_t *lda,
+                             std::int64_t *const *ipiv, T *const *b, const std::int64_t *ldb,
+                             std::int64_t group_count, const std::int64_t *group_sizes) {
+    host_group_batch("getrs_batch", func_name, group_count, group_sizes,
+                     static_cast<T *>(nullptr), 0, no_workspace,
+                     [&](std::int64_t g) { return batch_cost(n[g], n[g], nrhs[g]); },
+                     [&](std::int64_t g, std::int64_t id, T *, std::int64_t) {
+                         return host_getrs<T>(func, trans[g], n[g], nrhs[g], a[id], lda[g],
+                                              ipiv[id], b[id], ldb[g]);
+                     });
+}
+
+// The mixed-precision solvers use a fixed work array of mixed_lwork(n, nrhs)
+// elements per problem, which the evenly split scratchpad must cover.
+inline void mixed_batch_check(const char *func_name, std::int64_t n, std::int64_t nrhs,
+                              std::int64_t batch_size, std::int64_t scratchpad_size) {
+    if (batch_size > 0 && scratchpad_size / batch_size < mixed_lwork(n, nrhs))
+        throw oneapi::mkl::lapack::invalid_argument(func_name, "scratchpad_size is too small");
+}
+
+template <typename T, typename Func>
+inline void host_gesv_mixed_batch(const char *func_name, Func func, std::int64_t n,
+                                  std::int64_t nrhs, T *a, std::int64_t lda, std::int64_t stride_a,
+                                  std::int64_t *ipiv, std::int64_t stride_ipiv, T *b,
+                                  std::int64_t ldb, std::int64_t stride_b, T *x, std::int64_t ldx,
+                                  std::int64_t stride_x, std::int64_t *iter,
+                                  std::int64_t batch_size, T *scratchpad,
+                                  std::int64_t scratchpad_size) {
+    mixed_batch_check("gesv_mixed_batch", n, nrhs, batch_size, scratchpad_size);
+    host_batch("gesv_mixed_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t) {
+                   return host_gesv_mixed<T>(func, n, nrhs, a + i * stride_a, lda,
+                                             ipiv + i * stride_ipiv, b + i * stride_b, ldb,
+                                             x + i * stride_x, ldx, iter + i, work);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_gesv_mixed_batch(const char *func_name, Func func, const std::int64_t *n,
+                                  const std::int64_t *nrhs, T *const *a, const std::int64_t *lda,
+                                  std::int64_t *const *ipiv, T *const *b, const std::int64_t *ldb,
+                                  T *const *x, const std::int64_t *ldx, std::int64_t *iter,
+                                  std::int64_t group_count, const std::int64_t *group_sizes,
+                                  T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        "gesv_mixed_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) { return mixed_lwork(n[g], nrhs[g]); },
+        [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g] + nrhs[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t) {
+            return host_gesv_mixed<T>(func, n[g], nrhs[g], a[id], lda[g], ipiv[id], b[id], ldb[g],
+                                      x[id], ldx[g], iter + id, work);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_getrf_batch(const char *func_name, Func func, std::int64_t m, std::int64_t n,
+                             T *a, std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                             std::int64_t stride_ipiv, std::int64_t batch_size) {
+    host_batch("getrf_batch", func_name, batch_size, static_cast<T *>(nullptr), 0,
+               [&](std::int64_t i, T *, std::int64_t) {
+                   return host_getrf<T>(func, m, n, a + i * stride_a, lda, ipiv + i * stride_ipiv);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_getrf_batch(const char *func_name, Func func, const std::int64_t *m,
+                             const std::int64_t *n, T *const *a, const std::int64_t *lda,
+                             std::int64_t *const *ipiv, std::int64_t group_count,
+                             const std::int64_t *group_sizes) {
+    host_group_batch("getrf_batch", func_name, group_count, group_sizes,
+                     static_cast<T *>(nullptr), 0, no_workspace,
+                     [&](std::int64_t g) { return batch_cost(m[g], n[g], std::min(m[g], n[g])); },
+                     [&](std::int64_t g, std::int64_t id, T *, std::int64_t) {
+                         return host_getrf<T>(func, m[g], n[g], a[id], lda[g], ipiv[id]);
+                     });
+}
+
+template <typename T, typename Func>
+inline void host_heevr_batch(
+    const char *func_name, Func func, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+    oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, std::int64_t stride_a,
+    real_t<T> vl, real_t<T> vu, std::int64_t il, std::int64_t iu, real_t<T> abstol, std::int64_t *m,
+    real_t<T> *w, std::int64_t stride_w, T *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size) {
+    host_batch("heevr_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t lwork) {
+                   return host_heevr<T>(func, jobz, range, uplo, n, a + i * stride_a, lda, vl, vu,
+                                        il, iu, abstol, m + i, w + i * stride_w, z + i * stride_z,
+                                        ldz, work, lwork);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_heevr_batch(
+    const char *func_name, Func func, const oneapi::mkl::job *jobz,
+    const oneapi::mkl::rangev *range, const oneapi::mkl::uplo *uplo, const std::int64_t *n,
+    T *const *a, const std::int64_t *lda, const real_t<T> *vl, const real_t<T> *vu,
+    const std::int64_t *il, const std::int64_t *iu, const real_t<T> *abstol, std::int64_t *m,
+    real_t<T> *const *w, T *const *z, const std::int64_t *ldz, std::int64_t group_count,
+    const std::int64_t *group_sizes, T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        "heevr_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) {
+            return heevr_lwork<T>(func_name, func, jobz[g], range[g], uplo[g], n[g], lda[g],
+                                  ldz[g]);
+        },
+        [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t lwork) {
+            return host_heevr<T>(func, jobz[g], range[g], uplo[g], n[g], a[id], lda[g], vl[g],
+                                 vu[g], il[g], iu[g], abstol[g], m + id, w[id], z[id], ldz[g], work,
+                                 lwork);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_heevx_batch(
+    const char *func_name, Func func, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+    oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, std::int64_t stride_a,
+    real_t<T> vl, real_t<T> vu, std::int64_t il, std::int64_t iu, real_t<T> abstol, std::int64_t *m,
+    real_t<T> *w, std::int64_t stride_w, T *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size) {
+    host_batch("heevx_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t lwork) {
+                   return host_heevx<T>(func, jobz, range, uplo, n, a + i * stride_a, lda, vl, vu,
+                                        il, iu, abstol, m + i, w + i * stride_w, z + i * stride_z,
+                                        ldz, work, lwork);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_heevx_batch(
+    const char *func_name, Func func, const oneapi::mkl::job *jobz,
+    const oneapi::mkl::rangev *range, const oneapi::mkl::uplo *uplo, const std::int64_t *n,
+    T *const *a, const std::int64_t *lda, const real_t<T> *vl, const real_t<T> *vu,
+    const std::int64_t *il, const std::int64_t *iu, const real_t<T> *abstol, std::int64_t *m,
+    real_t<T> *const *w, T *const *z, const std::int64_t *ldz, std::int64_t group_count,
+    const std::int64_t *group_sizes, T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        "heevx_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) {
+            return heevx_lwork<T>(func_name, func, jobz[g], range[g], uplo[g], n[g], lda[g],
+                                  ldz[g]);
+        },
+        [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t lwork) {
+            return host_heevx<T>(func, jobz[g], range[g], uplo[g], n[g], a[id], lda[g], vl[g],
+                                 vu[g], il[g], iu[g], abstol[g], m + id, w[id], z[id], ldz[g], work,
+                                 lwork);
+        });
+}
+
+// The Jacobi eigensolvers use a fixed work array of jacobi_lwork(n) elements
+// per problem, which the evenly split scratchpad must cover.
+inline void jacobi_batch_check(const char *func_name, std::int64_t n, std::int64_t batch_size,
+                               std::int64_t scratchpad_size) {
+    if (batch_size > 0 && scratchpad_size / batch_size < jacobi_lwork(n))
+        throw oneapi::mkl::lapack::invalid_argument(func_name, "scratchpad_size is too small");
+}
+
+template <typename T>
+inline void host_jacobi_evd_batch(const char *func_name, const char *routine_name,
+                                  oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+                                  std::int64_t stride_a, real_t<T> *w, std::int64_t stride_w,
+                                  std::int64_t batch_size, T *scratchpad,
+                                  std::int64_t scratchpad_size) {
+    jacobi_batch_check(func_name, n, batch_size, scratchpad_size);
+    host_batch(func_name, routine_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t) {
+                   return host_jacobi_evd<T>(uplo, n, a + i * stride_a, lda, w + i * stride_w,
+                                             work);
+               });
+}
+
+template <typename T>
+inline void host_jacobi_evd_batch(const char *func_name, const char *routine_name,
+                                  const oneapi::mkl::uplo *uplo, const std::int64_t *n,
+                                  T *const *a, const std::int64_t *lda, real_t<T> *const *w,
+                                  std::int64_t group_count, const std::int64_t *group_sizes,
+                                  T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        func_name, routine_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) { return jacobi_lwork(n[g]); },
+        [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t) {
+            return host_jacobi_evd<T>(uplo[g], n[g], a[id], lda[g], w[id], work);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_orgqr_batch(const char *func_name, Func func, std::int64_t m, std::int64_t n,
+                             std::int64_t k, T *a, std::int64_t lda, std::int64_t stride_a,
+                             const T *tau, std::int64_t stride_tau, std::int64_t batch_size,
+                             T *scratchpad, std::int64_t scratchpad_size) {
+    host_batch("orgqr_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t lwork) {
+                   return host_orgqr<T>(func, m, n, k, a + i * stride_a, lda,
+                                        tau + i * stride_tau, work, lwork);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_orgqr_batch(const char *func_name, Func func, const std::int64_t *m,
+                             const std::int64_t *n, const std::int64_t *k, T *const *a,
+                             const std::int64_t *lda, T *const *tau, std::int64_t group_count,
+                             const std::int64_t *group_sizes, T *scratchpad,
+                             std::int64_t scratchpad_size) {
+    host_group_batch(
+        "orgqr_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) { return orgqr_lwork<T>(func_name, func, m[g], n[g], k[g], lda[g]); },
+        [&](std::int64_t g) { return batch_cost(m[g], n[g], k[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t lwork) {
+            return host_orgqr<T>(func, m[g], n[g], k[g], a[id], lda[g], tau[id], work, lwork);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_potrf_batch(const char *func_name, Func func, oneapi::mkl::uplo uplo,
+                             std::int64_t n, T *a, std::int64_t lda, std::int64_t stride_a,
+                             std::int64_t batch_size) {
+    host_batch("potrf_batch", func_name, batch_size, static_cast<T *>(nullptr), 0,
+               [&](std::int64_t i, T *, std::int64_t) {
+                   return host_potrf<T>(func, uplo, n, a + i * stride_a, lda);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_potrf_batch(const char *func_name, Func func, const oneapi::mkl::uplo *uplo,
+                             const std::int64_t *n, T *const *a, const std::int64_t *lda,
+                             std::int64_t group_count, const std::int64_t *group_sizes) {
+    host_group_batch("potrf_batch", func_name, group_count, group_sizes,
+                     static_cast<T *>(nullptr), 0, no_workspace,
+                     [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g]); },
+                     [&](std::int64_t g, std::int64_t id, T *, std::int64_t) {
+                         return host_potrf<T>(func, uplo[g], n[g], a[id], lda[g]);
+                     });
+}
+
+template <typename T, typename Func>
+inline void host_potrs_batch(const char *func_name, Func func, oneapi::mkl::uplo uplo,
+                             std::int64_t n, std::int64_t nrhs, const T *a, std::int64_t lda,
+                             std::int64_t stride_a, T *b, std::int64_t ldb, std::int64_t stride_b,
+                             std::int64_t batch_size) {
+    host_batch("potrs_batch", func_name, batch_size, static_cast<T *>(nullptr), 0,
+               [&](std::int64_t i, T *, std::int64_t) {
+                   return host_potrs<T>(func, uplo, n, nrhs, a + i * stride_a, lda,
+                                        b + i * stride_b, ldb);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_potrs_batch(const char *func_name, Func func, const oneapi::mkl::uplo *uplo,
+                             const std::int64_t *n, const std::int64_t *nrhs, T *const *a,
+                             const std::int64_t *lda, T *const *b, const std::int64_t *ldb,
+                             std::int64_t group_count, const std::int64_t *group_sizes) {
+    host_group_batch("potrs_batch", func_name, group_count, group_sizes,
+                     static_cast<T *>(nullptr), 0, no_workspace,
+                     [&](std::int64_t g) { return batch_cost(n[g], n[g], nrhs[g]); },
+                     [&](std::int64_t g, std::int64_t id, T *, std::int64_t) {
+                         return host_potrs<T>(func, uplo[g], n[g], nrhs[g], a[id], lda[g], b[id],
+                                              ldb[g]);
+                     });
+}
+
+template <typename T, typename Func>
+inline void host_posv_mixed_batch(const char *func_name, Func func, oneapi::mkl::uplo uplo,
+                                  std::int64_t n, std::int64_t nrhs, T *a, std::int64_t lda,
+                                  std::int64_t stride_a, T *b, std::int64_t ldb,
+                                  std::int64_t stride_b, T *x, std::int64_t ldx,
+                                  std::int64_t stride_x, std::int64_t *iter,
+                                  std::int64_t batch_size, T *scratchpad,
+                                  std::int64_t scratchpad_size) {
+    mixed_batch_check("posv_mixed_batch", n, nrhs, batch_size, scratchpad_size);
+    host_batch("posv_mixed_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t) {
+                   return host_posv_mixed<T>(func, uplo, n, nrhs, a + i * stride_a, lda,
+                                             b + i * stride_b, ldb, x + i * stride_x, ldx,
+                                             iter + i, work);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_posv_mixed_batch(const char *func_name, Func func, const oneapi::mkl::uplo *uplo,
+                                  const std::int64_t *n, const std::int64_t *nrhs, T *const *a,
+                                  const std::int64_t *lda, T *const *b, const std::int64_t *ldb,
+                                  T *const *x, const std::int64_t *ldx, std::int64_t *iter,
+                                  std::int64_t group_count, const std::int64_t *group_sizes,
+                                  T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        "posv_mixed_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) { return mixed_lwork(n[g], nrhs[g]); },
+        [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g] + nrhs[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t) {
+            return host_posv_mixed<T>(func, uplo[g], n[g], nrhs[g], a[id], lda[g], b[id], ldb[g],
+                                      x[id], ldx[g], iter + id, work);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_syevr_batch(const char *func_name, Func func, oneapi::mkl::job jobz,
+                             oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                             T *a, std::int64_t lda, std::int64_t stride_a, T vl, T vu,
+                             std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m, T *w,
+                             std::int64_t stride_w, T *z, std::int64_t ldz, std::int64_t stride_z,
+                             std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size) {
+    host_batch("syevr_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t lwork) {
+                   return host_syevr<T>(func, jobz, range, uplo, n, a + i * stride_a, lda, vl, vu,
+                                        il, iu, abstol, m + i, w + i * stride_w, z + i * stride_z,
+                                        ldz, work, lwork);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_syevr_batch(
+    const char *func_name, Func func, const oneapi::mkl::job *jobz,
+    const oneapi::mkl::rangev *range, const oneapi::mkl::uplo *uplo, const std::int64_t *n,
+    T *const *a, const std::int64_t *lda, const T *vl, const T *vu, const std::int64_t *il,
+    const std::int64_t *iu, const T *abstol, std::int64_t *m, T *const *w, T *const *z,
+    const std::int64_t *ldz, std::int64_t group_count, const std::int64_t *group_sizes,
+    T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        "syevr_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) {
+            return syevr_lwork<T>(func_name, func, jobz[g], range[g], uplo[g], n[g], lda[g],
+                                  ldz[g]);
+        },
+        [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t lwork) {
+            return host_syevr<T>(func, jobz[g], range[g], uplo[g], n[g], a[id], lda[g], vl[g],
+                                 vu[g], il[g], iu[g], abstol[g], m + id, w[id], z[id], ldz[g], work,
+                                 lwork);
+        });
+}
+
+template <typename T, typename Func>
+inline void host_syevx_batch(const char *func_name, Func func, oneapi::mkl::job jobz,
+                             oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                             T *a, std::int64_t lda, std::int64_t stride_a, T vl, T vu,
+                             std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m, T *w,
+                             std::int64_t stride_w, T *z, std::int64_t ldz, std::int64_t stride_z,
+                             std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size) {
+    host_batch("syevx_batch", func_name, batch_size, scratchpad, scratchpad_size,
+               [&](std::int64_t i, T *work, std::int64_t lwork) {
+                   return host_syevx<T>(func, jobz, range, uplo, n, a + i * stride_a, lda, vl, vu,
+                                        il, iu, abstol, m + i, w + i * stride_w, z + i * stride_z,
+                                        ldz, work, lwork);
+               });
+}
+
+template <typename T, typename Func>
+inline void host_syevx_batch(
+    const char *func_name, Func func, const oneapi::mkl::job *jobz,
+    const oneapi::mkl::rangev *range, const oneapi::mkl::uplo *uplo, const std::int64_t *n,
+    T *const *a, const std::int64_t *lda, const T *vl, const T *vu, const std::int64_t *il,
+    const std::int64_t *iu, const T *abstol, std::int64_t *m, T *const *w, T *const *z,
+    const std::int64_t *ldz, std::int64_t group_count, const std::int64_t *group_sizes,
+    T *scratchpad, std::int64_t scratchpad_size) {
+    host_group_batch(
+        "syevx_batch", func_name, group_count, group_sizes, scratchpad, scratchpad_size,
+        [&](std::int64_t g) {
+            return syevx_lwork<T>(func_name, func, jobz[g], range[g], uplo[g], n[g], lda[g],
+                                  ldz[g]);
+        },
+        [&](std::int64_t g) { return batch_cost(n[g], n[g], n[g]); },
+        [&](std::int64_t g, std::int64_t id, T *work, std::int64_t lwork) {
+            return host_syevx<T>(func, jobz[g], range[g], uplo[g], n[g], a[id], lda[g], vl[g],
+                                 vu[g], il[g], iu[g], abstol[g], m + id, w[id], z[id], ldz[g], work,
+                                 lwork);
+        });
+}
+
+// BUFFER APIs
+
+template <typename Func, typename T>
+inline void gels_batch(const char *func_name, Func func, sycl::queue &queue,
+                       oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<T> &a, std::int64_t lda,
+                       std::int64_t stride_a, sycl::buffer<T> &b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch_gels<T>(m, n, nrhs, lda, ldb, batch_size)) {
+            small_gels_batch<T>(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+            return;
+        }
+    }
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_gels_batch<T>(func_name, func, trans, m, n, nrhs, a_acc.GET_MULTI_PTR, lda,
+                               stride_a, b_acc.GET_MULTI_PTR, ldb, stride_b, batch_size,
+                               scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define GELS_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                        \
+    void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,             \
+                    std::int64_t n, std::int64_t nrhs, sycl::buffer<TYPE> &a, std::int64_t lda,   \
+                    std::int64_t stride_a, sycl::buffer<TYPE> &b, std::int64_t ldb,               \
+                    std::int64_t stride_b, std::int64_t batch_size,                               \
+                    sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {               \
+        gels_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, m, n, nrhs, a, lda, stride_a, \
+                   b, ldb, stride_b, batch_size, scratchpad, scratchpad_size);                    \
+    }
+
+GELS_STRIDED_BATCH_LAUNCHER(float, LAPACKE_sgels_work)
+GELS_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dgels_work)
+GELS_STRIDED_BATCH_LAUNCHER(std::complex<float>, LAPACKE_cgels_work)
+GELS_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zgels_work)
+
+#undef GELS_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void geqrf_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                        std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a,
+                        sycl::buffer<T> &tau, std::int64_t stride_tau, std::int64_t batch_size,
+                        sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_geqrf_batch<T>(func_name, func, m, n, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                tau_acc.GET_MULTI_PTR, stride_tau, batch_size,
+                                scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define GEQRF_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                     \
+    void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE> &a, \
+                     std::int64_t lda, std::int64_t stride_a, sycl::buffer<TYPE> &tau,          \
+                     std::int64_t stride_tau, std::int64_t batch_size,                          \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {            \
+        geqrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, stride_a, tau,      \
+                    stride_tau, batch_size, scratchpad, scratchpad_size);                       \
+    }
+
+GEQRF_STRIDED_BATCH_LAUNCHER(float, LAPACKE_sgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER(std::complex<float>, LAPACKE_cgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zgeqrf_work)
+
+#undef GEQRF_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void getri_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t n,
+                        sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a,
+                        sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                        std::int64_t batch_size, sycl::buffer<T> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_getri_batch<T>(func_name, func, n, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                ipiv_acc.GET_MULTI_PTR, stride_ipiv, batch_size,
+                                scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define GETRI_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                       \
+    void getri_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<TYPE> &a, std::int64_t lda, \
+                     std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,                     \
+                     std::int64_t stride_ipiv, std::int64_t batch_size,                           \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {              \
+        getri_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, a, lda, stride_a, ipiv,          \
+                    stride_ipiv, batch_size, scratchpad, scratchpad_size);                        \
+    }
+
+GETRI_STRIDED_BATCH_LAUNCHER(float, LAPACKE_sgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER(std::complex<float>, LAPACKE_cgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zgetri_work)
+
+#undef GETRI_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void getrs_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::transpose trans,
+    std::int64_t n, std::int64_t nrhs, sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv, sycl::buffer<T> &b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<T> &scratchpad,
+    std::int64_t scratchpad_size) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch_solve<T>(n, nrhs, lda, ldb, batch_size)) {
+            small_getrs_batch<T>(queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                                 ldb, stride_b, batch_size);
+            return;
+        }
+    }
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_getrs_batch<T>(func_name, func, trans, n, nrhs, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                ipiv_acc.GET_MULTI_PTR, stride_ipiv, b_acc.GET_MULTI_PTR, ldb,
+                                stride_b, batch_size);
+        });
+    });
+}
+
+#define GETRS_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                        \
+    void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,             \
+                     std::int64_t nrhs, sycl::buffer<TYPE> &a, std::int64_t lda,                   \
+                     std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,                      \
+                     std::int64_t stride_ipiv, sycl::buffer<TYPE> &b, std::int64_t ldb,            \
+                     std::int64_t stride_b, std::int64_t batch_size,                               \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {               \
+        getrs_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, n, nrhs, a, lda, stride_a,    \
+                    ipiv, stride_ipiv, b, ldb, stride_b, batch_size, scratchpad, scratchpad_size); \
+    }
+
+GETRS_STRIDED_BATCH_LAUNCHER(float, LAPACKE_sgetrs_work)
+GETRS_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dgetrs_work)
+GETRS_STRIDED_BATCH_LAUNCHER(std::complex<float>, LAPACKE_cgetrs_work)
+GETRS_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zgetrs_work)
+
+#undef GETRS_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void gesv_mixed_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+    std::int64_t stride_ipiv, sycl::buffer<T> &b, std::int64_t ldb, std::int64_t stride_b,
+    sycl::buffer<T> &x, std::int64_t ldx, std::int64_t stride_x, sycl::buffer<std::int64_t> &iter,
+    std::int64_t batch_size, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::write>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        auto x_acc = x.template get_access<sycl::access::mode::write>(cgh);
+        auto iter_acc = iter.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_gesv_mixed_batch<T>(func_name, func, n, nrhs, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                     ipiv_acc.GET_MULTI_PTR, stride_ipiv, b_acc.GET_MULTI_PTR, ldb,
+                                     stride_b, x_acc.GET_MULTI_PTR, ldx, stride_x,
+                                     iter_acc.GET_MULTI_PTR, batch_size, scratch_acc.GET_MULTI_PTR,
+                                     scratchpad_size);
+        });
+    });
+}
+
+#define GESV_MIXED_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                  \
+    void gesv_mixed_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,                  \
+                          sycl::buffer<TYPE> &a, std::int64_t lda, std::int64_t stride_a,         \
+                          sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,             \
+                          sycl::buffer<TYPE> &b, std::int64_t ldb, std::int64_t stride_b,         \
+                          sycl::buffer<TYPE> &x, std::int64_t ldx, std::int64_t stride_x,         \
+                          sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,              \
+                          sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {         \
+        gesv_mixed_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, nrhs, a, lda, stride_a,     \
+                         ipiv, stride_ipiv, b, ldb, stride_b, x, ldx, stride_x, iter, batch_size, \
+                         scratchpad, scratchpad_size);                                            \
+    }
+
+GESV_MIXED_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dsgesv_work)
+GESV_MIXED_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zcgesv_work)
+
+#undef GESV_MIXED_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void getrf_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                        std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a,
+                        sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                        std::int64_t batch_size, sycl::buffer<T> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch<T>(m, n, lda, batch_size)) {
+            small_getrf_batch<T>(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size);
+            return;
+        }
+    }
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::write>(cgh);
+        cgh.host_task([=]() {
+            host_getrf_batch<T>(func_name, func, m, n, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                ipiv_acc.GET_MULTI_PTR, stride_ipiv, batch_size);
+        });
+    });
+}
+
+#define GETRF_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                     \
+    void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE> &a, \
+                     std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv, \
+                     std::int64_t stride_ipiv, std::int64_t batch_size,                         \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {            \
+        getrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, stride_a, ipiv,     \
+                    stride_ipiv, batch_size, scratchpad, scratchpad_size);                      \
+    }
+
+GETRF_STRIDED_BATCH_LAUNCHER(float, LAPACKE_sgetrf_work)
+GETRF_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dgetrf_work)
+GETRF_STRIDED_BATCH_LAUNCHER(std::complex<float>, LAPACKE_cgetrf_work)
+GETRF_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zgetrf_work)
+
+#undef GETRF_STRIDED_BATCH_LAUNCHER
+
+template <typename T>
+inline void jacobi_evd_batch(const char *func_name, const char *routine_name, sycl::queue &queue,
+                             oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a,
+                             std::int64_t lda, std::int64_t stride_a, sycl::buffer<real_t<T>> &w,
+                             std::int64_t stride_w, std::int64_t batch_size,
+                             sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_jacobi<T>(n, lda, batch_size, scratchpad_size)) {
+            small_jacobi_evd_batch<T>(queue, func_name, uplo, n, a, lda, stride_a, w, stride_w,
+                                      batch_size, scratchpad, scratchpad_size);
+            return;
+        }
+    }
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_jacobi_evd_batch<T>(func_name, routine_name, uplo, n, a_acc.GET_MULTI_PTR, lda,
+                                     stride_a, w_acc.GET_MULTI_PTR, stride_w, batch_size,
+                                     scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define HEEVD_STRIDED_BATCH_LAUNCHER(TYPE_A, TYPE_B)                                             \
+    void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,          \
+                     std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda,                  \
+                     std::int64_t stride_a, sycl::buffer<TYPE_B> &w, std::int64_t stride_w,      \
+                     std::int64_t batch_size, sycl::buffer<TYPE_A> &scratchpad,                  \
+                     std::int64_t scratchpad_size) {                                             \
+        jacobi_evd_batch<TYPE_A>("heevd_batch", "heevj", queue, uplo, n, a, lda, stride_a,       \
+                                 w, stride_w, batch_size, scratchpad, scratchpad_size);          \
+    }
+
+HEEVD_STRIDED_BATCH_LAUNCHER(std::complex<float>, float)
+HEEVD_STRIDED_BATCH_LAUNCHER(std::complex<double>, double)
+
+#undef HEEVD_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void heevr_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a,
+    std::int64_t lda, std::int64_t stride_a, real_t<T> vl, real_t<T> vu, std::int64_t il,
+    std::int64_t iu, real_t<T> abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<real_t<T>> &w,
+    std::int64_t stride_w, sycl::buffer<T> &z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_heevr_batch<T>(func_name, func, jobz, range, uplo, n, a_acc.GET_MULTI_PTR, lda,
+                                stride_a, vl, vu, il, iu, abstol, m_acc.GET_MULTI_PTR,
+                                w_acc.GET_MULTI_PTR, stride_w, z_acc.GET_MULTI_PTR, ldz, stride_z,
+                                batch_size, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define HEEVR_STRIDED_BATCH_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                              \
+    void heevr_batch(                                                                              \
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                      \
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda,         \
+        std::int64_t stride_a, TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu,             \
+        TYPE_B abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE_B> &w,                     \
+        std::int64_t stride_w, sycl::buffer<TYPE_A> &z, std::int64_t ldz, std::int64_t stride_z,   \
+        std::int64_t batch_size, sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) { \
+        heevr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda,        \
+                    stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z,            \
+                    batch_size, scratchpad, scratchpad_size);                                      \
+    }
+
+HEEVR_STRIDED_BATCH_LAUNCHER(std::complex<float>, float, LAPACKE_cheevr_work)
+HEEVR_STRIDED_BATCH_LAUNCHER(std::complex<double>, double, LAPACKE_zheevr_work)
+
+#undef HEEVR_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void heevx_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a,
+    std::int64_t lda, std::int64_t stride_a, real_t<T> vl, real_t<T> vu, std::int64_t il,
+    std::int64_t iu, real_t<T> abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<real_t<T>> &w,
+    std::int64_t stride_w, sycl::buffer<T> &z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_heevx_batch<T>(func_name, func, jobz, range, uplo, n, a_acc.GET_MULTI_PTR, lda,
+                                stride_a, vl, vu, il, iu, abstol, m_acc.GET_MULTI_PTR,
+                                w_acc.GET_MULTI_PTR, stride_w, z_acc.GET_MULTI_PTR, ldz, stride_z,
+                                batch_size, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define HEEVX_STRIDED_BATCH_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                              \
+    void heevx_batch(                                                                              \
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                      \
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda,         \
+        std::int64_t stride_a, TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu,             \
+        TYPE_B abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE_B> &w,                     \
+        std::int64_t stride_w, sycl::buffer<TYPE_A> &z, std::int64_t ldz, std::int64_t stride_z,   \
+        std::int64_t batch_size, sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) { \
+        heevx_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda,        \
+                    stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z,            \
+                    batch_size, scratchpad, scratchpad_size);                                      \
+    }
+
+HEEVX_STRIDED_BATCH_LAUNCHER(std::complex<float>, float, LAPACKE_cheevx_work)
+HEEVX_STRIDED_BATCH_LAUNCHER(std::complex<double>, double, LAPACKE_zheevx_work)
+
+#undef HEEVX_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void orgqr_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                        std::int64_t n, std::int64_t k, sycl::buffer<T> &a, std::int64_t lda,
+                        std::int64_t stride_a, sycl::buffer<T> &tau, std::int64_t stride_tau,
+                        std::int64_t batch_size, sycl::buffer<T> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_orgqr_batch<T>(func_name, func, m, n, k, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                tau_acc.GET_MULTI_PTR, stride_tau, batch_size,
+                                scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define ORGQR_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                     \
+    void orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,        \
+                     sycl::buffer<TYPE> &a, std::int64_t lda, std::int64_t stride_a,            \
+                     sycl::buffer<TYPE> &tau, std::int64_t stride_tau, std::int64_t batch_size, \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {            \
+        orgqr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, stride_a, tau,   \
+                    stride_tau, batch_size, scratchpad, scratchpad_size);                       \
+    }
+
+ORGQR_STRIDED_BATCH_LAUNCHER(float, LAPACKE_sorgqr_work)
+ORGQR_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dorgqr_work)
+
+#undef ORGQR_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void potrf_batch(const char *func_name, Func func, sycl::queue &queue,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size,
+                        sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch<T>(n, n, lda, batch_size)) {
+            small_potrf_batch<T>(queue, uplo, n, a, lda, stride_a, batch_size);
+            return;
+        }
+    }
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_potrf_batch<T>(func_name, func, uplo, n, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                batch_size);
+        });
+    });
+}
+
+#define POTRF_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                              \
+    void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,         \
+                     sycl::buffer<TYPE> &a, std::int64_t lda, std::int64_t stride_a,     \
+                     std::int64_t batch_size, sycl::buffer<TYPE> &scratchpad,            \
+                     std::int64_t scratchpad_size) {                                     \
+        potrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, stride_a, \
+                    batch_size, scratchpad, scratchpad_size);                            \
+    }
+
+POTRF_STRIDED_BATCH_LAUNCHER(float, LAPACKE_spotrf_work)
+POTRF_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dpotrf_work)
+POTRF_STRIDED_BATCH_LAUNCHER(std::complex<float>, LAPACKE_cpotrf_work)
+POTRF_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zpotrf_work)
+
+#undef POTRF_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void potrs_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<T> &b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch_solve<T>(n, nrhs, lda, ldb, batch_size)) {
+            small_potrs_batch<T>(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                 batch_size);
+            return;
+        }
+    }
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_potrs_batch<T>(func_name, func, uplo, n, nrhs, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                b_acc.GET_MULTI_PTR, ldb, stride_b, batch_size);
+        });
+    });
+}
+
+#define POTRS_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                       \
+    void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,                  \
+                     std::int64_t nrhs, sycl::buffer<TYPE> &a, std::int64_t lda,                  \
+                     std::int64_t stride_a, sycl::buffer<TYPE> &b, std::int64_t ldb,              \
+                     std::int64_t stride_b, std::int64_t batch_size,                              \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {              \
+        potrs_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda, stride_a, b, \
+                    ldb, stride_b, batch_size, scratchpad, scratchpad_size);                      \
+    }
+
+POTRS_STRIDED_BATCH_LAUNCHER(float, LAPACKE_spotrs_work)
+POTRS_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dpotrs_work)
+POTRS_STRIDED_BATCH_LAUNCHER(std::complex<float>, LAPACKE_cpotrs_work)
+POTRS_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zpotrs_work)
+
+#undef POTRS_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void posv_mixed_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<T> &b, std::int64_t ldb, std::int64_t stride_b, sycl::buffer<T> &x,
+    std::int64_t ldx, std::int64_t stride_x, sycl::buffer<std::int64_t> &iter,
+    std::int64_t batch_size, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        auto x_acc = x.template get_access<sycl::access::mode::write>(cgh);
+        auto iter_acc = iter.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_posv_mixed_batch<T>(func_name, func, uplo, n, nrhs, a_acc.GET_MULTI_PTR, lda,
+                                     stride_a, b_acc.GET_MULTI_PTR, ldb, stride_b,
+                                     x_acc.GET_MULTI_PTR, ldx, stride_x, iter_acc.GET_MULTI_PTR,
+                                     batch_size, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define POSV_MIXED_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                               \
+    void posv_mixed_batch(                                                                     \
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,         \
+        sycl::buffer<TYPE> &a, std::int64_t lda, std::int64_t stride_a, sycl::buffer<TYPE> &b, \
+        std::int64_t ldb, std::int64_t stride_b, sycl::buffer<TYPE> &x, std::int64_t ldx,      \
+        std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,      \
+        sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                        \
+        posv_mixed_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda,      \
+                         stride_a, b, ldb, stride_b, x, ldx, stride_x, iter, batch_size,       \
+                         scratchpad, scratchpad_size);                                         \
+    }
+
+POSV_MIXED_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dsposv_work)
+POSV_MIXED_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zcposv_work)
+
+#undef POSV_MIXED_STRIDED_BATCH_LAUNCHER
+
+#define SYEVD_STRIDED_BATCH_LAUNCHER(TYPE)                                                        \
+    void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,           \
+                     std::int64_t n, sycl::buffer<TYPE> &a, std::int64_t lda,                     \
+                     std::int64_t stride_a, sycl::buffer<TYPE> &w, std::int64_t stride_w,         \
+                     std::int64_t batch_size, sycl::buffer<TYPE> &scratchpad,                     \
+                     std::int64_t scratchpad_size) {                                              \
+        jacobi_evd_batch<TYPE>("syevd_batch", "syevj", queue, uplo, n, a, lda, stride_a, w,       \
+                               stride_w, batch_size, scratchpad, scratchpad_size);                \
+    }
+
+SYEVD_STRIDED_BATCH_LAUNCHER(float)
+SYEVD_STRIDED_BATCH_LAUNCHER(double)
+
+#undef SYEVD_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void syevr_batch(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                        sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a, T vl, T vu,
+                        std::int64_t il, std::int64_t iu, T abstol, sycl::buffer<std::int64_t> &m,
+                        sycl::buffer<T> &w, std::int64_t stride_w, sycl::buffer<T> &z,
+                        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+                        sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_syevr_batch<T>(func_name, func, jobz, range, uplo, n, a_acc.GET_MULTI_PTR, lda,
+                                stride_a, vl, vu, il, iu, abstol, m_acc.GET_MULTI_PTR,
+                                w_acc.GET_MULTI_PTR, stride_w, z_acc.GET_MULTI_PTR, ldz, stride_z,
+                                batch_size, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define SYEVR_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                      \
+    void syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,       \
+                     oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a,              \
+                     std::int64_t lda, std::int64_t stride_a, TYPE vl, TYPE vu, std::int64_t il, \
+                     std::int64_t iu, TYPE abstol, sycl::buffer<std::int64_t> &m,                \
+                     sycl::buffer<TYPE> &w, std::int64_t stride_w, sycl::buffer<TYPE> &z,        \
+                     std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,           \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {             \
+        syevr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda,      \
+                    stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z,          \
+                    batch_size, scratchpad, scratchpad_size);                                    \
+    }
+
+SYEVR_STRIDED_BATCH_LAUNCHER(float, LAPACKE_ssyevr_work)
+SYEVR_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dsyevr_work)
+
+#undef SYEVR_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void syevx_batch(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                        sycl::buffer<T> &a, std::int64_t lda, std::int64_t stride_a, T vl, T vu,
+                        std::int64_t il, std::int64_t iu, T abstol, sycl::buffer<std::int64_t> &m,
+                        sycl::buffer<T> &w, std::int64_t stride_w, sycl::buffer<T> &z,
+                        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+                        sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_syevx_batch<T>(func_name, func, jobz, range, uplo, n, a_acc.GET_MULTI_PTR, lda,
+                                stride_a, vl, vu, il, iu, abstol, m_acc.GET_MULTI_PTR,
+                                w_acc.GET_MULTI_PTR, stride_w, z_acc.GET_MULTI_PTR, ldz, stride_z,
+                                batch_size, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define SYEVX_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                      \
+    void syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,       \
+                     oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a,              \
+                     std::int64_t lda, std::int64_t stride_a, TYPE vl, TYPE vu, std::int64_t il, \
+                     std::int64_t iu, TYPE abstol, sycl::buffer<std::int64_t> &m,                \
+                     sycl::buffer<TYPE> &w, std::int64_t stride_w, sycl::buffer<TYPE> &z,        \
+                     std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,           \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {             \
+        syevx_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda,      \
+                    stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z,          \
+                    batch_size, scratchpad, scratchpad_size);                                    \
+    }
+
+SYEVX_STRIDED_BATCH_LAUNCHER(float, LAPACKE_ssyevx_work)
+SYEVX_STRIDED_BATCH_LAUNCHER(double, LAPACKE_dsyevx_work)
+
+#undef SYEVX_STRIDED_BATCH_LAUNCHER
+
+template <typename Func, typename T>
+inline void ungqr_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                        std::int64_t n, std::int64_t k, sycl::buffer<T> &a, std::int64_t lda,
+                        std::int64_t stride_a, sycl::buffer<T> &tau, std::int64_t stride_tau,
+                        std::int64_t batch_size, sycl::buffer<T> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_orgqr_batch<T>(func_name, func, m, n, k, a_acc.GET_MULTI_PTR, lda, stride_a,
+                                tau_acc.GET_MULTI_PTR, stride_tau, batch_size,
+                                scratch_acc.GET_MULTI_PTR, scratchpad_size);
+        });
+    });
+}
+
+#define UNGQR_STRIDED_BATCH_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                     \
+    void ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,        \
+                     sycl::buffer<TYPE> &a, std::int64_t lda, std::int64_t stride_a,            \
+                     sycl::buffer<TYPE> &tau, std::int64_t stride_tau, std::int64_t batch_size, \
+                     sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {            \
+        ungqr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, stride_a, tau,   \
+                    stride_tau, batch_size, scratchpad, scratchpad_size);                       \
+    }
+
+UNGQR_STRIDED_BATCH_LAUNCHER(std::complex<float>, LAPACKE_cungqr_work)
+UNGQR_STRIDED_BATCH_LAUNCHER(std::complex<double>, LAPACKE_zungqr_work)
+
+#undef UNGQR_STRIDED_BATCH_LAUNCHER
+
+// USM APIs
+
+template <typename Func, typename T>
+inline sycl::event gels_batch(const char *func_name, Func func, sycl::queue &queue,
+                              oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                              std::int64_t nrhs, T *a, std::int64_t lda, std::int64_t stride_a,
+                              T *b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+                              const std::vector<sycl::event> &dependencies) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch_gels<T>(m, n, nrhs, lda, ldb, batch_size))
+            return small_gels_batch<T>(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                       stride_b, batch_size, dependencies);
+    }
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gels_batch<T>(func_name, func, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                               stride_b, batch_size, scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define GELS_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                 \
+    sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,   \
+                           std::int64_t n, std::int64_t nrhs, TYPE *a, std::int64_t lda,       \
+                           std::int64_t stride_a, TYPE *b, std::int64_t ldb,                   \
+                           std::int64_t stride_b, std::int64_t batch_size, TYPE *scratchpad,   \
+                           std::int64_t scratchpad_size,                                       \
+                           const std::vector<sycl::event> &dependencies) {                     \
+        return gels_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, m, n, nrhs, a, lda, \
+                          stride_a, b, ldb, stride_b, batch_size, scratchpad, scratchpad_size, \
+                          dependencies);                                                       \
+    }
+
+GELS_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_sgels_work)
+GELS_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dgels_work)
+GELS_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgels_work)
+GELS_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgels_work)
+
+#undef GELS_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event gels_batch(const char *func_name, Func func, sycl::queue &queue,
+                              oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+                              std::int64_t *nrhs, T **a, std::int64_t *lda, T **b,
+                              std::int64_t *ldb, std::int64_t group_count,
+                              std::int64_t *group_sizes, T *scratchpad,
+                              std::int64_t scratchpad_size,
+                              const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto trans_copy = host_copy(trans, group_count);
+    auto m_copy = host_copy(m, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto nrhs_copy = host_copy(nrhs, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto b_copy = host_copy(b, batch_size);
+    auto ldb_copy = host_copy(ldb, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gels_batch<T>(func_name, func, trans_copy.data(), m_copy.data(), n_copy.data(),
+                               nrhs_copy.data(), a_copy.data(), lda_copy.data(), b_copy.data(),
+                               ldb_copy.data(), group_count, group_sizes_copy.data(), scratchpad,
+                               scratchpad_size);
+        });
+    });
+}
+
+#define GELS_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                            \
+    sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,    \
+                           std::int64_t *n, std::int64_t *nrhs, TYPE **a, std::int64_t *lda,      \
+                           TYPE **b, std::int64_t *ldb, std::int64_t group_count,                 \
+                           std::int64_t *group_sizes, TYPE *scratchpad,                           \
+                           std::int64_t scratchpad_size,                                          \
+                           const std::vector<sycl::event> &dependencies) {                        \
+        return gels_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, m, n, nrhs, a, lda, b, \
+                          ldb, group_count, group_sizes, scratchpad, scratchpad_size,             \
+                          dependencies);                                                          \
+    }
+
+GELS_BATCH_LAUNCHER_USM(float, LAPACKE_sgels_work)
+GELS_BATCH_LAUNCHER_USM(double, LAPACKE_dgels_work)
+GELS_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgels_work)
+GELS_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgels_work)
+
+#undef GELS_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event geqrf_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                               std::int64_t n, T *a, std::int64_t lda, std::int64_t stride_a,
+                               T *tau, std::int64_t stride_tau, std::int64_t batch_size,
+                               T *scratchpad, std::int64_t scratchpad_size,
+                               const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_geqrf_batch<T>(func_name, func, m, n, a, lda, stride_a, tau, stride_tau,
+                                batch_size, scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define GEQRF_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                   \
+    sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *a,          \
+                            std::int64_t lda, std::int64_t stride_a, TYPE *tau,                   \
+                            std::int64_t stride_tau, std::int64_t batch_size, TYPE *scratchpad,   \
+                            std::int64_t scratchpad_size,                                         \
+                            const std::vector<sycl::event> &dependencies) {                       \
+        return geqrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, stride_a, tau, \
+                           stride_tau, batch_size, scratchpad, scratchpad_size, dependencies);    \
+    }
+
+GEQRF_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_sgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgeqrf_work)
+
+#undef GEQRF_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event geqrf_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t *m, std::int64_t *n, T **a,
+    std::int64_t *lda, T **tau, std::int64_t group_count, std::int64_t *group_sizes, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto m_copy = host_copy(m, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto tau_copy = host_copy(tau, batch_size);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_geqrf_batch<T>(func_name, func, m_copy.data(), n_copy.data(), a_copy.data(),
+                                lda_copy.data(), tau_copy.data(), group_count,
+                                group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define GEQRF_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                          \
+    sycl::event geqrf_batch(                                                                     \
+        sycl::queue &queue, std::int64_t *m, std::int64_t *n, TYPE **a, std::int64_t *lda,       \
+        TYPE **tau, std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad,       \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {            \
+        return geqrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, tau,          \
+                           group_count, group_sizes, scratchpad, scratchpad_size, dependencies); \
+    }
+
+GEQRF_BATCH_LAUNCHER_USM(float, LAPACKE_sgeqrf_work)
+GEQRF_BATCH_LAUNCHER_USM(double, LAPACKE_dgeqrf_work)
+GEQRF_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgeqrf_work)
+GEQRF_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgeqrf_work)
+
+#undef GEQRF_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getri_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t n, T *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t batch_size,
+    T *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_getri_batch<T>(func_name, func, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define GETRI_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                  \
+    sycl::event getri_batch(                                                                     \
+        sycl::queue &queue, std::int64_t n, TYPE *a, std::int64_t lda, std::int64_t stride_a,    \
+        std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t batch_size, TYPE *scratchpad, \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {            \
+        return getri_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, a, lda, stride_a, ipiv,  \
+                           stride_ipiv, batch_size, scratchpad, scratchpad_size, dependencies);  \
+    }
+
+GETRI_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_sgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetri_work)
+
+#undef GETRI_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getri_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t *n, T **a, std::int64_t *lda,
+    std::int64_t **ipiv, std::int64_t group_count, std::int64_t *group_sizes, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto ipiv_copy = host_copy(ipiv, batch_size);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_getri_batch<T>(func_name, func, n_copy.data(), a_copy.data(), lda_copy.data(),
+                                ipiv_copy.data(), group_count, group_sizes_copy.data(), scratchpad,
+                                scratchpad_size);
+        });
+    });
+}
+
+#define GETRI_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                            \
+    sycl::event getri_batch(                                                                       \
+        sycl::queue &queue, std::int64_t *n, TYPE **a, std::int64_t *lda, std::int64_t **ipiv,     \
+        std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad,                     \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return getri_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, a, lda, ipiv, group_count, \
+                           group_sizes, scratchpad, scratchpad_size, dependencies);                \
+    }
+
+GETRI_BATCH_LAUNCHER_USM(float, LAPACKE_sgetri_work)
+GETRI_BATCH_LAUNCHER_USM(double, LAPACKE_dgetri_work)
+GETRI_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetri_work)
+GETRI_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetri_work)
+
+#undef GETRI_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getrs_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::transpose trans,
+    std::int64_t n, std::int64_t nrhs, T *a, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t *ipiv, std::int64_t stride_ipiv, T *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch_solve<T>(n, nrhs, lda, ldb, batch_size))
+            return small_getrs_batch<T>(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                        stride_ipiv, b, ldb, stride_b, batch_size, dependencies);
+    }
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_getrs_batch<T>(func_name, func, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                stride_ipiv, b, ldb, stride_b, batch_size);
+        });
+    });
+}
+
+#define GETRS_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                   \
+    sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,     \
+                            std::int64_t nrhs, TYPE *a, std::int64_t lda, std::int64_t stride_a,  \
+                            std::int64_t *ipiv, std::int64_t stride_ipiv, TYPE *b,                \
+                            std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,     \
+                            TYPE *scratchpad, std::int64_t scratchpad_size,                       \
+                            const std::vector<sycl::event> &dependencies) {                       \
+        return getrs_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, n, nrhs, a, lda,      \
+                           stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size, scratchpad, \
+                           scratchpad_size, dependencies);                                        \
+    }
+
+GETRS_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_sgetrs_work)
+GETRS_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dgetrs_work)
+GETRS_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetrs_work)
+GETRS_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetrs_work)
+
+#undef GETRS_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getrs_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::transpose *trans,
+    std::int64_t *n, std::int64_t *nrhs, T **a, std::int64_t *lda, std::int64_t **ipiv, T **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto trans_copy = host_copy(trans, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto nrhs_copy = host_copy(nrhs, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto ipiv_copy = host_copy(ipiv, batch_size);
+    auto b_copy = host_copy(b, batch_size);
+    auto ldb_copy = host_copy(ldb, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_getrs_batch<T>(func_name, func, trans_copy.data(), n_copy.data(), nrhs_copy.data(),
+                                a_copy.data(), lda_copy.data(), ipiv_copy.data(), b_copy.data(),
+                                ldb_copy.data(), group_count, group_sizes_copy.data());
+        });
+    });
+}
+
+#define GETRS_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                            \
+    sycl::event getrs_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n, std::int64_t *nrhs,    \
+        TYPE **a, std::int64_t *lda, std::int64_t **ipiv, TYPE **b, std::int64_t *ldb,             \
+        std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad,                     \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return getrs_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, n, nrhs, a, lda, ipiv, \
+                           b, ldb, group_count, group_sizes, scratchpad, scratchpad_size,          \
+                           dependencies);                                                          \
+    }
+
+GETRS_BATCH_LAUNCHER_USM(float, LAPACKE_sgetrs_work)
+GETRS_BATCH_LAUNCHER_USM(double, LAPACKE_dgetrs_work)
+GETRS_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetrs_work)
+GETRS_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetrs_work)
+
+#undef GETRS_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event gesv_mixed_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t n, std::int64_t nrhs, T *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, T *b,
+    std::int64_t ldb, std::int64_t stride_b, T *x, std::int64_t ldx, std::int64_t stride_x,
+    std::int64_t *iter, std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gesv_mixed_batch<T>(func_name, func, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv,
+                                     b, ldb, stride_b, x, ldx, stride_x, iter, batch_size,
+                                     scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define GESV_MIXED_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                               \
+    sycl::event gesv_mixed_batch(                                                                  \
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, TYPE *a, std::int64_t lda,          \
+        std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, TYPE *b,              \
+        std::int64_t ldb, std::int64_t stride_b, TYPE *x, std::int64_t ldx, std::int64_t stride_x, \
+        std::int64_t *iter, std::int64_t batch_size, TYPE *scratchpad,                             \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return gesv_mixed_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, nrhs, a, lda,         \
+                                stride_a, ipiv, stride_ipiv, b, ldb, stride_b, x, ldx, stride_x,   \
+                                iter, batch_size, scratchpad, scratchpad_size, dependencies);      \
+    }
+
+GESV_MIXED_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dsgesv_work)
+GESV_MIXED_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zcgesv_work)
+
+#undef GESV_MIXED_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event gesv_mixed_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs,
+    T **a, std::int64_t *lda, std::int64_t **ipiv, T **b, std::int64_t *ldb, T **x,
+    std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes,
+    T *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto nrhs_copy = host_copy(nrhs, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto ipiv_copy = host_copy(ipiv, batch_size);
+    auto b_copy = host_copy(b, batch_size);
+    auto ldb_copy = host_copy(ldb, group_count);
+    auto x_copy = host_copy(x, batch_size);
+    auto ldx_copy = host_copy(ldx, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gesv_mixed_batch<T>(
+                func_name, func, n_copy.data(), nrhs_copy.data(), a_copy.data(), lda_copy.data(),
+                ipiv_copy.data(), b_copy.data(), ldb_copy.data(), x_copy.data(), ldx_copy.data(),
+                iter, group_count, group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define GESV_MIXED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                       \
+    sycl::event gesv_mixed_batch(                                                                  \
+        sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, TYPE **a, std::int64_t *lda,      \
+        std::int64_t **ipiv, TYPE **b, std::int64_t *ldb, TYPE **x, std::int64_t *ldx,             \
+        std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad, \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return gesv_mixed_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, nrhs, a, lda, ipiv,   \
+                                b, ldb, x, ldx, iter, group_count, group_sizes, scratchpad,        \
+                                scratchpad_size, dependencies);                                    \
+    }
+
+GESV_MIXED_BATCH_LAUNCHER_USM(double, LAPACKE_dsgesv_work)
+GESV_MIXED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zcgesv_work)
+
+#undef GESV_MIXED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getrf_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                               std::int64_t n, T *a, std::int64_t lda, std::int64_t stride_a,
+                               std::int64_t *ipiv, std::int64_t stride_ipiv,
+                               std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+                               const std::vector<sycl::event> &dependencies) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch<T>(m, n, lda, batch_size))
+            return small_getrf_batch<T>(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                        batch_size, dependencies);
+    }
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_getrf_batch<T>(func_name, func, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                batch_size);
+        });
+    });
+}
+
+#define GETRF_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                    \
+    sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *a,           \
+                            std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,           \
+                            std::int64_t stride_ipiv, std::int64_t batch_size, TYPE *scratchpad,   \
+                            std::int64_t scratchpad_size,                                          \
+                            const std::vector<sycl::event> &dependencies) {                        \
+        return getrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, stride_a, ipiv, \
+                           stride_ipiv, batch_size, scratchpad, scratchpad_size, dependencies);    \
+    }
+
+GETRF_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_sgetrf_work)
+GETRF_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dgetrf_work)
+GETRF_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetrf_work)
+GETRF_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetrf_work)
+
+#undef GETRF_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getrf_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t *m, std::int64_t *n, T **a,
+    std::int64_t *lda, std::int64_t **ipiv, std::int64_t group_count, std::int64_t *group_sizes,
+    T *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto m_copy = host_copy(m, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto ipiv_copy = host_copy(ipiv, batch_size);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_getrf_batch<T>(func_name, func, m_copy.data(), n_copy.data(), a_copy.data(),
+                                lda_copy.data(), ipiv_copy.data(), group_count,
+                                group_sizes_copy.data());
+        });
+    });
+}
+
+#define GETRF_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                          \
+    sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, TYPE **a,      \
+                            std::int64_t *lda, std::int64_t **ipiv, std::int64_t group_count,    \
+                            std::int64_t *group_sizes, TYPE *scratchpad,                         \
+                            std::int64_t scratchpad_size,                                        \
+                            const std::vector<sycl::event> &dependencies) {                      \
+        return getrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, ipiv,         \
+                           group_count, group_sizes, scratchpad, scratchpad_size, dependencies); \
+    }
+
+GETRF_BATCH_LAUNCHER_USM(float, LAPACKE_sgetrf_work)
+GETRF_BATCH_LAUNCHER_USM(double, LAPACKE_dgetrf_work)
+GETRF_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetrf_work)
+GETRF_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetrf_work)
+
+#undef GETRF_BATCH_LAUNCHER_USM
+
+template <typename T>
+inline sycl::event jacobi_evd_batch(const char *func_name, const char *routine_name,
+                                    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                    T *a, std::int64_t lda, std::int64_t stride_a, real_t<T> *w,
+                                    std::int64_t stride_w, std::int64_t batch_size, T *scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event> &dependencies) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_jacobi<T>(n, lda, batch_size, scratchpad_size))
+            return small_jacobi_evd_batch<T>(queue, func_name, uplo, n, a, lda, stride_a, w,
+                                             stride_w, batch_size, scratchpad, scratchpad_size,
+                                             dependencies);
+    }
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_jacobi_evd_batch<T>(func_name, routine_name, uplo, n, a, lda, stride_a, w,
+                                     stride_w, batch_size, scratchpad, scratchpad_size);
+        });
+    });
+}
+
+template <typename T>
+inline sycl::event jacobi_evd_batch(const char *func_name, const char *routine_name,
+                                    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                    T **a, std::int64_t *lda, real_t<T> **w,
+                                    std::int64_t group_count, std::int64_t *group_sizes,
+                                    T *scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto uplo_copy = host_copy(uplo, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto w_copy = host_copy(w, batch_size);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_jacobi_evd_batch<T>(func_name, routine_name, uplo_copy.data(), n_copy.data(),
+                                     a_copy.data(), lda_copy.data(), w_copy.data(), group_count,
+                                     group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define HEEVD_STRIDED_BATCH_LAUNCHER_USM(TYPE_A, TYPE_B)                                        \
+    sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,  \
+                            std::int64_t n, TYPE_A *a, std::int64_t lda, std::int64_t stride_a, \
+                            TYPE_B *w, std::int64_t stride_w, std::int64_t batch_size,          \
+                            TYPE_A *scratchpad, std::int64_t scratchpad_size,                   \
+                            const std::vector<sycl::event> &dependencies) {                     \
+        return jacobi_evd_batch<TYPE_A>("heevd_batch", "heevj", queue, uplo, n, a, lda,         \
+                                        stride_a, w, stride_w, batch_size, scratchpad,          \
+                                        scratchpad_size, dependencies);                         \
+    }
+
+HEEVD_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, float)
+HEEVD_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, double)
+
+#undef HEEVD_STRIDED_BATCH_LAUNCHER_USM
+
+#define HEEVD_BATCH_LAUNCHER_USM(TYPE_A, TYPE_B)                                                 \
+    sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, \
+                            std::int64_t *n, TYPE_A **a, std::int64_t *lda, TYPE_B **w,          \
+                            std::int64_t group_count, std::int64_t *group_sizes,                 \
+                            TYPE_A *scratchpad, std::int64_t scratchpad_size,                    \
+                            const std::vector<sycl::event> &dependencies) {                      \
+        return jacobi_evd_batch<TYPE_A>("heevd_batch", "heevj", queue, uplo, n, a, lda, w,       \
+                                        group_count, group_sizes, scratchpad, scratchpad_size,   \
+                                        dependencies);                                           \
+    }
+
+HEEVD_BATCH_LAUNCHER_USM(std::complex<float>, float)
+HEEVD_BATCH_LAUNCHER_USM(std::complex<double>, double)
+
+#undef HEEVD_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event heevr_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+    std::int64_t stride_a, real_t<T> vl, real_t<T> vu, std::int64_t il, std::int64_t iu,
+    real_t<T> abstol, std::int64_t *m, real_t<T> *w, std::int64_t stride_w, T *z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_heevr_batch<T>(func_name, func, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il,
+                                iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                                scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define HEEVR_STRIDED_BATCH_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                          \
+    sycl::event heevr_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                      \
+        oneapi::mkl::uplo uplo, std::int64_t n, TYPE_A *a, std::int64_t lda,                       \
+        std::int64_t stride_a, TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu,             \
+        TYPE_B abstol, std::int64_t *m, TYPE_B *w, std::int64_t stride_w, TYPE_A *z,               \
+        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size, TYPE_A *scratchpad,      \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return heevr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, \
+                           stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z,     \
+                           batch_size, scratchpad, scratchpad_size, dependencies);                 \
+    }
+
+HEEVR_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cheevr_work)
+HEEVR_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zheevr_work)
+
+#undef HEEVR_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event heevr_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, T **a, std::int64_t *lda,
+    real_t<T> *vl, real_t<T> *vu, std::int64_t *il, std::int64_t *iu, real_t<T> *abstol,
+    std::int64_t *m, real_t<T> **w, T **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto jobz_copy = host_copy(jobz, group_count);
+    auto range_copy = host_copy(range, group_count);
+    auto uplo_copy = host_copy(uplo, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto vl_copy = host_copy(vl, group_count);
+    auto vu_copy = host_copy(vu, group_count);
+    auto il_copy = host_copy(il, group_count);
+    auto iu_copy = host_copy(iu, group_count);
+    auto abstol_copy = host_copy(abstol, group_count);
+    auto w_copy = host_copy(w, batch_size);
+    auto z_copy = host_copy(z, batch_size);
+    auto ldz_copy = host_copy(ldz, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_heevr_batch<T>(
+                func_name, func, jobz_copy.data(), range_copy.data(), uplo_copy.data(),
+                n_copy.data(), a_copy.data(), lda_copy.data(), vl_copy.data(), vu_copy.data(),
+                il_copy.data(), iu_copy.data(), abstol_copy.data(), m, w_copy.data(), z_copy.data(),
+                ldz_copy.data(), group_count, group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define HEEVR_BATCH_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                  \
+    sycl::event heevr_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,                    \
+        oneapi::mkl::uplo *uplo, std::int64_t *n, TYPE_A **a, std::int64_t *lda, TYPE_B *vl,       \
+        TYPE_B *vu, std::int64_t *il, std::int64_t *iu, TYPE_B *abstol, std::int64_t *m,           \
+        TYPE_B **w, TYPE_A **z, std::int64_t *ldz, std::int64_t group_count,                       \
+        std::int64_t *group_sizes, TYPE_A *scratchpad, std::int64_t scratchpad_size,               \
+        const std::vector<sycl::event> &dependencies) {                                            \
+        return heevr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, \
+                           vl, vu, il, iu, abstol, m, w, z, ldz, group_count, group_sizes,         \
+                           scratchpad, scratchpad_size, dependencies);                             \
+    }
+
+HEEVR_BATCH_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cheevr_work)
+HEEVR_BATCH_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zheevr_work)
+
+#undef HEEVR_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event heevx_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+    std::int64_t stride_a, real_t<T> vl, real_t<T> vu, std::int64_t il, std::int64_t iu,
+    real_t<T> abstol, std::int64_t *m, real_t<T> *w, std::int64_t stride_w, T *z, std::int64_t ldz,
+    std::int64_t stride_z, std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_heevx_batch<T>(func_name, func, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il,
+                                iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                                scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define HEEVX_STRIDED_BATCH_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                          \
+    sycl::event heevx_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                      \
+        oneapi::mkl::uplo uplo, std::int64_t n, TYPE_A *a, std::int64_t lda,                       \
+        std::int64_t stride_a, TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu,             \
+        TYPE_B abstol, std::int64_t *m, TYPE_B *w, std::int64_t stride_w, TYPE_A *z,               \
+        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size, TYPE_A *scratchpad,      \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return heevx_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, \
+                           stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z,     \
+                           batch_size, scratchpad, scratchpad_size, dependencies);                 \
+    }
+
+HEEVX_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cheevx_work)
+HEEVX_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zheevx_work)
+
+#undef HEEVX_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event heevx_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, T **a, std::int64_t *lda,
+    real_t<T> *vl, real_t<T> *vu, std::int64_t *il, std::int64_t *iu, real_t<T> *abstol,
+    std::int64_t *m, real_t<T> **w, T **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto jobz_copy = host_copy(jobz, group_count);
+    auto range_copy = host_copy(range, group_count);
+    auto uplo_copy = host_copy(uplo, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto vl_copy = host_copy(vl, group_count);
+    auto vu_copy = host_copy(vu, group_count);
+    auto il_copy = host_copy(il, group_count);
+    auto iu_copy = host_copy(iu, group_count);
+    auto abstol_copy = host_copy(abstol, group_count);
+    auto w_copy = host_copy(w, batch_size);
+    auto z_copy = host_copy(z, batch_size);
+    auto ldz_copy = host_copy(ldz, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_heevx_batch<T>(
+                func_name, func, jobz_copy.data(), range_copy.data(), uplo_copy.data(),
+                n_copy.data(), a_copy.data(), lda_copy.data(), vl_copy.data(), vu_copy.data(),
+                il_copy.data(), iu_copy.data(), abstol_copy.data(), m, w_copy.data(), z_copy.data(),
+                ldz_copy.data(), group_count, group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define HEEVX_BATCH_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                  \
+    sycl::event heevx_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,                    \
+        oneapi::mkl::uplo *uplo, std::int64_t *n, TYPE_A **a, std::int64_t *lda, TYPE_B *vl,       \
+        TYPE_B *vu, std::int64_t *il, std::int64_t *iu, TYPE_B *abstol, std::int64_t *m,           \
+        TYPE_B **w, TYPE_A **z, std::int64_t *ldz, std::int64_t group_count,                       \
+        std::int64_t *group_sizes, TYPE_A *scratchpad, std::int64_t scratchpad_size,               \
+        const std::vector<sycl::event> &dependencies) {                                            \
+        return heevx_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, \
+                           vl, vu, il, iu, abstol, m, w, z, ldz, group_count, group_sizes,         \
+                           scratchpad, scratchpad_size, dependencies);                             \
+    }
+
+HEEVX_BATCH_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cheevx_work)
+HEEVX_BATCH_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zheevx_work)
+
+#undef HEEVX_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event orgqr_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                               std::int64_t n, std::int64_t k, T *a, std::int64_t lda,
+                               std::int64_t stride_a, T *tau, std::int64_t stride_tau,
+                               std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+                               const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_orgqr_batch<T>(func_name, func, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                batch_size, scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define ORGQR_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                 \
+    sycl::event orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k, \
+                            TYPE *a, std::int64_t lda, std::int64_t stride_a, TYPE *tau,        \
+                            std::int64_t stride_tau, std::int64_t batch_size, TYPE *scratchpad, \
+                            std::int64_t scratchpad_size,                                       \
+                            const std::vector<sycl::event> &dependencies) {                     \
+        return orgqr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, stride_a, \
+                           tau, stride_tau, batch_size, scratchpad, scratchpad_size,            \
+                           dependencies);                                                       \
+    }
+
+ORGQR_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_sorgqr_work)
+ORGQR_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dorgqr_work)
+
+#undef ORGQR_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event orgqr_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, T **a, std::int64_t *lda, T **tau, std::int64_t group_count,
+    std::int64_t *group_sizes, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto m_copy = host_copy(m, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto k_copy = host_copy(k, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto tau_copy = host_copy(tau, batch_size);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_orgqr_batch<T>(func_name, func, m_copy.data(), n_copy.data(), k_copy.data(),
+                                a_copy.data(), lda_copy.data(), tau_copy.data(), group_count,
+                                group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define ORGQR_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                            \
+    sycl::event orgqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, std::int64_t *k, \
+                            TYPE **a, std::int64_t *lda, TYPE **tau, std::int64_t group_count,     \
+                            std::int64_t *group_sizes, TYPE *scratchpad,                           \
+                            std::int64_t scratchpad_size,                                          \
+                            const std::vector<sycl::event> &dependencies) {                        \
+        return orgqr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, tau,         \
+                           group_count, group_sizes, scratchpad, scratchpad_size, dependencies);   \
+    }
+
+ORGQR_BATCH_LAUNCHER_USM(float, LAPACKE_sorgqr_work)
+ORGQR_BATCH_LAUNCHER_USM(double, LAPACKE_dorgqr_work)
+
+#undef ORGQR_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event potrf_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    T *a, std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch<T>(n, n, lda, batch_size))
+            return small_potrf_batch<T>(queue, uplo, n, a, lda, stride_a, batch_size, dependencies);
+    }
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_potrf_batch<T>(func_name, func, uplo, n, a, lda, stride_a, batch_size);
+        });
+    });
+}
+
+#define POTRF_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                  \
+    sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, \
+                            std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size,    \
+                            TYPE *scratchpad, std::int64_t scratchpad_size,                      \
+                            const std::vector<sycl::event> &dependencies) {                      \
+        return potrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, stride_a,  \
+                           batch_size, scratchpad, scratchpad_size, dependencies);               \
+    }
+
+POTRF_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_spotrf_work)
+POTRF_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dpotrf_work)
+POTRF_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cpotrf_work)
+POTRF_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zpotrf_work)
+
+#undef POTRF_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event potrf_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    T **a, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto uplo_copy = host_copy(uplo, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_potrf_batch<T>(func_name, func, uplo_copy.data(), n_copy.data(), a_copy.data(),
+                                lda_copy.data(), group_count, group_sizes_copy.data());
+        });
+    });
+}
+
+#define POTRF_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                            \
+    sycl::event potrf_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, TYPE **a, std::int64_t *lda, \
+        std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad,                     \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return potrf_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, group_count, \
+                           group_sizes, scratchpad, scratchpad_size, dependencies);                \
+    }
+
+POTRF_BATCH_LAUNCHER_USM(float, LAPACKE_spotrf_work)
+POTRF_BATCH_LAUNCHER_USM(double, LAPACKE_dpotrf_work)
+POTRF_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cpotrf_work)
+POTRF_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zpotrf_work)
+
+#undef POTRF_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event potrs_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, T *a, std::int64_t lda, std::int64_t stride_a, T *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    if constexpr (!is_complex<T>) {
+        if (use_small_batch_solve<T>(n, nrhs, lda, ldb, batch_size))
+            return small_potrs_batch<T>(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                        batch_size, dependencies);
+    }
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_potrs_batch<T>(func_name, func, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size);
+        });
+    });
+}
+
+#define POTRS_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                    \
+    sycl::event potrs_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, TYPE *a,    \
+        std::int64_t lda, std::int64_t stride_a, TYPE *b, std::int64_t ldb, std::int64_t stride_b, \
+        std::int64_t batch_size, TYPE *scratchpad, std::int64_t scratchpad_size,                   \
+        const std::vector<sycl::event> &dependencies) {                                            \
+        return potrs_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda,        \
+                           stride_a, b, ldb, stride_b, batch_size, scratchpad, scratchpad_size,    \
+                           dependencies);                                                          \
+    }
+
+POTRS_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_spotrs_work)
+POTRS_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dpotrs_work)
+POTRS_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cpotrs_work)
+POTRS_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zpotrs_work)
+
+#undef POTRS_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event potrs_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, T **a, std::int64_t *lda, T **b, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto uplo_copy = host_copy(uplo, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto nrhs_copy = host_copy(nrhs, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto b_copy = host_copy(b, batch_size);
+    auto ldb_copy = host_copy(ldb, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_potrs_batch<T>(func_name, func, uplo_copy.data(), n_copy.data(), nrhs_copy.data(),
+                                a_copy.data(), lda_copy.data(), b_copy.data(), ldb_copy.data(),
+                                group_count, group_sizes_copy.data());
+        });
+    });
+}
+
+#define POTRS_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                        \
+    sycl::event potrs_batch(                                                                   \
+        sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,      \
+        TYPE **a, std::int64_t *lda, TYPE **b, std::int64_t *ldb, std::int64_t group_count,    \
+        std::int64_t *group_sizes, TYPE *scratchpad, std::int64_t scratchpad_size,             \
+        const std::vector<sycl::event> &dependencies) {                                        \
+        return potrs_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda, b, \
+                           ldb, group_count, group_sizes, scratchpad, scratchpad_size,         \
+                           dependencies);                                                      \
+    }
+
+POTRS_BATCH_LAUNCHER_USM(float, LAPACKE_spotrs_work)
+POTRS_BATCH_LAUNCHER_USM(double, LAPACKE_dpotrs_work)
+POTRS_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cpotrs_work)
+POTRS_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zpotrs_work)
+
+#undef POTRS_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event posv_mixed_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, T *a, std::int64_t lda, std::int64_t stride_a, T *b, std::int64_t ldb,
+    std::int64_t stride_b, T *x, std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter,
+    std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_posv_mixed_batch<T>(func_name, func, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                     stride_b, x, ldx, stride_x, iter, batch_size, scratchpad,
+                                     scratchpad_size);
+        });
+    });
+}
+
+#define POSV_MIXED_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                               \
+    sycl::event posv_mixed_batch(                                                                  \
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, TYPE *a,    \
+        std::int64_t lda, std::int64_t stride_a, TYPE *b, std::int64_t ldb, std::int64_t stride_b, \
+        TYPE *x, std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter,                      \
+        std::int64_t batch_size, TYPE *scratchpad, std::int64_t scratchpad_size,                   \
+        const std::vector<sycl::event> &dependencies) {                                            \
+        return posv_mixed_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda,   \
+                                stride_a, b, ldb, stride_b, x, ldx, stride_x, iter, batch_size,    \
+                                scratchpad, scratchpad_size, dependencies);                        \
+    }
+
+POSV_MIXED_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dsposv_work)
+POSV_MIXED_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zcposv_work)
+
+#undef POSV_MIXED_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event posv_mixed_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, T **a, std::int64_t *lda, T **b, std::int64_t *ldb, T **x,
+    std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes,
+    T *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto uplo_copy = host_copy(uplo, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto nrhs_copy = host_copy(nrhs, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto b_copy = host_copy(b, batch_size);
+    auto ldb_copy = host_copy(ldb, group_count);
+    auto x_copy = host_copy(x, batch_size);
+    auto ldx_copy = host_copy(ldx, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_posv_mixed_batch<T>(
+                func_name, func, uplo_copy.data(), n_copy.data(), nrhs_copy.data(), a_copy.data(),
+                lda_copy.data(), b_copy.data(), ldb_copy.data(), x_copy.data(), ldx_copy.data(),
+                iter, group_count, group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define POSV_MIXED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                       \
+    sycl::event posv_mixed_batch(                                                                  \
+        sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,          \
+        TYPE **a, std::int64_t *lda, TYPE **b, std::int64_t *ldb, TYPE **x, std::int64_t *ldx,     \
+        std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad, \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return posv_mixed_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda,   \
+                                b, ldb, x, ldx, iter, group_count, group_sizes, scratchpad,        \
+                                scratchpad_size, dependencies);                                    \
+    }
+
+POSV_MIXED_BATCH_LAUNCHER_USM(double, LAPACKE_dsposv_work)
+POSV_MIXED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zcposv_work)
+
+#undef POSV_MIXED_BATCH_LAUNCHER_USM
+
+#define SYEVD_STRIDED_BATCH_LAUNCHER_USM(TYPE)                                                 \
+    sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, \
+                            std::int64_t n, TYPE *a, std::int64_t lda, std::int64_t stride_a,  \
+                            TYPE *w, std::int64_t stride_w, std::int64_t batch_size,           \
+                            TYPE *scratchpad, std::int64_t scratchpad_size,                    \
+                            const std::vector<sycl::event> &dependencies) {                    \
+        return jacobi_evd_batch<TYPE>("syevd_batch", "syevj", queue, uplo, n, a, lda,          \
+                                      stride_a, w, stride_w, batch_size, scratchpad,           \
+                                      scratchpad_size, dependencies);                          \
+    }
+
+SYEVD_STRIDED_BATCH_LAUNCHER_USM(float)
+SYEVD_STRIDED_BATCH_LAUNCHER_USM(double)
+
+#undef SYEVD_STRIDED_BATCH_LAUNCHER_USM
+
+#define SYEVD_BATCH_LAUNCHER_USM(TYPE)                                                             \
+    sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,   \
+                            std::int64_t *n, TYPE **a, std::int64_t *lda, TYPE **w,                \
+                            std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad, \
+                            std::int64_t scratchpad_size,                                          \
+                            const std::vector<sycl::event> &dependencies) {                        \
+        return jacobi_evd_batch<TYPE>("syevd_batch", "syevj", queue, uplo, n, a, lda, w,           \
+                                      group_count, group_sizes, scratchpad, scratchpad_size,       \
+                                      dependencies);                                               \
+    }
+
+SYEVD_BATCH_LAUNCHER_USM(float)
+SYEVD_BATCH_LAUNCHER_USM(double)
+
+#undef SYEVD_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event syevr_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+    std::int64_t stride_a, T vl, T vu, std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m,
+    T *w, std::int64_t stride_w, T *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_syevr_batch<T>(func_name, func, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il,
+                                iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                                scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define SYEVR_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                    \
+    sycl::event syevr_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                      \
+        oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, std::int64_t lda, std::int64_t stride_a,  \
+        TYPE vl, TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol, std::int64_t *m, TYPE *w, \
+        std::int64_t stride_w, TYPE *z, std::int64_t ldz, std::int64_t stride_z,                   \
+        std::int64_t batch_size, TYPE *scratchpad, std::int64_t scratchpad_size,                   \
+        const std::vector<sycl::event> &dependencies) {                                            \
+        return syevr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, \
+                           stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z,     \
+                           batch_size, scratchpad, scratchpad_size, dependencies);                 \
+    }
+
+SYEVR_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_ssyevr_work)
+SYEVR_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dsyevr_work)
+
+#undef SYEVR_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event syevr_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, T **a, std::int64_t *lda,
+    T *vl, T *vu, std::int64_t *il, std::int64_t *iu, T *abstol, std::int64_t *m, T **w, T **z,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto jobz_copy = host_copy(jobz, group_count);
+    auto range_copy = host_copy(range, group_count);
+    auto uplo_copy = host_copy(uplo, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto vl_copy = host_copy(vl, group_count);
+    auto vu_copy = host_copy(vu, group_count);
+    auto il_copy = host_copy(il, group_count);
+    auto iu_copy = host_copy(iu, group_count);
+    auto abstol_copy = host_copy(abstol, group_count);
+    auto w_copy = host_copy(w, batch_size);
+    auto z_copy = host_copy(z, batch_size);
+    auto ldz_copy = host_copy(ldz, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_syevr_batch<T>(
+                func_name, func, jobz_copy.data(), range_copy.data(), uplo_copy.data(),
+                n_copy.data(), a_copy.data(), lda_copy.data(), vl_copy.data(), vu_copy.data(),
+                il_copy.data(), iu_copy.data(), abstol_copy.data(), m, w_copy.data(), z_copy.data(),
+                ldz_copy.data(), group_count, group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define SYEVR_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                            \
+    sycl::event syevr_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,                    \
+        oneapi::mkl::uplo *uplo, std::int64_t *n, TYPE **a, std::int64_t *lda, TYPE *vl, TYPE *vu, \
+        std::int64_t *il, std::int64_t *iu, TYPE *abstol, std::int64_t *m, TYPE **w, TYPE **z,     \
+        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad,  \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return syevr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, \
+                           vl, vu, il, iu, abstol, m, w, z, ldz, group_count, group_sizes,         \
+                           scratchpad, scratchpad_size, dependencies);                             \
+    }
+
+SYEVR_BATCH_LAUNCHER_USM(float, LAPACKE_ssyevr_work)
+SYEVR_BATCH_LAUNCHER_USM(double, LAPACKE_dsyevr_work)
+
+#undef SYEVR_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event syevx_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+    std::int64_t stride_a, T vl, T vu, std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m,
+    T *w, std::int64_t stride_w, T *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_syevx_batch<T>(func_name, func, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il,
+                                iu, abstol, m, w, stride_w, z, ldz, stride_z, batch_size,
+                                scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define SYEVX_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                    \
+    sycl::event syevx_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                      \
+        oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, std::int64_t lda, std::int64_t stride_a,  \
+        TYPE vl, TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol, std::int64_t *m, TYPE *w, \
+        std::int64_t stride_w, TYPE *z, std::int64_t ldz, std::int64_t stride_z,                   \
+        std::int64_t batch_size, TYPE *scratchpad, std::int64_t scratchpad_size,                   \
+        const std::vector<sycl::event> &dependencies) {                                            \
+        return syevx_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, \
+                           stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z, ldz, stride_z,     \
+                           batch_size, scratchpad, scratchpad_size, dependencies);                 \
+    }
+
+SYEVX_STRIDED_BATCH_LAUNCHER_USM(float, LAPACKE_ssyevx_work)
+SYEVX_STRIDED_BATCH_LAUNCHER_USM(double, LAPACKE_dsyevx_work)
+
+#undef SYEVX_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event syevx_batch(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, T **a, std::int64_t *lda,
+    T *vl, T *vu, std::int64_t *il, std::int64_t *iu, T *abstol, std::int64_t *m, T **w, T **z,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto jobz_copy = host_copy(jobz, group_count);
+    auto range_copy = host_copy(range, group_count);
+    auto uplo_copy = host_copy(uplo, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto vl_copy = host_copy(vl, group_count);
+    auto vu_copy = host_copy(vu, group_count);
+    auto il_copy = host_copy(il, group_count);
+    auto iu_copy = host_copy(iu, group_count);
+    auto abstol_copy = host_copy(abstol, group_count);
+    auto w_copy = host_copy(w, batch_size);
+    auto z_copy = host_copy(z, batch_size);
+    auto ldz_copy = host_copy(ldz, group_count);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_syevx_batch<T>(
+                func_name, func, jobz_copy.data(), range_copy.data(), uplo_copy.data(),
+                n_copy.data(), a_copy.data(), lda_copy.data(), vl_copy.data(), vu_copy.data(),
+                il_copy.data(), iu_copy.data(), abstol_copy.data(), m, w_copy.data(), z_copy.data(),
+                ldz_copy.data(), group_count, group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define SYEVX_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                            \
+    sycl::event syevx_batch(                                                                       \
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,                    \
+        oneapi::mkl::uplo *uplo, std::int64_t *n, TYPE **a, std::int64_t *lda, TYPE *vl, TYPE *vu, \
+        std::int64_t *il, std::int64_t *iu, TYPE *abstol, std::int64_t *m, TYPE **w, TYPE **z,     \
+        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes, TYPE *scratchpad,  \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return syevx_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, \
+                           vl, vu, il, iu, abstol, m, w, z, ldz, group_count, group_sizes,         \
+                           scratchpad, scratchpad_size, dependencies);                             \
+    }
+
+SYEVX_BATCH_LAUNCHER_USM(float, LAPACKE_ssyevx_work)
+SYEVX_BATCH_LAUNCHER_USM(double, LAPACKE_dsyevx_work)
+
+#undef SYEVX_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event ungqr_batch(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                               std::int64_t n, std::int64_t k, T *a, std::int64_t lda,
+                               std::int64_t stride_a, T *tau, std::int64_t stride_tau,
+                               std::int64_t batch_size, T *scratchpad, std::int64_t scratchpad_size,
+                               const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_orgqr_batch<T>(func_name, func, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                batch_size, scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define UNGQR_STRIDED_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                 \
+    sycl::event ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k, \
+                            TYPE *a, std::int64_t lda, std::int64_t stride_a, TYPE *tau,        \
+                            std::int64_t stride_tau, std::int64_t batch_size, TYPE *scratchpad, \
+                            std::int64_t scratchpad_size,                                       \
+                            const std::vector<sycl::event> &dependencies) {                     \
+        return ungqr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, stride_a, \
+                           tau, stride_tau, batch_size, scratchpad, scratchpad_size,            \
+                           dependencies);                                                       \
+    }
+
+UNGQR_STRIDED_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cungqr_work)
+UNGQR_STRIDED_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zungqr_work)
+
+#undef UNGQR_STRIDED_BATCH_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event ungqr_batch(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+    std::int64_t *k, T **a, std::int64_t *lda, T **tau, std::int64_t group_count,
+    std::int64_t *group_sizes, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    const std::int64_t batch_size = group_batch_size(group_count, group_sizes);
+    auto group_sizes_copy = host_copy(group_sizes, group_count);
+    auto m_copy = host_copy(m, group_count);
+    auto n_copy = host_copy(n, group_count);
+    auto k_copy = host_copy(k, group_count);
+    auto a_copy = host_copy(a, batch_size);
+    auto lda_copy = host_copy(lda, group_count);
+    auto tau_copy = host_copy(tau, batch_size);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_orgqr_batch<T>(func_name, func, m_copy.data(), n_copy.data(), k_copy.data(),
+                                a_copy.data(), lda_copy.data(), tau_copy.data(), group_count,
+                                group_sizes_copy.data(), scratchpad, scratchpad_size);
+        });
+    });
+}
+
+#define UNGQR_BATCH_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                            \
+    sycl::event ungqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, std::int64_t *k, \
+                            TYPE **a, std::int64_t *lda, TYPE **tau, std::int64_t group_count,     \
+                            std::int64_t *group_sizes, TYPE *scratchpad,                           \
+                            std::int64_t scratchpad_size,                                          \
+                            const std::vector<sycl::event> &dependencies) {                        \
+        return ungqr_batch(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, tau,         \
+                           group_count, group_sizes, scratchpad, scratchpad_size, dependencies);   \
+    }
+
+UNGQR_BATCH_LAUNCHER_USM(std::complex<float>, LAPACKE_cungqr_work)
+UNGQR_BATCH_LAUNCHER_USM(std::complex<double>, LAPACKE_zungqr_work)
+
+#undef UNGQR_BATCH_LAUNCHER_USM
+
+// SCRATCHPAD APIs
+
+#define GELS_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                               \
+    template <>                                                                                  \
+    std::int64_t gels_batch_scratchpad_size<TYPE>(                                               \
+        sycl::queue & queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,       \
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,            \
+        std::int64_t stride_b, std::int64_t batch_size) {                                        \
+        return batch_size *                                                                      \
+               gels_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, trans, m, n, nrhs, lda, ldb); \
+    }
+
+GELS_STRIDED_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_sgels_work)
+GELS_STRIDED_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dgels_work)
+GELS_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgels_work)
+GELS_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgels_work)
+
+#undef GELS_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define GELS_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                    \
+    template <>                                                                               \
+    std::int64_t gels_batch_scratchpad_size<TYPE>(                                            \
+        sycl::queue & queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n, \
+        std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,   \
+        std::int64_t *group_sizes) {                                                          \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {          \
+            return gels_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, trans[g], m[g], n[g],  \
+                                    nrhs[g], lda[g], ldb[g]);                                 \
+        });                                                                                   \
+    }
+
+GELS_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_sgels_work)
+GELS_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dgels_work)
+GELS_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgels_work)
+GELS_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgels_work)
+
+#undef GELS_BATCH_LAUNCHER_SCRATCH
+
+#define GEQRF_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                          \
+    template <>                                                                              \
+    std::int64_t geqrf_batch_scratchpad_size<TYPE>(                                          \
+        sycl::queue & queue, std::int64_t m, std::int64_t n, std::int64_t lda,               \
+        std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {           \
+        return batch_size * geqrf_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, m, n, lda); \
+    }
+
+GEQRF_STRIDED_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_sgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgeqrf_work)
+GEQRF_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgeqrf_work)
+
+#undef GEQRF_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define GEQRF_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                  \
+    template <>                                                                              \
+    std::int64_t geqrf_batch_scratchpad_size<TYPE>(                                          \
+        sycl::queue & queue, std::int64_t *m, std::int64_t *n, std::int64_t *lda,            \
+        std::int64_t group_count, std::int64_t *group_sizes) {                               \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {         \
+            return geqrf_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, m[g], n[g], lda[g]); \
+        });                                                                                  \
+    }
+
+GEQRF_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_sgeqrf_work)
+GEQRF_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dgeqrf_work)
+GEQRF_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgeqrf_work)
+GEQRF_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgeqrf_work)
+
+#undef GEQRF_BATCH_LAUNCHER_SCRATCH
+
+#define GETRI_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                       \
+    template <>                                                                           \
+    std::int64_t getri_batch_scratchpad_size<TYPE>(                                       \
+        sycl::queue & queue, std::int64_t n, std::int64_t lda, std::int64_t stride_a,     \
+        std::int64_t stride_ipiv, std::int64_t batch_size) {                              \
+        return batch_size * getri_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, n, lda); \
+    }
+
+GETRI_STRIDED_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_sgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgetri_work)
+GETRI_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgetri_work)
+
+#undef GETRI_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define GETRI_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                     \
+    template <>                                                                                 \
+    std::int64_t getri_batch_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t *n,        \
+                                                   std::int64_t *lda, std::int64_t group_count, \
+                                                   std::int64_t *group_sizes) {                 \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {            \
+            return getri_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, n[g], lda[g]);          \
+        });                                                                                     \
+    }
+
+GETRI_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_sgetri_work)
+GETRI_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dgetri_work)
+GETRI_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgetri_work)
+GETRI_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgetri_work)
+
+#undef GETRI_BATCH_LAUNCHER_SCRATCH
+
+// LAPACKE_?getrs_work does not use scratchpad memory
+#define GETRS_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE)                                            \
+    template <>                                                                               \
+    std::int64_t getrs_batch_scratchpad_size<TYPE>(                                           \
+        sycl::queue & queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs, \
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,  \
+        std::int64_t stride_b, std::int64_t batch_size) {                                     \
+        return 0;                                                                             \
+    }
+
+GETRS_STRIDED_BATCH_LAUNCHER_SCRATCH(float)
+GETRS_STRIDED_BATCH_LAUNCHER_SCRATCH(double)
+GETRS_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+GETRS_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GETRS_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+// LAPACKE_?getrs_work does not use scratchpad memory
+#define GETRS_BATCH_LAUNCHER_SCRATCH(TYPE)                                                       \
+    template <>                                                                                  \
+    std::int64_t getrs_batch_scratchpad_size<TYPE>(                                              \
+        sycl::queue & queue, oneapi::mkl::transpose *trans, std::int64_t *n, std::int64_t *nrhs, \
+        std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,                          \
+        std::int64_t *group_sizes) {                                                             \
+        return 0;                                                                                \
+    }
+
+GETRS_BATCH_LAUNCHER_SCRATCH(float)
+GETRS_BATCH_LAUNCHER_SCRATCH(double)
+GETRS_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+GETRS_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GETRS_BATCH_LAUNCHER_SCRATCH
+
+#define GESV_MIXED_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE)                                           \
+    template <>                                                                                   \
+    std::int64_t gesv_mixed_batch_scratchpad_size<TYPE>(                                          \
+        sycl::queue & queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda,                 \
+        std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, \
+        std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size) {                       \
+        return batch_size * mixed_lwork(n, nrhs);                                                 \
+    }
+
+GESV_MIXED_STRIDED_BATCH_LAUNCHER_SCRATCH(double)
+GESV_MIXED_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GESV_MIXED_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define GESV_MIXED_BATCH_LAUNCHER_SCRATCH(TYPE)                                                   \
+    template <>                                                                                   \
+    std::int64_t gesv_mixed_batch_scratchpad_size<TYPE>(                                          \
+        sycl::queue & queue, std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda,              \
+        std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,                           \
+        std::int64_t *group_sizes) {                                                              \
+        return group_scratchpad_size(group_count, group_sizes,                                    \
+                                     [=](std::int64_t g) { return mixed_lwork(n[g], nrhs[g]); }); \
+    }
+
+GESV_MIXED_BATCH_LAUNCHER_SCRATCH(double)
+GESV_MIXED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GESV_MIXED_BATCH_LAUNCHER_SCRATCH
+
+// LAPACKE_?getrf_work does not use scratchpad memory
+#define GETRF_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE)                                  \
+    template <>                                                                     \
+    std::int64_t getrf_batch_scratchpad_size<TYPE>(                                 \
+        sycl::queue & queue, std::int64_t m, std::int64_t n, std::int64_t lda,      \
+        std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) { \
+        return 0;                                                                   \
+    }
+
+GETRF_STRIDED_BATCH_LAUNCHER_SCRATCH(float)
+GETRF_STRIDED_BATCH_LAUNCHER_SCRATCH(double)
+GETRF_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+GETRF_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GETRF_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+// LAPACKE_?getrf_work does not use scratchpad memory
+#define GETRF_BATCH_LAUNCHER_SCRATCH(TYPE)                                        \
+    template <>                                                                   \
+    std::int64_t getrf_batch_scratchpad_size<TYPE>(                               \
+        sycl::queue & queue, std::int64_t *m, std::int64_t *n, std::int64_t *lda, \
+        std::int64_t group_count, std::int64_t *group_sizes) {                    \
+        return 0;                                                                 \
+    }
+
+GETRF_BATCH_LAUNCHER_SCRATCH(float)
+GETRF_BATCH_LAUNCHER_SCRATCH(double)
+GETRF_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+GETRF_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GETRF_BATCH_LAUNCHER_SCRATCH
+
+#define HEEVD_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE)                                                 \
+    template <>                                                                                    \
+    std::int64_t heevd_batch_scratchpad_size<TYPE>(                                                \
+        sycl::queue & queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,        \
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) { \
+        return batch_size * jacobi_lwork(n);                                                       \
+    }
+
+HEEVD_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+HEEVD_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef HEEVD_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define HEEVD_BATCH_LAUNCHER_SCRATCH(TYPE)                                                     \
+    template <>                                                                                \
+    std::int64_t heevd_batch_scratchpad_size<TYPE>(                                            \
+        sycl::queue & queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n, \
+        std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {              \
+        return group_scratchpad_size(group_count, group_sizes,                                 \
+                                     [=](std::int64_t g) { return jacobi_lwork(n[g]); });      \
+    }
+
+HEEVD_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+HEEVD_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef HEEVD_BATCH_LAUNCHER_SCRATCH
+
+#define HEEVR_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                \
+    template <>                                                                                    \
+    std::int64_t heevr_batch_scratchpad_size<TYPE>(                                                \
+        sycl::queue & queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                     \
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,           \
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) { \
+        return batch_size * heevr_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, jobz, range,      \
+                                              uplo, n, lda, ldz);                                  \
+    }
+
+HEEVR_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cheevr_work)
+HEEVR_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zheevr_work)
+
+#undef HEEVR_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define HEEVR_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                \
+    template <>                                                                            \
+    std::int64_t heevr_batch_scratchpad_size<TYPE>(                                        \
+        sycl::queue & queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,           \
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,    \
+        std::int64_t group_count, std::int64_t *group_sizes) {                             \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {       \
+            return heevr_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, jobz[g], range[g], \
+                                     uplo[g], n[g], lda[g], ldz[g]);                       \
+        });                                                                                \
+    }
+
+HEEVR_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cheevr_work)
+HEEVR_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zheevr_work)
+
+#undef HEEVR_BATCH_LAUNCHER_SCRATCH
+
+#define HEEVX_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                \
+    template <>                                                                                    \
+    std::int64_t heevx_batch_scratchpad_size<TYPE>(                                                \
+        sycl::queue & queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                     \
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,           \
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) { \
+        return batch_size * heevx_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, jobz, range,      \
+                                              uplo, n, lda, ldz);                                  \
+    }
+
+HEEVX_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cheevx_work)
+HEEVX_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zheevx_work)
+
+#undef HEEVX_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define HEEVX_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                \
+    template <>                                                                            \
+    std::int64_t heevx_batch_scratchpad_size<TYPE>(                                        \
+        sycl::queue & queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,           \
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,    \
+        std::int64_t group_count, std::int64_t *group_sizes) {                             \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {       \
+            return heevx_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, jobz[g], range[g], \
+                                     uplo[g], n[g], lda[g], ldz[g]);                       \
+        });                                                                                \
+    }
+
+HEEVX_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cheevx_work)
+HEEVX_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zheevx_work)
+
+#undef HEEVX_BATCH_LAUNCHER_SCRATCH
+
+#define ORGQR_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                             \
+    template <>                                                                                 \
+    std::int64_t orgqr_batch_scratchpad_size<TYPE>(                                             \
+        sycl::queue & queue, std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t lda,  \
+        std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {              \
+        return batch_size * orgqr_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, m, n, k, lda); \
+    }
+
+ORGQR_STRIDED_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_sorgqr_work)
+ORGQR_STRIDED_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dorgqr_work)
+
+#undef ORGQR_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define ORGQR_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                        \
+    template <>                                                                                    \
+    std::int64_t orgqr_batch_scratchpad_size<TYPE>(                                                \
+        sycl::queue & queue, std::int64_t *m, std::int64_t *n, std::int64_t *k, std::int64_t *lda, \
+        std::int64_t group_count, std::int64_t *group_sizes) {                                     \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {               \
+            return orgqr_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, m[g], n[g], k[g], lda[g]); \
+        });                                                                                        \
+    }
+
+ORGQR_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_sorgqr_work)
+ORGQR_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dorgqr_work)
+
+#undef ORGQR_BATCH_LAUNCHER_SCRATCH
+
+// LAPACKE_?potrf_work does not use scratchpad memory
+#define POTRF_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE)                                     \
+    template <>                                                                        \
+    std::int64_t potrf_batch_scratchpad_size<TYPE>(                                    \
+        sycl::queue & queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, \
+        std::int64_t stride_a, std::int64_t batch_size) {                              \
+        return 0;                                                                      \
+    }
+
+POTRF_STRIDED_BATCH_LAUNCHER_SCRATCH(float)
+POTRF_STRIDED_BATCH_LAUNCHER_SCRATCH(double)
+POTRF_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+POTRF_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POTRF_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+// LAPACKE_?potrf_work does not use scratchpad memory
+#define POTRF_BATCH_LAUNCHER_SCRATCH(TYPE)                                                \
+    template <>                                                                           \
+    std::int64_t potrf_batch_scratchpad_size<TYPE>(                                       \
+        sycl::queue & queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, \
+        std::int64_t group_count, std::int64_t *group_sizes) {                            \
+        return 0;                                                                         \
+    }
+
+POTRF_BATCH_LAUNCHER_SCRATCH(float)
+POTRF_BATCH_LAUNCHER_SCRATCH(double)
+POTRF_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+POTRF_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POTRF_BATCH_LAUNCHER_SCRATCH
+
+// LAPACKE_?potrs_work does not use scratchpad memory
+#define POTRS_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE)                                        \
+    template <>                                                                           \
+    std::int64_t potrs_batch_scratchpad_size<TYPE>(                                       \
+        sycl::queue & queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,   \
+        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, \
+        std::int64_t batch_size) {                                                        \
+        return 0;                                                                         \
+    }
+
+POTRS_STRIDED_BATCH_LAUNCHER_SCRATCH(float)
+POTRS_STRIDED_BATCH_LAUNCHER_SCRATCH(double)
+POTRS_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+POTRS_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POTRS_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+// LAPACKE_?potrs_work does not use scratchpad memory
+#define POTRS_BATCH_LAUNCHER_SCRATCH(TYPE)                                                 \
+    template <>                                                                            \
+    std::int64_t potrs_batch_scratchpad_size<TYPE>(                                        \
+        sycl::queue & queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs, \
+        std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,                    \
+        std::int64_t *group_sizes) {                                                       \
+        return 0;                                                                          \
+    }
+
+POTRS_BATCH_LAUNCHER_SCRATCH(float)
+POTRS_BATCH_LAUNCHER_SCRATCH(double)
+POTRS_BATCH_LAUNCHER_SCRATCH(std::complex<float>)
+POTRS_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POTRS_BATCH_LAUNCHER_SCRATCH
+
+#define POSV_MIXED_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE)                                   \
+    template <>                                                                           \
+    std::int64_t posv_mixed_batch_scratchpad_size<TYPE>(                                  \
+        sycl::queue & queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,   \
+        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, \
+        std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size) {               \
+        return batch_size * mixed_lwork(n, nrhs);                                         \
+    }
+
+POSV_MIXED_STRIDED_BATCH_LAUNCHER_SCRATCH(double)
+POSV_MIXED_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POSV_MIXED_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define POSV_MIXED_BATCH_LAUNCHER_SCRATCH(TYPE)                                                   \
+    template <>                                                                                   \
+    std::int64_t posv_mixed_batch_scratchpad_size<TYPE>(                                          \
+        sycl::queue & queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,        \
+        std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,        \
+        std::int64_t *group_sizes) {                                                              \
+        return group_scratchpad_size(group_count, group_sizes,                                    \
+                                     [=](std::int64_t g) { return mixed_lwork(n[g], nrhs[g]); }); \
+    }
+
+POSV_MIXED_BATCH_LAUNCHER_SCRATCH(double)
+POSV_MIXED_BATCH_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POSV_MIXED_BATCH_LAUNCHER_SCRATCH
+
+#define SYEVD_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE)                                                 \
+    template <>                                                                                    \
+    std::int64_t syevd_batch_scratchpad_size<TYPE>(                                                \
+        sycl::queue & queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,        \
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) { \
+        return batch_size * jacobi_lwork(n);                                                       \
+    }
+
+SYEVD_STRIDED_BATCH_LAUNCHER_SCRATCH(float)
+SYEVD_STRIDED_BATCH_LAUNCHER_SCRATCH(double)
+
+#undef SYEVD_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define SYEVD_BATCH_LAUNCHER_SCRATCH(TYPE)                                                     \
+    template <>                                                                                \
+    std::int64_t syevd_batch_scratchpad_size<TYPE>(                                            \
+        sycl::queue & queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n, \
+        std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {              \
+        return group_scratchpad_size(group_count, group_sizes,                                 \
+                                     [=](std::int64_t g) { return jacobi_lwork(n[g]); });      \
+    }
+
+SYEVD_BATCH_LAUNCHER_SCRATCH(float)
+SYEVD_BATCH_LAUNCHER_SCRATCH(double)
+
+#undef SYEVD_BATCH_LAUNCHER_SCRATCH
+
+#define SYEVR_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                \
+    template <>                                                                                    \
+    std::int64_t syevr_batch_scratchpad_size<TYPE>(                                                \
+        sycl::queue & queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                     \
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,           \
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) { \
+        return batch_size * syevr_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, jobz, range,      \
+                                              uplo, n, lda, ldz);                                  \
+    }
+
+SYEVR_STRIDED_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_ssyevr_work)
+SYEVR_STRIDED_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dsyevr_work)
+
+#undef SYEVR_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define SYEVR_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                \
+    template <>                                                                            \
+    std::int64_t syevr_batch_scratchpad_size<TYPE>(                                        \
+        sycl::queue & queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,           \
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,    \
+        std::int64_t group_count, std::int64_t *group_sizes) {                             \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {       \
+            return syevr_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, jobz[g], range[g], \
+                                     uplo[g], n[g], lda[g], ldz[g]);                       \
+        });                                                                                \
+    }
+
+SYEVR_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_ssyevr_work)
+SYEVR_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dsyevr_work)
+
+#undef SYEVR_BATCH_LAUNCHER_SCRATCH
+
+#define SYEVX_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                \
+    template <>                                                                                    \
+    std::int64_t syevx_batch_scratchpad_size<TYPE>(                                                \
+        sycl::queue & queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,                     \
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,           \
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) { \
+        return batch_size * syevx_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, jobz, range,      \
+                                              uplo, n, lda, ldz);                                  \
+    }
+
+SYEVX_STRIDED_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_ssyevx_work)
+SYEVX_STRIDED_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dsyevx_work)
+
+#undef SYEVX_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define SYEVX_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                \
+    template <>                                                                            \
+    std::int64_t syevx_batch_scratchpad_size<TYPE>(                                        \
+        sycl::queue & queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,           \
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,    \
+        std::int64_t group_count, std::int64_t *group_sizes) {                             \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {       \
+            return syevx_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, jobz[g], range[g], \
+                                     uplo[g], n[g], lda[g], ldz[g]);                       \
+        });                                                                                \
+    }
+
+SYEVX_BATCH_LAUNCHER_SCRATCH(float, LAPACKE_ssyevx_work)
+SYEVX_BATCH_LAUNCHER_SCRATCH(double, LAPACKE_dsyevx_work)
+
+#undef SYEVX_BATCH_LAUNCHER_SCRATCH
+
+#define UNGQR_STRIDED_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                             \
+    template <>                                                                                 \
+    std::int64_t ungqr_batch_scratchpad_size<TYPE>(                                             \
+        sycl::queue & queue, std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t lda,  \
+        std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {              \
+        return batch_size * orgqr_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, m, n, k, lda); \
+    }
+
+UNGQR_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cungqr_work)
+UNGQR_STRIDED_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zungqr_work)
+
+#undef UNGQR_STRIDED_BATCH_LAUNCHER_SCRATCH
+
+#define UNGQR_BATCH_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                        \
+    template <>                                                                                    \
+    std::int64_t ungqr_batch_scratchpad_size<TYPE>(                                                \
+        sycl::queue & queue, std::int64_t *m, std::int64_t *n, std::int64_t *k, std::int64_t *lda, \
+        std::int64_t group_count, std::int64_t *group_sizes) {                                     \
+        return group_scratchpad_size(group_count, group_sizes, [=](std::int64_t g) {               \
+            return orgqr_lwork<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, m[g], n[g], k[g], lda[g]); \
+        });                                                                                        \
+    }
+
+UNGQR_BATCH_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cungqr_work)
+UNGQR_BATCH_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zungqr_work)
+
+#undef UNGQR_BATCH_LAUNCHER_SCRATCH
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
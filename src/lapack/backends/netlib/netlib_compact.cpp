@@ -0,0 +1,615 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+#include "netlib_helper.hpp"
+#include "netlib_host.hpp"
+#include "host_parallel_helper.hpp"
+#include "netlib_small_batch.hpp"
+#include "oneapi/mkl/lapack/detail/netlib/onemkl_lapack_netlib.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+/**
+ * Compact batches.
+ *
+ * The *_compact routines take batches in the layout of compact_batch_layout,
+ * where element (i, j) of interleave consecutive matrices is stored
+ * contiguously. Every kernel maps one matrix to one work-item, so the
+ * work-items of a sub-group, which are the SIMD lanes on CPU devices, load
+ * and store neighbouring elements instead of gathering one element per
+ * matrix. interleave should be a multiple of the SIMD width, e.g. 16 for
+ * float and 8 for double with AVX-512.
+ *
+ * getrf, getrs and potrf reuse the small-matrix kernels. Larger matrices are
+ * copied out of the compact layout one at a time and computed by LAPACKE.
+ */
+
+// Throws invalid_argument for the parameter at the given position, counted
+// from 1 after the queue, as LAPACKE does for its own parameters.
+inline void compact_check(const char *func_name, std::int64_t position, bool valid) {
+    if (!valid)
+        lapacke_info_check(func_name, func_name, -position);
+}
+
+inline bool compact_ld_valid(std::int64_t ld, std::int64_t rows) {
+    return ld >= std::max<std::int64_t>(1, rows);
+}
+
+// Raw pointers inside a host task, for USM pointers and buffer accessors.
+template <typename T>
+inline T *compact_host_ptr(T *ptr) {
+    return ptr;
+}
+
+template <typename Acc>
+inline auto compact_host_ptr(const Acc &acc) {
+    return acc.GET_MULTI_PTR;
+}
+
+// Copies matrix id of a compact batch to the column-major x, and back.
+template <typename T>
+inline void compact_gather(const T *a, compact_batch_layout layout, std::int64_t id,
+                           std::int64_t m, std::int64_t n, T *x, std::int64_t ldx) {
+    for (std::int64_t j = 0; j < n; ++j) {
+        for (std::int64_t i = 0; i < m; ++i)
+            x[i + j * ldx] = a[layout(id, i, j)];
+    }
+}
+
+template <typename T>
+inline void compact_scatter(const T *x, std::int64_t ldx, T *a, compact_batch_layout layout,
+                            std::int64_t id, std::int64_t m, std::int64_t n) {
+    for (std::int64_t j = 0; j < n; ++j) {
+        for (std::int64_t i = 0; i < m; ++i)
+            a[layout(id, i, j)] = x[i + j * ldx];
+    }
+}
+
+// KERNELS
+
+template <typename LayoutSrc, typename LayoutDst, typename AccSrc, typename AccDst>
+struct compact_copy_kernel {
+    AccSrc src;
+    AccDst dst;
+    LayoutSrc layout_src;
+    LayoutDst layout_dst;
+    std::int64_t m, n;
+
+    void operator()(sycl::id<1> id) const {
+        for (std::int64_t j = 0; j < n; ++j) {
+            for (std::int64_t i = 0; i < m; ++i)
+                dst[layout_dst(id[0], i, j)] = src[layout_src(id[0], i, j)];
+        }
+    }
+};
+
+/**
+ * Solution of op(A) * X = alpha * B or X * op(A) = alpha * B for one matrix,
+ * overwriting B, as in trsm. Both sides reduce to substitutions with the
+ * triangular matrix M = op(A) for left, or op(A)^T for right, applied to the
+ * columns or to the rows of B.
+ */
+template <typename T, typename AccA, typename AccB>
+struct compact_trsm_kernel {
+    AccA a;
+    AccB b;
+    compact_batch_layout layout_a, layout_b;
+    bool left, lower, trans, unit;
+    std::int64_t m, n;
+    T alpha;
+
+    void operator()(sycl::id<1> id) const {
+        const bool t = left ? trans : !trans;
+        const bool forward = lower != t;
+        const std::int64_t len = left ? m : n, count = left ? n : m;
+        auto mat = [&](std::int64_t i, std::int64_t k) {
+            return t ? a[layout_a(id[0], k, i)] : a[layout_a(id[0], i, k)];
+        };
+        auto vec = [&](std::int64_t v, std::int64_t i) -> decltype(b[0]) {
+            return left ? b[layout_b(id[0], i, v)] : b[layout_b(id[0], v, i)];
+        };
+        for (std::int64_t v = 0; v < count; ++v) {
+            for (std::int64_t s = 0; s < len; ++s) {
+                const std::int64_t i = forward ? s : len - 1 - s;
+                T x = alpha * vec(v, i);
+                if (forward) {
+                    for (std::int64_t k = 0; k < i; ++k)
+                        x -= mat(i, k) * vec(v, k);
+                }
+                else {
+                    for (std::int64_t k = i + 1; k < len; ++k)
+                        x -= mat(i, k) * vec(v, k);
+                }
+                vec(v, i) = unit ? x : x / mat(i, i);
+            }
+        }
+    }
+};
+
+/**
+ * C = alpha * op(A) * op(B) + beta * C for one matrix, as in gemm. C is not
+ * read when beta is zero.
+ */
+template <typename T, typename AccA, typename AccB, typename AccC>
+struct compact_gemm_kernel {
+    AccA a;
+    AccB b;
+    AccC c;
+    compact_batch_layout layout_a, layout_b, layout_c;
+    bool transa, transb;
+    std::int64_t m, n, k;
+    T alpha, beta;
+
+    void operator()(sycl::id<1> id) const {
+        for (std::int64_t j = 0; j < n; ++j) {
+            for (std::int64_t i = 0; i < m; ++i) {
+                T s = T(0);
+                for (std::int64_t l = 0; l < k; ++l) {
+                    const T x = transa ? a[layout_a(id[0], l, i)] : a[layout_a(id[0], i, l)];
+                    const T y = transb ? b[layout_b(id[0], j, l)] : b[layout_b(id[0], l, j)];
+                    s += x * y;
+                }
+                const std::int64_t ij = layout_c(id[0], i, j);
+                c[ij] = beta == T(0) ? alpha * s : alpha * s + beta * c[ij];
+            }
+        }
+    }
+};
+
+// COMPACT DRIVERS
+
+template <typename T, typename A, typename AP>
+inline sycl::event compact_pack(sycl::queue &queue, std::int64_t m, std::int64_t n, A &&a,
+                                std::int64_t lda, std::int64_t stride_a, AP &&ap,
+                                std::int64_t ldap, std::int64_t interleave,
+                                std::int64_t batch_size,
+                                const std::vector<sycl::event> &dependencies) {
+    compact_check("pack_compact", 1, m >= 0);
+    compact_check("pack_compact", 2, n >= 0);
+    compact_check("pack_compact", 4, compact_ld_valid(lda, m));
+    compact_check("pack_compact", 5, stride_a >= lda * n);
+    compact_check("pack_compact", 7, compact_ld_valid(ldap, m));
+    compact_check("pack_compact", 8, interleave > 0);
+    compact_check("pack_compact", 9, batch_size >= 0);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto ap_acc = small_batch_ptr(ap, cgh);
+        using kernel_t = compact_copy_kernel<strided_batch_layout, compact_batch_layout,
+                                             decltype(a_acc), decltype(ap_acc)>;
+        cgh.parallel_for(sycl::range<1>(batch_size),
+                         kernel_t{ a_acc, ap_acc, strided_batch_layout{ lda, stride_a },
+                                   compact_batch_layout(ldap, n, interleave), m, n });
+    });
+}
+
+template <typename T, typename AP, typename A>
+inline sycl::event compact_unpack(sycl::queue &queue, std::int64_t m, std::int64_t n, AP &&ap,
+                                  std::int64_t ldap, A &&a, std::int64_t lda,
+                                  std::int64_t stride_a, std::int64_t interleave,
+                                  std::int64_t batch_size,
+                                  const std::vector<sycl::event> &dependencies) {
+    compact_check("unpack_compact", 1, m >= 0);
+    compact_check("unpack_compact", 2, n >= 0);
+    compact_check("unpack_compact", 4, compact_ld_valid(ldap, m));
+    compact_check("unpack_compact", 6, compact_ld_valid(lda, m));
+    compact_check("unpack_compact", 7, stride_a >= lda * n);
+    compact_check("unpack_compact", 8, interleave > 0);
+    compact_check("unpack_compact", 9, batch_size >= 0);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto ap_acc = small_batch_ptr(ap, cgh);
+        auto a_acc = small_batch_ptr(a, cgh);
+        using kernel_t = compact_copy_kernel<compact_batch_layout, strided_batch_layout,
+                                             decltype(ap_acc), decltype(a_acc)>;
+        cgh.parallel_for(sycl::range<1>(batch_size),
+                         kernel_t{ ap_acc, a_acc, compact_batch_layout(ldap, n, interleave),
+                                   strided_batch_layout{ lda, stride_a }, m, n });
+    });
+}
+
+template <typename T, typename Func, typename A, typename Ipiv>
+inline sycl::event compact_getrf(const char *lapacke_name, Func func, sycl::queue &queue,
+                                 std::int64_t m, std::int64_t n, A &&a, std::int64_t lda,
+                                 Ipiv &&ipiv, std::int64_t stride_ipiv, std::int64_t interleave,
+                                 std::int64_t batch_size,
+                                 const std::vector<sycl::event> &dependencies) {
+    compact_check("getrf_compact", 1, m >= 0);
+    compact_check("getrf_compact", 2, n >= 0);
+    compact_check("getrf_compact", 4, compact_ld_valid(lda, m));
+    compact_check("getrf_compact", 6, stride_ipiv >= std::min(m, n));
+    compact_check("getrf_compact", 7, interleave > 0);
+    compact_check("getrf_compact", 8, batch_size >= 0);
+    const compact_batch_layout layout(lda, n, interleave);
+    if (use_small_batch<T>(m, n, lda, batch_size))
+        return small_getrf<T>(queue, "getrf_compact", m, n, a, layout, ipiv, stride_ipiv,
+                              batch_size, dependencies);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto ipiv_acc = small_batch_ptr(ipiv, cgh);
+        cgh.host_task([=]() {
+            T *a_ptr = compact_host_ptr(a_acc);
+            std::int64_t *ipiv_ptr = compact_host_ptr(ipiv_acc);
+            const std::int64_t ldx = std::max<std::int64_t>(1, m);
+            batch_info info("getrf_compact", lapacke_name, batch_size);
+            host::host_parallel_for(batch_size, [&](std::int64_t id) {
+                std::vector<T> x(ldx * n);
+                compact_gather(a_ptr, layout, id, m, n, x.data(), ldx);
+                info.set(id, host_getrf<T>(func, m, n, x.data(), ldx, ipiv_ptr + id * stride_ipiv));
+                compact_scatter(x.data(), ldx, a_ptr, layout, id, m, n);
+            });
+            info.check();
+        });
+    });
+}
+
+template <typename T, typename Func, typename A, typename Ipiv, typename B>
+inline sycl::event compact_getrs(const char *lapacke_name, Func func, sycl::queue &queue,
+                                 oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+                                 A &&a, std::int64_t lda, Ipiv &&ipiv, std::int64_t stride_ipiv,
+                                 B &&b, std::int64_t ldb, std::int64_t interleave,
+                                 std::int64_t batch_size,
+                                 const std::vector<sycl::event> &dependencies) {
+    compact_check("getrs_compact", 2, n >= 0);
+    compact_check("getrs_compact", 3, nrhs >= 0);
+    compact_check("getrs_compact", 5, compact_ld_valid(lda, n));
+    compact_check("getrs_compact", 7, stride_ipiv >= n);
+    compact_check("getrs_compact", 9, compact_ld_valid(ldb, n));
+    compact_check("getrs_compact", 10, interleave > 0);
+    compact_check("getrs_compact", 11, batch_size >= 0);
+    const compact_batch_layout layout_a(lda, n, interleave), layout_b(ldb, nrhs, interleave);
+    if (use_small_batch_solve<T>(n, nrhs, lda, ldb, batch_size))
+        return small_getrs<T>(queue, trans, n, nrhs, a, layout_a, ipiv, stride_ipiv, b, layout_b,
+                              batch_size, dependencies);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto ipiv_acc = small_batch_ptr(ipiv, cgh);
+        auto b_acc = small_batch_ptr(b, cgh);
+        cgh.host_task([=]() {
+            T *a_ptr = compact_host_ptr(a_acc);
+            std::int64_t *ipiv_ptr = compact_host_ptr(ipiv_acc);
+            T *b_ptr = compact_host_ptr(b_acc);
+            const std::int64_t ldx = std::max<std::int64_t>(1, n);
+            batch_info info("getrs_compact", lapacke_name, batch_size);
+            host::host_parallel_for(batch_size, [&](std::int64_t id) {
+                std::vector<T> x(ldx * n), y(ldx * nrhs);
+                compact_gather(a_ptr, layout_a, id, n, n, x.data(), ldx);
+                compact_gather(b_ptr, layout_b, id, n, nrhs, y.data(), ldx);
+                info.set(id, host_getrs<T>(func, trans, n, nrhs, x.data(), ldx,
+                                           ipiv_ptr + id * stride_ipiv, y.data(), ldx));
+                compact_scatter(y.data(), ldx, b_ptr, layout_b, id, n, nrhs);
+            });
+            info.check();
+        });
+    });
+}
+
+template <typename T, typename Func, typename A>
+inline sycl::event compact_potrf(const char *lapacke_name, Func func, sycl::queue &queue,
+                                 oneapi::mkl::uplo uplo, std::int64_t n, A &&a, std::int64_t lda,
+                                 std::int64_t interleave, std::int64_t batch_size,
+                                 const std::vector<sycl::event> &dependencies) {
+    compact_check("potrf_compact", 2, n >= 0);
+    compact_check("potrf_compact", 4, compact_ld_valid(lda, n));
+    compact_check("potrf_compact", 5, interleave > 0);
+    compact_check("potrf_compact", 6, batch_size >= 0);
+    const compact_batch_layout layout(lda, n, interleave);
+    if (use_small_batch<T>(n, n, lda, batch_size))
+        return small_potrf<T>(queue, "potrf_compact", uplo, n, a, layout, batch_size,
+                              dependencies);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        cgh.host_task([=]() {
+            T *a_ptr = compact_host_ptr(a_acc);
+            const std::int64_t ldx = std::max<std::int64_t>(1, n);
+            batch_info info("potrf_compact", lapacke_name, batch_size);
+            host::host_parallel_for(batch_size, [&](std::int64_t id) {
+                std::vector<T> x(ldx * n);
+                compact_gather(a_ptr, layout, id, n, n, x.data(), ldx);
+                info.set(id, host_potrf<T>(func, uplo, n, x.data(), ldx));
+                compact_scatter(x.data(), ldx, a_ptr, layout, id, n, n);
+            });
+            info.check();
+        });
+    });
+}
+
+template <typename T, typename A, typename B>
+inline sycl::event compact_trsm(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                                std::int64_t m, std::int64_t n, T alpha, A &&a, std::int64_t lda,
+                                B &&b, std::int64_t ldb, std::int64_t interleave,
+                                std::int64_t batch_size,
+                                const std::vector<sycl::event> &dependencies) {
+    const bool left = side == oneapi::mkl::side::left;
+    const std::int64_t k = left ? m : n;
+    compact_check("trsm_compact", 5, m >= 0);
+    compact_check("trsm_compact", 6, n >= 0);
+    compact_check("trsm_compact", 9, compact_ld_valid(lda, k));
+    compact_check("trsm_compact", 11, compact_ld_valid(ldb, m));
+    compact_check("trsm_compact", 12, interleave > 0);
+    compact_check("trsm_compact", 13, batch_size >= 0);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto b_acc = small_batch_ptr(b, cgh);
+        using kernel_t = compact_trsm_kernel<T, decltype(a_acc), decltype(b_acc)>;
+        cgh.parallel_for(sycl::range<1>(batch_size),
+                         kernel_t{ a_acc, b_acc, compact_batch_layout(lda, k, interleave),
+                                   compact_batch_layout(ldb, n, interleave), left,
+                                   uplo == oneapi::mkl::uplo::lower,
+                                   trans != oneapi::mkl::transpose::nontrans,
+                                   diag == oneapi::mkl::diag::unit, m, n, alpha });
+    });
+}
+
+template <typename T, typename A, typename B, typename C>
+inline sycl::event compact_gemm(sycl::queue &queue, oneapi::mkl::transpose transa,
+                                oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                                std::int64_t k, T alpha, A &&a, std::int64_t lda, B &&b,
+                                std::int64_t ldb, T beta, C &&c, std::int64_t ldc,
+                                std::int64_t interleave, std::int64_t batch_size,
+                                const std::vector<sycl::event> &dependencies) {
+    const bool ta = transa != oneapi::mkl::transpose::nontrans;
+    const bool tb = transb != oneapi::mkl::transpose::nontrans;
+    compact_check("gemm_compact", 3, m >= 0);
+    compact_check("gemm_compact", 4, n >= 0);
+    compact_check("gemm_compact", 5, k >= 0);
+    compact_check("gemm_compact", 8, compact_ld_valid(lda, ta ? k : m));
+    compact_check("gemm_compact", 10, compact_ld_valid(ldb, tb ? n : k));
+    compact_check("gemm_compact", 13, compact_ld_valid(ldc, m));
+    compact_check("gemm_compact", 14, interleave > 0);
+    compact_check("gemm_compact", 15, batch_size >= 0);
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto b_acc = small_batch_ptr(b, cgh);
+        auto c_acc = small_batch_ptr(c, cgh);
+        using kernel_t =
+            compact_gemm_kernel<T, decltype(a_acc), decltype(b_acc), decltype(c_acc)>;
+        cgh.parallel_for(sycl::range<1>(batch_size),
+                         kernel_t{ a_acc, b_acc, c_acc,
+                                   compact_batch_layout(lda, ta ? m : k, interleave),
+                                   compact_batch_layout(ldb, tb ? k : n, interleave),
+                                   compact_batch_layout(ldc, n, interleave), ta, tb, m, n, k,
+                                   alpha, beta });
+    });
+}
+
+// BUFFER APIs
+
+#define PACK_COMPACT_LAUNCHER(TYPE)                                                              \
+    void pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE> &a, \
+                      std::int64_t lda, std::int64_t stride_a, sycl::buffer<TYPE> &ap,           \
+                      std::int64_t ldap, std::int64_t interleave, std::int64_t batch_size) {     \
+        compact_pack<TYPE>(queue, m, n, a, lda, stride_a, ap, ldap, interleave, batch_size, {}); \
+    }
+
+PACK_COMPACT_LAUNCHER(float)
+PACK_COMPACT_LAUNCHER(double)
+
+#undef PACK_COMPACT_LAUNCHER
+
+#define UNPACK_COMPACT_LAUNCHER(TYPE)                                                              \
+    void unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n,                        \
+                        sycl::buffer<TYPE> &ap, std::int64_t ldap, sycl::buffer<TYPE> &a,          \
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t interleave,          \
+                        std::int64_t batch_size) {                                                 \
+        compact_unpack<TYPE>(queue, m, n, ap, ldap, a, lda, stride_a, interleave, batch_size, {}); \
+    }
+
+UNPACK_COMPACT_LAUNCHER(float)
+UNPACK_COMPACT_LAUNCHER(double)
+
+#undef UNPACK_COMPACT_LAUNCHER
+
+#define GETRF_COMPACT_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                             \
+    void getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE> &a, \
+                       std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,                        \
+                       std::int64_t stride_ipiv, std::int64_t interleave,                         \
+                       std::int64_t batch_size) {                                                 \
+        compact_getrf<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, ipiv,         \
+                            stride_ipiv, interleave, batch_size, {});                             \
+    }
+
+GETRF_COMPACT_LAUNCHER(float, LAPACKE_sgetrf_work)
+GETRF_COMPACT_LAUNCHER(double, LAPACKE_dgetrf_work)
+
+#undef GETRF_COMPACT_LAUNCHER
+
+#define GETRS_COMPACT_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                         \
+    void getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,      \
+                       std::int64_t nrhs, sycl::buffer<TYPE> &a, std::int64_t lda,            \
+                       sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,            \
+                       sycl::buffer<TYPE> &b, std::int64_t ldb, std::int64_t interleave,      \
+                       std::int64_t batch_size) {                                             \
+        compact_getrs<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, n, nrhs, a, lda, \
+                            ipiv, stride_ipiv, b, ldb, interleave, batch_size, {});           \
+    }
+
+GETRS_COMPACT_LAUNCHER(float, LAPACKE_sgetrs_work)
+GETRS_COMPACT_LAUNCHER(double, LAPACKE_dgetrs_work)
+
+#undef GETRS_COMPACT_LAUNCHER
+
+#define POTRF_COMPACT_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                              \
+    void potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,                 \
+                       sycl::buffer<TYPE> &a, std::int64_t lda, std::int64_t interleave,           \
+                       std::int64_t batch_size) {                                                  \
+        compact_potrf<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, interleave, \
+                            batch_size, {});                                                       \
+    }
+
+POTRF_COMPACT_LAUNCHER(float, LAPACKE_spotrf_work)
+POTRF_COMPACT_LAUNCHER(double, LAPACKE_dpotrf_work)
+
+#undef POTRF_COMPACT_LAUNCHER
+
+#define TRSM_COMPACT_LAUNCHER(TYPE)                                                         \
+    void trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,   \
+                      oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, \
+                      std::int64_t n, TYPE alpha, sycl::buffer<TYPE> &a, std::int64_t lda,  \
+                      sycl::buffer<TYPE> &b, std::int64_t ldb, std::int64_t interleave,     \
+                      std::int64_t batch_size) {                                            \
+        compact_trsm<TYPE>(queue, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb,     \
+                           interleave, batch_size, {});                                     \
+    }
+
+TRSM_COMPACT_LAUNCHER(float)
+TRSM_COMPACT_LAUNCHER(double)
+
+#undef TRSM_COMPACT_LAUNCHER
+
+#define GEMM_COMPACT_LAUNCHER(TYPE)                                                              \
+    void gemm_compact(sycl::queue &queue, oneapi::mkl::transpose transa,                         \
+                      oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,             \
+                      std::int64_t k, TYPE alpha, sycl::buffer<TYPE> &a, std::int64_t lda,       \
+                      sycl::buffer<TYPE> &b, std::int64_t ldb, TYPE beta, sycl::buffer<TYPE> &c, \
+                      std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size) {      \
+        compact_gemm<TYPE>(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,  \
+                           interleave, batch_size, {});                                          \
+    }
+
+GEMM_COMPACT_LAUNCHER(float)
+GEMM_COMPACT_LAUNCHER(double)
+
+#undef GEMM_COMPACT_LAUNCHER
+
+// USM APIs
+
+#define PACK_COMPACT_LAUNCHER_USM(TYPE)                                                            \
+    sycl::event pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *a,          \
+                             std::int64_t lda, std::int64_t stride_a, TYPE *ap, std::int64_t ldap, \
+                             std::int64_t interleave, std::int64_t batch_size,                     \
+                             const std::vector<sycl::event> &dependencies) {                       \
+        return compact_pack<TYPE>(queue, m, n, a, lda, stride_a, ap, ldap, interleave, batch_size, \
+                                  dependencies);                                                   \
+    }
+
+PACK_COMPACT_LAUNCHER_USM(float)
+PACK_COMPACT_LAUNCHER_USM(double)
+
+#undef PACK_COMPACT_LAUNCHER_USM
+
+#define UNPACK_COMPACT_LAUNCHER_USM(TYPE)                                                          \
+    sycl::event unpack_compact(                                                                    \
+        sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *ap, std::int64_t ldap, TYPE *a,  \
+        std::int64_t lda, std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size, \
+        const std::vector<sycl::event> &dependencies) {                                            \
+        return compact_unpack<TYPE>(queue, m, n, ap, ldap, a, lda, stride_a, interleave,           \
+                                    batch_size, dependencies);                                     \
+    }
+
+UNPACK_COMPACT_LAUNCHER_USM(float)
+UNPACK_COMPACT_LAUNCHER_USM(double)
+
+#undef UNPACK_COMPACT_LAUNCHER_USM
+
+#define GETRF_COMPACT_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                        \
+    sycl::event getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *a,       \
+                              std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv,    \
+                              std::int64_t interleave, std::int64_t batch_size,                  \
+                              const std::vector<sycl::event> &dependencies) {                    \
+        return compact_getrf<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, ipiv, \
+                                   stride_ipiv, interleave, batch_size, dependencies);           \
+    }
+
+GETRF_COMPACT_LAUNCHER_USM(float, LAPACKE_sgetrf_work)
+GETRF_COMPACT_LAUNCHER_USM(double, LAPACKE_dgetrf_work)
+
+#undef GETRF_COMPACT_LAUNCHER_USM
+
+#define GETRS_COMPACT_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                       \
+    sycl::event getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, \
+                              std::int64_t nrhs, TYPE *a, std::int64_t lda, std::int64_t *ipiv, \
+                              std::int64_t stride_ipiv, TYPE *b, std::int64_t ldb,              \
+                              std::int64_t interleave, std::int64_t batch_size,                 \
+                              const std::vector<sycl::event> &dependencies) {                   \
+        return compact_getrs<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, n, nrhs, a, \
+                                   lda, ipiv, stride_ipiv, b, ldb, interleave, batch_size,      \
+                                   dependencies);                                               \
+    }
+
+GETRS_COMPACT_LAUNCHER_USM(float, LAPACKE_sgetrs_work)
+GETRS_COMPACT_LAUNCHER_USM(double, LAPACKE_dgetrs_work)
+
+#undef GETRS_COMPACT_LAUNCHER_USM
+
+#define POTRF_COMPACT_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                          \
+    sycl::event potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, \
+                              std::int64_t lda, std::int64_t interleave, std::int64_t batch_size,  \
+                              const std::vector<sycl::event> &dependencies) {                      \
+        return compact_potrf<TYPE>(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda,      \
+                                   interleave, batch_size, dependencies);                          \
+    }
+
+POTRF_COMPACT_LAUNCHER_USM(float, LAPACKE_spotrf_work)
+POTRF_COMPACT_LAUNCHER_USM(double, LAPACKE_dpotrf_work)
+
+#undef POTRF_COMPACT_LAUNCHER_USM
+
+#define TRSM_COMPACT_LAUNCHER_USM(TYPE)                                                            \
+    sycl::event trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,   \
+                             oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, \
+                             std::int64_t n, TYPE alpha, TYPE *a, std::int64_t lda, TYPE *b,       \
+                             std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,   \
+                             const std::vector<sycl::event> &dependencies) {                       \
+        return compact_trsm<TYPE>(queue, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb,     \
+                                  interleave, batch_size, dependencies);                           \
+    }
+
+TRSM_COMPACT_LAUNCHER_USM(float)
+TRSM_COMPACT_LAUNCHER_USM(double)
+
+#undef TRSM_COMPACT_LAUNCHER_USM
+
+#define GEMM_COMPACT_LAUNCHER_USM(TYPE)                                                           \
+    sycl::event gemm_compact(                                                                     \
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,         \
+        std::int64_t m, std::int64_t n, std::int64_t k, TYPE alpha, TYPE *a, std::int64_t lda,    \
+        TYPE *b, std::int64_t ldb, TYPE beta, TYPE *c, std::int64_t ldc, std::int64_t interleave, \
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {                  \
+        return compact_gemm<TYPE>(queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, \
+                                  ldc, interleave, batch_size, dependencies);                     \
+    }
+
+GEMM_COMPACT_LAUNCHER_USM(float)
+GEMM_COMPACT_LAUNCHER_USM(double)
+
+#undef GEMM_COMPACT_LAUNCHER_USM
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_HELPER_HPP_
+#define _NETLIB_LAPACK_HELPER_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include <complex>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// The oneMKL LAPACK interface uses 64-bit integers throughout, so the backend
+// requires an ILP64 build of LAPACKE, and of the CBLAS that comes with it.
+// cmake/FindLAPACKE.cmake only accepts the lapacke64, lapack64, cblas64 and
+// blas64 libraries, so the configure step fails without them.
+#define lapack_int            std::int64_t
+#define lapack_complex_float  std::complex<float>
+#define lapack_complex_double std::complex<double>
+#ifndef CBLAS_INT
+#define CBLAS_INT std::int64_t
+#endif
+#define WeirdNEC
+extern "C" {
+#include "cblas.h"
+#include "lapacke.h"
+}
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/lapack/exceptions.hpp"
+
+#define GET_MULTI_PTR template get_multi_ptr<sycl::access::decorated::yes>().get_raw()
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+template <typename T>
+struct real_type {
+    using type = T;
+};
+
+template <typename T>
+struct real_type<std::complex<T>> {
+    using type = T;
+};
+
+template <typename T>
+using real_t = typename real_type<T>::type;
+
+template <typename T>
+constexpr bool is_complex = !std::is_same_v<T, real_t<T>>;
+
+// Single precision type used by the mixed-precision solvers for type T.
+template <typename T>
+using single_t = std::conditional_t<is_complex<T>, std::complex<float>, float>;
+
+/**
+ * Helper methods for converting between onemkl types and their LAPACKE
+ * character equivalents.
+ */
+
+template <typename T>
+inline char get_lapacke_trans(oneapi::mkl::transpose trans) {
+    if (trans == oneapi::mkl::transpose::nontrans)
+        return 'N';
+    // Real routines such as ormqr only accept 'T'.
+    if (trans == oneapi::mkl::transpose::trans || !is_complex<T>)
+        return 'T';
+    return 'C';
+}
+
+inline char get_lapacke_uplo(oneapi::mkl::uplo uplo) {
+    return uplo == oneapi::mkl::uplo::upper ? 'U' : 'L';
+}
+
+inline char get_lapacke_diag(oneapi::mkl::diag diag) {
+    return diag == oneapi::mkl::diag::unit ? 'U' : 'N';
+}
+
+inline char get_lapacke_side(oneapi::mkl::side side) {
+    return side == oneapi::mkl::side::left ? 'L' : 'R';
+}
+
+inline char get_lapacke_job(oneapi::mkl::job jobz) {
+    return jobz == oneapi::mkl::job::novec ? 'N' : 'V';
+}
+
+inline char get_lapacke_range(oneapi::mkl::rangev range) {
+    switch (range) {
+        case oneapi::mkl::rangev::values: return 'V';
+        case oneapi::mkl::rangev::indices: return 'I';
+        default: return 'A';
+    }
+}
+
+inline char get_lapacke_jobsvd(oneapi::mkl::jobsvd job) {
+    switch (job) {
+        case oneapi::mkl::jobsvd::vectors: return 'A';
+        case oneapi::mkl::jobsvd::vectorsina: return 'O';
+        case oneapi::mkl::jobsvd::somevec: return 'S';
+        default: return 'N';
+    }
+}
+
+inline char get_lapacke_generate(oneapi::mkl::generate vect) {
+    return vect == oneapi::mkl::generate::p ? 'P' : 'Q';
+}
+
+/**
+ * Translates a LAPACKE return value into the oneMKL LAPACK exceptions.
+ */
+inline void lapacke_info_check(const char *func_name, const char *lapacke_name,
+                               lapack_int info) {
+    if (info < 0)
+        throw oneapi::mkl::lapack::invalid_argument(
+            func_name,
+            std::string(lapacke_name) + " parameter number " + std::to_string(-info) +
+                " had an illegal value",
+            -info);
+    if (info > 0)
+        throw oneapi::mkl::lapack::computation_error(
+            func_name, std::string(lapacke_name) + " failed with info = " + std::to_string(info),
+            info);
+}
+
+/**
+ * Runs a LAPACKE workspace query, i.e. query(work) with lwork = -1, and
+ * returns the optimal size of the work array.
+ */
+template <typename T, typename Query>
+inline std::int64_t lapacke_query(const char *func_name, const char *lapacke_name, Query query) {
+    T work_query{};
+    lapacke_info_check(func_name, lapacke_name, query(&work_query));
+    return static_cast<std::int64_t>(std::real(work_query));
+}
+
+/**
+ * Collects the failures of the problems of a batch and reports them as a
+ * single batch_error once the whole batch has been processed.
+ */
+class batch_info {
+public:
+    batch_info(const char *func_name, const char *lapacke_name, std::int64_t batch_size)
+            : func_name_(func_name),
+              lapacke_name_(lapacke_name),
+              info_(batch_size, 0) {}
+
+    void set(std::int64_t id, lapack_int info) {
+        info_[id] = info;
+    }
+
+    void check() const {
+        std::vector<std::int64_t> ids;
+        std::vector<std::exception_ptr> exceptions;
+        for (std::int64_t id = 0; id < static_cast<std::int64_t>(info_.size()); ++id) {
+            if (info_[id] == 0)
+                continue;
+            ids.push_back(id);
+            try {
+                lapacke_info_check(func_name_, lapacke_name_, info_[id]);
+            }
+            catch (...) {
+                exceptions.push_back(std::current_exception());
+            }
+        }
+        if (!ids.empty())
+            throw oneapi::mkl::lapack::batch_error(
+                func_name_,
+                std::string(lapacke_name_) + " failed for " + std::to_string(ids.size()) +
+                    " problem(s) of the batch",
+                ids.size(), ids, exceptions);
+    }
+
+private:
+    const char *func_name_;
+    const char *lapacke_name_;
+    std::vector<lapack_int> info_;
+};
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_HELPER_HPP_
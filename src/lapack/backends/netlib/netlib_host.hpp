@@ -0,0 +1,459 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_HOST_HPP_
+#define _NETLIB_LAPACK_HOST_HPP_
+
+#include <algorithm>
+#include <vector>
+
+#include "netlib_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+/**
+ * Host drivers calling the column-major LAPACKE _work routines. They take the
+ * oneMKL arguments with raw host pointers and return the LAPACKE info. The
+ * scratchpad is used as the LAPACK work array; passing lwork = -1 performs a
+ * workspace query that stores the optimal size in work[0]. Routines that also
+ * need integer or real workspaces allocate those internally.
+ */
+
+template <typename T, typename Func>
+inline lapack_int host_gebrd(Func func, std::int64_t m, std::int64_t n, T *a, std::int64_t lda,
+                             real_t<T> *d, real_t<T> *e, T *tauq, T *taup, T *work,
+                             std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, m, n, a, lda, d, e, tauq, taup, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_gels(Func func, oneapi::mkl::transpose trans, std::int64_t m,
+                            std::int64_t n, std::int64_t nrhs, T *a, std::int64_t lda, T *b,
+                            std::int64_t ldb, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_trans<T>(trans), m, n, nrhs, a, lda, b, ldb, work,
+                lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_gerqf(Func func, std::int64_t m, std::int64_t n, T *a, std::int64_t lda,
+                             T *tau, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, m, n, a, lda, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_geqrf(Func func, std::int64_t m, std::int64_t n, T *a, std::int64_t lda,
+                             T *tau, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, m, n, a, lda, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_getrf(Func func, std::int64_t m, std::int64_t n, T *a, std::int64_t lda,
+                             std::int64_t *ipiv) {
+    return func(LAPACK_COL_MAJOR, m, n, a, lda, ipiv);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_getri(Func func, std::int64_t n, T *a, std::int64_t lda,
+                             const std::int64_t *ipiv, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, n, a, lda, ipiv, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_getrs(Func func, oneapi::mkl::transpose trans, std::int64_t n,
+                             std::int64_t nrhs, const T *a, std::int64_t lda,
+                             const std::int64_t *ipiv, T *b, std::int64_t ldb) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_trans<T>(trans), n, nrhs, a, lda, ipiv, b, ldb);
+}
+
+// Size of the work array of the mixed-precision solvers, in elements of T.
+inline std::int64_t mixed_lwork(std::int64_t n, std::int64_t nrhs) {
+    return std::max<std::int64_t>(1, n * nrhs);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_gesv_mixed(Func func, std::int64_t n, std::int64_t nrhs, T *a,
+                                  std::int64_t lda, std::int64_t *ipiv, T *b, std::int64_t ldb,
+                                  T *x, std::int64_t ldx, std::int64_t *iter, T *work) {
+    std::vector<single_t<T>> swork(std::max<std::int64_t>(1, n * (n + nrhs)));
+    lapack_int info;
+    if constexpr (is_complex<T>) {
+        std::vector<real_t<T>> rwork(std::max<std::int64_t>(1, n));
+        info = func(LAPACK_COL_MAJOR, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, work, swork.data(),
+                    rwork.data(), iter);
+    }
+    else {
+        info = func(LAPACK_COL_MAJOR, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, work, swork.data(),
+                    iter);
+    }
+    return info;
+}
+
+template <typename T, typename Func>
+inline lapack_int host_gesvd(Func func, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                             std::int64_t m, std::int64_t n, T *a, std::int64_t lda, real_t<T> *s,
+                             T *u, std::int64_t ldu, T *vt, std::int64_t ldvt, T *work,
+                             std::int64_t lwork) {
+    if constexpr (is_complex<T>) {
+        std::vector<real_t<T>> rwork(std::max<std::int64_t>(1, 5 * std::min(m, n)));
+        return func(LAPACK_COL_MAJOR, get_lapacke_jobsvd(jobu), get_lapacke_jobsvd(jobvt), m, n,
+                    a, lda, s, u, ldu, vt, ldvt, work, lwork, rwork.data());
+    }
+    else {
+        return func(LAPACK_COL_MAJOR, get_lapacke_jobsvd(jobu), get_lapacke_jobsvd(jobvt), m, n,
+                    a, lda, s, u, ldu, vt, ldvt, work, lwork);
+    }
+}
+
+template <typename T, typename Func>
+inline lapack_int host_heevd(Func func, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                             std::int64_t n, T *a, std::int64_t lda, real_t<T> *w, T *work,
+                             std::int64_t lwork) {
+    T work_query{};
+    real_t<T> rwork_query{};
+    lapack_int iwork_query{};
+    lapack_int info = func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_uplo(uplo), n, a,
+                           lda, w, lwork < 0 ? work : &work_query, -1, &rwork_query, -1,
+                           &iwork_query, -1);
+    if (info != 0 || lwork < 0)
+        return info;
+    std::vector<real_t<T>> rwork(static_cast<std::int64_t>(rwork_query));
+    std::vector<lapack_int> iwork(iwork_query);
+    return func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_uplo(uplo), n, a, lda, w,
+                work, lwork, rwork.data(), rwork.size(), iwork.data(), iwork.size());
+}
+
+// The workspace of the subset eigensolvers does not depend on the bounds of
+// the range, but LAPACK validates them before answering a workspace query, so
+// queries pass a valid range and a dummy eigenvalue count.
+template <typename R>
+inline void evx_query_bounds(std::int64_t n, R &vl, R &vu, std::int64_t &il, std::int64_t &iu) {
+    vl = R(0);
+    vu = R(1);
+    il = 1;
+    iu = n;
+}
+
+template <typename T, typename Func>
+inline lapack_int host_heevr(Func func, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                             oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+                             real_t<T> vl, real_t<T> vu, std::int64_t il, std::int64_t iu,
+                             real_t<T> abstol, std::int64_t *m, real_t<T> *w, T *z,
+                             std::int64_t ldz, T *work, std::int64_t lwork) {
+    lapack_int m_query{};
+    if (lwork < 0) {
+        evx_query_bounds(n, vl, vu, il, iu);
+        m = &m_query;
+    }
+    std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+    T work_query{};
+    real_t<T> rwork_query{};
+    lapack_int iwork_query{};
+    lapack_int info =
+        func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_range(range),
+             get_lapacke_uplo(uplo), n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+             isuppz.data(), lwork < 0 ? work : &work_query, -1, &rwork_query, -1, &iwork_query, -1);
+    if (info != 0 || lwork < 0)
+        return info;
+    std::vector<real_t<T>> rwork(static_cast<std::int64_t>(rwork_query));
+    std::vector<lapack_int> iwork(iwork_query);
+    return func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_range(range),
+                get_lapacke_uplo(uplo), n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                isuppz.data(), work, lwork, rwork.data(), rwork.size(), iwork.data(),
+                iwork.size());
+}
+
+template <typename T, typename Func>
+inline lapack_int host_heevx(Func func, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                             oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+                             real_t<T> vl, real_t<T> vu, std::int64_t il, std::int64_t iu,
+                             real_t<T> abstol, std::int64_t *m, real_t<T> *w, T *z,
+                             std::int64_t ldz, T *work, std::int64_t lwork) {
+    lapack_int m_query{};
+    if (lwork < 0) {
+        evx_query_bounds(n, vl, vu, il, iu);
+        m = &m_query;
+    }
+    const std::int64_t size = std::max<std::int64_t>(1, n);
+    std::vector<real_t<T>> rwork(7 * size);
+    std::vector<lapack_int> iwork(5 * size), ifail(size);
+    return func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_range(range),
+                get_lapacke_uplo(uplo), n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, work,
+                lwork, rwork.data(), iwork.data(), ifail.data());
+}
+
+template <typename T, typename Func>
+inline lapack_int host_hegvd(Func func, std::int64_t itype, oneapi::mkl::job jobz,
+                             oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T *b,
+                             std::int64_t ldb, real_t<T> *w, T *work, std::int64_t lwork) {
+    T work_query{};
+    real_t<T> rwork_query{};
+    lapack_int iwork_query{};
+    lapack_int info = func(LAPACK_COL_MAJOR, itype, get_lapacke_job(jobz), get_lapacke_uplo(uplo),
+                           n, a, lda, b, ldb, w, lwork < 0 ? work : &work_query, -1, &rwork_query,
+                           -1, &iwork_query, -1);
+    if (info != 0 || lwork < 0)
+        return info;
+    std::vector<real_t<T>> rwork(static_cast<std::int64_t>(rwork_query));
+    std::vector<lapack_int> iwork(iwork_query);
+    return func(LAPACK_COL_MAJOR, itype, get_lapacke_job(jobz), get_lapacke_uplo(uplo), n, a, lda,
+                b, ldb, w, work, lwork, rwork.data(), rwork.size(), iwork.data(), iwork.size());
+}
+
+template <typename T, typename Func>
+inline lapack_int host_hetrd(Func func, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                             std::int64_t lda, real_t<T> *d, real_t<T> *e, T *tau, T *work,
+                             std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, a, lda, d, e, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_hetrf(Func func, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                             std::int64_t lda, std::int64_t *ipiv, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, a, lda, ipiv, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_orgbr(Func func, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+                             std::int64_t k, T *a, std::int64_t lda, const T *tau, T *work,
+                             std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_generate(vec), m, n, k, a, lda, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_orgqr(Func func, std::int64_t m, std::int64_t n, std::int64_t k, T *a,
+                             std::int64_t lda, const T *tau, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, m, n, k, a, lda, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_orgtr(Func func, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                             std::int64_t lda, const T *tau, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, a, lda, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_ormtr(Func func, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             const T *a, std::int64_t lda, const T *tau, T *c, std::int64_t ldc,
+                             T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_side(side), get_lapacke_uplo(uplo),
+                get_lapacke_trans<T>(trans), m, n, a, lda, tau, c, ldc, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_ormrq(Func func, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                             std::int64_t m, std::int64_t n, std::int64_t k, const T *a,
+                             std::int64_t lda, const T *tau, T *c, std::int64_t ldc, T *work,
+                             std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_side(side), get_lapacke_trans<T>(trans), m, n, k, a,
+                lda, tau, c, ldc, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_ormqr(Func func, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                             std::int64_t m, std::int64_t n, std::int64_t k, const T *a,
+                             std::int64_t lda, const T *tau, T *c, std::int64_t ldc, T *work,
+                             std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_side(side), get_lapacke_trans<T>(trans), m, n, k, a,
+                lda, tau, c, ldc, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_posv_mixed(Func func, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, T *a, std::int64_t lda, T *b, std::int64_t ldb,
+                                  T *x, std::int64_t ldx, std::int64_t *iter, T *work) {
+    std::vector<single_t<T>> swork(std::max<std::int64_t>(1, n * (n + nrhs)));
+    lapack_int info;
+    if constexpr (is_complex<T>) {
+        std::vector<real_t<T>> rwork(std::max<std::int64_t>(1, n));
+        info = func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, nrhs, a, lda, b, ldb, x, ldx,
+                    work, swork.data(), rwork.data(), iter);
+    }
+    else {
+        info = func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, nrhs, a, lda, b, ldb, x, ldx,
+                    work, swork.data(), iter);
+    }
+    return info;
+}
+
+template <typename T, typename Func>
+inline lapack_int host_potrf(Func func, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                             std::int64_t lda) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, a, lda);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_potri(Func func, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                             std::int64_t lda) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, a, lda);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_potrs(Func func, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                             const T *a, std::int64_t lda, T *b, std::int64_t ldb) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, nrhs, a, lda, b, ldb);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_syevd(Func func, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                             std::int64_t n, T *a, std::int64_t lda, T *w, T *work,
+                             std::int64_t lwork) {
+    T work_query{};
+    lapack_int iwork_query{};
+    lapack_int info = func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_uplo(uplo), n, a,
+                           lda, w, lwork < 0 ? work : &work_query, -1, &iwork_query, -1);
+    if (info != 0 || lwork < 0)
+        return info;
+    std::vector<lapack_int> iwork(iwork_query);
+    return func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_uplo(uplo), n, a, lda, w,
+                work, lwork, iwork.data(), iwork.size());
+}
+
+template <typename T, typename Func>
+inline lapack_int host_syevr(Func func, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                             oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T vl,
+                             T vu, std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m,
+                             T *w, T *z, std::int64_t ldz, T *work, std::int64_t lwork) {
+    lapack_int m_query{};
+    if (lwork < 0) {
+        evx_query_bounds(n, vl, vu, il, iu);
+        m = &m_query;
+    }
+    std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+    T work_query{};
+    lapack_int iwork_query{};
+    lapack_int info = func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_range(range),
+                           get_lapacke_uplo(uplo), n, a, lda, vl, vu, il, iu, abstol, m, w, z,
+                           ldz, isuppz.data(), lwork < 0 ? work : &work_query, -1, &iwork_query,
+                           -1);
+    if (info != 0 || lwork < 0)
+        return info;
+    std::vector<lapack_int> iwork(iwork_query);
+    return func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_range(range),
+                get_lapacke_uplo(uplo), n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                isuppz.data(), work, lwork, iwork.data(), iwork.size());
+}
+
+template <typename T, typename Func>
+inline lapack_int host_syevx(Func func, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                             oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T vl,
+                             T vu, std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m,
+                             T *w, T *z, std::int64_t ldz, T *work, std::int64_t lwork) {
+    lapack_int m_query{};
+    if (lwork < 0) {
+        evx_query_bounds(n, vl, vu, il, iu);
+        m = &m_query;
+    }
+    const std::int64_t size = std::max<std::int64_t>(1, n);
+    std::vector<lapack_int> iwork(5 * size), ifail(size);
+    return func(LAPACK_COL_MAJOR, get_lapacke_job(jobz), get_lapacke_range(range),
+                get_lapacke_uplo(uplo), n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, work,
+                lwork, iwork.data(), ifail.data());
+}
+
+template <typename T, typename Func>
+inline lapack_int host_sygvd(Func func, std::int64_t itype, oneapi::mkl::job jobz,
+                             oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T *b,
+                             std::int64_t ldb, T *w, T *work, std::int64_t lwork) {
+    T work_query{};
+    lapack_int iwork_query{};
+    lapack_int info = func(LAPACK_COL_MAJOR, itype, get_lapacke_job(jobz), get_lapacke_uplo(uplo),
+                           n, a, lda, b, ldb, w, lwork < 0 ? work : &work_query, -1, &iwork_query,
+                           -1);
+    if (info != 0 || lwork < 0)
+        return info;
+    std::vector<lapack_int> iwork(iwork_query);
+    return func(LAPACK_COL_MAJOR, itype, get_lapacke_job(jobz), get_lapacke_uplo(uplo), n, a, lda,
+                b, ldb, w, work, lwork, iwork.data(), iwork.size());
+}
+
+template <typename T, typename Func>
+inline lapack_int host_sytrd(Func func, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                             std::int64_t lda, T *d, T *e, T *tau, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, a, lda, d, e, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_sytrf(Func func, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                             std::int64_t lda, std::int64_t *ipiv, T *work, std::int64_t lwork) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), n, a, lda, ipiv, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_trtrs(Func func, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                             oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, const T *a,
+                             std::int64_t lda, T *b, std::int64_t ldb) {
+    return func(LAPACK_COL_MAJOR, get_lapacke_uplo(uplo), get_lapacke_trans<T>(trans),
+                get_lapacke_diag(diag), n, nrhs, a, lda, b, ldb);
+}
+
+// The complex routines share the drivers of their real counterparts.
+
+template <typename T, typename Func>
+inline lapack_int host_ungbr(Func func, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+                             std::int64_t k, T *a, std::int64_t lda, const T *tau, T *work,
+                             std::int64_t lwork) {
+    return host_orgbr<T>(func, vec, m, n, k, a, lda, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_ungqr(Func func, std::int64_t m, std::int64_t n, std::int64_t k, T *a,
+                             std::int64_t lda, const T *tau, T *work, std::int64_t lwork) {
+    return host_orgqr<T>(func, m, n, k, a, lda, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_ungtr(Func func, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                             std::int64_t lda, const T *tau, T *work, std::int64_t lwork) {
+    return host_orgtr<T>(func, uplo, n, a, lda, tau, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_unmrq(Func func, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                             std::int64_t m, std::int64_t n, std::int64_t k, const T *a,
+                             std::int64_t lda, const T *tau, T *c, std::int64_t ldc, T *work,
+                             std::int64_t lwork) {
+    return host_ormrq<T>(func, side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_unmqr(Func func, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                             std::int64_t m, std::int64_t n, std::int64_t k, const T *a,
+                             std::int64_t lda, const T *tau, T *c, std::int64_t ldc, T *work,
+                             std::int64_t lwork) {
+    return host_ormqr<T>(func, side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork);
+}
+
+template <typename T, typename Func>
+inline lapack_int host_unmtr(Func func, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             const T *a, std::int64_t lda, const T *tau, T *c, std::int64_t ldc,
+                             T *work, std::int64_t lwork) {
+    return host_ormtr<T>(func, side, uplo, trans, m, n, a, lda, tau, c, ldc, work, lwork);
+}
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_HOST_HPP_
@@ -0,0 +1,426 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_JACOBI_HPP_
+#define _NETLIB_LAPACK_JACOBI_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "netlib_helper.hpp"
+#include "netlib_small_batch.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+/**
+ * Batched symmetric and Hermitian eigensolvers (syevd_batch, heevd_batch) by
+ * the cyclic Jacobi method.
+ *
+ * The stored triangle of A is expanded into the full matrix G = A / amax in the
+ * scratchpad, scaled by the largest element of A. Plane rotations J are applied
+ * from both sides, G = J^H G J, each one zeroing an off-diagonal element g_pq
+ * and its mirror, until every g_pq is negligible relative to
+ * sqrt(|g_pp| |g_qq|). The diagonal of G, scaled back by amax, holds the
+ * eigenvalues and the product V of the rotations the eigenvectors.
+ *
+ * The column pairs of a sweep are visited in round-robin order, so that the
+ * n / 2 rotations of a round touch disjoint rows and columns and can run in
+ * parallel. The host solver runs them in turn and spreads the batch over the
+ * host threads. For real matrices of a strided batch with
+ * n <= small_batch_max_size, a SYCL kernel instead solves one matrix per
+ * sub-group: each lane computes the rotation of one pair of the round, then the
+ * lanes rotate their columns of G and V, and then their rows of G.
+ *
+ * V is accumulated in A, so A is overwritten for jobz = job::novec too, and G
+ * is kept in the scratchpad. The iteration stops after a sweep without
+ * rotation. Matrices that have not converged after jacobi_max_sweeps sweeps
+ * report info = n + 1.
+ */
+constexpr int jacobi_max_sweeps = 50;
+
+inline std::int64_t jacobi_lwork(std::int64_t n) {
+    return std::max<std::int64_t>(1, n * n);
+}
+
+// Pair k of round r of the round-robin order of m columns, m even. Every pair
+// of columns meets once in the m - 1 rounds of a sweep.
+inline void jacobi_pair(std::int64_t m, std::int64_t r, std::int64_t k, std::int64_t &p,
+                        std::int64_t &q) {
+    if (k == 0) {
+        p = r;
+        q = m - 1;
+    }
+    else {
+        p = (r + k) % (m - 1);
+        q = (r + m - 1 - k) % (m - 1);
+    }
+}
+
+template <typename T>
+inline real_t<T> jacobi_abs(T x) {
+    if constexpr (is_complex<T>)
+        return sycl::sqrt(x.real() * x.real() + x.imag() * x.imag());
+    else
+        return sycl::fabs(x);
+}
+
+// Largest absolute value of the parts of x, which cannot overflow.
+template <typename T>
+inline real_t<T> jacobi_absmax(T x) {
+    if constexpr (is_complex<T>)
+        return std::max(sycl::fabs(x.real()), sycl::fabs(x.imag()));
+    else
+        return sycl::fabs(x);
+}
+
+template <typename T>
+inline T jacobi_conj(T x) {
+    if constexpr (is_complex<T>)
+        return std::conj(x);
+    else
+        return x;
+}
+
+template <typename T>
+inline real_t<T> jacobi_real(T x) {
+    if constexpr (is_complex<T>)
+        return x.real();
+    else
+        return x;
+}
+
+/**
+ * Loads column j of the Hermitian matrix with the uplo triangle stored in a
+ * into column j of g, and returns the largest absolute value of the real and
+ * imaginary parts of its elements.
+ */
+template <typename T, typename A, typename G>
+inline real_t<T> jacobi_load_column(std::int64_t n, bool upper, A a, G g, std::int64_t j) {
+    real_t<T> amax = 0;
+    for (std::int64_t i = 0; i < n; ++i) {
+        T x;
+        if (i == j)
+            x = jacobi_real(a(j, j));
+        else if (upper == (i < j))
+            x = a(i, j);
+        else
+            x = jacobi_conj(a(j, i));
+        g(i, j) = x;
+        amax = std::max(amax, jacobi_absmax(x));
+    }
+    return amax;
+}
+
+// Divides column j of g by amax and sets column j of v to the identity.
+template <typename T, typename G, typename V>
+inline void jacobi_scale_column(std::int64_t n, G g, V v, std::int64_t j, real_t<T> amax) {
+    for (std::int64_t i = 0; i < n; ++i) {
+        g(i, j) /= amax;
+        v(i, j) = T(i == j ? 1 : 0);
+    }
+}
+
+/**
+ * Rotation J of columns p and q: column p of G J is c g_p - s phase g_q and
+ * column q is s g_p + c phase g_q. app and aqq are the diagonal elements of
+ * J^H G J in p and q.
+ */
+template <typename T>
+struct jacobi_rotation {
+    real_t<T> c, s, app, aqq;
+    T phase;
+};
+
+/**
+ * Computes the rotation that zeroes g_pq. Returns false if g_pq is already
+ * negligible.
+ */
+template <typename T, typename G>
+inline bool jacobi_rotation_of(G g, std::int64_t p, std::int64_t q, jacobi_rotation<T> &rot) {
+    using R = real_t<T>;
+    const R app = jacobi_real(g(p, p)), aqq = jacobi_real(g(q, q));
+    const T gamma = g(p, q);
+    const R abs_gamma = jacobi_abs(gamma);
+    const R tol = std::numeric_limits<R>::epsilon();
+    if (!(abs_gamma > tol * sycl::sqrt(sycl::fabs(app)) * sycl::sqrt(sycl::fabs(aqq))) ||
+        !(abs_gamma > std::numeric_limits<R>::min()))
+        return false;
+
+    // tan of the smaller of the two angles that zero the off-diagonal element
+    // of [app |gamma|; |gamma| aqq], written to avoid overflow of zeta^2.
+    const R zeta = (aqq - app) / (2 * abs_gamma);
+    const R abs_zeta = sycl::fabs(zeta);
+    const R root = abs_zeta > 1 ? abs_zeta * sycl::sqrt(1 + (1 / abs_zeta) * (1 / abs_zeta))
+                                : sycl::sqrt(1 + abs_zeta * abs_zeta);
+    const R t = (zeta < 0 ? R(-1) : R(1)) / (abs_zeta + root);
+    rot.c = 1 / sycl::sqrt(1 + t * t);
+    rot.s = rot.c * t;
+    rot.app = app - t * abs_gamma;
+    rot.aqq = aqq + t * abs_gamma;
+    rot.phase = jacobi_conj(gamma) / abs_gamma;
+    return true;
+}
+
+// Multiplies columns p and q of x by J from the right.
+template <typename T, typename X>
+inline void jacobi_rotate_columns(std::int64_t n, X x, std::int64_t p, std::int64_t q,
+                                  const jacobi_rotation<T> &rot) {
+    for (std::int64_t i = 0; i < n; ++i) {
+        const T xp = x(i, p), xq = rot.phase * x(i, q);
+        x(i, p) = rot.c * xp - rot.s * xq;
+        x(i, q) = rot.s * xp + rot.c * xq;
+    }
+}
+
+// Multiplies rows p and q of g by J^H from the left, and sets the 2 x 2 block
+// of p and q to its exact value.
+template <typename T, typename G>
+inline void jacobi_rotate_rows(std::int64_t n, G g, std::int64_t p, std::int64_t q,
+                               const jacobi_rotation<T> &rot) {
+    const T conj_phase = jacobi_conj(rot.phase);
+    for (std::int64_t j = 0; j < n; ++j) {
+        const T gp = g(p, j), gq = conj_phase * g(q, j);
+        g(p, j) = rot.c * gp - rot.s * gq;
+        g(q, j) = rot.s * gp + rot.c * gq;
+    }
+    g(p, p) = rot.app;
+    g(q, q) = rot.aqq;
+    g(p, q) = 0;
+    g(q, p) = 0;
+}
+
+// Sorts the eigenvalues in ascending order, with the columns of v.
+template <typename T, typename W, typename V>
+inline void jacobi_sort(std::int64_t n, W w, V v) {
+    for (std::int64_t j = 0; j < n; ++j) {
+        std::int64_t k = j;
+        for (std::int64_t i = j + 1; i < n; ++i) {
+            if (w(i) < w(k))
+                k = i;
+        }
+        if (k == j)
+            continue;
+        const auto t = w(j);
+        w(j) = w(k);
+        w(k) = t;
+        for (std::int64_t i = 0; i < n; ++i) {
+            const T x = v(i, j);
+            v(i, j) = v(i, k);
+            v(i, k) = x;
+        }
+    }
+}
+
+/**
+ * Eigenvalues and eigenvectors of one matrix, as in syevd with jobz = job::vec.
+ * work holds jacobi_lwork(n) elements. Returns the info value of syevd: the
+ * position of an invalid argument, or n + 1 if the iteration did not converge.
+ */
+template <typename T>
+inline lapack_int host_jacobi_evd(oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+                                  real_t<T> *w, T *work) {
+    using R = real_t<T>;
+    if (n < 0)
+        return -3;
+    if (lda < std::max<std::int64_t>(1, n))
+        return -5;
+    const bool upper = uplo == oneapi::mkl::uplo::upper;
+    auto v = [&](std::int64_t i, std::int64_t j) -> T & { return a[i + j * lda]; };
+    auto g = [&](std::int64_t i, std::int64_t j) -> T & { return work[i + j * n]; };
+
+    R amax = 0;
+    for (std::int64_t j = 0; j < n; ++j)
+        amax = std::max(amax, jacobi_load_column<T>(n, upper, v, g, j));
+    if (!(amax > 0))
+        amax = 1;
+    for (std::int64_t j = 0; j < n; ++j)
+        jacobi_scale_column<T>(n, g, v, j, amax);
+
+    const std::int64_t m = n + n % 2;
+    bool converged = false;
+    for (int sweep = 0; sweep < jacobi_max_sweeps && !converged; ++sweep) {
+        converged = true;
+        for (std::int64_t r = 0; r < m - 1; ++r) {
+            for (std::int64_t k = 0; k < m / 2; ++k) {
+                std::int64_t p, q;
+                jacobi_pair(m, r, k, p, q);
+                jacobi_rotation<T> rot;
+                if (q < n && jacobi_rotation_of(g, p, q, rot)) {
+                    jacobi_rotate_columns(n, g, p, q, rot);
+                    jacobi_rotate_columns(n, v, p, q, rot);
+                    jacobi_rotate_rows(n, g, p, q, rot);
+                    converged = false;
+                }
+            }
+        }
+    }
+
+    for (std::int64_t j = 0; j < n; ++j)
+        w[j] = amax * jacobi_real(g(j, j));
+    jacobi_sort<T>(n, [&](std::int64_t j) -> R & { return w[j]; }, v);
+    return converged ? 0 : n + 1;
+}
+
+// Pairs of a round of the largest matrices of the small-matrix kernel.
+constexpr std::int64_t small_jacobi_pairs = small_batch_max_size / 2;
+
+/**
+ * Cyclic Jacobi for one real matrix per sub-group. Lanes own columns
+ * lane, lane + lanes, ... while G is formed, and pairs k = lane,
+ * lane + lanes, ... of every round of the sweeps. G and V are kept in the
+ * scratchpad and in a, so the lanes exchange them through memory, with a
+ * sub-group barrier between the phases of every round.
+ */
+template <typename T, typename Layout, typename AccA, typename AccW, typename AccWork>
+struct small_jacobi_evd_kernel {
+    AccA a;
+    AccW w;
+    AccWork work;
+    std::int64_t *info;
+    Layout layout_a;
+    strided_batch_layout layout_work;
+    bool upper;
+    std::int64_t n, stride_w, batch_size;
+
+    void operator()(sycl::nd_item<1> item) const {
+        auto sg = item.get_sub_group();
+        const std::int64_t id =
+            item.get_group(0) * sg.get_group_linear_range() + sg.get_group_linear_id();
+        if (id >= batch_size)
+            return;
+        const std::int64_t lane = sg.get_local_linear_id();
+        const std::int64_t lanes = sg.get_local_linear_range();
+        auto v = [&](std::int64_t i, std::int64_t j) -> T & { return a[layout_a(id, i, j)]; };
+        auto g = [&](std::int64_t i, std::int64_t j) -> T & {
+            return work[layout_work(id, i, j)];
+        };
+
+        T amax = 0;
+        for (std::int64_t j = lane; j < n; j += lanes)
+            amax = sycl::fmax(amax, jacobi_load_column<T>(n, upper, v, g, j));
+        amax = sycl::reduce_over_group(sg, amax, sycl::maximum<T>());
+        if (!(amax > 0))
+            amax = 1;
+        sycl::group_barrier(sg);
+        for (std::int64_t j = lane; j < n; j += lanes)
+            jacobi_scale_column<T>(n, g, v, j, amax);
+        sycl::group_barrier(sg);
+
+        // Each lane keeps the rotations of its pairs of the current round.
+        const std::int64_t m = n + n % 2;
+        bool converged = false;
+        for (int sweep = 0; sweep < jacobi_max_sweeps && !converged; ++sweep) {
+            bool rotated = false;
+            for (std::int64_t r = 0; r < m - 1; ++r) {
+                jacobi_rotation<T> rot[small_jacobi_pairs];
+                bool active[small_jacobi_pairs];
+                for (std::int64_t k = lane, l = 0; k < m / 2; k += lanes, ++l) {
+                    std::int64_t p, q;
+                    jacobi_pair(m, r, k, p, q);
+                    active[l] = q < n && jacobi_rotation_of(g, p, q, rot[l]);
+                    rotated = rotated || active[l];
+                }
+                sycl::group_barrier(sg);
+                for (std::int64_t k = lane, l = 0; k < m / 2; k += lanes, ++l) {
+                    std::int64_t p, q;
+                    jacobi_pair(m, r, k, p, q);
+                    if (active[l]) {
+                        jacobi_rotate_columns(n, g, p, q, rot[l]);
+                        jacobi_rotate_columns(n, v, p, q, rot[l]);
+                    }
+                }
+                sycl::group_barrier(sg);
+                for (std::int64_t k = lane, l = 0; k < m / 2; k += lanes, ++l) {
+                    std::int64_t p, q;
+                    jacobi_pair(m, r, k, p, q);
+                    if (active[l])
+                        jacobi_rotate_rows(n, g, p, q, rot[l]);
+                }
+                sycl::group_barrier(sg);
+            }
+            converged = !sycl::any_of_group(sg, rotated);
+        }
+
+        if (lane == 0) {
+            const std::int64_t w_off = id * stride_w;
+            for (std::int64_t j = 0; j < n; ++j)
+                w[w_off + j] = amax * g(j, j);
+            jacobi_sort<T>(n, [&](std::int64_t j) -> T & { return w[w_off + j]; }, v);
+            info[id] = converged ? 0 : n + 1;
+        }
+    }
+};
+
+// Lanes per matrix: one lane per pair of a round of the largest matrices.
+constexpr std::int64_t small_jacobi_lanes = small_jacobi_pairs;
+
+// Invalid arguments and short scratchpads are left to the host solver, which
+// reports them. G and V live in memory rather than in private arrays, so
+// double matrices go up to small_batch_max_size too.
+template <typename T>
+inline bool use_small_jacobi(std::int64_t n, std::int64_t lda, std::int64_t batch_size,
+                             std::int64_t scratchpad_size) {
+    return batch_size > 0 && n >= 0 && n <= small_batch_max_size &&
+           lda >= std::max<std::int64_t>(1, n) &&
+           scratchpad_size / batch_size >= jacobi_lwork(n);
+}
+
+template <typename T, typename A, typename W, typename Scratch>
+inline sycl::event small_jacobi_evd_batch(sycl::queue &queue, const char *func_name,
+                                          oneapi::mkl::uplo uplo, std::int64_t n, A &&a,
+                                          std::int64_t lda, std::int64_t stride_a, W &&w,
+                                          std::int64_t stride_w, std::int64_t batch_size,
+                                          Scratch &&scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event> &dependencies = {}) {
+    small_batch_info info(queue, batch_size);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto w_acc = small_batch_ptr(w, cgh);
+        auto work_acc = small_batch_ptr(scratchpad, cgh);
+        using kernel_t = small_jacobi_evd_kernel<T, strided_batch_layout, decltype(a_acc),
+                                                 decltype(w_acc), decltype(work_acc)>;
+        const std::int64_t lanes = small_jacobi_lanes;
+        cgh.parallel_for(sycl::nd_range<1>(sycl::range<1>(batch_size * lanes),
+                                           sycl::range<1>(lanes)),
+                         kernel_t{ a_acc, w_acc, work_acc, info.get(),
+                                   strided_batch_layout{ lda, stride_a },
+                                   strided_batch_layout{ n, scratchpad_size / batch_size },
+                                   uplo == oneapi::mkl::uplo::upper, n, stride_w, batch_size });
+    });
+    return small_batch_check(queue, done, func_name, "syevj", info, batch_size);
+}
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_JACOBI_HPP_
@@ -0,0 +1,3170 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "netlib_helper.hpp"
+#include "netlib_host.hpp"
+#include "netlib_randomized.hpp"
+#include "netlib_tsqr.hpp"
+#include "oneapi/mkl/lapack/detail/netlib/onemkl_lapack_netlib.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+// Every routine runs the corresponding LAPACKE_?xxx_work function inside a
+// host_task. LAPACKE failures are reported asynchronously through the queue.
+
+// BUFFER APIs
+
+template <typename Func, typename T>
+inline void gebrd(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<real_t<T>> &d,
+                  sycl::buffer<real_t<T>> &e, sycl::buffer<T> &tauq, sycl::buffer<T> &taup,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto d_acc = d.template get_access<sycl::access::mode::write>(cgh);
+        auto e_acc = e.template get_access<sycl::access::mode::write>(cgh);
+        auto tauq_acc = tauq.template get_access<sycl::access::mode::write>(cgh);
+        auto taup_acc = taup.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_gebrd<T>(func, m, n, a_acc.GET_MULTI_PTR, lda, d_acc.GET_MULTI_PTR,
+                              e_acc.GET_MULTI_PTR, tauq_acc.GET_MULTI_PTR, taup_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("gebrd", func_name, info);
+        });
+    });
+}
+
+#define GEBRD_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                     \
+    void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE_A> &a, \
+               std::int64_t lda, sycl::buffer<TYPE_B> &d, sycl::buffer<TYPE_B> &e,          \
+               sycl::buffer<TYPE_A> &tauq, sycl::buffer<TYPE_A> &taup,                      \
+               sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) {            \
+        gebrd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, d, e, tauq, taup,     \
+              scratchpad, scratchpad_size);                                                 \
+    }
+
+GEBRD_LAUNCHER(float, float, LAPACKE_sgebrd_work)
+GEBRD_LAUNCHER(double, double, LAPACKE_dgebrd_work)
+GEBRD_LAUNCHER(std::complex<float>, float, LAPACKE_cgebrd_work)
+GEBRD_LAUNCHER(std::complex<double>, double, LAPACKE_zgebrd_work)
+
+#undef GEBRD_LAUNCHER
+
+template <typename Func, typename T>
+inline void gerqf(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_gerqf<T>(func, m, n, a_acc.GET_MULTI_PTR, lda, tau_acc.GET_MULTI_PTR,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("gerqf", func_name, info);
+        });
+    });
+}
+
+#define GERQF_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                             \
+    void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE> &a, \
+               std::int64_t lda, sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &scratchpad, \
+               std::int64_t scratchpad_size) {                                            \
+        gerqf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, tau, scratchpad,    \
+              scratchpad_size);                                                           \
+    }
+
+GERQF_LAUNCHER(float, LAPACKE_sgerqf_work)
+GERQF_LAUNCHER(double, LAPACKE_dgerqf_work)
+GERQF_LAUNCHER(std::complex<float>, LAPACKE_cgerqf_work)
+GERQF_LAUNCHER(std::complex<double>, LAPACKE_zgerqf_work)
+
+#undef GERQF_LAUNCHER
+
+template <typename Func, typename T>
+inline void geqrf(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_geqrf<T>(func, m, n, a_acc.GET_MULTI_PTR, lda, tau_acc.GET_MULTI_PTR,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("geqrf", func_name, info);
+        });
+    });
+}
+
+#define GEQRF_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                             \
+    void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE> &a, \
+               std::int64_t lda, sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &scratchpad, \
+               std::int64_t scratchpad_size) {                                            \
+        geqrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, tau, scratchpad,    \
+              scratchpad_size);                                                           \
+    }
+
+GEQRF_LAUNCHER(float, LAPACKE_sgeqrf_work)
+GEQRF_LAUNCHER(double, LAPACKE_dgeqrf_work)
+GEQRF_LAUNCHER(std::complex<float>, LAPACKE_cgeqrf_work)
+GEQRF_LAUNCHER(std::complex<double>, LAPACKE_zgeqrf_work)
+
+#undef GEQRF_LAUNCHER
+
+template <typename Geqrf, typename Ormqr, typename T>
+inline void geqrf_tsqr(const char *geqrf_name, Geqrf geqrf, const char *ormqr_name, Ormqr ormqr,
+                       sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<T> &a,
+                       std::int64_t lda, sycl::buffer<T> &tau, sycl::buffer<T> &scratchpad,
+                       std::int64_t scratchpad_size) {
+    if (scratchpad_size < host_geqrf_tsqr_scratchpad_size<T>(geqrf_name, geqrf, ormqr_name, ormqr,
+                                                             m, n, lda))
+        throw oneapi::mkl::lapack::invalid_argument("geqrf_tsqr", "scratchpad_size is too small");
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_geqrf_tsqr<T>(geqrf_name, geqrf, ormqr_name, ormqr, m, n, a_acc.GET_MULTI_PTR,
+                               lda, tau_acc.GET_MULTI_PTR, scratch_acc.GET_MULTI_PTR,
+                               scratchpad_size);
+        });
+    });
+}
+
+#define GEQRF_TSQR_LAUNCHER(TYPE, GEQRF_ROUTINE, ORMQR_ROUTINE)                                \
+    void geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE> &a, \
+                    std::int64_t lda, sycl::buffer<TYPE> &tau,                                 \
+                    sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {            \
+        geqrf_tsqr(#GEQRF_ROUTINE, GEQRF_ROUTINE, #ORMQR_ROUTINE, ORMQR_ROUTINE, queue, m, n,  \
+                   a, lda, tau, scratchpad, scratchpad_size);                                  \
+    }
+
+GEQRF_TSQR_LAUNCHER(float, LAPACKE_sgeqrf_work, LAPACKE_sormqr_work)
+GEQRF_TSQR_LAUNCHER(double, LAPACKE_dgeqrf_work, LAPACKE_dormqr_work)
+GEQRF_TSQR_LAUNCHER(std::complex<float>, LAPACKE_cgeqrf_work, LAPACKE_cunmqr_work)
+GEQRF_TSQR_LAUNCHER(std::complex<double>, LAPACKE_zgeqrf_work, LAPACKE_zunmqr_work)
+
+#undef GEQRF_TSQR_LAUNCHER
+
+template <typename Func, typename T>
+inline void getrf(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda,
+                  sycl::buffer<std::int64_t> &ipiv, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_getrf<T>(func, m, n, a_acc.GET_MULTI_PTR, lda, ipiv_acc.GET_MULTI_PTR);
+            lapacke_info_check("getrf", func_name, info);
+        });
+    });
+}
+
+#define GETRF_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                      \
+    void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<TYPE> &a,          \
+               std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<TYPE> &scratchpad, \
+               std::int64_t scratchpad_size) {                                                     \
+        getrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, ipiv, scratchpad,            \
+              scratchpad_size);                                                                    \
+    }
+
+GETRF_LAUNCHER(float, LAPACKE_sgetrf_work)
+GETRF_LAUNCHER(double, LAPACKE_dgetrf_work)
+GETRF_LAUNCHER(std::complex<float>, LAPACKE_cgetrf_work)
+GETRF_LAUNCHER(std::complex<double>, LAPACKE_zgetrf_work)
+
+#undef GETRF_LAUNCHER
+
+template <typename Func, typename T>
+inline void getri(const char *func_name, Func func, sycl::queue &queue, std::int64_t n,
+                  sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_getri<T>(func, n, a_acc.GET_MULTI_PTR, lda, ipiv_acc.GET_MULTI_PTR,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("getri", func_name, info);
+        });
+    });
+}
+
+#define GETRI_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                               \
+    void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<TYPE> &a, std::int64_t lda, \
+               sycl::buffer<std::int64_t> &ipiv, sycl::buffer<TYPE> &scratchpad,            \
+               std::int64_t scratchpad_size) {                                              \
+        getri(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, a, lda, ipiv, scratchpad,        \
+              scratchpad_size);                                                             \
+    }
+
+GETRI_LAUNCHER(float, LAPACKE_sgetri_work)
+GETRI_LAUNCHER(double, LAPACKE_dgetri_work)
+GETRI_LAUNCHER(std::complex<float>, LAPACKE_cgetri_work)
+GETRI_LAUNCHER(std::complex<double>, LAPACKE_zgetri_work)
+
+#undef GETRI_LAUNCHER
+
+template <typename Func, typename T>
+inline void getrs(const char *func_name, Func func, sycl::queue &queue,
+                  oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+                  sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                  sycl::buffer<T> &b, std::int64_t ldb, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_getrs<T>(func, trans, n, nrhs, a_acc.GET_MULTI_PTR, lda,
+                                      ipiv_acc.GET_MULTI_PTR, b_acc.GET_MULTI_PTR, ldb);
+            lapacke_info_check("getrs", func_name, info);
+        });
+    });
+}
+
+#define GETRS_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                 \
+    void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,              \
+               std::int64_t nrhs, sycl::buffer<TYPE> &a, std::int64_t lda,                    \
+               sycl::buffer<std::int64_t> &ipiv, sycl::buffer<TYPE> &b, std::int64_t ldb,     \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                \
+        getrs(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, n, nrhs, a, lda, ipiv, b, ldb, \
+              scratchpad, scratchpad_size);                                                   \
+    }
+
+GETRS_LAUNCHER(float, LAPACKE_sgetrs_work)
+GETRS_LAUNCHER(double, LAPACKE_dgetrs_work)
+GETRS_LAUNCHER(std::complex<float>, LAPACKE_cgetrs_work)
+GETRS_LAUNCHER(std::complex<double>, LAPACKE_zgetrs_work)
+
+#undef GETRS_LAUNCHER
+
+template <typename Func, typename T>
+inline void gesv_mixed(const char *func_name, Func func, sycl::queue &queue, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<T> &a, std::int64_t lda,
+                       sycl::buffer<std::int64_t> &ipiv, sycl::buffer<T> &b, std::int64_t ldb,
+                       sycl::buffer<T> &x, std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+                       sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    if (scratchpad_size < mixed_lwork(n, nrhs))
+        throw oneapi::mkl::lapack::invalid_argument("gesv_mixed", "scratchpad_size is too small");
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::write>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        auto x_acc = x.template get_access<sycl::access::mode::write>(cgh);
+        auto iter_acc = iter.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_gesv_mixed<T>(func, n, nrhs, a_acc.GET_MULTI_PTR, lda, ipiv_acc.GET_MULTI_PTR,
+                                   b_acc.GET_MULTI_PTR, ldb, x_acc.GET_MULTI_PTR, ldx,
+                                   iter_acc.GET_MULTI_PTR, scratch_acc.GET_MULTI_PTR);
+            lapacke_info_check("gesv_mixed", func_name, info);
+        });
+    });
+}
+
+#define GESV_MIXED_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                \
+    void gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<TYPE> &a, \
+                    std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<TYPE> &b,    \
+                    std::int64_t ldb, sycl::buffer<TYPE> &x, std::int64_t ldx,                    \
+                    sycl::buffer<std::int64_t> &iter, sycl::buffer<TYPE> &scratchpad,             \
+                    std::int64_t scratchpad_size) {                                               \
+        gesv_mixed(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, nrhs, a, lda, ipiv, b, ldb, x,    \
+                   ldx, iter, scratchpad, scratchpad_size);                                       \
+    }
+
+GESV_MIXED_LAUNCHER(double, LAPACKE_dsgesv_work)
+GESV_MIXED_LAUNCHER(std::complex<double>, LAPACKE_zcgesv_work)
+
+#undef GESV_MIXED_LAUNCHER
+
+template <typename Func, typename T>
+inline void gesvd(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                  oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, sycl::buffer<T> &a,
+                  std::int64_t lda, sycl::buffer<real_t<T>> &s, sycl::buffer<T> &u,
+                  std::int64_t ldu, sycl::buffer<T> &vt, std::int64_t ldvt,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto s_acc = s.template get_access<sycl::access::mode::write>(cgh);
+        auto u_acc = u.template get_access<sycl::access::mode::write>(cgh);
+        auto vt_acc = vt.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_gesvd<T>(func, jobu, jobvt, m, n, a_acc.GET_MULTI_PTR, lda,
+                              s_acc.GET_MULTI_PTR, u_acc.GET_MULTI_PTR, ldu, vt_acc.GET_MULTI_PTR,
+                              ldvt, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("gesvd", func_name, info);
+        });
+    });
+}
+
+#define GESVD_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                           \
+    void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,           \
+               std::int64_t m, std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda,         \
+               sycl::buffer<TYPE_B> &s, sycl::buffer<TYPE_A> &u, std::int64_t ldu,                \
+               sycl::buffer<TYPE_A> &vt, std::int64_t ldvt, sycl::buffer<TYPE_A> &scratchpad,     \
+               std::int64_t scratchpad_size) {                                                    \
+        gesvd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, \
+              ldvt, scratchpad, scratchpad_size);                                                 \
+    }
+
+GESVD_LAUNCHER(float, float, LAPACKE_sgesvd_work)
+GESVD_LAUNCHER(double, double, LAPACKE_dgesvd_work)
+GESVD_LAUNCHER(std::complex<float>, float, LAPACKE_cgesvd_work)
+GESVD_LAUNCHER(std::complex<double>, double, LAPACKE_zgesvd_work)
+
+#undef GESVD_LAUNCHER
+
+template <typename Geqrf, typename Orgqr, typename Gesvd, typename T>
+inline void gesvd_randomized(const char *geqrf_name, Geqrf geqrf, const char *orgqr_name,
+                             Orgqr orgqr, const char *gesvd_name, Gesvd gesvd, sycl::queue &queue,
+                             oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+                             std::int64_t n, std::int64_t k, std::int64_t oversample,
+                             std::int64_t power_iters, std::uint64_t seed, sycl::buffer<T> &a,
+                             std::int64_t lda, sycl::buffer<real_t<T>> &s, sycl::buffer<T> &u,
+                             std::int64_t ldu, sycl::buffer<T> &vt, std::int64_t ldvt,
+                             sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    if (scratchpad_size < host_gesvd_randomized_scratchpad_size<T>(
+                              geqrf_name, geqrf, orgqr_name, orgqr, gesvd_name, gesvd, jobu,
+                              jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt))
+        throw oneapi::mkl::lapack::invalid_argument("gesvd_randomized",
+                                                    "scratchpad_size is too small");
+    if (k == 0)
+        return;
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto s_acc = s.template get_access<sycl::access::mode::write>(cgh);
+        auto u_acc = u.template get_access<sycl::access::mode::write>(cgh);
+        auto vt_acc = vt.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            host_gesvd_randomized<T>(geqrf_name, geqrf, orgqr_name, orgqr, gesvd_name, gesvd, jobu,
+                                     jobvt, m, n, k, oversample, power_iters, seed,
+                                     a_acc.GET_MULTI_PTR, lda, s_acc.GET_MULTI_PTR,
+                                     u_acc.GET_MULTI_PTR, ldu, vt_acc.GET_MULTI_PTR, ldvt,
+                                     scratch_acc.GET_MULTI_PTR);
+        });
+    });
+}
+
+#define GESVD_RANDOMIZED_LAUNCHER(TYPE_A, TYPE_B, GEQRF_ROUTINE, ORGQR_ROUTINE, GESVD_ROUTINE)     \
+    void gesvd_randomized(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, \
+                          std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversample, \
+                          std::int64_t power_iters, std::uint64_t seed, sycl::buffer<TYPE_A> &a,   \
+                          std::int64_t lda, sycl::buffer<TYPE_B> &s, sycl::buffer<TYPE_A> &u,      \
+                          std::int64_t ldu, sycl::buffer<TYPE_A> &vt, std::int64_t ldvt,           \
+                          sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) {        \
+        gesvd_randomized(#GEQRF_ROUTINE, GEQRF_ROUTINE, #ORGQR_ROUTINE, ORGQR_ROUTINE,             \
+                         #GESVD_ROUTINE, GESVD_ROUTINE, queue, jobu, jobvt, m, n, k, oversample,   \
+                         power_iters, seed, a, lda, s, u, ldu, vt, ldvt, scratchpad,               \
+                         scratchpad_size);                                                         \
+    }
+
+GESVD_RANDOMIZED_LAUNCHER(float, float, LAPACKE_sgeqrf_work, LAPACKE_sorgqr_work,
+                          LAPACKE_sgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER(double, double, LAPACKE_dgeqrf_work, LAPACKE_dorgqr_work,
+                          LAPACKE_dgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER(std::complex<float>, float, LAPACKE_cgeqrf_work, LAPACKE_cungqr_work,
+                          LAPACKE_cgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER(std::complex<double>, double, LAPACKE_zgeqrf_work, LAPACKE_zungqr_work,
+                          LAPACKE_zgesvd_work)
+
+#undef GESVD_RANDOMIZED_LAUNCHER
+
+template <typename Func, typename T>
+inline void heevd(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a, std::int64_t lda,
+                  sycl::buffer<real_t<T>> &w, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_heevd<T>(func, jobz, uplo, n, a_acc.GET_MULTI_PTR, lda, w_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("heevd", func_name, info);
+        });
+    });
+}
+
+#define HEEVD_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                           \
+    void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, \
+               sycl::buffer<TYPE_A> &a, std::int64_t lda, sycl::buffer<TYPE_B> &w,                \
+               sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) {                  \
+        heevd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, uplo, n, a, lda, w, scratchpad,     \
+              scratchpad_size);                                                                   \
+    }
+
+HEEVD_LAUNCHER(std::complex<float>, float, LAPACKE_cheevd_work)
+HEEVD_LAUNCHER(std::complex<double>, double, LAPACKE_zheevd_work)
+
+#undef HEEVD_LAUNCHER
+
+template <typename Func, typename T>
+inline void heevr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  sycl::buffer<T> &a, std::int64_t lda, real_t<T> vl, real_t<T> vu, std::int64_t il,
+                  std::int64_t iu, real_t<T> abstol, sycl::buffer<std::int64_t> &m,
+                  sycl::buffer<real_t<T>> &w, sycl::buffer<T> &z, std::int64_t ldz,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_heevr<T>(func, jobz, range, uplo, n, a_acc.GET_MULTI_PTR, lda, vl, vu, il, iu,
+                              abstol, m_acc.GET_MULTI_PTR, w_acc.GET_MULTI_PTR, z_acc.GET_MULTI_PTR,
+                              ldz, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("heevr", func_name, info);
+        });
+    });
+}
+
+#define HEEVR_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                            \
+    void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,               \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda,  \
+               TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu, TYPE_B abstol,              \
+               sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE_B> &w, sycl::buffer<TYPE_A> &z,    \
+               std::int64_t ldz, sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) { \
+        heevr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl, vu, il,  \
+              iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);                              \
+    }
+
+HEEVR_LAUNCHER(std::complex<float>, float, LAPACKE_cheevr_work)
+HEEVR_LAUNCHER(std::complex<double>, double, LAPACKE_zheevr_work)
+
+#undef HEEVR_LAUNCHER
+
+template <typename Func, typename T>
+inline void heevx(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  sycl::buffer<T> &a, std::int64_t lda, real_t<T> vl, real_t<T> vu, std::int64_t il,
+                  std::int64_t iu, real_t<T> abstol, sycl::buffer<std::int64_t> &m,
+                  sycl::buffer<real_t<T>> &w, sycl::buffer<T> &z, std::int64_t ldz,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_heevx<T>(func, jobz, range, uplo, n, a_acc.GET_MULTI_PTR, lda, vl, vu, il, iu,
+                              abstol, m_acc.GET_MULTI_PTR, w_acc.GET_MULTI_PTR, z_acc.GET_MULTI_PTR,
+                              ldz, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("heevx", func_name, info);
+        });
+    });
+}
+
+#define HEEVX_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                            \
+    void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,               \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda,  \
+               TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu, TYPE_B abstol,              \
+               sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE_B> &w, sycl::buffer<TYPE_A> &z,    \
+               std::int64_t ldz, sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) { \
+        heevx(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl, vu, il,  \
+              iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);                              \
+    }
+
+HEEVX_LAUNCHER(std::complex<float>, float, LAPACKE_cheevx_work)
+HEEVX_LAUNCHER(std::complex<double>, double, LAPACKE_zheevx_work)
+
+#undef HEEVX_LAUNCHER
+
+template <typename Func, typename T>
+inline void hegvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
+                  oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a,
+                  std::int64_t lda, sycl::buffer<T> &b, std::int64_t ldb,
+                  sycl::buffer<real_t<T>> &w, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_hegvd<T>(func, itype, jobz, uplo, n, a_acc.GET_MULTI_PTR, lda,
+                                      b_acc.GET_MULTI_PTR, ldb, w_acc.GET_MULTI_PTR,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("hegvd", func_name, info);
+        });
+    });
+}
+
+#define HEGVD_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                           \
+    void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,                     \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE_A> &a, std::int64_t lda, \
+               sycl::buffer<TYPE_A> &b, std::int64_t ldb, sycl::buffer<TYPE_B> &w,                \
+               sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) {                  \
+        hegvd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, itype, jobz, uplo, n, a, lda, b, ldb, w,  \
+              scratchpad, scratchpad_size);                                                       \
+    }
+
+HEGVD_LAUNCHER(std::complex<float>, float, LAPACKE_chegvd_work)
+HEGVD_LAUNCHER(std::complex<double>, double, LAPACKE_zhegvd_work)
+
+#undef HEGVD_LAUNCHER
+
+template <typename Func, typename T>
+inline void hetrd(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<real_t<T>> &d,
+                  sycl::buffer<real_t<T>> &e, sycl::buffer<T> &tau, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto d_acc = d.template get_access<sycl::access::mode::write>(cgh);
+        auto e_acc = e.template get_access<sycl::access::mode::write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_hetrd<T>(func, uplo, n, a_acc.GET_MULTI_PTR, lda, d_acc.GET_MULTI_PTR,
+                                      e_acc.GET_MULTI_PTR, tau_acc.GET_MULTI_PTR,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("hetrd", func_name, info);
+        });
+    });
+}
+
+#define HETRD_LAUNCHER(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                         \
+    void hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,                      \
+               sycl::buffer<TYPE_A> &a, std::int64_t lda, sycl::buffer<TYPE_B> &d,              \
+               sycl::buffer<TYPE_B> &e, sycl::buffer<TYPE_A> &tau,                              \
+               sycl::buffer<TYPE_A> &scratchpad, std::int64_t scratchpad_size) {                \
+        hetrd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, d, e, tau, scratchpad, \
+              scratchpad_size);                                                                 \
+    }
+
+HETRD_LAUNCHER(std::complex<float>, float, LAPACKE_chetrd_work)
+HETRD_LAUNCHER(std::complex<double>, double, LAPACKE_zhetrd_work)
+
+#undef HETRD_LAUNCHER
+
+template <typename Func, typename T>
+inline void hetrf(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda,
+                  sycl::buffer<std::int64_t> &ipiv, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_hetrf<T>(func, uplo, n, a_acc.GET_MULTI_PTR, lda, ipiv_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("hetrf", func_name, info);
+        });
+    });
+}
+
+#define HETRF_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                      \
+    void hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a,  \
+               std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<TYPE> &scratchpad, \
+               std::int64_t scratchpad_size) {                                                     \
+        hetrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, ipiv, scratchpad,         \
+              scratchpad_size);                                                                    \
+    }
+
+HETRF_LAUNCHER(std::complex<float>, LAPACKE_chetrf_work)
+HETRF_LAUNCHER(std::complex<double>, LAPACKE_zhetrf_work)
+
+#undef HETRF_LAUNCHER
+
+template <typename Func, typename T>
+inline void orgbr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::generate vec,
+                  std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<T> &a,
+                  std::int64_t lda, sycl::buffer<T> &tau, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_orgbr<T>(func, vec, m, n, k, a_acc.GET_MULTI_PTR, lda, tau_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("orgbr", func_name, info);
+        });
+    });
+}
+
+#define ORGBR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                    \
+    void orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,    \
+               std::int64_t k, sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &tau, \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                   \
+        orgbr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, vec, m, n, k, a, lda, tau, scratchpad,   \
+              scratchpad_size);                                                                  \
+    }
+
+ORGBR_LAUNCHER(float, LAPACKE_sorgbr_work)
+ORGBR_LAUNCHER(double, LAPACKE_dorgbr_work)
+
+#undef ORGBR_LAUNCHER
+
+template <typename Func, typename T>
+inline void orgqr(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                  std::int64_t n, std::int64_t k, sycl::buffer<T> &a, std::int64_t lda,
+                  sycl::buffer<T> &tau, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_orgqr<T>(func, m, n, k, a_acc.GET_MULTI_PTR, lda, tau_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("orgqr", func_name, info);
+        });
+    });
+}
+
+#define ORGQR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                             \
+    void orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,        \
+               sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &tau,          \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {            \
+        orgqr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, tau, scratchpad, \
+              scratchpad_size);                                                           \
+    }
+
+ORGQR_LAUNCHER(float, LAPACKE_sorgqr_work)
+ORGQR_LAUNCHER(double, LAPACKE_dorgqr_work)
+
+#undef ORGQR_LAUNCHER
+
+template <typename Func, typename T>
+inline void orgtr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_orgtr<T>(func, uplo, n, a_acc.GET_MULTI_PTR, lda, tau_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("orgtr", func_name, info);
+        });
+    });
+}
+
+#define ORGTR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                     \
+    void orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, \
+               std::int64_t lda, sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &scratchpad,         \
+               std::int64_t scratchpad_size) {                                                    \
+        orgtr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, tau, scratchpad,         \
+              scratchpad_size);                                                                   \
+    }
+
+ORGTR_LAUNCHER(float, LAPACKE_sorgtr_work)
+ORGTR_LAUNCHER(double, LAPACKE_dorgtr_work)
+
+#undef ORGTR_LAUNCHER
+
+template <typename Func, typename T>
+inline void ormtr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::side side,
+                  oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau,
+                  sycl::buffer<T> &c, std::int64_t ldc, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_ormtr<T>(func, side, uplo, trans, m, n, a_acc.GET_MULTI_PTR, lda,
+                                      tau_acc.GET_MULTI_PTR, c_acc.GET_MULTI_PTR, ldc,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("ormtr", func_name, info);
+        });
+    });
+}
+
+#define ORMTR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                    \
+    void ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,               \
+               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,                     \
+               sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &tau,                 \
+               sycl::buffer<TYPE> &c, std::int64_t ldc, sycl::buffer<TYPE> &scratchpad,          \
+               std::int64_t scratchpad_size) {                                                   \
+        ormtr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, uplo, trans, m, n, a, lda, tau, c, \
+              ldc, scratchpad, scratchpad_size);                                                 \
+    }
+
+ORMTR_LAUNCHER(float, LAPACKE_sormtr_work)
+ORMTR_LAUNCHER(double, LAPACKE_dormtr_work)
+
+#undef ORMTR_LAUNCHER
+
+template <typename Func, typename T>
+inline void ormrq(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::side side,
+                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                  sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau, sycl::buffer<T> &c,
+                  std::int64_t ldc, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_ormrq<T>(func, side, trans, m, n, k, a_acc.GET_MULTI_PTR, lda,
+                                      tau_acc.GET_MULTI_PTR, c_acc.GET_MULTI_PTR, ldc,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("ormrq", func_name, info);
+        });
+    });
+}
+
+#define ORMRQ_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                      \
+    void ormrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,           \
+               std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<TYPE> &a,              \
+               std::int64_t lda, sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &c, std::int64_t ldc, \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                     \
+        ormrq(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, trans, m, n, k, a, lda, tau, c, ldc, \
+              scratchpad, scratchpad_size);                                                        \
+    }
+
+ORMRQ_LAUNCHER(float, LAPACKE_sormrq_work)
+ORMRQ_LAUNCHER(double, LAPACKE_dormrq_work)
+
+#undef ORMRQ_LAUNCHER
+
+template <typename Func, typename T>
+inline void ormqr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::side side,
+                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                  sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau, sycl::buffer<T> &c,
+                  std::int64_t ldc, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_ormqr<T>(func, side, trans, m, n, k, a_acc.GET_MULTI_PTR, lda,
+                                      tau_acc.GET_MULTI_PTR, c_acc.GET_MULTI_PTR, ldc,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("ormqr", func_name, info);
+        });
+    });
+}
+
+#define ORMQR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                      \
+    void ormqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,           \
+               std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<TYPE> &a,              \
+               std::int64_t lda, sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &c, std::int64_t ldc, \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                     \
+        ormqr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, trans, m, n, k, a, lda, tau, c, ldc, \
+              scratchpad, scratchpad_size);                                                        \
+    }
+
+ORMQR_LAUNCHER(float, LAPACKE_sormqr_work)
+ORMQR_LAUNCHER(double, LAPACKE_dormqr_work)
+
+#undef ORMQR_LAUNCHER
+
+template <typename Func, typename T>
+inline void posv_mixed(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                       std::int64_t n, std::int64_t nrhs, sycl::buffer<T> &a, std::int64_t lda,
+                       sycl::buffer<T> &b, std::int64_t ldb, sycl::buffer<T> &x, std::int64_t ldx,
+                       sycl::buffer<std::int64_t> &iter, sycl::buffer<T> &scratchpad,
+                       std::int64_t scratchpad_size) {
+    if (scratchpad_size < mixed_lwork(n, nrhs))
+        throw oneapi::mkl::lapack::invalid_argument("posv_mixed", "scratchpad_size is too small");
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        auto x_acc = x.template get_access<sycl::access::mode::write>(cgh);
+        auto iter_acc = iter.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_posv_mixed<T>(func, uplo, n, nrhs, a_acc.GET_MULTI_PTR, lda,
+                                           b_acc.GET_MULTI_PTR, ldb, x_acc.GET_MULTI_PTR, ldx,
+                                           iter_acc.GET_MULTI_PTR, scratch_acc.GET_MULTI_PTR);
+            lapacke_info_check("posv_mixed", func_name, info);
+        });
+    });
+}
+
+#define POSV_MIXED_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                 \
+    void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, \
+                    sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &b,                \
+                    std::int64_t ldb, sycl::buffer<TYPE> &x, std::int64_t ldx,                     \
+                    sycl::buffer<std::int64_t> &iter, sycl::buffer<TYPE> &scratchpad,              \
+                    std::int64_t scratchpad_size) {                                                \
+        posv_mixed(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda, b, ldb, x,     \
+                   ldx, iter, scratchpad, scratchpad_size);                                        \
+    }
+
+POSV_MIXED_LAUNCHER(double, LAPACKE_dsposv_work)
+POSV_MIXED_LAUNCHER(std::complex<double>, LAPACKE_zcposv_work)
+
+#undef POSV_MIXED_LAUNCHER
+
+template <typename Func, typename T>
+inline void potrf(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_potrf<T>(func, uplo, n, a_acc.GET_MULTI_PTR, lda);
+            lapacke_info_check("potrf", func_name, info);
+        });
+    });
+}
+
+#define POTRF_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                     \
+    void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, \
+               std::int64_t lda, sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {  \
+        potrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, scratchpad,              \
+              scratchpad_size);                                                                   \
+    }
+
+POTRF_LAUNCHER(float, LAPACKE_spotrf_work)
+POTRF_LAUNCHER(double, LAPACKE_dpotrf_work)
+POTRF_LAUNCHER(std::complex<float>, LAPACKE_cpotrf_work)
+POTRF_LAUNCHER(std::complex<double>, LAPACKE_zpotrf_work)
+
+#undef POTRF_LAUNCHER
+
+template <typename Func, typename T>
+inline void potri(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_potri<T>(func, uplo, n, a_acc.GET_MULTI_PTR, lda);
+            lapacke_info_check("potri", func_name, info);
+        });
+    });
+}
+
+#define POTRI_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                     \
+    void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, \
+               std::int64_t lda, sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {  \
+        potri(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, scratchpad,              \
+              scratchpad_size);                                                                   \
+    }
+
+POTRI_LAUNCHER(float, LAPACKE_spotri_work)
+POTRI_LAUNCHER(double, LAPACKE_dpotri_work)
+POTRI_LAUNCHER(std::complex<float>, LAPACKE_cpotri_work)
+POTRI_LAUNCHER(std::complex<double>, LAPACKE_zpotri_work)
+
+#undef POTRI_LAUNCHER
+
+template <typename Func, typename T>
+inline void potrs(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, std::int64_t nrhs, sycl::buffer<T> &a, std::int64_t lda,
+                  sycl::buffer<T> &b, std::int64_t ldb, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_potrs<T>(func, uplo, n, nrhs, a_acc.GET_MULTI_PTR, lda,
+                                      b_acc.GET_MULTI_PTR, ldb);
+            lapacke_info_check("potrs", func_name, info);
+        });
+    });
+}
+
+#define POTRS_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                      \
+    void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,      \
+               sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &b, std::int64_t ldb,   \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                     \
+        potrs(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad, \
+              scratchpad_size);                                                                    \
+    }
+
+POTRS_LAUNCHER(float, LAPACKE_spotrs_work)
+POTRS_LAUNCHER(double, LAPACKE_dpotrs_work)
+POTRS_LAUNCHER(std::complex<float>, LAPACKE_cpotrs_work)
+POTRS_LAUNCHER(std::complex<double>, LAPACKE_zpotrs_work)
+
+#undef POTRS_LAUNCHER
+
+template <typename Func, typename T>
+inline void syevd(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a, std::int64_t lda,
+                  sycl::buffer<T> &w, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_syevd<T>(func, jobz, uplo, n, a_acc.GET_MULTI_PTR, lda, w_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("syevd", func_name, info);
+        });
+    });
+}
+
+#define SYEVD_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                     \
+    void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, \
+               sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &w,                    \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                    \
+        syevd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, uplo, n, a, lda, w, scratchpad,     \
+              scratchpad_size);                                                                   \
+    }
+
+SYEVD_LAUNCHER(float, LAPACKE_ssyevd_work)
+SYEVD_LAUNCHER(double, LAPACKE_dsyevd_work)
+
+#undef SYEVD_LAUNCHER
+
+template <typename Func, typename T>
+inline void syevr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  sycl::buffer<T> &a, std::int64_t lda, T vl, T vu, std::int64_t il,
+                  std::int64_t iu, T abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<T> &w,
+                  sycl::buffer<T> &z, std::int64_t ldz, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_syevr<T>(func, jobz, range, uplo, n, a_acc.GET_MULTI_PTR, lda, vl, vu, il, iu,
+                              abstol, m_acc.GET_MULTI_PTR, w_acc.GET_MULTI_PTR, z_acc.GET_MULTI_PTR,
+                              ldz, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("syevr", func_name, info);
+        });
+    });
+}
+
+#define SYEVR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                     \
+    void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,              \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, std::int64_t lda,   \
+               TYPE vl, TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol,                   \
+               sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE> &w, sycl::buffer<TYPE> &z,       \
+               std::int64_t ldz, sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {  \
+        syevr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl, vu, il, \
+              iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);                             \
+    }
+
+SYEVR_LAUNCHER(float, LAPACKE_ssyevr_work)
+SYEVR_LAUNCHER(double, LAPACKE_dsyevr_work)
+
+#undef SYEVR_LAUNCHER
+
+template <typename Func, typename T>
+inline void syevx(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  sycl::buffer<T> &a, std::int64_t lda, T vl, T vu, std::int64_t il,
+                  std::int64_t iu, T abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<T> &w,
+                  sycl::buffer<T> &z, std::int64_t ldz, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto m_acc = m.template get_access<sycl::access::mode::write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto z_acc = z.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_syevx<T>(func, jobz, range, uplo, n, a_acc.GET_MULTI_PTR, lda, vl, vu, il, iu,
+                              abstol, m_acc.GET_MULTI_PTR, w_acc.GET_MULTI_PTR, z_acc.GET_MULTI_PTR,
+                              ldz, scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("syevx", func_name, info);
+        });
+    });
+}
+
+#define SYEVX_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                     \
+    void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,              \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, std::int64_t lda,   \
+               TYPE vl, TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol,                   \
+               sycl::buffer<std::int64_t> &m, sycl::buffer<TYPE> &w, sycl::buffer<TYPE> &z,       \
+               std::int64_t ldz, sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {  \
+        syevx(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl, vu, il, \
+              iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size);                             \
+    }
+
+SYEVX_LAUNCHER(float, LAPACKE_ssyevx_work)
+SYEVX_LAUNCHER(double, LAPACKE_dsyevx_work)
+
+#undef SYEVX_LAUNCHER
+
+template <typename Func, typename T>
+inline void sygvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
+                  oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<T> &a,
+                  std::int64_t lda, sycl::buffer<T> &b, std::int64_t ldb, sycl::buffer<T> &w,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        auto w_acc = w.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_sygvd<T>(func, itype, jobz, uplo, n, a_acc.GET_MULTI_PTR, lda,
+                                      b_acc.GET_MULTI_PTR, ldb, w_acc.GET_MULTI_PTR,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("sygvd", func_name, info);
+        });
+    });
+}
+
+#define SYGVD_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                    \
+    void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,                    \
+               oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, std::int64_t lda,  \
+               sycl::buffer<TYPE> &b, std::int64_t ldb, sycl::buffer<TYPE> &w,                   \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                   \
+        sygvd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, itype, jobz, uplo, n, a, lda, b, ldb, w, \
+              scratchpad, scratchpad_size);                                                      \
+    }
+
+SYGVD_LAUNCHER(float, LAPACKE_ssygvd_work)
+SYGVD_LAUNCHER(double, LAPACKE_dsygvd_work)
+
+#undef SYGVD_LAUNCHER
+
+template <typename Func, typename T>
+inline void sytrd(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &d,
+                  sycl::buffer<T> &e, sycl::buffer<T> &tau, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto d_acc = d.template get_access<sycl::access::mode::write>(cgh);
+        auto e_acc = e.template get_access<sycl::access::mode::write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_sytrd<T>(func, uplo, n, a_acc.GET_MULTI_PTR, lda, d_acc.GET_MULTI_PTR,
+                                      e_acc.GET_MULTI_PTR, tau_acc.GET_MULTI_PTR,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("sytrd", func_name, info);
+        });
+    });
+}
+
+#define SYTRD_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                     \
+    void sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, \
+               std::int64_t lda, sycl::buffer<TYPE> &d, sycl::buffer<TYPE> &e,                    \
+               sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &scratchpad,                           \
+               std::int64_t scratchpad_size) {                                                    \
+        sytrd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, d, e, tau, scratchpad,   \
+              scratchpad_size);                                                                   \
+    }
+
+SYTRD_LAUNCHER(float, LAPACKE_ssytrd_work)
+SYTRD_LAUNCHER(double, LAPACKE_dsytrd_work)
+
+#undef SYTRD_LAUNCHER
+
+template <typename Func, typename T>
+inline void sytrf(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda,
+                  sycl::buffer<std::int64_t> &ipiv, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto ipiv_acc = ipiv.template get_access<sycl::access::mode::write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_sytrf<T>(func, uplo, n, a_acc.GET_MULTI_PTR, lda, ipiv_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("sytrf", func_name, info);
+        });
+    });
+}
+
+#define SYTRF_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                      \
+    void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a,  \
+               std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<TYPE> &scratchpad, \
+               std::int64_t scratchpad_size) {                                                     \
+        sytrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, ipiv, scratchpad,         \
+              scratchpad_size);                                                                    \
+    }
+
+SYTRF_LAUNCHER(float, LAPACKE_ssytrf_work)
+SYTRF_LAUNCHER(double, LAPACKE_dsytrf_work)
+SYTRF_LAUNCHER(std::complex<float>, LAPACKE_csytrf_work)
+SYTRF_LAUNCHER(std::complex<double>, LAPACKE_zsytrf_work)
+
+#undef SYTRF_LAUNCHER
+
+template <typename Func, typename T>
+inline void trtrs(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n,
+                  std::int64_t nrhs, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &b,
+                  std::int64_t ldb, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_trtrs<T>(func, uplo, trans, diag, n, nrhs, a_acc.GET_MULTI_PTR, lda,
+                                      b_acc.GET_MULTI_PTR, ldb);
+            lapacke_info_check("trtrs", func_name, info);
+        });
+    });
+}
+
+#define TRTRS_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                    \
+    void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,         \
+               oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, sycl::buffer<TYPE> &a, \
+               std::int64_t lda, sycl::buffer<TYPE> &b, std::int64_t ldb,                        \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                   \
+        trtrs(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, trans, diag, n, nrhs, a, lda, b,   \
+              ldb, scratchpad, scratchpad_size);                                                 \
+    }
+
+TRTRS_LAUNCHER(float, LAPACKE_strtrs_work)
+TRTRS_LAUNCHER(double, LAPACKE_dtrtrs_work)
+TRTRS_LAUNCHER(std::complex<float>, LAPACKE_ctrtrs_work)
+TRTRS_LAUNCHER(std::complex<double>, LAPACKE_ztrtrs_work)
+
+#undef TRTRS_LAUNCHER
+
+template <typename Func, typename T>
+inline void ungbr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::generate vec,
+                  std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<T> &a,
+                  std::int64_t lda, sycl::buffer<T> &tau, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_ungbr<T>(func, vec, m, n, k, a_acc.GET_MULTI_PTR, lda, tau_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("ungbr", func_name, info);
+        });
+    });
+}
+
+#define UNGBR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                    \
+    void ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,    \
+               std::int64_t k, sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &tau, \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                   \
+        ungbr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, vec, m, n, k, a, lda, tau, scratchpad,   \
+              scratchpad_size);                                                                  \
+    }
+
+UNGBR_LAUNCHER(std::complex<float>, LAPACKE_cungbr_work)
+UNGBR_LAUNCHER(std::complex<double>, LAPACKE_zungbr_work)
+
+#undef UNGBR_LAUNCHER
+
+template <typename Func, typename T>
+inline void ungqr(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                  std::int64_t n, std::int64_t k, sycl::buffer<T> &a, std::int64_t lda,
+                  sycl::buffer<T> &tau, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_ungqr<T>(func, m, n, k, a_acc.GET_MULTI_PTR, lda, tau_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("ungqr", func_name, info);
+        });
+    });
+}
+
+#define UNGQR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                             \
+    void ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,        \
+               sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &tau,          \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {            \
+        ungqr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, tau, scratchpad, \
+              scratchpad_size);                                                           \
+    }
+
+UNGQR_LAUNCHER(std::complex<float>, LAPACKE_cungqr_work)
+UNGQR_LAUNCHER(std::complex<double>, LAPACKE_zungqr_work)
+
+#undef UNGQR_LAUNCHER
+
+template <typename Func, typename T>
+inline void ungtr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau,
+                  sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read_write>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info =
+                host_ungtr<T>(func, uplo, n, a_acc.GET_MULTI_PTR, lda, tau_acc.GET_MULTI_PTR,
+                              scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("ungtr", func_name, info);
+        });
+    });
+}
+
+#define UNGTR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                     \
+    void ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<TYPE> &a, \
+               std::int64_t lda, sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &scratchpad,         \
+               std::int64_t scratchpad_size) {                                                    \
+        ungtr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, tau, scratchpad,         \
+              scratchpad_size);                                                                   \
+    }
+
+UNGTR_LAUNCHER(std::complex<float>, LAPACKE_cungtr_work)
+UNGTR_LAUNCHER(std::complex<double>, LAPACKE_zungtr_work)
+
+#undef UNGTR_LAUNCHER
+
+template <typename Func, typename T>
+inline void unmrq(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::side side,
+                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                  sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau, sycl::buffer<T> &c,
+                  std::int64_t ldc, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_unmrq<T>(func, side, trans, m, n, k, a_acc.GET_MULTI_PTR, lda,
+                                      tau_acc.GET_MULTI_PTR, c_acc.GET_MULTI_PTR, ldc,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("unmrq", func_name, info);
+        });
+    });
+}
+
+#define UNMRQ_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                      \
+    void unmrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,           \
+               std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<TYPE> &a,              \
+               std::int64_t lda, sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &c, std::int64_t ldc, \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                     \
+        unmrq(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, trans, m, n, k, a, lda, tau, c, ldc, \
+              scratchpad, scratchpad_size);                                                        \
+    }
+
+UNMRQ_LAUNCHER(std::complex<float>, LAPACKE_cunmrq_work)
+UNMRQ_LAUNCHER(std::complex<double>, LAPACKE_zunmrq_work)
+
+#undef UNMRQ_LAUNCHER
+
+template <typename Func, typename T>
+inline void unmqr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::side side,
+                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                  sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau, sycl::buffer<T> &c,
+                  std::int64_t ldc, sycl::buffer<T> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_unmqr<T>(func, side, trans, m, n, k, a_acc.GET_MULTI_PTR, lda,
+                                      tau_acc.GET_MULTI_PTR, c_acc.GET_MULTI_PTR, ldc,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("unmqr", func_name, info);
+        });
+    });
+}
+
+#define UNMQR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                      \
+    void unmqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,           \
+               std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<TYPE> &a,              \
+               std::int64_t lda, sycl::buffer<TYPE> &tau, sycl::buffer<TYPE> &c, std::int64_t ldc, \
+               sycl::buffer<TYPE> &scratchpad, std::int64_t scratchpad_size) {                     \
+        unmqr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, trans, m, n, k, a, lda, tau, c, ldc, \
+              scratchpad, scratchpad_size);                                                        \
+    }
+
+UNMQR_LAUNCHER(std::complex<float>, LAPACKE_cunmqr_work)
+UNMQR_LAUNCHER(std::complex<double>, LAPACKE_zunmqr_work)
+
+#undef UNMQR_LAUNCHER
+
+template <typename Func, typename T>
+inline void unmtr(const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::side side,
+                  oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m,
+                  std::int64_t n, sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &tau,
+                  sycl::buffer<T> &c, std::int64_t ldc, sycl::buffer<T> &scratchpad,
+                  std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto tau_acc = tau.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        auto scratch_acc = scratchpad.template get_access<sycl::access::mode::read_write>(cgh);
+        cgh.host_task([=]() {
+            auto info = host_unmtr<T>(func, side, uplo, trans, m, n, a_acc.GET_MULTI_PTR, lda,
+                                      tau_acc.GET_MULTI_PTR, c_acc.GET_MULTI_PTR, ldc,
+                                      scratch_acc.GET_MULTI_PTR, scratchpad_size);
+            lapacke_info_check("unmtr", func_name, info);
+        });
+    });
+}
+
+#define UNMTR_LAUNCHER(TYPE, LAPACKE_ROUTINE)                                                    \
+    void unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,               \
+               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,                     \
+               sycl::buffer<TYPE> &a, std::int64_t lda, sycl::buffer<TYPE> &tau,                 \
+               sycl::buffer<TYPE> &c, std::int64_t ldc, sycl::buffer<TYPE> &scratchpad,          \
+               std::int64_t scratchpad_size) {                                                   \
+        unmtr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, uplo, trans, m, n, a, lda, tau, c, \
+              ldc, scratchpad, scratchpad_size);                                                 \
+    }
+
+UNMTR_LAUNCHER(std::complex<float>, LAPACKE_cunmtr_work)
+UNMTR_LAUNCHER(std::complex<double>, LAPACKE_zunmtr_work)
+
+#undef UNMTR_LAUNCHER
+
+// USM APIs
+
+template <typename Func, typename T>
+inline sycl::event gebrd(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, T *a, std::int64_t lda, real_t<T> *d, real_t<T> *e,
+                         T *tauq, T *taup, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info =
+                host_gebrd<T>(func, m, n, a, lda, d, e, tauq, taup, scratchpad, scratchpad_size);
+            lapacke_info_check("gebrd", func_name, info);
+        });
+    });
+}
+
+#define GEBRD_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                    \
+    sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE_A *a,           \
+                      std::int64_t lda, TYPE_B *d, TYPE_B *e, TYPE_A *tauq, TYPE_A *taup,      \
+                      TYPE_A *scratchpad, std::int64_t scratchpad_size,                        \
+                      const std::vector<sycl::event> &dependencies) {                          \
+        return gebrd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, d, e, tauq, taup, \
+                     scratchpad, scratchpad_size, dependencies);                               \
+    }
+
+GEBRD_LAUNCHER_USM(float, float, LAPACKE_sgebrd_work)
+GEBRD_LAUNCHER_USM(double, double, LAPACKE_dgebrd_work)
+GEBRD_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cgebrd_work)
+GEBRD_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zgebrd_work)
+
+#undef GEBRD_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event gerqf(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, T *a, std::int64_t lda, T *tau, T *scratchpad,
+                         std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_gerqf<T>(func, m, n, a, lda, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("gerqf", func_name, info);
+        });
+    });
+}
+
+#define GERQF_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *a,                 \
+                      std::int64_t lda, TYPE *tau, TYPE *scratchpad, std::int64_t scratchpad_size, \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return gerqf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, tau, scratchpad,      \
+                     scratchpad_size, dependencies);                                               \
+    }
+
+GERQF_LAUNCHER_USM(float, LAPACKE_sgerqf_work)
+GERQF_LAUNCHER_USM(double, LAPACKE_dgerqf_work)
+GERQF_LAUNCHER_USM(std::complex<float>, LAPACKE_cgerqf_work)
+GERQF_LAUNCHER_USM(std::complex<double>, LAPACKE_zgerqf_work)
+
+#undef GERQF_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event geqrf(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, T *a, std::int64_t lda, T *tau, T *scratchpad,
+                         std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_geqrf<T>(func, m, n, a, lda, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("geqrf", func_name, info);
+        });
+    });
+}
+
+#define GEQRF_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *a,                 \
+                      std::int64_t lda, TYPE *tau, TYPE *scratchpad, std::int64_t scratchpad_size, \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return geqrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, tau, scratchpad,      \
+                     scratchpad_size, dependencies);                                               \
+    }
+
+GEQRF_LAUNCHER_USM(float, LAPACKE_sgeqrf_work)
+GEQRF_LAUNCHER_USM(double, LAPACKE_dgeqrf_work)
+GEQRF_LAUNCHER_USM(std::complex<float>, LAPACKE_cgeqrf_work)
+GEQRF_LAUNCHER_USM(std::complex<double>, LAPACKE_zgeqrf_work)
+
+#undef GEQRF_LAUNCHER_USM
+
+template <typename Geqrf, typename Ormqr, typename T>
+inline sycl::event geqrf_tsqr(const char *geqrf_name, Geqrf geqrf, const char *ormqr_name,
+                              Ormqr ormqr, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                              T *a, std::int64_t lda, T *tau, T *scratchpad,
+                              std::int64_t scratchpad_size,
+                              const std::vector<sycl::event> &dependencies) {
+    if (scratchpad_size < host_geqrf_tsqr_scratchpad_size<T>(geqrf_name, geqrf, ormqr_name, ormqr,
+                                                             m, n, lda))
+        throw oneapi::mkl::lapack::invalid_argument("geqrf_tsqr", "scratchpad_size is too small");
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_geqrf_tsqr<T>(geqrf_name, geqrf, ormqr_name, ormqr, m, n, a, lda, tau, scratchpad,
+                               scratchpad_size);
+        });
+    });
+}
+
+#define GEQRF_TSQR_LAUNCHER_USM(TYPE, GEQRF_ROUTINE, ORMQR_ROUTINE)                               \
+    sycl::event geqrf_tsqr(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *a,           \
+                           std::int64_t lda, TYPE *tau, TYPE *scratchpad,                         \
+                           std::int64_t scratchpad_size,                                          \
+                           const std::vector<sycl::event> &dependencies) {                        \
+        return geqrf_tsqr(#GEQRF_ROUTINE, GEQRF_ROUTINE, #ORMQR_ROUTINE, ORMQR_ROUTINE, queue, m, \
+                          n, a, lda, tau, scratchpad, scratchpad_size, dependencies);             \
+    }
+
+GEQRF_TSQR_LAUNCHER_USM(float, LAPACKE_sgeqrf_work, LAPACKE_sormqr_work)
+GEQRF_TSQR_LAUNCHER_USM(double, LAPACKE_dgeqrf_work, LAPACKE_dormqr_work)
+GEQRF_TSQR_LAUNCHER_USM(std::complex<float>, LAPACKE_cgeqrf_work, LAPACKE_cunmqr_work)
+GEQRF_TSQR_LAUNCHER_USM(std::complex<double>, LAPACKE_zgeqrf_work, LAPACKE_zunmqr_work)
+
+#undef GEQRF_TSQR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getrf(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, T *a, std::int64_t lda, std::int64_t *ipiv, T *scratchpad,
+                         std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_getrf<T>(func, m, n, a, lda, ipiv);
+            lapacke_info_check("getrf", func_name, info);
+        });
+    });
+}
+
+#define GETRF_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                              \
+    sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, TYPE *a,             \
+                      std::int64_t lda, std::int64_t *ipiv, TYPE *scratchpad,                  \
+                      std::int64_t scratchpad_size,                                            \
+                      const std::vector<sycl::event> &dependencies) {                          \
+        return getrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, a, lda, ipiv, scratchpad, \
+                     scratchpad_size, dependencies);                                           \
+    }
+
+GETRF_LAUNCHER_USM(float, LAPACKE_sgetrf_work)
+GETRF_LAUNCHER_USM(double, LAPACKE_dgetrf_work)
+GETRF_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetrf_work)
+GETRF_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetrf_work)
+
+#undef GETRF_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getri(const char *func_name, Func func, sycl::queue &queue, std::int64_t n, T *a,
+                         std::int64_t lda, std::int64_t *ipiv, T *scratchpad,
+                         std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_getri<T>(func, n, a, lda, ipiv, scratchpad, scratchpad_size);
+            lapacke_info_check("getri", func_name, info);
+        });
+    });
+}
+
+#define GETRI_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                           \
+    sycl::event getri(sycl::queue &queue, std::int64_t n, TYPE *a, std::int64_t lda,        \
+                      std::int64_t *ipiv, TYPE *scratchpad, std::int64_t scratchpad_size,   \
+                      const std::vector<sycl::event> &dependencies) {                       \
+        return getri(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, a, lda, ipiv, scratchpad, \
+                     scratchpad_size, dependencies);                                        \
+    }
+
+GETRI_LAUNCHER_USM(float, LAPACKE_sgetri_work)
+GETRI_LAUNCHER_USM(double, LAPACKE_dgetri_work)
+GETRI_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetri_work)
+GETRI_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetri_work)
+
+#undef GETRI_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event getrs(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs, T *a,
+                         std::int64_t lda, std::int64_t *ipiv, T *b, std::int64_t ldb,
+                         T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_getrs<T>(func, trans, n, nrhs, a, lda, ipiv, b, ldb);
+            lapacke_info_check("getrs", func_name, info);
+        });
+    });
+}
+
+#define GETRS_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                \
+    sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,          \
+                      std::int64_t nrhs, TYPE *a, std::int64_t lda, std::int64_t *ipiv, TYPE *b, \
+                      std::int64_t ldb, TYPE *scratchpad, std::int64_t scratchpad_size,          \
+                      const std::vector<sycl::event> &dependencies) {                            \
+        return getrs(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, trans, n, nrhs, a, lda, ipiv, b,  \
+                     ldb, scratchpad, scratchpad_size, dependencies);                            \
+    }
+
+GETRS_LAUNCHER_USM(float, LAPACKE_sgetrs_work)
+GETRS_LAUNCHER_USM(double, LAPACKE_dgetrs_work)
+GETRS_LAUNCHER_USM(std::complex<float>, LAPACKE_cgetrs_work)
+GETRS_LAUNCHER_USM(std::complex<double>, LAPACKE_zgetrs_work)
+
+#undef GETRS_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event gesv_mixed(const char *func_name, Func func, sycl::queue &queue, std::int64_t n,
+                              std::int64_t nrhs, T *a, std::int64_t lda, std::int64_t *ipiv, T *b,
+                              std::int64_t ldb, T *x, std::int64_t ldx, std::int64_t *iter,
+                              T *scratchpad, std::int64_t scratchpad_size,
+                              const std::vector<sycl::event> &dependencies) {
+    if (scratchpad_size < mixed_lwork(n, nrhs))
+        throw oneapi::mkl::lapack::invalid_argument("gesv_mixed", "scratchpad_size is too small");
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info =
+                host_gesv_mixed<T>(func, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, scratchpad);
+            lapacke_info_check("gesv_mixed", func_name, info);
+        });
+    });
+}
+
+#define GESV_MIXED_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                             \
+    sycl::event gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, TYPE *a,         \
+                           std::int64_t lda, std::int64_t *ipiv, TYPE *b, std::int64_t ldb,        \
+                           TYPE *x, std::int64_t ldx, std::int64_t *iter, TYPE *scratchpad,        \
+                           std::int64_t scratchpad_size,                                           \
+                           const std::vector<sycl::event> &dependencies) {                         \
+        return gesv_mixed(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, n, nrhs, a, lda, ipiv, b, ldb, \
+                          x, ldx, iter, scratchpad, scratchpad_size, dependencies);                \
+    }
+
+GESV_MIXED_LAUNCHER_USM(double, LAPACKE_dsgesv_work)
+GESV_MIXED_LAUNCHER_USM(std::complex<double>, LAPACKE_zcgesv_work)
+
+#undef GESV_MIXED_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event gesvd(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, T *a, std::int64_t lda, real_t<T> *s,
+    T *u, std::int64_t ldu, T *vt, std::int64_t ldvt, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_gesvd<T>(func, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                      scratchpad, scratchpad_size);
+            lapacke_info_check("gesvd", func_name, info);
+        });
+    });
+}
+
+#define GESVD_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                     \
+    sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,  \
+                      std::int64_t m, std::int64_t n, TYPE_A *a, std::int64_t lda, TYPE_B *s,   \
+                      TYPE_A *u, std::int64_t ldu, TYPE_A *vt, std::int64_t ldvt,               \
+                      TYPE_A *scratchpad, std::int64_t scratchpad_size,                         \
+                      const std::vector<sycl::event> &dependencies) {                           \
+        return gesvd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobu, jobvt, m, n, a, lda, s, u, \
+                     ldu, vt, ldvt, scratchpad, scratchpad_size, dependencies);                 \
+    }
+
+GESVD_LAUNCHER_USM(float, float, LAPACKE_sgesvd_work)
+GESVD_LAUNCHER_USM(double, double, LAPACKE_dgesvd_work)
+GESVD_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cgesvd_work)
+GESVD_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zgesvd_work)
+
+#undef GESVD_LAUNCHER_USM
+
+template <typename Geqrf, typename Orgqr, typename Gesvd, typename T>
+inline sycl::event gesvd_randomized(
+    const char *geqrf_name, Geqrf geqrf, const char *orgqr_name, Orgqr orgqr,
+    const char *gesvd_name, Gesvd gesvd, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed, const T *a,
+    std::int64_t lda, real_t<T> *s, T *u, std::int64_t ldu, T *vt, std::int64_t ldvt,
+    T *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    if (scratchpad_size < host_gesvd_randomized_scratchpad_size<T>(
+                              geqrf_name, geqrf, orgqr_name, orgqr, gesvd_name, gesvd, jobu,
+                              jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt))
+        throw oneapi::mkl::lapack::invalid_argument("gesvd_randomized",
+                                                    "scratchpad_size is too small");
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            host_gesvd_randomized<T>(geqrf_name, geqrf, orgqr_name, orgqr, gesvd_name, gesvd, jobu,
+                                     jobvt, m, n, k, oversample, power_iters, seed, a, lda, s, u,
+                                     ldu, vt, ldvt, scratchpad);
+        });
+    });
+}
+
+#define GESVD_RANDOMIZED_LAUNCHER_USM(TYPE_A, TYPE_B, GEQRF_ROUTINE, ORGQR_ROUTINE, GESVD_ROUTINE) \
+    sycl::event gesvd_randomized(                                                                  \
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,   \
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,         \
+        std::uint64_t seed, const TYPE_A *a, std::int64_t lda, TYPE_B *s, TYPE_A *u,               \
+        std::int64_t ldu, TYPE_A *vt, std::int64_t ldvt, TYPE_A *scratchpad,                       \
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {              \
+        return gesvd_randomized(#GEQRF_ROUTINE, GEQRF_ROUTINE, #ORGQR_ROUTINE, ORGQR_ROUTINE,      \
+                                #GESVD_ROUTINE, GESVD_ROUTINE, queue, jobu, jobvt, m, n, k,        \
+                                oversample, power_iters, seed, a, lda, s, u, ldu, vt, ldvt,        \
+                                scratchpad, scratchpad_size, dependencies);                        \
+    }
+
+GESVD_RANDOMIZED_LAUNCHER_USM(float, float, LAPACKE_sgeqrf_work, LAPACKE_sorgqr_work,
+                              LAPACKE_sgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER_USM(double, double, LAPACKE_dgeqrf_work, LAPACKE_dorgqr_work,
+                              LAPACKE_dgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cgeqrf_work, LAPACKE_cungqr_work,
+                              LAPACKE_cgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zgeqrf_work,
+                              LAPACKE_zungqr_work, LAPACKE_zgesvd_work)
+
+#undef GESVD_RANDOMIZED_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event heevd(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, real_t<T> *w, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_heevd<T>(func, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size);
+            lapacke_info_check("heevd", func_name, info);
+        });
+    });
+}
+
+#define HEEVD_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                       \
+    sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,          \
+                      std::int64_t n, TYPE_A *a, std::int64_t lda, TYPE_B *w, TYPE_A *scratchpad, \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return heevd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, uplo, n, a, lda, w,          \
+                     scratchpad, scratchpad_size, dependencies);                                  \
+    }
+
+HEEVD_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cheevd_work)
+HEEVD_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zheevd_work)
+
+#undef HEEVD_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event heevr(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+    real_t<T> vl, real_t<T> vu, std::int64_t il, std::int64_t iu, real_t<T> abstol, std::int64_t *m,
+    real_t<T> *w, T *z, std::int64_t ldz, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_heevr<T>(func, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                      w, z, ldz, scratchpad, scratchpad_size);
+            lapacke_info_check("heevr", func_name, info);
+        });
+    });
+}
+
+#define HEEVR_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                        \
+    sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,        \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE_A *a, std::int64_t lda,         \
+                      TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu, TYPE_B abstol,       \
+                      std::int64_t *m, TYPE_B *w, TYPE_A *z, std::int64_t ldz, TYPE_A *scratchpad, \
+                      std::int64_t scratchpad_size,                                                \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return heevr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl,   \
+                     vu, il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies); \
+    }
+
+HEEVR_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cheevr_work)
+HEEVR_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zheevr_work)
+
+#undef HEEVR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event heevx(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+    real_t<T> vl, real_t<T> vu, std::int64_t il, std::int64_t iu, real_t<T> abstol, std::int64_t *m,
+    real_t<T> *w, T *z, std::int64_t ldz, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_heevx<T>(func, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                      w, z, ldz, scratchpad, scratchpad_size);
+            lapacke_info_check("heevx", func_name, info);
+        });
+    });
+}
+
+#define HEEVX_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                        \
+    sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,        \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE_A *a, std::int64_t lda,         \
+                      TYPE_B vl, TYPE_B vu, std::int64_t il, std::int64_t iu, TYPE_B abstol,       \
+                      std::int64_t *m, TYPE_B *w, TYPE_A *z, std::int64_t ldz, TYPE_A *scratchpad, \
+                      std::int64_t scratchpad_size,                                                \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return heevx(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl,   \
+                     vu, il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies); \
+    }
+
+HEEVX_LAUNCHER_USM(std::complex<float>, float, LAPACKE_cheevx_work)
+HEEVX_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zheevx_work)
+
+#undef HEEVX_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event hegvd(const char *func_name, Func func, sycl::queue &queue, std::int64_t itype,
+                         oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                         std::int64_t lda, T *b, std::int64_t ldb, real_t<T> *w, T *scratchpad,
+                         std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_hegvd<T>(func, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                                      scratchpad_size);
+            lapacke_info_check("hegvd", func_name, info);
+        });
+    });
+}
+
+#define HEGVD_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                     \
+    sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,            \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE_A *a, std::int64_t lda,      \
+                      TYPE_A *b, std::int64_t ldb, TYPE_B *w, TYPE_A *scratchpad,               \
+                      std::int64_t scratchpad_size,                                             \
+                      const std::vector<sycl::event> &dependencies) {                           \
+        return hegvd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, itype, jobz, uplo, n, a, lda, b, \
+                     ldb, w, scratchpad, scratchpad_size, dependencies);                        \
+    }
+
+HEGVD_LAUNCHER_USM(std::complex<float>, float, LAPACKE_chegvd_work)
+HEGVD_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zhegvd_work)
+
+#undef HEGVD_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event hetrd(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    T *a, std::int64_t lda, real_t<T> *d, real_t<T> *e, T *tau, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info =
+                host_hetrd<T>(func, uplo, n, a, lda, d, e, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("hetrd", func_name, info);
+        });
+    });
+}
+
+#define HETRD_LAUNCHER_USM(TYPE_A, TYPE_B, LAPACKE_ROUTINE)                                    \
+    sycl::event hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE_A *a,   \
+                      std::int64_t lda, TYPE_B *d, TYPE_B *e, TYPE_A *tau, TYPE_A *scratchpad, \
+                      std::int64_t scratchpad_size,                                            \
+                      const std::vector<sycl::event> &dependencies) {                          \
+        return hetrd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, d, e, tau,     \
+                     scratchpad, scratchpad_size, dependencies);                               \
+    }
+
+HETRD_LAUNCHER_USM(std::complex<float>, float, LAPACKE_chetrd_work)
+HETRD_LAUNCHER_USM(std::complex<double>, double, LAPACKE_zhetrd_work)
+
+#undef HETRD_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event hetrf(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+                         std::int64_t *ipiv, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_hetrf<T>(func, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+            lapacke_info_check("hetrf", func_name, info);
+        });
+    });
+}
+
+#define HETRF_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                 \
+    sycl::event hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a,        \
+                      std::int64_t lda, std::int64_t *ipiv, TYPE *scratchpad,                     \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return hetrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, ipiv, scratchpad, \
+                     scratchpad_size, dependencies);                                              \
+    }
+
+HETRF_LAUNCHER_USM(std::complex<float>, LAPACKE_chetrf_work)
+HETRF_LAUNCHER_USM(std::complex<double>, LAPACKE_zhetrf_work)
+
+#undef HETRF_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event orgbr(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+    std::int64_t n, std::int64_t k, T *a, std::int64_t lda, T *tau, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_orgbr<T>(func, vec, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("orgbr", func_name, info);
+        });
+    });
+}
+
+#define ORGBR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                           \
+    sycl::event orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,        \
+                      std::int64_t n, std::int64_t k, TYPE *a, std::int64_t lda, TYPE *tau, \
+                      TYPE *scratchpad, std::int64_t scratchpad_size,                       \
+                      const std::vector<sycl::event> &dependencies) {                       \
+        return orgbr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, vec, m, n, k, a, lda, tau,   \
+                     scratchpad, scratchpad_size, dependencies);                            \
+    }
+
+ORGBR_LAUNCHER_USM(float, LAPACKE_sorgbr_work)
+ORGBR_LAUNCHER_USM(double, LAPACKE_dorgbr_work)
+
+#undef ORGBR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event orgqr(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, std::int64_t k, T *a, std::int64_t lda, T *tau,
+                         T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_orgqr<T>(func, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("orgqr", func_name, info);
+        });
+    });
+}
+
+#define ORGQR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k, TYPE *a, \
+                      std::int64_t lda, TYPE *tau, TYPE *scratchpad, std::int64_t scratchpad_size, \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return orgqr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, tau, scratchpad,   \
+                     scratchpad_size, dependencies);                                               \
+    }
+
+ORGQR_LAUNCHER_USM(float, LAPACKE_sorgqr_work)
+ORGQR_LAUNCHER_USM(double, LAPACKE_dorgqr_work)
+
+#undef ORGQR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event orgtr(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T *tau,
+                         T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_orgtr<T>(func, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("orgtr", func_name, info);
+        });
+    });
+}
+
+#define ORGTR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a,         \
+                      std::int64_t lda, TYPE *tau, TYPE *scratchpad, std::int64_t scratchpad_size, \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return orgtr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, tau, scratchpad,   \
+                     scratchpad_size, dependencies);                                               \
+    }
+
+ORGTR_LAUNCHER_USM(float, LAPACKE_sorgtr_work)
+ORGTR_LAUNCHER_USM(double, LAPACKE_dorgtr_work)
+
+#undef ORGTR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event ormtr(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::side side,
+    oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, T *a,
+    std::int64_t lda, T *tau, T *c, std::int64_t ldc, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_ormtr<T>(func, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                      scratchpad, scratchpad_size);
+            lapacke_info_check("ormtr", func_name, info);
+        });
+    });
+}
+
+#define ORMTR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                               \
+    sycl::event ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,       \
+                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, TYPE *a,    \
+                      std::int64_t lda, TYPE *tau, TYPE *c, std::int64_t ldc, TYPE *scratchpad, \
+                      std::int64_t scratchpad_size,                                             \
+                      const std::vector<sycl::event> &dependencies) {                           \
+        return ormtr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, uplo, trans, m, n, a, lda, \
+                     tau, c, ldc, scratchpad, scratchpad_size, dependencies);                   \
+    }
+
+ORMTR_LAUNCHER_USM(float, LAPACKE_sormtr_work)
+ORMTR_LAUNCHER_USM(double, LAPACKE_dormtr_work)
+
+#undef ORMTR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event ormrq(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, std::int64_t k, T *a, std::int64_t lda, T *tau, T *c,
+                         std::int64_t ldc, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_ormrq<T>(func, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                                      scratchpad_size);
+            lapacke_info_check("ormrq", func_name, info);
+        });
+    });
+}
+
+#define ORMRQ_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                 \
+    sycl::event ormrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,   \
+                      std::int64_t m, std::int64_t n, std::int64_t k, TYPE *a, std::int64_t lda,  \
+                      TYPE *tau, TYPE *c, std::int64_t ldc, TYPE *scratchpad,                     \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return ormrq(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, trans, m, n, k, a, lda, tau, \
+                     c, ldc, scratchpad, scratchpad_size, dependencies);                          \
+    }
+
+ORMRQ_LAUNCHER_USM(float, LAPACKE_sormrq_work)
+ORMRQ_LAUNCHER_USM(double, LAPACKE_dormrq_work)
+
+#undef ORMRQ_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event ormqr(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, std::int64_t k, T *a, std::int64_t lda, T *tau, T *c,
+                         std::int64_t ldc, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_ormqr<T>(func, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                                      scratchpad_size);
+            lapacke_info_check("ormqr", func_name, info);
+        });
+    });
+}
+
+#define ORMQR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                 \
+    sycl::event ormqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,   \
+                      std::int64_t m, std::int64_t n, std::int64_t k, TYPE *a, std::int64_t lda,  \
+                      TYPE *tau, TYPE *c, std::int64_t ldc, TYPE *scratchpad,                     \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return ormqr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, trans, m, n, k, a, lda, tau, \
+                     c, ldc, scratchpad, scratchpad_size, dependencies);                          \
+    }
+
+ORMQR_LAUNCHER_USM(float, LAPACKE_sormqr_work)
+ORMQR_LAUNCHER_USM(double, LAPACKE_dormqr_work)
+
+#undef ORMQR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event posv_mixed(const char *func_name, Func func, sycl::queue &queue,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, T *a,
+                              std::int64_t lda, T *b, std::int64_t ldb, T *x, std::int64_t ldx,
+                              std::int64_t *iter, T *scratchpad, std::int64_t scratchpad_size,
+                              const std::vector<sycl::event> &dependencies) {
+    if (scratchpad_size < mixed_lwork(n, nrhs))
+        throw oneapi::mkl::lapack::invalid_argument("posv_mixed", "scratchpad_size is too small");
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info =
+                host_posv_mixed<T>(func, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, scratchpad);
+            lapacke_info_check("posv_mixed", func_name, info);
+        });
+    });
+}
+
+#define POSV_MIXED_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                             \
+    sycl::event posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,             \
+                           std::int64_t nrhs, TYPE *a, std::int64_t lda, TYPE *b,                  \
+                           std::int64_t ldb, TYPE *x, std::int64_t ldx, std::int64_t *iter,        \
+                           TYPE *scratchpad, std::int64_t scratchpad_size,                         \
+                           const std::vector<sycl::event> &dependencies) {                         \
+        return posv_mixed(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda, b, ldb, \
+                          x, ldx, iter, scratchpad, scratchpad_size, dependencies);                \
+    }
+
+POSV_MIXED_LAUNCHER_USM(double, LAPACKE_dsposv_work)
+POSV_MIXED_LAUNCHER_USM(std::complex<double>, LAPACKE_zcposv_work)
+
+#undef POSV_MIXED_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event potrf(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+                         T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_potrf<T>(func, uplo, n, a, lda);
+            lapacke_info_check("potrf", func_name, info);
+        });
+    });
+}
+
+#define POTRF_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                           \
+    sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a,  \
+                      std::int64_t lda, TYPE *scratchpad, std::int64_t scratchpad_size,     \
+                      const std::vector<sycl::event> &dependencies) {                       \
+        return potrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, scratchpad, \
+                     scratchpad_size, dependencies);                                        \
+    }
+
+POTRF_LAUNCHER_USM(float, LAPACKE_spotrf_work)
+POTRF_LAUNCHER_USM(double, LAPACKE_dpotrf_work)
+POTRF_LAUNCHER_USM(std::complex<float>, LAPACKE_cpotrf_work)
+POTRF_LAUNCHER_USM(std::complex<double>, LAPACKE_zpotrf_work)
+
+#undef POTRF_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event potri(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+                         T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_potri<T>(func, uplo, n, a, lda);
+            lapacke_info_check("potri", func_name, info);
+        });
+    });
+}
+
+#define POTRI_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                           \
+    sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a,  \
+                      std::int64_t lda, TYPE *scratchpad, std::int64_t scratchpad_size,     \
+                      const std::vector<sycl::event> &dependencies) {                       \
+        return potri(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, scratchpad, \
+                     scratchpad_size, dependencies);                                        \
+    }
+
+POTRI_LAUNCHER_USM(float, LAPACKE_spotri_work)
+POTRI_LAUNCHER_USM(double, LAPACKE_dpotri_work)
+POTRI_LAUNCHER_USM(std::complex<float>, LAPACKE_cpotri_work)
+POTRI_LAUNCHER_USM(std::complex<double>, LAPACKE_zpotri_work)
+
+#undef POTRI_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event potrs(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, T *a, std::int64_t lda, T *b, std::int64_t ldb, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_potrs<T>(func, uplo, n, nrhs, a, lda, b, ldb);
+            lapacke_info_check("potrs", func_name, info);
+        });
+    });
+}
+
+#define POTRS_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                              \
+    sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,              \
+                      std::int64_t nrhs, TYPE *a, std::int64_t lda, TYPE *b, std::int64_t ldb, \
+                      TYPE *scratchpad, std::int64_t scratchpad_size,                          \
+                      const std::vector<sycl::event> &dependencies) {                          \
+        return potrs(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, nrhs, a, lda, b, ldb,  \
+                     scratchpad, scratchpad_size, dependencies);                               \
+    }
+
+POTRS_LAUNCHER_USM(float, LAPACKE_spotrs_work)
+POTRS_LAUNCHER_USM(double, LAPACKE_dpotrs_work)
+POTRS_LAUNCHER_USM(std::complex<float>, LAPACKE_cpotrs_work)
+POTRS_LAUNCHER_USM(std::complex<double>, LAPACKE_zpotrs_work)
+
+#undef POTRS_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event syevd(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, T *a,
+                         std::int64_t lda, T *w, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_syevd<T>(func, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size);
+            lapacke_info_check("syevd", func_name, info);
+        });
+    });
+}
+
+#define SYEVD_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                           \
+    sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,    \
+                      std::int64_t n, TYPE *a, std::int64_t lda, TYPE *w, TYPE *scratchpad, \
+                      std::int64_t scratchpad_size,                                         \
+                      const std::vector<sycl::event> &dependencies) {                       \
+        return syevd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, uplo, n, a, lda, w,    \
+                     scratchpad, scratchpad_size, dependencies);                            \
+    }
+
+SYEVD_LAUNCHER_USM(float, LAPACKE_ssyevd_work)
+SYEVD_LAUNCHER_USM(double, LAPACKE_dsyevd_work)
+
+#undef SYEVD_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event syevr(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T vl,
+    T vu, std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m, T *w, T *z, std::int64_t ldz,
+    T *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_syevr<T>(func, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                      w, z, ldz, scratchpad, scratchpad_size);
+            lapacke_info_check("syevr", func_name, info);
+        });
+    });
+}
+
+#define SYEVR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,        \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, std::int64_t lda, TYPE vl,  \
+                      TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol, std::int64_t *m,     \
+                      TYPE *w, TYPE *z, std::int64_t ldz, TYPE *scratchpad,                        \
+                      std::int64_t scratchpad_size,                                                \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return syevr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl,   \
+                     vu, il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies); \
+    }
+
+SYEVR_LAUNCHER_USM(float, LAPACKE_ssyevr_work)
+SYEVR_LAUNCHER_USM(double, LAPACKE_dsyevr_work)
+
+#undef SYEVR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event syevx(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T vl,
+    T vu, std::int64_t il, std::int64_t iu, T abstol, std::int64_t *m, T *w, T *z, std::int64_t ldz,
+    T *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_syevx<T>(func, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                      w, z, ldz, scratchpad, scratchpad_size);
+            lapacke_info_check("syevx", func_name, info);
+        });
+    });
+}
+
+#define SYEVX_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,        \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, std::int64_t lda, TYPE vl,  \
+                      TYPE vu, std::int64_t il, std::int64_t iu, TYPE abstol, std::int64_t *m,     \
+                      TYPE *w, TYPE *z, std::int64_t ldz, TYPE *scratchpad,                        \
+                      std::int64_t scratchpad_size,                                                \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return syevx(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, jobz, range, uplo, n, a, lda, vl,   \
+                     vu, il, iu, abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies); \
+    }
+
+SYEVX_LAUNCHER_USM(float, LAPACKE_ssyevx_work)
+SYEVX_LAUNCHER_USM(double, LAPACKE_dsyevx_work)
+
+#undef SYEVX_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event sygvd(
+    const char *func_name, Func func, sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+    oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T *b, std::int64_t ldb, T *w,
+    T *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_sygvd<T>(func, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                                      scratchpad_size);
+            lapacke_info_check("sygvd", func_name, info);
+        });
+    });
+}
+
+#define SYGVD_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                 \
+    sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,              \
+                      oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, std::int64_t lda, TYPE *b, \
+                      std::int64_t ldb, TYPE *w, TYPE *scratchpad, std::int64_t scratchpad_size,  \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return sygvd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, itype, jobz, uplo, n, a, lda, b,   \
+                     ldb, w, scratchpad, scratchpad_size, dependencies);                          \
+    }
+
+SYGVD_LAUNCHER_USM(float, LAPACKE_ssygvd_work)
+SYGVD_LAUNCHER_USM(double, LAPACKE_dsygvd_work)
+
+#undef SYGVD_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event sytrd(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T *d, T *e,
+                         T *tau, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info =
+                host_sytrd<T>(func, uplo, n, a, lda, d, e, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("sytrd", func_name, info);
+        });
+    });
+}
+
+#define SYTRD_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                          \
+    sycl::event sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a, \
+                      std::int64_t lda, TYPE *d, TYPE *e, TYPE *tau, TYPE *scratchpad,     \
+                      std::int64_t scratchpad_size,                                        \
+                      const std::vector<sycl::event> &dependencies) {                      \
+        return sytrd(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, d, e, tau, \
+                     scratchpad, scratchpad_size, dependencies);                           \
+    }
+
+SYTRD_LAUNCHER_USM(float, LAPACKE_ssytrd_work)
+SYTRD_LAUNCHER_USM(double, LAPACKE_dsytrd_work)
+
+#undef SYTRD_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event sytrf(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda,
+                         std::int64_t *ipiv, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_sytrf<T>(func, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+            lapacke_info_check("sytrf", func_name, info);
+        });
+    });
+}
+
+#define SYTRF_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                 \
+    sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a,        \
+                      std::int64_t lda, std::int64_t *ipiv, TYPE *scratchpad,                     \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return sytrf(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, ipiv, scratchpad, \
+                     scratchpad_size, dependencies);                                              \
+    }
+
+SYTRF_LAUNCHER_USM(float, LAPACKE_ssytrf_work)
+SYTRF_LAUNCHER_USM(double, LAPACKE_dsytrf_work)
+SYTRF_LAUNCHER_USM(std::complex<float>, LAPACKE_csytrf_work)
+SYTRF_LAUNCHER_USM(std::complex<double>, LAPACKE_zsytrf_work)
+
+#undef SYTRF_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event trtrs(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, T *a,
+    std::int64_t lda, T *b, std::int64_t ldb, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_trtrs<T>(func, uplo, trans, diag, n, nrhs, a, lda, b, ldb);
+            lapacke_info_check("trtrs", func_name, info);
+        });
+    });
+}
+
+#define TRTRS_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,    \
+                      oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, TYPE *a,          \
+                      std::int64_t lda, TYPE *b, std::int64_t ldb, TYPE *scratchpad,               \
+                      std::int64_t scratchpad_size,                                                \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return trtrs(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, trans, diag, n, nrhs, a, lda, \
+                     b, ldb, scratchpad, scratchpad_size, dependencies);                           \
+    }
+
+TRTRS_LAUNCHER_USM(float, LAPACKE_strtrs_work)
+TRTRS_LAUNCHER_USM(double, LAPACKE_dtrtrs_work)
+TRTRS_LAUNCHER_USM(std::complex<float>, LAPACKE_ctrtrs_work)
+TRTRS_LAUNCHER_USM(std::complex<double>, LAPACKE_ztrtrs_work)
+
+#undef TRTRS_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event ungbr(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+    std::int64_t n, std::int64_t k, T *a, std::int64_t lda, T *tau, T *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_ungbr<T>(func, vec, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("ungbr", func_name, info);
+        });
+    });
+}
+
+#define UNGBR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                           \
+    sycl::event ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,        \
+                      std::int64_t n, std::int64_t k, TYPE *a, std::int64_t lda, TYPE *tau, \
+                      TYPE *scratchpad, std::int64_t scratchpad_size,                       \
+                      const std::vector<sycl::event> &dependencies) {                       \
+        return ungbr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, vec, m, n, k, a, lda, tau,   \
+                     scratchpad, scratchpad_size, dependencies);                            \
+    }
+
+UNGBR_LAUNCHER_USM(std::complex<float>, LAPACKE_cungbr_work)
+UNGBR_LAUNCHER_USM(std::complex<double>, LAPACKE_zungbr_work)
+
+#undef UNGBR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event ungqr(const char *func_name, Func func, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, std::int64_t k, T *a, std::int64_t lda, T *tau,
+                         T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_ungqr<T>(func, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("ungqr", func_name, info);
+        });
+    });
+}
+
+#define UNGQR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k, TYPE *a, \
+                      std::int64_t lda, TYPE *tau, TYPE *scratchpad, std::int64_t scratchpad_size, \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return ungqr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, m, n, k, a, lda, tau, scratchpad,   \
+                     scratchpad_size, dependencies);                                               \
+    }
+
+UNGQR_LAUNCHER_USM(std::complex<float>, LAPACKE_cungqr_work)
+UNGQR_LAUNCHER_USM(std::complex<double>, LAPACKE_zungqr_work)
+
+#undef UNGQR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event ungtr(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::uplo uplo, std::int64_t n, T *a, std::int64_t lda, T *tau,
+                         T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_ungtr<T>(func, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+            lapacke_info_check("ungtr", func_name, info);
+        });
+    });
+}
+
+#define UNGTR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                  \
+    sycl::event ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, TYPE *a,         \
+                      std::int64_t lda, TYPE *tau, TYPE *scratchpad, std::int64_t scratchpad_size, \
+                      const std::vector<sycl::event> &dependencies) {                              \
+        return ungtr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, uplo, n, a, lda, tau, scratchpad,   \
+                     scratchpad_size, dependencies);                                               \
+    }
+
+UNGTR_LAUNCHER_USM(std::complex<float>, LAPACKE_cungtr_work)
+UNGTR_LAUNCHER_USM(std::complex<double>, LAPACKE_zungtr_work)
+
+#undef UNGTR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event unmrq(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, std::int64_t k, T *a, std::int64_t lda, T *tau, T *c,
+                         std::int64_t ldc, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_unmrq<T>(func, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                                      scratchpad_size);
+            lapacke_info_check("unmrq", func_name, info);
+        });
+    });
+}
+
+#define UNMRQ_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                 \
+    sycl::event unmrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,   \
+                      std::int64_t m, std::int64_t n, std::int64_t k, TYPE *a, std::int64_t lda,  \
+                      TYPE *tau, TYPE *c, std::int64_t ldc, TYPE *scratchpad,                     \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return unmrq(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, trans, m, n, k, a, lda, tau, \
+                     c, ldc, scratchpad, scratchpad_size, dependencies);                          \
+    }
+
+UNMRQ_LAUNCHER_USM(std::complex<float>, LAPACKE_cunmrq_work)
+UNMRQ_LAUNCHER_USM(std::complex<double>, LAPACKE_zunmrq_work)
+
+#undef UNMRQ_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event unmqr(const char *func_name, Func func, sycl::queue &queue,
+                         oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+                         std::int64_t n, std::int64_t k, T *a, std::int64_t lda, T *tau, T *c,
+                         std::int64_t ldc, T *scratchpad, std::int64_t scratchpad_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_unmqr<T>(func, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                                      scratchpad_size);
+            lapacke_info_check("unmqr", func_name, info);
+        });
+    });
+}
+
+#define UNMQR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                                 \
+    sycl::event unmqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,   \
+                      std::int64_t m, std::int64_t n, std::int64_t k, TYPE *a, std::int64_t lda,  \
+                      TYPE *tau, TYPE *c, std::int64_t ldc, TYPE *scratchpad,                     \
+                      std::int64_t scratchpad_size,                                               \
+                      const std::vector<sycl::event> &dependencies) {                             \
+        return unmqr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, trans, m, n, k, a, lda, tau, \
+                     c, ldc, scratchpad, scratchpad_size, dependencies);                          \
+    }
+
+UNMQR_LAUNCHER_USM(std::complex<float>, LAPACKE_cunmqr_work)
+UNMQR_LAUNCHER_USM(std::complex<double>, LAPACKE_zunmqr_work)
+
+#undef UNMQR_LAUNCHER_USM
+
+template <typename Func, typename T>
+inline sycl::event unmtr(
+    const char *func_name, Func func, sycl::queue &queue, oneapi::mkl::side side,
+    oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, T *a,
+    std::int64_t lda, T *tau, T *c, std::int64_t ldc, T *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            auto info = host_unmtr<T>(func, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                      scratchpad, scratchpad_size);
+            lapacke_info_check("unmtr", func_name, info);
+        });
+    });
+}
+
+#define UNMTR_LAUNCHER_USM(TYPE, LAPACKE_ROUTINE)                                               \
+    sycl::event unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,       \
+                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, TYPE *a,    \
+                      std::int64_t lda, TYPE *tau, TYPE *c, std::int64_t ldc, TYPE *scratchpad, \
+                      std::int64_t scratchpad_size,                                             \
+                      const std::vector<sycl::event> &dependencies) {                           \
+        return unmtr(#LAPACKE_ROUTINE, LAPACKE_ROUTINE, queue, side, uplo, trans, m, n, a, lda, \
+                     tau, c, ldc, scratchpad, scratchpad_size, dependencies);                   \
+    }
+
+UNMTR_LAUNCHER_USM(std::complex<float>, LAPACKE_cunmtr_work)
+UNMTR_LAUNCHER_USM(std::complex<double>, LAPACKE_zunmtr_work)
+
+#undef UNMTR_LAUNCHER_USM
+
+// SCRATCHPAD APIs
+
+#define GEBRD_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                             \
+    template <>                                                                                   \
+    std::int64_t gebrd_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t m, std::int64_t n, \
+                                             std::int64_t lda) {                                  \
+        return lapacke_query<TYPE>("gebrd", #LAPACKE_ROUTINE, [=](TYPE *work) {                   \
+            return host_gebrd<TYPE>(LAPACKE_ROUTINE, m, n, nullptr, lda, nullptr, nullptr,        \
+                                    nullptr, nullptr, work, -1);                                  \
+        });                                                                                       \
+    }
+
+GEBRD_LAUNCHER_SCRATCH(float, LAPACKE_sgebrd_work)
+GEBRD_LAUNCHER_SCRATCH(double, LAPACKE_dgebrd_work)
+GEBRD_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgebrd_work)
+GEBRD_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgebrd_work)
+
+#undef GEBRD_LAUNCHER_SCRATCH
+
+#define GERQF_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                             \
+    template <>                                                                                   \
+    std::int64_t gerqf_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t m, std::int64_t n, \
+                                             std::int64_t lda) {                                  \
+        return lapacke_query<TYPE>("gerqf", #LAPACKE_ROUTINE, [=](TYPE *work) {                   \
+            return host_gerqf<TYPE>(LAPACKE_ROUTINE, m, n, nullptr, lda, nullptr, work, -1);      \
+        });                                                                                       \
+    }
+
+GERQF_LAUNCHER_SCRATCH(float, LAPACKE_sgerqf_work)
+GERQF_LAUNCHER_SCRATCH(double, LAPACKE_dgerqf_work)
+GERQF_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgerqf_work)
+GERQF_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgerqf_work)
+
+#undef GERQF_LAUNCHER_SCRATCH
+
+#define GEQRF_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                             \
+    template <>                                                                                   \
+    std::int64_t geqrf_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t m, std::int64_t n, \
+                                             std::int64_t lda) {                                  \
+        return lapacke_query<TYPE>("geqrf", #LAPACKE_ROUTINE, [=](TYPE *work) {                   \
+            return host_geqrf<TYPE>(LAPACKE_ROUTINE, m, n, nullptr, lda, nullptr, work, -1);      \
+        });                                                                                       \
+    }
+
+GEQRF_LAUNCHER_SCRATCH(float, LAPACKE_sgeqrf_work)
+GEQRF_LAUNCHER_SCRATCH(double, LAPACKE_dgeqrf_work)
+GEQRF_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgeqrf_work)
+GEQRF_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgeqrf_work)
+
+#undef GEQRF_LAUNCHER_SCRATCH
+
+#define GEQRF_TSQR_LAUNCHER_SCRATCH(TYPE, GEQRF_ROUTINE, ORMQR_ROUTINE)                         \
+    template <>                                                                                 \
+    std::int64_t geqrf_tsqr_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t m,          \
+                                                  std::int64_t n, std::int64_t lda) {           \
+        return host_geqrf_tsqr_scratchpad_size<TYPE>(#GEQRF_ROUTINE, GEQRF_ROUTINE,             \
+                                                     #ORMQR_ROUTINE, ORMQR_ROUTINE, m, n, lda); \
+    }
+
+GEQRF_TSQR_LAUNCHER_SCRATCH(float, LAPACKE_sgeqrf_work, LAPACKE_sormqr_work)
+GEQRF_TSQR_LAUNCHER_SCRATCH(double, LAPACKE_dgeqrf_work, LAPACKE_dormqr_work)
+GEQRF_TSQR_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgeqrf_work, LAPACKE_cunmqr_work)
+GEQRF_TSQR_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgeqrf_work, LAPACKE_zunmqr_work)
+
+#undef GEQRF_TSQR_LAUNCHER_SCRATCH
+
+// LAPACKE_?getrf_work does not use scratchpad memory
+#define GETRF_LAUNCHER_SCRATCH(TYPE)                                                              \
+    template <>                                                                                   \
+    std::int64_t getrf_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t m, std::int64_t n, \
+                                             std::int64_t lda) {                                  \
+        return 0;                                                                                 \
+    }
+
+GETRF_LAUNCHER_SCRATCH(float)
+GETRF_LAUNCHER_SCRATCH(double)
+GETRF_LAUNCHER_SCRATCH(std::complex<float>)
+GETRF_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GETRF_LAUNCHER_SCRATCH
+
+#define GETRI_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                     \
+    template <>                                                                           \
+    std::int64_t getri_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t n,         \
+                                             std::int64_t lda) {                          \
+        return lapacke_query<TYPE>("getri", #LAPACKE_ROUTINE, [=](TYPE *work) {           \
+            return host_getri<TYPE>(LAPACKE_ROUTINE, n, nullptr, lda, nullptr, work, -1); \
+        });                                                                               \
+    }
+
+GETRI_LAUNCHER_SCRATCH(float, LAPACKE_sgetri_work)
+GETRI_LAUNCHER_SCRATCH(double, LAPACKE_dgetri_work)
+GETRI_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgetri_work)
+GETRI_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgetri_work)
+
+#undef GETRI_LAUNCHER_SCRATCH
+
+// LAPACKE_?getrs_work does not use scratchpad memory
+#define GETRS_LAUNCHER_SCRATCH(TYPE)                                                              \
+    template <>                                                                                   \
+    std::int64_t getrs_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::transpose trans,   \
+                                             std::int64_t n, std::int64_t nrhs, std::int64_t lda, \
+                                             std::int64_t ldb) {                                  \
+        return 0;                                                                                 \
+    }
+
+GETRS_LAUNCHER_SCRATCH(float)
+GETRS_LAUNCHER_SCRATCH(double)
+GETRS_LAUNCHER_SCRATCH(std::complex<float>)
+GETRS_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GETRS_LAUNCHER_SCRATCH
+
+#define GESV_MIXED_LAUNCHER_SCRATCH(TYPE)                                               \
+    template <>                                                                         \
+    std::int64_t gesv_mixed_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t n,  \
+                                                  std::int64_t nrhs, std::int64_t lda,  \
+                                                  std::int64_t ldb, std::int64_t ldx) { \
+        return mixed_lwork(n, nrhs);                                                    \
+    }
+
+GESV_MIXED_LAUNCHER_SCRATCH(double)
+GESV_MIXED_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef GESV_MIXED_LAUNCHER_SCRATCH
+
+#define GESVD_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                             \
+    template <>                                                                                   \
+    std::int64_t gesvd_scratchpad_size<TYPE>(                                                     \
+        sycl::queue & queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m, \
+        std::int64_t n, std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {                  \
+        return lapacke_query<TYPE>("gesvd", #LAPACKE_ROUTINE, [=](TYPE *work) {                   \
+            return host_gesvd<TYPE>(LAPACKE_ROUTINE, jobu, jobvt, m, n, nullptr, lda, nullptr,    \
+                                    nullptr, ldu, nullptr, ldvt, work, -1);                       \
+        });                                                                                       \
+    }
+
+GESVD_LAUNCHER_SCRATCH(float, LAPACKE_sgesvd_work)
+GESVD_LAUNCHER_SCRATCH(double, LAPACKE_dgesvd_work)
+GESVD_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgesvd_work)
+GESVD_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgesvd_work)
+
+#undef GESVD_LAUNCHER_SCRATCH
+
+#define GESVD_RANDOMIZED_LAUNCHER_SCRATCH(TYPE, GEQRF_ROUTINE, ORGQR_ROUTINE, GESVD_ROUTINE)      \
+    template <>                                                                                   \
+    std::int64_t gesvd_randomized_scratchpad_size<TYPE>(                                          \
+        sycl::queue & queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m, \
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,        \
+        std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {                                  \
+        return host_gesvd_randomized_scratchpad_size<TYPE>(                                       \
+            #GEQRF_ROUTINE, GEQRF_ROUTINE, #ORGQR_ROUTINE, ORGQR_ROUTINE, #GESVD_ROUTINE,         \
+            GESVD_ROUTINE, jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);        \
+    }
+
+GESVD_RANDOMIZED_LAUNCHER_SCRATCH(float, LAPACKE_sgeqrf_work, LAPACKE_sorgqr_work,
+                                  LAPACKE_sgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER_SCRATCH(double, LAPACKE_dgeqrf_work, LAPACKE_dorgqr_work,
+                                  LAPACKE_dgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cgeqrf_work, LAPACKE_cungqr_work,
+                                  LAPACKE_cgesvd_work)
+GESVD_RANDOMIZED_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zgeqrf_work, LAPACKE_zungqr_work,
+                                  LAPACKE_zgesvd_work)
+
+#undef GESVD_RANDOMIZED_LAUNCHER_SCRATCH
+
+#define HEEVD_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                            \
+    template <>                                                                                  \
+    std::int64_t heevd_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::job jobz,         \
+                                             oneapi::mkl::uplo uplo, std::int64_t n,             \
+                                             std::int64_t lda) {                                 \
+        return lapacke_query<TYPE>("heevd", #LAPACKE_ROUTINE, [=](TYPE *work) {                  \
+            return host_heevd<TYPE>(LAPACKE_ROUTINE, jobz, uplo, n, nullptr, lda, nullptr, work, \
+                                    -1);                                                         \
+        });                                                                                      \
+    }
+
+HEEVD_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cheevd_work)
+HEEVD_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zheevd_work)
+
+#undef HEEVD_LAUNCHER_SCRATCH
+
+#define HEEVR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t heevr_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::job jobz,           \
+                                             oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,    \
+                                             std::int64_t n, std::int64_t lda, std::int64_t ldz) { \
+        return lapacke_query<TYPE>("heevr", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_heevr<TYPE>(LAPACKE_ROUTINE, jobz, range, uplo, n, nullptr, lda, 0, 0, 0,  \
+                                    0, 0, nullptr, nullptr, nullptr, ldz, work, -1);               \
+        });                                                                                        \
+    }
+
+HEEVR_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cheevr_work)
+HEEVR_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zheevr_work)
+
+#undef HEEVR_LAUNCHER_SCRATCH
+
+#define HEEVX_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t heevx_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::job jobz,           \
+                                             oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,    \
+                                             std::int64_t n, std::int64_t lda, std::int64_t ldz) { \
+        return lapacke_query<TYPE>("heevx", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_heevx<TYPE>(LAPACKE_ROUTINE, jobz, range, uplo, n, nullptr, lda, 0, 0, 0,  \
+                                    0, 0, nullptr, nullptr, nullptr, ldz, work, -1);               \
+        });                                                                                        \
+    }
+
+HEEVX_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cheevx_work)
+HEEVX_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zheevx_work)
+
+#undef HEEVX_LAUNCHER_SCRATCH
+
+#define HEGVD_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t hegvd_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t itype,              \
+                                             oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,        \
+                                             std::int64_t n, std::int64_t lda, std::int64_t ldb) { \
+        return lapacke_query<TYPE>("hegvd", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_hegvd<TYPE>(LAPACKE_ROUTINE, itype, jobz, uplo, n, nullptr, lda, nullptr,  \
+                                    ldb, nullptr, work, -1);                                       \
+        });                                                                                        \
+    }
+
+HEGVD_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_chegvd_work)
+HEGVD_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zhegvd_work)
+
+#undef HEGVD_LAUNCHER_SCRATCH
+
+#define HETRD_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                         \
+    template <>                                                                               \
+    std::int64_t hetrd_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo,     \
+                                             std::int64_t n, std::int64_t lda) {              \
+        return lapacke_query<TYPE>("hetrd", #LAPACKE_ROUTINE, [=](TYPE *work) {               \
+            return host_hetrd<TYPE>(LAPACKE_ROUTINE, uplo, n, nullptr, lda, nullptr, nullptr, \
+                                    nullptr, work, -1);                                       \
+        });                                                                                   \
+    }
+
+HETRD_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_chetrd_work)
+HETRD_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zhetrd_work)
+
+#undef HETRD_LAUNCHER_SCRATCH
+
+#define HETRF_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                           \
+    template <>                                                                                 \
+    std::int64_t hetrf_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo,       \
+                                             std::int64_t n, std::int64_t lda) {                \
+        return lapacke_query<TYPE>("hetrf", #LAPACKE_ROUTINE, [=](TYPE *work) {                 \
+            return host_hetrf<TYPE>(LAPACKE_ROUTINE, uplo, n, nullptr, lda, nullptr, work, -1); \
+        });                                                                                     \
+    }
+
+HETRF_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_chetrf_work)
+HETRF_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zhetrf_work)
+
+#undef HETRF_LAUNCHER_SCRATCH
+
+#define ORGBR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                            \
+    template <>                                                                                  \
+    std::int64_t orgbr_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::generate vect,    \
+                                             std::int64_t m, std::int64_t n, std::int64_t k,     \
+                                             std::int64_t lda) {                                 \
+        return lapacke_query<TYPE>("orgbr", #LAPACKE_ROUTINE, [=](TYPE *work) {                  \
+            return host_orgbr<TYPE>(LAPACKE_ROUTINE, vect, m, n, k, nullptr, lda, nullptr, work, \
+                                    -1);                                                         \
+        });                                                                                      \
+    }
+
+ORGBR_LAUNCHER_SCRATCH(float, LAPACKE_sorgbr_work)
+ORGBR_LAUNCHER_SCRATCH(double, LAPACKE_dorgbr_work)
+
+#undef ORGBR_LAUNCHER_SCRATCH
+
+#define ORGQR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                             \
+    template <>                                                                                   \
+    std::int64_t orgqr_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t m, std::int64_t n, \
+                                             std::int64_t k, std::int64_t lda) {                  \
+        return lapacke_query<TYPE>("orgqr", #LAPACKE_ROUTINE, [=](TYPE *work) {                   \
+            return host_orgqr<TYPE>(LAPACKE_ROUTINE, m, n, k, nullptr, lda, nullptr, work, -1);   \
+        });                                                                                       \
+    }
+
+ORGQR_LAUNCHER_SCRATCH(float, LAPACKE_sorgqr_work)
+ORGQR_LAUNCHER_SCRATCH(double, LAPACKE_dorgqr_work)
+
+#undef ORGQR_LAUNCHER_SCRATCH
+
+#define ORGTR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                           \
+    template <>                                                                                 \
+    std::int64_t orgtr_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo,       \
+                                             std::int64_t n, std::int64_t lda) {                \
+        return lapacke_query<TYPE>("orgtr", #LAPACKE_ROUTINE, [=](TYPE *work) {                 \
+            return host_orgtr<TYPE>(LAPACKE_ROUTINE, uplo, n, nullptr, lda, nullptr, work, -1); \
+        });                                                                                     \
+    }
+
+ORGTR_LAUNCHER_SCRATCH(float, LAPACKE_sorgtr_work)
+ORGTR_LAUNCHER_SCRATCH(double, LAPACKE_dorgtr_work)
+
+#undef ORGTR_LAUNCHER_SCRATCH
+
+#define ORMTR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t ormtr_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::side side,          \
+                                             oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, \
+                                             std::int64_t m, std::int64_t n, std::int64_t lda,     \
+                                             std::int64_t ldc) {                                   \
+        return lapacke_query<TYPE>("ormtr", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_ormtr<TYPE>(LAPACKE_ROUTINE, side, uplo, trans, m, n, nullptr, lda,        \
+                                    nullptr, nullptr, ldc, work, -1);                              \
+        });                                                                                        \
+    }
+
+ORMTR_LAUNCHER_SCRATCH(float, LAPACKE_sormtr_work)
+ORMTR_LAUNCHER_SCRATCH(double, LAPACKE_dormtr_work)
+
+#undef ORMTR_LAUNCHER_SCRATCH
+
+#define ORMRQ_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t ormrq_scratchpad_size<TYPE>(                                                      \
+        sycl::queue & queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m, \
+        std::int64_t n, std::int64_t k, std::int64_t lda, std::int64_t ldc) {                      \
+        return lapacke_query<TYPE>("ormrq", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_ormrq<TYPE>(LAPACKE_ROUTINE, side, trans, m, n, k, nullptr, lda, nullptr,  \
+                                    nullptr, ldc, work, -1);                                       \
+        });                                                                                        \
+    }
+
+ORMRQ_LAUNCHER_SCRATCH(float, LAPACKE_sormrq_work)
+ORMRQ_LAUNCHER_SCRATCH(double, LAPACKE_dormrq_work)
+
+#undef ORMRQ_LAUNCHER_SCRATCH
+
+#define ORMQR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t ormqr_scratchpad_size<TYPE>(                                                      \
+        sycl::queue & queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m, \
+        std::int64_t n, std::int64_t k, std::int64_t lda, std::int64_t ldc) {                      \
+        return lapacke_query<TYPE>("ormqr", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_ormqr<TYPE>(LAPACKE_ROUTINE, side, trans, m, n, k, nullptr, lda, nullptr,  \
+                                    nullptr, ldc, work, -1);                                       \
+        });                                                                                        \
+    }
+
+ORMQR_LAUNCHER_SCRATCH(float, LAPACKE_sormqr_work)
+ORMQR_LAUNCHER_SCRATCH(double, LAPACKE_dormqr_work)
+
+#undef ORMQR_LAUNCHER_SCRATCH
+
+#define POSV_MIXED_LAUNCHER_SCRATCH(TYPE)                                               \
+    template <>                                                                         \
+    std::int64_t posv_mixed_scratchpad_size<TYPE>(                                      \
+        sycl::queue & queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, \
+        std::int64_t lda, std::int64_t ldb, std::int64_t ldx) {                         \
+        return mixed_lwork(n, nrhs);                                                    \
+    }
+
+POSV_MIXED_LAUNCHER_SCRATCH(double)
+POSV_MIXED_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POSV_MIXED_LAUNCHER_SCRATCH
+
+// LAPACKE_?potrf_work does not use scratchpad memory
+#define POTRF_LAUNCHER_SCRATCH(TYPE)                                                      \
+    template <>                                                                           \
+    std::int64_t potrf_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo, \
+                                             std::int64_t n, std::int64_t lda) {          \
+        return 0;                                                                         \
+    }
+
+POTRF_LAUNCHER_SCRATCH(float)
+POTRF_LAUNCHER_SCRATCH(double)
+POTRF_LAUNCHER_SCRATCH(std::complex<float>)
+POTRF_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POTRF_LAUNCHER_SCRATCH
+
+// LAPACKE_?potri_work does not use scratchpad memory
+#define POTRI_LAUNCHER_SCRATCH(TYPE)                                                      \
+    template <>                                                                           \
+    std::int64_t potri_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo, \
+                                             std::int64_t n, std::int64_t lda) {          \
+        return 0;                                                                         \
+    }
+
+POTRI_LAUNCHER_SCRATCH(float)
+POTRI_LAUNCHER_SCRATCH(double)
+POTRI_LAUNCHER_SCRATCH(std::complex<float>)
+POTRI_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POTRI_LAUNCHER_SCRATCH
+
+// LAPACKE_?potrs_work does not use scratchpad memory
+#define POTRS_LAUNCHER_SCRATCH(TYPE)                                                              \
+    template <>                                                                                   \
+    std::int64_t potrs_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo,         \
+                                             std::int64_t n, std::int64_t nrhs, std::int64_t lda, \
+                                             std::int64_t ldb) {                                  \
+        return 0;                                                                                 \
+    }
+
+POTRS_LAUNCHER_SCRATCH(float)
+POTRS_LAUNCHER_SCRATCH(double)
+POTRS_LAUNCHER_SCRATCH(std::complex<float>)
+POTRS_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef POTRS_LAUNCHER_SCRATCH
+
+#define SYEVD_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                            \
+    template <>                                                                                  \
+    std::int64_t syevd_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::job jobz,         \
+                                             oneapi::mkl::uplo uplo, std::int64_t n,             \
+                                             std::int64_t lda) {                                 \
+        return lapacke_query<TYPE>("syevd", #LAPACKE_ROUTINE, [=](TYPE *work) {                  \
+            return host_syevd<TYPE>(LAPACKE_ROUTINE, jobz, uplo, n, nullptr, lda, nullptr, work, \
+                                    -1);                                                         \
+        });                                                                                      \
+    }
+
+SYEVD_LAUNCHER_SCRATCH(float, LAPACKE_ssyevd_work)
+SYEVD_LAUNCHER_SCRATCH(double, LAPACKE_dsyevd_work)
+
+#undef SYEVD_LAUNCHER_SCRATCH
+
+#define SYEVR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t syevr_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::job jobz,           \
+                                             oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,    \
+                                             std::int64_t n, std::int64_t lda, std::int64_t ldz) { \
+        return lapacke_query<TYPE>("syevr", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_syevr<TYPE>(LAPACKE_ROUTINE, jobz, range, uplo, n, nullptr, lda, 0, 0, 0,  \
+                                    0, 0, nullptr, nullptr, nullptr, ldz, work, -1);               \
+        });                                                                                        \
+    }
+
+SYEVR_LAUNCHER_SCRATCH(float, LAPACKE_ssyevr_work)
+SYEVR_LAUNCHER_SCRATCH(double, LAPACKE_dsyevr_work)
+
+#undef SYEVR_LAUNCHER_SCRATCH
+
+#define SYEVX_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t syevx_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::job jobz,           \
+                                             oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,    \
+                                             std::int64_t n, std::int64_t lda, std::int64_t ldz) { \
+        return lapacke_query<TYPE>("syevx", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_syevx<TYPE>(LAPACKE_ROUTINE, jobz, range, uplo, n, nullptr, lda, 0, 0, 0,  \
+                                    0, 0, nullptr, nullptr, nullptr, ldz, work, -1);               \
+        });                                                                                        \
+    }
+
+SYEVX_LAUNCHER_SCRATCH(float, LAPACKE_ssyevx_work)
+SYEVX_LAUNCHER_SCRATCH(double, LAPACKE_dsyevx_work)
+
+#undef SYEVX_LAUNCHER_SCRATCH
+
+#define SYGVD_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t sygvd_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t itype,              \
+                                             oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,        \
+                                             std::int64_t n, std::int64_t lda, std::int64_t ldb) { \
+        return lapacke_query<TYPE>("sygvd", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_sygvd<TYPE>(LAPACKE_ROUTINE, itype, jobz, uplo, n, nullptr, lda, nullptr,  \
+                                    ldb, nullptr, work, -1);                                       \
+        });                                                                                        \
+    }
+
+SYGVD_LAUNCHER_SCRATCH(float, LAPACKE_ssygvd_work)
+SYGVD_LAUNCHER_SCRATCH(double, LAPACKE_dsygvd_work)
+
+#undef SYGVD_LAUNCHER_SCRATCH
+
+#define SYTRD_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                         \
+    template <>                                                                               \
+    std::int64_t sytrd_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo,     \
+                                             std::int64_t n, std::int64_t lda) {              \
+        return lapacke_query<TYPE>("sytrd", #LAPACKE_ROUTINE, [=](TYPE *work) {               \
+            return host_sytrd<TYPE>(LAPACKE_ROUTINE, uplo, n, nullptr, lda, nullptr, nullptr, \
+                                    nullptr, work, -1);                                       \
+        });                                                                                   \
+    }
+
+SYTRD_LAUNCHER_SCRATCH(float, LAPACKE_ssytrd_work)
+SYTRD_LAUNCHER_SCRATCH(double, LAPACKE_dsytrd_work)
+
+#undef SYTRD_LAUNCHER_SCRATCH
+
+#define SYTRF_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                           \
+    template <>                                                                                 \
+    std::int64_t sytrf_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo,       \
+                                             std::int64_t n, std::int64_t lda) {                \
+        return lapacke_query<TYPE>("sytrf", #LAPACKE_ROUTINE, [=](TYPE *work) {                 \
+            return host_sytrf<TYPE>(LAPACKE_ROUTINE, uplo, n, nullptr, lda, nullptr, work, -1); \
+        });                                                                                     \
+    }
+
+SYTRF_LAUNCHER_SCRATCH(float, LAPACKE_ssytrf_work)
+SYTRF_LAUNCHER_SCRATCH(double, LAPACKE_dsytrf_work)
+SYTRF_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_csytrf_work)
+SYTRF_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zsytrf_work)
+
+#undef SYTRF_LAUNCHER_SCRATCH
+
+// LAPACKE_?trtrs_work does not use scratchpad memory
+#define TRTRS_LAUNCHER_SCRATCH(TYPE)                                                               \
+    template <>                                                                                    \
+    std::int64_t trtrs_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo,          \
+                                             oneapi::mkl::transpose trans, oneapi::mkl::diag diag, \
+                                             std::int64_t n, std::int64_t nrhs, std::int64_t lda,  \
+                                             std::int64_t ldb) {                                   \
+        return 0;                                                                                  \
+    }
+
+TRTRS_LAUNCHER_SCRATCH(float)
+TRTRS_LAUNCHER_SCRATCH(double)
+TRTRS_LAUNCHER_SCRATCH(std::complex<float>)
+TRTRS_LAUNCHER_SCRATCH(std::complex<double>)
+
+#undef TRTRS_LAUNCHER_SCRATCH
+
+#define UNGBR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                            \
+    template <>                                                                                  \
+    std::int64_t ungbr_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::generate vect,    \
+                                             std::int64_t m, std::int64_t n, std::int64_t k,     \
+                                             std::int64_t lda) {                                 \
+        return lapacke_query<TYPE>("ungbr", #LAPACKE_ROUTINE, [=](TYPE *work) {                  \
+            return host_ungbr<TYPE>(LAPACKE_ROUTINE, vect, m, n, k, nullptr, lda, nullptr, work, \
+                                    -1);                                                         \
+        });                                                                                      \
+    }
+
+UNGBR_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cungbr_work)
+UNGBR_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zungbr_work)
+
+#undef UNGBR_LAUNCHER_SCRATCH
+
+#define UNGQR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                             \
+    template <>                                                                                   \
+    std::int64_t ungqr_scratchpad_size<TYPE>(sycl::queue & queue, std::int64_t m, std::int64_t n, \
+                                             std::int64_t k, std::int64_t lda) {                  \
+        return lapacke_query<TYPE>("ungqr", #LAPACKE_ROUTINE, [=](TYPE *work) {                   \
+            return host_ungqr<TYPE>(LAPACKE_ROUTINE, m, n, k, nullptr, lda, nullptr, work, -1);   \
+        });                                                                                       \
+    }
+
+UNGQR_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cungqr_work)
+UNGQR_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zungqr_work)
+
+#undef UNGQR_LAUNCHER_SCRATCH
+
+#define UNGTR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                           \
+    template <>                                                                                 \
+    std::int64_t ungtr_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::uplo uplo,       \
+                                             std::int64_t n, std::int64_t lda) {                \
+        return lapacke_query<TYPE>("ungtr", #LAPACKE_ROUTINE, [=](TYPE *work) {                 \
+            return host_ungtr<TYPE>(LAPACKE_ROUTINE, uplo, n, nullptr, lda, nullptr, work, -1); \
+        });                                                                                     \
+    }
+
+UNGTR_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cungtr_work)
+UNGTR_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zungtr_work)
+
+#undef UNGTR_LAUNCHER_SCRATCH
+
+#define UNMRQ_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t unmrq_scratchpad_size<TYPE>(                                                      \
+        sycl::queue & queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m, \
+        std::int64_t n, std::int64_t k, std::int64_t lda, std::int64_t ldc) {                      \
+        return lapacke_query<TYPE>("unmrq", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_unmrq<TYPE>(LAPACKE_ROUTINE, side, trans, m, n, k, nullptr, lda, nullptr,  \
+                                    nullptr, ldc, work, -1);                                       \
+        });                                                                                        \
+    }
+
+UNMRQ_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cunmrq_work)
+UNMRQ_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zunmrq_work)
+
+#undef UNMRQ_LAUNCHER_SCRATCH
+
+#define UNMQR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t unmqr_scratchpad_size<TYPE>(                                                      \
+        sycl::queue & queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m, \
+        std::int64_t n, std::int64_t k, std::int64_t lda, std::int64_t ldc) {                      \
+        return lapacke_query<TYPE>("unmqr", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_unmqr<TYPE>(LAPACKE_ROUTINE, side, trans, m, n, k, nullptr, lda, nullptr,  \
+                                    nullptr, ldc, work, -1);                                       \
+        });                                                                                        \
+    }
+
+UNMQR_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cunmqr_work)
+UNMQR_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zunmqr_work)
+
+#undef UNMQR_LAUNCHER_SCRATCH
+
+#define UNMTR_LAUNCHER_SCRATCH(TYPE, LAPACKE_ROUTINE)                                              \
+    template <>                                                                                    \
+    std::int64_t unmtr_scratchpad_size<TYPE>(sycl::queue & queue, oneapi::mkl::side side,          \
+                                             oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, \
+                                             std::int64_t m, std::int64_t n, std::int64_t lda,     \
+                                             std::int64_t ldc) {                                   \
+        return lapacke_query<TYPE>("unmtr", #LAPACKE_ROUTINE, [=](TYPE *work) {                    \
+            return host_unmtr<TYPE>(LAPACKE_ROUTINE, side, uplo, trans, m, n, nullptr, lda,        \
+                                    nullptr, nullptr, ldc, work, -1);                              \
+        });                                                                                        \
+    }
+
+UNMTR_LAUNCHER_SCRATCH(std::complex<float>, LAPACKE_cunmtr_work)
+UNMTR_LAUNCHER_SCRATCH(std::complex<double>, LAPACKE_zunmtr_work)
+
+#undef UNMTR_LAUNCHER_SCRATCH
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,283 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_RANDOMIZED_HPP_
+#define _NETLIB_LAPACK_RANDOMIZED_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "netlib_helper.hpp"
+#include "netlib_host.hpp"
+#include "host_parallel_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+/**
+ * Randomized truncated SVD (Halko, Martinsson and Tropp).
+ *
+ * gesvd_randomized computes the k largest singular values of the m x n matrix
+ * A, and the corresponding singular vectors, from an orthonormal basis Q of an
+ * approximation of the range of A:
+ *
+ *   Y = A Omega, where Omega is an n x l Gaussian matrix, l = min(k + oversample, m, n),
+ *   Q = orth(Y), refined by power_iters iterations Q = orth(A orth(A^H Q)),
+ *   B = Q^H A = U_B S V^H, the SVD of an l x n matrix,
+ *   U = Q U_B(:, 1:k) and V^H(1:k, :).
+ *
+ * A is only read, by products with l columns, so the cost is O(m n l) per pass
+ * over A instead of the O(m n min(m, n)) of gesvd. The products are computed
+ * by CBLAS on row or column blocks spread over the host threads, and Q is
+ * orthonormalized by geqrf and orgqr. Omega is generated from the seed by a
+ * counter-based generator, so it does not depend on the number of threads.
+ */
+
+inline void gesvd_randomized_check(oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                                   std::int64_t m, std::int64_t n, std::int64_t k,
+                                   std::int64_t oversample, std::int64_t power_iters,
+                                   std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    auto check = [](bool valid, const char *message) {
+        if (!valid)
+            throw oneapi::mkl::lapack::invalid_argument("gesvd_randomized", message);
+    };
+    auto job_valid = [](oneapi::mkl::jobsvd job) {
+        return job == oneapi::mkl::jobsvd::somevec || job == oneapi::mkl::jobsvd::novec;
+    };
+    check(job_valid(jobu), "jobu must be jobsvd::somevec or jobsvd::novec");
+    check(job_valid(jobvt), "jobvt must be jobsvd::somevec or jobsvd::novec");
+    check(m >= 0 && n >= 0, "m and n must not be negative");
+    check(k >= 0 && k <= std::min(m, n), "k must be between 0 and min(m, n)");
+    check(oversample >= 0 && power_iters >= 0, "oversample and power_iters must not be negative");
+    check(lda >= std::max<std::int64_t>(1, m), "lda must be at least max(1, m)");
+    check(jobu == oneapi::mkl::jobsvd::novec || ldu >= std::max<std::int64_t>(1, m),
+          "ldu must be at least max(1, m)");
+    check(jobvt == oneapi::mkl::jobsvd::novec || ldvt >= std::max<std::int64_t>(1, k),
+          "ldvt must be at least max(1, k)");
+}
+
+// Sketch size, the number of columns of Omega and Q.
+inline std::int64_t randomized_sketch_size(std::int64_t m, std::int64_t n, std::int64_t k,
+                                           std::int64_t oversample) {
+    return std::min({ k + oversample, m, n });
+}
+
+// jobu and jobvt of the gesvd of B: V^H overwrites B.
+inline oneapi::mkl::jobsvd randomized_jobu(oneapi::mkl::jobsvd jobu) {
+    return jobu == oneapi::mkl::jobsvd::novec ? jobu : oneapi::mkl::jobsvd::somevec;
+}
+
+inline oneapi::mkl::jobsvd randomized_jobvt(oneapi::mkl::jobsvd jobvt) {
+    return jobvt == oneapi::mkl::jobsvd::novec ? jobvt : oneapi::mkl::jobsvd::vectorsina;
+}
+
+/**
+ * Layout of the scratchpad, in elements of T: Omega (n x l, also holding the
+ * orthonormalized A^H Q of the power iterations), Q (m x l), B (l x n), U_B
+ * (l x l), tau, and the LAPACK work array.
+ */
+struct randomized_svd_plan {
+    std::int64_t l, omega, q, b, ub, tau, work, lwork, size;
+
+    randomized_svd_plan(std::int64_t m, std::int64_t n, std::int64_t l, std::int64_t lwork)
+            : l(l),
+              omega(0),
+              q(omega + n * l),
+              b(q + m * l),
+              ub(b + l * n),
+              tau(ub + l * l),
+              work(tau + l),
+              lwork(lwork),
+              size(work + lwork) {}
+};
+
+template <typename T, typename Geqrf, typename Orgqr, typename Gesvd>
+inline std::int64_t randomized_svd_lwork(const char *geqrf_name, Geqrf geqrf,
+                                         const char *orgqr_name, Orgqr orgqr,
+                                         const char *gesvd_name, Gesvd gesvd,
+                                         oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                                         std::int64_t m, std::int64_t n, std::int64_t l) {
+    std::int64_t lwork = 1;
+    for (std::int64_t rows : { m, n }) {
+        lwork = std::max(lwork, lapacke_query<T>("gesvd_randomized", geqrf_name, [&](T *work) {
+            return host_geqrf<T>(geqrf, rows, l, nullptr, rows, nullptr, work, -1);
+        }));
+        lwork = std::max(lwork, lapacke_query<T>("gesvd_randomized", orgqr_name, [&](T *work) {
+            return host_orgqr<T>(orgqr, rows, l, l, nullptr, rows, nullptr, work, -1);
+        }));
+    }
+    return std::max(lwork, lapacke_query<T>("gesvd_randomized", gesvd_name, [&](T *work) {
+        return host_gesvd<T>(gesvd, randomized_jobu(jobu), randomized_jobvt(jobvt), l, n, nullptr,
+                             l, nullptr, nullptr, l, nullptr, 1, work, -1);
+    }));
+}
+
+template <typename T, typename Geqrf, typename Orgqr, typename Gesvd>
+inline std::int64_t host_gesvd_randomized_scratchpad_size(
+    const char *geqrf_name, Geqrf geqrf, const char *orgqr_name, Orgqr orgqr,
+    const char *gesvd_name, Gesvd gesvd, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t oversample,
+    std::int64_t power_iters, std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    gesvd_randomized_check(jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+    const std::int64_t l = randomized_sketch_size(m, n, k, oversample);
+    if (k == 0)
+        return 0;
+    return randomized_svd_plan(m, n, l,
+                               randomized_svd_lwork<T>(geqrf_name, geqrf, orgqr_name, orgqr,
+                                                       gesvd_name, gesvd, jobu, jobvt, m, n, l))
+        .size;
+}
+
+// Element index of a standard normal sequence: two uniform numbers hashed from
+// (seed, index) by splitmix64 are combined by the Box-Muller transform.
+inline std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+constexpr double randomized_two_pi = 6.283185307179586;
+
+inline double gaussian_value(std::uint64_t seed, std::uint64_t index) {
+    const std::uint64_t key = splitmix64(seed);
+    const double u1 = ((splitmix64(key ^ (2 * index)) >> 11) + 1) * 0x1.0p-53;
+    const double u2 = (splitmix64(key ^ (2 * index + 1)) >> 11) * 0x1.0p-53;
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(randomized_two_pi * u2);
+}
+
+template <typename T>
+inline T gaussian(std::uint64_t seed, std::uint64_t index) {
+    if constexpr (is_complex<T>)
+        return T(gaussian_value(seed, 2 * index), gaussian_value(seed, 2 * index + 1));
+    else
+        return T(gaussian_value(seed, index));
+}
+
+template <typename T>
+inline void cblas_gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, const T *a, std::int64_t lda, const T *b,
+                       std::int64_t ldb, T *c, std::int64_t ldc) {
+    const T one = 1, zero = 0;
+    if constexpr (std::is_same_v<T, float>)
+        cblas_sgemm(CblasColMajor, transa, transb, m, n, k, one, a, lda, b, ldb, zero, c, ldc);
+    else if constexpr (std::is_same_v<T, double>)
+        cblas_dgemm(CblasColMajor, transa, transb, m, n, k, one, a, lda, b, ldb, zero, c, ldc);
+    else if constexpr (std::is_same_v<T, std::complex<float>>)
+        cblas_cgemm(CblasColMajor, transa, transb, m, n, k, &one, a, lda, b, ldb, &zero, c, ldc);
+    else
+        cblas_zgemm(CblasColMajor, transa, transb, m, n, k, &one, a, lda, b, ldb, &zero, c, ldc);
+}
+
+// C = op(A) op(B) for an m x n matrix C, where op is the identity or the
+// conjugate transpose. The longer dimension of C is split into one block per
+// host thread.
+template <typename T>
+inline void randomized_gemm(bool conj_a, std::int64_t m, std::int64_t n, std::int64_t k,
+                            const T *a, std::int64_t lda, const T *b, std::int64_t ldb, T *c,
+                            std::int64_t ldc) {
+    constexpr std::int64_t min_block = 256;
+    const CBLAS_TRANSPOSE transa = conj_a ? CblasConjTrans : CblasNoTrans;
+    const bool split_rows = m >= n;
+    const std::int64_t size = split_rows ? m : n;
+    const std::int64_t blocks =
+        std::max<std::int64_t>(1, std::min(host::host_num_threads(), size / min_block));
+    host::host_parallel_for(blocks, [&](std::int64_t block) {
+        const std::int64_t begin = block * size / blocks, end = (block + 1) * size / blocks;
+        if (split_rows)
+            cblas_gemm<T>(transa, CblasNoTrans, end - begin, n, k,
+                          a + (conj_a ? begin * lda : begin), lda, b, ldb, c + begin, ldc);
+        else
+            cblas_gemm<T>(transa, CblasNoTrans, m, end - begin, k, a, lda, b + begin * ldb, ldb,
+                          c + begin * ldc, ldc);
+    });
+}
+
+// Replaces the rows x l matrix y by an orthonormal basis of its columns.
+template <typename T, typename Geqrf, typename Orgqr>
+inline void randomized_orth(const char *geqrf_name, Geqrf geqrf, const char *orgqr_name,
+                            Orgqr orgqr, std::int64_t rows, std::int64_t l, T *y, T *tau,
+                            T *work, std::int64_t lwork) {
+    lapacke_info_check("gesvd_randomized", geqrf_name,
+                       host_geqrf<T>(geqrf, rows, l, y, rows, tau, work, lwork));
+    lapacke_info_check("gesvd_randomized", orgqr_name,
+                       host_orgqr<T>(orgqr, rows, l, l, y, rows, tau, work, lwork));
+}
+
+template <typename T, typename Geqrf, typename Orgqr, typename Gesvd>
+inline void host_gesvd_randomized(const char *geqrf_name, Geqrf geqrf, const char *orgqr_name,
+                                  Orgqr orgqr, const char *gesvd_name, Gesvd gesvd,
+                                  oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                                  std::int64_t m, std::int64_t n, std::int64_t k,
+                                  std::int64_t oversample, std::int64_t power_iters,
+                                  std::uint64_t seed, const T *a, std::int64_t lda,
+                                  real_t<T> *s, T *u, std::int64_t ldu, T *vt, std::int64_t ldvt,
+                                  T *scratchpad) {
+    if (k == 0)
+        return;
+    const std::int64_t l = randomized_sketch_size(m, n, k, oversample);
+    const randomized_svd_plan plan(m, n, l,
+                                   randomized_svd_lwork<T>(geqrf_name, geqrf, orgqr_name, orgqr,
+                                                           gesvd_name, gesvd, jobu, jobvt, m,
+                                                           n, l));
+    T *omega = scratchpad + plan.omega, *q = scratchpad + plan.q, *b = scratchpad + plan.b,
+      *ub = scratchpad + plan.ub, *tau = scratchpad + plan.tau, *work = scratchpad + plan.work;
+    auto orth = [&](std::int64_t rows, T *y) {
+        randomized_orth<T>(geqrf_name, geqrf, orgqr_name, orgqr, rows, l, y, tau, work,
+                           plan.lwork);
+    };
+
+    host::host_parallel_for(l, [&](std::int64_t j) {
+        for (std::int64_t i = 0; i < n; ++i)
+            omega[i + j * n] = gaussian<T>(seed, j * n + i);
+    });
+    randomized_gemm<T>(false, m, l, n, a, lda, omega, n, q, m);
+    orth(m, q);
+    for (std::int64_t iter = 0; iter < power_iters; ++iter) {
+        randomized_gemm<T>(true, n, l, m, a, lda, q, m, omega, n);
+        orth(n, omega);
+        randomized_gemm<T>(false, m, l, n, a, lda, omega, n, q, m);
+        orth(m, q);
+    }
+
+    // B = Q^H A = U_B S V^H, with V^H overwriting B.
+    randomized_gemm<T>(true, l, n, m, q, m, a, lda, b, l);
+    std::vector<real_t<T>> sb(l);
+    lapacke_info_check("gesvd_randomized", gesvd_name,
+                       host_gesvd<T>(gesvd, randomized_jobu(jobu), randomized_jobvt(jobvt), l, n,
+                                     b, l, sb.data(), ub, l, nullptr, 1, work, plan.lwork));
+    std::copy(sb.begin(), sb.begin() + k, s);
+    if (jobu != oneapi::mkl::jobsvd::novec)
+        randomized_gemm<T>(false, m, k, l, q, m, ub, l, u, ldu);
+    if (jobvt != oneapi::mkl::jobsvd::novec) {
+        for (std::int64_t j = 0; j < n; ++j)
+            std::copy(b + j * l, b + j * l + k, vt + j * ldvt);
+    }
+}
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_RANDOMIZED_HPP_
@@ -0,0 +1,741 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_SMALL_BATCH_HPP_
+#define _NETLIB_LAPACK_SMALL_BATCH_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "netlib_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+/**
+ * Small-matrix batch kernels.
+ *
+ * For large batches of tiny matrices, one LAPACKE call per matrix is dominated
+ * by call and argument checking overhead. Strided gels, getrf, getrs, potrf
+ * and potrs batches of real matrices where every dimension is at most
+ * small_batch_max_size_v<T> (32 for float, 16 for double) are instead
+ * computed by SYCL kernels instantiated for the smallest power-of-two size
+ * bucket that holds the matrix. Each work-item owns one matrix of the batch
+ * and keeps it in a private array with compile-time dimensions. On CPU devices
+ * the work-items of a sub-group are the SIMD lanes, so neighbouring matrices of
+ * the batch are factored side by side.
+ *
+ * The kernels follow the unblocked LAPACK algorithms (geqr2, getf2, potf2) and
+ * report the same info values. Failures are collected in a USM array and
+ * reported as a batch_error by a host task once the kernel has run.
+ *
+ * The kernels address the matrices through a layout, so the same kernels serve
+ * strided batches and batches in the compact layout of the *_compact routines.
+ */
+constexpr std::int64_t small_batch_min_bucket = 4;
+constexpr std::int64_t small_batch_max_size = 32;
+
+// A work-item keeps an N x N array of T in private memory, i.e. 4 KB for
+// float at N = 32 but 8 KB for double, which spills out of registers and
+// limits occupancy. Wider types are therefore capped at half the size.
+template <typename T>
+constexpr std::int64_t small_batch_max_size_v =
+    sizeof(T) > sizeof(float) ? small_batch_max_size / 2 : small_batch_max_size;
+
+// Invokes f with the smallest power-of-two bucket in [small_batch_min_bucket,
+// small_batch_max_size_v<T>] that is not smaller than size.
+template <typename T, int Bucket = small_batch_min_bucket, typename F>
+inline void dispatch_small_batch_bucket(std::int64_t size, F &&f) {
+    if constexpr (Bucket >= small_batch_max_size_v<T>) {
+        f(std::integral_constant<int, Bucket>{});
+    }
+    else {
+        if (size <= Bucket)
+            f(std::integral_constant<int, Bucket>{});
+        else
+            dispatch_small_batch_bucket<T, 2 * Bucket>(size, std::forward<F>(f));
+    }
+}
+
+// Invalid arguments are left to LAPACKE, which reports them.
+template <typename T>
+inline bool use_small_batch(std::int64_t m, std::int64_t n, std::int64_t lda,
+                            std::int64_t batch_size) {
+    return batch_size > 0 && m >= 0 && n >= 0 && m <= small_batch_max_size_v<T> &&
+           n <= small_batch_max_size_v<T> && lda >= std::max<std::int64_t>(1, m);
+}
+
+template <typename T>
+inline bool use_small_batch_solve(std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                  std::int64_t ldb, std::int64_t batch_size) {
+    return use_small_batch<T>(n, n, lda, batch_size) && nrhs >= 0 &&
+           ldb >= std::max<std::int64_t>(1, n);
+}
+
+template <typename T>
+inline bool use_small_batch_gels(std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                 std::int64_t lda, std::int64_t ldb, std::int64_t batch_size) {
+    return use_small_batch<T>(m, n, lda, batch_size) && nrhs >= 0 &&
+           ldb >= std::max<std::int64_t>({ 1, m, n });
+}
+
+/**
+ * Element (i, j) of matrix id of a strided batch of column-major matrices.
+ */
+struct strided_batch_layout {
+    std::int64_t ld, stride;
+
+    std::int64_t operator()(std::int64_t id, std::int64_t i, std::int64_t j) const {
+        return id * stride + i + j * ld;
+    }
+};
+
+/**
+ * Element (i, j) of matrix id of a batch in the compact layout: the matrices
+ * are split into groups of interleave consecutive matrices, and the elements
+ * (i, j) of the matrices of a group are stored next to each other. Groups are
+ * ld * cols * interleave elements apart.
+ */
+struct compact_batch_layout {
+    std::int64_t ld, interleave, group_stride;
+
+    compact_batch_layout(std::int64_t ld, std::int64_t cols, std::int64_t interleave)
+            : ld(ld),
+              interleave(interleave),
+              group_stride(ld * cols * interleave) {}
+
+    std::int64_t operator()(std::int64_t id, std::int64_t i, std::int64_t j) const {
+        return (id / interleave) * group_stride + (i + j * ld) * interleave + id % interleave;
+    }
+};
+
+template <typename T, int N, typename Layout, typename AccA>
+inline void small_batch_load(T (&x)[N][N], const AccA &a, Layout layout, std::int64_t id,
+                             std::int64_t m, std::int64_t n) {
+    for (int j = 0; j < N; ++j) {
+        for (int i = 0; i < N; ++i)
+            x[j][i] = (i < m && j < n) ? a[layout(id, i, j)] : T(0);
+    }
+}
+
+template <typename T, int N, typename Layout, typename AccA>
+inline void small_batch_store(const T (&x)[N][N], const AccA &a, Layout layout, std::int64_t id,
+                              std::int64_t m, std::int64_t n) {
+    for (int j = 0; j < N; ++j) {
+        for (int i = 0; i < N; ++i) {
+            if (i < m && j < n)
+                a[layout(id, i, j)] = x[j][i];
+        }
+    }
+}
+
+/**
+ * LU factorization with partial pivoting of one matrix, as in getf2.
+ */
+template <typename T, int N, typename Layout, typename AccA, typename AccIpiv>
+struct small_getrf_kernel {
+    AccA a;
+    AccIpiv ipiv;
+    std::int64_t *info;
+    Layout layout;
+    std::int64_t m, n, stride_ipiv;
+
+    void operator()(sycl::id<1> id) const {
+        T x[N][N];
+        small_batch_load(x, a, layout, id[0], m, n);
+        const std::int64_t ipiv_off = id[0] * stride_ipiv;
+        const std::int64_t mn = m < n ? m : n;
+        std::int64_t status = 0;
+        for (int k = 0; k < N && k < mn; ++k) {
+            int p = k;
+            T pmax = sycl::fabs(x[k][k]);
+            for (int i = k + 1; i < N && i < m; ++i) {
+                if (sycl::fabs(x[k][i]) > pmax) {
+                    pmax = sycl::fabs(x[k][i]);
+                    p = i;
+                }
+            }
+            ipiv[ipiv_off + k] = p + 1;
+            if (x[k][p] != T(0)) {
+                if (p != k) {
+                    for (int j = 0; j < N; ++j) {
+                        const T t = x[j][k];
+                        x[j][k] = x[j][p];
+                        x[j][p] = t;
+                    }
+                }
+                const T r = T(1) / x[k][k];
+                for (int i = k + 1; i < N; ++i)
+                    x[k][i] *= r;
+            }
+            else if (status == 0) {
+                status = k + 1;
+            }
+            for (int j = k + 1; j < N; ++j) {
+                const T t = x[j][k];
+                for (int i = k + 1; i < N; ++i)
+                    x[j][i] -= x[k][i] * t;
+            }
+        }
+        small_batch_store(x, a, layout, id[0], m, n);
+        info[id[0]] = status;
+    }
+};
+
+/**
+ * Solution of op(A) * X = B with the LU factors of getrf, as in getrs.
+ */
+template <typename T, int N, typename Layout, typename AccA, typename AccIpiv, typename AccB>
+struct small_getrs_kernel {
+    AccA a;
+    AccIpiv ipiv;
+    AccB b;
+    Layout layout_a, layout_b;
+    bool trans;
+    std::int64_t n, nrhs, stride_ipiv;
+
+    void operator()(sycl::id<1> id) const {
+        T lu[N][N];
+        small_batch_load(lu, a, layout_a, id[0], n, n);
+        const std::int64_t ipiv_off = id[0] * stride_ipiv;
+        for (std::int64_t r = 0; r < nrhs; ++r) {
+            T x[N];
+            for (int i = 0; i < N; ++i)
+                x[i] = i < n ? b[layout_b(id[0], i, r)] : T(0);
+            if (!trans) {
+                for (int k = 0; k < N && k < n; ++k) {
+                    const std::int64_t p = ipiv[ipiv_off + k] - 1;
+                    const T t = x[k];
+                    x[k] = x[p];
+                    x[p] = t;
+                }
+                for (int j = 0; j < N; ++j) {
+                    for (int i = j + 1; i < N; ++i)
+                        x[i] -= lu[j][i] * x[j];
+                }
+                for (int j = N - 1; j >= 0; --j) {
+                    if (j < n) {
+                        x[j] /= lu[j][j];
+                        for (int i = 0; i < j; ++i)
+                            x[i] -= lu[j][i] * x[j];
+                    }
+                }
+            }
+            else {
+                for (int j = 0; j < N && j < n; ++j) {
+                    for (int i = 0; i < j; ++i)
+                        x[j] -= lu[j][i] * x[i];
+                    x[j] /= lu[j][j];
+                }
+                for (int j = N - 1; j >= 0; --j) {
+                    for (int i = j + 1; i < N; ++i)
+                        x[j] -= lu[j][i] * x[i];
+                }
+                for (int k = N - 1; k >= 0; --k) {
+                    if (k < n) {
+                        const std::int64_t p = ipiv[ipiv_off + k] - 1;
+                        const T t = x[k];
+                        x[k] = x[p];
+                        x[p] = t;
+                    }
+                }
+            }
+            for (int i = 0; i < N && i < n; ++i)
+                b[layout_b(id[0], i, r)] = x[i];
+        }
+    }
+};
+
+/**
+ * Cholesky factorization of one matrix, as in potf2. Only the uplo triangle
+ * is referenced. On failure the leading columns stay factored.
+ */
+template <typename T, int N, typename Layout, typename AccA>
+struct small_potrf_kernel {
+    AccA a;
+    std::int64_t *info;
+    Layout layout;
+    bool upper;
+    std::int64_t n;
+
+    // Element (i, j) of the referenced triangle, for i >= j.
+    T &tri(T (&x)[N][N], int i, int j) const {
+        return upper ? x[i][j] : x[j][i];
+    }
+
+    void operator()(sycl::id<1> id) const {
+        T x[N][N];
+        small_batch_load(x, a, layout, id[0], n, n);
+        std::int64_t status = 0;
+        for (int j = 0; j < N && j < n; ++j) {
+            T d = tri(x, j, j);
+            for (int k = 0; k < j; ++k)
+                d -= tri(x, j, k) * tri(x, j, k);
+            if (!(d > T(0))) {
+                tri(x, j, j) = d;
+                status = j + 1;
+                break;
+            }
+            d = sycl::sqrt(d);
+            tri(x, j, j) = d;
+            for (int i = j + 1; i < N; ++i) {
+                T s = tri(x, i, j);
+                for (int k = 0; k < j; ++k)
+                    s -= tri(x, i, k) * tri(x, j, k);
+                tri(x, i, j) = s / d;
+            }
+        }
+        for (int j = 0; j < N && j < n; ++j) {
+            for (int i = j; i < N && i < n; ++i) {
+                if (upper)
+                    a[layout(id[0], j, i)] = x[i][j];
+                else
+                    a[layout(id[0], i, j)] = x[j][i];
+            }
+        }
+        info[id[0]] = status;
+    }
+};
+
+/**
+ * Solution of A * X = B with the Cholesky factor of potrf, as in potrs.
+ */
+template <typename T, int N, typename Layout, typename AccA, typename AccB>
+struct small_potrs_kernel {
+    AccA a;
+    AccB b;
+    Layout layout_a, layout_b;
+    bool upper;
+    std::int64_t n, nrhs;
+
+    void operator()(sycl::id<1> id) const {
+        // L[j][i] holds element (i, j) of the lower triangular factor L, or
+        // of U^T when the upper triangle is stored.
+        T l[N][N];
+        for (int j = 0; j < N; ++j) {
+            for (int i = 0; i < N; ++i) {
+                if (i >= j && i < n)
+                    l[j][i] = upper ? a[layout_a(id[0], j, i)] : a[layout_a(id[0], i, j)];
+                else
+                    l[j][i] = T(0);
+            }
+        }
+        for (std::int64_t r = 0; r < nrhs; ++r) {
+            T x[N];
+            for (int i = 0; i < N; ++i)
+                x[i] = i < n ? b[layout_b(id[0], i, r)] : T(0);
+            for (int j = 0; j < N && j < n; ++j) {
+                x[j] /= l[j][j];
+                for (int i = j + 1; i < N; ++i)
+                    x[i] -= l[j][i] * x[j];
+            }
+            for (int j = N - 1; j >= 0; --j) {
+                if (j < n) {
+                    for (int i = j + 1; i < N; ++i)
+                        x[j] -= l[j][i] * x[i];
+                    x[j] /= l[j][j];
+                }
+            }
+            for (int i = 0; i < N && i < n; ++i)
+                b[layout_b(id[0], i, r)] = x[i];
+        }
+    }
+};
+
+/**
+ * Least squares or minimum norm solution of op(A) * X = B, as in gels. The
+ * QR factorization of A, or of A^T when m < n (the LQ factorization of A), is
+ * computed as in geqr2, and each right-hand side is then updated with the
+ * Householder reflectors, as in ormqr, and solved with the triangular factor,
+ * as in trtrs, without leaving the private arrays.
+ */
+template <typename T, int N, typename Layout, typename AccA, typename AccB>
+struct small_gels_kernel {
+    AccA a;
+    AccB b;
+    std::int64_t *info;
+    Layout layout_a, layout_b;
+    bool trans;
+    std::int64_t m, n, nrhs;
+
+    void operator()(sycl::id<1> id) const {
+        // x[j][i] holds element (i, j) of A, or of A^T when m < n, so that the
+        // factored mr x nr matrix always has mr >= nr.
+        const bool lq = m < n;
+        const std::int64_t mr = lq ? n : m, nr = lq ? m : n;
+        const std::int64_t rows_b = trans ? n : m;
+        T x[N][N];
+        bool zero = true;
+        for (int j = 0; j < N; ++j) {
+            for (int i = 0; i < N; ++i) {
+                x[j][i] = T(0);
+                if (i < mr && j < nr) {
+                    x[j][i] = lq ? a[layout_a(id[0], j, i)] : a[layout_a(id[0], i, j)];
+                    zero = zero && x[j][i] == T(0);
+                }
+            }
+        }
+        info[id[0]] = 0;
+        if (nrhs == 0)
+            return;
+        if (zero) {
+            for (std::int64_t r = 0; r < nrhs; ++r) {
+                for (int i = 0; i < N && i < mr; ++i)
+                    b[layout_b(id[0], i, r)] = T(0);
+            }
+            return;
+        }
+
+        // Householder reflectors H(k) = I - tau[k] * v * v^T, with v(k) = 1 and
+        // v(k+1:) stored below the diagonal, as in larfg.
+        T tau[N];
+        std::int64_t status = 0;
+        for (int k = 0; k < N; ++k) {
+            tau[k] = T(0);
+            if (k >= nr)
+                continue;
+            T scale = T(0);
+            for (int i = k + 1; i < N; ++i)
+                scale = sycl::fmax(scale, sycl::fabs(x[k][i]));
+            if (scale != T(0)) {
+                const T alpha = x[k][k];
+                scale = sycl::fmax(scale, sycl::fabs(alpha));
+                T ssq = T(0);
+                for (int i = k; i < N; ++i)
+                    ssq += (x[k][i] / scale) * (x[k][i] / scale);
+                const T beta = -sycl::copysign(scale * sycl::sqrt(ssq), alpha);
+                tau[k] = (beta - alpha) / beta;
+                const T r = T(1) / (alpha - beta);
+                for (int i = k + 1; i < N; ++i)
+                    x[k][i] *= r;
+                x[k][k] = beta;
+                for (int j = k + 1; j < N; ++j) {
+                    T w = x[j][k];
+                    for (int i = k + 1; i < N; ++i)
+                        w += x[k][i] * x[j][i];
+                    w *= tau[k];
+                    x[j][k] -= w;
+                    for (int i = k + 1; i < N; ++i)
+                        x[j][i] -= w * x[k][i];
+                }
+            }
+            if (x[k][k] == T(0) && status == 0)
+                status = k + 1;
+        }
+        for (int j = 0; j < N && j < nr; ++j) {
+            for (int i = 0; i < N && i < mr; ++i) {
+                if (lq)
+                    a[layout_a(id[0], j, i)] = x[j][i];
+                else
+                    a[layout_a(id[0], i, j)] = x[j][i];
+            }
+        }
+        if (status != 0) {
+            info[id[0]] = status;
+            return;
+        }
+
+        // Least squares problem with the factored matrix, or minimum norm
+        // problem with its transpose.
+        const bool least_squares = lq == trans;
+        for (std::int64_t r = 0; r < nrhs; ++r) {
+            T y[N];
+            for (int i = 0; i < N; ++i)
+                y[i] = i < rows_b ? b[layout_b(id[0], i, r)] : T(0);
+            if (least_squares) {
+                for (int k = 0; k < N && k < nr; ++k) {
+                    T w = y[k];
+                    for (int i = k + 1; i < N; ++i)
+                        w += x[k][i] * y[i];
+                    w *= tau[k];
+                    y[k] -= w;
+                    for (int i = k + 1; i < N; ++i)
+                        y[i] -= w * x[k][i];
+                }
+                for (int j = N - 1; j >= 0; --j) {
+                    if (j < nr) {
+                        y[j] /= x[j][j];
+                        for (int i = 0; i < j; ++i)
+                            y[i] -= x[j][i] * y[j];
+                    }
+                }
+            }
+            else {
+                for (int j = 0; j < N && j < nr; ++j) {
+                    for (int i = 0; i < j; ++i)
+                        y[j] -= x[j][i] * y[i];
+                    y[j] /= x[j][j];
+                }
+                for (int k = N - 1; k >= 0; --k) {
+                    if (k < nr) {
+                        T w = y[k];
+                        for (int i = k + 1; i < N; ++i)
+                            w += x[k][i] * y[i];
+                        w *= tau[k];
+                        y[k] -= w;
+                        for (int i = k + 1; i < N; ++i)
+                            y[i] -= w * x[k][i];
+                    }
+                }
+            }
+            for (int i = 0; i < N && i < mr; ++i)
+                b[layout_b(id[0], i, r)] = y[i];
+        }
+    }
+};
+
+/**
+ * Owns the USM array the small-matrix kernels write their info values to,
+ * until small_batch_check hands it over to the host task that frees it. The
+ * array is released if a submission throws before that.
+ */
+class small_batch_info {
+public:
+    small_batch_info(sycl::queue &queue, std::int64_t batch_size)
+            : context_(queue.get_context()),
+              info_(sycl::malloc_shared<std::int64_t>(batch_size, queue)) {}
+
+    small_batch_info(const small_batch_info &) = delete;
+    small_batch_info &operator=(const small_batch_info &) = delete;
+
+    ~small_batch_info() {
+        if (info_)
+            sycl::free(info_, context_);
+    }
+
+    std::int64_t *get() const {
+        return info_;
+    }
+
+    void release() {
+        info_ = nullptr;
+    }
+
+private:
+    sycl::context context_;
+    std::int64_t *info_;
+};
+
+/**
+ * Reports the info values written by a small-matrix kernel as a batch_error,
+ * and releases the info array.
+ */
+inline sycl::event small_batch_check(sycl::queue &queue, sycl::event kernel_done,
+                                     const char *func_name, const char *routine_name,
+                                     small_batch_info &info, std::int64_t batch_size) {
+    auto context = queue.get_context();
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(kernel_done);
+        cgh.host_task([=, info = info.get()]() {
+            batch_info status(func_name, routine_name, batch_size);
+            for (std::int64_t id = 0; id < batch_size; ++id)
+                status.set(id, info[id]);
+            sycl::free(info, context);
+            status.check();
+        });
+    });
+    info.release();
+    return done;
+}
+
+// SUBMISSION HELPERS
+
+// Accessors for the buffer API, USM pointers otherwise.
+template <typename T>
+inline T *small_batch_ptr(T *ptr, sycl::handler &) {
+    return ptr;
+}
+
+template <typename T, sycl::access::mode Mode = sycl::access::mode::read_write>
+inline auto small_batch_ptr(sycl::buffer<T> &buf, sycl::handler &cgh) {
+    return buf.template get_access<Mode>(cgh);
+}
+
+template <typename T, typename Layout, typename A, typename B>
+inline sycl::event small_gels(sycl::queue &queue, const char *func_name,
+                              oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                              std::int64_t nrhs, A &&a, Layout layout_a, B &&b, Layout layout_b,
+                              std::int64_t batch_size,
+                              const std::vector<sycl::event> &dependencies) {
+    small_batch_info info(queue, batch_size);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto b_acc = small_batch_ptr(b, cgh);
+        const bool is_trans = trans != oneapi::mkl::transpose::nontrans;
+        dispatch_small_batch_bucket<T>(std::max(m, n), [&](auto nb) {
+            using kernel_t = small_gels_kernel<T, decltype(nb)::value, Layout, decltype(a_acc),
+                                               decltype(b_acc)>;
+            cgh.parallel_for(sycl::range<1>(batch_size),
+                             kernel_t{ a_acc, b_acc, info.get(), layout_a, layout_b, is_trans, m,
+                                       n, nrhs });
+        });
+    });
+    return small_batch_check(queue, done, func_name, "gels", info, batch_size);
+}
+
+template <typename T, typename Layout, typename A, typename Ipiv>
+inline sycl::event small_getrf(sycl::queue &queue, const char *func_name, std::int64_t m,
+                               std::int64_t n, A &&a, Layout layout, Ipiv &&ipiv,
+                               std::int64_t stride_ipiv, std::int64_t batch_size,
+                               const std::vector<sycl::event> &dependencies) {
+    small_batch_info info(queue, batch_size);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto ipiv_acc = small_batch_ptr(ipiv, cgh);
+        dispatch_small_batch_bucket<T>(std::max(m, n), [&](auto nb) {
+            using kernel_t = small_getrf_kernel<T, decltype(nb)::value, Layout, decltype(a_acc),
+                                                decltype(ipiv_acc)>;
+            cgh.parallel_for(sycl::range<1>(batch_size),
+                             kernel_t{ a_acc, ipiv_acc, info.get(), layout, m, n, stride_ipiv });
+        });
+    });
+    return small_batch_check(queue, done, func_name, "getrf", info, batch_size);
+}
+
+template <typename T, typename Layout, typename A, typename Ipiv, typename B>
+inline sycl::event small_getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                               std::int64_t nrhs, A &&a, Layout layout_a, Ipiv &&ipiv,
+                               std::int64_t stride_ipiv, B &&b, Layout layout_b,
+                               std::int64_t batch_size,
+                               const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto ipiv_acc = small_batch_ptr(ipiv, cgh);
+        auto b_acc = small_batch_ptr(b, cgh);
+        const bool is_trans = trans != oneapi::mkl::transpose::nontrans;
+        dispatch_small_batch_bucket<T>(n, [&](auto nb) {
+            using kernel_t = small_getrs_kernel<T, decltype(nb)::value, Layout, decltype(a_acc),
+                                                decltype(ipiv_acc), decltype(b_acc)>;
+            cgh.parallel_for(sycl::range<1>(batch_size),
+                             kernel_t{ a_acc, ipiv_acc, b_acc, layout_a, layout_b, is_trans, n,
+                                       nrhs, stride_ipiv });
+        });
+    });
+}
+
+template <typename T, typename Layout, typename A>
+inline sycl::event small_potrf(sycl::queue &queue, const char *func_name, oneapi::mkl::uplo uplo,
+                               std::int64_t n, A &&a, Layout layout, std::int64_t batch_size,
+                               const std::vector<sycl::event> &dependencies) {
+    small_batch_info info(queue, batch_size);
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        const bool upper = uplo == oneapi::mkl::uplo::upper;
+        dispatch_small_batch_bucket<T>(n, [&](auto nb) {
+            using kernel_t = small_potrf_kernel<T, decltype(nb)::value, Layout, decltype(a_acc)>;
+            cgh.parallel_for(sycl::range<1>(batch_size),
+                             kernel_t{ a_acc, info.get(), layout, upper, n });
+        });
+    });
+    return small_batch_check(queue, done, func_name, "potrf", info, batch_size);
+}
+
+template <typename T, typename Layout, typename A, typename B>
+inline sycl::event small_potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, A &&a, Layout layout_a, B &&b, Layout layout_b,
+                               std::int64_t batch_size,
+                               const std::vector<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dependencies);
+        auto a_acc = small_batch_ptr(a, cgh);
+        auto b_acc = small_batch_ptr(b, cgh);
+        const bool upper = uplo == oneapi::mkl::uplo::upper;
+        dispatch_small_batch_bucket<T>(n, [&](auto nb) {
+            using kernel_t = small_potrs_kernel<T, decltype(nb)::value, Layout, decltype(a_acc),
+                                                decltype(b_acc)>;
+            cgh.parallel_for(sycl::range<1>(batch_size),
+                             kernel_t{ a_acc, b_acc, layout_a, layout_b, upper, n, nrhs });
+        });
+    });
+}
+
+// Strided batches.
+
+template <typename T, typename A, typename B>
+inline sycl::event small_gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                    std::int64_t m, std::int64_t n, std::int64_t nrhs, A &&a,
+                                    std::int64_t lda, std::int64_t stride_a, B &&b,
+                                    std::int64_t ldb, std::int64_t stride_b,
+                                    std::int64_t batch_size,
+                                    const std::vector<sycl::event> &dependencies = {}) {
+    return small_gels<T>(queue, "gels_batch", trans, m, n, nrhs, a,
+                         strided_batch_layout{ lda, stride_a }, b,
+                         strided_batch_layout{ ldb, stride_b }, batch_size, dependencies);
+}
+
+template <typename T, typename A, typename Ipiv>
+inline sycl::event small_getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, A &&a,
+                                     std::int64_t lda, std::int64_t stride_a, Ipiv &&ipiv,
+                                     std::int64_t stride_ipiv, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    return small_getrf<T>(queue, "getrf_batch", m, n, a, strided_batch_layout{ lda, stride_a },
+                          ipiv, stride_ipiv, batch_size, dependencies);
+}
+
+template <typename T, typename A, typename Ipiv, typename B>
+inline sycl::event small_getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                     std::int64_t n, std::int64_t nrhs, A &&a, std::int64_t lda,
+                                     std::int64_t stride_a, Ipiv &&ipiv, std::int64_t stride_ipiv,
+                                     B &&b, std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    return small_getrs<T>(queue, trans, n, nrhs, a, strided_batch_layout{ lda, stride_a }, ipiv,
+                          stride_ipiv, b, strided_batch_layout{ ldb, stride_b }, batch_size,
+                          dependencies);
+}
+
+template <typename T, typename A>
+inline sycl::event small_potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     A &&a, std::int64_t lda, std::int64_t stride_a,
+                                     std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    return small_potrf<T>(queue, "potrf_batch", uplo, n, a, strided_batch_layout{ lda, stride_a },
+                          batch_size, dependencies);
+}
+
+template <typename T, typename A, typename B>
+inline sycl::event small_potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, A &&a, std::int64_t lda,
+                                     std::int64_t stride_a, B &&b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     const std::vector<sycl::event> &dependencies = {}) {
+    return small_potrs<T>(queue, uplo, n, nrhs, a, strided_batch_layout{ lda, stride_a }, b,
+                          strided_batch_layout{ ldb, stride_b }, batch_size, dependencies);
+}
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_SMALL_BATCH_HPP_
@@ -0,0 +1,316 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_TSQR_HPP_
+#define _NETLIB_LAPACK_TSQR_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "netlib_helper.hpp"
+#include "netlib_host.hpp"
+#include "host_parallel_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+/**
+ * Tall-skinny QR factorization (TSQR).
+ *
+ * geqrf factors a matrix one panel at a time, and every panel sweeps all m rows
+ * column by column, so for m >> n the factorization is bound by memory latency
+ * and runs on a single thread. geqrf_tsqr instead splits the rows into blocks
+ * of tsqr_block_rows(n) to 2 * tsqr_block_rows(n) rows and factors the blocks
+ * with geqrf on the host threads. The R factors of the blocks are stacked and
+ * factored the same way, level after level, until the stacked matrix is a
+ * single block.
+ *
+ * The tree of reflectors is then turned back into the representation of geqrf
+ * (Householder reconstruction, Ballard et al.): the LU factorization without
+ * pivoting Q - [S; 0] = [L1; L2] U of the m x n factor Q, with the signs S
+ * chosen so that every pivot is at least 1 in magnitude, gives the reflectors
+ * V = [L1; L2], tau_k = -U_kk / S_kk and the triangular factor S R. a and tau
+ * can thus be passed to ormqr, orgqr, unmqr and ungqr as if they had been
+ * computed by geqrf. Q is only formed explicitly for the stacked levels; the
+ * rows of Q at level 0 are formed one row block at a time, right before they
+ * are turned into rows of L2.
+ *
+ * The blocks only depend on m and n, so the result does not depend on the
+ * number of threads.
+ */
+constexpr std::int64_t tsqr_min_block_rows = 4096;
+
+inline std::int64_t tsqr_block_rows(std::int64_t n) {
+    return std::max(tsqr_min_block_rows, 4 * n);
+}
+
+// Invalid arguments and matrices that do not split into at least two blocks
+// are left to geqrf.
+inline bool use_tsqr(std::int64_t m, std::int64_t n, std::int64_t lda) {
+    return n > 0 && lda >= m && m >= 2 * tsqr_block_rows(n);
+}
+
+// First row of block b of a level with the given rows split into blocks.
+inline std::int64_t tsqr_block_begin(std::int64_t rows, std::int64_t blocks, std::int64_t b) {
+    return b * rows / blocks;
+}
+
+/**
+ * Layout of the tree in the scratchpad. Level 0 factors A, level l > 0 factors
+ * the R factors of the blocks of level l - 1 stacked on top of each other, and
+ * the last level is a single block. The blocks of a level are processed
+ * `slots` at a time, each with its own work array and, at level 0, its own
+ * block of Q. Offsets are in elements of T.
+ */
+struct tsqr_plan {
+    std::vector<std::int64_t> rows;   // rows of the matrix of every level
+    std::vector<std::int64_t> blocks; // row blocks of every level
+    std::vector<std::int64_t> tau;    // tau arrays of the blocks, n elements per block
+    std::vector<std::int64_t> mat;    // stacked matrices of the levels l > 0
+    std::vector<std::int64_t> q;      // explicit Q factors of the levels l > 0, rows[l] x n
+    std::int64_t slots;               // blocks processed at the same time
+    std::int64_t ldq;                 // rows of the level 0 blocks of Q
+    std::int64_t q0;                  // level 0 blocks of Q, ldq x n per slot
+    std::int64_t top;                 // LU factors of the top n x n block of Q - [S; 0]
+    std::int64_t work;                // work arrays, lwork elements per slot
+    std::int64_t lwork;
+    std::int64_t size;
+
+    tsqr_plan(std::int64_t m, std::int64_t n, std::int64_t lwork) : lwork(lwork) {
+        const std::int64_t block_rows = tsqr_block_rows(n);
+        for (std::int64_t r = m;; r = blocks.back() * n) {
+            rows.push_back(r);
+            blocks.push_back(r >= 2 * block_rows ? r / block_rows : 1);
+            if (blocks.back() == 1)
+                break;
+        }
+        slots = std::min(blocks[0], host::host_num_threads());
+        ldq = 2 * block_rows;
+        std::int64_t offset = 0;
+        for (std::size_t l = 0; l < rows.size(); ++l) {
+            tau.push_back(offset);
+            offset += blocks[l] * n;
+        }
+        for (std::size_t l = 0; l < rows.size(); ++l) {
+            mat.push_back(offset);
+            offset += l > 0 ? rows[l] * n : 0;
+        }
+        for (std::size_t l = 0; l < rows.size(); ++l) {
+            q.push_back(offset);
+            offset += l > 0 ? rows[l] * n : 0;
+        }
+        q0 = offset;
+        offset += slots * ldq * n;
+        top = offset;
+        offset += n * n;
+        work = offset;
+        size = offset + slots * lwork;
+    }
+
+    std::int64_t levels() const {
+        return static_cast<std::int64_t>(rows.size());
+    }
+};
+
+// Calls f(b, slot) for the blocks in [first, blocks), plan.slots blocks at a
+// time, so that the blocks running at the same time use different slots.
+template <typename F>
+inline void tsqr_for_blocks(const tsqr_plan &plan, std::int64_t first, std::int64_t blocks, F f) {
+    for (std::int64_t chunk = first; chunk < blocks; chunk += plan.slots) {
+        host::host_parallel_for(std::min(plan.slots, blocks - chunk),
+                                [&](std::int64_t slot) { f(chunk + slot, slot); });
+    }
+}
+
+// Work array of one block, large enough for geqrf and ormqr on any block.
+template <typename T, typename Geqrf, typename Ormqr>
+inline std::int64_t tsqr_lwork(const char *geqrf_name, Geqrf geqrf, const char *ormqr_name,
+                               Ormqr ormqr, std::int64_t n) {
+    const std::int64_t rows = 2 * tsqr_block_rows(n);
+    const std::int64_t geqrf_lwork = lapacke_query<T>("geqrf_tsqr", geqrf_name, [&](T *work) {
+        return host_geqrf<T>(geqrf, rows, n, nullptr, rows, nullptr, work, -1);
+    });
+    const std::int64_t ormqr_lwork = lapacke_query<T>("geqrf_tsqr", ormqr_name, [&](T *work) {
+        return host_ormqr<T>(ormqr, oneapi::mkl::side::left, oneapi::mkl::transpose::nontrans,
+                             rows, n, n, nullptr, rows, nullptr, nullptr, rows, work, -1);
+    });
+    return std::max({ geqrf_lwork, ormqr_lwork, n });
+}
+
+template <typename T, typename Geqrf, typename Ormqr>
+inline std::int64_t host_geqrf_tsqr_scratchpad_size(const char *geqrf_name, Geqrf geqrf,
+                                                    const char *ormqr_name, Ormqr ormqr,
+                                                    std::int64_t m, std::int64_t n,
+                                                    std::int64_t lda) {
+    if (!use_tsqr(m, n, lda)) {
+        return lapacke_query<T>("geqrf_tsqr", geqrf_name, [&](T *work) {
+            return host_geqrf<T>(geqrf, m, n, nullptr, lda, nullptr, work, -1);
+        });
+    }
+    return tsqr_plan(m, n, tsqr_lwork<T>(geqrf_name, geqrf, ormqr_name, ormqr, n)).size;
+}
+
+// Reports the first failure of the blocks of a level.
+inline void tsqr_info_check(const char *lapacke_name, const std::vector<lapack_int> &info) {
+    for (auto block_info : info)
+        lapacke_info_check("geqrf_tsqr", lapacke_name, block_info);
+}
+
+template <typename T, typename Geqrf, typename Ormqr>
+inline void host_geqrf_tsqr(const char *geqrf_name, Geqrf geqrf, const char *ormqr_name,
+                            Ormqr ormqr, std::int64_t m, std::int64_t n, T *a, std::int64_t lda,
+                            T *tau, T *scratchpad, std::int64_t scratchpad_size) {
+    if (!use_tsqr(m, n, lda)) {
+        auto info = host_geqrf<T>(geqrf, m, n, a, lda, tau, scratchpad, scratchpad_size);
+        lapacke_info_check("geqrf_tsqr", geqrf_name, info);
+        return;
+    }
+    const tsqr_plan plan(m, n, tsqr_lwork<T>(geqrf_name, geqrf, ormqr_name, ormqr, n));
+    const std::int64_t levels = plan.levels(), lwork = plan.lwork, ldq = plan.ldq;
+    auto mat = [&](std::int64_t l) { return l == 0 ? a : scratchpad + plan.mat[l]; };
+    auto ld = [&](std::int64_t l) { return l == 0 ? lda : plan.rows[l]; };
+    auto work = [&](std::int64_t slot) { return scratchpad + plan.work + slot * lwork; };
+
+    // Factor the blocks of every level and stack their R factors for the next.
+    for (std::int64_t l = 0; l < levels; ++l) {
+        const std::int64_t rows = plan.rows[l], blocks = plan.blocks[l];
+        std::vector<lapack_int> info(blocks, 0);
+        tsqr_for_blocks(plan, 0, blocks, [&](std::int64_t b, std::int64_t slot) {
+            const std::int64_t begin = tsqr_block_begin(rows, blocks, b),
+                               end = tsqr_block_begin(rows, blocks, b + 1);
+            T *block = mat(l) + begin;
+            info[b] = host_geqrf<T>(geqrf, end - begin, n, block, ld(l),
+                                    scratchpad + plan.tau[l] + b * n, work(slot), lwork);
+            if (l + 1 == levels)
+                return;
+            T *r = mat(l + 1) + b * n;
+            for (std::int64_t j = 0; j < n; ++j) {
+                for (std::int64_t i = 0; i < n; ++i)
+                    r[i + j * ld(l + 1)] = i <= j ? block[i + j * ld(l)] : T(0);
+            }
+        });
+        tsqr_info_check(geqrf_name, info);
+    }
+
+    // Rows begin to end of the explicit Q factor of level l, written to q with
+    // leading dimension ldc. They are Q_b [Q_{l + 1}(b * n : b * n + n, :); 0].
+    auto form_q = [&](std::int64_t l, std::int64_t b, T *q, std::int64_t ldc,
+                      std::int64_t slot) {
+        const std::int64_t rows = plan.rows[l], blocks = plan.blocks[l];
+        const std::int64_t begin = tsqr_block_begin(rows, blocks, b),
+                           end = tsqr_block_begin(rows, blocks, b + 1);
+        for (std::int64_t j = 0; j < n; ++j) {
+            for (std::int64_t k = 0; k < end - begin; ++k) {
+                if (k >= n)
+                    q[k + j * ldc] = T(0);
+                else if (l + 1 == levels)
+                    q[k + j * ldc] = k == j ? T(1) : T(0);
+                else
+                    q[k + j * ldc] = scratchpad[plan.q[l + 1] + b * n + k + j * plan.rows[l + 1]];
+            }
+        }
+        return host_ormqr<T>(ormqr, oneapi::mkl::side::left, oneapi::mkl::transpose::nontrans,
+                             end - begin, n, n, mat(l) + begin, ld(l),
+                             scratchpad + plan.tau[l] + b * n, q, ldc, work(slot), lwork);
+    };
+
+    // Form the explicit Q factor of the stacked levels, from the last level down.
+    for (std::int64_t l = levels - 1; l > 0; --l) {
+        const std::int64_t rows = plan.rows[l], blocks = plan.blocks[l];
+        std::vector<lapack_int> info(blocks, 0);
+        tsqr_for_blocks(plan, 0, blocks, [&](std::int64_t b, std::int64_t slot) {
+            T *q = scratchpad + plan.q[l] + tsqr_block_begin(rows, blocks, b);
+            info[b] = form_q(l, b, q, rows, slot);
+        });
+        tsqr_info_check(ormqr_name, info);
+    }
+
+    // LU factorization without pivoting of Q - [S; 0]. The top n x n block
+    // comes from the first block of level 0.
+    const std::int64_t blocks = plan.blocks[0];
+    std::vector<lapack_int> info(blocks, 0);
+    info[0] = form_q(0, 0, scratchpad + plan.q0, ldq, 0);
+    tsqr_info_check(ormqr_name, info);
+    T *u = scratchpad + plan.top;
+    for (std::int64_t j = 0; j < n; ++j) {
+        for (std::int64_t i = 0; i < n; ++i)
+            u[i + j * n] = scratchpad[plan.q0 + i + j * ldq];
+    }
+    std::vector<T> s(n);
+    for (std::int64_t k = 0; k < n; ++k) {
+        T &pivot = u[k + k * n];
+        const real_t<T> abs_pivot = std::abs(pivot);
+        s[k] = abs_pivot == real_t<T>(0) ? T(-1) : -pivot / abs_pivot;
+        pivot -= s[k];
+        for (std::int64_t i = k + 1; i < n; ++i)
+            u[i + k * n] /= pivot;
+        for (std::int64_t j = k + 1; j < n; ++j) {
+            for (std::int64_t i = k + 1; i < n; ++i)
+                u[i + j * n] -= u[i + k * n] * u[k + j * n];
+        }
+    }
+
+    // The rows below are L2 = Q2 U^{-1}. Every block of Q is formed in its
+    // slot and turned into rows of L2 straight in a, which overwrites the
+    // reflectors of the block once they are no longer needed.
+    auto write_l2 = [&](std::int64_t b, const T *q) {
+        const std::int64_t block_begin = tsqr_block_begin(m, blocks, b),
+                           begin = std::max(n, block_begin),
+                           end = tsqr_block_begin(m, blocks, b + 1);
+        for (std::int64_t j = 0; j < n; ++j) {
+            for (std::int64_t i = begin; i < end; ++i)
+                a[i + j * lda] = q[i - block_begin + j * ldq];
+            for (std::int64_t k = 0; k < j; ++k) {
+                const T u_kj = u[k + j * n];
+                for (std::int64_t i = begin; i < end; ++i)
+                    a[i + j * lda] -= a[i + k * lda] * u_kj;
+            }
+            for (std::int64_t i = begin; i < end; ++i)
+                a[i + j * lda] /= u[j + j * n];
+        }
+    };
+    write_l2(0, scratchpad + plan.q0);
+    tsqr_for_blocks(plan, 1, blocks, [&](std::int64_t b, std::int64_t slot) {
+        T *q = scratchpad + plan.q0 + slot * ldq * n;
+        info[b] = form_q(0, b, q, ldq, slot);
+        if (info[b] == 0)
+            write_l2(b, q);
+    });
+    tsqr_info_check(ormqr_name, info);
+
+    // The top block of a holds L1 below the diagonal and S R on and above it,
+    // where R is the factor of the last level.
+    const T *r = mat(levels - 1);
+    for (std::int64_t j = 0; j < n; ++j) {
+        for (std::int64_t i = 0; i < n; ++i)
+            a[i + j * lda] = i <= j ? s[i] * r[i + j * ld(levels - 1)] : u[i + j * n];
+        tau[j] = -u[j + j * n] / s[j];
+    }
+}
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_TSQR_HPP_
@@ -1060,6 +1060,933 @@ std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(sycl::queue &queu
     throw unimplemented("lapack", "ungqr_batch_scratchpad_size");
 }
 
+void pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                  std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &ap,
+                  std::int64_t ldap, std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "pack_compact");
+}
+void pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+                  std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &ap,
+                  std::int64_t ldap, std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "pack_compact");
+}
+sycl::event pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                         std::int64_t lda, std::int64_t stride_a, float *ap, std::int64_t ldap,
+                         std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "pack_compact");
+}
+sycl::event pack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                         std::int64_t lda, std::int64_t stride_a, double *ap, std::int64_t ldap,
+                         std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "pack_compact");
+}
+void unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &ap,
+                    std::int64_t ldap, sycl::buffer<float> &a, std::int64_t lda,
+                    std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "unpack_compact");
+}
+void unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &ap,
+                    std::int64_t ldap, sycl::buffer<double> &a, std::int64_t lda,
+                    std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "unpack_compact");
+}
+sycl::event unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, float *ap,
+                           std::int64_t ldap, float *a, std::int64_t lda, std::int64_t stride_a,
+                           std::int64_t interleave, std::int64_t batch_size,
+                           const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "unpack_compact");
+}
+sycl::event unpack_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, double *ap,
+                           std::int64_t ldap, double *a, std::int64_t lda, std::int64_t stride_a,
+                           std::int64_t interleave, std::int64_t batch_size,
+                           const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "unpack_compact");
+}
+void getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                   std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "getrf_compact");
+}
+void getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+                   std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "getrf_compact");
+}
+sycl::event getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                          std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                          std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "getrf_compact");
+}
+sycl::event getrf_compact(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                          std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                          std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "getrf_compact");
+}
+void getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                   std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                   sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   sycl::buffer<float> &b, std::int64_t ldb, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    throw unimplemented("lapack", "getrs_compact");
+}
+void getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                   std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                   sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   sycl::buffer<double> &b, std::int64_t ldb, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    throw unimplemented("lapack", "getrs_compact");
+}
+sycl::event getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                          std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                          std::int64_t stride_ipiv, float *b, std::int64_t ldb,
+                          std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "getrs_compact");
+}
+sycl::event getrs_compact(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                          std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                          std::int64_t stride_ipiv, double *b, std::int64_t ldb,
+                          std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "getrs_compact");
+}
+void potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                   sycl::buffer<float> &a, std::int64_t lda, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    throw unimplemented("lapack", "potrf_compact");
+}
+void potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                   sycl::buffer<double> &a, std::int64_t lda, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    throw unimplemented("lapack", "potrf_compact");
+}
+sycl::event potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                          std::int64_t lda, std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "potrf_compact");
+}
+sycl::event potrf_compact(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                          std::int64_t lda, std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "potrf_compact");
+}
+void trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                  std::int64_t n, float alpha, sycl::buffer<float> &a, std::int64_t lda,
+                  sycl::buffer<float> &b, std::int64_t ldb, std::int64_t interleave,
+                  std::int64_t batch_size) {
+    throw unimplemented("lapack", "trsm_compact");
+}
+void trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                  std::int64_t n, double alpha, sycl::buffer<double> &a, std::int64_t lda,
+                  sycl::buffer<double> &b, std::int64_t ldb, std::int64_t interleave,
+                  std::int64_t batch_size) {
+    throw unimplemented("lapack", "trsm_compact");
+}
+sycl::event trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                         oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                         std::int64_t n, float alpha, float *a, std::int64_t lda, float *b,
+                         std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "trsm_compact");
+}
+sycl::event trsm_compact(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                         oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                         std::int64_t n, double alpha, double *a, std::int64_t lda, double *b,
+                         std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "trsm_compact");
+}
+void gemm_compact(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                  sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+                  std::int64_t ldb, float beta, sycl::buffer<float> &c, std::int64_t ldc,
+                  std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gemm_compact");
+}
+void gemm_compact(sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                  std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                  sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                  std::int64_t ldb, double beta, sycl::buffer<double> &c, std::int64_t ldc,
+                  std::int64_t interleave, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gemm_compact");
+}
+sycl::event gemm_compact(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, float *a, std::int64_t lda,
+    float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gemm_compact");
+}
+sycl::event gemm_compact(
+    sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, double *a, std::int64_t lda,
+    double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gemm_compact");
+}
+
+void gesv_mixed_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                      sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                      sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                      sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                      sycl::buffer<double> &x, std::int64_t ldx, std::int64_t stride_x,
+                      sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+                      sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+void gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+    std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+    std::int64_t stride_ipiv, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+    std::int64_t stride_b, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+    std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+    std::int64_t ldb, std::int64_t stride_b, double *x, std::int64_t ldx, std::int64_t stride_x,
+    std::int64_t *iter, std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<double> *x,
+    std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<double>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gesv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gesv_mixed_batch_scratchpad_size");
+}
+void posv_mixed_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                      sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                      sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                      sycl::buffer<double> &x, std::int64_t ldx, std::int64_t stride_x,
+                      sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+                      sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+void posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+    sycl::buffer<std::complex<double>> &x, std::int64_t ldx, std::int64_t stride_x,
+    sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+    double *x, std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+sycl::event posv_mixed_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                             std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                             std::int64_t stride_b, std::complex<double> *x, std::int64_t ldx,
+                             std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+                             std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                             const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    throw unimplemented("lapack", "posv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t batch_size) {
+    throw unimplemented("lapack", "posv_mixed_batch_scratchpad_size");
+}
+sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda,
+    std::int64_t **ipiv, double **b, std::int64_t *ldb, double **x, std::int64_t *ldx,
+    std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+sycl::event gesv_mixed_batch(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a,
+    std::int64_t *lda, std::int64_t **ipiv, std::complex<double> **b, std::int64_t *ldb,
+    std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gesv_mixed_batch");
+}
+sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs, double **a,
+    std::int64_t *lda, double **b, std::int64_t *ldb, double **x, std::int64_t *ldx,
+    std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+sycl::event posv_mixed_batch(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+    std::complex<double> **a, std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
+    std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "posv_mixed_batch");
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<double>(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t *ldx, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gesv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t *ldx, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gesv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "posv_mixed_batch_scratchpad_size");
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "posv_mixed_batch_scratchpad_size");
+}
+
+void heevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                 std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il,
+                 std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+                 sycl::buffer<float> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<float>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+void heevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                 std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il,
+                 std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+                 sycl::buffer<double> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<double>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::int64_t stride_w, std::complex<double> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+sycl::event heevr_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+                        oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a,
+                        std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu,
+                        float *abstol, std::int64_t *m, float **w, std::complex<float> **z,
+                        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+sycl::event heevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double *vl, double *vu,
+    std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m, double **w,
+    std::complex<double> **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr_batch");
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevr_batch_scratchpad_size");
+}
+void heevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                 std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il,
+                 std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+                 sycl::buffer<float> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<float>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+void heevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                 std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il,
+                 std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+                 sycl::buffer<double> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<double>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float vl,
+    float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+    std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double vl,
+    double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+    std::int64_t stride_w, std::complex<double> *z, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+sycl::event heevx_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+                        oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a,
+                        std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu,
+                        float *abstol, std::int64_t *m, float **w, std::complex<float> **z,
+                        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+sycl::event heevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double *vl, double *vu,
+    std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m, double **w,
+    std::complex<double> **z, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx_batch");
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevx_batch_scratchpad_size");
+}
+void syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                 std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+                 float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                 std::int64_t stride_w, sycl::buffer<float> &z, std::int64_t ldz,
+                 std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+void syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                 std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+                 double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                 std::int64_t stride_w, sycl::buffer<double> &z, std::int64_t ldz,
+                 std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+sycl::event syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                        std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, std::int64_t *m, float *w, std::int64_t stride_w, float *z,
+                        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+sycl::event syevr_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                        std::int64_t stride_a, double vl, double vu, std::int64_t il,
+                        std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                        std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+sycl::event syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, float **a, std::int64_t *lda, float *vl, float *vu, std::int64_t *il,
+    std::int64_t *iu, float *abstol, std::int64_t *m, float **w, float **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+sycl::event syevr_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, double **a, std::int64_t *lda, double *vl, double *vu, std::int64_t *il,
+    std::int64_t *iu, double *abstol, std::int64_t *m, double **w, double **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr_batch");
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevr_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevr_batch_scratchpad_size");
+}
+void syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                 std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+                 float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                 std::int64_t stride_w, sycl::buffer<float> &z, std::int64_t ldz,
+                 std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+void syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                 std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+                 double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                 std::int64_t stride_w, sycl::buffer<double> &z, std::int64_t ldz,
+                 std::int64_t stride_z, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+sycl::event syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                        std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, std::int64_t *m, float *w, std::int64_t stride_w, float *z,
+                        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+sycl::event syevx_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                        std::int64_t stride_a, double vl, double vu, std::int64_t il,
+                        std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                        std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+sycl::event syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, float **a, std::int64_t *lda, float *vl, float *vu, std::int64_t *il,
+    std::int64_t *iu, float *abstol, std::int64_t *m, float **w, float **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+sycl::event syevx_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, double **a, std::int64_t *lda, double *vl, double *vu, std::int64_t *il,
+    std::int64_t *iu, double *abstol, std::int64_t *m, double **w, double **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx_batch");
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevx_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t *ldz, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevx_batch_scratchpad_size");
+}
+
+void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+                        std::int64_t *n, std::complex<float> **a, std::int64_t *lda, float **w,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+                        std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double **w,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevd_batch");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    throw unimplemented("lapack", "heevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "heevd_batch_scratchpad_size");
+}
+void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a, float *w,
+                        std::int64_t stride_w, std::int64_t batch_size, float *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
+                        double *w, std::int64_t stride_w, std::int64_t batch_size,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+sycl::event syevd_batch(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n, float **a,
+    std::int64_t *lda, float **w, std::int64_t group_count, std::int64_t *group_sizes,
+    float *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+                        std::int64_t *n, double **a, std::int64_t *lda, double **w,
+                        std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevd_batch");
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    throw unimplemented("lapack", "syevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevd_batch_scratchpad_size");
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "syevd_batch_scratchpad_size");
+}
+
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                       std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                       std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+                       std::int64_t *n, std::int64_t *nrhs, float **a, std::int64_t *lda, float **b,
+                       std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+                       float *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+                       std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda,
+                       double **b, std::int64_t *ldb, std::int64_t group_count,
+                       std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+                       std::int64_t *n, std::int64_t *nrhs, std::complex<float> **a,
+                       std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb,
+                       std::int64_t group_count, std::int64_t *group_sizes,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+                       std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a,
+                       std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
+                       std::int64_t group_count, std::int64_t *group_sizes,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+
 } // namespace rocsolver
 } // namespace lapack
 } // namespace mkl
@@ -423,6 +423,194 @@ extern "C" ONEMKL_EXPORT lapack_function_table_t mkl_lapack_table = {
     oneapi::mkl::lapack::rocsolver::potrs_batch_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::rocsolver::potrs_batch_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::rocsolver::ungqr_batch_scratchpad_size<std::complex<float>>,
-    oneapi::mkl::lapack::rocsolver::ungqr_batch_scratchpad_size<std::complex<double>>
+    oneapi::mkl::lapack::rocsolver::ungqr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::pack_compact,
+    oneapi::mkl::lapack::rocsolver::pack_compact,
+    oneapi::mkl::lapack::rocsolver::pack_compact,
+    oneapi::mkl::lapack::rocsolver::pack_compact,
+    oneapi::mkl::lapack::rocsolver::unpack_compact,
+    oneapi::mkl::lapack::rocsolver::unpack_compact,
+    oneapi::mkl::lapack::rocsolver::unpack_compact,
+    oneapi::mkl::lapack::rocsolver::unpack_compact,
+    oneapi::mkl::lapack::rocsolver::getrf_compact,
+    oneapi::mkl::lapack::rocsolver::getrf_compact,
+    oneapi::mkl::lapack::rocsolver::getrf_compact,
+    oneapi::mkl::lapack::rocsolver::getrf_compact,
+    oneapi::mkl::lapack::rocsolver::getrs_compact,
+    oneapi::mkl::lapack::rocsolver::getrs_compact,
+    oneapi::mkl::lapack::rocsolver::getrs_compact,
+    oneapi::mkl::lapack::rocsolver::getrs_compact,
+    oneapi::mkl::lapack::rocsolver::potrf_compact,
+    oneapi::mkl::lapack::rocsolver::potrf_compact,
+    oneapi::mkl::lapack::rocsolver::potrf_compact,
+    oneapi::mkl::lapack::rocsolver::potrf_compact,
+    oneapi::mkl::lapack::rocsolver::trsm_compact,
+    oneapi::mkl::lapack::rocsolver::trsm_compact,
+    oneapi::mkl::lapack::rocsolver::trsm_compact,
+    oneapi::mkl::lapack::rocsolver::trsm_compact,
+    oneapi::mkl::lapack::rocsolver::gemm_compact,
+    oneapi::mkl::lapack::rocsolver::gemm_compact,
+    oneapi::mkl::lapack::rocsolver::gemm_compact,
+    oneapi::mkl::lapack::rocsolver::gemm_compact,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::posv_mixed,
+    oneapi::mkl::lapack::rocsolver::posv_mixed,
+    oneapi::mkl::lapack::rocsolver::posv_mixed,
+    oneapi::mkl::lapack::rocsolver::posv_mixed,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::gesv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::posv_mixed_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::geqrf_tsqr_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::gesvd_randomized_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::heevr,
+    oneapi::mkl::lapack::rocsolver::heevr,
+    oneapi::mkl::lapack::rocsolver::heevr,
+    oneapi::mkl::lapack::rocsolver::heevr,
+    oneapi::mkl::lapack::rocsolver::heevr_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevr_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::heevx,
+    oneapi::mkl::lapack::rocsolver::heevx,
+    oneapi::mkl::lapack::rocsolver::heevx,
+    oneapi::mkl::lapack::rocsolver::heevx,
+    oneapi::mkl::lapack::rocsolver::heevx_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevx_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::syevr,
+    oneapi::mkl::lapack::rocsolver::syevr,
+    oneapi::mkl::lapack::rocsolver::syevr,
+    oneapi::mkl::lapack::rocsolver::syevr,
+    oneapi::mkl::lapack::rocsolver::syevr_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevr_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::syevx,
+    oneapi::mkl::lapack::rocsolver::syevx,
+    oneapi::mkl::lapack::rocsolver::syevx,
+    oneapi::mkl::lapack::rocsolver::syevx,
+    oneapi::mkl::lapack::rocsolver::syevx_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevx_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::heevr_batch,
+    oneapi::mkl::lapack::rocsolver::heevr_batch,
+    oneapi::mkl::lapack::rocsolver::heevr_batch,
+    oneapi::mkl::lapack::rocsolver::heevr_batch,
+    oneapi::mkl::lapack::rocsolver::heevr_batch,
+    oneapi::mkl::lapack::rocsolver::heevr_batch,
+    oneapi::mkl::lapack::rocsolver::heevr_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::heevr_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::heevx_batch,
+    oneapi::mkl::lapack::rocsolver::heevx_batch,
+    oneapi::mkl::lapack::rocsolver::heevx_batch,
+    oneapi::mkl::lapack::rocsolver::heevx_batch,
+    oneapi::mkl::lapack::rocsolver::heevx_batch,
+    oneapi::mkl::lapack::rocsolver::heevx_batch,
+    oneapi::mkl::lapack::rocsolver::heevx_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevx_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::heevx_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevx_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::syevr_batch,
+    oneapi::mkl::lapack::rocsolver::syevr_batch,
+    oneapi::mkl::lapack::rocsolver::syevr_batch,
+    oneapi::mkl::lapack::rocsolver::syevr_batch,
+    oneapi::mkl::lapack::rocsolver::syevr_batch,
+    oneapi::mkl::lapack::rocsolver::syevr_batch,
+    oneapi::mkl::lapack::rocsolver::syevr_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevr_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::syevr_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevr_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::syevx_batch,
+    oneapi::mkl::lapack::rocsolver::syevx_batch,
+    oneapi::mkl::lapack::rocsolver::syevx_batch,
+    oneapi::mkl::lapack::rocsolver::syevx_batch,
+    oneapi::mkl::lapack::rocsolver::syevx_batch,
+    oneapi::mkl::lapack::rocsolver::syevx_batch,
+    oneapi::mkl::lapack::rocsolver::syevx_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevx_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::syevx_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevx_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::heevd_batch,
+    oneapi::mkl::lapack::rocsolver::heevd_batch,
+    oneapi::mkl::lapack::rocsolver::heevd_batch,
+    oneapi::mkl::lapack::rocsolver::heevd_batch,
+    oneapi::mkl::lapack::rocsolver::heevd_batch,
+    oneapi::mkl::lapack::rocsolver::heevd_batch,
+    oneapi::mkl::lapack::rocsolver::heevd_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevd_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::heevd_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::heevd_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::syevd_batch,
+    oneapi::mkl::lapack::rocsolver::syevd_batch,
+    oneapi::mkl::lapack::rocsolver::syevd_batch,
+    oneapi::mkl::lapack::rocsolver::syevd_batch,
+    oneapi::mkl::lapack::rocsolver::syevd_batch,
+    oneapi::mkl::lapack::rocsolver::syevd_batch,
+    oneapi::mkl::lapack::rocsolver::syevd_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevd_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::syevd_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::syevd_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch,
+    oneapi::mkl::lapack::rocsolver::gels_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::gels_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::gels_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::gels_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::rocsolver::gels_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::rocsolver::gels_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::rocsolver::gels_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::rocsolver::gels_batch_scratchpad_size<std::complex<double>>
 #undef LAPACK_BACKEND
 };
@@ -1835,5 +1835,944 @@ typedef struct {
                                                       std::int64_t *n, std::int64_t *k,
                                                       std::int64_t *lda, std::int64_t group_count,
                                                       std::int64_t *group_sizes);
+    void (*spack_compact_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<float> &ap, std::int64_t ldap, std::int64_t interleave,
+                               std::int64_t batch_size);
+    void (*dpack_compact_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<double> &ap, std::int64_t ldap, std::int64_t interleave,
+                               std::int64_t batch_size);
+    sycl::event (*spack_compact_usm_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
+        std::int64_t stride_a, float *ap, std::int64_t ldap, std::int64_t interleave,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*dpack_compact_usm_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
+        std::int64_t stride_a, double *ap, std::int64_t ldap, std::int64_t interleave,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    void (*sunpack_compact_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 sycl::buffer<float> &ap, std::int64_t ldap, sycl::buffer<float> &a,
+                                 std::int64_t lda, std::int64_t stride_a, std::int64_t interleave,
+                                 std::int64_t batch_size);
+    void (*dunpack_compact_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                 sycl::buffer<double> &ap, std::int64_t ldap,
+                                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                                 std::int64_t interleave, std::int64_t batch_size);
+    sycl::event (*sunpack_compact_usm_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, float *ap, std::int64_t ldap, float *a,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dunpack_compact_usm_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, double *ap, std::int64_t ldap,
+        double *a, std::int64_t lda, std::int64_t stride_a, std::int64_t interleave,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    void (*sgetrf_compact_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                sycl::buffer<float> &a, std::int64_t lda,
+                                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                std::int64_t interleave, std::int64_t batch_size);
+    void (*dgetrf_compact_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                sycl::buffer<double> &a, std::int64_t lda,
+                                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                std::int64_t interleave, std::int64_t batch_size);
+    sycl::event (*sgetrf_compact_usm_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
+        std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t interleave,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*dgetrf_compact_usm_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
+        std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t interleave,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    void (*sgetrs_compact_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                                std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                sycl::buffer<float> &b, std::int64_t ldb, std::int64_t interleave,
+                                std::int64_t batch_size);
+    void (*dgetrs_compact_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                                std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                sycl::buffer<double> &b, std::int64_t ldb, std::int64_t interleave,
+                                std::int64_t batch_size);
+    sycl::event (*sgetrs_compact_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+        float *a, std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv, float *b,
+        std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dgetrs_compact_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+        double *a, std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+        std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    void (*spotrf_compact_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                sycl::buffer<float> &a, std::int64_t lda, std::int64_t interleave,
+                                std::int64_t batch_size);
+    void (*dpotrf_compact_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                sycl::buffer<double> &a, std::int64_t lda, std::int64_t interleave,
+                                std::int64_t batch_size);
+    sycl::event (*spotrf_compact_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, float *a, std::int64_t lda,
+                                           std::int64_t interleave, std::int64_t batch_size,
+                                           const std::vector<sycl::event> &dependencies);
+    sycl::event (*dpotrf_compact_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, double *a, std::int64_t lda,
+                                           std::int64_t interleave, std::int64_t batch_size,
+                                           const std::vector<sycl::event> &dependencies);
+    void (*strsm_compact_sycl)(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                               oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                               std::int64_t n, float alpha, sycl::buffer<float> &a,
+                               std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+                               std::int64_t interleave, std::int64_t batch_size);
+    void (*dtrsm_compact_sycl)(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                               oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m,
+                               std::int64_t n, double alpha, sycl::buffer<double> &a,
+                               std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                               std::int64_t interleave, std::int64_t batch_size);
+    sycl::event (*strsm_compact_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+        oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+        float alpha, float *a, std::int64_t lda, float *b, std::int64_t ldb,
+        std::int64_t interleave, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dtrsm_compact_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+        oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+        double alpha, double *a, std::int64_t lda, double *b, std::int64_t ldb,
+        std::int64_t interleave, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    void (*sgemm_compact_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float> &a,
+        std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb, float beta,
+        sycl::buffer<float> &c, std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size);
+    void (*dgemm_compact_sycl)(sycl::queue &queue, oneapi::mkl::transpose transa,
+                               oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n,
+                               std::int64_t k, double alpha, sycl::buffer<double> &a,
+                               std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                               double beta, sycl::buffer<double> &c, std::int64_t ldc,
+                               std::int64_t interleave, std::int64_t batch_size);
+    sycl::event (*sgemm_compact_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, float *a, std::int64_t lda,
+        float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc, std::int64_t interleave,
+        std::int64_t batch_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*dgemm_compact_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, double *a, std::int64_t lda,
+        double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+        std::int64_t interleave, std::int64_t batch_size,
+        const std::vector<sycl::event> &dependencies);
+    void (*dgesv_mixed_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                             sycl::buffer<double> &a, std::int64_t lda,
+                             sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                             std::int64_t ldb, sycl::buffer<double> &x, std::int64_t ldx,
+                             sycl::buffer<std::int64_t> &iter, sycl::buffer<double> &scratchpad,
+                             std::int64_t scratchpad_size);
+    void (*zgesv_mixed_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+        sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+        sycl::buffer<std::complex<double>> &x, std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*dgesv_mixed_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+        std::int64_t *ipiv, double *b, std::int64_t ldb, double *x, std::int64_t ldx,
+        std::int64_t *iter, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zgesv_mixed_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+        std::int64_t lda, std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+        std::complex<double> *x, std::int64_t ldx, std::int64_t *iter,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*dgesv_mixed_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t n,
+                                                     std::int64_t nrhs, std::int64_t lda,
+                                                     std::int64_t ldb, std::int64_t ldx);
+    std::int64_t (*zgesv_mixed_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t n,
+                                                     std::int64_t nrhs, std::int64_t lda,
+                                                     std::int64_t ldb, std::int64_t ldx);
+    void (*dposv_mixed_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                             sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &x,
+                             std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+                             sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*zposv_mixed_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+        sycl::buffer<std::complex<double>> &x, std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*dposv_mixed_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+        std::int64_t lda, double *b, std::int64_t ldb, double *x, std::int64_t ldx,
+        std::int64_t *iter, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zposv_mixed_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        std::complex<double> *a, std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+        std::complex<double> *x, std::int64_t ldx, std::int64_t *iter,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*dposv_mixed_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        std::int64_t lda, std::int64_t ldb, std::int64_t ldx);
+    std::int64_t (*zposv_mixed_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        std::int64_t lda, std::int64_t ldb, std::int64_t ldx);
+    void (*dgesv_mixed_batch_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                   sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                                   sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                                   sycl::buffer<double> &x, std::int64_t ldx, std::int64_t stride_x,
+                                   sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+                                   sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*zgesv_mixed_batch_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+        sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+        sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+        sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+        sycl::buffer<std::complex<double>> &x, std::int64_t ldx, std::int64_t stride_x,
+        sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*dgesv_mixed_batch_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+        std::int64_t ldb, std::int64_t stride_b, double *x, std::int64_t ldx, std::int64_t stride_x,
+        std::int64_t *iter, std::int64_t batch_size, double *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zgesv_mixed_batch_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+        std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<double> *x,
+        std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*dgesv_mixed_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+    std::int64_t (*zgesv_mixed_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+    void (*dposv_mixed_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b,
+        std::int64_t ldb, std::int64_t stride_b, sycl::buffer<double> &x, std::int64_t ldx,
+        std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*zposv_mixed_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+        sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+        sycl::buffer<std::complex<double>> &x, std::int64_t ldx, std::int64_t stride_x,
+        sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*dposv_mixed_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+        std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+        double *x, std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter,
+        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zposv_mixed_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, std::complex<double> *b,
+        std::int64_t ldb, std::int64_t stride_b, std::complex<double> *x, std::int64_t ldx,
+        std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*dposv_mixed_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+    std::int64_t (*zposv_mixed_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size);
+    sycl::event (*dgesv_mixed_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda,
+        std::int64_t **ipiv, double **b, std::int64_t *ldb, double **x, std::int64_t *ldx,
+        std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zgesv_mixed_group_usm_sycl)(
+        sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a,
+        std::int64_t *lda, std::int64_t **ipiv, std::complex<double> **b, std::int64_t *ldb,
+        std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count,
+        std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dposv_mixed_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+        double **a, std::int64_t *lda, double **b, std::int64_t *ldb, double **x, std::int64_t *ldx,
+        std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zposv_mixed_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+        std::complex<double> **a, std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
+        std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count,
+        std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*dgesv_mixed_group_scratchpad_size_sycl)(
+        sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda,
+        std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count, std::int64_t *group_sizes);
+    std::int64_t (*zgesv_mixed_group_scratchpad_size_sycl)(
+        sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda,
+        std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count, std::int64_t *group_sizes);
+    std::int64_t (*dposv_mixed_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+        std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+        std::int64_t *group_sizes);
+    std::int64_t (*zposv_mixed_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
+        std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+        std::int64_t *group_sizes);
+    void (*sgeqrf_tsqr_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                             sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
+                             sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+    void (*dgeqrf_tsqr_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                             sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
+                             sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*cgeqrf_tsqr_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+        std::int64_t lda, sycl::buffer<std::complex<float>> &tau,
+        sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+    void (*zgeqrf_tsqr_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+        std::int64_t lda, sycl::buffer<std::complex<double>> &tau,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*sgeqrf_tsqr_usm_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        float *a, std::int64_t lda, float *tau, float *scratchpad,
+                                        std::int64_t scratchpad_size,
+                                        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dgeqrf_tsqr_usm_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                        double *a, std::int64_t lda, double *tau,
+                                        double *scratchpad, std::int64_t scratchpad_size,
+                                        const std::vector<sycl::event> &dependencies);
+    sycl::event (*cgeqrf_tsqr_usm_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+        std::int64_t lda, std::complex<float> *tau, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zgeqrf_tsqr_usm_sycl)(
+        sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+        std::int64_t lda, std::complex<double> *tau, std::complex<double> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    std::int64_t (*sgeqrf_tsqr_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t m,
+                                                     std::int64_t n, std::int64_t lda);
+    std::int64_t (*dgeqrf_tsqr_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t m,
+                                                     std::int64_t n, std::int64_t lda);
+    std::int64_t (*cgeqrf_tsqr_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t m,
+                                                     std::int64_t n, std::int64_t lda);
+    std::int64_t (*zgeqrf_tsqr_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t m,
+                                                     std::int64_t n, std::int64_t lda);
+    void (*sgesvd_randomized_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::uint64_t seed, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &s,
+        sycl::buffer<float> &u, std::int64_t ldu, sycl::buffer<float> &vt, std::int64_t ldvt,
+        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+    void (*dgesvd_randomized_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::uint64_t seed, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &s,
+        sycl::buffer<double> &u, std::int64_t ldu, sycl::buffer<double> &vt, std::int64_t ldvt,
+        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*cgesvd_randomized_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::uint64_t seed, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+        sycl::buffer<float> &s, sycl::buffer<std::complex<float>> &u, std::int64_t ldu,
+        sycl::buffer<std::complex<float>> &vt, std::int64_t ldvt,
+        sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+    void (*zgesvd_randomized_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::uint64_t seed, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+        sycl::buffer<double> &s, sycl::buffer<std::complex<double>> &u, std::int64_t ldu,
+        sycl::buffer<std::complex<double>> &vt, std::int64_t ldvt,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*sgesvd_randomized_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::uint64_t seed, const float *a, std::int64_t lda, float *s, float *u, std::int64_t ldu,
+        float *vt, std::int64_t ldvt, float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dgesvd_randomized_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::uint64_t seed, const double *a, std::int64_t lda, double *s, double *u,
+        std::int64_t ldu, double *vt, std::int64_t ldvt, double *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*cgesvd_randomized_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::uint64_t seed, const std::complex<float> *a, std::int64_t lda, float *s,
+        std::complex<float> *u, std::int64_t ldu, std::complex<float> *vt, std::int64_t ldvt,
+        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zgesvd_randomized_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::uint64_t seed, const std::complex<double> *a, std::int64_t lda, double *s,
+        std::complex<double> *u, std::int64_t ldu, std::complex<double> *vt, std::int64_t ldvt,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*sgesvd_randomized_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::int64_t lda, std::int64_t ldu, std::int64_t ldvt);
+    std::int64_t (*dgesvd_randomized_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::int64_t lda, std::int64_t ldu, std::int64_t ldvt);
+    std::int64_t (*cgesvd_randomized_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::int64_t lda, std::int64_t ldu, std::int64_t ldvt);
+    std::int64_t (*zgesvd_randomized_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+        std::int64_t n, std::int64_t k, std::int64_t oversample, std::int64_t power_iters,
+        std::int64_t lda, std::int64_t ldu, std::int64_t ldvt);
+    void (*cheevr_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+        std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+        sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z,
+        std::int64_t ldz, sycl::buffer<std::complex<float>> &scratchpad,
+        std::int64_t scratchpad_size);
+    void (*zheevr_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+        std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+        sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+        sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*cheevr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda, float vl,
+        float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+        std::complex<float> *z, std::int64_t ldz, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+        double vl, double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+        double *w, std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    std::int64_t (*cheevr_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*zheevr_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    void (*cheevx_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+        std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+        sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z,
+        std::int64_t ldz, sycl::buffer<std::complex<float>> &scratchpad,
+        std::int64_t scratchpad_size);
+    void (*zheevx_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+        std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+        sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+        sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*cheevx_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda, float vl,
+        float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+        std::complex<float> *z, std::int64_t ldz, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevx_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+        double vl, double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+        double *w, std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    std::int64_t (*cheevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*zheevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    void (*ssyevr_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                        std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                        sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*dsyevr_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                        std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                        double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                        sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+    sycl::event (*ssyevr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl, float vu,
+        std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+        std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl, double vu,
+        std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w, double *z,
+        std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*ssyevr_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*dsyevr_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    void (*ssyevx_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                        std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                        sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*dsyevx_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                        std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                        double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                        sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+    sycl::event (*ssyevx_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl, float vu,
+        std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+        std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevx_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl, double vu,
+        std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w, double *z,
+        std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*ssyevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*dsyevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    void (*cheevr_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+        std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il,
+        std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+        std::int64_t stride_w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+        std::int64_t stride_z, std::int64_t batch_size,
+        sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+    void (*zheevr_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+        std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il,
+        std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+        std::int64_t stride_w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+        std::int64_t stride_z, std::int64_t batch_size,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*cheevr_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+        std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+        std::int64_t *m, float *w, std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz,
+        std::int64_t stride_z, std::int64_t batch_size, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevr_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+        std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+        double abstol, std::int64_t *m, double *w, std::int64_t stride_w, std::complex<double> *z,
+        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*cheevr_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a, std::int64_t *lda,
+        float *vl, float *vu, std::int64_t *il, std::int64_t *iu, float *abstol, std::int64_t *m,
+        float **w, std::complex<float> **z, std::int64_t *ldz, std::int64_t group_count,
+        std::int64_t *group_sizes, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevr_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<double> **a, std::int64_t *lda,
+        double *vl, double *vu, std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m,
+        double **w, std::complex<double> **z, std::int64_t *ldz, std::int64_t group_count,
+        std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*cheevr_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size);
+    std::int64_t (*zheevr_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size);
+    std::int64_t (*cheevr_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+        std::int64_t group_count, std::int64_t *group_sizes);
+    std::int64_t (*zheevr_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+        std::int64_t group_count, std::int64_t *group_sizes);
+    void (*cheevx_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+        std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il,
+        std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+        std::int64_t stride_w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+        std::int64_t stride_z, std::int64_t batch_size,
+        sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+    void (*zheevx_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+        std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il,
+        std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+        std::int64_t stride_w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+        std::int64_t stride_z, std::int64_t batch_size,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*cheevx_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+        std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+        std::int64_t *m, float *w, std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz,
+        std::int64_t stride_z, std::int64_t batch_size, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevx_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+        std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+        double abstol, std::int64_t *m, double *w, std::int64_t stride_w, std::complex<double> *z,
+        std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*cheevx_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a, std::int64_t *lda,
+        float *vl, float *vu, std::int64_t *il, std::int64_t *iu, float *abstol, std::int64_t *m,
+        float **w, std::complex<float> **z, std::int64_t *ldz, std::int64_t group_count,
+        std::int64_t *group_sizes, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevx_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<double> **a, std::int64_t *lda,
+        double *vl, double *vu, std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m,
+        double **w, std::complex<double> **z, std::int64_t *ldz, std::int64_t group_count,
+        std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*cheevx_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size);
+    std::int64_t (*zheevx_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size);
+    std::int64_t (*cheevx_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+        std::int64_t group_count, std::int64_t *group_sizes);
+    std::int64_t (*zheevx_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+        std::int64_t group_count, std::int64_t *group_sizes);
+    void (*ssyevr_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+        std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+        sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+        sycl::buffer<float> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+    void (*dsyevr_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+        std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+        double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+        std::int64_t stride_w, sycl::buffer<double> &z, std::int64_t ldz, std::int64_t stride_z,
+        std::int64_t batch_size, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*ssyevr_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a,
+        float vl, float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+        float *w, std::int64_t stride_w, float *z, std::int64_t ldz, std::int64_t stride_z,
+        std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevr_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
+        double vl, double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+        double *w, std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*ssyevr_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, float **a, std::int64_t *lda, float *vl,
+        float *vu, std::int64_t *il, std::int64_t *iu, float *abstol, std::int64_t *m, float **w,
+        float **z, std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+        float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevr_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, double **a, std::int64_t *lda, double *vl,
+        double *vu, std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m, double **w,
+        double **z, std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+        double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*ssyevr_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size);
+    std::int64_t (*dsyevr_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size);
+    std::int64_t (*ssyevr_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+        std::int64_t group_count, std::int64_t *group_sizes);
+    std::int64_t (*dsyevr_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+        std::int64_t group_count, std::int64_t *group_sizes);
+    void (*ssyevx_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+        std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+        sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+        sycl::buffer<float> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+    void (*dsyevx_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+        std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+        double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+        std::int64_t stride_w, sycl::buffer<double> &z, std::int64_t ldz, std::int64_t stride_z,
+        std::int64_t batch_size, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*ssyevx_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a,
+        float vl, float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+        float *w, std::int64_t stride_w, float *z, std::int64_t ldz, std::int64_t stride_z,
+        std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevx_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
+        double vl, double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+        double *w, std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*ssyevx_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, float **a, std::int64_t *lda, float *vl,
+        float *vu, std::int64_t *il, std::int64_t *iu, float *abstol, std::int64_t *m, float **w,
+        float **z, std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+        float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevx_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, double **a, std::int64_t *lda, double *vl,
+        double *vu, std::int64_t *il, std::int64_t *iu, double *abstol, std::int64_t *m, double **w,
+        double **z, std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+        double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*ssyevx_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size);
+    std::int64_t (*dsyevx_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+        std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size);
+    std::int64_t (*ssyevx_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+        std::int64_t group_count, std::int64_t *group_sizes);
+    std::int64_t (*dsyevx_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::rangev *range,
+        oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda, std::int64_t *ldz,
+        std::int64_t group_count, std::int64_t *group_sizes);
+    void (*cheevd_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+        sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+        sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+    void (*zheevd_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+        sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*cheevd_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+        std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevd_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+        std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*cheevd_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+        std::complex<float> **a, std::int64_t *lda, float **w, std::int64_t group_count,
+        std::int64_t *group_sizes, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zheevd_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+        std::complex<double> **a, std::int64_t *lda, double **w, std::int64_t group_count,
+        std::int64_t *group_sizes, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*cheevd_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+    std::int64_t (*zheevd_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+    std::int64_t (*cheevd_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+        std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+    std::int64_t (*zheevd_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+        std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+    void (*ssyevd_batch_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                              std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w,
+                              std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                              std::int64_t scratchpad_size);
+    void (*dsyevd_batch_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                              std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<double> &w, std::int64_t stride_w,
+                              std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                              std::int64_t scratchpad_size);
+    sycl::event (*ssyevd_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+        std::int64_t lda, std::int64_t stride_a, float *w, std::int64_t stride_w,
+        std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevd_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        double *a, std::int64_t lda, std::int64_t stride_a, double *w, std::int64_t stride_w,
+        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*ssyevd_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+        float **a, std::int64_t *lda, float **w, std::int64_t group_count,
+        std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*dsyevd_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+        double **a, std::int64_t *lda, double **w, std::int64_t group_count,
+        std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*ssyevd_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+    std::int64_t (*dsyevd_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+    std::int64_t (*ssyevd_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+        std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+    std::int64_t (*dsyevd_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo, std::int64_t *n,
+        std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+    void (*sgels_batch_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                             std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &b,
+                             std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+    void (*dgels_batch_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                             std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b,
+                             std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*cgels_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+        std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size,
+        sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+    void (*zgels_batch_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+        std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size,
+        sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+    sycl::event (*sgels_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*dgels_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*cgels_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+        std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zgels_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+        std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*sgels_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+        std::int64_t *nrhs, float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
+        std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*dgels_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+        std::int64_t *nrhs, double **a, std::int64_t *lda, double **b, std::int64_t *ldb,
+        std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+        std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies);
+    sycl::event (*cgels_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+        std::int64_t *nrhs, std::complex<float> **a, std::int64_t *lda, std::complex<float> **b,
+        std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    sycl::event (*zgels_group_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+        std::int64_t *nrhs, std::complex<double> **a, std::int64_t *lda, std::complex<double> **b,
+        std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const std::vector<sycl::event> &dependencies);
+    std::int64_t (*sgels_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size);
+    std::int64_t (*dgels_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size);
+    std::int64_t (*cgels_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size);
+    std::int64_t (*zgels_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size);
+    std::int64_t (*sgels_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+        std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+        std::int64_t *group_sizes);
+    std::int64_t (*dgels_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+        std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+        std::int64_t *group_sizes);
+    std::int64_t (*cgels_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+        std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+        std::int64_t *group_sizes);
+    std::int64_t (*zgels_group_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+        std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
+        std::int64_t *group_sizes);
 
 } lapack_function_table_t;
@@ -2997,6 +2997,1657 @@ std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
     return function_tables[libkey].zungqr_group_scratchpad_size_sycl(queue, m, n, k, lda,
                                                                      group_count, group_sizes);
 }
+void pack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                  sycl::buffer<float> &ap, std::int64_t ldap, std::int64_t interleave,
+                  std::int64_t batch_size) {
+    function_tables[libkey].spack_compact_sycl(queue, m, n, a, lda, stride_a, ap, ldap, interleave,
+                                               batch_size);
+}
+void pack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                  sycl::buffer<double> &ap, std::int64_t ldap, std::int64_t interleave,
+                  std::int64_t batch_size) {
+    function_tables[libkey].dpack_compact_sycl(queue, m, n, a, lda, stride_a, ap, ldap, interleave,
+                                               batch_size);
+}
+sycl::event pack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a,
+                         float *ap, std::int64_t ldap, std::int64_t interleave,
+                         std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].spack_compact_usm_sycl(queue, m, n, a, lda, stride_a, ap, ldap,
+                                                          interleave, batch_size, dependencies);
+}
+sycl::event pack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
+                         double *ap, std::int64_t ldap, std::int64_t interleave,
+                         std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dpack_compact_usm_sycl(queue, m, n, a, lda, stride_a, ap, ldap,
+                                                          interleave, batch_size, dependencies);
+}
+void unpack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                    sycl::buffer<float> &ap, std::int64_t ldap, sycl::buffer<float> &a,
+                    std::int64_t lda, std::int64_t stride_a, std::int64_t interleave,
+                    std::int64_t batch_size) {
+    function_tables[libkey].sunpack_compact_sycl(queue, m, n, ap, ldap, a, lda, stride_a,
+                                                 interleave, batch_size);
+}
+void unpack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                    sycl::buffer<double> &ap, std::int64_t ldap, sycl::buffer<double> &a,
+                    std::int64_t lda, std::int64_t stride_a, std::int64_t interleave,
+                    std::int64_t batch_size) {
+    function_tables[libkey].dunpack_compact_sycl(queue, m, n, ap, ldap, a, lda, stride_a,
+                                                 interleave, batch_size);
+}
+sycl::event unpack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                           std::int64_t n, float *ap, std::int64_t ldap, float *a, std::int64_t lda,
+                           std::int64_t stride_a, std::int64_t interleave, std::int64_t batch_size,
+                           const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].sunpack_compact_usm_sycl(queue, m, n, ap, ldap, a, lda, stride_a,
+                                                            interleave, batch_size, dependencies);
+}
+sycl::event unpack_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                           std::int64_t n, double *ap, std::int64_t ldap, double *a,
+                           std::int64_t lda, std::int64_t stride_a, std::int64_t interleave,
+                           std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dunpack_compact_usm_sycl(queue, m, n, ap, ldap, a, lda, stride_a,
+                                                            interleave, batch_size, dependencies);
+}
+void getrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                   std::int64_t stride_ipiv, std::int64_t interleave, std::int64_t batch_size) {
+    function_tables[libkey].sgetrf_compact_sycl(queue, m, n, a, lda, ipiv, stride_ipiv, interleave,
+                                                batch_size);
+}
+void getrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                   sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                   std::int64_t stride_ipiv, std::int64_t interleave, std::int64_t batch_size) {
+    function_tables[libkey].dgetrf_compact_sycl(queue, m, n, a, lda, ipiv, stride_ipiv, interleave,
+                                                batch_size);
+}
+sycl::event getrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                          std::int64_t n, float *a, std::int64_t lda, std::int64_t *ipiv,
+                          std::int64_t stride_ipiv, std::int64_t interleave,
+                          std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].sgetrf_compact_usm_sycl(queue, m, n, a, lda, ipiv, stride_ipiv,
+                                                           interleave, batch_size, dependencies);
+}
+sycl::event getrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                          std::int64_t n, double *a, std::int64_t lda, std::int64_t *ipiv,
+                          std::int64_t stride_ipiv, std::int64_t interleave,
+                          std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgetrf_compact_usm_sycl(queue, m, n, a, lda, ipiv, stride_ipiv,
+                                                           interleave, batch_size, dependencies);
+}
+void getrs_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                   std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                   sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   sycl::buffer<float> &b, std::int64_t ldb, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    function_tables[libkey].sgetrs_compact_sycl(queue, trans, n, nrhs, a, lda, ipiv, stride_ipiv, b,
+                                                ldb, interleave, batch_size);
+}
+void getrs_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                   std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                   sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                   sycl::buffer<double> &b, std::int64_t ldb, std::int64_t interleave,
+                   std::int64_t batch_size) {
+    function_tables[libkey].dgetrs_compact_sycl(queue, trans, n, nrhs, a, lda, ipiv, stride_ipiv, b,
+                                                ldb, interleave, batch_size);
+}
+sycl::event getrs_compact(oneapi::mkl::device libkey, sycl::queue &queue,
+                          oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs, float *a,
+                          std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv, float *b,
+                          std::int64_t ldb, std::int64_t interleave, std::int64_t batch_size,
+                          const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].sgetrs_compact_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv,
+                                                           stride_ipiv, b, ldb, interleave,
+                                                           batch_size, dependencies);
+}
+sycl::event getrs_compact(oneapi::mkl::device libkey, sycl::queue &queue,
+                          oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+                          double *a, std::int64_t lda, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                          double *b, std::int64_t ldb, std::int64_t interleave,
+                          std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgetrs_compact_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv,
+                                                           stride_ipiv, b, ldb, interleave,
+                                                           batch_size, dependencies);
+}
+void potrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                   std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                   std::int64_t interleave, std::int64_t batch_size) {
+    function_tables[libkey].spotrf_compact_sycl(queue, uplo, n, a, lda, interleave, batch_size);
+}
+void potrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                   std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                   std::int64_t interleave, std::int64_t batch_size) {
+    function_tables[libkey].dpotrf_compact_sycl(queue, uplo, n, a, lda, interleave, batch_size);
+}
+sycl::event potrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                          std::int64_t n, float *a, std::int64_t lda, std::int64_t interleave,
+                          std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].spotrf_compact_usm_sycl(queue, uplo, n, a, lda, interleave,
+                                                           batch_size, dependencies);
+}
+sycl::event potrf_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                          std::int64_t n, double *a, std::int64_t lda, std::int64_t interleave,
+                          std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dpotrf_compact_usm_sycl(queue, uplo, n, a, lda, interleave,
+                                                           batch_size, dependencies);
+}
+void trsm_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
+                  oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                  std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float> &a,
+                  std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+                  std::int64_t interleave, std::int64_t batch_size) {
+    function_tables[libkey].strsm_compact_sycl(queue, side, uplo, trans, diag, m, n, alpha, a, lda,
+                                               b, ldb, interleave, batch_size);
+}
+void trsm_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
+                  oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                  std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double> &a,
+                  std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                  std::int64_t interleave, std::int64_t batch_size) {
+    function_tables[libkey].dtrsm_compact_sycl(queue, side, uplo, trans, diag, m, n, alpha, a, lda,
+                                               b, ldb, interleave, batch_size);
+}
+sycl::event trsm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    float alpha, float *a, std::int64_t lda, float *b, std::int64_t ldb, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].strsm_compact_usm_sycl(queue, side, uplo, trans, diag, m, n,
+                                                          alpha, a, lda, b, ldb, interleave,
+                                                          batch_size, dependencies);
+}
+sycl::event trsm_compact(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t m, std::int64_t n,
+    double alpha, double *a, std::int64_t lda, double *b, std::int64_t ldb, std::int64_t interleave,
+    std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dtrsm_compact_usm_sycl(queue, side, uplo, trans, diag, m, n,
+                                                          alpha, a, lda, b, ldb, interleave,
+                                                          batch_size, dependencies);
+}
+void gemm_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose transa,
+                  oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                  float alpha, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+                  std::int64_t ldb, float beta, sycl::buffer<float> &c, std::int64_t ldc,
+                  std::int64_t interleave, std::int64_t batch_size) {
+    function_tables[libkey].sgemm_compact_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                               ldb, beta, c, ldc, interleave, batch_size);
+}
+void gemm_compact(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose transa,
+                  oneapi::mkl::transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                  double alpha, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                  std::int64_t ldb, double beta, sycl::buffer<double> &c, std::int64_t ldc,
+                  std::int64_t interleave, std::int64_t batch_size) {
+    function_tables[libkey].dgemm_compact_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
+                                               ldb, beta, c, ldc, interleave, batch_size);
+}
+sycl::event gemm_compact(oneapi::mkl::device libkey, sycl::queue &queue,
+                         oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                         std::int64_t m, std::int64_t n, std::int64_t k, float alpha, float *a,
+                         std::int64_t lda, float *b, std::int64_t ldb, float beta, float *c,
+                         std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].sgemm_compact_usm_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                          lda, b, ldb, beta, c, ldc, interleave,
+                                                          batch_size, dependencies);
+}
+sycl::event gemm_compact(oneapi::mkl::device libkey, sycl::queue &queue,
+                         oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+                         std::int64_t m, std::int64_t n, std::int64_t k, double alpha, double *a,
+                         std::int64_t lda, double *b, std::int64_t ldb, double beta, double *c,
+                         std::int64_t ldc, std::int64_t interleave, std::int64_t batch_size,
+                         const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgemm_compact_usm_sycl(queue, transa, transb, m, n, k, alpha, a,
+                                                          lda, b, ldb, beta, c, ldc, interleave,
+                                                          batch_size, dependencies);
+}
+void gesv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &x,
+                std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+                sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].dgesv_mixed_sycl(queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter,
+                                             scratchpad, scratchpad_size);
+}
+void gesv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                std::int64_t ldb, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    function_tables[libkey].zgesv_mixed_sycl(queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter,
+                                             scratchpad, scratchpad_size);
+}
+sycl::event gesv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                       double *b, std::int64_t ldb, double *x, std::int64_t ldx, std::int64_t *iter,
+                       double *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgesv_mixed_usm_sycl(queue, n, nrhs, a, lda, ipiv, b, ldb, x,
+                                                        ldx, iter, scratchpad, scratchpad_size,
+                                                        dependencies);
+}
+sycl::event gesv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                       std::complex<double> *x, std::int64_t ldx, std::int64_t *iter,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zgesv_mixed_usm_sycl(queue, n, nrhs, a, lda, ipiv, b, ldb, x,
+                                                        ldx, iter, scratchpad, scratchpad_size,
+                                                        dependencies);
+}
+template <>
+std::int64_t gesv_mixed_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb, std::int64_t ldx) {
+    return function_tables[libkey].dgesv_mixed_scratchpad_size_sycl(queue, n, nrhs, lda, ldb, ldx);
+}
+template <>
+std::int64_t gesv_mixed_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t ldb, std::int64_t ldx) {
+    return function_tables[libkey].zgesv_mixed_scratchpad_size_sycl(queue, n, nrhs, lda, ldb, ldx);
+}
+void posv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &x,
+                std::int64_t ldx, sycl::buffer<std::int64_t> &iter,
+                sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].dposv_mixed_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter,
+                                             scratchpad, scratchpad_size);
+}
+void posv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    function_tables[libkey].zposv_mixed_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter,
+                                             scratchpad, scratchpad_size);
+}
+sycl::event posv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                       std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                       std::int64_t ldb, double *x, std::int64_t ldx, std::int64_t *iter,
+                       double *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dposv_mixed_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, x,
+                                                        ldx, iter, scratchpad, scratchpad_size,
+                                                        dependencies);
+}
+sycl::event posv_mixed(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                       std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::complex<double> *b, std::int64_t ldb, std::complex<double> *x,
+                       std::int64_t ldx, std::int64_t *iter, std::complex<double> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zposv_mixed_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, x,
+                                                        ldx, iter, scratchpad, scratchpad_size,
+                                                        dependencies);
+}
+template <>
+std::int64_t posv_mixed_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb, std::int64_t ldx) {
+    return function_tables[libkey].dposv_mixed_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
+                                                                    ldx);
+}
+template <>
+std::int64_t posv_mixed_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb, std::int64_t ldx) {
+    return function_tables[libkey].zposv_mixed_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
+                                                                    ldx);
+}
+void gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv, sycl::buffer<double> &b,
+    std::int64_t ldb, std::int64_t stride_b, sycl::buffer<double> &x, std::int64_t ldx,
+    std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].dgesv_mixed_batch_sycl(queue, n, nrhs, a, lda, stride_a, ipiv,
+                                                   stride_ipiv, b, ldb, stride_b, x, ldx, stride_x,
+                                                   iter, batch_size, scratchpad, scratchpad_size);
+}
+void gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+    sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+    sycl::buffer<std::complex<double>> &x, std::int64_t ldx, std::int64_t stride_x,
+    sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].zgesv_mixed_batch_sycl(queue, n, nrhs, a, lda, stride_a, ipiv,
+                                                   stride_ipiv, b, ldb, stride_b, x, ldx, stride_x,
+                                                   iter, batch_size, scratchpad, scratchpad_size);
+}
+sycl::event gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    double *b, std::int64_t ldb, std::int64_t stride_b, double *x, std::int64_t ldx,
+    std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgesv_mixed_batch_usm_sycl(
+        queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, x, ldx, stride_x,
+        iter, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+    std::int64_t stride_ipiv, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::complex<double> *x, std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zgesv_mixed_batch_usm_sycl(
+        queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, x, ldx, stride_x,
+        iter, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size) {
+    return function_tables[libkey].dgesv_mixed_batch_scratchpad_size_sycl(
+        queue, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, ldx, stride_x, batch_size);
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size) {
+    return function_tables[libkey].zgesv_mixed_batch_scratchpad_size_sycl(
+        queue, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, ldx, stride_x, batch_size);
+}
+void posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b, sycl::buffer<double> &x,
+    std::int64_t ldx, std::int64_t stride_x, sycl::buffer<std::int64_t> &iter,
+    std::int64_t batch_size, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].dposv_mixed_batch_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                   stride_b, x, ldx, stride_x, iter, batch_size,
+                                                   scratchpad, scratchpad_size);
+}
+void posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+    std::int64_t stride_b, sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+    std::int64_t stride_x, sycl::buffer<std::int64_t> &iter, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].zposv_mixed_batch_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                   stride_b, x, ldx, stride_x, iter, batch_size,
+                                                   scratchpad, scratchpad_size);
+}
+sycl::event posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+    std::int64_t ldb, std::int64_t stride_b, double *x, std::int64_t ldx, std::int64_t stride_x,
+    std::int64_t *iter, std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dposv_mixed_batch_usm_sycl(
+        queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, x, ldx, stride_x, iter,
+        batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<double> *x,
+    std::int64_t ldx, std::int64_t stride_x, std::int64_t *iter, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zposv_mixed_batch_usm_sycl(
+        queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, x, ldx, stride_x, iter,
+        batch_size, scratchpad, scratchpad_size, dependencies);
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size) {
+    return function_tables[libkey].dposv_mixed_batch_scratchpad_size_sycl(
+        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, ldx, stride_x, batch_size);
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t ldx, std::int64_t stride_x, std::int64_t batch_size) {
+    return function_tables[libkey].zposv_mixed_batch_scratchpad_size_sycl(
+        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, ldx, stride_x, batch_size);
+}
+sycl::event gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs, double **a,
+    std::int64_t *lda, std::int64_t **ipiv, double **b, std::int64_t *ldb, double **x,
+    std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgesv_mixed_group_usm_sycl(
+        queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, group_count, group_sizes, scratchpad,
+        scratchpad_size, dependencies);
+}
+sycl::event gesv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs,
+    std::complex<double> **a, std::int64_t *lda, std::int64_t **ipiv, std::complex<double> **b,
+    std::int64_t *ldb, std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zgesv_mixed_group_usm_sycl(
+        queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, group_count, group_sizes, scratchpad,
+        scratchpad_size, dependencies);
+}
+sycl::event posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, double **a, std::int64_t *lda, double **b, std::int64_t *ldb, double **x,
+    std::int64_t *ldx, std::int64_t *iter, std::int64_t group_count, std::int64_t *group_sizes,
+    double *scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dposv_mixed_group_usm_sycl(
+        queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, group_count, group_sizes, scratchpad,
+        scratchpad_size, dependencies);
+}
+sycl::event posv_mixed_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, std::complex<double> **a, std::int64_t *lda, std::complex<double> **b,
+    std::int64_t *ldb, std::complex<double> **x, std::int64_t *ldx, std::int64_t *iter,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zposv_mixed_group_usm_sycl(
+        queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, group_count, group_sizes, scratchpad,
+        scratchpad_size, dependencies);
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    return function_tables[libkey].dgesv_mixed_group_scratchpad_size_sycl(
+        queue, n, nrhs, lda, ldb, ldx, group_count, group_sizes);
+}
+template <>
+std::int64_t gesv_mixed_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *nrhs,
+    std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx, std::int64_t group_count,
+    std::int64_t *group_sizes) {
+    return function_tables[libkey].zgesv_mixed_group_scratchpad_size_sycl(
+        queue, n, nrhs, lda, ldb, ldx, group_count, group_sizes);
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx,
+    std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].dposv_mixed_group_scratchpad_size_sycl(
+        queue, uplo, n, nrhs, lda, ldb, ldx, group_count, group_sizes);
+}
+template <>
+std::int64_t posv_mixed_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+    std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t *ldx,
+    std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].zposv_mixed_group_scratchpad_size_sycl(
+        queue, uplo, n, nrhs, lda, ldb, ldx, group_count, group_sizes);
+}
+void geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
+                sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].sgeqrf_tsqr_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
+                sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].dgeqrf_tsqr_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                sycl::buffer<std::complex<float>> &tau,
+                sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].cgeqrf_tsqr_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+void geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                sycl::buffer<std::complex<double>> &tau,
+                sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].zgeqrf_tsqr_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+sycl::event geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                       std::int64_t n, float *a, std::int64_t lda, float *tau, float *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].sgeqrf_tsqr_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                       std::int64_t n, double *a, std::int64_t lda, double *tau, double *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgeqrf_tsqr_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                       std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                       std::complex<float> *tau, std::complex<float> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cgeqrf_tsqr_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event geqrf_tsqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                       std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                       std::complex<double> *tau, std::complex<double> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zgeqrf_tsqr_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                               std::int64_t m, std::int64_t n, std::int64_t lda) {
+    return function_tables[libkey].sgeqrf_tsqr_scratchpad_size_sycl(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                std::int64_t m, std::int64_t n, std::int64_t lda) {
+    return function_tables[libkey].dgeqrf_tsqr_scratchpad_size_sycl(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                             sycl::queue &queue, std::int64_t m,
+                                                             std::int64_t n, std::int64_t lda) {
+    return function_tables[libkey].cgeqrf_tsqr_scratchpad_size_sycl(queue, m, n, lda);
+}
+template <>
+std::int64_t geqrf_tsqr_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                              sycl::queue &queue, std::int64_t m,
+                                                              std::int64_t n, std::int64_t lda) {
+    return function_tables[libkey].zgeqrf_tsqr_scratchpad_size_sycl(queue, m, n, lda);
+}
+void gesvd_randomized(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                      oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+                      sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &s,
+                      sycl::buffer<float> &u, std::int64_t ldu, sycl::buffer<float> &vt,
+                      std::int64_t ldvt, sycl::buffer<float> &scratchpad,
+                      std::int64_t scratchpad_size) {
+    function_tables[libkey].sgesvd_randomized_sycl(queue, jobu, jobvt, m, n, k, oversample,
+                                                   power_iters, seed, a, lda, s, u, ldu, vt, ldvt,
+                                                   scratchpad, scratchpad_size);
+}
+void gesvd_randomized(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                      oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+                      sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &s,
+                      sycl::buffer<double> &u, std::int64_t ldu, sycl::buffer<double> &vt,
+                      std::int64_t ldvt, sycl::buffer<double> &scratchpad,
+                      std::int64_t scratchpad_size) {
+    function_tables[libkey].dgesvd_randomized_sycl(queue, jobu, jobvt, m, n, k, oversample,
+                                                   power_iters, seed, a, lda, s, u, ldu, vt, ldvt,
+                                                   scratchpad, scratchpad_size);
+}
+void gesvd_randomized(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                      oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+                      sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                      sycl::buffer<float> &s, sycl::buffer<std::complex<float>> &u,
+                      std::int64_t ldu, sycl::buffer<std::complex<float>> &vt, std::int64_t ldvt,
+                      sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].cgesvd_randomized_sycl(queue, jobu, jobvt, m, n, k, oversample,
+                                                   power_iters, seed, a, lda, s, u, ldu, vt, ldvt,
+                                                   scratchpad, scratchpad_size);
+}
+void gesvd_randomized(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                      oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+                      std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+                      sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                      sycl::buffer<double> &s, sycl::buffer<std::complex<double>> &u,
+                      std::int64_t ldu, sycl::buffer<std::complex<double>> &vt, std::int64_t ldvt,
+                      sycl::buffer<std::complex<double>> &scratchpad,
+                      std::int64_t scratchpad_size) {
+    function_tables[libkey].zgesvd_randomized_sycl(queue, jobu, jobvt, m, n, k, oversample,
+                                                   power_iters, seed, a, lda, s, u, ldu, vt, ldvt,
+                                                   scratchpad, scratchpad_size);
+}
+sycl::event gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed, const float *a,
+    std::int64_t lda, float *s, float *u, std::int64_t ldu, float *vt, std::int64_t ldvt,
+    float *scratchpad, std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].sgesvd_randomized_usm_sycl(
+        queue, jobu, jobvt, m, n, k, oversample, power_iters, seed, a, lda, s, u, ldu, vt, ldvt,
+        scratchpad, scratchpad_size, dependencies);
+}
+sycl::event gesvd_randomized(oneapi::mkl::device libkey, sycl::queue &queue,
+                             oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+                             std::int64_t n, std::int64_t k, std::int64_t oversample,
+                             std::int64_t power_iters, std::uint64_t seed, const double *a,
+                             std::int64_t lda, double *s, double *u, std::int64_t ldu, double *vt,
+                             std::int64_t ldvt, double *scratchpad, std::int64_t scratchpad_size,
+                             const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgesvd_randomized_usm_sycl(
+        queue, jobu, jobvt, m, n, k, oversample, power_iters, seed, a, lda, s, u, ldu, vt, ldvt,
+        scratchpad, scratchpad_size, dependencies);
+}
+sycl::event gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+    const std::complex<float> *a, std::int64_t lda, float *s, std::complex<float> *u,
+    std::int64_t ldu, std::complex<float> *vt, std::int64_t ldvt, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cgesvd_randomized_usm_sycl(
+        queue, jobu, jobvt, m, n, k, oversample, power_iters, seed, a, lda, s, u, ldu, vt, ldvt,
+        scratchpad, scratchpad_size, dependencies);
+}
+sycl::event gesvd_randomized(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::uint64_t seed,
+    const std::complex<double> *a, std::int64_t lda, double *s, std::complex<double> *u,
+    std::int64_t ldu, std::complex<double> *vt, std::int64_t ldvt, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zgesvd_randomized_usm_sycl(
+        queue, jobu, jobvt, m, n, k, oversample, power_iters, seed, a, lda, s, u, ldu, vt, ldvt,
+        scratchpad, scratchpad_size, dependencies);
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt) {
+    return function_tables[libkey].sgesvd_randomized_scratchpad_size_sycl(
+        queue, jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt) {
+    return function_tables[libkey].dgesvd_randomized_scratchpad_size_sycl(
+        queue, jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt) {
+    return function_tables[libkey].cgesvd_randomized_scratchpad_size_sycl(
+        queue, jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+}
+template <>
+std::int64_t gesvd_randomized_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+    oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t k,
+    std::int64_t oversample, std::int64_t power_iters, std::int64_t lda, std::int64_t ldu,
+    std::int64_t ldvt) {
+    return function_tables[libkey].zgesvd_randomized_scratchpad_size_sycl(
+        queue, jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+}
+void heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+           std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].cheevr_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+void heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+           std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].zheevr_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+sycl::event heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                  std::int64_t iu, float abstol, std::int64_t *m, float *w, std::complex<float> *z,
+                  std::int64_t ldz, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevr_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+sycl::event heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                  std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                  std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevr_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz) {
+    return function_tables[libkey].cheevr_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda,
+                                                               ldz);
+}
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz) {
+    return function_tables[libkey].zheevr_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda,
+                                                               ldz);
+}
+void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+           std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].cheevx_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+           std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].zheevx_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                  std::int64_t iu, float abstol, std::int64_t *m, float *w, std::complex<float> *z,
+                  std::int64_t ldz, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevx_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                  std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                  std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevx_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz) {
+    return function_tables[libkey].cheevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda,
+                                                               ldz);
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz) {
+    return function_tables[libkey].zheevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda,
+                                                               ldz);
+}
+void syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<float> &a, std::int64_t lda, float vl, float vu, std::int64_t il,
+           std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    function_tables[libkey].ssyevr_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+void syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<double> &a, std::int64_t lda, double vl, double vu, std::int64_t il,
+           std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    function_tables[libkey].dsyevr_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+sycl::event syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                  float abstol, std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                  float *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevr_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+sycl::event syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                  double abstol, std::int64_t *m, double *w, double *z, std::int64_t ldz,
+                  double *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevr_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+template <>
+std::int64_t syevr_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                          oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                          std::int64_t ldz) {
+    return function_tables[libkey].ssyevr_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda,
+                                                               ldz);
+}
+template <>
+std::int64_t syevr_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                           oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                           oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                           std::int64_t ldz) {
+    return function_tables[libkey].dsyevr_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda,
+                                                               ldz);
+}
+void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<float> &a, std::int64_t lda, float vl, float vu, std::int64_t il,
+           std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    function_tables[libkey].ssyevx_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<double> &a, std::int64_t lda, double vl, double vu, std::int64_t il,
+           std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    function_tables[libkey].dsyevx_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                                        m, w, z, ldz, scratchpad, scratchpad_size);
+}
+sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                  float abstol, std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                  float *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevx_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                  double abstol, std::int64_t *m, double *w, double *z, std::int64_t ldz,
+                  double *scratchpad, std::int64_t scratchpad_size,
+                  const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevx_usm_sycl(queue, jobz, range, uplo, n, a, lda, vl, vu, il,
+                                                   iu, abstol, m, w, z, ldz, scratchpad,
+                                                   scratchpad_size, dependencies);
+}
+template <>
+std::int64_t syevx_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                          oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                          std::int64_t ldz) {
+    return function_tables[libkey].ssyevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda,
+                                                               ldz);
+}
+template <>
+std::int64_t syevx_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                           oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                           oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                           std::int64_t ldz) {
+    return function_tables[libkey].dsyevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda,
+                                                               ldz);
+}
+void heevr_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                 sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<float>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    function_tables[libkey].cheevr_batch_sycl(queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                                              il, iu, abstol, m, w, stride_w, z, ldz, stride_z,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+void heevr_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                 sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<double>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    function_tables[libkey].zheevr_batch_sycl(queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                                              il, iu, abstol, m, w, stride_w, z, ldz, stride_z,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+sycl::event heevr_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float vl,
+                        float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                        float *w, std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz,
+                        std::int64_t stride_z, std::int64_t batch_size,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevr_batch_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z,
+        ldz, stride_z, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event heevr_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double vl,
+                        double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                        double *w, std::int64_t stride_w, std::complex<double> *z, std::int64_t ldz,
+                        std::int64_t stride_z, std::int64_t batch_size,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevr_batch_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z,
+        ldz, stride_z, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event heevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a,
+    std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu, float *abstol,
+    std::int64_t *m, float **w, std::complex<float> **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevr_group_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, group_count,
+        group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event heevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<double> **a,
+    std::int64_t *lda, double *vl, double *vu, std::int64_t *il, std::int64_t *iu, double *abstol,
+    std::int64_t *m, double **w, std::complex<double> **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevr_group_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, group_count,
+        group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size) {
+    return function_tables[libkey].cheevr_batch_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size) {
+    return function_tables[libkey].zheevr_batch_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].cheevr_group_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+template <>
+std::int64_t heevr_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].zheevr_group_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+void heevx_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                 sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<float>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    function_tables[libkey].cheevx_batch_sycl(queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                                              il, iu, abstol, m, w, stride_w, z, ldz, stride_z,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+void heevx_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                 sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, std::int64_t stride_w,
+                 sycl::buffer<std::complex<double>> &z, std::int64_t ldz, std::int64_t stride_z,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    function_tables[libkey].zheevx_batch_sycl(queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                                              il, iu, abstol, m, w, stride_w, z, ldz, stride_z,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+sycl::event heevx_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float vl,
+                        float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                        float *w, std::int64_t stride_w, std::complex<float> *z, std::int64_t ldz,
+                        std::int64_t stride_z, std::int64_t batch_size,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevx_batch_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z,
+        ldz, stride_z, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event heevx_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double vl,
+                        double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                        double *w, std::int64_t stride_w, std::complex<double> *z, std::int64_t ldz,
+                        std::int64_t stride_z, std::int64_t batch_size,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevx_batch_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z,
+        ldz, stride_z, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event heevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<float> **a,
+    std::int64_t *lda, float *vl, float *vu, std::int64_t *il, std::int64_t *iu, float *abstol,
+    std::int64_t *m, float **w, std::complex<float> **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevx_group_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, group_count,
+        group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event heevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::complex<double> **a,
+    std::int64_t *lda, double *vl, double *vu, std::int64_t *il, std::int64_t *iu, double *abstol,
+    std::int64_t *m, double **w, std::complex<double> **z, std::int64_t *ldz,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevx_group_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, group_count,
+        group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size) {
+    return function_tables[libkey].cheevx_batch_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size) {
+    return function_tables[libkey].zheevx_batch_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].cheevx_group_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+template <>
+std::int64_t heevx_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].zheevx_group_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+void syevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+    std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+    float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+    sycl::buffer<float> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].ssyevr_batch_sycl(queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                                              il, iu, abstol, m, w, stride_w, z, ldz, stride_z,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+void syevr_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+    std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+    double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, std::int64_t stride_w,
+    sycl::buffer<double> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].dsyevr_batch_sycl(queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                                              il, iu, abstol, m, w, stride_w, z, ldz, stride_z,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+sycl::event syevr_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                        std::int64_t lda, std::int64_t stride_a, float vl, float vu,
+                        std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+                        std::int64_t stride_w, float *z, std::int64_t ldz, std::int64_t stride_z,
+                        std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevr_batch_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z,
+        ldz, stride_z, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event syevr_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                        double *a, std::int64_t lda, std::int64_t stride_a, double vl, double vu,
+                        std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                        std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevr_batch_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z,
+        ldz, stride_z, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event syevr_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+                        oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        float **a, std::int64_t *lda, float *vl, float *vu, std::int64_t *il,
+                        std::int64_t *iu, float *abstol, std::int64_t *m, float **w, float **z,
+                        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevr_group_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, group_count,
+        group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event syevr_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+                        oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        double **a, std::int64_t *lda, double *vl, double *vu, std::int64_t *il,
+                        std::int64_t *iu, double *abstol, std::int64_t *m, double **w, double **z,
+                        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevr_group_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, group_count,
+        group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size) {
+    return function_tables[libkey].ssyevr_batch_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size) {
+    return function_tables[libkey].dsyevr_batch_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].ssyevr_group_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+template <>
+std::int64_t syevr_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].dsyevr_group_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+void syevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+    std::int64_t lda, std::int64_t stride_a, float vl, float vu, std::int64_t il, std::int64_t iu,
+    float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, std::int64_t stride_w,
+    sycl::buffer<float> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].ssyevx_batch_sycl(queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                                              il, iu, abstol, m, w, stride_w, z, ldz, stride_z,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+void syevx_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+    std::int64_t lda, std::int64_t stride_a, double vl, double vu, std::int64_t il, std::int64_t iu,
+    double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, std::int64_t stride_w,
+    sycl::buffer<double> &z, std::int64_t ldz, std::int64_t stride_z, std::int64_t batch_size,
+    sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].dsyevx_batch_sycl(queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu,
+                                              il, iu, abstol, m, w, stride_w, z, ldz, stride_z,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+sycl::event syevx_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                        std::int64_t lda, std::int64_t stride_a, float vl, float vu,
+                        std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+                        std::int64_t stride_w, float *z, std::int64_t ldz, std::int64_t stride_z,
+                        std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevx_batch_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z,
+        ldz, stride_z, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event syevx_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                        double *a, std::int64_t lda, std::int64_t stride_a, double vl, double vu,
+                        std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                        std::int64_t stride_w, double *z, std::int64_t ldz, std::int64_t stride_z,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevx_batch_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, stride_a, vl, vu, il, iu, abstol, m, w, stride_w, z,
+        ldz, stride_z, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event syevx_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+                        oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        float **a, std::int64_t *lda, float *vl, float *vu, std::int64_t *il,
+                        std::int64_t *iu, float *abstol, std::int64_t *m, float **w, float **z,
+                        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevx_group_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, group_count,
+        group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+sycl::event syevx_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+                        oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        double **a, std::int64_t *lda, double *vl, double *vu, std::int64_t *il,
+                        std::int64_t *iu, double *abstol, std::int64_t *m, double **w, double **z,
+                        std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevx_group_usm_sycl(
+        queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz, group_count,
+        group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size) {
+    return function_tables[libkey].ssyevx_batch_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t stride_w, std::int64_t ldz, std::int64_t stride_z,
+    std::int64_t batch_size) {
+    return function_tables[libkey].dsyevx_batch_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].ssyevx_group_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+template <>
+std::int64_t syevx_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+    oneapi::mkl::rangev *range, oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *lda,
+    std::int64_t *ldz, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].dsyevx_group_scratchpad_size_sycl(
+        queue, jobz, range, uplo, n, lda, ldz, group_count, group_sizes);
+}
+void heevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &w,
+                 std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].cheevd_batch_sycl(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+void heevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &w,
+                 std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    function_tables[libkey].zheevd_batch_sycl(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevd_batch_usm_sycl(queue, jobz, uplo, n, a, lda, stride_a, w,
+                                                         stride_w, batch_size, scratchpad,
+                                                         scratchpad_size, dependencies);
+}
+sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevd_batch_usm_sycl(queue, jobz, uplo, n, a, lda, stride_a, w,
+                                                         stride_w, batch_size, scratchpad,
+                                                         scratchpad_size, dependencies);
+}
+sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<float> **a, std::int64_t *lda, float **w,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cheevd_group_usm_sycl(queue, jobz, uplo, n, a, lda, w,
+                                                         group_count, group_sizes, scratchpad,
+                                                         scratchpad_size, dependencies);
+}
+sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::complex<double> **a, std::int64_t *lda, double **w,
+    std::int64_t group_count, std::int64_t *group_sizes, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zheevd_group_usm_sycl(queue, jobz, uplo, n, a, lda, w,
+                                                         group_count, group_sizes, scratchpad,
+                                                         scratchpad_size, dependencies);
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size) {
+    return function_tables[libkey].cheevd_batch_scratchpad_size_sycl(
+        queue, jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size) {
+    return function_tables[libkey].zheevd_batch_scratchpad_size_sycl(
+        queue, jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].cheevd_group_scratchpad_size_sycl(queue, jobz, uplo, n, lda,
+                                                                     group_count, group_sizes);
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].zheevd_group_scratchpad_size_sycl(queue, jobz, uplo, n, lda,
+                                                                     group_count, group_sizes);
+}
+void syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w,
+                 std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    function_tables[libkey].ssyevd_batch_sycl(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+void syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<double> &w, std::int64_t stride_w,
+                 std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    function_tables[libkey].dsyevd_batch_sycl(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                                              batch_size, scratchpad, scratchpad_size);
+}
+sycl::event syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                        std::int64_t stride_a, float *w, std::int64_t stride_w,
+                        std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevd_batch_usm_sycl(queue, jobz, uplo, n, a, lda, stride_a, w,
+                                                         stride_w, batch_size, scratchpad,
+                                                         scratchpad_size, dependencies);
+}
+sycl::event syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                        std::int64_t stride_a, double *w, std::int64_t stride_w,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevd_batch_usm_sycl(queue, jobz, uplo, n, a, lda, stride_a, w,
+                                                         stride_w, batch_size, scratchpad,
+                                                         scratchpad_size, dependencies);
+}
+sycl::event syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+                        oneapi::mkl::uplo *uplo, std::int64_t *n, float **a, std::int64_t *lda,
+                        float **w, std::int64_t group_count, std::int64_t *group_sizes,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].ssyevd_group_usm_sycl(queue, jobz, uplo, n, a, lda, w,
+                                                         group_count, group_sizes, scratchpad,
+                                                         scratchpad_size, dependencies);
+}
+sycl::event syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz,
+                        oneapi::mkl::uplo *uplo, std::int64_t *n, double **a, std::int64_t *lda,
+                        double **w, std::int64_t group_count, std::int64_t *group_sizes,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dsyevd_group_usm_sycl(queue, jobz, uplo, n, a, lda, w,
+                                                         group_count, group_sizes, scratchpad,
+                                                         scratchpad_size, dependencies);
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size) {
+    return function_tables[libkey].ssyevd_batch_scratchpad_size_sycl(
+        queue, jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size) {
+    return function_tables[libkey].dsyevd_batch_scratchpad_size_sycl(
+        queue, jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].ssyevd_group_scratchpad_size_sycl(queue, jobz, uplo, n, lda,
+                                                                     group_count, group_sizes);
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job *jobz, oneapi::mkl::uplo *uplo,
+    std::int64_t *n, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].dsyevd_group_scratchpad_size_sycl(queue, jobz, uplo, n, lda,
+                                                                     group_count, group_sizes);
+}
+void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    function_tables[libkey].sgels_batch_sycl(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                             stride_b, batch_size, scratchpad, scratchpad_size);
+}
+void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    function_tables[libkey].dgels_batch_sycl(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                             stride_b, batch_size, scratchpad, scratchpad_size);
+}
+void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    function_tables[libkey].cgels_batch_sycl(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                             stride_b, batch_size, scratchpad, scratchpad_size);
+}
+void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    function_tables[libkey].zgels_batch_sycl(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                             stride_b, batch_size, scratchpad, scratchpad_size);
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                       std::int64_t m, std::int64_t n, std::int64_t nrhs, float *a,
+                       std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].sgels_batch_usm_sycl(queue, trans, m, n, nrhs, a, lda, stride_a,
+                                                        b, ldb, stride_b, batch_size, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                       std::int64_t m, std::int64_t n, std::int64_t nrhs, double *a,
+                       std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgels_batch_usm_sycl(queue, trans, m, n, nrhs, a, lda, stride_a,
+                                                        b, ldb, stride_b, batch_size, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                       std::int64_t m, std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                       std::int64_t lda, std::int64_t stride_a, std::complex<float> *b,
+                       std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cgels_batch_usm_sycl(queue, trans, m, n, nrhs, a, lda, stride_a,
+                                                        b, ldb, stride_b, batch_size, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                       std::int64_t m, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                       std::int64_t lda, std::int64_t stride_a, std::complex<double> *b,
+                       std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zgels_batch_usm_sycl(queue, trans, m, n, nrhs, a, lda, stride_a,
+                                                        b, ldb, stride_b, batch_size, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].sgels_group_usm_sycl(queue, trans, m, n, nrhs, a, lda, b, ldb,
+                                                        group_count, group_sizes, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda, double **b,
+    std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].dgels_group_usm_sycl(queue, trans, m, n, nrhs, a, lda, b, ldb,
+                                                        group_count, group_sizes, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                       oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+                       std::int64_t *nrhs, std::complex<float> **a, std::int64_t *lda,
+                       std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count,
+                       std::int64_t *group_sizes, std::complex<float> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].cgels_group_usm_sycl(queue, trans, m, n, nrhs, a, lda, b, ldb,
+                                                        group_count, group_sizes, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                       oneapi::mkl::transpose *trans, std::int64_t *m, std::int64_t *n,
+                       std::int64_t *nrhs, std::complex<double> **a, std::int64_t *lda,
+                       std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+                       std::int64_t *group_sizes, std::complex<double> *scratchpad,
+                       std::int64_t scratchpad_size, const std::vector<sycl::event> &dependencies) {
+    return function_tables[libkey].zgels_group_usm_sycl(queue, trans, m, n, nrhs, a, lda, b, ldb,
+                                                        group_count, group_sizes, scratchpad,
+                                                        scratchpad_size, dependencies);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    return function_tables[libkey].sgels_batch_scratchpad_size_sycl(
+        queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    return function_tables[libkey].dgels_batch_scratchpad_size_sycl(
+        queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    return function_tables[libkey].cgels_batch_scratchpad_size_sycl(
+        queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    return function_tables[libkey].zgels_batch_scratchpad_size_sycl(
+        queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].sgels_group_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda,
+                                                                    ldb, group_count, group_sizes);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].dgels_group_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda,
+                                                                    ldb, group_count, group_sizes);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].cgels_group_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda,
+                                                                    ldb, group_count, group_sizes);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *m,
+    std::int64_t *n, std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb,
+    std::int64_t group_count, std::int64_t *group_sizes) {
+    return function_tables[libkey].zgels_group_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda,
+                                                                    ldb, group_count, group_sizes);
+}
 
 } //namespace detail
 } //namespace lapack
@@ -0,0 +1,194 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device *> devices;
+
+namespace {
+
+template <typename fp, typename fp_res>
+int test(device *dev, oneapi::mkl::layout layout, int64_t n, int64_t incx, int64_t batch_size) {
+    // Prepare data.
+    int64_t i;
+
+    int64_t stride_x = n * std::abs(incx);
+
+    vector<fp, allocator_helper<fp, 64>> x(stride_x * batch_size);
+    vector<fp_res> result(batch_size, fp_res(-1)), result_ref(batch_size, fp_res(-1));
+
+    for (i = 0; i < batch_size; i++) {
+        rand_vector(x.data() + stride_x * i, n, incx);
+    }
+
+    // Call reference ASUM_BATCH_STRIDE.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int n_ref = (int)n;
+    int incx_ref = (int)incx;
+
+    for (i = 0; i < batch_size; i++) {
+        result_ref[i] =
+            ::asum<fp_ref, fp_res>(&n_ref, (fp_ref *)x.data() + i * stride_x, &incx_ref);
+    }
+
+    // Call DPC++ ASUM_BATCH_STRIDE.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during ASUM_BATCH_STRIDE:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp_res, 1> result_buffer(result.data(), range<1>(result.size()));
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                oneapi::mkl::blas::column_major::asum_batch(main_queue, n, x_buffer, incx, stride_x,
+                                                            result_buffer, batch_size);
+                break;
+            case oneapi::mkl::layout::row_major:
+                oneapi::mkl::blas::row_major::asum_batch(main_queue, n, x_buffer, incx, stride_x,
+                                                         result_buffer, batch_size);
+                break;
+            default: break;
+        }
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::asum_batch, n,
+                                        x_buffer, incx, stride_x, result_buffer, batch_size);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::asum_batch, n,
+                                        x_buffer, incx, stride_x, result_buffer, batch_size);
+                break;
+            default: break;
+        }
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during ASUM_BATCH_STRIDE:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of ASUM_BATCH_STRIDE:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    auto result_accessor = result_buffer.template get_host_access(read_only);
+    bool good = check_equal_vector(result_accessor.get_pointer(), result_ref.data(), batch_size, 1,
+                                   n, std::cout);
+    return (int)good;
+}
+
+class AsumBatchStrideTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device *, oneapi::mkl::layout>> {};
+
+TEST_P(AsumBatchStrideTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(
+        (test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 15)));
+    EXPECT_TRUEORSKIP(
+        (test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 15)));
+    EXPECT_TRUEORSKIP(
+        (test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 35, 3, 100)));
+}
+
+TEST_P(AsumBatchStrideTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP(
+        (test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 15)));
+    EXPECT_TRUEORSKIP(
+        (test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 15)));
+    EXPECT_TRUEORSKIP(
+        (test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 35, 3, 100)));
+}
+
+TEST_P(AsumBatchStrideTests, ComplexSinglePrecision) {
+    EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
+                                                        std::get<1>(GetParam()), 1357, 2, 15)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
+                                                        std::get<1>(GetParam()), 1357, 1, 15)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
+                                                        std::get<1>(GetParam()), 35, 3, 100)));
+}
+
+TEST_P(AsumBatchStrideTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP((test<std::complex<double>, double>(std::get<0>(GetParam()),
+                                                          std::get<1>(GetParam()), 1357, 2, 15)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, double>(std::get<0>(GetParam()),
+                                                          std::get<1>(GetParam()), 1357, 1, 15)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, double>(std::get<0>(GetParam()),
+                                                          std::get<1>(GetParam()), 35, 3, 100)));
+}
+
+INSTANTIATE_TEST_SUITE_P(AsumBatchStrideTestSuite, AsumBatchStrideTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
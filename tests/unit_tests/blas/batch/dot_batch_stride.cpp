@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device *> devices;
+
+namespace {
+
+template <typename fp>
+int test(device *dev, oneapi::mkl::layout layout, int64_t n, int64_t incx, int64_t incy,
+         int64_t batch_size) {
+    // Prepare data.
+    int64_t i;
+
+    int64_t stride_x, stride_y;
+    stride_x = n * std::abs(incx);
+    stride_y = n * std::abs(incy);
+
+    vector<fp, allocator_helper<fp, 64>> x(stride_x * batch_size);
+    vector<fp, allocator_helper<fp, 64>> y(stride_y * batch_size);
+    vector<fp> result(batch_size, fp(-1)), result_ref(batch_size, fp(-1));
+
+    for (i = 0; i < batch_size; i++) {
+        rand_vector(x.data() + stride_x * i, n, incx);
+        rand_vector(y.data() + stride_y * i, n, incy);
+    }
+
+    // Call reference DOT_BATCH_STRIDE.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int n_ref = (int)n;
+    int incx_ref = (int)incx;
+    int incy_ref = (int)incy;
+
+    for (i = 0; i < batch_size; i++) {
+        result_ref[i] = ::dot<fp_ref, fp_ref>(&n_ref, (fp_ref *)x.data() + i * stride_x, &incx_ref,
+                                              (fp_ref *)y.data() + i * stride_y, &incy_ref);
+    }
+
+    // Call DPC++ DOT_BATCH_STRIDE.
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during DOT_BATCH_STRIDE:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+
+    buffer<fp, 1> x_buffer(x.data(), range<1>(x.size()));
+    buffer<fp, 1> y_buffer(y.data(), range<1>(y.size()));
+    buffer<fp, 1> result_buffer(result.data(), range<1>(result.size()));
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                oneapi::mkl::blas::column_major::dot_batch(main_queue, n, x_buffer, incx, stride_x,
+                                                           y_buffer, incy, stride_y, result_buffer,
+                                                           batch_size);
+                break;
+            case oneapi::mkl::layout::row_major:
+                oneapi::mkl::blas::row_major::dot_batch(main_queue, n, x_buffer, incx, stride_x,
+                                                        y_buffer, incy, stride_y, result_buffer,
+                                                        batch_size);
+                break;
+            default: break;
+        }
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::dot_batch, n,
+                                        x_buffer, incx, stride_x, y_buffer, incy, stride_y,
+                                        result_buffer, batch_size);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::dot_batch, n,
+                                        x_buffer, incx, stride_x, y_buffer, incy, stride_y,
+                                        result_buffer, batch_size);
+                break;
+            default: break;
+        }
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during DOT_BATCH_STRIDE:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of DOT_BATCH_STRIDE:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    auto result_accessor = result_buffer.template get_host_access(read_only);
+    bool good = check_equal_vector(result_accessor.get_pointer(), result_ref.data(), batch_size, 1,
+                                   n, std::cout);
+    return (int)good;
+}
+
+class DotBatchStrideTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device *, oneapi::mkl::layout>> {};
+
+TEST_P(DotBatchStrideTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, 15));
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -2, -3, 15));
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1, 15));
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 35, 1, -2, 100));
+}
+
+TEST_P(DotBatchStrideTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, 15));
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -2, -3, 15));
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1, 15));
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 35, 1, -2, 100));
+}
+
+INSTANTIATE_TEST_SUITE_P(DotBatchStrideTestSuite, DotBatchStrideTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
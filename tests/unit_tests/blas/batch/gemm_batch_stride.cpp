@@ -48,7 +48,7 @@ extern std::vector<sycl::device *> devices;
 namespace {
 
 template <typename fp>
-int test(device *dev, oneapi::mkl::layout layout, int64_t batch_size) {
+int test(device *dev, oneapi::mkl::layout layout, int64_t batch_size, int64_t max_size = 500) {
     // Prepare data.
     int64_t m, n, k;
     int64_t lda, ldb, ldc;
@@ -57,9 +57,9 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t batch_size) {
     int64_t i, tmp;
 
     batch_size = 1 + std::rand() % 20;
-    m = 1 + std::rand() % 500;
-    n = 1 + std::rand() % 500;
-    k = 1 + std::rand() % 500;
+    m = 1 + std::rand() % max_size;
+    n = 1 + std::rand() % max_size;
+    k = 1 + std::rand() % max_size;
     lda = std::max(m, k);
     ldb = std::max(n, k);
     ldc = std::max(m, n);
@@ -218,17 +218,21 @@ TEST_P(GemmBatchStrideTests, RealHalfPrecision) {
 
 TEST_P(GemmBatchStrideTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, 32));
 }
 
 TEST_P(GemmBatchStrideTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
 
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, 32));
 }
 
 TEST_P(GemmBatchStrideTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(
         test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, 32));
 }
 
 TEST_P(GemmBatchStrideTests, ComplexDoublePrecision) {
@@ -236,6 +240,8 @@ TEST_P(GemmBatchStrideTests, ComplexDoublePrecision) {
 
     EXPECT_TRUEORSKIP(
         test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, 32));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmBatchStrideTestSuite, GemmBatchStrideTests,
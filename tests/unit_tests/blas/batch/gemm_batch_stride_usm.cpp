@@ -48,7 +48,7 @@ extern std::vector<sycl::device *> devices;
 namespace {
 
 template <typename fp>
-int test(device *dev, oneapi::mkl::layout layout, int64_t batch_size) {
+int test(device *dev, oneapi::mkl::layout layout, int64_t batch_size, int64_t max_size = 500) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const &e : exceptions) {
@@ -77,9 +77,9 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t batch_size) {
     int64_t i, tmp;
 
     batch_size = 1 + std::rand() % 20;
-    m = 1 + std::rand() % 500;
-    n = 1 + std::rand() % 500;
-    k = 1 + std::rand() % 500;
+    m = 1 + std::rand() % max_size;
+    n = 1 + std::rand() % max_size;
+    k = 1 + std::rand() % max_size;
     lda = std::max(m, k);
     ldb = std::max(n, k);
     ldc = std::max(m, n);
@@ -251,17 +251,21 @@ TEST_P(GemmBatchStrideUsmTests, RealHalfPrecision) {
 
 TEST_P(GemmBatchStrideUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, 32));
 }
 
 TEST_P(GemmBatchStrideUsmTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
 
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, 32));
 }
 
 TEST_P(GemmBatchStrideUsmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(
         test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, 32));
 }
 
 TEST_P(GemmBatchStrideUsmTests, ComplexDoublePrecision) {
@@ -269,6 +273,8 @@ TEST_P(GemmBatchStrideUsmTests, ComplexDoublePrecision) {
 
     EXPECT_TRUEORSKIP(
         test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, 32));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmBatchStrideUsmTestSuite, GemmBatchStrideUsmTests,
@@ -48,7 +48,7 @@ extern std::vector<sycl::device *> devices;
 namespace {
 
 template <typename fp>
-int test(device *dev, oneapi::mkl::layout layout, int64_t group_count) {
+int test(device *dev, oneapi::mkl::layout layout, int64_t group_count, bool mixed_sizes = false) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const &e : exceptions) {
@@ -97,10 +97,25 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t group_count) {
     int64_t size_a = 0, size_b = 0, size_c = 0;
 
     for (i = 0; i < group_count; i++) {
+        int64_t min_size = 1, max_size = 500;
         group_size[i] = 1 + std::rand() % 20;
-        m[i] = 1 + std::rand() % 500;
-        n[i] = 1 + std::rand() % 500;
-        k[i] = 1 + std::rand() % 500;
+        if (mixed_sizes) {
+            // Groups cycle through products larger than 256^3, small products
+            //  and empty groups, so that reordering the products by size mixes
+            //  the groups.
+            switch (i % 3) {
+                case 0:
+                    group_size[i] = 1 + std::rand() % 2;
+                    min_size = 257;
+                    max_size = 300;
+                    break;
+                case 1: max_size = 40; break;
+                default: group_size[i] = 0; break;
+            }
+        }
+        m[i] = min_size + std::rand() % (max_size - min_size + 1);
+        n[i] = min_size + std::rand() % (max_size - min_size + 1);
+        k[i] = min_size + std::rand() % (max_size - min_size + 1);
         lda[i] = std::max(m[i], k[i]);
         ldb[i] = std::max(n[i], k[i]);
         ldc[i] = std::max(m[i], n[i]);
@@ -339,17 +354,21 @@ TEST_P(GemmBatchUsmTests, RealHalfPrecision) {
 
 TEST_P(GemmBatchUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 7, true));
 }
 
 TEST_P(GemmBatchUsmTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
 
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 7, true));
 }
 
 TEST_P(GemmBatchUsmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(
         test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 7, true));
 }
 
 TEST_P(GemmBatchUsmTests, ComplexDoublePrecision) {
@@ -357,6 +376,8 @@ TEST_P(GemmBatchUsmTests, ComplexDoublePrecision) {
 
     EXPECT_TRUEORSKIP(
         test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 7, true));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmBatchUsmTestSuite, GemmBatchUsmTests,
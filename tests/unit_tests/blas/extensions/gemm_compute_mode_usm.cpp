@@ -0,0 +1,214 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+         oneapi::mkl::transpose transb, oneapi::mkl::compute_mode mode, int m, int n, int k,
+         int lda, int ldb, int ldc, fp alpha, fp beta) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+
+    auto C_ref = C;
+
+    // Call Reference GEMM.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &ldc_ref);
+
+    // Call DPC++ GEMM with the compute mode.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                done = oneapi::mkl::blas::column_major::gemm(main_queue, transa, transb, m, n, k,
+                                                             alpha, A.data(), lda, B.data(), ldb,
+                                                             beta, C.data(), ldc, mode,
+                                                             dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::gemm(main_queue, transa, transb, m, n, k,
+                                                          alpha, A.data(), lda, B.data(), ldb, beta,
+                                                          C.data(), ldc, mode, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm, transa,
+                                        transb, m, n, k, alpha, A.data(), lda, B.data(), ldb, beta,
+                                        C.data(), ldc, mode, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm, transa,
+                                        transb, m, n, k, alpha, A.data(), lda, B.data(), ldb, beta,
+                                        C.data(), ldc, mode, dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation. bfloat16
+    // operands keep 8 bits of the significand.
+    const int error_mag = mode == oneapi::mkl::compute_mode::float_to_bf16 ? k << 12 : 20 * k;
+    bool good = check_equal_matrix(C, C_ref, layout, m, n, ldc, error_mag, std::cout);
+
+    return (int)good;
+}
+
+class GemmComputeModeUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(GemmComputeModeUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    for (auto mode :
+         { oneapi::mkl::compute_mode::unset, oneapi::mkl::compute_mode::float_to_bf16,
+           oneapi::mkl::compute_mode::float_to_bf16x2, oneapi::mkl::compute_mode::float_to_bf16x3,
+           oneapi::mkl::compute_mode::float_to_tf32, oneapi::mkl::compute_mode::any }) {
+        EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                      oneapi::mkl::transpose::nontrans,
+                                      oneapi::mkl::transpose::nontrans, mode, 79, 83, 91, 103, 105,
+                                      106, alpha, beta));
+        EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                      oneapi::mkl::transpose::trans, oneapi::mkl::transpose::trans,
+                                      mode, 79, 83, 91, 103, 105, 106, alpha, beta));
+    }
+}
+
+TEST_P(GemmComputeModeUsmTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::transpose::nontrans,
+                                   oneapi::mkl::transpose::trans, oneapi::mkl::compute_mode::any,
+                                   79, 83, 91, 103, 105, 106, alpha, beta));
+}
+
+TEST_P(GemmComputeModeUsmTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0);
+    std::complex<float> beta(3.0);
+    for (auto mode : { oneapi::mkl::compute_mode::complex_3m, oneapi::mkl::compute_mode::any }) {
+        EXPECT_TRUEORSKIP(test<std::complex<float>>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+            oneapi::mkl::transpose::nontrans, mode, 79, 83, 91, 103, 105, 106, alpha, beta));
+        EXPECT_TRUEORSKIP(test<std::complex<float>>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+            oneapi::mkl::transpose::trans, mode, 79, 83, 91, 103, 105, 106, alpha, beta));
+    }
+}
+
+TEST_P(GemmComputeModeUsmTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    std::complex<double> alpha(2.0);
+    std::complex<double> beta(3.0);
+    for (auto mode : { oneapi::mkl::compute_mode::complex_3m, oneapi::mkl::compute_mode::any }) {
+        EXPECT_TRUEORSKIP(test<std::complex<double>>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+            oneapi::mkl::transpose::nontrans, mode, 79, 83, 91, 103, 105, 106, alpha, beta));
+        EXPECT_TRUEORSKIP(test<std::complex<double>>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+            oneapi::mkl::transpose::trans, mode, 79, 83, 91, 103, 105, 106, alpha, beta));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmComputeModeUsmTestSuite, GemmComputeModeUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,247 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Reference epilogue, applied to the result of the reference gemm.
+template <typename fp>
+void epilogue_ref(std::vector<fp>& C, oneapi::mkl::layout layout, int m, int n, int ldc,
+                  const std::vector<fp>& bias, oneapi::mkl::epilogue_desc epilogue) {
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            fp& c = (layout == oneapi::mkl::layout::col_major) ? C[i + j * ldc] : C[j + i * ldc];
+            double x = c;
+            if (epilogue.bias == oneapi::mkl::epilogue_bias::row)
+                x += bias[j];
+            if (epilogue.bias == oneapi::mkl::epilogue_bias::column)
+                x += bias[i];
+            switch (epilogue.act) {
+                case oneapi::mkl::activation::relu: x = std::max(x, 0.0); break;
+                case oneapi::mkl::activation::gelu_tanh:
+                    x = 0.5 * x *
+                        (1.0 + std::tanh(0.7978845608028654 * (x + 0.044715 * x * x * x)));
+                    break;
+                case oneapi::mkl::activation::gelu_erf:
+                    x = 0.5 * x * (1.0 + std::erf(x * 0.7071067811865476));
+                    break;
+                default: break;
+            }
+            c = fp(epilogue.scale * x);
+        }
+    }
+}
+
+template <typename fp, typename fp_c>
+int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+         oneapi::mkl::transpose transb, int m, int n, int k, int lda, int ldb, int ldc, fp alpha,
+         fp beta, oneapi::mkl::epilogue_desc epilogue) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_EPILOGUE:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data. C is generated in the type of the product and converted.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    auto uc = usm_allocator<fp_c, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C_in(ua), bias(ua);
+    vector<fp_c, decltype(uc)> C(uc);
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C_in, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    rand_vector(bias, std::max(m, n), 1);
+    for (auto x : C_in)
+        C.push_back(fp_c(x));
+
+    std::vector<fp> C_ref(C.begin(), C.end());
+    std::vector<fp> bias_ref(bias.begin(), bias.end());
+
+    // Call Reference GEMM and apply the epilogue.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &ldc_ref);
+    epilogue_ref(C_ref, layout, m, n, ldc, bias_ref, epilogue);
+
+    // Call DPC++ GEMM_EPILOGUE.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                done = oneapi::mkl::blas::column_major::gemm_epilogue(
+                    main_queue, transa, transb, m, n, k, alpha, A.data(), lda, B.data(), ldb, beta,
+                    C.data(), ldc, bias.data(), epilogue, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::gemm_epilogue(
+                    main_queue, transa, transb, m, n, k, alpha, A.data(), lda, B.data(), ldb, beta,
+                    C.data(), ldc, bias.data(), epilogue, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_epilogue,
+                                        transa, transb, m, n, k, alpha, A.data(), lda, B.data(),
+                                        ldb, beta, C.data(), ldc, bias.data(), epilogue,
+                                        dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_epilogue,
+                                        transa, transb, m, n, k, alpha, A.data(), lda, B.data(),
+                                        ldb, beta, C.data(), ldc, bias.data(), epilogue,
+                                        dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_EPILOGUE:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_EPILOGUE:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    // A bfloat16 C is compared in the type of the product, with the precision
+    // of bfloat16.
+    std::vector<fp> C_out(C.begin(), C.end());
+    const int error_mag = std::is_same_v<fp, fp_c> ? 10 * k : 1 << 16;
+    bool good = check_equal_matrix(C_out, C_ref, layout, m, n, ldc, error_mag, std::cout);
+
+    return (int)good;
+}
+
+class GemmEpilogueUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(GemmEpilogueUsmTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    oneapi::mkl::epilogue_desc relu{ oneapi::mkl::epilogue_bias::row,
+                                     oneapi::mkl::activation::relu, 1.0 };
+    oneapi::mkl::epilogue_desc gelu{ oneapi::mkl::epilogue_bias::column,
+                                     oneapi::mkl::activation::gelu_tanh, 0.5 };
+    EXPECT_TRUEORSKIP((test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                          oneapi::mkl::transpose::nontrans,
+                                          oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105,
+                                          106, alpha, beta, relu)));
+    EXPECT_TRUEORSKIP((test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                          oneapi::mkl::transpose::trans,
+                                          oneapi::mkl::transpose::nontrans, 279, 283, 391, 403,
+                                          405, 406, alpha, beta, gelu)));
+    EXPECT_TRUEORSKIP((test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                          oneapi::mkl::transpose::nontrans,
+                                          oneapi::mkl::transpose::trans, 7, 5, 9, 13, 15, 16,
+                                          alpha, 0.0f, oneapi::mkl::epilogue_desc{})));
+}
+
+TEST_P(GemmEpilogueUsmTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    double alpha(2.0);
+    double beta(3.0);
+    oneapi::mkl::epilogue_desc gelu{ oneapi::mkl::epilogue_bias::row,
+                                     oneapi::mkl::activation::gelu_erf, 2.0 };
+    EXPECT_TRUEORSKIP((test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                            oneapi::mkl::transpose::trans,
+                                            oneapi::mkl::transpose::trans, 279, 283, 391, 403, 405,
+                                            406, alpha, beta, gelu)));
+}
+
+TEST_P(GemmEpilogueUsmTests, RealSinglePrecisionToBfloat16) {
+    float alpha(2.0);
+    float beta(0.0);
+    oneapi::mkl::epilogue_desc relu{ oneapi::mkl::epilogue_bias::column,
+                                     oneapi::mkl::activation::relu, 0.25 };
+    EXPECT_TRUEORSKIP((test<float, oneapi::mkl::bfloat16>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 279, 283, 391, 403, 405, 406, alpha, beta, relu)));
+    EXPECT_TRUEORSKIP((test<float, oneapi::mkl::bfloat16>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105, 106, alpha, 3.0f,
+        oneapi::mkl::epilogue_desc{})));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmEpilogueUsmTestSuite, GemmEpilogueUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,288 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+template <typename fp>
+int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::pack_matrix which,
+         oneapi::mkl::transpose transa, oneapi::mkl::transpose transb, int m, int n, int k,
+         int lda, int ldb, int ldc, fp alpha, fp beta) {
+    // Prepare data. The packed operand is multiplied with two different other
+    // operands, A and A2 or B and B2.
+    vector<fp, allocator_helper<fp, 64>> A, A2, B, B2, C, C2, C_ref, C2_ref;
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(A2, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(B2, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    C2 = C;
+
+    const bool pack_a = (which == oneapi::mkl::pack_matrix::a);
+    auto& A_second = pack_a ? A : A2;
+    auto& B_second = pack_a ? B2 : B;
+    C_ref = C;
+    C2_ref = C;
+
+    // Call Reference GEMM.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &ldc_ref);
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A_second.data(), &lda_ref, (fp_ref*)B_second.data(), &ldb_ref,
+           (fp_ref*)&beta, (fp_ref*)C2_ref.data(), &ldc_ref);
+
+    // Call DPC++ GEMM_PACK and GEMM_COMPUTE.
+
+    // Catch asynchronous exceptions
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM_PACK:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+
+    buffer<fp, 1> A_buffer(A.data(), range<1>(A.size()));
+    buffer<fp, 1> B_buffer(B.data(), range<1>(B.size()));
+    buffer<fp, 1> A2_buffer(A2.data(), range<1>(A2.size()));
+    buffer<fp, 1> B2_buffer(B2.data(), range<1>(B2.size()));
+    buffer<fp, 1> C_buffer(C.data(), range<1>(C.size()));
+    buffer<fp, 1> C2_buffer(C2.data(), range<1>(C2.size()));
+
+    // The packed operand and the other operand of each product.
+    auto& X_buffer = pack_a ? A_buffer : B_buffer;
+    auto& Y_buffer = pack_a ? B_buffer : A_buffer;
+    auto& Y2_buffer = pack_a ? B2_buffer : A2_buffer;
+    const int ldx = pack_a ? lda : ldb;
+    const int ldy = pack_a ? ldb : lda;
+    const auto transx = pack_a ? transa : transb;
+    const auto transy = pack_a ? transb : transa;
+
+    try {
+        std::int64_t size = 0;
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                size = oneapi::mkl::blas::column_major::gemm_pack_get_size<fp>(main_queue, which,
+                                                                               m, n, k);
+                break;
+            case oneapi::mkl::layout::row_major:
+                size = oneapi::mkl::blas::row_major::gemm_pack_get_size<fp>(main_queue, which, m,
+                                                                            n, k);
+                break;
+            default: break;
+        }
+        buffer<fp, 1> packed_buffer(range<1>(std::max<std::int64_t>(size, 1)));
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                oneapi::mkl::blas::column_major::gemm_pack(main_queue, which, transx, m, n, k,
+                                                           alpha, X_buffer, ldx, packed_buffer);
+                oneapi::mkl::blas::column_major::gemm_compute(main_queue, which, transy, m, n, k,
+                                                              packed_buffer, Y_buffer, ldy, beta,
+                                                              C_buffer, ldc);
+                oneapi::mkl::blas::column_major::gemm_compute(main_queue, which, transy, m, n, k,
+                                                              packed_buffer, Y2_buffer, ldy, beta,
+                                                              C2_buffer, ldc);
+                break;
+            case oneapi::mkl::layout::row_major:
+                oneapi::mkl::blas::row_major::gemm_pack(main_queue, which, transx, m, n, k, alpha,
+                                                        X_buffer, ldx, packed_buffer);
+                oneapi::mkl::blas::row_major::gemm_compute(main_queue, which, transy, m, n, k,
+                                                           packed_buffer, Y_buffer, ldy, beta,
+                                                           C_buffer, ldc);
+                oneapi::mkl::blas::row_major::gemm_compute(main_queue, which, transy, m, n, k,
+                                                           packed_buffer, Y2_buffer, ldy, beta,
+                                                           C2_buffer, ldc);
+                break;
+            default: break;
+        }
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(
+                    main_queue, size = oneapi::mkl::blas::column_major::gemm_pack_get_size<fp>,
+                    which, m, n, k);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(
+                    main_queue, size = oneapi::mkl::blas::row_major::gemm_pack_get_size<fp>, which,
+                    m, n, k);
+                break;
+            default: break;
+        }
+        buffer<fp, 1> packed_buffer(range<1>(std::max<std::int64_t>(size, 1)));
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_pack,
+                                        which, transx, m, n, k, alpha, X_buffer, ldx,
+                                        packed_buffer);
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_compute,
+                                        which, transy, m, n, k, packed_buffer, Y_buffer, ldy, beta,
+                                        C_buffer, ldc);
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm_compute,
+                                        which, transy, m, n, k, packed_buffer, Y2_buffer, ldy,
+                                        beta, C2_buffer, ldc);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_pack, which,
+                                        transx, m, n, k, alpha, X_buffer, ldx, packed_buffer);
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_compute,
+                                        which, transy, m, n, k, packed_buffer, Y_buffer, ldy, beta,
+                                        C_buffer, ldc);
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm_compute,
+                                        which, transy, m, n, k, packed_buffer, Y2_buffer, ldy,
+                                        beta, C2_buffer, ldc);
+                break;
+            default: break;
+        }
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_PACK:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_PACK:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    auto C_accessor = C_buffer.template get_host_access(read_only);
+    bool good = check_equal_matrix(C_accessor, C_ref, layout, m, n, ldc, 10 * k, std::cout);
+    auto C2_accessor = C2_buffer.template get_host_access(read_only);
+    good = good && check_equal_matrix(C2_accessor, C2_ref, layout, m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+}
+
+class GemmPackTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(GemmPackTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    for (auto which : { oneapi::mkl::pack_matrix::a, oneapi::mkl::pack_matrix::b }) {
+        EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), which,
+                                      oneapi::mkl::transpose::nontrans,
+                                      oneapi::mkl::transpose::nontrans, 79, 83, 91, 103, 105, 106,
+                                      alpha, beta));
+        EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), which,
+                                      oneapi::mkl::transpose::trans,
+                                      oneapi::mkl::transpose::nontrans, 279, 283, 391, 403, 405,
+                                      406, alpha, beta));
+        EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), which,
+                                      oneapi::mkl::transpose::nontrans,
+                                      oneapi::mkl::transpose::trans, 7, 5, 9, 13, 15, 16, alpha,
+                                      beta));
+    }
+}
+
+TEST_P(GemmPackTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    double alpha(2.0);
+    double beta(3.0);
+    for (auto which : { oneapi::mkl::pack_matrix::a, oneapi::mkl::pack_matrix::b }) {
+        EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), which,
+                                       oneapi::mkl::transpose::trans, oneapi::mkl::transpose::trans,
+                                       279, 283, 391, 403, 405, 406, alpha, beta));
+    }
+}
+
+TEST_P(GemmPackTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    std::complex<float> beta(3.0, 1.0);
+    for (auto which : { oneapi::mkl::pack_matrix::a, oneapi::mkl::pack_matrix::b }) {
+        EXPECT_TRUEORSKIP(test<std::complex<float>>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), which,
+            oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, 79, 83, 91, 103,
+            105, 106, alpha, beta));
+        EXPECT_TRUEORSKIP(test<std::complex<float>>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), which,
+            oneapi::mkl::transpose::conjtrans, oneapi::mkl::transpose::trans, 279, 283, 391, 403,
+            405, 406, alpha, beta));
+    }
+}
+
+TEST_P(GemmPackTests, ComplexDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    std::complex<double> alpha(2.0, -0.5);
+    std::complex<double> beta(3.0, 1.0);
+    for (auto which : { oneapi::mkl::pack_matrix::a, oneapi::mkl::pack_matrix::b }) {
+        EXPECT_TRUEORSKIP(test<std::complex<double>>(
+            std::get<0>(GetParam()), std::get<1>(GetParam()), which, oneapi::mkl::transpose::trans,
+            oneapi::mkl::transpose::conjtrans, 279, 283, 391, 403, 405, 406, alpha, beta));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmPackTestSuite, GemmPackTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
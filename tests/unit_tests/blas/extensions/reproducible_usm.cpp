@@ -0,0 +1,270 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Results are compared bit for bit across processes through a file. With
+//  ONEMKL_TEST_REPRODUCIBLE_RECORD set, the test writes its results to that
+//  file; with ONEMKL_TEST_REPRODUCIBLE_CHECK set, it compares them with the
+//  ones recorded earlier, e.g. by a run with another number of threads.
+bool record_or_check(const std::string& routine, const void* data, size_t bytes) {
+    static const char digits[] = "0123456789abcdef";
+    const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+    const std::string key =
+        std::string(info->test_suite_name()) + "." + info->name() + "." + routine;
+    std::string value;
+    for (size_t i = 0; i < bytes; i++) {
+        const unsigned char byte = static_cast<const unsigned char*>(data)[i];
+        value += digits[byte >> 4];
+        value += digits[byte & 15];
+    }
+
+    if (const char* path = std::getenv("ONEMKL_TEST_REPRODUCIBLE_RECORD")) {
+        static bool started = false;
+        std::ofstream out(path, started ? std::ios::app : std::ios::trunc);
+        started = true;
+        out << key << " " << value << "\n";
+        return static_cast<bool>(out);
+    }
+    if (const char* path = std::getenv("ONEMKL_TEST_REPRODUCIBLE_CHECK")) {
+        std::ifstream in(path);
+        std::string recorded_key, recorded_value;
+        while (in >> recorded_key >> recorded_value) {
+            if (recorded_key == key) {
+                if (recorded_value != value)
+                    std::cout << "Result of " << key << " differs from the one in " << path
+                              << std::endl;
+                return recorded_value == value;
+            }
+        }
+        std::cout << "No result for " << key << " in " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+template <typename fp>
+int test(device* dev, oneapi::mkl::layout layout, int N, int m, int n, int k) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during REPRODUCIBLE:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data. Every process draws the same data so that its results can
+    //  be compared with those of another run.
+    std::srand(1);
+    const auto transa = oneapi::mkl::transpose::nontrans;
+    const auto transb = oneapi::mkl::transpose::trans;
+    const int lda = (layout == oneapi::mkl::layout::col_major) ? m : k;
+    const int ldb = (layout == oneapi::mkl::layout::col_major) ? n : k;
+    const int ldc = (layout == oneapi::mkl::layout::col_major) ? m : n;
+    fp alpha(2.0), beta(3.0);
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua), A(ua), B(ua), C(ua);
+    rand_vector(x, N, 1);
+    rand_vector(y, N, 1);
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    vector<fp> C_ref(C.begin(), C.end());
+
+    // Call Reference DOT, NRM2, ASUM and GEMM.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int N_ref = N, inc_ref = 1;
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    fp dot_ref = ::dot<fp, fp>(&N_ref, (fp*)x.data(), &inc_ref, (fp*)y.data(), &inc_ref);
+    fp nrm2_ref = ::nrm2<fp_ref, fp>(&N_ref, (fp_ref*)x.data(), &inc_ref);
+    fp asum_ref = ::asum<fp_ref, fp>(&N_ref, (fp_ref*)x.data(), &inc_ref);
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &ldc_ref);
+
+    // Call DPC++ DOT, NRM2, ASUM and GEMM.
+
+    fp* result_p = (fp*)oneapi::mkl::malloc_shared(64, 3 * sizeof(fp), *dev, cxt);
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                oneapi::mkl::blas::column_major::dot(main_queue, N, x.data(), 1, y.data(), 1,
+                                                     result_p, dependencies)
+                    .wait();
+                oneapi::mkl::blas::column_major::nrm2(main_queue, N, x.data(), 1, result_p + 1,
+                                                      dependencies)
+                    .wait();
+                oneapi::mkl::blas::column_major::asum(main_queue, N, x.data(), 1, result_p + 2,
+                                                      dependencies)
+                    .wait();
+                done = oneapi::mkl::blas::column_major::gemm(main_queue, transa, transb, m, n, k,
+                                                             alpha, A.data(), lda, B.data(), ldb,
+                                                             beta, C.data(), ldc, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                oneapi::mkl::blas::row_major::dot(main_queue, N, x.data(), 1, y.data(), 1,
+                                                  result_p, dependencies)
+                    .wait();
+                oneapi::mkl::blas::row_major::nrm2(main_queue, N, x.data(), 1, result_p + 1,
+                                                   dependencies)
+                    .wait();
+                oneapi::mkl::blas::row_major::asum(main_queue, N, x.data(), 1, result_p + 2,
+                                                   dependencies)
+                    .wait();
+                done = oneapi::mkl::blas::row_major::gemm(main_queue, transa, transb, m, n, k,
+                                                          alpha, A.data(), lda, B.data(), ldb, beta,
+                                                          C.data(), ldc, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::col_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::dot, N,
+                                        x.data(), 1, y.data(), 1, result_p, dependencies);
+                main_queue.wait();
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::nrm2, N,
+                                        x.data(), 1, result_p + 1, dependencies);
+                main_queue.wait();
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::asum, N,
+                                        x.data(), 1, result_p + 2, dependencies);
+                main_queue.wait();
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::gemm, transa,
+                                        transb, m, n, k, alpha, A.data(), lda, B.data(), ldb,
+                                        beta, C.data(), ldc, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::dot, N, x.data(),
+                                        1, y.data(), 1, result_p, dependencies);
+                main_queue.wait();
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::nrm2, N, x.data(),
+                                        1, result_p + 1, dependencies);
+                main_queue.wait();
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::asum, N, x.data(),
+                                        1, result_p + 2, dependencies);
+                main_queue.wait();
+                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::gemm, transa,
+                                        transb, m, n, k, alpha, A.data(), lda, B.data(), ldb,
+                                        beta, C.data(), ldc, dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during REPRODUCIBLE:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        oneapi::mkl::free_usm(result_p, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of REPRODUCIBLE:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation,
+    //  then bit for bit with a recorded run if one was requested.
+    bool good = check_equal(result_p[0], dot_ref, N, std::cout) &&
+                check_equal(result_p[1], nrm2_ref, N, std::cout) &&
+                check_equal(result_p[2], asum_ref, N, std::cout) &&
+                check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * k, std::cout);
+    good = good && record_or_check("dot", result_p, sizeof(fp)) &&
+           record_or_check("nrm2", result_p + 1, sizeof(fp)) &&
+           record_or_check("asum", result_p + 2, sizeof(fp)) &&
+           record_or_check("gemm", C.data(), C.size() * sizeof(fp));
+    oneapi::mkl::free_usm(result_p, cxt);
+
+    return (int)good;
+}
+
+class ReproducibleUsmTests
+        : public ::testing::TestWithParam<std::tuple<sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(ReproducibleUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 100003, 9, 14, 8191));
+}
+
+TEST_P(ReproducibleUsmTests, RealDoublePrecision) {
+    CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
+
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 100003, 9, 14, 8191));
+}
+
+INSTANTIATE_TEST_SUITE_P(ReproducibleUsmTestSuite, ReproducibleUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::col_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
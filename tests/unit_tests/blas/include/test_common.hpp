@@ -91,6 +91,19 @@ sycl::buffer<typename vec::value_type, 1> make_buffer(const vec &v) {
     return buf;
 }
 
+// Buffer setups exercising the netlib direct host path: every buffer backed by
+//  host memory, only some of them, or one host-backed buffer passed for two
+//  arguments.
+enum class host_buffers { none, all, mixed, aliased };
+
+// SYCL buffer backed directly by the vector's storage.
+template <typename vec>
+sycl::buffer<typename vec::value_type, 1> make_host_ptr_buffer(vec &v) {
+    sycl::buffer<typename vec::value_type, 1> buf(v.data(), sycl::range<1>(v.size()),
+                                                  { sycl::property::buffer::use_host_ptr() });
+    return buf;
+}
+
 // Reference helpers.
 template <typename T>
 struct ref_type_info {
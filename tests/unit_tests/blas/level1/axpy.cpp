@@ -46,10 +46,15 @@ extern std::vector<sycl::device *> devices;
 namespace {
 
 template <typename fp>
-int test(device *dev, oneapi::mkl::layout layout, int N, int incx, int incy, fp alpha) {
+int test(device *dev, oneapi::mkl::layout layout, int N, int incx, int incy, fp alpha,
+         host_buffers buffers = host_buffers::none) {
     // Prepare data.
     vector<fp> x, y, y_ref;
 
+    // An aliased call passes y for x as well.
+    if (buffers == host_buffers::aliased)
+        incx = incy;
+
     rand_vector(x, N, incx);
     rand_vector(y, N, incy);
     y_ref = y;
@@ -58,8 +63,13 @@ int test(device *dev, oneapi::mkl::layout layout, int N, int incx, int incy, fp
     using fp_ref = typename ref_type_info<fp>::type;
     const int N_ref = N, incx_ref = incx, incy_ref = incy;
 
-    ::axpy(&N_ref, (fp_ref *)&alpha, (fp_ref *)x.data(), &incx_ref, (fp_ref *)y_ref.data(),
-           &incy_ref);
+    // Buffers backed by host memory take the direct host path on CPU devices, so
+    //  run twice to check that the second call sees the first one's result.
+    const int reps = (buffers != host_buffers::none) ? 2 : 1;
+    fp *x_ref = (buffers == host_buffers::aliased) ? y_ref.data() : x.data();
+    for (int rep = 0; rep < reps; rep++)
+        ::axpy(&N_ref, (fp_ref *)&alpha, (fp_ref *)x_ref, &incx_ref, (fp_ref *)y_ref.data(),
+               &incy_ref);
 
     // Call DPC++ AXPY.
 
@@ -79,35 +89,40 @@ int test(device *dev, oneapi::mkl::layout layout, int N, int incx, int incy, fp
 
     queue main_queue(*dev, exception_handler);
 
-    buffer<fp, 1> x_buffer = make_buffer(x);
-    buffer<fp, 1> y_buffer = make_buffer(y);
+    buffer<fp, 1> y_buffer = (buffers != host_buffers::none) ? make_host_ptr_buffer(y)
+                                                             : make_buffer(y);
+    buffer<fp, 1> x_buffer = (buffers == host_buffers::aliased) ? y_buffer
+                             : (buffers == host_buffers::all)   ? make_host_ptr_buffer(x)
+                                                                : make_buffer(x);
 
     try {
+        for (int rep = 0; rep < reps; rep++) {
 #ifdef CALL_RT_API
-        switch (layout) {
-            case oneapi::mkl::layout::col_major:
-                oneapi::mkl::blas::column_major::axpy(main_queue, N, alpha, x_buffer, incx,
-                                                      y_buffer, incy);
-                break;
-            case oneapi::mkl::layout::row_major:
-                oneapi::mkl::blas::row_major::axpy(main_queue, N, alpha, x_buffer, incx, y_buffer,
-                                                   incy);
-                break;
-            default: break;
-        }
+            switch (layout) {
+                case oneapi::mkl::layout::col_major:
+                    oneapi::mkl::blas::column_major::axpy(main_queue, N, alpha, x_buffer, incx,
+                                                          y_buffer, incy);
+                    break;
+                case oneapi::mkl::layout::row_major:
+                    oneapi::mkl::blas::row_major::axpy(main_queue, N, alpha, x_buffer, incx,
+                                                       y_buffer, incy);
+                    break;
+                default: break;
+            }
 #else
-        switch (layout) {
-            case oneapi::mkl::layout::col_major:
-                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::axpy, N, alpha,
-                                        x_buffer, incx, y_buffer, incy);
-                break;
-            case oneapi::mkl::layout::row_major:
-                TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::axpy, N, alpha,
-                                        x_buffer, incx, y_buffer, incy);
-                break;
-            default: break;
-        }
+            switch (layout) {
+                case oneapi::mkl::layout::col_major:
+                    TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::axpy, N,
+                                            alpha, x_buffer, incx, y_buffer, incy);
+                    break;
+                case oneapi::mkl::layout::row_major:
+                    TEST_RUN_BLAS_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::axpy, N,
+                                            alpha, x_buffer, incx, y_buffer, incy);
+                    break;
+                default: break;
+            }
 #endif
+        }
     }
     catch (exception const &e) {
         std::cout << "Caught synchronous SYCL exception during AXPY:\n" << e.what() << std::endl;
@@ -139,8 +154,16 @@ TEST_P(AxpyTests, RealSinglePrecision) {
         test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, alpha));
     EXPECT_TRUEORSKIP(
         test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1, alpha));
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 100000, 1, 1, alpha));
     EXPECT_TRUEORSKIP(
         test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2, alpha));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                  alpha, host_buffers::all));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                  alpha, host_buffers::mixed));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                  alpha, host_buffers::aliased));
 }
 TEST_P(AxpyTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
@@ -150,8 +173,16 @@ TEST_P(AxpyTests, RealDoublePrecision) {
         test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, alpha));
     EXPECT_TRUEORSKIP(
         test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1, alpha));
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 100000, 1, 1, alpha));
     EXPECT_TRUEORSKIP(
         test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2, alpha));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                   alpha, host_buffers::all));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                   alpha, host_buffers::mixed));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3,
+                                   alpha, host_buffers::aliased));
 }
 TEST_P(AxpyTests, ComplexSinglePrecision) {
     std::complex<float> alpha(2.0, -0.5);
@@ -161,6 +192,12 @@ TEST_P(AxpyTests, ComplexSinglePrecision) {
                                                 1357, 1, 1, alpha));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                                 1357, -3, -2, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                1357, 2, 3, alpha, host_buffers::all));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                1357, 2, 3, alpha, host_buffers::mixed));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                1357, 2, 3, alpha, host_buffers::aliased));
 }
 TEST_P(AxpyTests, ComplexDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
@@ -172,6 +209,12 @@ TEST_P(AxpyTests, ComplexDoublePrecision) {
                                                  1357, 1, 1, alpha));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                                  1357, -3, -2, alpha));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 1357, 2, 3, alpha, host_buffers::all));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 1357, 2, 3, alpha, host_buffers::mixed));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 1357, 2, 3, alpha, host_buffers::aliased));
 }
 
 INSTANTIATE_TEST_SUITE_P(AxpyTestSuite, AxpyTests,
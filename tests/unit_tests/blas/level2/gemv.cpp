@@ -48,7 +48,8 @@ namespace {
 
 template <typename fp>
 int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa, int m, int n,
-         fp alpha, fp beta, int incx, int incy, int lda) {
+         fp alpha, fp beta, int incx, int incy, int lda,
+         host_buffers buffers = host_buffers::none) {
     // Prepare data.
     int x_len = outer_dimension(transa, m, n);
     int y_len = inner_dimension(transa, m, n);
@@ -86,9 +87,12 @@ int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
 
     queue main_queue(*dev, exception_handler);
 
-    buffer<fp, 1> x_buffer = make_buffer(x);
-    buffer<fp, 1> y_buffer = make_buffer(y);
-    buffer<fp, 1> A_buffer = make_buffer(A);
+    buffer<fp, 1> x_buffer = (buffers != host_buffers::none) ? make_host_ptr_buffer(x)
+                                                             : make_buffer(x);
+    buffer<fp, 1> y_buffer = (buffers != host_buffers::none) ? make_host_ptr_buffer(y)
+                                                             : make_buffer(y);
+    buffer<fp, 1> A_buffer = (buffers == host_buffers::all) ? make_host_ptr_buffer(A)
+                                                            : make_buffer(A);
 
     try {
 #ifdef CALL_RT_API
@@ -158,6 +162,17 @@ TEST_P(GemvTests, RealSinglePrecision) {
                                   oneapi::mkl::transpose::trans, 25, 30, alpha, beta, -2, -3, 42));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                   oneapi::mkl::transpose::trans, 25, 30, alpha, beta, 1, 1, 42));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::transpose::nontrans, 300, 400, alpha, beta, 1, 1,
+                                  400));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::transpose::trans, 300, 400, alpha, beta, 1, 1, 400));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::transpose::trans, 25, 30, alpha, beta, 2, 3, 42,
+                                  host_buffers::all));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::transpose::trans, 25, 30, alpha, beta, 2, 3, 42,
+                                  host_buffers::mixed));
 }
 TEST_P(GemvTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
@@ -179,6 +194,12 @@ TEST_P(GemvTests, RealDoublePrecision) {
                                    oneapi::mkl::transpose::trans, 25, 30, alpha, beta, -2, -3, 42));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                    oneapi::mkl::transpose::trans, 25, 30, alpha, beta, 1, 1, 42));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::transpose::nontrans, 300, 400, alpha, beta, 1, 1,
+                                   400));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::transpose::trans, 300, 400, alpha, beta, 1, 1,
+                                   400));
 }
 
 TEST_P(GemvTests, ComplexSinglePrecision) {
@@ -211,6 +232,12 @@ TEST_P(GemvTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                                 oneapi::mkl::transpose::conjtrans, 2, 3, alpha,
                                                 beta, 1, 1, 42));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                oneapi::mkl::transpose::conjtrans, 2, 3, alpha,
+                                                beta, 2, 3, 42, host_buffers::all));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                oneapi::mkl::transpose::conjtrans, 2, 3, alpha,
+                                                beta, 2, 3, 42, host_buffers::mixed));
 }
 
 TEST_P(GemvTests, ComplexDoublePrecision) {
@@ -146,6 +146,8 @@ TEST_P(GerTests, RealSinglePrecision) {
         test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 25, 30, alpha, -2, -3, 42));
     EXPECT_TRUEORSKIP(
         test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 25, 30, alpha, 1, 1, 42));
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300, 400, alpha, 1, 1, 400));
 }
 TEST_P(GerTests, RealDoublePrecision) {
     CHECK_DOUBLE_ON_DEVICE(std::get<0>(GetParam()));
@@ -157,6 +159,8 @@ TEST_P(GerTests, RealDoublePrecision) {
         test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 25, 30, alpha, -2, -3, 42));
     EXPECT_TRUEORSKIP(
         test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 25, 30, alpha, 1, 1, 42));
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 300, 400, alpha, 1, 1, 400));
 }
 
 INSTANTIATE_TEST_SUITE_P(GerTestSuite, GerTests,
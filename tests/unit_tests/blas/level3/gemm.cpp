@@ -50,13 +50,21 @@ namespace {
 template <typename Ta, typename Tc>
 int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
          oneapi::mkl::transpose transb, int m, int n, int k, int lda, int ldb, int ldc, Tc alpha,
-         Tc beta) {
+         Tc beta, bool nan_ab = false, host_buffers buffers = host_buffers::none) {
     // Prepare data.
     vector<Ta, allocator_helper<Ta, 64>> A, B;
     vector<Tc, allocator_helper<Tc, 64>> C, C_ref;
 
     rand_matrix(A, layout, transa, m, k, lda);
     rand_matrix(B, layout, transb, k, n, ldb);
+    if (nan_ab) {
+        // A and B must not be referenced when alpha is zero.
+        std::fill(A.begin(), A.end(), Ta(std::numeric_limits<float>::quiet_NaN()));
+        std::fill(B.begin(), B.end(), Ta(std::numeric_limits<float>::quiet_NaN()));
+    }
+    // An aliased call passes A for B as well, so the shapes of A and B must match.
+    if (buffers == host_buffers::aliased)
+        B = A;
     rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
     C_ref = C;
 
@@ -90,9 +98,16 @@ int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
 
     queue main_queue(*dev, exception_handler);
 
-    buffer<Ta, 1> A_buffer(A.data(), range<1>(A.size()));
-    buffer<Ta, 1> B_buffer(B.data(), range<1>(B.size()));
-    buffer<Tc, 1> C_buffer(C.data(), range<1>(C.size()));
+    buffer<Ta, 1> A_buffer = (buffers != host_buffers::none)
+                                 ? make_host_ptr_buffer(A)
+                                 : buffer<Ta, 1>(A.data(), range<1>(A.size()));
+    buffer<Ta, 1> B_buffer = (buffers == host_buffers::aliased) ? A_buffer
+                             : (buffers == host_buffers::all)
+                                 ? make_host_ptr_buffer(B)
+                                 : buffer<Ta, 1>(B.data(), range<1>(B.size()));
+    buffer<Tc, 1> C_buffer = (buffers != host_buffers::none)
+                                 ? make_host_ptr_buffer(C)
+                                 : buffer<Tc, 1>(C.data(), range<1>(C.size()));
 
     try {
 #ifdef CALL_RT_API
@@ -217,6 +232,27 @@ TEST_P(GemmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP((test<float, float>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
         oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, 12, 7, 5, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, 0.0f, beta, true)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 79, 79, 79, 103, 103, 106, alpha, beta, false,
+        host_buffers::all)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 79, 79, 79, 103, 103, 106, alpha, beta, false,
+        host_buffers::mixed)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 79, 79, 79, 103, 103, 106, alpha, beta, false,
+        host_buffers::aliased)));
 }
 
 TEST_P(GemmTests, RealDoublePrecision) {
@@ -236,6 +272,18 @@ TEST_P(GemmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP((test<double, double>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
         oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, 27, 5, 32, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, 12, 7, 5, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, 0.0, beta, true)));
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 9, 12, 1500, 1501, 1501, 106, alpha, beta)));
 }
 
 TEST_P(GemmTests, ComplexSinglePrecision) {
@@ -268,6 +316,31 @@ TEST_P(GemmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
         oneapi::mkl::transpose::conjtrans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::nontrans, 27, 5, 32, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::trans, 12, 7, 5, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, std::complex<float>(0.0), beta,
+        true)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::conjtrans, 9, 12, 1500, 1501, 1501, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::nontrans, 79, 79, 79, 103, 103, 106, alpha, beta, false,
+        host_buffers::all)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::nontrans, 79, 79, 79, 103, 103, 106, alpha, beta, false,
+        host_buffers::mixed)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::nontrans, 79, 79, 79, 103, 103, 106, alpha, beta, false,
+        host_buffers::aliased)));
 }
 
 TEST_P(GemmTests, ComplexDoublePrecision) {
@@ -302,6 +375,16 @@ TEST_P(GemmTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
         oneapi::mkl::transpose::conjtrans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::conjtrans, 27, 5, 32, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::trans, 12, 7, 5, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, std::complex<double>(0.0), beta,
+        true)));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmTestSuite, GemmTests,
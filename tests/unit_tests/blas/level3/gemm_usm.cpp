@@ -49,7 +49,7 @@ namespace {
 template <typename Ta, typename Tc>
 int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
          oneapi::mkl::transpose transb, int m, int n, int k, int lda, int ldb, int ldc, Tc alpha,
-         Tc beta) {
+         Tc beta, bool nan_ab = false) {
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const& e : exceptions) {
@@ -76,6 +76,11 @@ int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
     vector<Tc, decltype(uc)> C(ua);
     rand_matrix(A, layout, transa, m, k, lda);
     rand_matrix(B, layout, transb, k, n, ldb);
+    if (nan_ab) {
+        // A and B must not be referenced when alpha is zero.
+        std::fill(A.begin(), A.end(), Ta(std::numeric_limits<float>::quiet_NaN()));
+        std::fill(B.begin(), B.end(), Ta(std::numeric_limits<float>::quiet_NaN()));
+    }
     rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
 
     auto C_ref = C;
@@ -216,6 +221,15 @@ TEST_P(GemmUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP((test<float, float>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
         oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, 12, 7, 5, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<float, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, 0.0f, beta, true)));
 }
 
 TEST_P(GemmUsmTests, RealDoublePrecision) {
@@ -235,6 +249,18 @@ TEST_P(GemmUsmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP((test<double, double>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
         oneapi::mkl::transpose::trans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::nontrans, 27, 5, 32, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::trans, 12, 7, 5, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, 0.0, beta, true)));
+    EXPECT_TRUEORSKIP((test<double, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 9, 12, 1500, 1501, 1501, 106, alpha, beta)));
 }
 
 TEST_P(GemmUsmTests, ComplexSinglePrecision) {
@@ -267,6 +293,19 @@ TEST_P(GemmUsmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
         oneapi::mkl::transpose::conjtrans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::nontrans, 27, 5, 32, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::trans, 12, 7, 5, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, std::complex<float>(0.0), beta,
+        true)));
+    EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::trans,
+        oneapi::mkl::transpose::conjtrans, 9, 12, 1500, 1501, 1501, 106, alpha, beta)));
 }
 
 TEST_P(GemmUsmTests, ComplexDoublePrecision) {
@@ -301,6 +340,16 @@ TEST_P(GemmUsmTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
         oneapi::mkl::transpose::conjtrans, 79, 83, 91, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::conjtrans, 27, 5, 32, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::conjtrans,
+        oneapi::mkl::transpose::trans, 12, 7, 5, 103, 105, 106, alpha, beta)));
+    EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::trans, 27, 5, 32, 103, 105, 106, std::complex<double>(0.0), beta,
+        true)));
 }
 
 INSTANTIATE_TEST_SUITE_P(GemmUsmTestSuite, GemmUsmTests,
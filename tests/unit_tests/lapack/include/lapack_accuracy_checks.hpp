@@ -163,6 +163,49 @@ bool check_geqrf_accuracy(int64_t m, int64_t n, const std::vector<fp>& A, int64_
     return result;
 }
 
+/* Same checks as check_geqrf_accuracy, with the m x n factor Q only, so that tall matrices stay
+ * cheap to check. */
+template <typename fp>
+bool check_geqrf_tall_accuracy(int64_t m, int64_t n, const std::vector<fp>& A, int64_t lda,
+                               const std::vector<fp>& tau, const std::vector<fp>& A_initial) {
+    bool result = true;
+    /* |A - Q R| < |A| O(eps) */
+    std::vector<fp> R(m * n);
+    int64_t ldr = m;
+    reference::laset(oneapi::mkl::uplo::lower, m, n, 0.0, 0.0, R.data(), ldr);
+    reference::lacpy(oneapi::mkl::uplo::upper, m, n, A.data(), lda, R.data(), ldr);
+    auto info = reference::or_un_mqr(oneapi::mkl::side::left, oneapi::mkl::transpose::nontrans, m,
+                                     n, n, A.data(), lda, tau.data(), R.data(), ldr);
+    if (0 != info) {
+        test_log::lout << "reference ormqr/unmqr failed with info = " << info << std::endl;
+        return false;
+    }
+    if (!rel_mat_err_check(m, n, R, ldr, A_initial, lda)) {
+        test_log::lout << "Factorization check failed" << std::endl;
+        result = false;
+    }
+
+    /* | I - Q' Q | < m O(eps) */
+    std::vector<fp> Q(m * n);
+    int64_t ldq = m;
+    reference::lacpy('A', m, n, A.data(), lda, Q.data(), ldq);
+    info = reference::or_un_gqr(m, n, n, Q.data(), ldq, tau.data());
+    if (0 != info) {
+        test_log::lout << "reference org/ungqr failed with info = " << info << std::endl;
+        return false;
+    }
+    std::vector<fp> QQ(n * n);
+    int64_t ldqq = n;
+    reference::gemm(oneapi::mkl::transpose::conjtrans, oneapi::mkl::transpose::nontrans, n, n, m,
+                    1.0, Q.data(), ldq, Q.data(), ldq, 0.0, QQ.data(), ldqq);
+    if (!rel_id_err_check(n, QQ, ldqq, 10.0 * m / n)) {
+        test_log::lout << "Orthogonality check failed" << std::endl;
+        result = false;
+    }
+
+    return result;
+}
+
 template <typename fp>
 bool check_gerqf_accuracy(const std::vector<fp>& A, const std::vector<fp>& A_initial,
                           const std::vector<fp>& tau, int64_t m, int64_t n, int64_t lda) {
@@ -582,6 +625,81 @@ bool check_sy_he_evd_accuracy(oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, int
     return result;
 }
 
+/* Reference eigenvalues of the Hermitian matrix A, in ascending order */
+template <typename fp>
+std::vector<typename complex_info<fp>::real_type> reference_sy_he_eigenvalues(
+    oneapi::mkl::uplo uplo, int64_t n, std::vector<fp> A, int64_t lda) {
+    std::vector<typename complex_info<fp>::real_type> D_ref(n);
+    if constexpr (complex_info<fp>::is_complex)
+        reference::heevd(oneapi::mkl::job::novec, uplo, n, A.data(), lda, D_ref.data());
+    else
+        reference::syevd(oneapi::mkl::job::novec, uplo, n, A.data(), lda, D_ref.data());
+    return D_ref;
+}
+
+/* Bounds vl < D_ref[il - 1] <= D_ref[iu - 1] < vu of a values range holding the eigenvalues il
+   to iu, halfway to the neighboring eigenvalues */
+template <typename fp_real>
+void sy_he_evx_value_bounds(int64_t n, int64_t il, int64_t iu, const std::vector<fp_real>& D_ref,
+                            fp_real& vl, fp_real& vu) {
+    vl = il > 1 ? (D_ref[il - 2] + D_ref[il - 1]) / 2 : D_ref[0] - 1;
+    vu = iu < n ? (D_ref[iu - 1] + D_ref[iu]) / 2 : D_ref[n - 1] + 1;
+}
+
+template <typename fp>
+bool check_sy_he_evx_accuracy(oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, int64_t n,
+                              int64_t il, int64_t iu, int64_t m,
+                              const std::vector<typename complex_info<fp>::real_type>& w,
+                              const std::vector<fp>& Z, int64_t ldz, std::vector<fp> A_initial,
+                              int64_t lda) {
+    using fp_real = typename complex_info<fp>::real_type;
+    bool result = true;
+
+    /* The eigenvalues il to iu are found */
+    int64_t count = iu - il + 1;
+    if (m != count) {
+        test_log::lout << "Eigenvalue count check failed: " << m << " != " << count << std::endl;
+        return false;
+    }
+
+    /* |D_ref - D| < |D_ref| O(eps) */
+    auto D_ref = reference_sy_he_eigenvalues(uplo, n, A_initial, lda);
+    std::vector<fp_real> D_ref_range(D_ref.begin() + il - 1, D_ref.begin() + iu);
+    if (!rel_vec_err_check(m, D_ref_range, w, 10.0 * n)) {
+        test_log::lout << "Eigenvalue check failed" << std::endl;
+        result = false;
+    }
+
+    if (oneapi::mkl::job::vec == jobz) {
+        /* |A Z - Z D| < |Z D| O(eps) */
+        hermitian_to_full(uplo, n, A_initial, lda);
+        std::vector<fp> AZ(n * m);
+        int64_t ldaz = n;
+        reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, n, m, n,
+                        1.0, A_initial.data(), lda, Z.data(), ldz, 0.0, AZ.data(), ldaz);
+        std::vector<fp> ZD(n * m);
+        int64_t ldzd = n;
+        for (int64_t col = 0; col < m; col++)
+            for (int64_t row = 0; row < n; row++)
+                ZD[row + col * ldzd] = Z[row + col * ldz] * w[col];
+        if (!rel_mat_err_check(n, m, AZ, ldaz, ZD, ldzd, 10.0 * n)) {
+            test_log::lout << "Eigenvector residual check failed" << std::endl;
+            result = false;
+        }
+
+        /* |I - Z' Z| < m O(eps) */
+        std::vector<fp> ZZ(m * m);
+        int64_t ldzz = m;
+        reference::gemm(oneapi::mkl::transpose::conjtrans, oneapi::mkl::transpose::nontrans, m, m,
+                        n, 1.0, Z.data(), ldz, Z.data(), ldz, 0.0, ZZ.data(), ldzz);
+        if (!rel_id_err_check(m, ZZ, ldzz, 10.0 * n)) {
+            test_log::lout << "Orthogonality check failed" << std::endl;
+            result = false;
+        }
+    }
+    return result;
+}
+
 template <typename fp>
 bool check_trtrs_accuracy(oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
                           oneapi::mkl::diag diag, int64_t n, int64_t nrhs, std::vector<fp> A,
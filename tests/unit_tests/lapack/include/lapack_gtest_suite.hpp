@@ -64,6 +64,14 @@ using ComplexDoublePrecisionUsm = std::complex<double>;
     DEFINE_TEST_ACCURACY_BUFFER_COMPLEX(SUITE);         \
     INSTANTIATE_TEST_CLASS(SUITE, AccuracyBuffer)
 
+#define INSTANTIATE_GTEST_SUITE_ACCURACY_DOUBLE(SUITE) \
+    CREATE_TEST_CLASS(SUITE, AccuracyUsm);             \
+    DEFINE_TEST_ACCURACY_USM_DOUBLE(SUITE);            \
+    INSTANTIATE_TEST_CLASS(SUITE, AccuracyUsm);        \
+    CREATE_TEST_CLASS(SUITE, AccuracyBuffer);          \
+    DEFINE_TEST_ACCURACY_BUFFER_DOUBLE(SUITE);         \
+    INSTANTIATE_TEST_CLASS(SUITE, AccuracyBuffer)
+
 #define INSTANTIATE_GTEST_SUITE_ACCURACY_USM(SUITE) \
     CREATE_TEST_CLASS(SUITE, AccuracyUsm);          \
     DEFINE_TEST_ACCURACY_USM_REAL(SUITE);           \
@@ -80,6 +88,11 @@ using ComplexDoublePrecisionUsm = std::complex<double>;
     DEFINE_TEST_ACCURACY_USM_COMPLEX(SUITE);                \
     INSTANTIATE_TEST_CLASS(SUITE, AccuracyUsm)
 
+#define INSTANTIATE_GTEST_SUITE_ACCURACY_USM_DOUBLE(SUITE) \
+    CREATE_TEST_CLASS(SUITE, AccuracyUsm);                 \
+    DEFINE_TEST_ACCURACY_USM_DOUBLE(SUITE);                \
+    INSTANTIATE_TEST_CLASS(SUITE, AccuracyUsm)
+
 #define DEFINE_TEST_ACCURACY_USM_REAL(SUITE)                                                   \
     TEST_P(SUITE##AccuracyUsm, RealSinglePrecision) {                                          \
         test_log::padding = "[          ] ";                                                   \
@@ -126,6 +139,31 @@ using ComplexDoublePrecisionUsm = std::complex<double>;
             accuracy_controller.run(::accuracy<ComplexDoublePrecisionBuffer>, *GetParam())); \
     }
 
+#define DEFINE_TEST_ACCURACY_USM_DOUBLE(SUITE)                                                    \
+    TEST_P(SUITE##AccuracyUsm, RealDoublePrecision) {                                             \
+        CHECK_DOUBLE_ON_DEVICE(GetParam());                                                       \
+        test_log::padding = "[          ] ";                                                      \
+        EXPECT_TRUE(accuracy_controller.run(::accuracy<RealDoublePrecisionUsm>, *GetParam()));    \
+    }                                                                                             \
+    TEST_P(SUITE##AccuracyUsm, ComplexDoublePrecision) {                                          \
+        CHECK_DOUBLE_ON_DEVICE(GetParam());                                                       \
+        test_log::padding = "[          ] ";                                                      \
+        EXPECT_TRUE(accuracy_controller.run(::accuracy<ComplexDoublePrecisionUsm>, *GetParam())); \
+    }
+
+#define DEFINE_TEST_ACCURACY_BUFFER_DOUBLE(SUITE)                                                 \
+    TEST_P(SUITE##AccuracyBuffer, RealDoublePrecision) {                                          \
+        CHECK_DOUBLE_ON_DEVICE(GetParam());                                                       \
+        test_log::padding = "[          ] ";                                                      \
+        EXPECT_TRUE(accuracy_controller.run(::accuracy<RealDoublePrecisionBuffer>, *GetParam())); \
+    }                                                                                             \
+    TEST_P(SUITE##AccuracyBuffer, ComplexDoublePrecision) {                                       \
+        CHECK_DOUBLE_ON_DEVICE(GetParam());                                                       \
+        test_log::padding = "[          ] ";                                                      \
+        EXPECT_TRUE(                                                                              \
+            accuracy_controller.run(::accuracy<ComplexDoublePrecisionBuffer>, *GetParam()));      \
+    }
+
 #define INSTANTIATE_GTEST_SUITE_DEPENDENCY(SUITE) \
     CREATE_TEST_CLASS(SUITE, DependencyUsm);      \
     DEFINE_TEST_DEPENDENCY_REAL(SUITE);           \
@@ -142,6 +180,11 @@ using ComplexDoublePrecisionUsm = std::complex<double>;
     DEFINE_TEST_DEPENDENCY_COMPLEX(SUITE);                \
     INSTANTIATE_TEST_CLASS(SUITE, DependencyUsm);
 
+#define INSTANTIATE_GTEST_SUITE_DEPENDENCY_DOUBLE(SUITE) \
+    CREATE_TEST_CLASS(SUITE, DependencyUsm);             \
+    DEFINE_TEST_DEPENDENCY_DOUBLE(SUITE);                \
+    INSTANTIATE_TEST_CLASS(SUITE, DependencyUsm);
+
 #define DEFINE_TEST_DEPENDENCY_REAL(SUITE)                                                     \
     TEST_P(SUITE##DependencyUsm, RealSinglePrecision) {                                        \
         test_log::padding = "[          ] ";                                                   \
@@ -167,3 +210,17 @@ using ComplexDoublePrecisionUsm = std::complex<double>;
         EXPECT_TRUE(                                                                              \
             dependency_controller.run(::usm_dependency<ComplexDoublePrecisionUsm>, *GetParam())); \
     }\
+
+#define DEFINE_TEST_DEPENDENCY_DOUBLE(SUITE)                                                      \
+    TEST_P(SUITE##DependencyUsm, RealDoublePrecision) {                                           \
+        CHECK_DOUBLE_ON_DEVICE(GetParam());                                                       \
+        test_log::padding = "[          ] ";                                                      \
+        EXPECT_TRUE(                                                                              \
+            dependency_controller.run(::usm_dependency<RealDoublePrecisionUsm>, *GetParam()));    \
+    }                                                                                             \
+    TEST_P(SUITE##DependencyUsm, ComplexDoublePrecision) {                                        \
+        CHECK_DOUBLE_ON_DEVICE(GetParam());                                                       \
+        test_log::padding = "[          ] ";                                                      \
+        EXPECT_TRUE(                                                                              \
+            dependency_controller.run(::usm_dependency<ComplexDoublePrecisionUsm>, *GetParam())); \
+    }
@@ -448,6 +448,29 @@ inline int64_t gebrd(int64_t m, int64_t n, std::complex<double> *a, int64_t lda,
                           reinterpret_cast<lapack_complex_double *>(taup));
 }
 
+inline int64_t gels(oneapi::mkl::transpose trans, int64_t m, int64_t n, int64_t nrhs,
+                    std::complex<float> *a, int64_t lda, std::complex<float> *b, int64_t ldb) {
+    return LAPACKE_cgels(LAPACK_COL_MAJOR, to_char(trans), m, n, nrhs,
+                         reinterpret_cast<lapack_complex_float *>(a), lda,
+                         reinterpret_cast<lapack_complex_float *>(b), ldb);
+}
+inline int64_t gels(oneapi::mkl::transpose trans, int64_t m, int64_t n, int64_t nrhs, double *a,
+                    int64_t lda, double *b, int64_t ldb) {
+    return LAPACKE_dgels(LAPACK_COL_MAJOR, trans == oneapi::mkl::transpose::nontrans ? 'N' : 'T',
+                         m, n, nrhs, a, lda, b, ldb);
+}
+inline int64_t gels(oneapi::mkl::transpose trans, int64_t m, int64_t n, int64_t nrhs, float *a,
+                    int64_t lda, float *b, int64_t ldb) {
+    return LAPACKE_sgels(LAPACK_COL_MAJOR, trans == oneapi::mkl::transpose::nontrans ? 'N' : 'T',
+                         m, n, nrhs, a, lda, b, ldb);
+}
+inline int64_t gels(oneapi::mkl::transpose trans, int64_t m, int64_t n, int64_t nrhs,
+                    std::complex<double> *a, int64_t lda, std::complex<double> *b, int64_t ldb) {
+    return LAPACKE_zgels(LAPACK_COL_MAJOR, to_char(trans), m, n, nrhs,
+                         reinterpret_cast<lapack_complex_double *>(a), lda,
+                         reinterpret_cast<lapack_complex_double *>(b), ldb);
+}
+
 inline int64_t geqrf(int64_t m, int64_t n, std::complex<float> *a, int64_t lda,
                      std::complex<float> *tau) {
     return LAPACKE_cgeqrf(LAPACK_COL_MAJOR, m, n, reinterpret_cast<lapack_complex_float *>(a), lda,
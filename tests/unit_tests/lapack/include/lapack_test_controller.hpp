@@ -48,6 +48,10 @@ inline std::ostream& operator<<(std::ostream& os, const oneapi::mkl::jobsvd& t)
     os << static_cast<int64_t>(t);
     return os;
 }
+inline std::ostream& operator<<(std::ostream& os, const oneapi::mkl::rangev& t) {
+    os << static_cast<int64_t>(t);
+    return os;
+}
 inline std::ostream& operator<<(std::ostream& os, const oneapi::mkl::transpose& t) {
     os << static_cast<int64_t>(t);
     return os;
@@ -0,0 +1,198 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+0 10 6 3 12 80 12 40 4 27182
+3 6 10 2 7 80 11 30 3 27182
+0 5 9 2 6 60 10 25 3 27182
+3 40 25 4 41 1100 41 200 2 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::transpose trans, int64_t m, int64_t n,
+              int64_t nrhs, int64_t lda, int64_t stride_a, int64_t ldb, int64_t stride_b,
+              int64_t batch_size, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* Initialize: op(A) has rows_b rows and rows_x columns */
+    int64_t rows_b = trans == oneapi::mkl::transpose::nontrans ? m : n;
+    int64_t rows_x = trans == oneapi::mkl::transpose::nontrans ? n : m;
+    std::vector<fp> A(stride_a * batch_size);
+    std::vector<fp> B(stride_b * batch_size);
+    for (int64_t i = 0; i < batch_size; i++) {
+        rand_matrix_diag_dom(seed, oneapi::mkl::transpose::nontrans, m, n, A, lda, i * stride_a);
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, rows_b, nrhs, B, ldb, i * stride_b);
+    }
+
+    std::vector<fp> A_ref = A;
+    std::vector<fp> B_ref = B;
+    for (int64_t i = 0; i < batch_size; i++) {
+        auto info = reference::gels(trans, m, n, nrhs, A_ref.data() + i * stride_a, lda,
+                                    B_ref.data() + i * stride_b, ldb);
+        if (0 != info) {
+            test_log::lout << "batch routine index " << i
+                           << ": reference gels failed with info: " << info << std::endl;
+            return false;
+        }
+    }
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto B_dev = device_alloc<data_T>(queue, B.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::gels_batch_scratchpad_size<fp>(
+            queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_LAPACK_CT_SELECT(
+            queue, scratchpad_size = oneapi::mkl::lapack::gels_batch_scratchpad_size<fp>, trans, m,
+            n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        host_to_device_copy(queue, B.data(), B_dev, B.size());
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::gels_batch(queue, trans, m, n, nrhs, A_dev, lda, stride_a, B_dev, ldb,
+                                        stride_b, batch_size, scratchpad_dev, scratchpad_size);
+#else
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::gels_batch, trans, m, n, nrhs, A_dev,
+                                  lda, stride_a, B_dev, ldb, stride_b, batch_size, scratchpad_dev,
+                                  scratchpad_size);
+#endif
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, B_dev, B.data(), B.size());
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, B_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    /* |X - X_ref| < |X_ref| O(eps), with X_ref the solution of reference gels */
+    bool result = true;
+    for (int64_t i = 0; i < batch_size; i++) {
+        auto B_ = copy_vector(B, ldb * nrhs, i * stride_b);
+        auto B_ref_ = copy_vector(B_ref, ldb * nrhs, i * stride_b);
+        if (!rel_mat_err_check(rows_x, nrhs, B_, ldb, B_ref_, ldb)) {
+            test_log::lout << "batch routine index " << i << " failed" << std::endl;
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+const char* dependency_input = R"(
+0 1 1 1 1 1 1 1 1 1
+)";
+
+template <typename data_T>
+bool usm_dependency(const sycl::device& dev, oneapi::mkl::transpose trans, int64_t m, int64_t n,
+                    int64_t nrhs, int64_t lda, int64_t stride_a, int64_t ldb, int64_t stride_b,
+                    int64_t batch_size, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* Initialize */
+    int64_t rows_b = trans == oneapi::mkl::transpose::nontrans ? m : n;
+    std::vector<fp> A(stride_a * batch_size);
+    std::vector<fp> B(stride_b * batch_size);
+    for (int64_t i = 0; i < batch_size; i++) {
+        rand_matrix_diag_dom(seed, oneapi::mkl::transpose::nontrans, m, n, A, lda, i * stride_a);
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, rows_b, nrhs, B, ldb, i * stride_b);
+    }
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto B_dev = device_alloc<data_T>(queue, B.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::gels_batch_scratchpad_size<fp>(
+            queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_LAPACK_CT_SELECT(
+            queue, scratchpad_size = oneapi::mkl::lapack::gels_batch_scratchpad_size<fp>, trans, m,
+            n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        host_to_device_copy(queue, B.data(), B_dev, B.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependency(queue);
+#ifdef CALL_RT_API
+        sycl::event func_event = oneapi::mkl::lapack::gels_batch(
+            queue, trans, m, n, nrhs, A_dev, lda, stride_a, B_dev, ldb, stride_b, batch_size,
+            scratchpad_dev, scratchpad_size, std::vector<sycl::event>{ in_event });
+#else
+        sycl::event func_event;
+        TEST_RUN_LAPACK_CT_SELECT(queue, func_event = oneapi::mkl::lapack::gels_batch, trans, m, n,
+                                  nrhs, A_dev, lda, stride_a, B_dev, ldb, stride_b, batch_size,
+                                  scratchpad_dev, scratchpad_size,
+                                  std::vector<sycl::event>{ in_event });
+#endif
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev);
+        device_free(queue, B_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(GelsBatchStride);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY(GelsBatchStride);
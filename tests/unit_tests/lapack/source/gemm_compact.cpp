@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+0 0 21 13 17 22 18 23 4 11 27182
+1 1 9 12 40 41 13 10 4 9 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::transpose transa,
+              oneapi::mkl::transpose transb, int64_t m, int64_t n, int64_t k, int64_t lda,
+              int64_t ldb, int64_t ldc, int64_t interleave, int64_t batch_size, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* Initialize */
+    const fp alpha = 1.5;
+    const fp beta = -0.5;
+    const bool is_transa = transa != oneapi::mkl::transpose::nontrans;
+    const bool is_transb = transb != oneapi::mkl::transpose::nontrans;
+    const int64_t rows_a = is_transa ? k : m, cols_a = is_transa ? m : k;
+    const int64_t rows_b = is_transb ? n : k, cols_b = is_transb ? k : n;
+    const int64_t stride_a = lda * cols_a;
+    const int64_t stride_b = ldb * cols_b;
+    const int64_t stride_c = ldc * n;
+    const int64_t padded_size = (batch_size + interleave - 1) / interleave * interleave;
+    std::vector<fp> A(stride_a * batch_size);
+    std::vector<fp> B(stride_b * batch_size);
+    std::vector<fp> C_initial(stride_c * batch_size);
+    for (int64_t i = 0; i < batch_size; i++) {
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, rows_a, cols_a, A, lda, i * stride_a);
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, rows_b, cols_b, B, ldb, i * stride_b);
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, C_initial, ldc, i * stride_c);
+    }
+
+    std::vector<fp> C = C_initial;
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto B_dev = device_alloc<data_T>(queue, B.size());
+        auto C_dev = device_alloc<data_T>(queue, C.size());
+        auto Ap_dev = device_alloc<data_T>(queue, padded_size * stride_a);
+        auto Bp_dev = device_alloc<data_T>(queue, padded_size * stride_b);
+        auto Cp_dev = device_alloc<data_T>(queue, padded_size * stride_c);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        host_to_device_copy(queue, B.data(), B_dev, B.size());
+        host_to_device_copy(queue, C.data(), C_dev, C.size());
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::pack_compact(queue, rows_a, cols_a, A_dev, lda, stride_a, Ap_dev,
+                                          lda, interleave, batch_size);
+        oneapi::mkl::lapack::pack_compact(queue, rows_b, cols_b, B_dev, ldb, stride_b, Bp_dev,
+                                          ldb, interleave, batch_size);
+        oneapi::mkl::lapack::pack_compact(queue, m, n, C_dev, ldc, stride_c, Cp_dev, ldc,
+                                          interleave, batch_size);
+        queue.wait_and_throw();
+        oneapi::mkl::lapack::gemm_compact(queue, transa, transb, m, n, k, alpha, Ap_dev, lda,
+                                          Bp_dev, ldb, beta, Cp_dev, ldc, interleave, batch_size);
+        queue.wait_and_throw();
+        oneapi::mkl::lapack::unpack_compact(queue, m, n, Cp_dev, ldc, C_dev, ldc, stride_c,
+                                            interleave, batch_size);
+#else
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::pack_compact, rows_a, cols_a, A_dev,
+                                  lda, stride_a, Ap_dev, lda, interleave, batch_size);
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::pack_compact, rows_b, cols_b, B_dev,
+                                  ldb, stride_b, Bp_dev, ldb, interleave, batch_size);
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::pack_compact, m, n, C_dev, ldc,
+                                  stride_c, Cp_dev, ldc, interleave, batch_size);
+        queue.wait_and_throw();
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::gemm_compact, transa, transb, m, n,
+                                  k, alpha, Ap_dev, lda, Bp_dev, ldb, beta, Cp_dev, ldc,
+                                  interleave, batch_size);
+        queue.wait_and_throw();
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::unpack_compact, m, n, Cp_dev, ldc,
+                                  C_dev, ldc, stride_c, interleave, batch_size);
+#endif
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, C_dev, C.data(), C.size());
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, B_dev);
+        device_free(queue, C_dev);
+        device_free(queue, Ap_dev);
+        device_free(queue, Bp_dev);
+        device_free(queue, Cp_dev);
+    }
+
+    bool result = true;
+    for (int64_t i = 0; i < batch_size; i++) {
+        auto C_ = copy_vector(C, ldc * n, i * stride_c);
+        auto C_ref = copy_vector(C_initial, ldc * n, i * stride_c);
+        reference::gemm(transa, transb, m, n, k, alpha, A.data() + i * stride_a, lda,
+                        B.data() + i * stride_b, ldb, beta, C_ref.data(), ldc);
+        if (!rel_mat_err_check(m, n, C_, ldc, C_ref, ldc)) {
+            test_log::lout << "batch routine index " << i << " failed" << std::endl;
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+const char* dependency_input = R"(
+0 0 1 1 1 1 1 1 1 1 1
+)";
+
+template <typename data_T>
+bool usm_dependency(const sycl::device& dev, oneapi::mkl::transpose transa,
+                    oneapi::mkl::transpose transb, int64_t m, int64_t n, int64_t k, int64_t lda,
+                    int64_t ldb, int64_t ldc, int64_t interleave, int64_t batch_size,
+                    uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* With interleave 1, the compact layout is the strided layout */
+    const fp alpha = 1.5;
+    const fp beta = -0.5;
+    const int64_t stride_a = lda * (transa != oneapi::mkl::transpose::nontrans ? m : k);
+    const int64_t stride_b = ldb * (transb != oneapi::mkl::transpose::nontrans ? k : n);
+    const int64_t stride_c = ldc * n;
+    std::vector<fp> A(stride_a * batch_size);
+    std::vector<fp> B(stride_b * batch_size);
+    std::vector<fp> C(stride_c * batch_size);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, lda, stride_a / lda * batch_size, A, lda);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, ldb, stride_b / ldb * batch_size, B, ldb);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, ldc, n * batch_size, C, ldc);
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto B_dev = device_alloc<data_T>(queue, B.size());
+        auto C_dev = device_alloc<data_T>(queue, C.size());
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        host_to_device_copy(queue, B.data(), B_dev, B.size());
+        host_to_device_copy(queue, C.data(), C_dev, C.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependency(queue);
+#ifdef CALL_RT_API
+        sycl::event func_event = oneapi::mkl::lapack::gemm_compact(
+            queue, transa, transb, m, n, k, alpha, A_dev, lda, B_dev, ldb, beta, C_dev, ldc,
+            interleave, batch_size, std::vector<sycl::event>{ in_event });
+#else
+        sycl::event func_event;
+        TEST_RUN_LAPACK_CT_SELECT(queue, func_event = oneapi::mkl::lapack::gemm_compact, transa,
+                                  transb, m, n, k, alpha, A_dev, lda, B_dev, ldb, beta, C_dev, ldc,
+                                  interleave, batch_size, std::vector<sycl::event>{ in_event });
+#endif
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev);
+        device_free(queue, B_dev);
+        device_free(queue, C_dev);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_REAL(GemmCompact);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY_REAL(GemmCompact);
@@ -0,0 +1,239 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+3 3 100 80 10 6 1 104 101 12 27182
+3 3 40 60 5 0 2 40 40 5 27182
+3 0 64 64 8 8 0 64 64 8 27182
+0 3 50 70 12 4 1 53 50 12 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+              int64_t m, int64_t n, int64_t k, int64_t oversample, int64_t power_iters,
+              int64_t lda, int64_t ldu, int64_t ldvt, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+
+    /* Initialize: A = X Y has rank k, so its range is found exactly */
+    int64_t min_mn = std::min(m, n);
+    std::vector<fp> X(m * k), Y(k * n);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, k, X, m);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, k, n, Y, k);
+
+    std::vector<fp> A(lda * n);
+    reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, m, n, k,
+                    1.0, X.data(), m, Y.data(), k, 0.0, A.data(), lda);
+    std::vector<fp> U(ldu * k);
+    std::vector<fp> Vt(ldvt * n);
+    std::vector<fp_real> s(k);
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto U_dev = device_alloc<data_T>(queue, U.size());
+        auto Vt_dev = device_alloc<data_T>(queue, Vt.size());
+        auto s_dev = device_alloc<data_T, fp_real>(queue, s.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::gesvd_randomized_scratchpad_size<fp>(
+            queue, jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_LAPACK_CT_SELECT(
+            queue, scratchpad_size = oneapi::mkl::lapack::gesvd_randomized_scratchpad_size<fp>,
+            jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::gesvd_randomized(queue, jobu, jobvt, m, n, k, oversample, power_iters,
+                                              seed, A_dev, lda, s_dev, U_dev, ldu, Vt_dev, ldvt,
+                                              scratchpad_dev, scratchpad_size);
+#else
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::gesvd_randomized, jobu, jobvt, m, n,
+                                  k, oversample, power_iters, seed, A_dev, lda, s_dev, U_dev, ldu,
+                                  Vt_dev, ldvt, scratchpad_dev, scratchpad_size);
+#endif
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, U_dev, U.data(), U.size());
+        device_to_host_copy(queue, Vt_dev, Vt.data(), Vt.size());
+        device_to_host_copy(queue, s_dev, s.data(), s.size());
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, U_dev);
+        device_free(queue, Vt_dev);
+        device_free(queue, s_dev);
+        device_free(queue, scratchpad_dev);
+    }
+    bool result = true;
+
+    /* |s - s_ref| < |s_ref| O(eps), with s_ref the k largest singular values of A */
+    std::vector<fp> A_ref = A;
+    std::vector<fp_real> s_ref(min_mn), superb(min_mn);
+    reference::gesvd(oneapi::mkl::jobsvd::novec, oneapi::mkl::jobsvd::novec, m, n, A_ref.data(),
+                     lda, s_ref.data(), nullptr, 1, nullptr, 1, superb.data());
+    s_ref.resize(k);
+    if (!rel_vec_err_check(k, s, s_ref, 10.0 * std::max(m, n))) {
+        test_log::lout << "Singular values check failed" << std::endl;
+        result = false;
+    }
+
+    if (jobu == oneapi::mkl::jobsvd::somevec && jobvt == oneapi::mkl::jobsvd::somevec) {
+        /* |A - U S V'| < |A| O(eps) */
+        std::vector<fp> US(m * k);
+        int64_t ldus = m;
+        for (int64_t col = 0; col < k; col++)
+            for (int64_t row = 0; row < m; row++)
+                US[row + col * ldus] = U[row + col * ldu] * s[col];
+        std::vector<fp> USV(m * n);
+        int64_t ldusv = m;
+        reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, m, n, k,
+                        1.0, US.data(), ldus, Vt.data(), ldvt, 0.0, USV.data(), ldusv);
+        if (!rel_mat_err_check(m, n, A, lda, USV, ldusv)) {
+            test_log::lout << "Factorization check failed" << std::endl;
+            result = false;
+        }
+    }
+
+    if (jobu == oneapi::mkl::jobsvd::somevec) {
+        /* |I - U' U| < n O(eps) */
+        std::vector<fp> UU(k * k);
+        int64_t lduu = k;
+        reference::gemm(oneapi::mkl::transpose::conjtrans, oneapi::mkl::transpose::nontrans, k, k,
+                        m, 1.0, U.data(), ldu, U.data(), ldu, 0.0, UU.data(), lduu);
+        if (!rel_id_err_check(k, UU, lduu)) {
+            test_log::lout << "U Orthogonality check failed" << std::endl;
+            result = false;
+        }
+    }
+
+    if (jobvt == oneapi::mkl::jobsvd::somevec) {
+        /* |I - V' V| < n O(eps) */
+        std::vector<fp> VV(k * k);
+        int64_t ldvv = k;
+        reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::conjtrans, k, k,
+                        n, 1.0, Vt.data(), ldvt, Vt.data(), ldvt, 0.0, VV.data(), ldvv);
+        if (!rel_id_err_check(k, VV, ldvv)) {
+            test_log::lout << "V Orthogonality check failed" << std::endl;
+            result = false;
+        }
+    }
+    return result;
+}
+
+const char* dependency_input = R"(
+3 3 1 1 1 0 0 1 1 1 1
+)";
+
+template <typename data_T>
+bool usm_dependency(const sycl::device& dev, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                    int64_t m, int64_t n, int64_t k, int64_t oversample, int64_t power_iters,
+                    int64_t lda, int64_t ldu, int64_t ldvt, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+
+    /* Initialize */
+    std::vector<fp> A(lda * n);
+    std::vector<fp> U(ldu * k);
+    std::vector<fp> Vt(ldvt * n);
+    std::vector<fp_real> s(k);
+
+    rand_matrix_diag_dom(seed, oneapi::mkl::transpose::nontrans, m, n, A, lda);
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto U_dev = device_alloc<data_T>(queue, U.size());
+        auto Vt_dev = device_alloc<data_T>(queue, Vt.size());
+        auto s_dev = device_alloc<data_T, fp_real>(queue, s.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::gesvd_randomized_scratchpad_size<fp>(
+            queue, jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_LAPACK_CT_SELECT(
+            queue, scratchpad_size = oneapi::mkl::lapack::gesvd_randomized_scratchpad_size<fp>,
+            jobu, jobvt, m, n, k, oversample, power_iters, lda, ldu, ldvt);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependency(queue);
+#ifdef CALL_RT_API
+        sycl::event func_event = oneapi::mkl::lapack::gesvd_randomized(
+            queue, jobu, jobvt, m, n, k, oversample, power_iters, seed, A_dev, lda, s_dev, U_dev,
+            ldu, Vt_dev, ldvt, scratchpad_dev, scratchpad_size,
+            std::vector<sycl::event>{ in_event });
+#else
+        sycl::event func_event;
+        TEST_RUN_LAPACK_CT_SELECT(queue, func_event = oneapi::mkl::lapack::gesvd_randomized, jobu,
+                                  jobvt, m, n, k, oversample, power_iters, seed, A_dev, lda, s_dev,
+                                  U_dev, ldu, Vt_dev, ldvt, scratchpad_dev, scratchpad_size,
+                                  std::vector<sycl::event>{ in_event });
+#endif
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev);
+        device_free(queue, U_dev);
+        device_free(queue, Vt_dev);
+        device_free(queue, s_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(GesvdRandomized);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY(GesvdRandomized);
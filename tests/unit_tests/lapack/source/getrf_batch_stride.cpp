@@ -37,6 +37,7 @@ namespace {
 
 const char* accuracy_input = R"(
 31 27 33 1024 3 27182
+40 35 41 1700 3 27182
 )";
 
 template <typename data_T>
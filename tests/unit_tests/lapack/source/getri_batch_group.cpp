@@ -17,7 +17,9 @@
 * SPDX-License-Identifier: Apache-2.0
 *******************************************************************************/
 
+#include <algorithm>
 #include <complex>
+#include <exception>
 #include <list>
 #include <numeric>
 #include <vector>
@@ -38,32 +40,46 @@
 namespace {
 
 const char* accuracy_input = R"(
-27182
+0 27182
+1 27182
 )";
 
 template <typename fp>
-bool accuracy(const sycl::device& dev, uint64_t seed) {
+bool accuracy(const sycl::device& dev, int64_t mixed_sizes, uint64_t seed) {
     using fp_real = typename complex_info<fp>::real_type;
 
     /* Test Parameters */
     std::vector<int64_t> n_vec = { 6, 4 };
     std::vector<int64_t> lda_vec = { 7, 6 };
     std::vector<int64_t> group_sizes_vec = { 2, 2 };
+    std::vector<int64_t> singular_ids;
+
+    /* Groups of very different sizes, in an order unrelated to their cost, and
+     * problems with a zero on the diagonal of U, for which getri reports
+     * info = k + 1. Results, info values and workspace must follow the order
+     * of the groups whatever order the backend solves the problems in. */
+    if (mixed_sizes) {
+        n_vec = { 2, 140, 5, 1, 48 };
+        lda_vec = { 3, 141, 5, 2, 50 };
+        group_sizes_vec = { 3, 1, 2, 2, 1 };
+        singular_ids = { 2, 5, 8 };
+    }
 
     int64_t group_count = group_sizes_vec.size();
     int64_t batch_size = std::accumulate(group_sizes_vec.begin(), group_sizes_vec.end(), 0);
+    std::vector<int64_t> info_vec(batch_size, 0);
 
     std::list<std::vector<fp>> A_initial_list;
     std::list<std::vector<fp>> A_list;
     std::list<std::vector<int64_t>> ipiv_list;
 
-    for (int64_t group_id = 0; group_id < group_count; group_id++) {
+    for (int64_t group_id = 0, global_id = 0; group_id < group_count; group_id++) {
         auto n = n_vec[group_id];
         auto lda = lda_vec[group_id];
         auto group_size = group_sizes_vec[group_id];
 
         /* Allocate and Initialize on host */
-        for (int64_t local_id = 0; local_id < group_size; local_id++) {
+        for (int64_t local_id = 0; local_id < group_size; local_id++, global_id++) {
             A_initial_list.emplace_back(lda * n);
             auto& A_initial = A_initial_list.back();
             rand_matrix(seed, oneapi::mkl::transpose::nontrans, n, n, A_initial, lda);
@@ -79,12 +95,27 @@ bool accuracy(const sycl::device& dev, uint64_t seed) {
                 test_log::lout << "Reference getrf failed with info = " << info << std::endl;
                 return false;
             }
+
+            if (std::find(singular_ids.begin(), singular_ids.end(), global_id) !=
+                singular_ids.end()) {
+                const int64_t k = n - 1 - global_id % n;
+                A[k + k * lda] = fp{ 0 };
+                info_vec[global_id] = k + 1;
+            }
         }
     }
 
+    /* The workspace of the problems must stay within scratchpad_size */
+    const int64_t guard_size = 64;
+    std::vector<fp> guard(guard_size, fp{ -7 });
+
     /* Compute on device */
+    std::vector<std::exception_ptr> errors;
     {
-        sycl::queue queue{ dev, async_error_handler };
+        sycl::queue queue{ dev, [&errors](sycl::exception_list exceptions) {
+                              for (auto const& e : exceptions)
+                                  errors.push_back(e);
+                          } };
 
         std::list<std::vector<fp, sycl::usm_allocator<fp, sycl::usm::alloc::shared>>> A_dev_list;
         std::list<std::vector<int64_t, sycl::usm_allocator<int64_t, sycl::usm::alloc::shared>>>
@@ -114,7 +145,8 @@ bool accuracy(const sycl::device& dev, uint64_t seed) {
             queue, scratchpad_size = oneapi::mkl::lapack::getri_batch_scratchpad_size<fp>,
             n_vec.data(), lda_vec.data(), group_count, group_sizes_vec.data());
 #endif
-        auto scratchpad_dev = device_alloc<fp>(queue, scratchpad_size);
+        auto scratchpad_dev = device_alloc<fp>(queue, scratchpad_size + guard_size);
+        host_to_device_copy(queue, guard.data(), scratchpad_dev + scratchpad_size, guard_size);
 
         auto A_dev_iter = A_dev_list.begin();
         auto ipiv_dev_iter = ipiv_dev_list.begin();
@@ -133,21 +165,27 @@ bool accuracy(const sycl::device& dev, uint64_t seed) {
         }
         queue.wait_and_throw();
 
+        try {
 #ifdef CALL_RT_API
-        oneapi::mkl::lapack::getri_batch(queue, n_vec.data(), A_dev_ptrs, lda_vec.data(),
-                                         ipiv_dev_ptrs, group_count, group_sizes_vec.data(),
-                                         scratchpad_dev, scratchpad_size);
+            oneapi::mkl::lapack::getri_batch(queue, n_vec.data(), A_dev_ptrs, lda_vec.data(),
+                                             ipiv_dev_ptrs, group_count, group_sizes_vec.data(),
+                                             scratchpad_dev, scratchpad_size);
 #else
-        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::getri_batch, n_vec.data(), A_dev_ptrs,
-                                  lda_vec.data(), ipiv_dev_ptrs, group_count,
-                                  group_sizes_vec.data(), scratchpad_dev, scratchpad_size);
+            TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::getri_batch, n_vec.data(),
+                                      A_dev_ptrs, lda_vec.data(), ipiv_dev_ptrs, group_count,
+                                      group_sizes_vec.data(), scratchpad_dev, scratchpad_size);
 #endif
-        queue.wait_and_throw();
+            queue.wait_and_throw();
+        }
+        catch (...) {
+            errors.push_back(std::current_exception());
+        }
 
         A_iter = A_list.begin();
         for (int64_t global_id = 0; global_id < batch_size; global_id++, A_iter++) {
             device_to_host_copy(queue, A_dev_ptrs[global_id], A_iter->data(), A_iter->size());
         }
+        device_to_host_copy(queue, scratchpad_dev + scratchpad_size, guard.data(), guard_size);
         queue.wait_and_throw();
         if (scratchpad_dev) {
             sycl::free(scratchpad_dev, queue);
@@ -162,6 +200,51 @@ bool accuracy(const sycl::device& dev, uint64_t seed) {
 
     bool result = true;
 
+    if (std::any_of(guard.begin(), guard.end(), [](fp x) { return x != fp{ -7 }; })) {
+        test_log::lout << "getri_batch wrote past the end of the scratchpad" << std::endl;
+        result = false;
+    }
+
+    /* Failures must be reported by global id, with the info of each problem */
+    const size_t expected_errors = singular_ids.empty() ? 0 : 1;
+    if (errors.size() != expected_errors) {
+        test_log::lout << "expected " << expected_errors << " exception(s), got " << errors.size()
+                       << std::endl;
+        result = false;
+    }
+    for (auto const& error : errors) {
+        try {
+            std::rethrow_exception(error);
+        }
+        catch (oneapi::mkl::lapack::batch_error const& e) {
+            if (e.ids() != singular_ids) {
+                test_log::lout << "batch_error reports the wrong problem ids" << std::endl;
+                result = false;
+            }
+            for (size_t i = 0; i < e.ids().size() && i < e.exceptions().size(); i++) {
+                const int64_t id = e.ids()[i];
+                try {
+                    std::rethrow_exception(e.exceptions()[i]);
+                }
+                catch (oneapi::mkl::lapack::computation_error const& c) {
+                    if (id < 0 || id >= batch_size || c.info() != info_vec[id]) {
+                        test_log::lout << "problem " << id << " reports info = " << c.info()
+                                       << std::endl;
+                        result = false;
+                    }
+                }
+                catch (std::exception const& c) {
+                    test_log::lout << c.what() << std::endl;
+                    result = false;
+                }
+            }
+        }
+        catch (std::exception const& e) {
+            test_log::lout << e.what() << std::endl;
+            result = false;
+        }
+    }
+
     int64_t global_id = 0;
     auto A_iter = A_list.begin();
     auto ipiv_iter = ipiv_list.begin();
@@ -172,6 +255,8 @@ bool accuracy(const sycl::device& dev, uint64_t seed) {
         auto group_size = group_sizes_vec[group_id];
         for (int64_t local_id = 0; local_id < group_size;
              local_id++, global_id++, A_iter++, ipiv_iter++, A_initial_iter++) {
+            if (info_vec[global_id] != 0)
+                continue;
             if (!check_getri_accuracy(n, *A_iter, lda, *ipiv_iter, *A_initial_iter)) {
                 test_log::lout << "batch routine (" << global_id << ", " << group_id << ", "
                                << local_id << ") (global_id, group_id, local_id) failed"
@@ -37,6 +37,7 @@ namespace {
 
 const char* accuracy_input = R"(
 0 6 10 7 70 10 12 120 3 27182
+1 40 5 41 1700 45 45 300 3 27182
 )";
 
 template <typename data_T>
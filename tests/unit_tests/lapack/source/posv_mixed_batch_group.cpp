@@ -0,0 +1,309 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <list>
+#include <numeric>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+27182
+)";
+
+template <typename fp>
+bool accuracy(const sycl::device& dev, uint64_t seed) {
+    /* Test Parameters */
+    std::vector<oneapi::mkl::uplo> uplo_vec = { oneapi::mkl::uplo::upper,
+                                                oneapi::mkl::uplo::lower };
+    std::vector<int64_t> n_vec = { 6, 20 };
+    std::vector<int64_t> nrhs_vec = { 3, 2 };
+    std::vector<int64_t> lda_vec = { 7, 21 };
+    std::vector<int64_t> ldb_vec = { 8, 22 };
+    std::vector<int64_t> ldx_vec = { 9, 20 };
+    std::vector<int64_t> group_sizes_vec = { 3, 2 };
+
+    int64_t group_count = group_sizes_vec.size();
+    int64_t batch_size = std::accumulate(group_sizes_vec.begin(), group_sizes_vec.end(), 0);
+
+    std::list<std::vector<fp>> A_initial_list;
+    std::list<std::vector<fp>> B_initial_list;
+    std::list<std::vector<fp>> X_list;
+
+    for (int64_t group_id = 0; group_id < group_count; group_id++) {
+        auto uplo = uplo_vec[group_id];
+        auto n = n_vec[group_id];
+        auto nrhs = nrhs_vec[group_id];
+        auto lda = lda_vec[group_id];
+        auto ldb = ldb_vec[group_id];
+        auto ldx = ldx_vec[group_id];
+        auto group_size = group_sizes_vec[group_id];
+
+        /* Allocate and Initialize on host */
+        for (int64_t local_id = 0; local_id < group_size; local_id++) {
+            A_initial_list.emplace_back(lda * n);
+            auto& A_initial = A_initial_list.back();
+            rand_pos_def_matrix(seed, uplo, n, A_initial, lda);
+
+            B_initial_list.emplace_back(ldb * nrhs);
+            auto& B_initial = B_initial_list.back();
+            rand_matrix(seed, oneapi::mkl::transpose::nontrans, n, nrhs, B_initial, ldb);
+
+            X_list.emplace_back(ldx * nrhs);
+        }
+    }
+    std::vector<int64_t> iter(batch_size);
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        std::list<std::vector<fp, sycl::usm_allocator<fp, sycl::usm::alloc::shared>>> A_dev_list;
+        std::list<std::vector<fp, sycl::usm_allocator<fp, sycl::usm::alloc::shared>>> B_dev_list;
+        std::list<std::vector<fp, sycl::usm_allocator<fp, sycl::usm::alloc::shared>>> X_dev_list;
+        fp** A_dev_ptrs = sycl::malloc_shared<fp*>(batch_size, queue);
+        fp** B_dev_ptrs = sycl::malloc_shared<fp*>(batch_size, queue);
+        fp** X_dev_ptrs = sycl::malloc_shared<fp*>(batch_size, queue);
+        auto iter_dev = device_alloc<fp, int64_t>(queue, batch_size);
+
+        /* Allocate on device */
+        sycl::usm_allocator<fp, sycl::usm::alloc::shared> usm_fp_allocator{ queue.get_context(),
+                                                                            dev };
+        auto A_iter = A_initial_list.begin();
+        auto B_iter = B_initial_list.begin();
+        auto X_iter = X_list.begin();
+        for (int64_t group_id = 0; group_id < group_count; group_id++) {
+            for (int64_t local_id = 0; local_id < group_sizes_vec[group_id];
+                 local_id++, A_iter++, B_iter++, X_iter++) {
+                A_dev_list.emplace_back(A_iter->size(), usm_fp_allocator);
+                B_dev_list.emplace_back(B_iter->size(), usm_fp_allocator);
+                X_dev_list.emplace_back(X_iter->size(), usm_fp_allocator);
+            }
+        }
+
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::posv_mixed_batch_scratchpad_size<fp>(
+            queue, uplo_vec.data(), n_vec.data(), nrhs_vec.data(), lda_vec.data(), ldb_vec.data(),
+            ldx_vec.data(), group_count, group_sizes_vec.data());
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_LAPACK_CT_SELECT(
+            queue, scratchpad_size = oneapi::mkl::lapack::posv_mixed_batch_scratchpad_size<fp>,
+            uplo_vec.data(), n_vec.data(), nrhs_vec.data(), lda_vec.data(), ldb_vec.data(),
+            ldx_vec.data(), group_count, group_sizes_vec.data());
+#endif
+        auto scratchpad_dev = device_alloc<fp>(queue, scratchpad_size);
+
+        auto A_dev_iter = A_dev_list.begin();
+        auto B_dev_iter = B_dev_list.begin();
+        auto X_dev_iter = X_dev_list.begin();
+        for (int64_t global_id = 0; global_id < batch_size;
+             global_id++, A_dev_iter++, B_dev_iter++, X_dev_iter++) {
+            A_dev_ptrs[global_id] = A_dev_iter->data();
+            B_dev_ptrs[global_id] = B_dev_iter->data();
+            X_dev_ptrs[global_id] = X_dev_iter->data();
+        }
+
+        A_iter = A_initial_list.begin();
+        B_iter = B_initial_list.begin();
+        for (int64_t global_id = 0; global_id < batch_size; global_id++, A_iter++, B_iter++) {
+            host_to_device_copy(queue, A_iter->data(), A_dev_ptrs[global_id], A_iter->size());
+            host_to_device_copy(queue, B_iter->data(), B_dev_ptrs[global_id], B_iter->size());
+        }
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::posv_mixed_batch(queue, uplo_vec.data(), n_vec.data(),
+                                              nrhs_vec.data(), A_dev_ptrs, lda_vec.data(),
+                                              B_dev_ptrs, ldb_vec.data(), X_dev_ptrs,
+                                              ldx_vec.data(), iter_dev, group_count,
+                                              group_sizes_vec.data(), scratchpad_dev,
+                                              scratchpad_size);
+#else
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::posv_mixed_batch, uplo_vec.data(),
+                                  n_vec.data(), nrhs_vec.data(), A_dev_ptrs, lda_vec.data(),
+                                  B_dev_ptrs, ldb_vec.data(), X_dev_ptrs, ldx_vec.data(), iter_dev,
+                                  group_count, group_sizes_vec.data(), scratchpad_dev,
+                                  scratchpad_size);
+#endif
+        queue.wait_and_throw();
+
+        X_iter = X_list.begin();
+        for (int64_t global_id = 0; global_id < batch_size; global_id++, X_iter++) {
+            device_to_host_copy(queue, X_dev_ptrs[global_id], X_iter->data(), X_iter->size());
+        }
+        device_to_host_copy(queue, iter_dev, iter.data(), iter.size());
+        queue.wait_and_throw();
+        if (scratchpad_dev) {
+            sycl::free(scratchpad_dev, queue);
+        }
+        if (iter_dev) {
+            sycl::free(iter_dev, queue);
+        }
+        if (A_dev_ptrs) {
+            sycl::free(A_dev_ptrs, queue);
+        }
+        if (B_dev_ptrs) {
+            sycl::free(B_dev_ptrs, queue);
+        }
+        if (X_dev_ptrs) {
+            sycl::free(X_dev_ptrs, queue);
+        }
+    }
+
+    bool result = true;
+
+    int64_t global_id = 0;
+    auto X_iter = X_list.begin();
+    auto A_initial_iter = A_initial_list.begin();
+    auto B_initial_iter = B_initial_list.begin();
+    for (int64_t group_id = 0; group_id < group_count; group_id++) {
+        auto uplo = uplo_vec[group_id];
+        auto n = n_vec[group_id];
+        auto nrhs = nrhs_vec[group_id];
+        auto lda = lda_vec[group_id];
+        auto ldb = ldb_vec[group_id];
+        auto ldx = ldx_vec[group_id];
+        auto group_size = group_sizes_vec[group_id];
+        for (int64_t local_id = 0; local_id < group_size;
+             local_id++, global_id++, X_iter++, A_initial_iter++, B_initial_iter++) {
+            /* The solution is checked in the layout of B */
+            std::vector<fp> X_ldb(ldb * nrhs);
+            reference::lacpy('A', n, nrhs, X_iter->data(), ldx, X_ldb.data(), ldb);
+            if (!check_potrs_accuracy(uplo, n, nrhs, X_ldb, ldb, *A_initial_iter, lda,
+                                      *B_initial_iter)) {
+                test_log::lout << "batch routine (" << global_id << ", " << group_id << ", "
+                               << local_id << ") (global_id, group_id, local_id) failed"
+                               << ", refinement iterations = " << iter[global_id] << std::endl;
+                result = false;
+            }
+        }
+    }
+
+    return result;
+}
+
+const char* dependency_input = R"(
+1
+)";
+
+template <typename fp>
+bool usm_dependency(const sycl::device& dev, uint64_t seed) {
+    /* Test Parameters */
+    std::vector<oneapi::mkl::uplo> uplo_vec = { oneapi::mkl::uplo::upper };
+    std::vector<int64_t> n_vec = { 1 };
+    std::vector<int64_t> nrhs_vec = { 1 };
+    std::vector<int64_t> lda_vec = { 1 };
+    std::vector<int64_t> ldb_vec = { 1 };
+    std::vector<int64_t> ldx_vec = { 1 };
+    std::vector<int64_t> group_sizes_vec = { 1 };
+
+    int64_t group_count = group_sizes_vec.size();
+    int64_t batch_size = std::accumulate(group_sizes_vec.begin(), group_sizes_vec.end(), 0);
+
+    std::vector<fp> A(lda_vec[0] * n_vec[0]);
+    std::vector<fp> B(ldb_vec[0] * nrhs_vec[0]);
+    rand_pos_def_matrix(seed, uplo_vec[0], n_vec[0], A, lda_vec[0]);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, n_vec[0], nrhs_vec[0], B, ldb_vec[0]);
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        fp** A_dev_ptrs = sycl::malloc_shared<fp*>(batch_size, queue);
+        fp** B_dev_ptrs = sycl::malloc_shared<fp*>(batch_size, queue);
+        fp** X_dev_ptrs = sycl::malloc_shared<fp*>(batch_size, queue);
+        A_dev_ptrs[0] = device_alloc<fp>(queue, A.size());
+        B_dev_ptrs[0] = device_alloc<fp>(queue, B.size());
+        X_dev_ptrs[0] = device_alloc<fp>(queue, ldx_vec[0] * nrhs_vec[0]);
+        auto iter_dev = device_alloc<fp, int64_t>(queue, batch_size);
+
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::posv_mixed_batch_scratchpad_size<fp>(
+            queue, uplo_vec.data(), n_vec.data(), nrhs_vec.data(), lda_vec.data(), ldb_vec.data(),
+            ldx_vec.data(), group_count, group_sizes_vec.data());
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_LAPACK_CT_SELECT(
+            queue, scratchpad_size = oneapi::mkl::lapack::posv_mixed_batch_scratchpad_size<fp>,
+            uplo_vec.data(), n_vec.data(), nrhs_vec.data(), lda_vec.data(), ldb_vec.data(),
+            ldx_vec.data(), group_count, group_sizes_vec.data());
+#endif
+        auto scratchpad_dev = device_alloc<fp>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev_ptrs[0], A.size());
+        host_to_device_copy(queue, B.data(), B_dev_ptrs[0], B.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependency(queue);
+#ifdef CALL_RT_API
+        sycl::event func_event = oneapi::mkl::lapack::posv_mixed_batch(
+            queue, uplo_vec.data(), n_vec.data(), nrhs_vec.data(), A_dev_ptrs, lda_vec.data(),
+            B_dev_ptrs, ldb_vec.data(), X_dev_ptrs, ldx_vec.data(), iter_dev, group_count,
+            group_sizes_vec.data(), scratchpad_dev, scratchpad_size,
+            std::vector<sycl::event>{ in_event });
+#else
+        sycl::event func_event;
+        TEST_RUN_LAPACK_CT_SELECT(queue, func_event = oneapi::mkl::lapack::posv_mixed_batch,
+                                  uplo_vec.data(), n_vec.data(), nrhs_vec.data(), A_dev_ptrs,
+                                  lda_vec.data(), B_dev_ptrs, ldb_vec.data(), X_dev_ptrs,
+                                  ldx_vec.data(), iter_dev, group_count, group_sizes_vec.data(),
+                                  scratchpad_dev, scratchpad_size,
+                                  std::vector<sycl::event>{ in_event });
+#endif
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev_ptrs[0]);
+        device_free(queue, B_dev_ptrs[0]);
+        device_free(queue, X_dev_ptrs[0]);
+        device_free(queue, iter_dev);
+        device_free(queue, scratchpad_dev);
+        sycl::free(A_dev_ptrs, queue);
+        sycl::free(B_dev_ptrs, queue);
+        sycl::free(X_dev_ptrs, queue);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM_DOUBLE(PosvMixedBatchGroup);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY_DOUBLE(PosvMixedBatchGroup);
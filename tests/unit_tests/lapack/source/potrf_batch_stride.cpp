@@ -37,6 +37,7 @@ namespace {
 
 const char* accuracy_input = R"(
 1 4 15 123 3 27182
+0 40 41 1700 3 27182
 )";
 
 template <typename data_T>
@@ -37,6 +37,7 @@ namespace {
 
 const char* accuracy_input = R"(
 1 4 15 5 123 22 400 3 27182
+0 40 5 41 1700 45 300 3 27182
 )";
 
 template <typename data_T>
@@ -0,0 +1,214 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+
+namespace {
+
+const char* accuracy_input = R"(
+1 1 0 20 21 430 5 12 20 22 450 3 27182
+1 2 1 30 30 900 1 8 30 31 930 2 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+              oneapi::mkl::uplo uplo, int64_t n, int64_t lda, int64_t stride_a, int64_t il,
+              int64_t iu, int64_t stride_w, int64_t ldz, int64_t stride_z, int64_t batch_size,
+              uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+
+    /* Initialize */
+    std::vector<fp> A_initial(stride_a * batch_size);
+    for (int64_t i = 0; i < batch_size; i++)
+        rand_hermitian_matrix(seed, uplo, n, A_initial, lda, i * stride_a);
+
+    std::vector<fp> A = A_initial;
+    std::vector<int64_t> m(batch_size);
+    std::vector<fp_real> w(stride_w * batch_size);
+    std::vector<fp> Z(stride_z * batch_size);
+
+    /* The values range applies to every matrix, so it is taken from the first one. The bounds
+       are halfway between eigenvalues, so the others are seeded to share its spectrum. */
+    fp_real vl = 0.0, vu = 0.0, abstol = 0.0;
+    if (range == oneapi::mkl::rangev::values) {
+        for (int64_t i = 1; i < batch_size; i++)
+            std::copy(A_initial.begin(), A_initial.begin() + lda * n,
+                      A_initial.begin() + i * stride_a);
+        A = A_initial;
+        sy_he_evx_value_bounds(n, il, iu, reference_sy_he_eigenvalues(uplo, n, A, lda), vl, vu);
+    }
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto m_dev = device_alloc<data_T, int64_t>(queue, m.size());
+        auto w_dev = device_alloc<data_T, fp_real>(queue, w.size());
+        auto Z_dev = device_alloc<data_T>(queue, Z.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::syevx_batch_scratchpad_size<fp>(
+            queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_LAPACK_CT_SELECT(
+            queue, scratchpad_size = oneapi::mkl::lapack::syevx_batch_scratchpad_size<fp>, jobz,
+            range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::syevx_batch(queue, jobz, range, uplo, n, A_dev, lda, stride_a, vl, vu,
+                                         il, iu, abstol, m_dev, w_dev, stride_w, Z_dev, ldz,
+                                         stride_z, batch_size, scratchpad_dev, scratchpad_size);
+#else
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::syevx_batch, jobz, range, uplo, n,
+                                  A_dev, lda, stride_a, vl, vu, il, iu, abstol, m_dev, w_dev,
+                                  stride_w, Z_dev, ldz, stride_z, batch_size, scratchpad_dev,
+                                  scratchpad_size);
+#endif
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, m_dev, m.data(), m.size());
+        device_to_host_copy(queue, w_dev, w.data(), w.size());
+        device_to_host_copy(queue, Z_dev, Z.data(), Z.size());
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, m_dev);
+        device_free(queue, w_dev);
+        device_free(queue, Z_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    bool result = true;
+    for (int64_t i = 0; i < batch_size; i++) {
+        auto w_ = copy_vector(w, n, i * stride_w);
+        auto Z_ = copy_vector(Z, ldz * n, i * stride_z);
+        auto A_initial_ = copy_vector(A_initial, lda * n, i * stride_a);
+        if (!check_sy_he_evx_accuracy(jobz, uplo, n, il, iu, m[i], w_, Z_, ldz, A_initial_,
+                                      lda)) {
+            test_log::lout << "batch routine index " << i << " failed" << std::endl;
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+const char* dependency_input = R"(
+1 2 1 1 1 1 1 1 1 1 1 1 1
+)";
+
+template <typename data_T>
+bool usm_dependency(const sycl::device& dev, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                    oneapi::mkl::uplo uplo, int64_t n, int64_t lda, int64_t stride_a, int64_t il,
+                    int64_t iu, int64_t stride_w, int64_t ldz, int64_t stride_z,
+                    int64_t batch_size, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+
+    /* Initialize */
+    std::vector<fp> A(stride_a * batch_size);
+    for (int64_t i = 0; i < batch_size; i++)
+        rand_hermitian_matrix(seed, uplo, n, A, lda, i * stride_a);
+
+    std::vector<fp_real> w(stride_w * batch_size);
+    std::vector<fp> Z(stride_z * batch_size);
+    fp_real vl = 0.0, vu = 0.0, abstol = 0.0;
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto m_dev = device_alloc<data_T, int64_t>(queue, batch_size);
+        auto w_dev = device_alloc<data_T, fp_real>(queue, w.size());
+        auto Z_dev = device_alloc<data_T>(queue, Z.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::syevx_batch_scratchpad_size<fp>(
+            queue, jobz, range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_LAPACK_CT_SELECT(
+            queue, scratchpad_size = oneapi::mkl::lapack::syevx_batch_scratchpad_size<fp>, jobz,
+            range, uplo, n, lda, stride_a, stride_w, ldz, stride_z, batch_size);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependency(queue);
+#ifdef CALL_RT_API
+        sycl::event func_event = oneapi::mkl::lapack::syevx_batch(
+            queue, jobz, range, uplo, n, A_dev, lda, stride_a, vl, vu, il, iu, abstol, m_dev, w_dev,
+            stride_w, Z_dev, ldz, stride_z, batch_size, scratchpad_dev, scratchpad_size,
+            std::vector<sycl::event>{ in_event });
+#else
+        sycl::event func_event;
+        TEST_RUN_LAPACK_CT_SELECT(queue, func_event = oneapi::mkl::lapack::syevx_batch, jobz,
+                                  range, uplo, n, A_dev, lda, stride_a, vl, vu, il, iu, abstol,
+                                  m_dev, w_dev, stride_w, Z_dev, ldz, stride_z, batch_size,
+                                  scratchpad_dev, scratchpad_size,
+                                  std::vector<sycl::event>{ in_event });
+#endif
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev);
+        device_free(queue, m_dev);
+        device_free(queue, w_dev);
+        device_free(queue, Z_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_REAL(SyevxBatchStride);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY_REAL(SyevxBatchStride);
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+0 1 0 0 23 5 24 24 4 11 27182
+1 0 1 1 5 6 7 6 4 9 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+              oneapi::mkl::transpose trans, oneapi::mkl::diag diag, int64_t m, int64_t n,
+              int64_t lda, int64_t ldb, int64_t interleave, int64_t batch_size, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* Initialize */
+    const fp alpha = 2.0;
+    const int64_t k = side == oneapi::mkl::side::left ? m : n;
+    const int64_t stride_a = lda * k;
+    const int64_t stride_b = ldb * n;
+    const int64_t padded_size = (batch_size + interleave - 1) / interleave * interleave;
+    std::vector<fp> A(stride_a * batch_size);
+    std::vector<fp> B_initial(stride_b * batch_size);
+    for (int64_t i = 0; i < batch_size; i++) {
+        rand_matrix_diag_dom(seed, oneapi::mkl::transpose::nontrans, k, k, A, lda, i * stride_a);
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, B_initial, ldb, i * stride_b);
+    }
+
+    std::vector<fp> B = B_initial;
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto B_dev = device_alloc<data_T>(queue, B.size());
+        auto Ap_dev = device_alloc<data_T>(queue, padded_size * stride_a);
+        auto Bp_dev = device_alloc<data_T>(queue, padded_size * stride_b);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        host_to_device_copy(queue, B.data(), B_dev, B.size());
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::pack_compact(queue, k, k, A_dev, lda, stride_a, Ap_dev, lda,
+                                          interleave, batch_size);
+        oneapi::mkl::lapack::pack_compact(queue, m, n, B_dev, ldb, stride_b, Bp_dev, ldb,
+                                          interleave, batch_size);
+        queue.wait_and_throw();
+        oneapi::mkl::lapack::trsm_compact(queue, side, uplo, trans, diag, m, n, alpha, Ap_dev, lda,
+                                          Bp_dev, ldb, interleave, batch_size);
+        queue.wait_and_throw();
+        oneapi::mkl::lapack::unpack_compact(queue, m, n, Bp_dev, ldb, B_dev, ldb, stride_b,
+                                            interleave, batch_size);
+#else
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::pack_compact, k, k, A_dev, lda,
+                                  stride_a, Ap_dev, lda, interleave, batch_size);
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::pack_compact, m, n, B_dev, ldb,
+                                  stride_b, Bp_dev, ldb, interleave, batch_size);
+        queue.wait_and_throw();
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::trsm_compact, side, uplo, trans,
+                                  diag, m, n, alpha, Ap_dev, lda, Bp_dev, ldb, interleave,
+                                  batch_size);
+        queue.wait_and_throw();
+        TEST_RUN_LAPACK_CT_SELECT(queue, oneapi::mkl::lapack::unpack_compact, m, n, Bp_dev, ldb,
+                                  B_dev, ldb, stride_b, interleave, batch_size);
+#endif
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, B_dev, B.data(), B.size());
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, B_dev);
+        device_free(queue, Ap_dev);
+        device_free(queue, Bp_dev);
+    }
+
+    /* op(A) * X = alpha * B or X * op(A) = alpha * B */
+    bool result = true;
+    for (int64_t i = 0; i < batch_size; i++) {
+        auto X = copy_vector(B, ldb * n, i * stride_b);
+        auto B_initial_ = copy_vector(B_initial, ldb * n, i * stride_b);
+        for (auto& b : B_initial_)
+            b *= alpha;
+        reference::trmm(side, uplo, trans, diag, m, n, 1.0, A.data() + i * stride_a, lda,
+                        X.data(), ldb);
+        if (!rel_mat_err_check(m, n, X, ldb, B_initial_, ldb)) {
+            test_log::lout << "batch routine index " << i << " failed" << std::endl;
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+const char* dependency_input = R"(
+0 0 0 0 1 1 1 1 1 1 1
+)";
+
+template <typename data_T>
+bool usm_dependency(const sycl::device& dev, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                    oneapi::mkl::transpose trans, oneapi::mkl::diag diag, int64_t m, int64_t n,
+                    int64_t lda, int64_t ldb, int64_t interleave, int64_t batch_size,
+                    uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* With interleave 1, the compact layout is the strided layout */
+    const fp alpha = 2.0;
+    const int64_t k = side == oneapi::mkl::side::left ? m : n;
+    const int64_t stride_a = lda * k;
+    const int64_t stride_b = ldb * n;
+    std::vector<fp> A(stride_a * batch_size);
+    std::vector<fp> B(stride_b * batch_size);
+    for (int64_t i = 0; i < batch_size; i++) {
+        rand_matrix_diag_dom(seed, oneapi::mkl::transpose::nontrans, k, k, A, lda, i * stride_a);
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, B, ldb, i * stride_b);
+    }
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto B_dev = device_alloc<data_T>(queue, B.size());
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        host_to_device_copy(queue, B.data(), B_dev, B.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependency(queue);
+#ifdef CALL_RT_API
+        sycl::event func_event = oneapi::mkl::lapack::trsm_compact(
+            queue, side, uplo, trans, diag, m, n, alpha, A_dev, lda, B_dev, ldb, interleave,
+            batch_size, std::vector<sycl::event>{ in_event });
+#else
+        sycl::event func_event;
+        TEST_RUN_LAPACK_CT_SELECT(queue, func_event = oneapi::mkl::lapack::trsm_compact, side,
+                                  uplo, trans, diag, m, n, alpha, A_dev, lda, B_dev, ldb,
+                                  interleave, batch_size, std::vector<sycl::event>{ in_event });
+#endif
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev);
+        device_free(queue, B_dev);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_REAL(TrsmCompact);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY_REAL(TrsmCompact);
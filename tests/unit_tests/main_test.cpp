@@ -152,7 +152,7 @@ int main(int argc, char** argv) {
     }
 
 #if defined(ENABLE_MKLCPU_BACKEND) || defined(ENABLE_NETLIB_BACKEND) || \
-    defined(ENABLE_PORTBLAS_BACKEND_INTEL_CPU)
+    defined(ENABLE_NETLIB_LAPACK_BACKEND) || defined(ENABLE_PORTBLAS_BACKEND_INTEL_CPU)
 #ifdef __HIPSYCL__
     local_devices.push_back(sycl::device(sycl::cpu_selector()));
 #else